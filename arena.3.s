@@ -0,0 +1,1007 @@
+    .data
+
+_arenas_218:
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .long 0
+    .long 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .long 0
+    .long 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .long 0
+    .long 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .long 0
+    .long 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .long 0
+    .long 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .long 0
+    .long 0
+
+_free_blocks_219:
+    .quad 0
+
+_generation_220:
+    .long 1
+
+    .text
+
+_L_str_263:
+    .asciz "ast"
+
+_L_str_265:
+    .asciz "type"
+
+_L_str_267:
+    .asciz "symbol"
+
+_L_str_269:
+    .asciz "string"
+
+_L_str_271:
+    .asciz "macro"
+
+_L_str_273:
+    .asciz "expansion"
+
+_L_str_275:
+    .asciz "**unknown**"
+
+_L_str_329:
+    .asciz "%-10s %10s %12s %12s %8s\012"
+
+_L_str_330:
+    .asciz "region"
+
+_L_str_331:
+    .asciz "allocs"
+
+_L_str_332:
+    .asciz "allocated"
+
+_L_str_333:
+    .asciz "reserved"
+
+_L_str_334:
+    .asciz "blocks"
+
+_L_str_337:
+    .asciz "%-10s %10d %12lu %12lu %8d\012"
+
+_L_str_339:
+    .asciz "%-10s %10s %12lu %12lu %8s\012"
+
+_L_str_340:
+    .asciz "total"
+
+_L_str_341:
+    .asciz ""
+
+_align_size:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $8, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    pushq %rax
+    movl  $8, %eax
+    movslq %eax, %rax
+    movq  %rax, %rdi
+    popq  %rax
+    xorq  %rdx, %rdx
+    divq  %rdi
+    pushq %rax
+    movl  $8, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    jmp   _LBB0_0
+_LBB0_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_block_data:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $24, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    jmp   _LBB1_0
+_LBB1_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_new_block:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movl  $24, %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _malloc
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -16(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movl  $0, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -16(%rbp), %rax
+    jmp   _LBB2_0
+_LBB2_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_get_block:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+## func body
+## local scalar init
+    leaq  -8(%rbp), %rax
+    pushq %rax
+    movq  _free_blocks_219(%rip), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -8(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB4_3
+## if-then
+    subq  $16, %rsp
+    movl  $64, %eax
+    pushq %rax
+    movl  $1024, %eax
+    popq  %rdx
+    imull %edx, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _new_block
+    addq  $16, %rsp
+    jmp   _LBB3_0
+    jmp   _LBB4_2
+## if-else
+_LBB4_3:
+_LBB4_2:
+## assign
+    leaq  _free_blocks_219(%rip), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movl  $0, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -8(%rbp), %rax
+    jmp   _LBB3_0
+_LBB3_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_free_block_list:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## while-cond
+_LBB6_4:
+    movq  -16(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB6_2
+## while-body
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB6_4
+_LBB6_2:
+_LBB5_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_region_to_string:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movl  %edi, -4(%rbp)
+## func body
+## switch-value
+    movl  -4(%rbp), %eax
+## begin jump table
+    cmpl  $0, %eax
+    je    _LBB8_362
+    cmpl  $1, %eax
+    je    _LBB8_364
+    cmpl  $2, %eax
+    je    _LBB8_366
+    cmpl  $3, %eax
+    je    _LBB8_368
+    cmpl  $4, %eax
+    je    _LBB8_370
+    cmpl  $5, %eax
+    je    _LBB8_372
+    jmp   _LBB8_374
+    jmp   _LBB8_2
+## end jump table
+_LBB8_362:
+    leaq  _L_str_263(%rip), %rax
+    jmp   _LBB7_0
+_LBB8_364:
+    leaq  _L_str_265(%rip), %rax
+    jmp   _LBB7_0
+_LBB8_366:
+    leaq  _L_str_267(%rip), %rax
+    jmp   _LBB7_0
+_LBB8_368:
+    leaq  _L_str_269(%rip), %rax
+    jmp   _LBB7_0
+_LBB8_370:
+    leaq  _L_str_271(%rip), %rax
+    jmp   _LBB7_0
+_LBB8_372:
+    leaq  _L_str_273(%rip), %rax
+    jmp   _LBB7_0
+_LBB8_374:
+    leaq  _L_str_275(%rip), %rax
+    jmp   _LBB7_0
+_LBB8_2:
+_LBB7_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _arena_alloc
+_arena_alloc:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movl  %edi, -4(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    leaq  _arenas_218(%rip), %rax
+    pushq %rax
+    movl  $40, %eax
+    pushq %rax
+    movl  -4(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _align_size
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -40(%rbp), %rax
+    pushq %rax
+    movl  $1024, %eax
+    movslq %eax, %rax
+    movq  %rax, %rdx
+    popq  %rax
+    cmpq  %rdx, %rax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB10_3
+## if-then
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -40(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _new_block
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -32(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## add-assign
+    movq  -24(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    addq  %rax, (%rdx)
+    movq  (%rdx), %rax
+    movq  -24(%rbp), %rax
+    addq  $36, %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB10_2
+## if-else
+_LBB10_3:
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -32(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB12_2
+    movq  -32(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movq  -40(%rbp), %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, %rdx
+    popq  %rax
+    cmpq  %rdx, %rax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB12_2
+    movl  $0, %eax
+_LBB12_2:
+    cmpl  $0, %eax
+    je    _LBB11_3
+## if-then
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    callq _get_block
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -32(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## add-assign
+    movq  -24(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    addq  %rax, (%rdx)
+    movq  (%rdx), %rax
+    movq  -24(%rbp), %rax
+    addq  $36, %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB11_2
+## if-else
+_LBB11_3:
+_LBB11_2:
+_LBB10_2:
+## assign
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -32(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _block_data
+    addq  $8, %rsp
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## add-assign
+    movq  -32(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movq  -40(%rbp), %rax
+    popq  %rdx
+    addq  %rax, (%rdx)
+    movq  (%rdx), %rax
+## add-assign
+    movq  -24(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movq  -40(%rbp), %rax
+    popq  %rdx
+    addq  %rax, (%rdx)
+    movq  (%rdx), %rax
+    movq  -24(%rbp), %rax
+    addq  $32, %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    subq  $32, %rsp
+    movq  -48(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movq  -40(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movq  8(%rsp), %rdx
+    callq _memset
+    addq  $32, %rsp
+    movq  -48(%rbp), %rax
+    jmp   _LBB9_0
+_LBB9_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _reset_arena
+_reset_arena:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movl  %edi, -4(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    leaq  _arenas_218(%rip), %rax
+    pushq %rax
+    movl  $40, %eax
+    pushq %rax
+    movl  -4(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -24(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB14_3
+## if-then
+## while-cond
+_LBB15_4:
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    je    _LBB15_2
+## while-body
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB15_4
+_LBB15_2:
+## assign
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  _free_blocks_219(%rip), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  _free_blocks_219(%rip), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB14_2
+## if-else
+_LBB14_3:
+_LBB14_2:
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free_block_list
+    addq  $16, %rsp
+## assign
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -16(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movl  $0, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -16(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    movl  $0, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -16(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -16(%rbp), %rax
+    addq  $36, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+_LBB13_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _reset_arenas
+_reset_arenas:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+## func body
+## for-pre
+## assign
+    leaq  -4(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB17_1:
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  $6, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB17_2
+## for-body
+    subq  $16, %rsp
+    movl  -4(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _reset_arena
+    addq  $16, %rsp
+## for-post
+_LBB17_4:
+    leaq  -4(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB17_1
+_LBB17_2:
+    leaq  _generation_220(%rip), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+_LBB16_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _arena_generation
+_arena_generation:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $0, %rsp
+## func params
+## func body
+    movl  _generation_220(%rip), %eax
+    jmp   _LBB18_0
+_LBB18_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _free_arenas
+_free_arenas:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $0, %rsp
+## func params
+## func body
+    callq _reset_arenas
+    subq  $16, %rsp
+    movq  _free_blocks_219(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free_block_list
+    addq  $16, %rsp
+## assign
+    leaq  _free_blocks_219(%rip), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+_LBB19_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _print_arena_stats
+_print_arena_stats:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+## func body
+## local scalar init
+    leaq  -8(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $48, %rsp
+    leaq  _L_str_329(%rip), %rax
+    movq  %rax, 40(%rsp)
+    leaq  _L_str_330(%rip), %rax
+    movq  %rax, 32(%rsp)
+    leaq  _L_str_331(%rip), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_332(%rip), %rax
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_333(%rip), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_334(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  40(%rsp), %rdi
+    movq  32(%rsp), %rsi
+    movq  24(%rsp), %rdx
+    movq  16(%rsp), %rcx
+    movq  8(%rsp), %r8
+    movq  (%rsp), %r9
+    movb  $0, %al
+    callq _printf
+    addq  $48, %rsp
+## for-pre
+## assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB21_1:
+    movl  -20(%rbp), %eax
+    pushq %rax
+    movl  $6, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB21_2
+## for-body
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    leaq  _arenas_218(%rip), %rax
+    pushq %rax
+    movl  $40, %eax
+    pushq %rax
+    movl  -20(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $48, %rsp
+    leaq  _L_str_337(%rip), %rax
+    movq  %rax, 40(%rsp)
+    subq  $16, %rsp
+    movl  -20(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _region_to_string
+    addq  $16, %rsp
+    movq  %rax, 32(%rsp)
+    movq  -32(%rbp), %rax
+    addq  $32, %rax
+    movl  (%rax), %eax
+    movl  %eax, 24(%rsp)
+    movq  -32(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movq  -32(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  -32(%rbp), %rax
+    addq  $36, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movq  40(%rsp), %rdi
+    movq  32(%rsp), %rsi
+    movl  24(%rsp), %edx
+    movq  16(%rsp), %rcx
+    movq  8(%rsp), %r8
+    movl  (%rsp), %r9d
+    movb  $0, %al
+    callq _printf
+    addq  $48, %rsp
+## add-assign
+    leaq  -8(%rbp), %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    addq  %rax, (%rdx)
+    movq  (%rdx), %rax
+## add-assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    addq  %rax, (%rdx)
+    movq  (%rdx), %rax
+## for-post
+_LBB21_4:
+    leaq  -20(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB21_1
+_LBB21_2:
+    subq  $48, %rsp
+    leaq  _L_str_339(%rip), %rax
+    movq  %rax, 40(%rsp)
+    leaq  _L_str_340(%rip), %rax
+    movq  %rax, 32(%rsp)
+    leaq  _L_str_341(%rip), %rax
+    movq  %rax, 24(%rsp)
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_341(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  40(%rsp), %rdi
+    movq  32(%rsp), %rsi
+    movq  24(%rsp), %rdx
+    movq  16(%rsp), %rcx
+    movq  8(%rsp), %r8
+    movq  (%rsp), %r9
+    movb  $0, %al
+    callq _printf
+    addq  $48, %rsp
+_LBB20_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
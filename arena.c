@@ -0,0 +1,172 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "arena.h"
+
+static struct arena arenas[ARENA_REGION_COUNT];
+/* standard size blocks given back by reset_arenas() to be reused */
+static struct arena_block *free_blocks = NULL;
+/* incremented every reset so that caches can tell their entries are gone */
+static int generation = 1;
+
+static size_t align_size(size_t size)
+{
+    return (size + ARENA_ALIGNMENT - 1) / ARENA_ALIGNMENT * ARENA_ALIGNMENT;
+}
+
+static char *block_data(struct arena_block *block)
+{
+    /* data follows the header. the header size is a multiple of alignment */
+    return (char *) (block + 1);
+}
+
+static struct arena_block *new_block(size_t size)
+{
+    struct arena_block *block = malloc(sizeof(struct arena_block) + size);
+
+    block->next = NULL;
+    block->size = size;
+    block->used = 0;
+
+    return block;
+}
+
+static struct arena_block *get_block(void)
+{
+    struct arena_block *block = free_blocks;
+
+    if (!block)
+        return new_block(ARENA_BLOCK_SIZE);
+
+    free_blocks = block->next;
+    block->next = NULL;
+    block->used = 0;
+
+    return block;
+}
+
+static void free_block_list(struct arena_block *block)
+{
+    struct arena_block *b = block, *tmp;
+
+    while (b) {
+        tmp = b->next;
+        free(b);
+        b = tmp;
+    }
+}
+
+static const char *region_to_string(int region)
+{
+    switch (region) {
+    case ARENA_AST: return "ast";
+    case ARENA_TYPE: return "type";
+    case ARENA_SYMBOL: return "symbol";
+    case ARENA_STRING: return "string";
+    case ARENA_MACRO: return "macro";
+    case ARENA_EXPANSION: return "expansion";
+    default: return "**unknown**";
+    }
+}
+
+void *arena_alloc(int region, size_t size)
+{
+    struct arena *a = &arenas[region];
+    struct arena_block *block = NULL;
+    const size_t alloc = align_size(size);
+    char *p = NULL;
+
+    if (alloc > ARENA_LARGE_SIZE) {
+        /* large objects do not share blocks */
+        block = new_block(alloc);
+        block->next = a->large_blocks;
+        a->large_blocks = block;
+        a->bytes_reserved += block->size;
+        a->block_count++;
+    }
+    else {
+        block = a->blocks;
+        if (!block || block->used + alloc > block->size) {
+            block = get_block();
+            block->next = a->blocks;
+            a->blocks = block;
+            a->bytes_reserved += block->size;
+            a->block_count++;
+        }
+    }
+
+    p = block_data(block) + block->used;
+    block->used += alloc;
+
+    a->bytes_allocated += alloc;
+    a->alloc_count++;
+
+    memset(p, 0, alloc);
+    return p;
+}
+
+void reset_arena(int region)
+{
+    struct arena *a = &arenas[region];
+    struct arena_block *tail = a->blocks;
+
+    /* move standard blocks to the free list instead of freeing them */
+    if (tail) {
+        while (tail->next)
+            tail = tail->next;
+        tail->next = free_blocks;
+        free_blocks = a->blocks;
+    }
+    free_block_list(a->large_blocks);
+
+    a->blocks = NULL;
+    a->large_blocks = NULL;
+    a->bytes_allocated = 0;
+    a->bytes_reserved = 0;
+    a->alloc_count = 0;
+    a->block_count = 0;
+}
+
+void reset_arenas(void)
+{
+    int i;
+
+    for (i = 0; i < ARENA_REGION_COUNT; i++)
+        reset_arena(i);
+    generation++;
+}
+
+int arena_generation(void)
+{
+    return generation;
+}
+
+void free_arenas(void)
+{
+    reset_arenas();
+    free_block_list(free_blocks);
+    free_blocks = NULL;
+}
+
+void print_arena_stats(void)
+{
+    size_t total_allocated = 0;
+    size_t total_reserved = 0;
+    int i;
+
+    printf("%-10s %10s %12s %12s %8s\n",
+            "region", "allocs", "allocated", "reserved", "blocks");
+
+    for (i = 0; i < ARENA_REGION_COUNT; i++) {
+        const struct arena *a = &arenas[i];
+
+        printf("%-10s %10d %12lu %12lu %8d\n", region_to_string(i),
+                a->alloc_count, a->bytes_allocated, a->bytes_reserved, a->block_count);
+
+        total_allocated += a->bytes_allocated;
+        total_reserved += a->bytes_reserved;
+    }
+
+    printf("%-10s %10s %12lu %12lu %8s\n",
+            "total", "", total_allocated, total_reserved, "");
+}
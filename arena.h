@@ -0,0 +1,51 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stddef.h>
+
+/* objects living as long as a translation unit are allocated from one of
+ * these regions and released all together by reset_arenas() */
+enum arena_region {
+    ARENA_AST,
+    ARENA_TYPE,
+    ARENA_SYMBOL,
+    ARENA_STRING,
+    ARENA_MACRO,
+    /* scratch tokens of one macro expansion. see reset_arena() */
+    ARENA_EXPANSION,
+    ARENA_REGION_COUNT
+};
+
+#define ARENA_BLOCK_SIZE (64 * 1024)
+/* requests larger than this get a dedicated block */
+#define ARENA_LARGE_SIZE 1024
+#define ARENA_ALIGNMENT 8
+
+struct arena_block {
+    struct arena_block *next;
+    size_t size;
+    size_t used;
+};
+
+struct arena {
+    struct arena_block *blocks;
+    struct arena_block *large_blocks;
+
+    /* statistics */
+    size_t bytes_allocated;
+    size_t bytes_reserved;
+    int alloc_count;
+    int block_count;
+};
+
+/* returns zero-filled memory */
+extern void *arena_alloc(int region, size_t size);
+
+extern void reset_arenas(void);
+/* releases one region only. does not invalidate caches of other regions */
+extern void reset_arena(int region);
+extern int arena_generation(void);
+extern void free_arenas(void);
+extern void print_arena_stats(void);
+
+#endif /* _H */
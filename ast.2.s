@@ -0,0 +1,2982 @@
+    .data
+
+_node_pool_1030:
+    .long 0
+    .zero 1
+    .zero 1
+    .zero 1
+    .zero 1
+    .quad 0
+    .long 0
+    .long 0
+    .long 0
+    .zero 1
+    .zero 1
+    .zero 1
+    .zero 1
+
+_type_name_1354:
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+
+    .text
+
+_L_str_1195:
+    .asciz "null"
+
+_L_str_1199:
+    .asciz "NOD_NOP"
+
+_L_str_1201:
+    .asciz "NOD_LIST"
+
+_L_str_1203:
+    .asciz "NOD_COMPOUND"
+
+_L_str_1205:
+    .asciz "NOD_BREAK"
+
+_L_str_1207:
+    .asciz "NOD_CONTINUE"
+
+_L_str_1209:
+    .asciz "NOD_RETURN"
+
+_L_str_1211:
+    .asciz "NOD_GOTO"
+
+_L_str_1213:
+    .asciz "NOD_IF"
+
+_L_str_1215:
+    .asciz "NOD_IF_THEN"
+
+_L_str_1217:
+    .asciz "NOD_SWITCH"
+
+_L_str_1219:
+    .asciz "NOD_CASE"
+
+_L_str_1221:
+    .asciz "NOD_DEFAULT"
+
+_L_str_1223:
+    .asciz "NOD_LABEL"
+
+_L_str_1225:
+    .asciz "NOD_FOR"
+
+_L_str_1227:
+    .asciz "NOD_FOR_PRE_COND"
+
+_L_str_1229:
+    .asciz "NOD_FOR_BODY_POST"
+
+_L_str_1231:
+    .asciz "NOD_WHILE"
+
+_L_str_1233:
+    .asciz "NOD_DOWHILE"
+
+_L_str_1235:
+    .asciz "NOD_ASSIGN"
+
+_L_str_1237:
+    .asciz "NOD_ADD_ASSIGN"
+
+_L_str_1239:
+    .asciz "NOD_SUB_ASSIGN"
+
+_L_str_1241:
+    .asciz "NOD_MUL_ASSIGN"
+
+_L_str_1243:
+    .asciz "NOD_DIV_ASSIGN"
+
+_L_str_1245:
+    .asciz "NOD_MOD_ASSIGN"
+
+_L_str_1247:
+    .asciz "NOD_SHL_ASSIGN"
+
+_L_str_1249:
+    .asciz "NOD_SHR_ASSIGN"
+
+_L_str_1251:
+    .asciz "NOD_OR_ASSIGN"
+
+_L_str_1253:
+    .asciz "NOD_XOR_ASSIGN"
+
+_L_str_1255:
+    .asciz "NOD_AND_ASSIGN"
+
+_L_str_1257:
+    .asciz "NOD_STRUCT_REF"
+
+_L_str_1259:
+    .asciz "NOD_CAST"
+
+_L_str_1261:
+    .asciz "NOD_ADDR"
+
+_L_str_1263:
+    .asciz "NOD_DEREF"
+
+_L_str_1265:
+    .asciz "NOD_FUNC_DEF"
+
+_L_str_1267:
+    .asciz "NOD_CALL"
+
+_L_str_1269:
+    .asciz "NOD_ARG"
+
+_L_str_1271:
+    .asciz "NOD_ADD"
+
+_L_str_1273:
+    .asciz "NOD_SUB"
+
+_L_str_1275:
+    .asciz "NOD_MUL"
+
+_L_str_1277:
+    .asciz "NOD_DIV"
+
+_L_str_1279:
+    .asciz "NOD_MOD"
+
+_L_str_1281:
+    .asciz "NOD_SHL"
+
+_L_str_1283:
+    .asciz "NOD_SHR"
+
+_L_str_1285:
+    .asciz "NOD_OR"
+
+_L_str_1287:
+    .asciz "NOD_XOR"
+
+_L_str_1289:
+    .asciz "NOD_AND"
+
+_L_str_1291:
+    .asciz "NOD_NOT"
+
+_L_str_1293:
+    .asciz "NOD_LT"
+
+_L_str_1295:
+    .asciz "NOD_GT"
+
+_L_str_1297:
+    .asciz "NOD_LE"
+
+_L_str_1299:
+    .asciz "NOD_GE"
+
+_L_str_1301:
+    .asciz "NOD_EQ"
+
+_L_str_1303:
+    .asciz "NOD_NE"
+
+_L_str_1305:
+    .asciz "NOD_COMMA"
+
+_L_str_1307:
+    .asciz "NOD_COND"
+
+_L_str_1309:
+    .asciz "NOD_COND_THEN"
+
+_L_str_1311:
+    .asciz "NOD_LOGICAL_OR"
+
+_L_str_1313:
+    .asciz "NOD_LOGICAL_AND"
+
+_L_str_1315:
+    .asciz "NOD_LOGICAL_NOT"
+
+_L_str_1317:
+    .asciz "NOD_PREINC"
+
+_L_str_1319:
+    .asciz "NOD_PREDEC"
+
+_L_str_1321:
+    .asciz "NOD_POSTINC"
+
+_L_str_1323:
+    .asciz "NOD_POSTDEC"
+
+_L_str_1325:
+    .asciz "NOD_SIZEOF"
+
+_L_str_1327:
+    .asciz "NOD_IDENT"
+
+_L_str_1329:
+    .asciz "NOD_NUM"
+
+_L_str_1331:
+    .asciz "NOD_FPNUM"
+
+_L_str_1333:
+    .asciz "NOD_STRING"
+
+_L_str_1335:
+    .asciz "NOD_CONST_EXPR"
+
+_L_str_1337:
+    .asciz "NOD_TYPE_NAME"
+
+_L_str_1339:
+    .asciz "NOD_DECL_IDENT"
+
+_L_str_1341:
+    .asciz "NOD_INIT"
+
+_L_str_1343:
+    .asciz "NOD_DESIG"
+
+_L_str_1345:
+    .asciz "**unknown**"
+
+_L_str_1355:
+    .asciz " %s"
+
+_L_str_1365:
+    .asciz "  "
+
+_L_str_1367:
+    .asciz "%d. "
+
+_L_str_1369:
+    .asciz "\033[36m"
+
+_L_str_1370:
+    .asciz "\033[1m"
+
+_L_str_1371:
+    .asciz "%s"
+
+_L_str_1372:
+    .asciz "\033[0m"
+
+_L_str_1373:
+    .asciz "\033[39m"
+
+_L_str_1376:
+    .asciz "\033[33m"
+
+_L_str_1380:
+    .asciz "\033[31m"
+
+_L_str_1382:
+    .asciz " "
+
+_L_str_1383:
+    .asciz "\033[32m"
+
+_L_str_1393:
+    .asciz "\033[35m"
+
+_L_str_1394:
+    .asciz " %ld"
+
+_L_str_1396:
+    .asciz " %g"
+
+_L_str_1398:
+    .asciz " \""
+
+_L_str_1399:
+    .asciz "\""
+
+_L_str_1403:
+    .asciz "\012"
+
+_new_array:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+## func body
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movq  %rax, (%rsp)
+    movl  8(%rsp), %edi
+    movq  (%rsp), %rsi
+    callq _arena_alloc
+    addq  $16, %rsp
+    jmp   _LBB0_0
+_LBB0_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_add_ast_block:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $20, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB2_3
+## if-then
+## local scalar init
+    leaq  -20(%rbp), %rax
+    pushq %rax
+## cond-?
+    movq  -8(%rbp), %rax
+    addq  $20, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    je    _LBB3_3
+## cond-then
+    movl  $2, %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $20, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    imull %edx, %eax
+    jmp   _LBB3_2
+## cond-else
+_LBB3_3:
+    movl  $16, %eax
+_LBB3_2:
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $24, %eax
+    movslq %eax, %rax
+    movq  %rax, 16(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movl  8(%rsp), %esi
+    callq _new_array
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB4_3
+## if-then
+    subq  $32, %rsp
+    movq  -32(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movl  $24, %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    imull %edx, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _memcpy
+    addq  $32, %rsp
+    jmp   _LBB4_2
+## if-else
+_LBB4_3:
+_LBB4_2:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $20, %rax
+    pushq %rax
+    movl  -20(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB2_2
+## if-else
+_LBB2_3:
+_LBB2_2:
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $24, %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $32, %eax
+    movslq %eax, %rax
+    movq  %rax, 16(%rsp)
+    movl  $4096, %eax
+    movl  %eax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movl  8(%rsp), %esi
+    callq _new_array
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $8, %eax
+    movslq %eax, %rax
+    movq  %rax, 16(%rsp)
+    movl  $4096, %eax
+    movl  %eax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movl  8(%rsp), %esi
+    callq _new_array
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -16(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $4, %eax
+    movslq %eax, %rax
+    movq  %rax, 16(%rsp)
+    movl  $4096, %eax
+    movl  %eax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movl  8(%rsp), %esi
+    callq _new_array
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+_LBB1_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_ast_pool:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+## func body
+## local scalar init
+    leaq  -8(%rbp), %rax
+    pushq %rax
+    leaq  _node_pool_1030(%rip), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    subq  $8, %rsp
+    callq _arena_generation
+    addq  $8, %rsp
+    popq  %rdx
+    cmpl  %edx, %eax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB6_3
+## if-then
+## assign
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $20, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    subq  $8, %rsp
+    callq _arena_generation
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _add_ast_block
+    addq  $16, %rsp
+    jmp   _LBB6_2
+## if-else
+_LBB6_3:
+_LBB6_2:
+    movq  -8(%rbp), %rax
+    jmp   _LBB5_0
+_LBB5_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_block_of:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movl  %edi, -4(%rbp)
+## func body
+    leaq  _node_pool_1030(%rip), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $24, %eax
+    pushq %rax
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  $4096, %eax
+    movl  %eax, %edi
+    popq  %rax
+    cltd
+    idivl %edi
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    jmp   _LBB7_0
+_LBB7_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_node_at:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movl  %edi, -4(%rbp)
+## func body
+## if-cond
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB9_3
+## if-then
+    movl  $0, %eax
+    jmp   _LBB8_0
+    jmp   _LBB9_2
+## if-else
+_LBB9_3:
+_LBB9_2:
+    subq  $16, %rsp
+    movl  -4(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _block_of
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $32, %eax
+    pushq %rax
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  $4096, %eax
+    movl  %eax, %edi
+    popq  %rax
+    cltd
+    idivl %edi
+    movl  %edx, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    jmp   _LBB8_0
+_LBB8_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _new_ast_node
+_new_ast_node:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $64, %rsp
+## func params
+    movl  %edi, -4(%rbp)
+    movq  %rsi, -16(%rbp)
+    movq  %rdx, -24(%rbp)
+## func body
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    callq _ast_pool
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -32(%rbp), %rax
+    addq  $24, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $4096, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB11_3
+## if-then
+    subq  $16, %rsp
+    movq  -32(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _add_ast_block
+    addq  $16, %rsp
+    jmp   _LBB11_2
+## if-else
+_LBB11_3:
+_LBB11_2:
+## assign
+    leaq  -52(%rbp), %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    addq  $24, %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movl  -52(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  (%rsp), %edi
+    callq _block_of
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    movq  -40(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $32, %eax
+    pushq %rax
+    movl  -52(%rbp), %eax
+    pushq %rax
+    movl  $4096, %eax
+    movl  %eax, %edi
+    popq  %rax
+    cltd
+    idivl %edi
+    movl  %edx, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -48(%rbp), %rax
+    addq  $28, %rax
+    pushq %rax
+    movl  -4(%rbp), %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## assign
+    movq  -48(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    movl  -52(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -48(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -48(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _set_node_l
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -48(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _set_node_r
+    addq  $16, %rsp
+## assign
+    movq  -48(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    subq  $8, %rsp
+    callq _type_void
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -40(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -52(%rbp), %eax
+    pushq %rax
+    movl  $4096, %eax
+    movl  %eax, %edi
+    popq  %rax
+    cltd
+    idivl %edi
+    movl  %edx, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $0, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -40(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  -52(%rbp), %eax
+    pushq %rax
+    movl  $4096, %eax
+    movl  %eax, %edi
+    popq  %rax
+    cltd
+    idivl %edi
+    movl  %edx, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    movq  -48(%rbp), %rax
+    jmp   _LBB10_0
+_LBB10_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _node_l
+_node_l:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _node_at
+    addq  $16, %rsp
+    jmp   _LBB12_0
+_LBB12_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _node_r
+_node_r:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $20, %rax
+    movl  (%rax), %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _node_at
+    addq  $16, %rsp
+    jmp   _LBB13_0
+_LBB13_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _set_node_l
+_set_node_l:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## assign
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+## cond-?
+    movq  -16(%rbp), %rax
+    cmpl  $0, %eax
+    je    _LBB15_3
+## cond-then
+    movq  -16(%rbp), %rax
+    addq  $24, %rax
+    movl  (%rax), %eax
+    jmp   _LBB15_2
+## cond-else
+_LBB15_3:
+    movl  $0, %eax
+_LBB15_2:
+    popq  %rdx
+    movl  %eax, (%rdx)
+_LBB14_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _set_node_r
+_set_node_r:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## assign
+    movq  -8(%rbp), %rax
+    addq  $20, %rax
+    pushq %rax
+## cond-?
+    movq  -16(%rbp), %rax
+    cmpl  $0, %eax
+    je    _LBB17_3
+## cond-then
+    movq  -16(%rbp), %rax
+    addq  $24, %rax
+    movl  (%rax), %eax
+    jmp   _LBB17_2
+## cond-else
+_LBB17_3:
+    movl  $0, %eax
+_LBB17_2:
+    popq  %rdx
+    movl  %eax, (%rdx)
+_LBB16_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _node_ival
+_node_ival:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    movl  (%rax), %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _block_of
+    addq  $16, %rsp
+    addq  $8, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $4096, %eax
+    movl  %eax, %edi
+    popq  %rax
+    cltd
+    idivl %edi
+    movl  %edx, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    jmp   _LBB18_0
+_LBB18_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _node_fval
+_node_fval:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    movl  (%rax), %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _block_of
+    addq  $16, %rsp
+    addq  $8, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $4096, %eax
+    movl  %eax, %edi
+    popq  %rax
+    cltd
+    idivl %edi
+    movl  %edx, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $0, %rax
+    movss (%rax), %xmm0
+    jmp   _LBB19_0
+_LBB19_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _node_pos
+_node_pos:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    movl  (%rax), %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _block_of
+    addq  $16, %rsp
+    addq  $16, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $4096, %eax
+    movl  %eax, %edi
+    popq  %rax
+    cltd
+    idivl %edi
+    movl  %edx, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    jmp   _LBB20_0
+_LBB20_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _set_node_ival
+_set_node_ival:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## assign
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    movl  (%rax), %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _block_of
+    addq  $16, %rsp
+    addq  $8, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $4096, %eax
+    movl  %eax, %edi
+    popq  %rax
+    cltd
+    idivl %edi
+    movl  %edx, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+_LBB21_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _set_node_fval
+_set_node_fval:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movss %xmm0, -12(%rbp)
+## func body
+## assign
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    movl  (%rax), %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _block_of
+    addq  $16, %rsp
+    addq  $8, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $4096, %eax
+    movl  %eax, %edi
+    popq  %rax
+    cltd
+    idivl %edi
+    movl  %edx, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $0, %rax
+    pushq %rax
+    movss -12(%rbp), %xmm0
+    popq  %rdx
+    movss %xmm0, (%rdx)
+_LBB22_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_push_walk:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movl  %edx, -20(%rbp)
+## func body
+## if-cond
+    movq  -16(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB24_3
+## if-then
+    jmp   _LBB23_0
+    jmp   _LBB24_2
+## if-else
+_LBB24_3:
+_LBB24_2:
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $12, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB25_3
+## if-then
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $2, %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $12, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movl  $16, %eax
+    pushq %rax
+    movl  -24(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    movslq %eax, %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _malloc
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $32, %rsp
+    movq  -32(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movl  $16, %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    imull %edx, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _memcpy
+    addq  $32, %rsp
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $32, %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB26_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+    jmp   _LBB26_2
+## if-else
+_LBB26_3:
+_LBB26_2:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $12, %rax
+    pushq %rax
+    movl  -24(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB25_2
+## if-else
+_LBB25_3:
+_LBB25_2:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $16, %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $16, %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  -20(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+_LBB23_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _begin_ast_walk
+_begin_ast_walk:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $32, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $12, %rax
+    pushq %rax
+    movl  $32, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $28, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _push_walk
+    addq  $32, %rsp
+_LBB27_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _end_ast_walk
+_end_ast_walk:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $32, %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB29_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+    jmp   _LBB29_2
+## if-else
+_LBB29_3:
+_LBB29_2:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $32, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+_LBB28_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _next_ast_node
+_next_ast_node:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    movl  $0, %eax
+    je    _LBB32_2
+    movq  -8(%rbp), %rax
+    addq  $28, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB32_2
+    movl  $1, %eax
+_LBB32_2:
+    cmpl  $0, %eax
+    je    _LBB31_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, 16(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _push_walk
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, 16(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _push_walk
+    addq  $32, %rsp
+    jmp   _LBB31_2
+## if-else
+_LBB31_3:
+_LBB31_2:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $28, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB33_3
+## if-then
+## assign
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movl  $0, %eax
+    jmp   _LBB30_0
+    jmp   _LBB33_2
+## if-else
+_LBB33_3:
+_LBB33_2:
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    subl  $1, %ecx
+    movl  %ecx, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $16, %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $16, %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    jmp   _LBB30_0
+_LBB30_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _skip_ast_children
+_skip_ast_children:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## assign
+    movq  -8(%rbp), %rax
+    addq  $28, %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+_LBB34_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _next_ast_list_item
+_next_ast_list_item:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## while-cond
+_LBB36_4:
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _next_ast_node
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB36_2
+## while-body
+## if-cond
+    movq  -16(%rbp), %rax
+    addq  $28, %rax
+    movb  (%rax), %al
+    movzbl %al, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB38_2
+    movq  -16(%rbp), %rax
+    addq  $28, %rax
+    movb  (%rax), %al
+    movzbl %al, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB38_2
+    movl  $1, %eax
+_LBB38_2:
+    cmpl  $0, %eax
+    je    _LBB37_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _skip_ast_children
+    addq  $16, %rsp
+    movq  -16(%rbp), %rax
+    jmp   _LBB35_0
+    jmp   _LBB37_2
+## if-else
+_LBB37_3:
+_LBB37_2:
+    jmp   _LBB36_4
+_LBB36_2:
+    movl  $0, %eax
+    jmp   _LBB35_0
+_LBB35_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _node_to_string
+_node_to_string:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## if-cond
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB40_3
+## if-then
+    leaq  _L_str_1195(%rip), %rax
+    jmp   _LBB39_0
+    jmp   _LBB40_2
+## if-else
+_LBB40_3:
+_LBB40_2:
+## switch-value
+    movq  -8(%rbp), %rax
+    addq  $28, %rax
+    movb  (%rax), %al
+    movzbl %al, %eax
+## begin jump table
+    cmpl  $0, %eax
+    je    _LBB41_1298
+    cmpl  $1, %eax
+    je    _LBB41_1300
+    cmpl  $2, %eax
+    je    _LBB41_1302
+    cmpl  $3, %eax
+    je    _LBB41_1304
+    cmpl  $4, %eax
+    je    _LBB41_1306
+    cmpl  $5, %eax
+    je    _LBB41_1308
+    cmpl  $6, %eax
+    je    _LBB41_1310
+    cmpl  $7, %eax
+    je    _LBB41_1312
+    cmpl  $8, %eax
+    je    _LBB41_1314
+    cmpl  $9, %eax
+    je    _LBB41_1316
+    cmpl  $10, %eax
+    je    _LBB41_1318
+    cmpl  $11, %eax
+    je    _LBB41_1320
+    cmpl  $12, %eax
+    je    _LBB41_1322
+    cmpl  $13, %eax
+    je    _LBB41_1324
+    cmpl  $14, %eax
+    je    _LBB41_1326
+    cmpl  $15, %eax
+    je    _LBB41_1328
+    cmpl  $16, %eax
+    je    _LBB41_1330
+    cmpl  $17, %eax
+    je    _LBB41_1332
+    cmpl  $18, %eax
+    je    _LBB41_1334
+    cmpl  $19, %eax
+    je    _LBB41_1336
+    cmpl  $20, %eax
+    je    _LBB41_1338
+    cmpl  $21, %eax
+    je    _LBB41_1340
+    cmpl  $22, %eax
+    je    _LBB41_1342
+    cmpl  $23, %eax
+    je    _LBB41_1344
+    cmpl  $24, %eax
+    je    _LBB41_1346
+    cmpl  $25, %eax
+    je    _LBB41_1348
+    cmpl  $26, %eax
+    je    _LBB41_1350
+    cmpl  $27, %eax
+    je    _LBB41_1352
+    cmpl  $28, %eax
+    je    _LBB41_1354
+    cmpl  $29, %eax
+    je    _LBB41_1356
+    cmpl  $30, %eax
+    je    _LBB41_1358
+    cmpl  $31, %eax
+    je    _LBB41_1360
+    cmpl  $32, %eax
+    je    _LBB41_1362
+    cmpl  $33, %eax
+    je    _LBB41_1364
+    cmpl  $34, %eax
+    je    _LBB41_1366
+    cmpl  $35, %eax
+    je    _LBB41_1368
+    cmpl  $36, %eax
+    je    _LBB41_1370
+    cmpl  $37, %eax
+    je    _LBB41_1372
+    cmpl  $38, %eax
+    je    _LBB41_1374
+    cmpl  $39, %eax
+    je    _LBB41_1376
+    cmpl  $40, %eax
+    je    _LBB41_1378
+    cmpl  $41, %eax
+    je    _LBB41_1380
+    cmpl  $42, %eax
+    je    _LBB41_1382
+    cmpl  $43, %eax
+    je    _LBB41_1384
+    cmpl  $44, %eax
+    je    _LBB41_1386
+    cmpl  $45, %eax
+    je    _LBB41_1388
+    cmpl  $46, %eax
+    je    _LBB41_1390
+    cmpl  $47, %eax
+    je    _LBB41_1392
+    cmpl  $48, %eax
+    je    _LBB41_1394
+    cmpl  $49, %eax
+    je    _LBB41_1396
+    cmpl  $50, %eax
+    je    _LBB41_1398
+    cmpl  $51, %eax
+    je    _LBB41_1400
+    cmpl  $52, %eax
+    je    _LBB41_1402
+    cmpl  $53, %eax
+    je    _LBB41_1404
+    cmpl  $54, %eax
+    je    _LBB41_1406
+    cmpl  $55, %eax
+    je    _LBB41_1408
+    cmpl  $56, %eax
+    je    _LBB41_1410
+    cmpl  $57, %eax
+    je    _LBB41_1412
+    cmpl  $58, %eax
+    je    _LBB41_1414
+    cmpl  $59, %eax
+    je    _LBB41_1416
+    cmpl  $60, %eax
+    je    _LBB41_1418
+    cmpl  $61, %eax
+    je    _LBB41_1420
+    cmpl  $62, %eax
+    je    _LBB41_1422
+    cmpl  $63, %eax
+    je    _LBB41_1424
+    cmpl  $64, %eax
+    je    _LBB41_1426
+    cmpl  $65, %eax
+    je    _LBB41_1428
+    cmpl  $66, %eax
+    je    _LBB41_1430
+    cmpl  $67, %eax
+    je    _LBB41_1432
+    cmpl  $68, %eax
+    je    _LBB41_1434
+    cmpl  $69, %eax
+    je    _LBB41_1436
+    cmpl  $70, %eax
+    je    _LBB41_1438
+    cmpl  $71, %eax
+    je    _LBB41_1440
+    cmpl  $72, %eax
+    je    _LBB41_1442
+    jmp   _LBB41_1444
+    jmp   _LBB41_2
+## end jump table
+_LBB41_1298:
+    leaq  _L_str_1199(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1300:
+    leaq  _L_str_1201(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1302:
+    leaq  _L_str_1203(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1304:
+    leaq  _L_str_1205(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1306:
+    leaq  _L_str_1207(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1308:
+    leaq  _L_str_1209(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1310:
+    leaq  _L_str_1211(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1312:
+    leaq  _L_str_1213(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1314:
+    leaq  _L_str_1215(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1316:
+    leaq  _L_str_1217(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1318:
+    leaq  _L_str_1219(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1320:
+    leaq  _L_str_1221(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1322:
+    leaq  _L_str_1223(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1324:
+    leaq  _L_str_1225(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1326:
+    leaq  _L_str_1227(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1328:
+    leaq  _L_str_1229(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1330:
+    leaq  _L_str_1231(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1332:
+    leaq  _L_str_1233(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1334:
+    leaq  _L_str_1235(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1336:
+    leaq  _L_str_1237(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1338:
+    leaq  _L_str_1239(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1340:
+    leaq  _L_str_1241(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1342:
+    leaq  _L_str_1243(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1344:
+    leaq  _L_str_1245(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1346:
+    leaq  _L_str_1247(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1348:
+    leaq  _L_str_1249(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1350:
+    leaq  _L_str_1251(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1352:
+    leaq  _L_str_1253(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1354:
+    leaq  _L_str_1255(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1356:
+    leaq  _L_str_1257(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1358:
+    leaq  _L_str_1259(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1360:
+    leaq  _L_str_1261(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1362:
+    leaq  _L_str_1263(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1364:
+    leaq  _L_str_1265(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1366:
+    leaq  _L_str_1267(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1368:
+    leaq  _L_str_1269(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1370:
+    leaq  _L_str_1271(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1372:
+    leaq  _L_str_1273(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1374:
+    leaq  _L_str_1275(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1376:
+    leaq  _L_str_1277(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1378:
+    leaq  _L_str_1279(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1380:
+    leaq  _L_str_1281(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1382:
+    leaq  _L_str_1283(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1384:
+    leaq  _L_str_1285(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1386:
+    leaq  _L_str_1287(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1388:
+    leaq  _L_str_1289(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1390:
+    leaq  _L_str_1291(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1392:
+    leaq  _L_str_1293(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1394:
+    leaq  _L_str_1295(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1396:
+    leaq  _L_str_1297(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1398:
+    leaq  _L_str_1299(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1400:
+    leaq  _L_str_1301(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1402:
+    leaq  _L_str_1303(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1404:
+    leaq  _L_str_1305(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1406:
+    leaq  _L_str_1307(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1408:
+    leaq  _L_str_1309(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1410:
+    leaq  _L_str_1311(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1412:
+    leaq  _L_str_1313(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1414:
+    leaq  _L_str_1315(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1416:
+    leaq  _L_str_1317(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1418:
+    leaq  _L_str_1319(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1420:
+    leaq  _L_str_1321(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1422:
+    leaq  _L_str_1323(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1424:
+    leaq  _L_str_1325(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1426:
+    leaq  _L_str_1327(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1428:
+    leaq  _L_str_1329(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1430:
+    leaq  _L_str_1331(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1432:
+    leaq  _L_str_1333(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1434:
+    leaq  _L_str_1335(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1436:
+    leaq  _L_str_1337(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1438:
+    leaq  _L_str_1339(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1440:
+    leaq  _L_str_1341(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1442:
+    leaq  _L_str_1343(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_1444:
+    leaq  _L_str_1345(%rip), %rax
+    jmp   _LBB39_0
+_LBB41_2:
+_LBB39_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_print_type:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _type_name_1354(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _make_type_name
+    addq  $16, %rsp
+    subq  $16, %rsp
+    leaq  _L_str_1355(%rip), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _type_name_1354(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+_LBB42_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_print_node:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+## func body
+## for-pre
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB44_1:
+    movl  -16(%rbp), %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB44_2
+## for-body
+    subq  $16, %rsp
+    leaq  _L_str_1365(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+## for-post
+_LBB44_4:
+    leaq  -16(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB44_1
+_LBB44_2:
+    subq  $16, %rsp
+    leaq  _L_str_1367(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movl  -12(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB47_2
+    movq  -8(%rbp), %rax
+    addq  $28, %rax
+    movb  (%rax), %al
+    movzbl %al, %eax
+    pushq %rax
+    movl  $65, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB47_2
+    movl  $0, %eax
+_LBB47_2:
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB46_2
+    movq  -8(%rbp), %rax
+    addq  $28, %rax
+    movb  (%rax), %al
+    movzbl %al, %eax
+    pushq %rax
+    movl  $66, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB46_2
+    movl  $0, %eax
+_LBB46_2:
+    cmpl  $0, %eax
+    je    _LBB45_3
+## if-then
+    subq  $16, %rsp
+    leaq  _L_str_1369(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    leaq  _L_str_1370(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    leaq  _L_str_1371(%rip), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_to_string
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    leaq  _L_str_1372(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    leaq  _L_str_1373(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    jmp   _LBB45_2
+## if-else
+_LBB45_3:
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $28, %rax
+    movb  (%rax), %al
+    movzbl %al, %eax
+    pushq %rax
+    movl  $71, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB48_3
+## if-then
+    subq  $16, %rsp
+    leaq  _L_str_1376(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    leaq  _L_str_1370(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    leaq  _L_str_1371(%rip), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_to_string
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    leaq  _L_str_1372(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    leaq  _L_str_1373(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    jmp   _LBB48_2
+## if-else
+_LBB48_3:
+    subq  $16, %rsp
+    leaq  _L_str_1371(%rip), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_to_string
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+_LBB48_2:
+_LBB45_2:
+    subq  $16, %rsp
+    leaq  _L_str_1380(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _print_type
+    addq  $16, %rsp
+    subq  $16, %rsp
+    leaq  _L_str_1373(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB50_2
+    movq  -8(%rbp), %rax
+    addq  $28, %rax
+    movb  (%rax), %al
+    movzbl %al, %eax
+    pushq %rax
+    movl  $72, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB50_2
+    movl  $1, %eax
+_LBB50_2:
+    cmpl  $0, %eax
+    je    _LBB49_3
+## if-then
+    subq  $16, %rsp
+    leaq  _L_str_1382(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    leaq  _L_str_1383(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    leaq  _L_str_1370(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    leaq  _L_str_1371(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    leaq  _L_str_1372(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    leaq  _L_str_1373(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    jmp   _LBB49_2
+## if-else
+_LBB49_3:
+_LBB49_2:
+## switch-value
+    movq  -8(%rbp), %rax
+    addq  $28, %rax
+    movb  (%rax), %al
+    movzbl %al, %eax
+## begin jump table
+    cmpl  $70, %eax
+    je    _LBB51_1487
+    cmpl  $64, %eax
+    je    _LBB51_1488
+    cmpl  $72, %eax
+    je    _LBB51_1489
+    cmpl  $71, %eax
+    je    _LBB51_1490
+    cmpl  $65, %eax
+    je    _LBB51_1491
+    cmpl  $68, %eax
+    je    _LBB51_1492
+    cmpl  $66, %eax
+    je    _LBB51_1495
+    cmpl  $67, %eax
+    je    _LBB51_1497
+    jmp   _LBB51_1500
+    jmp   _LBB51_2
+## end jump table
+_LBB51_1487:
+_LBB51_1488:
+    subq  $16, %rsp
+    leaq  _L_str_1382(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    leaq  _L_str_1383(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    leaq  _L_str_1370(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    leaq  _L_str_1371(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    leaq  _L_str_1372(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    leaq  _L_str_1373(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    jmp   _LBB51_2
+_LBB51_1489:
+_LBB51_1490:
+_LBB51_1491:
+_LBB51_1492:
+    subq  $16, %rsp
+    leaq  _L_str_1393(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    leaq  _L_str_1370(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    leaq  _L_str_1394(%rip), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_ival
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    leaq  _L_str_1372(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    leaq  _L_str_1373(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    jmp   _LBB51_2
+_LBB51_1495:
+    subq  $16, %rsp
+    leaq  _L_str_1393(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    leaq  _L_str_1370(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    leaq  _L_str_1396(%rip), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_fval
+    addq  $16, %rsp
+    cvtss2sd %xmm0, %xmm0
+    movsd %xmm0, (%rsp)
+    movq  8(%rsp), %rdi
+    movsd (%rsp), %xmm0
+    movb  $1, %al
+    callq _printf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    leaq  _L_str_1372(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    leaq  _L_str_1373(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    jmp   _LBB51_2
+_LBB51_1497:
+    subq  $16, %rsp
+    leaq  _L_str_1393(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    leaq  _L_str_1370(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    leaq  _L_str_1398(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  ___stdoutp@GOTPCREL(%rip), %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _print_string_literal
+    addq  $16, %rsp
+    subq  $16, %rsp
+    leaq  _L_str_1399(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    leaq  _L_str_1372(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    leaq  _L_str_1373(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    jmp   _LBB51_2
+_LBB51_1500:
+    jmp   _LBB51_2
+_LBB51_2:
+    subq  $16, %rsp
+    leaq  _L_str_1403(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+_LBB43_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _print_tree
+_print_tree:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $560, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+    subq  $16, %rsp
+    leaq  -552(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _begin_ast_walk
+    addq  $16, %rsp
+## while-cond
+_LBB53_4:
+## assign
+    leaq  -560(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    leaq  -552(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _next_ast_node
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB53_2
+## while-body
+    subq  $16, %rsp
+    movq  -560(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  -552(%rbp), %rax
+    addq  $24, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _print_node
+    addq  $16, %rsp
+    jmp   _LBB53_4
+_LBB53_2:
+    subq  $16, %rsp
+    leaq  -552(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _end_ast_walk
+    addq  $16, %rsp
+_LBB52_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
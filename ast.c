@@ -1,6 +1,8 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include "ast.h"
+#include "arena.h"
 #include "esc_seq.h"
 
 #define TERMINAL_COLOR_BLACK   "\x1b[30m"
@@ -16,26 +18,229 @@
 #define TERMINAL_DECORATION_BOLD    "\x1b[1m"
 #define TERMINAL_DECORATION_RESET   "\x1b[0m"
 
+/* blocks are allocated from the ast arena and so is the block table. they
+ * are released together with the arena */
+struct ast_pool {
+    int generation;
+    struct ast_block *blocks;
+    int block_count;
+    int block_capacity;
+    int node_count;
+};
+
+static struct ast_pool node_pool;
+
+static void *new_array(size_t size, int count)
+{
+    return arena_alloc(ARENA_AST, size * count);
+}
+
+static void add_ast_block(struct ast_pool *pool)
+{
+    struct ast_block *block;
+
+    if (pool->block_count == pool->block_capacity) {
+        const int new_cap = pool->block_capacity ? 2 * pool->block_capacity : 16;
+        struct ast_block *blocks = new_array(sizeof(struct ast_block), new_cap);
+
+        if (pool->block_count > 0)
+            memcpy(blocks, pool->blocks, sizeof(struct ast_block) * pool->block_count);
+        pool->blocks = blocks;
+        pool->block_capacity = new_cap;
+    }
+
+    block = &pool->blocks[pool->block_count++];
+    block->nodes = new_array(sizeof(struct ast_node), AST_BLOCK_SIZE);
+    block->values = new_array(sizeof(union ast_value), AST_BLOCK_SIZE);
+    block->positions = new_array(sizeof(struct position), AST_BLOCK_SIZE);
+}
+
+static struct ast_pool *ast_pool(void)
+{
+    struct ast_pool *pool = &node_pool;
+
+    /* blocks were released together with the ast arena */
+    if (pool->generation != arena_generation()) {
+        pool->blocks = NULL;
+        pool->block_count = 0;
+        pool->block_capacity = 0;
+        /* index 0 is no node */
+        pool->node_count = 1;
+        pool->generation = arena_generation();
+        add_ast_block(pool);
+    }
+
+    return pool;
+}
+
+static struct ast_block *block_of(int index)
+{
+    return &node_pool.blocks[index / AST_BLOCK_SIZE];
+}
+
+static struct ast_node *node_at(int index)
+{
+    if (index == 0)
+        return NULL;
+    return &block_of(index)->nodes[index % AST_BLOCK_SIZE];
+}
+
 struct ast_node *new_ast_node(enum ast_node_kind kind,
         struct ast_node *l, struct ast_node *r)
 {
-    struct ast_node *n = calloc(1, sizeof(struct ast_node));
+    struct ast_pool *pool = ast_pool();
+    struct ast_block *block;
+    struct ast_node *n;
+    int index;
+
+    if (pool->node_count == pool->block_count * AST_BLOCK_SIZE)
+        add_ast_block(pool);
+
+    index = pool->node_count++;
+    block = block_of(index);
+
+    n = &block->nodes[index % AST_BLOCK_SIZE];
     n->kind = kind;
-    n->l = l;
-    n->r = r;
+    n->index = index;
+    n->sym = NULL;
+    set_node_l(n, l);
+    set_node_r(n, r);
 
     n->type = type_void();
 
+    block->values[index % AST_BLOCK_SIZE].ival = 0;
+    block->positions[index % AST_BLOCK_SIZE].offset = 0;
+
     return n;
 }
 
-void free_ast_node(struct ast_node *node)
+struct ast_node *node_l(const struct ast_node *node)
+{
+    return node_at(node->l_index);
+}
+
+struct ast_node *node_r(const struct ast_node *node)
+{
+    return node_at(node->r_index);
+}
+
+void set_node_l(struct ast_node *node, const struct ast_node *l)
+{
+    node->l_index = l ? l->index : 0;
+}
+
+void set_node_r(struct ast_node *node, const struct ast_node *r)
+{
+    node->r_index = r ? r->index : 0;
+}
+
+long node_ival(const struct ast_node *node)
+{
+    return block_of(node->index)->values[node->index % AST_BLOCK_SIZE].ival;
+}
+
+float node_fval(const struct ast_node *node)
+{
+    return block_of(node->index)->values[node->index % AST_BLOCK_SIZE].fval;
+}
+
+struct position *node_pos(const struct ast_node *node)
+{
+    return &block_of(node->index)->positions[node->index % AST_BLOCK_SIZE];
+}
+
+void set_node_ival(struct ast_node *node, long ival)
+{
+    block_of(node->index)->values[node->index % AST_BLOCK_SIZE].ival = ival;
+}
+
+void set_node_fval(struct ast_node *node, float fval)
+{
+    block_of(node->index)->values[node->index % AST_BLOCK_SIZE].fval = fval;
+}
+
+static void push_walk(struct ast_walker *w, const struct ast_node *node, int depth)
 {
     if (!node)
         return;
 
-    free_ast_node(node->l);
-    free_ast_node(node->r);
+    if (w->count == w->capacity) {
+        const int new_cap = 2 * w->capacity;
+        struct ast_walk_entry *stack = malloc(sizeof(struct ast_walk_entry) * new_cap);
+
+        memcpy(stack, w->stack, sizeof(struct ast_walk_entry) * w->count);
+        if (w->stack != w->local)
+            free(w->stack);
+
+        w->stack = stack;
+        w->capacity = new_cap;
+    }
+
+    w->stack[w->count].node = node;
+    w->stack[w->count].depth = depth;
+    w->count++;
+}
+
+void begin_ast_walk(struct ast_walker *w, const struct ast_node *tree)
+{
+    w->stack = w->local;
+    w->count = 0;
+    w->capacity = AST_WALK_LOCAL_SIZE;
+    w->curr = NULL;
+    w->depth = 0;
+    w->skip_children = 0;
+
+    push_walk(w, tree, 0);
+}
+
+void end_ast_walk(struct ast_walker *w)
+{
+    if (w->stack != w->local)
+        free(w->stack);
+
+    w->stack = w->local;
+    w->count = 0;
+    w->curr = NULL;
+}
+
+const struct ast_node *next_ast_node(struct ast_walker *w)
+{
+    /* r goes first to come out after l */
+    if (w->curr && !w->skip_children) {
+        push_walk(w, node_r(w->curr), w->depth + 1);
+        push_walk(w, node_l(w->curr), w->depth + 1);
+    }
+    w->skip_children = 0;
+
+    if (w->count == 0) {
+        w->curr = NULL;
+        return NULL;
+    }
+
+    w->count--;
+    w->curr = w->stack[w->count].node;
+    w->depth = w->stack[w->count].depth;
+
+    return w->curr;
+}
+
+void skip_ast_children(struct ast_walker *w)
+{
+    w->skip_children = 1;
+}
+
+const struct ast_node *next_ast_list_item(struct ast_walker *w)
+{
+    const struct ast_node *node;
+
+    while ((node = next_ast_node(w)) != NULL) {
+        if (node->kind != NOD_LIST && node->kind != NOD_COMPOUND) {
+            skip_ast_children(w);
+            return node;
+        }
+    }
+
+    return NULL;
 }
 
 const char *node_to_string(const struct ast_node *node)
@@ -129,13 +334,10 @@ static void print_type(const struct data_type *type)
     printf(" %s", type_name);
 }
 
-static void print_tree_recursive(const struct ast_node *tree, int depth)
+static void print_node(const struct ast_node *tree, int depth)
 {
     int i;
 
-    if (!tree)
-        return;
-
     for (i = 0; i < depth; i++) {
         printf("  ");
     }
@@ -191,7 +393,7 @@ static void print_tree_recursive(const struct ast_node *tree, int depth)
     case NOD_CONST_EXPR:
         printf(TERMINAL_COLOR_MAGENTA);
         printf(TERMINAL_DECORATION_BOLD);
-            printf(" %ld", tree->ival);
+            printf(" %ld", node_ival(tree));
         printf(TERMINAL_DECORATION_RESET);
         printf(TERMINAL_COLOR_RESET);
         break;
@@ -199,7 +401,7 @@ static void print_tree_recursive(const struct ast_node *tree, int depth)
     case NOD_FPNUM:
         printf(TERMINAL_COLOR_MAGENTA);
         printf(TERMINAL_DECORATION_BOLD);
-            printf(" %g", tree->fval);
+            printf(" %g", node_fval(tree));
         printf(TERMINAL_DECORATION_RESET);
         printf(TERMINAL_COLOR_RESET);
         break;
@@ -218,12 +420,15 @@ static void print_tree_recursive(const struct ast_node *tree, int depth)
         break;
     }
     printf("\n");
-
-    print_tree_recursive(tree->l, depth + 1);
-    print_tree_recursive(tree->r, depth + 1);
 }
 
 void print_tree(const struct ast_node *tree)
 {
-    print_tree_recursive(tree, 0);
+    struct ast_walker walk;
+    const struct ast_node *node;
+
+    begin_ast_walk(&walk, tree);
+    while ((node = next_ast_node(&walk)) != NULL)
+        print_node(node, walk.depth);
+    end_ast_walk(&walk);
 }
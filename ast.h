@@ -87,22 +87,83 @@ enum ast_node_kind {
     NOD_DESIG
 };
 
+/* nodes are stored one after another in the blocks of a node pool and
+ * refer to their children by 32-bit index in the pool. 0 is no node.
+ * literal values and positions are kept in side tables by the same index,
+ * so that tree walks go through small nodes only. use the node_ functions
+ * below to get and set them */
 struct ast_node {
-    enum ast_node_kind kind;
     struct data_type *type;
     struct symbol *sym;
 
-    struct ast_node *l;
-    struct ast_node *r;
+    int l_index;
+    int r_index;
+    int index;
+    /* enum ast_node_kind */
+    unsigned char kind;
+};
+
+#define AST_BLOCK_SIZE 4096 /* nodes */
 
+/* either of them is used depending on the kind of node */
+union ast_value {
     long ival;
     float fval;
-    struct position pos;
+};
+
+struct ast_block {
+    struct ast_node *nodes;
+    /* side tables */
+    union ast_value *values;
+    struct position *positions;
 };
 
 extern struct ast_node *new_ast_node(enum ast_node_kind kind,
         struct ast_node *l, struct ast_node *r);
-extern void free_ast_node(struct ast_node *node);
+
+/* children */
+extern struct ast_node *node_l(const struct ast_node *node);
+extern struct ast_node *node_r(const struct ast_node *node);
+extern void set_node_l(struct ast_node *node, const struct ast_node *l);
+extern void set_node_r(struct ast_node *node, const struct ast_node *r);
+
+/* side tables */
+extern long node_ival(const struct ast_node *node);
+extern float node_fval(const struct ast_node *node);
+extern struct position *node_pos(const struct ast_node *node);
+extern void set_node_ival(struct ast_node *node, long ival);
+extern void set_node_fval(struct ast_node *node, float fval);
+
+/* walks a tree in the order of a recursive walker, a node and then its l and
+ * r subtrees, with its own stack. lists are chains of NOD_LIST on l, so a
+ * long list would otherwise take as many frames of the call stack */
+#define AST_WALK_LOCAL_SIZE 32
+
+struct ast_walk_entry {
+    const struct ast_node *node;
+    int depth;
+};
+
+struct ast_walker {
+    struct ast_walk_entry *stack;
+    int count;
+    int capacity;
+
+    /* the node returned last. its children are pushed on the next call */
+    const struct ast_node *curr;
+    int depth;
+    int skip_children;
+
+    struct ast_walk_entry local[AST_WALK_LOCAL_SIZE];
+};
+
+extern void begin_ast_walk(struct ast_walker *w, const struct ast_node *tree);
+extern void end_ast_walk(struct ast_walker *w);
+extern const struct ast_node *next_ast_node(struct ast_walker *w);
+extern void skip_ast_children(struct ast_walker *w);
+/* nodes hanging from NOD_LIST and NOD_COMPOUND chains. the walker does not
+ * go into them */
+extern const struct ast_node *next_ast_list_item(struct ast_walker *w);
 
 extern const char *node_to_string(const struct ast_node *node);
 extern void print_tree(const struct ast_node *tree);
@@ -0,0 +1,78 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../lexer.h"
+#include "../arena.h"
+
+#define CORPUS_WORDS 200000
+#define REPEAT 10
+
+static const char *keywords[] = {
+    "int", "if", "else", "while", "for", "return", "static", "const",
+    "unsigned", "struct", "char", "void", "switch", "case", "break",
+    "sizeof", "typedef", "enum", "long", "double", "extern", "do", NULL
+};
+
+static const char *identifiers[] = {
+    "count", "index", "value", "next", "buffer", "length", "node_kind",
+    "table", "entry", "pos", "result", "tmp", "symbol_table", "p", "x1",
+    "head", "tail", "data_type", "size", "ival", "offset", "lexer", NULL
+};
+
+static char *make_corpus(const char **words)
+{
+    char *text = malloc(CORPUS_WORDS * 16 + 1);
+    char *p = text;
+    int i, w = 0;
+
+    for (i = 0; i < CORPUS_WORDS; i++) {
+        if (!words[w])
+            w = 0;
+        strcpy(p, words[w++]);
+        p += strlen(p);
+        *p++ = (i % 8 == 7) ? '\n' : ' ';
+    }
+    *p = '\0';
+
+    return text;
+}
+
+static void run(const char *name, const char *text)
+{
+    struct lexer *l = new_lexer();
+    struct token tok;
+    struct token_value val;
+    long ntokens = 0;
+    double sec;
+    clock_t start;
+    int i;
+
+    start = clock();
+    for (i = 0; i < REPEAT; i++) {
+        set_source_text(l, text);
+        while (get_next_token(l, &tok, &val) != TOK_EOF)
+            ntokens++;
+    }
+    sec = (double) (clock() - start) / CLOCKS_PER_SEC;
+
+    printf("%-12s %10ld tokens %8.3f sec %12.0f tokens/sec\n",
+            name, ntokens, sec, ntokens / sec);
+
+    free_lexer(l);
+}
+
+int main(void)
+{
+    char *keyword_text = make_corpus(keywords);
+    char *ident_text = make_corpus(identifiers);
+
+    run("keyword", keyword_text);
+    run("identifier", ident_text);
+
+    free(keyword_text);
+    free(ident_text);
+    free_arenas();
+
+    return 0;
+}
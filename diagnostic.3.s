@@ -0,0 +1,15689 @@
+    .data
+
+    .text
+
+_L_str_295:
+    .asciz "r"
+
+_L_str_303:
+    .asciz "%c"
+
+_L_str_306:
+    .asciz " "
+
+_L_str_308:
+    .asciz "\033[1m"
+
+_L_str_309:
+    .asciz "\033[32m"
+
+_L_str_310:
+    .asciz "^"
+
+_L_str_311:
+    .asciz "\033[39m"
+
+_L_str_312:
+    .asciz "\033[0m"
+
+_L_str_313:
+    .asciz "\012"
+
+_L_str_327:
+    .asciz "%s:"
+
+_L_str_328:
+    .asciz "%d:%d: "
+
+_L_str_329:
+    .asciz "\033[31m"
+
+_L_str_330:
+    .asciz "%s: "
+
+_L_str_331:
+    .asciz "error"
+
+_L_str_332:
+    .asciz "%s\012"
+
+_L_str_335:
+    .asciz "\033[35m"
+
+_L_str_336:
+    .asciz "warning"
+
+_print_line:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+    movl  %edx, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_295(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _fopen
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -24(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB1_3
+## if-then
+    jmp   _LBB0_0
+    jmp   _LBB1_2
+## if-else
+_LBB1_3:
+_LBB1_2:
+## for-pre
+## for-cond
+_LBB2_1:
+    movl  $1, %eax
+    cmpl  $0, %eax
+    je    _LBB2_2
+## for-body
+## if-cond
+    movl  -32(%rbp), %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB3_3
+## if-then
+    jmp   _LBB2_2
+    jmp   _LBB3_2
+## if-else
+_LBB3_3:
+_LBB3_2:
+## assign
+    leaq  -36(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _fgetc
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  -36(%rbp), %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB4_3
+## if-then
+    jmp   _LBB2_2
+    jmp   _LBB4_2
+## if-else
+_LBB4_3:
+_LBB4_2:
+## if-cond
+    movl  -36(%rbp), %eax
+    pushq %rax
+    movl  $10, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB5_3
+## if-then
+    leaq  -32(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB5_2
+## if-else
+_LBB5_3:
+_LBB5_2:
+## for-post
+_LBB2_4:
+    jmp   _LBB2_1
+_LBB2_2:
+## for-pre
+## for-cond
+_LBB6_1:
+    movl  $1, %eax
+    cmpl  $0, %eax
+    je    _LBB6_2
+## for-body
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _fgetc
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $32, %rsp
+    movq  ___stderrp@GOTPCREL(%rip), %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_303(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movl  -40(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+## if-cond
+    movl  -40(%rbp), %eax
+    pushq %rax
+    movl  $10, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB8_2
+    movl  -40(%rbp), %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB8_2
+    movl  $0, %eax
+_LBB8_2:
+    cmpl  $0, %eax
+    je    _LBB7_3
+## if-then
+    jmp   _LBB6_2
+    jmp   _LBB7_2
+## if-else
+_LBB7_3:
+_LBB7_2:
+## for-post
+_LBB6_4:
+    jmp   _LBB6_1
+_LBB6_2:
+## for-pre
+## assign
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB9_1:
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movl  -16(%rbp), %eax
+    pushq %rax
+    movl  $1, %eax
+    movl  %eax, %edx
+    popq  %rax
+    subl  %edx, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB9_2
+## for-body
+    subq  $16, %rsp
+    movq  ___stderrp@GOTPCREL(%rip), %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_306(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+## for-post
+_LBB9_4:
+    leaq  -28(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB9_1
+_LBB9_2:
+    subq  $16, %rsp
+    movq  ___stderrp@GOTPCREL(%rip), %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_308(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  ___stderrp@GOTPCREL(%rip), %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_309(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  ___stderrp@GOTPCREL(%rip), %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_310(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  ___stderrp@GOTPCREL(%rip), %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_311(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  ___stderrp@GOTPCREL(%rip), %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_312(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  ___stderrp@GOTPCREL(%rip), %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_313(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _fclose
+    addq  $16, %rsp
+_LBB0_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_print_message:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $64, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movl  %edx, -20(%rbp)
+## func body
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    movq  %rax, 16(%rsp)
+    leaq  -40(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _resolve_position
+    addq  $32, %rsp
+## assign
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    leaq  -40(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -52(%rbp), %rax
+    pushq %rax
+    leaq  -40(%rbp), %rax
+    addq  $12, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    leaq  -40(%rbp), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  -20(%rbp), %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB11_3
+## if-then
+    subq  $16, %rsp
+    movq  ___stderrp@GOTPCREL(%rip), %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_308(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  ___stderrp@GOTPCREL(%rip), %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_327(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  -48(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  ___stderrp@GOTPCREL(%rip), %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_328(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movl  -56(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -52(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  ___stderrp@GOTPCREL(%rip), %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_329(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  ___stderrp@GOTPCREL(%rip), %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_330(%rip), %rax
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_331(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  ___stderrp@GOTPCREL(%rip), %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_311(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  ___stderrp@GOTPCREL(%rip), %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_332(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  ___stderrp@GOTPCREL(%rip), %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_312(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    jmp   _LBB11_2
+## if-else
+_LBB11_3:
+_LBB11_2:
+## if-cond
+    movl  -20(%rbp), %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB12_3
+## if-then
+    subq  $16, %rsp
+    movq  ___stderrp@GOTPCREL(%rip), %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_308(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  ___stderrp@GOTPCREL(%rip), %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_327(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  -48(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  ___stderrp@GOTPCREL(%rip), %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_328(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movl  -56(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -52(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  ___stderrp@GOTPCREL(%rip), %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_335(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  ___stderrp@GOTPCREL(%rip), %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_330(%rip), %rax
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_336(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  ___stderrp@GOTPCREL(%rip), %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_311(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  ___stderrp@GOTPCREL(%rip), %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_332(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  ___stderrp@GOTPCREL(%rip), %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_312(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    jmp   _LBB12_2
+## if-else
+_LBB12_3:
+_LBB12_2:
+    subq  $32, %rsp
+    movq  -48(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  -56(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    movl  -52(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _print_line
+    addq  $32, %rsp
+_LBB10_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_print_message_array:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movl  %edx, -20(%rbp)
+## func body
+## for-pre
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB14_1:
+    movl  -24(%rbp), %eax
+    pushq %rax
+    movl  $5, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB14_2
+## for-body
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movl  $16, %eax
+    pushq %rax
+    movl  -24(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -32(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    je    _LBB15_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -32(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _print_message
+    addq  $32, %rsp
+    jmp   _LBB15_2
+## if-else
+_LBB15_3:
+_LBB15_2:
+## for-post
+_LBB14_4:
+    leaq  -24(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB14_1
+_LBB14_2:
+_LBB13_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_init_message:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## if-cond
+    movq  -8(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB17_3
+## if-then
+    jmp   _LBB16_0
+    jmp   _LBB17_2
+## if-else
+_LBB17_3:
+_LBB17_2:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+_LBB16_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_free_message:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## if-cond
+    movq  -8(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB19_3
+## if-then
+    jmp   _LBB18_0
+    jmp   _LBB19_2
+## if-else
+_LBB19_3:
+_LBB19_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+_LBB18_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _new_diagnostic
+_new_diagnostic:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+## func body
+## local scalar init
+    leaq  -8(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movl  $176, %eax
+    movslq %eax, %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _malloc
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-pre
+## assign
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB21_1:
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $5, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB21_2
+## for-body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $16, %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _init_message
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $88, %rax
+    pushq %rax
+    movl  $16, %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _init_message
+    addq  $16, %rsp
+## for-post
+_LBB21_4:
+    leaq  -12(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB21_1
+_LBB21_2:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $168, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $172, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    movq  -8(%rbp), %rax
+    jmp   _LBB20_0
+_LBB20_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _free_diagnostic
+_free_diagnostic:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## if-cond
+    movq  -8(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB23_3
+## if-then
+    jmp   _LBB22_0
+    jmp   _LBB23_2
+## if-else
+_LBB23_3:
+_LBB23_2:
+## for-pre
+## assign
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB24_1:
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $5, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB24_2
+## for-body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $16, %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free_message
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $88, %rax
+    pushq %rax
+    movl  $16, %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free_message
+    addq  $16, %rsp
+## for-post
+_LBB24_4:
+    leaq  -12(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB24_1
+_LBB24_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+_LBB22_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _add_warning
+_add_warning:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $1104, %rsp
+## func params
+    movq  %rdi, -48(%rbp)
+    movq  %rsi, -40(%rbp)
+    movq  %rdx, -32(%rbp)
+    movq  %rcx, -24(%rbp)
+    movq  %r8, -16(%rbp)
+    movq  %r9, -8(%rbp)
+## func body
+    leaq  -32(%rbp), %rax
+    subq  $8, %rsp
+    movq  %rax, (%rsp)
+    leaq  -72(%rbp), %rax
+    subq  $8, %rsp
+    movq  %rax, (%rsp)
+## __builtin_va_start
+    pop    %rax ## &va_list
+    pop    %rdx ## &last
+    leaq   -48(%rbp), %rdi ## gp_offset
+    subq   %rdi, %rdx      ## gp_offset
+    addq   $8, %rdx         ## gp_offset
+    movq   %rdx, (%rax)    ## gp_offset
+    movl   $48, 4(%rax)     ## fp_offset
+    leaq   16(%rbp), %rdi  ## overflow_arg_area
+    movq   %rdi, 8(%rax)   ## overflow_arg_area
+    leaq   -48(%rbp), %rdi ## reg_save_area
+    movq   %rdi, 16(%rax)  ## reg_save_area
+## end of __builtin_va_start
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $1, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $2, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $3, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $5, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $6, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $7, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $9, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $10, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $11, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $12, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $13, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $14, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $15, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $17, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $18, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $19, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $20, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $21, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $22, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $23, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $25, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $26, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $27, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $28, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $29, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $30, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $31, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $33, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $34, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $35, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $36, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $37, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $38, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $39, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $40, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $41, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $42, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $43, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $44, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $45, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $46, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $47, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $48, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $49, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $50, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $51, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $52, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $53, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $54, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $55, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $56, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $57, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $58, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $59, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $60, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $61, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $62, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $63, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $64, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $65, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $66, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $67, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $68, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $69, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $70, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $71, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $72, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $73, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $74, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $75, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $76, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $77, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $78, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $79, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $80, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $81, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $82, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $83, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $84, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $85, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $86, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $87, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $88, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $89, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $90, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $91, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $92, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $93, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $94, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $95, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $96, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $97, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $98, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $99, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $100, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $101, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $102, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $103, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $104, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $105, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $106, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $107, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $108, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $109, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $110, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $111, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $112, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $113, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $114, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $115, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $116, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $117, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $118, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $119, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $120, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $121, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $122, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $123, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $124, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $125, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $126, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $127, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $128, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $129, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $130, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $131, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $132, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $133, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $134, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $135, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $136, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $137, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $138, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $139, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $140, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $141, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $142, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $143, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $144, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $145, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $146, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $147, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $148, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $149, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $150, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $151, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $152, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $153, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $154, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $155, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $156, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $157, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $158, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $159, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $160, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $161, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $162, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $163, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $164, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $165, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $166, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $167, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $168, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $169, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $170, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $171, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $172, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $173, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $174, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $175, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $176, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $177, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $178, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $179, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $180, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $181, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $182, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $183, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $184, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $185, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $186, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $187, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $188, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $189, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $190, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $191, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $192, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $193, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $194, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $195, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $196, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $197, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $198, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $199, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $200, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $201, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $202, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $203, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $204, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $205, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $206, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $207, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $208, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $209, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $210, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $211, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $212, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $213, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $214, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $215, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $216, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $217, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $218, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $219, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $220, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $221, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $222, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $223, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $224, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $225, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $226, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $227, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $228, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $229, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $230, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $231, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $232, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $233, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $234, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $235, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $236, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $237, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $238, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $239, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $240, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $241, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $242, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $243, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $244, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $245, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $246, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $247, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $248, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $249, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $250, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $251, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $252, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $253, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $254, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $255, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $256, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $257, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $258, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $259, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $260, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $261, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $262, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $263, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $264, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $265, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $266, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $267, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $268, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $269, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $270, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $271, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $272, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $273, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $274, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $275, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $276, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $277, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $278, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $279, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $280, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $281, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $282, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $283, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $284, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $285, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $286, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $287, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $288, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $289, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $290, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $291, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $292, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $293, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $294, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $295, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $296, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $297, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $298, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $299, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $300, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $301, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $302, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $303, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $304, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $305, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $306, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $307, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $308, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $309, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $310, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $311, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $312, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $313, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $314, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $315, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $316, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $317, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $318, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $319, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $320, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $321, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $322, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $323, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $324, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $325, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $326, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $327, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $328, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $329, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $330, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $331, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $332, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $333, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $334, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $335, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $336, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $337, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $338, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $339, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $340, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $341, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $342, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $343, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $344, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $345, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $346, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $347, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $348, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $349, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $350, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $351, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $352, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $353, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $354, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $355, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $356, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $357, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $358, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $359, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $360, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $361, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $362, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $363, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $364, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $365, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $366, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $367, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $368, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $369, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $370, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $371, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $372, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $373, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $374, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $375, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $376, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $377, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $378, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $379, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $380, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $381, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $382, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $383, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $384, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $385, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $386, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $387, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $388, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $389, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $390, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $391, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $392, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $393, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $394, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $395, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $396, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $397, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $398, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $399, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $400, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $401, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $402, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $403, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $404, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $405, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $406, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $407, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $408, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $409, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $410, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $411, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $412, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $413, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $414, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $415, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $416, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $417, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $418, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $419, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $420, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $421, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $422, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $423, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $424, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $425, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $426, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $427, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $428, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $429, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $430, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $431, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $432, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $433, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $434, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $435, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $436, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $437, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $438, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $439, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $440, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $441, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $442, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $443, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $444, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $445, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $446, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $447, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $448, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $449, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $450, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $451, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $452, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $453, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $454, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $455, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $456, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $457, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $458, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $459, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $460, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $461, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $462, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $463, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $464, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $465, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $466, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $467, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $468, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $469, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $470, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $471, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $472, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $473, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $474, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $475, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $476, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $477, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $478, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $479, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $480, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $481, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $482, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $483, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $484, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $485, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $486, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $487, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $488, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $489, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $490, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $491, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $492, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $493, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $494, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $495, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $496, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $497, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $498, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $499, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $500, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $501, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $502, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $503, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $504, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $505, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $506, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $507, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $508, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $509, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $510, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $511, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $512, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $513, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $514, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $515, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $516, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $517, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $518, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $519, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $520, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $521, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $522, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $523, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $524, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $525, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $526, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $527, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $528, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $529, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $530, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $531, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $532, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $533, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $534, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $535, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $536, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $537, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $538, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $539, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $540, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $541, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $542, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $543, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $544, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $545, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $546, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $547, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $548, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $549, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $550, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $551, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $552, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $553, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $554, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $555, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $556, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $557, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $558, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $559, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $560, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $561, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $562, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $563, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $564, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $565, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $566, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $567, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $568, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $569, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $570, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $571, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $572, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $573, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $574, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $575, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $576, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $577, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $578, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $579, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $580, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $581, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $582, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $583, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $584, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $585, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $586, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $587, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $588, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $589, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $590, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $591, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $592, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $593, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $594, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $595, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $596, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $597, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $598, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $599, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $600, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $601, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $602, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $603, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $604, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $605, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $606, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $607, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $608, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $609, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $610, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $611, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $612, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $613, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $614, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $615, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $616, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $617, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $618, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $619, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $620, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $621, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $622, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $623, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $624, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $625, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $626, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $627, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $628, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $629, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $630, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $631, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $632, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $633, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $634, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $635, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $636, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $637, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $638, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $639, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $640, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $641, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $642, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $643, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $644, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $645, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $646, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $647, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $648, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $649, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $650, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $651, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $652, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $653, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $654, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $655, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $656, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $657, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $658, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $659, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $660, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $661, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $662, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $663, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $664, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $665, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $666, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $667, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $668, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $669, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $670, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $671, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $672, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $673, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $674, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $675, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $676, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $677, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $678, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $679, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $680, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $681, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $682, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $683, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $684, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $685, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $686, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $687, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $688, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $689, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $690, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $691, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $692, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $693, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $694, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $695, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $696, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $697, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $698, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $699, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $700, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $701, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $702, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $703, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $704, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $705, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $706, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $707, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $708, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $709, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $710, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $711, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $712, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $713, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $714, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $715, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $716, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $717, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $718, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $719, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $720, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $721, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $722, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $723, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $724, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $725, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $726, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $727, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $728, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $729, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $730, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $731, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $732, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $733, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $734, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $735, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $736, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $737, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $738, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $739, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $740, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $741, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $742, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $743, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $744, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $745, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $746, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $747, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $748, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $749, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $750, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $751, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $752, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $753, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $754, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $755, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $756, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $757, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $758, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $759, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $760, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $761, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $762, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $763, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $764, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $765, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $766, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $767, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $768, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $769, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $770, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $771, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $772, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $773, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $774, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $775, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $776, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $777, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $778, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $779, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $780, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $781, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $782, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $783, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $784, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $785, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $786, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $787, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $788, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $789, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $790, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $791, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $792, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $793, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $794, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $795, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $796, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $797, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $798, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $799, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $800, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $801, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $802, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $803, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $804, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $805, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $806, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $807, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $808, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $809, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $810, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $811, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $812, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $813, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $814, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $815, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $816, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $817, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $818, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $819, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $820, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $821, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $822, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $823, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $824, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $825, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $826, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $827, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $828, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $829, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $830, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $831, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $832, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $833, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $834, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $835, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $836, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $837, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $838, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $839, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $840, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $841, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $842, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $843, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $844, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $845, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $846, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $847, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $848, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $849, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $850, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $851, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $852, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $853, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $854, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $855, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $856, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $857, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $858, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $859, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $860, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $861, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $862, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $863, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $864, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $865, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $866, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $867, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $868, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $869, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $870, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $871, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $872, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $873, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $874, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $875, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $876, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $877, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $878, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $879, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $880, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $881, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $882, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $883, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $884, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $885, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $886, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $887, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $888, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $889, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $890, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $891, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $892, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $893, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $894, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $895, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $896, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $897, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $898, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $899, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $900, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $901, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $902, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $903, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $904, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $905, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $906, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $907, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $908, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $909, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $910, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $911, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $912, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $913, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $914, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $915, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $916, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $917, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $918, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $919, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $920, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $921, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $922, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $923, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $924, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $925, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $926, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $927, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $928, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $929, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $930, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $931, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $932, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $933, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $934, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $935, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $936, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $937, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $938, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $939, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $940, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $941, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $942, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $943, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $944, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $945, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $946, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $947, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $948, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $949, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $950, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $951, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $952, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $953, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $954, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $955, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $956, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $957, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $958, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $959, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $960, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $961, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $962, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $963, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $964, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $965, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $966, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $967, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $968, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $969, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $970, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $971, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $972, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $973, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $974, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $975, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $976, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $977, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $978, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $979, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $980, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $981, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $982, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $983, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $984, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $985, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $986, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $987, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $988, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $989, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $990, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $991, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $992, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $993, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $994, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $995, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $996, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $997, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $998, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $999, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $1000, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $1001, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $1002, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $1003, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $1004, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $1005, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $1006, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $1007, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $1008, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $1009, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $1010, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $1011, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $1012, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $1013, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $1014, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $1015, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $1016, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $1017, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $1018, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $1019, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $1020, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $1021, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $1022, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $1023, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## if-cond
+    movq  -48(%rbp), %rax
+    addq  $168, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $5, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setge %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB26_3
+## if-then
+    movq  -48(%rbp), %rax
+    addq  $168, %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB25_0
+    jmp   _LBB26_2
+## if-else
+_LBB26_3:
+_LBB26_2:
+## assign
+    leaq  -80(%rbp), %rax
+    pushq %rax
+    movq  -48(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $16, %eax
+    pushq %rax
+    movq  -48(%rbp), %rax
+    addq  $168, %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -80(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movq  -40(%rbp), %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $32, %rsp
+    leaq  -1104(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -32(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    leaq  -72(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _vsprintf
+    addq  $32, %rsp
+## assign
+    movq  -80(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    subq  $8, %rsp
+    movl  $1, %eax
+    movslq %eax, %rax
+    pushq %rax
+    subq  $8, %rsp
+    leaq  -1104(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _strlen
+    addq  $8, %rsp
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _malloc
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -80(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  -1104(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcpy
+    addq  $16, %rsp
+_LBB25_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _add_error
+_add_error:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $1104, %rsp
+## func params
+    movq  %rdi, -48(%rbp)
+    movq  %rsi, -40(%rbp)
+    movq  %rdx, -32(%rbp)
+    movq  %rcx, -24(%rbp)
+    movq  %r8, -16(%rbp)
+    movq  %r9, -8(%rbp)
+## func body
+    leaq  -32(%rbp), %rax
+    subq  $8, %rsp
+    movq  %rax, (%rsp)
+    leaq  -72(%rbp), %rax
+    subq  $8, %rsp
+    movq  %rax, (%rsp)
+## __builtin_va_start
+    pop    %rax ## &va_list
+    pop    %rdx ## &last
+    leaq   -48(%rbp), %rdi ## gp_offset
+    subq   %rdi, %rdx      ## gp_offset
+    addq   $8, %rdx         ## gp_offset
+    movq   %rdx, (%rax)    ## gp_offset
+    movl   $48, 4(%rax)     ## fp_offset
+    leaq   16(%rbp), %rdi  ## overflow_arg_area
+    movq   %rdi, 8(%rax)   ## overflow_arg_area
+    leaq   -48(%rbp), %rdi ## reg_save_area
+    movq   %rdi, 16(%rax)  ## reg_save_area
+## end of __builtin_va_start
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $1, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $2, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $3, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $5, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $6, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $7, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $9, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $10, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $11, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $12, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $13, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $14, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $15, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $17, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $18, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $19, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $20, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $21, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $22, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $23, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $25, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $26, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $27, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $28, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $29, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $30, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $31, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $33, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $34, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $35, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $36, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $37, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $38, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $39, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $40, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $41, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $42, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $43, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $44, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $45, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $46, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $47, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $48, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $49, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $50, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $51, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $52, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $53, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $54, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $55, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $56, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $57, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $58, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $59, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $60, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $61, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $62, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $63, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $64, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $65, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $66, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $67, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $68, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $69, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $70, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $71, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $72, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $73, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $74, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $75, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $76, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $77, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $78, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $79, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $80, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $81, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $82, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $83, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $84, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $85, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $86, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $87, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $88, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $89, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $90, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $91, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $92, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $93, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $94, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $95, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $96, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $97, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $98, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $99, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $100, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $101, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $102, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $103, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $104, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $105, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $106, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $107, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $108, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $109, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $110, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $111, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $112, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $113, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $114, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $115, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $116, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $117, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $118, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $119, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $120, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $121, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $122, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $123, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $124, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $125, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $126, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $127, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $128, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $129, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $130, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $131, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $132, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $133, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $134, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $135, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $136, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $137, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $138, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $139, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $140, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $141, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $142, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $143, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $144, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $145, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $146, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $147, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $148, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $149, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $150, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $151, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $152, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $153, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $154, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $155, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $156, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $157, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $158, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $159, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $160, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $161, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $162, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $163, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $164, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $165, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $166, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $167, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $168, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $169, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $170, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $171, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $172, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $173, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $174, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $175, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $176, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $177, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $178, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $179, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $180, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $181, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $182, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $183, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $184, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $185, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $186, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $187, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $188, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $189, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $190, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $191, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $192, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $193, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $194, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $195, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $196, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $197, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $198, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $199, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $200, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $201, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $202, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $203, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $204, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $205, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $206, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $207, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $208, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $209, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $210, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $211, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $212, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $213, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $214, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $215, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $216, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $217, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $218, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $219, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $220, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $221, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $222, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $223, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $224, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $225, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $226, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $227, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $228, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $229, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $230, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $231, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $232, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $233, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $234, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $235, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $236, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $237, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $238, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $239, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $240, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $241, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $242, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $243, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $244, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $245, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $246, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $247, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $248, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $249, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $250, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $251, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $252, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $253, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $254, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $255, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $256, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $257, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $258, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $259, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $260, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $261, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $262, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $263, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $264, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $265, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $266, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $267, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $268, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $269, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $270, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $271, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $272, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $273, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $274, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $275, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $276, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $277, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $278, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $279, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $280, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $281, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $282, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $283, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $284, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $285, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $286, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $287, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $288, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $289, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $290, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $291, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $292, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $293, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $294, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $295, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $296, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $297, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $298, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $299, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $300, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $301, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $302, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $303, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $304, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $305, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $306, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $307, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $308, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $309, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $310, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $311, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $312, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $313, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $314, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $315, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $316, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $317, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $318, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $319, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $320, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $321, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $322, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $323, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $324, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $325, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $326, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $327, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $328, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $329, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $330, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $331, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $332, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $333, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $334, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $335, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $336, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $337, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $338, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $339, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $340, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $341, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $342, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $343, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $344, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $345, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $346, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $347, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $348, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $349, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $350, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $351, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $352, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $353, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $354, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $355, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $356, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $357, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $358, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $359, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $360, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $361, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $362, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $363, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $364, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $365, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $366, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $367, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $368, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $369, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $370, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $371, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $372, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $373, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $374, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $375, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $376, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $377, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $378, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $379, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $380, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $381, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $382, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $383, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $384, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $385, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $386, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $387, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $388, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $389, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $390, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $391, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $392, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $393, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $394, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $395, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $396, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $397, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $398, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $399, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $400, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $401, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $402, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $403, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $404, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $405, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $406, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $407, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $408, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $409, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $410, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $411, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $412, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $413, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $414, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $415, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $416, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $417, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $418, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $419, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $420, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $421, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $422, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $423, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $424, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $425, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $426, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $427, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $428, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $429, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $430, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $431, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $432, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $433, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $434, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $435, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $436, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $437, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $438, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $439, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $440, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $441, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $442, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $443, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $444, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $445, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $446, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $447, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $448, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $449, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $450, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $451, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $452, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $453, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $454, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $455, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $456, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $457, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $458, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $459, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $460, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $461, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $462, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $463, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $464, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $465, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $466, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $467, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $468, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $469, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $470, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $471, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $472, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $473, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $474, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $475, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $476, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $477, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $478, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $479, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $480, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $481, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $482, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $483, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $484, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $485, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $486, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $487, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $488, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $489, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $490, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $491, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $492, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $493, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $494, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $495, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $496, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $497, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $498, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $499, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $500, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $501, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $502, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $503, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $504, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $505, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $506, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $507, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $508, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $509, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $510, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $511, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $512, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $513, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $514, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $515, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $516, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $517, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $518, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $519, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $520, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $521, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $522, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $523, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $524, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $525, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $526, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $527, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $528, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $529, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $530, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $531, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $532, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $533, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $534, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $535, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $536, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $537, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $538, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $539, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $540, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $541, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $542, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $543, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $544, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $545, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $546, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $547, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $548, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $549, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $550, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $551, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $552, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $553, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $554, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $555, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $556, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $557, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $558, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $559, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $560, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $561, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $562, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $563, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $564, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $565, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $566, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $567, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $568, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $569, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $570, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $571, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $572, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $573, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $574, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $575, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $576, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $577, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $578, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $579, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $580, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $581, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $582, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $583, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $584, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $585, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $586, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $587, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $588, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $589, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $590, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $591, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $592, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $593, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $594, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $595, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $596, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $597, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $598, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $599, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $600, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $601, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $602, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $603, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $604, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $605, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $606, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $607, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $608, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $609, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $610, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $611, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $612, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $613, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $614, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $615, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $616, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $617, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $618, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $619, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $620, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $621, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $622, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $623, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $624, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $625, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $626, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $627, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $628, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $629, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $630, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $631, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $632, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $633, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $634, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $635, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $636, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $637, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $638, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $639, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $640, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $641, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $642, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $643, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $644, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $645, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $646, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $647, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $648, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $649, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $650, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $651, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $652, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $653, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $654, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $655, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $656, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $657, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $658, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $659, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $660, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $661, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $662, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $663, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $664, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $665, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $666, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $667, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $668, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $669, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $670, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $671, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $672, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $673, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $674, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $675, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $676, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $677, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $678, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $679, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $680, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $681, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $682, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $683, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $684, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $685, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $686, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $687, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $688, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $689, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $690, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $691, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $692, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $693, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $694, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $695, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $696, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $697, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $698, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $699, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $700, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $701, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $702, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $703, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $704, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $705, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $706, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $707, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $708, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $709, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $710, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $711, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $712, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $713, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $714, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $715, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $716, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $717, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $718, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $719, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $720, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $721, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $722, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $723, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $724, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $725, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $726, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $727, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $728, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $729, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $730, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $731, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $732, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $733, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $734, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $735, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $736, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $737, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $738, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $739, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $740, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $741, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $742, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $743, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $744, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $745, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $746, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $747, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $748, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $749, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $750, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $751, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $752, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $753, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $754, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $755, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $756, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $757, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $758, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $759, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $760, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $761, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $762, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $763, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $764, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $765, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $766, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $767, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $768, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $769, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $770, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $771, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $772, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $773, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $774, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $775, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $776, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $777, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $778, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $779, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $780, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $781, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $782, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $783, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $784, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $785, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $786, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $787, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $788, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $789, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $790, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $791, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $792, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $793, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $794, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $795, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $796, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $797, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $798, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $799, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $800, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $801, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $802, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $803, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $804, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $805, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $806, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $807, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $808, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $809, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $810, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $811, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $812, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $813, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $814, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $815, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $816, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $817, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $818, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $819, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $820, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $821, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $822, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $823, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $824, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $825, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $826, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $827, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $828, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $829, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $830, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $831, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $832, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $833, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $834, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $835, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $836, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $837, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $838, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $839, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $840, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $841, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $842, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $843, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $844, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $845, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $846, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $847, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $848, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $849, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $850, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $851, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $852, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $853, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $854, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $855, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $856, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $857, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $858, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $859, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $860, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $861, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $862, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $863, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $864, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $865, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $866, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $867, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $868, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $869, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $870, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $871, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $872, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $873, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $874, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $875, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $876, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $877, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $878, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $879, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $880, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $881, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $882, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $883, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $884, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $885, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $886, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $887, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $888, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $889, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $890, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $891, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $892, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $893, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $894, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $895, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $896, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $897, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $898, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $899, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $900, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $901, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $902, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $903, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $904, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $905, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $906, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $907, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $908, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $909, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $910, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $911, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $912, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $913, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $914, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $915, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $916, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $917, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $918, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $919, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $920, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $921, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $922, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $923, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $924, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $925, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $926, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $927, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $928, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $929, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $930, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $931, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $932, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $933, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $934, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $935, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $936, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $937, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $938, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $939, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $940, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $941, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $942, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $943, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $944, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $945, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $946, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $947, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $948, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $949, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $950, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $951, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $952, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $953, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $954, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $955, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $956, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $957, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $958, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $959, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $960, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $961, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $962, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $963, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $964, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $965, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $966, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $967, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $968, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $969, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $970, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $971, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $972, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $973, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $974, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $975, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $976, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $977, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $978, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $979, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $980, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $981, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $982, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $983, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $984, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $985, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $986, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $987, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $988, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $989, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $990, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $991, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $992, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $993, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $994, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $995, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $996, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $997, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $998, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $999, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $1000, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $1001, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $1002, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $1003, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $1004, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $1005, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $1006, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $1007, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $1008, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $1009, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $1010, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $1011, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $1012, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $1013, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $1014, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $1015, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $1016, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $1017, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $1018, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $1019, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $1020, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $1021, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $1022, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -1104(%rbp), %rax
+    addq  $1023, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## if-cond
+    movq  -48(%rbp), %rax
+    addq  $172, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $5, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setge %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB28_3
+## if-then
+    movq  -48(%rbp), %rax
+    addq  $172, %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB27_0
+    jmp   _LBB28_2
+## if-else
+_LBB28_3:
+_LBB28_2:
+## assign
+    leaq  -80(%rbp), %rax
+    pushq %rax
+    movq  -48(%rbp), %rax
+    addq  $88, %rax
+    pushq %rax
+    movl  $16, %eax
+    pushq %rax
+    movq  -48(%rbp), %rax
+    addq  $172, %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -80(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movq  -40(%rbp), %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $32, %rsp
+    leaq  -1104(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -32(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    leaq  -72(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _vsprintf
+    addq  $32, %rsp
+## assign
+    movq  -80(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    subq  $8, %rsp
+    movl  $1, %eax
+    movslq %eax, %rax
+    pushq %rax
+    subq  $8, %rsp
+    leaq  -1104(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _strlen
+    addq  $8, %rsp
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _malloc
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -80(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  -1104(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcpy
+    addq  $16, %rsp
+_LBB27_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _print_warnings
+_print_warnings:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  %rax, 16(%rsp)
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _print_message_array
+    addq  $32, %rsp
+_LBB29_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _print_errors
+_print_errors:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $88, %rax
+    movq  %rax, 16(%rsp)
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _print_message_array
+    addq  $32, %rsp
+_LBB30_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
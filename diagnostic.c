@@ -3,6 +3,7 @@
 #include <stdarg.h>
 #include <string.h>
 #include "diagnostic.h"
+#include "source_map.h"
 
 #define TERMINAL_COLOR_BLACK   "\x1b[30m"
 #define TERMINAL_COLOR_RED     "\x1b[31m"
@@ -70,11 +71,17 @@ static void print_line(const char *filepath, int row, int col)
     fclose(fp);
 }
 
-static void print_message(const struct message *msg, int msg_type)
+static void print_message(const struct diagnostic *diag,
+        const struct message *msg, int msg_type)
 {
-    const char *err_filepath = msg->pos.filename;
-    const int err_col = msg->pos.x;
-    const int err_row = msg->pos.y;
+    struct source_location loc;
+    const char *err_filepath;
+    int err_col, err_row;
+
+    resolve_position(diag->srcmap, &msg->pos, &loc);
+    err_filepath = loc.filename;
+    err_col = loc.column;
+    err_row = loc.line;
 
     if (msg_type == ERROR) {
         fprintf(stderr, TERMINAL_DECORATION_BOLD);
@@ -99,7 +106,8 @@ static void print_message(const struct message *msg, int msg_type)
     print_line(err_filepath, err_row, err_col);
 }
 
-static void print_message_array(const struct message *msg_array, int msg_type)
+static void print_message_array(const struct diagnostic *diag,
+        const struct message *msg_array, int msg_type)
 {
     int i;
 
@@ -107,7 +115,7 @@ static void print_message_array(const struct message *msg_array, int msg_type)
         const struct message *msg = &msg_array[i];
 
         if (msg->str)
-            print_message(msg, msg_type);
+            print_message(diag, msg, msg_type);
     }
 }
 
@@ -135,6 +143,7 @@ struct diagnostic *new_diagnostic()
         init_message(&diag->errors[i]);
     }
 
+    diag->srcmap = NULL;
     diag->warning_count = 0;
     diag->error_count = 0;
 
@@ -206,10 +215,10 @@ void add_error(struct diagnostic *diag, const struct position *pos,
 
 void print_warnings(const struct diagnostic *diag)
 {
-    print_message_array(diag->warnings, WARNING);
+    print_message_array(diag, diag->warnings, WARNING);
 }
 
 void print_errors(const struct diagnostic *diag)
 {
-    print_message_array(diag->errors, ERROR);
+    print_message_array(diag, diag->errors, ERROR);
 }
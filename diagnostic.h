@@ -10,7 +10,12 @@ struct message {
     struct position pos;
 };
 
+struct source_map;
+
 struct diagnostic {
+    /* to find lines and columns of messages */
+    struct source_map *srcmap;
+
     struct message warnings[MAX_MESSAGE_COUNT];
     struct message errors[MAX_MESSAGE_COUNT];
 
@@ -0,0 +1,857 @@
+    .data
+
+    .text
+
+_L_str_181:
+    .asciz "\\%03o"
+
+_L_str_182:
+    .asciz "%s"
+
+_L_str_183:
+    .asciz "%c"
+
+_L_str_201:
+    .asciz "\\%c"
+
+    .global _escape_sequence_to_char
+_escape_sequence_to_char:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $92, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB1_3
+## if-then
+    movl  $0, %eax
+    jmp   _LBB0_0
+    jmp   _LBB1_2
+## if-else
+_LBB1_3:
+_LBB1_2:
+## switch-value
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+## begin jump table
+    cmpl  $48, %eax
+    je    _LBB2_233
+    cmpl  $92, %eax
+    je    _LBB2_234
+    cmpl  $39, %eax
+    je    _LBB2_235
+    cmpl  $34, %eax
+    je    _LBB2_236
+    cmpl  $97, %eax
+    je    _LBB2_237
+    cmpl  $98, %eax
+    je    _LBB2_238
+    cmpl  $102, %eax
+    je    _LBB2_239
+    cmpl  $110, %eax
+    je    _LBB2_240
+    cmpl  $114, %eax
+    je    _LBB2_241
+    cmpl  $116, %eax
+    je    _LBB2_242
+    cmpl  $118, %eax
+    je    _LBB2_243
+    jmp   _LBB2_244
+    jmp   _LBB2_2
+## end jump table
+_LBB2_233:
+## assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB2_2
+_LBB2_234:
+## assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $92, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB2_2
+_LBB2_235:
+## assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $39, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB2_2
+_LBB2_236:
+## assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $34, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB2_2
+_LBB2_237:
+## assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $7, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB2_2
+_LBB2_238:
+## assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $8, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB2_2
+_LBB2_239:
+## assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $12, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB2_2
+_LBB2_240:
+## assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $10, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB2_2
+_LBB2_241:
+## assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $13, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB2_2
+_LBB2_242:
+## assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $9, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB2_2
+_LBB2_243:
+## assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $11, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB2_2
+_LBB2_244:
+    movl  $0, %eax
+    jmp   _LBB0_0
+_LBB2_2:
+## assign
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movl  -20(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    movl  $1, %eax
+    jmp   _LBB0_0
+_LBB0_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _char_to_escape_sequence
+_char_to_escape_sequence:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movl  %edi, -4(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movq  -16(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB4_3
+## if-then
+    movl  $0, %eax
+    jmp   _LBB3_0
+    jmp   _LBB4_2
+## if-else
+_LBB4_3:
+_LBB4_2:
+## switch-value
+    movl  -4(%rbp), %eax
+## begin jump table
+    cmpl  $0, %eax
+    je    _LBB5_257
+    cmpl  $92, %eax
+    je    _LBB5_258
+    cmpl  $39, %eax
+    je    _LBB5_259
+    cmpl  $34, %eax
+    je    _LBB5_260
+    cmpl  $7, %eax
+    je    _LBB5_261
+    cmpl  $8, %eax
+    je    _LBB5_262
+    cmpl  $12, %eax
+    je    _LBB5_263
+    cmpl  $10, %eax
+    je    _LBB5_264
+    cmpl  $13, %eax
+    je    _LBB5_265
+    cmpl  $9, %eax
+    je    _LBB5_266
+    cmpl  $11, %eax
+    je    _LBB5_267
+    jmp   _LBB5_268
+    jmp   _LBB5_2
+## end jump table
+_LBB5_257:
+## assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $48, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB5_2
+_LBB5_258:
+## assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $92, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB5_2
+_LBB5_259:
+## assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $39, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB5_2
+_LBB5_260:
+## assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $34, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB5_2
+_LBB5_261:
+## assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $97, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB5_2
+_LBB5_262:
+## assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $98, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB5_2
+_LBB5_263:
+## assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $102, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB5_2
+_LBB5_264:
+## assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $110, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB5_2
+_LBB5_265:
+## assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $114, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB5_2
+_LBB5_266:
+## assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $116, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB5_2
+_LBB5_267:
+## assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $118, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB5_2
+_LBB5_268:
+    movl  $0, %eax
+    jmp   _LBB3_0
+_LBB5_2:
+## assign
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $92, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## assign
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  -20(%rbp), %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## assign
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+    movl  $1, %eax
+    jmp   _LBB3_0
+_LBB3_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _print_string_literal
+_print_string_literal:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -28(%rbp), %rax
+    addq  $1, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -28(%rbp), %rax
+    addq  $2, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -28(%rbp), %rax
+    addq  $3, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## for-pre
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB7_1:
+    movq  -24(%rbp), %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    je    _LBB7_2
+## for-body
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _iscntrl
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB8_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_181(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+    jmp   _LBB8_2
+## if-else
+_LBB8_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -28(%rbp), %rax
+    movq  %rax, (%rsp)
+    movl  8(%rsp), %edi
+    movq  (%rsp), %rsi
+    callq _char_to_escape_sequence
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB10_2
+    movq  -24(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $39, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB10_2
+    movl  $1, %eax
+_LBB10_2:
+    cmpl  $0, %eax
+    je    _LBB9_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_182(%rip), %rax
+    movq  %rax, 16(%rsp)
+    leaq  -28(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+    jmp   _LBB9_2
+## if-else
+_LBB9_3:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_183(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+_LBB9_2:
+_LBB8_2:
+## for-post
+_LBB7_4:
+    leaq  -24(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    jmp   _LBB7_1
+_LBB7_2:
+_LBB6_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _make_string_literal
+_make_string_literal:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movq  %rdx, -24(%rbp)
+## func body
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -44(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -44(%rbp), %rax
+    addq  $1, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -44(%rbp), %rax
+    addq  $2, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -44(%rbp), %rax
+    addq  $3, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-pre
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB12_1:
+    movq  -32(%rbp), %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    je    _LBB12_2
+## for-body
+## if-cond
+    subq  $16, %rsp
+    movq  -32(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _iscntrl
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB13_3
+## if-then
+## if-cond
+    movq  -40(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    pushq %rax
+    movl  -48(%rbp), %eax
+    pushq %rax
+    movl  $4, %eax
+    movl  %eax, %edx
+    popq  %rax
+    subl  %edx, %eax
+    movslq %eax, %rax
+    movq  %rax, %rdx
+    popq  %rax
+    cmpq  %rdx, %rax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB14_3
+## if-then
+    jmp   _LBB12_2
+    jmp   _LBB14_2
+## if-else
+_LBB14_3:
+_LBB14_2:
+    subq  $32, %rsp
+    movq  -40(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_181(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  -32(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    movb  $0, %al
+    callq _sprintf
+    addq  $32, %rsp
+## add-assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    popq  %rdx
+    addq  %rax, (%rdx)
+    movq  (%rdx), %rax
+    jmp   _LBB13_2
+## if-else
+_LBB13_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -32(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -44(%rbp), %rax
+    movq  %rax, (%rsp)
+    movl  8(%rsp), %edi
+    movq  (%rsp), %rsi
+    callq _char_to_escape_sequence
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB16_2
+    movq  -32(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $39, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB16_2
+    movl  $1, %eax
+_LBB16_2:
+    cmpl  $0, %eax
+    je    _LBB15_3
+## if-then
+## if-cond
+    movq  -40(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    pushq %rax
+    movl  -48(%rbp), %eax
+    pushq %rax
+    movl  $2, %eax
+    movl  %eax, %edx
+    popq  %rax
+    subl  %edx, %eax
+    movslq %eax, %rax
+    movq  %rax, %rdx
+    popq  %rax
+    cmpq  %rdx, %rax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB17_3
+## if-then
+    jmp   _LBB12_2
+    jmp   _LBB17_2
+## if-else
+_LBB17_3:
+_LBB17_2:
+    subq  $32, %rsp
+    movq  -40(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_201(%rip), %rax
+    movq  %rax, 16(%rsp)
+    leaq  -44(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    movb  $0, %al
+    callq _sprintf
+    addq  $32, %rsp
+## add-assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    addq  %rax, (%rdx)
+    movq  (%rdx), %rax
+    jmp   _LBB15_2
+## if-else
+_LBB15_3:
+## if-cond
+    movq  -40(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    pushq %rax
+    movl  -48(%rbp), %eax
+    pushq %rax
+    movl  $1, %eax
+    movl  %eax, %edx
+    popq  %rax
+    subl  %edx, %eax
+    movslq %eax, %rax
+    movq  %rax, %rdx
+    popq  %rax
+    cmpq  %rdx, %rax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB18_3
+## if-then
+    jmp   _LBB12_2
+    jmp   _LBB18_2
+## if-else
+_LBB18_3:
+_LBB18_2:
+## assign
+    leaq  -40(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    pushq %rax
+    movq  -32(%rbp), %rax
+    movb  (%rax), %al
+    popq  %rdx
+    movb  %al, (%rdx)
+_LBB15_2:
+_LBB13_2:
+## for-post
+_LBB12_4:
+    leaq  -32(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    jmp   _LBB12_1
+_LBB12_2:
+## assign
+    movq  -40(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+_LBB11_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
@@ -0,0 +1,23769 @@
+    .data
+
+_att_syntax_1004:
+    .long 1
+
+_operand_label_1005:
+    .quad 0
+
+_operand_symbol_1006:
+    .quad 0
+
+_operand_label_id_1007:
+    .long 0
+
+_operand_symbol_id_1008:
+    .long 0
+
+_operand_register_1009:
+    .long 0
+
+_operand_immediate_1010:
+    .quad 0
+
+_operand_offset_1011:
+    .quad 0
+
+_opecode_mnem_1012:
+    .long 0
+
+_opecode_len_1013:
+    .long 0
+
+_stack_offset_1014:
+    .long 8
+
+_register_name_1148:
+    .byte 97
+    .byte 95
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 97
+    .byte 108
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 97
+    .byte 120
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 101
+    .byte 97
+    .byte 120
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 114
+    .byte 97
+    .byte 120
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 98
+    .byte 95
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 98
+    .byte 108
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 98
+    .byte 120
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 101
+    .byte 98
+    .byte 120
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 114
+    .byte 98
+    .byte 120
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 99
+    .byte 95
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 99
+    .byte 108
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 99
+    .byte 120
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 101
+    .byte 99
+    .byte 120
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 114
+    .byte 99
+    .byte 120
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 100
+    .byte 95
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 100
+    .byte 108
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 100
+    .byte 120
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 101
+    .byte 100
+    .byte 120
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 114
+    .byte 100
+    .byte 120
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 100
+    .byte 105
+    .byte 95
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 100
+    .byte 105
+    .byte 108
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 100
+    .byte 105
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 101
+    .byte 100
+    .byte 105
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 114
+    .byte 100
+    .byte 105
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 115
+    .byte 105
+    .byte 95
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 115
+    .byte 105
+    .byte 108
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 115
+    .byte 105
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 101
+    .byte 115
+    .byte 105
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 114
+    .byte 115
+    .byte 105
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 98
+    .byte 112
+    .byte 95
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 98
+    .byte 112
+    .byte 108
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 98
+    .byte 112
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 101
+    .byte 98
+    .byte 112
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 114
+    .byte 98
+    .byte 112
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 115
+    .byte 112
+    .byte 95
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 115
+    .byte 112
+    .byte 108
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 115
+    .byte 112
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 101
+    .byte 115
+    .byte 112
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 114
+    .byte 115
+    .byte 112
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 114
+    .byte 56
+    .byte 95
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 114
+    .byte 56
+    .byte 98
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 114
+    .byte 56
+    .byte 119
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 114
+    .byte 56
+    .byte 100
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 114
+    .byte 56
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 114
+    .byte 57
+    .byte 95
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 114
+    .byte 57
+    .byte 98
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 114
+    .byte 57
+    .byte 119
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 114
+    .byte 57
+    .byte 100
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 114
+    .byte 57
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 114
+    .byte 49
+    .byte 48
+    .byte 95
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 114
+    .byte 49
+    .byte 48
+    .byte 98
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 114
+    .byte 49
+    .byte 48
+    .byte 119
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 114
+    .byte 49
+    .byte 48
+    .byte 100
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 114
+    .byte 49
+    .byte 48
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 114
+    .byte 49
+    .byte 49
+    .byte 95
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 114
+    .byte 49
+    .byte 49
+    .byte 98
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 114
+    .byte 49
+    .byte 49
+    .byte 119
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 114
+    .byte 49
+    .byte 49
+    .byte 100
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 114
+    .byte 49
+    .byte 49
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 114
+    .byte 49
+    .byte 50
+    .byte 95
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 114
+    .byte 49
+    .byte 50
+    .byte 98
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 114
+    .byte 49
+    .byte 50
+    .byte 119
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 114
+    .byte 49
+    .byte 50
+    .byte 100
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 114
+    .byte 49
+    .byte 50
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 114
+    .byte 49
+    .byte 51
+    .byte 95
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 114
+    .byte 49
+    .byte 51
+    .byte 98
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 114
+    .byte 49
+    .byte 51
+    .byte 119
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 114
+    .byte 49
+    .byte 51
+    .byte 100
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 114
+    .byte 49
+    .byte 51
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 114
+    .byte 49
+    .byte 52
+    .byte 95
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 114
+    .byte 49
+    .byte 52
+    .byte 98
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 114
+    .byte 49
+    .byte 52
+    .byte 119
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 114
+    .byte 49
+    .byte 52
+    .byte 100
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 114
+    .byte 49
+    .byte 52
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 114
+    .byte 49
+    .byte 53
+    .byte 95
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 114
+    .byte 49
+    .byte 53
+    .byte 98
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 114
+    .byte 49
+    .byte 53
+    .byte 119
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 114
+    .byte 49
+    .byte 53
+    .byte 100
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 114
+    .byte 49
+    .byte 53
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 120
+    .byte 109
+    .byte 109
+    .byte 48
+    .byte 95
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 120
+    .byte 109
+    .byte 109
+    .byte 48
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 120
+    .byte 109
+    .byte 109
+    .byte 48
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 120
+    .byte 109
+    .byte 109
+    .byte 48
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 120
+    .byte 109
+    .byte 109
+    .byte 48
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 120
+    .byte 109
+    .byte 109
+    .byte 49
+    .byte 95
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 120
+    .byte 109
+    .byte 109
+    .byte 49
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 120
+    .byte 109
+    .byte 109
+    .byte 49
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 120
+    .byte 109
+    .byte 109
+    .byte 49
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 120
+    .byte 109
+    .byte 109
+    .byte 49
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 120
+    .byte 109
+    .byte 109
+    .byte 50
+    .byte 95
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 120
+    .byte 109
+    .byte 109
+    .byte 50
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 120
+    .byte 109
+    .byte 109
+    .byte 50
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 120
+    .byte 109
+    .byte 109
+    .byte 50
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 120
+    .byte 109
+    .byte 109
+    .byte 50
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 120
+    .byte 109
+    .byte 109
+    .byte 51
+    .byte 95
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 120
+    .byte 109
+    .byte 109
+    .byte 51
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 120
+    .byte 109
+    .byte 109
+    .byte 51
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 120
+    .byte 109
+    .byte 109
+    .byte 51
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 120
+    .byte 109
+    .byte 109
+    .byte 51
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 120
+    .byte 109
+    .byte 109
+    .byte 52
+    .byte 95
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 120
+    .byte 109
+    .byte 109
+    .byte 52
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 120
+    .byte 109
+    .byte 109
+    .byte 52
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 120
+    .byte 109
+    .byte 109
+    .byte 52
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 120
+    .byte 109
+    .byte 109
+    .byte 52
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 120
+    .byte 109
+    .byte 109
+    .byte 53
+    .byte 95
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 120
+    .byte 109
+    .byte 109
+    .byte 53
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 120
+    .byte 109
+    .byte 109
+    .byte 53
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 120
+    .byte 109
+    .byte 109
+    .byte 53
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 120
+    .byte 109
+    .byte 109
+    .byte 53
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 120
+    .byte 109
+    .byte 109
+    .byte 54
+    .byte 95
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 120
+    .byte 109
+    .byte 109
+    .byte 54
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 120
+    .byte 109
+    .byte 109
+    .byte 54
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 120
+    .byte 109
+    .byte 109
+    .byte 54
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 120
+    .byte 109
+    .byte 109
+    .byte 54
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 120
+    .byte 109
+    .byte 109
+    .byte 55
+    .byte 95
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 120
+    .byte 109
+    .byte 109
+    .byte 55
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 120
+    .byte 109
+    .byte 109
+    .byte 55
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 120
+    .byte 109
+    .byte 109
+    .byte 55
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 120
+    .byte 109
+    .byte 109
+    .byte 55
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+
+_arg_reg_list_1149:
+    .long 20
+    .long 25
+    .long 15
+    .long 10
+    .long 40
+    .long 45
+
+_arg_fp_list_1150:
+    .long 80
+    .long 85
+    .long 90
+    .long 95
+    .long 100
+    .long 105
+    .long 110
+    .long 115
+
+_directive_1151:
+    .byte 63
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 98
+    .byte 121
+    .byte 116
+    .byte 101
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 119
+    .byte 111
+    .byte 114
+    .byte 100
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 100
+    .byte 119
+    .byte 111
+    .byte 114
+    .byte 100
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 113
+    .byte 119
+    .byte 111
+    .byte 114
+    .byte 100
+    .byte 0
+    .byte 0
+    .byte 0
+
+_data_name_1152:
+    .byte 63
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 98
+    .byte 121
+    .byte 116
+    .byte 101
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 119
+    .byte 111
+    .byte 114
+    .byte 100
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 108
+    .byte 111
+    .byte 110
+    .byte 103
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 113
+    .byte 117
+    .byte 97
+    .byte 100
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+
+_suffix_letter_1153:
+    .byte 63
+    .byte 98
+    .byte 119
+    .byte 108
+    .byte 113
+    .byte 115
+    .byte 100
+
+_size_to_offset_1154:
+    .long 0
+    .long 1
+    .long 2
+    .long 3
+    .long 4
+    .long 3
+    .long 4
+
+_instruction_name_1212:
+    .quad _L_str_1213
+    .quad _L_str_1214
+    .quad _L_str_1215
+    .quad _L_str_1216
+    .quad _L_str_1217
+    .quad _L_str_1218
+    .quad _L_str_1219
+    .quad _L_str_1220
+    .quad _L_str_1221
+    .quad _L_str_1222
+    .quad _L_str_1223
+    .quad _L_str_1224
+    .quad _L_str_1225
+    .quad _L_str_1226
+    .quad _L_str_1227
+    .quad _L_str_1228
+    .quad _L_str_1229
+    .quad _L_str_1230
+    .quad _L_str_1231
+    .quad _L_str_1232
+    .quad _L_str_1233
+    .quad _L_str_1234
+    .quad _L_str_1235
+    .quad _L_str_1236
+    .quad _L_str_1237
+    .quad _L_str_1238
+    .quad _L_str_1239
+    .quad _L_str_1240
+    .quad _L_str_1241
+    .quad _L_str_1242
+    .quad _L_str_1243
+    .quad _L_str_1244
+    .quad _L_str_1245
+    .quad _L_str_1246
+    .quad _L_str_1247
+    .quad _L_str_1248
+    .quad _L_str_1249
+    .quad _L_str_1250
+    .quad _L_str_1251
+    .quad _L_str_1252
+    .quad _L_str_1253
+    .quad _L_str_1254
+    .quad _L_str_1255
+    .quad _L_str_1256
+    .quad _L_str_1257
+    .quad _L_str_1258
+    .quad _L_str_1259
+    .quad _L_str_1260
+    .quad _L_str_1261
+    .quad _L_str_1262
+
+_LABEL_NAME_PREFIX_1443:
+    .quad _L_str_1444
+
+_STR_LIT_NAME_PREFIX_1445:
+    .quad _L_str_1446
+
+_FP_LIT_NAME_PREFIX_1447:
+    .quad _L_str_1448
+
+_buf_1454:
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+
+_local_area_size_1735:
+    .long 0
+
+_scope_2506:
+    .long 0
+    .long 0
+    .long 0
+    .long 0
+
+_next_scope_2508:
+    .long 0
+
+    .text
+
+_L_str_1213:
+    .asciz "mov"
+
+_L_str_1214:
+    .asciz "movsb"
+
+_L_str_1215:
+    .asciz "movsw"
+
+_L_str_1216:
+    .asciz "movsl"
+
+_L_str_1217:
+    .asciz "movzb"
+
+_L_str_1218:
+    .asciz "movzw"
+
+_L_str_1219:
+    .asciz "add"
+
+_L_str_1220:
+    .asciz "sub"
+
+_L_str_1221:
+    .asciz "imul"
+
+_L_str_1222:
+    .asciz "div"
+
+_L_str_1223:
+    .asciz "idiv"
+
+_L_str_1224:
+    .asciz "shl"
+
+_L_str_1225:
+    .asciz "shr"
+
+_L_str_1226:
+    .asciz "sar"
+
+_L_str_1227:
+    .asciz "or"
+
+_L_str_1228:
+    .asciz "xor"
+
+_L_str_1229:
+    .asciz "and"
+
+_L_str_1230:
+    .asciz "not"
+
+_L_str_1231:
+    .asciz "cmp"
+
+_L_str_1232:
+    .asciz "movs"
+
+_L_str_1233:
+    .asciz "adds"
+
+_L_str_1234:
+    .asciz "subs"
+
+_L_str_1235:
+    .asciz "muls"
+
+_L_str_1236:
+    .asciz "divs"
+
+_L_str_1237:
+    .asciz "ucomis"
+
+_L_str_1238:
+    .asciz "lea"
+
+_L_str_1239:
+    .asciz "push"
+
+_L_str_1240:
+    .asciz "pop"
+
+_L_str_1241:
+    .asciz "call"
+
+_L_str_1242:
+    .asciz "ret"
+
+_L_str_1243:
+    .asciz "je"
+
+_L_str_1244:
+    .asciz "jne"
+
+_L_str_1245:
+    .asciz "jmp"
+
+_L_str_1246:
+    .asciz "sete"
+
+_L_str_1247:
+    .asciz "setne"
+
+_L_str_1248:
+    .asciz "setl"
+
+_L_str_1249:
+    .asciz "setg"
+
+_L_str_1250:
+    .asciz "setle"
+
+_L_str_1251:
+    .asciz "setge"
+
+_L_str_1252:
+    .asciz "seta"
+
+_L_str_1253:
+    .asciz "setb"
+
+_L_str_1254:
+    .asciz "setae"
+
+_L_str_1255:
+    .asciz "setbe"
+
+_L_str_1256:
+    .asciz "cltd"
+
+_L_str_1257:
+    .asciz "cqto"
+
+_L_str_1258:
+    .asciz "cvtsi2ssl"
+
+_L_str_1259:
+    .asciz "cvtss2sd"
+
+_L_str_1260:
+    .asciz "cvtsd2ss"
+
+_L_str_1261:
+    .asciz "cvttss2si"
+
+_L_str_1262:
+    .asciz "cvttsd2si"
+
+_L_str_1292:
+    .asciz "    "
+
+_L_str_1300:
+    .asciz "%*s"
+
+_L_str_1301:
+    .asciz " "
+
+_L_str_1313:
+    .asciz "%s%c"
+
+_L_str_1318:
+    .asciz "%s"
+
+_L_str_1331:
+    .asciz "%%"
+
+_L_str_1336:
+    .asciz "$"
+
+_L_str_1337:
+    .asciz "%ld"
+
+_L_str_1340:
+    .asciz "*"
+
+_L_str_1341:
+    .asciz "(%%%s)"
+
+_L_str_1342:
+    .asciz "%ld(%%%s)"
+
+_L_str_1346:
+    .asciz "%s ptr [%s]"
+
+_L_str_1347:
+    .asciz "%s ptr [%s%+ld]"
+
+_L_str_1351:
+    .asciz "_%s(%%rip)"
+
+_L_str_1352:
+    .asciz "_%s_%d(%%rip)"
+
+_L_str_1356:
+    .asciz "%s ptr [_%s_%d]"
+
+_L_str_1357:
+    .asciz "%s ptr [_%s]"
+
+_L_str_1360:
+    .asciz "_%s"
+
+_L_str_1361:
+    .asciz "_%s_%d"
+
+_L_str_1417:
+    .asciz "\012"
+
+_L_str_1440:
+    .asciz ", "
+
+_L_str_1444:
+    .asciz "LBB"
+
+_L_str_1446:
+    .asciz "L_str"
+
+_L_str_1448:
+    .asciz "L_fp"
+
+_L_str_1455:
+    .asciz "%s%d"
+
+_L_str_1473:
+    .asciz "_%s%d_%d"
+
+_L_str_1569:
+    .asciz "## %s\012"
+
+_L_str_1706:
+    .asciz "save address to returning value"
+
+_L_str_1770:
+    .asciz "    .global _%s\012"
+
+_L_str_1771:
+    .asciz "_%s:\012"
+
+_L_str_1817:
+    .asciz "---------------------------------------------------------------\012"
+
+_L_str_1818:
+    .asciz "* %2d | size: %d, offset: %d, pass_by_stack: %d, reg: %d, is_fp: %d\012"
+
+_L_str_1895:
+    .asciz "## __builtin_va_start\012"
+
+_L_str_1896:
+    .asciz "    pop    %%rax ## &va_list\012"
+
+_L_str_1897:
+    .asciz "    pop    %%rdx ## &last\012"
+
+_L_str_1898:
+    .asciz "    leaq   -48(%%rbp), %%rdi ## gp_offset\012"
+
+_L_str_1899:
+    .asciz "    subq   %%rdi, %%rdx      ## gp_offset\012"
+
+_L_str_1900:
+    .asciz "    addq   $8, %%rdx         ## gp_offset\012"
+
+_L_str_1901:
+    .asciz "    movq   %%rdx, (%%rax)    ## gp_offset\012"
+
+_L_str_1902:
+    .asciz "    movl   $48, 4(%%rax)     ## fp_offset\012"
+
+_L_str_1903:
+    .asciz "    leaq   16(%%rbp), %%rdi  ## overflow_arg_area\012"
+
+_L_str_1904:
+    .asciz "    movq   %%rdi, 8(%%rax)   ## overflow_arg_area\012"
+
+_L_str_1905:
+    .asciz "    leaq   -48(%%rbp), %%rdi ## reg_save_area\012"
+
+_L_str_1906:
+    .asciz "    movq   %%rdi, 16(%%rax)  ## reg_save_area\012"
+
+_L_str_1907:
+    .asciz "## end of __builtin_va_start\012"
+
+_L_str_1920:
+    .asciz "__builtin_va_start"
+
+_L_str_1934:
+    .asciz ":\012"
+
+_L_str_1946:
+    .asciz "__stdinp"
+
+_L_str_1947:
+    .asciz "__stdoutp"
+
+_L_str_1948:
+    .asciz "__stderrp"
+
+_L_str_1951:
+    .asciz "%s@GOTPCREL"
+
+_L_str_1986:
+    .asciz "not an object\012"
+
+_L_str_2159:
+    .asciz "begin jump table"
+
+_L_str_2160:
+    .asciz "end jump table"
+
+_L_str_2213:
+    .asciz "local scalar init"
+
+_L_str_2273:
+    .asciz "local bit init"
+
+_L_str_2278:
+    .asciz "assign bit field"
+
+_L_str_2288:
+    .asciz "%s %s:\012"
+
+_L_str_2291:
+    .asciz "    [%04d] is_written: %d written_size: %d init: %p\012"
+
+_L_str_2295:
+    .asciz "           "
+
+_L_str_2296:
+    .asciz "[%02d] bit_width: %d ---------- init: %p\012"
+
+_L_str_2418:
+    .asciz "    .%s 0\012"
+
+_L_str_2423:
+    .asciz "    .%s %ld\012"
+
+_L_str_2425:
+    .asciz "    .%s %d\012"
+
+_L_str_2428:
+    .asciz "    .%s "
+
+_L_str_2458:
+    .asciz "    .global "
+
+_L_str_2464:
+    .asciz "    .zero 1\012"
+
+_L_str_2523:
+    .asciz "for-pre"
+
+_L_str_2524:
+    .asciz "for-cond"
+
+_L_str_2526:
+    .asciz "for-body"
+
+_L_str_2527:
+    .asciz "for-post"
+
+_L_str_2529:
+    .asciz "while-cond"
+
+_L_str_2530:
+    .asciz "while-body"
+
+_L_str_2532:
+    .asciz "do-while-body"
+
+_L_str_2533:
+    .asciz "do-while-cond"
+
+_L_str_2535:
+    .asciz "if-cond"
+
+_L_str_2537:
+    .asciz "if-then"
+
+_L_str_2538:
+    .asciz "if-else"
+
+_L_str_2540:
+    .asciz "switch-value"
+
+_L_str_2565:
+    .asciz "func params"
+
+_L_str_2566:
+    .asciz "func body"
+
+_L_str_2568:
+    .asciz "assign"
+
+_L_str_2572:
+    .asciz "bit field"
+
+_L_str_2575:
+    .asciz "add-assign"
+
+_L_str_2577:
+    .asciz "sub-assign"
+
+_L_str_2579:
+    .asciz "mul-assign"
+
+_L_str_2581:
+    .asciz "div-assign"
+
+_L_str_2583:
+    .asciz "mod-assign"
+
+_L_str_2585:
+    .asciz "shl-assign"
+
+_L_str_2587:
+    .asciz "shr-assign"
+
+_L_str_2589:
+    .asciz "or-assign"
+
+_L_str_2591:
+    .asciz "xor-assign"
+
+_L_str_2593:
+    .asciz "and-assign"
+
+_L_str_2629:
+    .asciz "cond-?"
+
+_L_str_2631:
+    .asciz "cond-then"
+
+_L_str_2632:
+    .asciz "cond-else"
+
+_L_str_2703:
+    .asciz "    .asciz \""
+
+_L_str_2704:
+    .asciz "\"\012\012"
+
+_L_str_2719:
+    .asciz "    .quad %ld\012"
+
+_L_str_2730:
+    .asciz ".intel_syntax noprefix\012"
+
+_L_str_2731:
+    .asciz "    .data\012\012"
+
+_L_str_2732:
+    .asciz "    .text\012\012"
+
+_is_register:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movl  %edi, -4(%rbp)
+## func body
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setge %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB1_2
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  $119, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setle %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB1_2
+    movl  $1, %eax
+_LBB1_2:
+    jmp   _LBB0_0
+_LBB0_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_inc_stack_pointer:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movl  %edi, -4(%rbp)
+## func body
+## add-assign
+    leaq  _stack_offset_1014(%rip), %rax
+    pushq %rax
+    movl  -4(%rbp), %eax
+    popq  %rdx
+    addl  %eax, (%rdx)
+    movl  (%rdx), %eax
+_LBB2_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_dec_stack_pointer:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movl  %edi, -4(%rbp)
+## func body
+## sub-assign
+    leaq  _stack_offset_1014(%rip), %rax
+    pushq %rax
+    movl  -4(%rbp), %eax
+    popq  %rdx
+    subl  %eax, (%rdx)
+    movl  (%rdx), %eax
+_LBB3_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_is_stack_aligned:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $0, %rsp
+## func params
+## func body
+    movl  _stack_offset_1014(%rip), %eax
+    pushq %rax
+    movl  $16, %eax
+    movl  %eax, %edi
+    popq  %rax
+    cltd
+    idivl %edi
+    movl  %edx, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    jmp   _LBB4_0
+_LBB4_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_get_operand_size:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movl  %edi, -4(%rbp)
+## func body
+## if-cond
+    subq  $16, %rsp
+    movl  -4(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _is_register
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB6_3
+## if-then
+## if-cond
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  $80, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setge %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB7_3
+## if-then
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  $5, %eax
+    movl  %eax, %edi
+    popq  %rax
+    cltd
+    idivl %edi
+    movl  %edx, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    jmp   _LBB5_0
+    jmp   _LBB7_2
+## if-else
+_LBB7_3:
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  $5, %eax
+    movl  %eax, %edi
+    popq  %rax
+    cltd
+    idivl %edi
+    movl  %edx, %eax
+    jmp   _LBB5_0
+_LBB7_2:
+    jmp   _LBB6_2
+## if-else
+_LBB6_3:
+_LBB6_2:
+    movl  $0, %eax
+    jmp   _LBB5_0
+_LBB5_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_print_indent:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1292(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+_LBB8_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_print_separator:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    movl  $6, %eax
+    pushq %rax
+    movl  _opecode_len_1013(%rip), %eax
+    movl  %eax, %edx
+    popq  %rax
+    subl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -12(%rbp), %rax
+    pushq %rax
+## cond-?
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $1, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB10_3
+## cond-then
+    movl  -12(%rbp), %eax
+    jmp   _LBB10_2
+## cond-else
+_LBB10_3:
+    movl  $1, %eax
+_LBB10_2:
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_1300(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movl  -12(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    leaq  _L_str_1301(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    movq  (%rsp), %rcx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+_LBB9_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_print_opecode:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+    movl  %edx, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    leaq  _instruction_name_1212(%rip), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _strlen
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $25, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB12_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_1313(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _suffix_letter_1153(%rip), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  -16(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movl  (%rsp), %ecx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+    leaq  -28(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB12_2
+## if-else
+_LBB12_3:
+## if-cond
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $30, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB13_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_1313(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _suffix_letter_1153(%rip), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $4, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movl  (%rsp), %ecx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+    leaq  -28(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB13_2
+## if-else
+_LBB13_3:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_1318(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+_LBB13_2:
+_LBB12_2:
+## if-cond
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $26, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB14_3
+## if-then
+    subq  $16, %rsp
+    movl  $8, %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _inc_stack_pointer
+    addq  $16, %rsp
+    jmp   _LBB14_2
+## if-else
+_LBB14_3:
+_LBB14_2:
+## if-cond
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $27, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB15_3
+## if-then
+    subq  $16, %rsp
+    movl  $8, %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _dec_stack_pointer
+    addq  $16, %rsp
+    jmp   _LBB15_2
+## if-else
+_LBB15_3:
+_LBB15_2:
+## if-cond
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $28, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB16_3
+## if-then
+## assign
+    leaq  _opecode_mnem_1012(%rip), %rax
+    pushq %rax
+    movl  $28, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB16_2
+## if-else
+_LBB16_3:
+## assign
+    leaq  _opecode_mnem_1012(%rip), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+_LBB16_2:
+## assign
+    leaq  _opecode_len_1013(%rip), %rax
+    pushq %rax
+    movl  -28(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+_LBB11_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_print_operand:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+    movl  %edx, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movl  -12(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _is_register
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB18_3
+## if-then
+## local scalar init
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $5, %eax
+    movl  %eax, %edi
+    popq  %rax
+    cltd
+    idivl %edi
+    movl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB19_3
+## if-then
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    leaq  _register_name_1148(%rip), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    pushq %rax
+    leaq  _size_to_offset_1154(%rip), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  -16(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB19_2
+## if-else
+_LBB19_3:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    leaq  _register_name_1148(%rip), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+_LBB19_2:
+## if-cond
+    movl  _att_syntax_1004(%rip), %eax
+    cmpl  $0, %eax
+    je    _LBB20_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1331(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    jmp   _LBB20_2
+## if-else
+_LBB20_3:
+_LBB20_2:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_1318(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+    jmp   _LBB17_0
+    jmp   _LBB18_2
+## if-else
+_LBB18_3:
+_LBB18_2:
+## switch-value
+    movl  -12(%rbp), %eax
+## begin jump table
+    cmpl  $120, %eax
+    je    _LBB21_1435
+    cmpl  $121, %eax
+    je    _LBB21_1438
+    cmpl  $123, %eax
+    je    _LBB21_1449
+    cmpl  $122, %eax
+    je    _LBB21_1459
+    jmp   _LBB21_1462
+    jmp   _LBB21_2
+## end jump table
+_LBB21_1435:
+## if-cond
+    movl  _att_syntax_1004(%rip), %eax
+    cmpl  $0, %eax
+    je    _LBB22_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1336(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    jmp   _LBB22_2
+## if-else
+_LBB22_3:
+_LBB22_2:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_1337(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  _operand_immediate_1010(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+    jmp   _LBB21_2
+_LBB21_1438:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    leaq  _register_name_1148(%rip), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  _operand_register_1009(%rip), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movl  _att_syntax_1004(%rip), %eax
+    cmpl  $0, %eax
+    je    _LBB23_3
+## if-then
+## if-cond
+    movl  _opecode_mnem_1012(%rip), %eax
+    pushq %rax
+    movl  $28, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB24_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1340(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    jmp   _LBB24_2
+## if-else
+_LBB24_3:
+_LBB24_2:
+## if-cond
+    movq  _operand_offset_1011(%rip), %rax
+    pushq %rax
+    movl  $0, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB25_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_1341(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+    jmp   _LBB25_2
+## if-else
+_LBB25_3:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_1342(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  _operand_offset_1011(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movq  (%rsp), %rcx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+_LBB25_2:
+    jmp   _LBB23_2
+## if-else
+_LBB23_3:
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    leaq  _directive_1151(%rip), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -16(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  _operand_offset_1011(%rip), %rax
+    pushq %rax
+    movl  $0, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB26_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_1346(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  -40(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movq  (%rsp), %rcx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+    jmp   _LBB26_2
+## if-else
+_LBB26_3:
+    subq  $48, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 40(%rsp)
+    leaq  _L_str_1347(%rip), %rax
+    movq  %rax, 32(%rsp)
+    movq  -40(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  _operand_offset_1011(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  40(%rsp), %rdi
+    movq  32(%rsp), %rsi
+    movq  24(%rsp), %rdx
+    movq  16(%rsp), %rcx
+    movq  8(%rsp), %r8
+    movb  $0, %al
+    callq _fprintf
+    addq  $48, %rsp
+_LBB26_2:
+_LBB23_2:
+    jmp   _LBB21_2
+_LBB21_1449:
+## if-cond
+    movl  _att_syntax_1004(%rip), %eax
+    cmpl  $0, %eax
+    je    _LBB27_3
+## if-then
+## if-cond
+    movl  _opecode_mnem_1012(%rip), %eax
+    pushq %rax
+    movl  $28, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB28_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1340(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    jmp   _LBB28_2
+## if-else
+_LBB28_3:
+_LBB28_2:
+## if-cond
+    movl  _operand_symbol_id_1008(%rip), %eax
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB29_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_1351(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  _operand_symbol_1006(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+    jmp   _LBB29_2
+## if-else
+_LBB29_3:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_1352(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  _operand_symbol_1006(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movl  _operand_symbol_id_1008(%rip), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movl  (%rsp), %ecx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+_LBB29_2:
+    jmp   _LBB27_2
+## if-else
+_LBB27_3:
+## local scalar init
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    leaq  _directive_1151(%rip), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -16(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movl  _operand_symbol_id_1008(%rip), %eax
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB30_3
+## if-then
+    subq  $48, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 40(%rsp)
+    leaq  _L_str_1356(%rip), %rax
+    movq  %rax, 32(%rsp)
+    movq  -48(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  _operand_symbol_1006(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movl  _operand_symbol_id_1008(%rip), %eax
+    movl  %eax, 8(%rsp)
+    movq  40(%rsp), %rdi
+    movq  32(%rsp), %rsi
+    movq  24(%rsp), %rdx
+    movq  16(%rsp), %rcx
+    movl  8(%rsp), %r8d
+    movb  $0, %al
+    callq _fprintf
+    addq  $48, %rsp
+    jmp   _LBB30_2
+## if-else
+_LBB30_3:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_1357(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  -48(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  _operand_symbol_1006(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movq  (%rsp), %rcx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+_LBB30_2:
+_LBB27_2:
+    jmp   _LBB21_2
+_LBB21_1459:
+## if-cond
+    movl  _operand_label_id_1007(%rip), %eax
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB31_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_1360(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  _operand_label_1005(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+    jmp   _LBB31_2
+## if-else
+_LBB31_3:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_1361(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  _operand_label_1005(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movl  _operand_label_id_1007(%rip), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movl  (%rsp), %ecx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+_LBB31_2:
+    jmp   _LBB21_2
+_LBB21_1462:
+    jmp   _LBB21_2
+_LBB21_2:
+_LBB17_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _regi
+_regi:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movl  %edi, -4(%rbp)
+    movl  %esi, -8(%rbp)
+## func body
+## if-cond
+    subq  $16, %rsp
+    movl  -4(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _is_register
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB34_2
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  $5, %eax
+    movl  %eax, %edi
+    popq  %rax
+    cltd
+    idivl %edi
+    movl  %edx, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB34_2
+    movl  $1, %eax
+_LBB34_2:
+    cmpl  $0, %eax
+    je    _LBB33_3
+## if-then
+    movl  -4(%rbp), %eax
+    pushq %rax
+    leaq  _size_to_offset_1154(%rip), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  -8(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    jmp   _LBB32_0
+    jmp   _LBB33_2
+## if-else
+_LBB33_3:
+    movl  $0, %eax
+    jmp   _LBB32_0
+_LBB33_2:
+_LBB32_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _arg_reg
+_arg_reg:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movl  %edi, -4(%rbp)
+    movl  %esi, -8(%rbp)
+## func body
+## if-cond
+    movl  -8(%rbp), %eax
+    pushq %rax
+    movl  $5, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB37_2
+    movl  -8(%rbp), %eax
+    pushq %rax
+    movl  $6, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB37_2
+    movl  $0, %eax
+_LBB37_2:
+    cmpl  $0, %eax
+    je    _LBB36_3
+## if-then
+## if-cond
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB39_2
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  $7, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB39_2
+    movl  $0, %eax
+_LBB39_2:
+    cmpl  $0, %eax
+    je    _LBB38_3
+## if-then
+    movl  $80, %eax
+    jmp   _LBB35_0
+    jmp   _LBB38_2
+## if-else
+_LBB38_3:
+    subq  $16, %rsp
+    leaq  _arg_fp_list_1150(%rip), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  -4(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, 8(%rsp)
+    movl  -8(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _regi
+    addq  $16, %rsp
+    jmp   _LBB35_0
+_LBB38_2:
+    jmp   _LBB36_2
+## if-else
+_LBB36_3:
+## if-cond
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB41_2
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  $5, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB41_2
+    movl  $0, %eax
+_LBB41_2:
+    cmpl  $0, %eax
+    je    _LBB40_3
+## if-then
+    movl  $0, %eax
+    jmp   _LBB35_0
+    jmp   _LBB40_2
+## if-else
+_LBB40_3:
+    subq  $16, %rsp
+    leaq  _arg_reg_list_1149(%rip), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  -4(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, 8(%rsp)
+    movl  -8(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _regi
+    addq  $16, %rsp
+    jmp   _LBB35_0
+_LBB40_2:
+_LBB36_2:
+_LBB35_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _imm
+_imm:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## assign
+    leaq  _operand_immediate_1010(%rip), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movl  $120, %eax
+    jmp   _LBB42_0
+_LBB42_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _mem
+_mem:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movl  %edi, -4(%rbp)
+    movl  %esi, -8(%rbp)
+## func body
+## assign
+    leaq  _operand_register_1009(%rip), %rax
+    pushq %rax
+    movl  -4(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  _operand_offset_1011(%rip), %rax
+    pushq %rax
+    movl  -8(%rbp), %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movl  $121, %eax
+    jmp   _LBB43_0
+_LBB43_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _symb
+_symb:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+## func body
+## assign
+    leaq  _operand_symbol_1006(%rip), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  _operand_symbol_id_1008(%rip), %rax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    movl  $123, %eax
+    jmp   _LBB44_0
+_LBB44_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _label
+_label:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+## func body
+## assign
+    leaq  _operand_label_1005(%rip), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  _operand_label_id_1007(%rip), %rax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    movl  $122, %eax
+    jmp   _LBB45_0
+_LBB45_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _code1
+_code1:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _print_indent
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  -12(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _print_opecode
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1417(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+_LBB46_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _code2
+_code2:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+    movl  %edx, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movl  -16(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  (%rsp), %edi
+    callq _get_operand_size
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  -20(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _print_indent
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  -12(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    movl  -24(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _print_opecode
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _print_separator
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  -16(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    movl  -24(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _print_operand
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1417(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+_LBB47_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _code3
+_code3:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+    movl  %edx, -16(%rbp)
+    movl  %ecx, -20(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movl  -16(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  (%rsp), %edi
+    callq _get_operand_size
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movl  -20(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  (%rsp), %edi
+    callq _get_operand_size
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+## cond-?
+    movl  -24(%rbp), %eax
+    pushq %rax
+    movl  -28(%rbp), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB49_3
+## cond-then
+    movl  -24(%rbp), %eax
+    jmp   _LBB49_2
+## cond-else
+_LBB49_3:
+    movl  -28(%rbp), %eax
+_LBB49_2:
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _print_indent
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  -12(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    movl  -32(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _print_opecode
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _print_separator
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  -16(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    movl  -32(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _print_operand
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1440(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    movl  -32(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _print_operand
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1417(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+_LBB48_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_make_label:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movl  %edi, -4(%rbp)
+    movl  %esi, -8(%rbp)
+## func body
+    subq  $32, %rsp
+    leaq  _buf_1454(%rip), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_1455(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  _LABEL_NAME_PREFIX_1443(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movl  -4(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movl  (%rsp), %ecx
+    movb  $0, %al
+    callq _sprintf
+    addq  $32, %rsp
+    subq  $16, %rsp
+    leaq  _buf_1454(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movl  -8(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _label
+    addq  $16, %rsp
+    jmp   _LBB50_0
+_LBB50_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_gen_symbol_name:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movl  %edx, -20(%rbp)
+## func body
+## if-cond
+    movl  -20(%rbp), %eax
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB52_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_1360(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+    jmp   _LBB52_2
+## if-else
+_LBB52_3:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_1361(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movl  (%rsp), %ecx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+_LBB52_2:
+_LBB51_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_gen_label_name:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movl  %edx, -20(%rbp)
+    movl  %ecx, -24(%rbp)
+## func body
+## if-cond
+    movl  -20(%rbp), %eax
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB55_2
+    movl  -24(%rbp), %eax
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB55_2
+    movl  $1, %eax
+_LBB55_2:
+    cmpl  $0, %eax
+    je    _LBB54_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_1360(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+    jmp   _LBB54_2
+## if-else
+_LBB54_3:
+    subq  $48, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 40(%rsp)
+    leaq  _L_str_1473(%rip), %rax
+    movq  %rax, 32(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    movl  -24(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  40(%rsp), %rdi
+    movq  32(%rsp), %rsi
+    movq  24(%rsp), %rdx
+    movl  16(%rsp), %ecx
+    movl  8(%rsp), %r8d
+    movb  $0, %al
+    callq _fprintf
+    addq  $48, %rsp
+_LBB54_2:
+_LBB53_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_gen_string_literal_name:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+## func body
+## if-cond
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB57_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_1360(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  _STR_LIT_NAME_PREFIX_1445(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+    jmp   _LBB57_2
+## if-else
+_LBB57_3:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_1361(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  _STR_LIT_NAME_PREFIX_1445(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movl  -12(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movl  (%rsp), %ecx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+_LBB57_2:
+_LBB56_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_gen_fpnum_literal_name:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+## func body
+## if-cond
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB59_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_1360(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  _FP_LIT_NAME_PREFIX_1447(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+    jmp   _LBB59_2
+## if-else
+_LBB59_3:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_1361(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  _FP_LIT_NAME_PREFIX_1447(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movl  -12(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movl  (%rsp), %ecx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+_LBB59_2:
+_LBB58_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_opsize:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_char
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB61_3
+## if-then
+    movl  $1, %eax
+    jmp   _LBB60_0
+    jmp   _LBB61_2
+## if-else
+_LBB61_3:
+_LBB61_2:
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_short
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB62_3
+## if-then
+    movl  $2, %eax
+    jmp   _LBB60_0
+    jmp   _LBB62_2
+## if-else
+_LBB62_3:
+_LBB62_2:
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_int
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB63_3
+## if-then
+    movl  $3, %eax
+    jmp   _LBB60_0
+    jmp   _LBB63_2
+## if-else
+_LBB63_3:
+_LBB63_2:
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_long
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB64_3
+## if-then
+    movl  $4, %eax
+    jmp   _LBB60_0
+    jmp   _LBB64_2
+## if-else
+_LBB64_3:
+_LBB64_2:
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_float
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB65_3
+## if-then
+    movl  $5, %eax
+    jmp   _LBB60_0
+    jmp   _LBB65_2
+## if-else
+_LBB65_3:
+_LBB65_2:
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_double
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB66_3
+## if-then
+    movl  $6, %eax
+    jmp   _LBB60_0
+    jmp   _LBB66_2
+## if-else
+_LBB66_3:
+_LBB66_2:
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_pointer
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB67_3
+## if-then
+    movl  $4, %eax
+    jmp   _LBB60_0
+    jmp   _LBB67_2
+## if-else
+_LBB67_3:
+_LBB67_2:
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_enum
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB68_3
+## if-then
+    movl  $3, %eax
+    jmp   _LBB60_0
+    jmp   _LBB68_2
+## if-else
+_LBB68_3:
+_LBB68_2:
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_struct_or_union
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB69_3
+## if-then
+## switch-value
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _get_size
+    addq  $16, %rsp
+## begin jump table
+    cmpl  $1, %eax
+    je    _LBB70_1597
+    cmpl  $2, %eax
+    je    _LBB70_1598
+    cmpl  $4, %eax
+    je    _LBB70_1599
+    jmp   _LBB70_1600
+    jmp   _LBB70_2
+## end jump table
+_LBB70_1597:
+    movl  $1, %eax
+    jmp   _LBB60_0
+_LBB70_1598:
+    movl  $2, %eax
+    jmp   _LBB60_0
+_LBB70_1599:
+    movl  $3, %eax
+    jmp   _LBB60_0
+_LBB70_1600:
+    jmp   _LBB70_2
+_LBB70_2:
+    jmp   _LBB69_2
+## if-else
+_LBB69_3:
+_LBB69_2:
+    movl  $4, %eax
+    jmp   _LBB60_0
+_LBB60_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_data_name_from_type:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _opsize
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    leaq  _data_name_1152(%rip), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    jmp   _LBB71_0
+_LBB71_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_register_from_type:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movl  %edi, -4(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _opsize
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  -4(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _regi
+    addq  $16, %rsp
+    jmp   _LBB72_0
+_LBB72_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_get_mem_offset:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $28, %rax
+    movl  (%rax), %eax
+    jmp   _LBB73_0
+_LBB73_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_gen_comment:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_1569(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+_LBB74_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_align_to:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movl  %edi, -4(%rbp)
+    movl  %esi, -8(%rbp)
+## func body
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  -8(%rbp), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    pushq %rax
+    movl  $1, %eax
+    movl  %eax, %edx
+    popq  %rax
+    subl  %edx, %eax
+    pushq %rax
+    movl  -8(%rbp), %eax
+    movl  %eax, %edi
+    popq  %rax
+    cltd
+    idivl %edi
+    pushq %rax
+    movl  -8(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    jmp   _LBB75_0
+_LBB75_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_is_small_object:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _get_size
+    addq  $16, %rsp
+    pushq %rax
+    movl  $8, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setle %al
+    movzbl %al, %eax
+    jmp   _LBB76_0
+_LBB76_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_is_medium_object:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _get_size
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $8, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB78_2
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $16, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setle %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB78_2
+    movl  $1, %eax
+_LBB78_2:
+    jmp   _LBB77_0
+_LBB77_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_is_large_object:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _get_size
+    addq  $16, %rsp
+    pushq %rax
+    movl  $16, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setg  %al
+    movzbl %al, %eax
+    jmp   _LBB79_0
+_LBB79_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_is_odd_size_object:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _get_size
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_struct_or_union
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB81_3
+## if-then
+    movl  $0, %eax
+    jmp   _LBB80_0
+    jmp   _LBB81_2
+## if-else
+_LBB81_3:
+_LBB81_2:
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB84_2
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $5, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB84_2
+    movl  $0, %eax
+_LBB84_2:
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB83_2
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $6, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB83_2
+    movl  $0, %eax
+_LBB83_2:
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB82_2
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $7, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB82_2
+    movl  $0, %eax
+_LBB82_2:
+    jmp   _LBB80_0
+_LBB80_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_piece_size:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movl  %edi, -4(%rbp)
+## func body
+## if-cond
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  $8, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setge %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB86_3
+## if-then
+    movl  $8, %eax
+    jmp   _LBB85_0
+    jmp   _LBB86_2
+## if-else
+_LBB86_3:
+_LBB86_2:
+## if-cond
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  $4, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setge %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB87_3
+## if-then
+    movl  $4, %eax
+    jmp   _LBB85_0
+    jmp   _LBB87_2
+## if-else
+_LBB87_3:
+_LBB87_2:
+## if-cond
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  $2, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setge %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB88_3
+## if-then
+    movl  $2, %eax
+    jmp   _LBB85_0
+    jmp   _LBB88_2
+## if-else
+_LBB88_3:
+_LBB88_2:
+    movl  $1, %eax
+    jmp   _LBB85_0
+_LBB85_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_piece_opsize:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movl  %edi, -4(%rbp)
+## func body
+## switch-value
+    movl  -4(%rbp), %eax
+## begin jump table
+    cmpl  $1, %eax
+    je    _LBB90_1717
+    cmpl  $2, %eax
+    je    _LBB90_1718
+    cmpl  $4, %eax
+    je    _LBB90_1719
+    jmp   _LBB90_1720
+    jmp   _LBB90_2
+## end jump table
+_LBB90_1717:
+    movl  $1, %eax
+    jmp   _LBB89_0
+_LBB90_1718:
+    movl  $2, %eax
+    jmp   _LBB89_0
+_LBB90_1719:
+    movl  $3, %eax
+    jmp   _LBB89_0
+_LBB90_1720:
+    movl  $4, %eax
+    jmp   _LBB89_0
+_LBB90_2:
+_LBB89_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_gen_store_pieces:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+    movl  %edx, -16(%rbp)
+    movl  %ecx, -20(%rbp)
+    movl  %r8d, -24(%rbp)
+## func body
+## local scalar init
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movl  -12(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _piece_size
+    addq  $16, %rsp
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB92_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  -16(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movl  -12(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _piece_opsize
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _regi
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movl  -20(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -24(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB91_0
+    jmp   _LBB92_2
+## if-else
+_LBB92_3:
+_LBB92_2:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  -16(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  $4, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _regi
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  $59, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+## for-pre
+## for-cond
+_LBB93_1:
+    movl  $1, %eax
+    cmpl  $0, %eax
+    je    _LBB93_2
+## for-body
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  -28(%rbp), %eax
+    movl  %eax, %edx
+    popq  %rax
+    subl  %edx, %eax
+    movl  %eax, (%rsp)
+    movl  (%rsp), %edi
+    callq _piece_size
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  $55, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movl  -32(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _piece_opsize
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _regi
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movl  -20(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -24(%rbp), %eax
+    pushq %rax
+    movl  -28(%rbp), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+## add-assign
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    movl  -32(%rbp), %eax
+    popq  %rdx
+    addl  %eax, (%rdx)
+    movl  (%rdx), %eax
+## if-cond
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB94_3
+## if-then
+    jmp   _LBB93_2
+    jmp   _LBB94_2
+## if-else
+_LBB94_3:
+_LBB94_2:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $12, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  $8, %eax
+    pushq %rax
+    movl  -32(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _imm
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  $59, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+## for-post
+_LBB93_4:
+    jmp   _LBB93_1
+_LBB93_2:
+_LBB91_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_gen_load_pieces:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+    movl  %edx, -16(%rbp)
+    movl  %ecx, -20(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## while-cond
+_LBB96_4:
+    movl  -24(%rbp), %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB96_2
+## while-body
+## local scalar init
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  -24(%rbp), %eax
+    movl  %eax, %edx
+    popq  %rax
+    subl  %edx, %eax
+    movl  %eax, (%rsp)
+    movl  (%rsp), %edi
+    callq _piece_size
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+## cond-?
+    movl  -24(%rbp), %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB97_3
+## cond-then
+    movl  $58, %eax
+    jmp   _LBB97_2
+## cond-else
+_LBB97_3:
+    movl  $53, %eax
+_LBB97_2:
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movl  $4, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB98_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  -16(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    pushq %rax
+    movl  -24(%rbp), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  -32(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB98_2
+## if-else
+_LBB98_3:
+## if-cond
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB99_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $5, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  -16(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    pushq %rax
+    movl  -24(%rbp), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  -32(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB99_2
+## if-else
+_LBB99_3:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $4, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  -16(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    pushq %rax
+    movl  -24(%rbp), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  -32(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+_LBB99_2:
+_LBB98_2:
+## if-cond
+    movl  -24(%rbp), %eax
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB100_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $11, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  $8, %eax
+    pushq %rax
+    movl  -24(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _imm
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  $54, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $14, %eax
+    movl  %eax, 16(%rsp)
+    movl  $54, %eax
+    movl  %eax, 8(%rsp)
+    movl  $59, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB100_2
+## if-else
+_LBB100_3:
+_LBB100_2:
+## add-assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  -28(%rbp), %eax
+    popq  %rdx
+    addl  %eax, (%rdx)
+    movl  (%rdx), %eax
+    jmp   _LBB96_4
+_LBB96_2:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movl  $59, %eax
+    movl  %eax, 8(%rsp)
+    movl  $4, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+_LBB95_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_gen_add_stack_pointer:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+## func body
+## if-cond
+    movl  -12(%rbp), %eax
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB102_3
+## if-then
+    jmp   _LBB101_0
+    jmp   _LBB102_2
+## if-else
+_LBB102_3:
+_LBB102_2:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $6, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  -12(%rbp), %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _imm
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  $39, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movl  -12(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _inc_stack_pointer
+    addq  $16, %rsp
+_LBB101_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_gen_sub_stack_pointer:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+## func body
+## if-cond
+    movl  -12(%rbp), %eax
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB104_3
+## if-then
+    jmp   _LBB103_0
+    jmp   _LBB104_2
+## if-else
+_LBB104_3:
+_LBB104_2:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $7, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  -12(%rbp), %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _imm
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  $39, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movl  -12(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _dec_stack_pointer
+    addq  $16, %rsp
+_LBB103_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_gen_func_param_list_variadic_:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## for-pre
+## assign
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB106_1:
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $6, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB106_2
+## for-body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $8, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    pushq %rax
+    movl  $6, %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    movl  %eax, %edx
+    popq  %rax
+    subl  %edx, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  -12(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movl  8(%rsp), %esi
+    callq _arg_reg
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movl  $34, %eax
+    movl  %eax, 8(%rsp)
+    movl  -16(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+## for-post
+_LBB106_4:
+    leaq  -12(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB106_1
+_LBB106_2:
+_LBB105_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_gen_store_param:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movl  %edx, -20(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _get_size
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  -20(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movl  $34, %eax
+    movl  %eax, 8(%rsp)
+    movl  $54, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $7, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    addq  $28, %rax
+    movl  (%rax), %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _imm
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  $54, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+## while-cond
+_LBB108_4:
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movl  -24(%rbp), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB108_2
+## while-body
+## local scalar init
+    leaq  -36(%rbp), %rax
+    pushq %rax
+## cond-?
+    movl  -24(%rbp), %eax
+    pushq %rax
+    movl  -28(%rbp), %eax
+    movl  %eax, %edx
+    popq  %rax
+    subl  %edx, %eax
+    pushq %rax
+    movl  $8, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB109_3
+## cond-then
+    movl  -24(%rbp), %eax
+    pushq %rax
+    movl  -28(%rbp), %eax
+    movl  %eax, %edx
+    popq  %rax
+    subl  %edx, %eax
+    jmp   _LBB109_2
+## cond-else
+_LBB109_3:
+    movl  $8, %eax
+_LBB109_2:
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $48, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 40(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, 32(%rsp)
+    subq  $16, %rsp
+    movl  -32(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _arg_reg
+    addq  $16, %rsp
+    movl  %eax, 24(%rsp)
+    movl  $54, %eax
+    movl  %eax, 16(%rsp)
+    movl  -28(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  40(%rsp), %rdi
+    movl  32(%rsp), %esi
+    movl  24(%rsp), %edx
+    movl  16(%rsp), %ecx
+    movl  8(%rsp), %r8d
+    callq _gen_store_pieces
+    addq  $48, %rsp
+    leaq  -32(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+## add-assign
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    movl  $8, %eax
+    popq  %rdx
+    addl  %eax, (%rdx)
+    movl  (%rdx), %eax
+    jmp   _LBB108_4
+_LBB108_2:
+    movl  -32(%rbp), %eax
+    jmp   _LBB107_0
+_LBB107_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_gen_func_param_list_:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $80, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $16, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -36(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _return_type
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_large_object
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB111_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1706(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_comment
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $26, %eax
+    movl  %eax, 16(%rsp)
+    movl  $24, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    leaq  -28(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB111_2
+## if-else
+_LBB111_3:
+_LBB111_2:
+## for-pre
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _first_param
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB112_1:
+    movq  -24(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB112_2
+## for-body
+## local scalar init
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -52(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -48(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _get_size
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -64(%rbp), %rax
+    pushq %rax
+    movq  -48(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -48(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_ellipsis
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB113_3
+## if-then
+    jmp   _LBB112_2
+    jmp   _LBB113_2
+## if-else
+_LBB113_3:
+_LBB113_2:
+## if-cond
+    subq  $16, %rsp
+    movq  -64(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_fpnum
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB114_3
+## if-then
+## local scalar init
+    leaq  -68(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  -36(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -64(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _opsize
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movl  8(%rsp), %esi
+    callq _arg_reg
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -72(%rbp), %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    pushq %rax
+    movq  -48(%rbp), %rax
+    addq  $28, %rax
+    movl  (%rax), %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $19, %eax
+    movl  %eax, 16(%rsp)
+    movl  -68(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movl  $34, %eax
+    movl  %eax, 8(%rsp)
+    movl  -72(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    leaq  -36(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB112_4
+    jmp   _LBB114_2
+## if-else
+_LBB114_3:
+_LBB114_2:
+## if-cond
+    movl  -52(%rbp), %eax
+    pushq %rax
+    movl  $8, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setle %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB116_2
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movl  $6, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB116_2
+    movl  $1, %eax
+_LBB116_2:
+    cmpl  $0, %eax
+    je    _LBB115_3
+## if-then
+## local scalar init
+    leaq  -76(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  -28(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -48(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _opsize
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movl  8(%rsp), %esi
+    callq _arg_reg
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -80(%rbp), %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    pushq %rax
+    movq  -48(%rbp), %rax
+    addq  $28, %rax
+    movl  (%rax), %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -48(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_odd_size_object
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB117_3
+## if-then
+    subq  $48, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 40(%rsp)
+    movl  -52(%rbp), %eax
+    movl  %eax, 32(%rsp)
+    subq  $16, %rsp
+    movl  -28(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _arg_reg
+    addq  $16, %rsp
+    movl  %eax, 24(%rsp)
+    movl  $34, %eax
+    movl  %eax, 16(%rsp)
+    movl  -80(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  40(%rsp), %rdi
+    movl  32(%rsp), %esi
+    movl  24(%rsp), %edx
+    movl  16(%rsp), %ecx
+    movl  8(%rsp), %r8d
+    callq _gen_store_pieces
+    addq  $48, %rsp
+    jmp   _LBB117_2
+## if-else
+_LBB117_3:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movl  -76(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movl  $34, %eax
+    movl  %eax, 8(%rsp)
+    movl  -80(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+_LBB117_2:
+    leaq  -28(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB115_2
+## if-else
+_LBB115_3:
+## if-cond
+    movl  -52(%rbp), %eax
+    pushq %rax
+    movl  $16, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setle %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB119_2
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movl  $5, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB119_2
+    movl  $1, %eax
+_LBB119_2:
+    cmpl  $0, %eax
+    je    _LBB118_3
+## if-then
+## assign
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -48(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -28(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movl  (%rsp), %edx
+    callq _gen_store_param
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB118_2
+## if-else
+_LBB118_3:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movl  $34, %eax
+    movl  %eax, 8(%rsp)
+    movl  $4, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $6, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  -32(%rbp), %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _imm
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  $4, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -48(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movl  $34, %eax
+    movl  %eax, 8(%rsp)
+    movq  $-1, %rax
+    pushq %rax
+    movq  -48(%rbp), %rax
+    addq  $28, %rax
+    movl  (%rax), %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _gen_copy_large_object
+    addq  $32, %rsp
+## add-assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  -52(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    movl  $8, %eax
+    movl  %eax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movl  8(%rsp), %esi
+    callq _align_to
+    addq  $24, %rsp
+    popq  %rdx
+    addl  %eax, (%rdx)
+    movl  (%rdx), %eax
+_LBB118_2:
+_LBB115_2:
+## for-post
+_LBB112_4:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _next_param
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB112_1
+_LBB112_2:
+_LBB110_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_gen_func_param_list:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _node_l
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_variadic
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB121_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _gen_func_param_list_variadic_
+    addq  $16, %rsp
+    jmp   _LBB121_2
+## if-else
+_LBB121_3:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_func_param_list_
+    addq  $16, %rsp
+_LBB121_2:
+_LBB120_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_find_max_return_size:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $576, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -564(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    leaq  -552(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _begin_ast_walk
+    addq  $16, %rsp
+## while-cond
+_LBB123_4:
+## assign
+    leaq  -560(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    leaq  -552(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _next_ast_node
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB123_2
+## while-body
+## if-cond
+    movq  -560(%rbp), %rax
+    addq  $28, %rax
+    movb  (%rax), %al
+    movzbl %al, %eax
+    pushq %rax
+    movl  $34, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB125_2
+    subq  $16, %rsp
+    movq  -560(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_small_object
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB125_2
+    movl  $1, %eax
+_LBB125_2:
+    cmpl  $0, %eax
+    je    _LBB124_3
+## if-then
+## local scalar init
+    leaq  -568(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -560(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _get_size
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -564(%rbp), %rax
+    pushq %rax
+## cond-?
+    movl  -568(%rbp), %eax
+    pushq %rax
+    movl  -564(%rbp), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB126_3
+## cond-then
+    movl  -568(%rbp), %eax
+    jmp   _LBB126_2
+## cond-else
+_LBB126_3:
+    movl  -564(%rbp), %eax
+_LBB126_2:
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB124_2
+## if-else
+_LBB124_3:
+_LBB124_2:
+    jmp   _LBB123_4
+_LBB123_2:
+    subq  $16, %rsp
+    leaq  -552(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _end_ast_walk
+    addq  $16, %rsp
+    movl  -564(%rbp), %eax
+    jmp   _LBB122_0
+_LBB122_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_get_local_area_size:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $0, %rsp
+## func params
+## func body
+    movl  _local_area_size_1735(%rip), %eax
+    jmp   _LBB127_0
+_LBB127_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_set_local_area_offset:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _node_l
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _get_mem_offset
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _find_max_return_size
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  -24(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    movl  $16, %eax
+    movl  %eax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movl  8(%rsp), %esi
+    callq _align_to
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  _local_area_size_1735(%rip), %rax
+    pushq %rax
+    movl  -20(%rbp), %eax
+    pushq %rax
+    movl  -24(%rbp), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+_LBB128_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_gen_func_prologue:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _node_l
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_static
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB130_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_1770(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+    jmp   _LBB130_2
+## if-else
+_LBB130_3:
+_LBB130_2:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_1771(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $26, %eax
+    movl  %eax, 16(%rsp)
+    movl  $34, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movl  $39, %eax
+    movl  %eax, 8(%rsp)
+    movl  $34, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $7, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    callq _get_local_area_size
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _imm
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  $39, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+_LBB129_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_gen_func_body:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+_LBB131_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_gen_func_epilogue:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movl  $34, %eax
+    movl  %eax, 8(%rsp)
+    movl  $39, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $27, %eax
+    movl  %eax, 16(%rsp)
+    movl  $34, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $29, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _code1
+    addq  $16, %rsp
+_LBB132_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_free_argument_list:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## while-cond
+_LBB134_4:
+    movq  -16(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB134_2
+## while-body
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB134_4
+_LBB134_2:
+_LBB133_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_print_argument_list:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    leaq  _L_str_1817(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+## for-pre
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB136_1:
+    movq  -24(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB136_2
+## for-body
+    subq  $64, %rsp
+    leaq  _L_str_1818(%rip), %rax
+    movq  %rax, 56(%rsp)
+    leaq  -12(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    movl  %eax, 48(%rsp)
+    movq  -24(%rbp), %rax
+    addq  $32, %rax
+    movl  (%rax), %eax
+    movl  %eax, 40(%rsp)
+    movq  -24(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    movl  %eax, 32(%rsp)
+    movq  -24(%rbp), %rax
+    addq  $36, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, 24(%rsp)
+    movq  -24(%rbp), %rax
+    addq  $24, %rax
+    movl  (%rax), %eax
+    movl  %eax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    addq  $37, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movq  56(%rsp), %rdi
+    movl  48(%rsp), %esi
+    movl  40(%rsp), %edx
+    movl  32(%rsp), %ecx
+    movl  24(%rsp), %r8d
+    movl  16(%rsp), %r9d
+    movb  $0, %al
+    callq _printf
+    addq  $64, %rsp
+## for-post
+_LBB136_4:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB136_1
+_LBB136_2:
+_LBB135_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_gen_func_call:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $176, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _node_l
+    addq  $8, %rsp
+    addq  $8, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -44(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _node_r
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -96(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -96(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    popq  %rax
+    movq  $0, %rdx
+    movq  %rdx, (%rax)
+## local scalar init
+    leaq  -96(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -96(%rbp), %rax
+    addq  $20, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -96(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -96(%rbp), %rax
+    addq  $28, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -96(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -96(%rbp), %rax
+    addq  $36, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -96(%rbp), %rax
+    addq  $37, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -96(%rbp), %rax
+    addq  $38, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -104(%rbp), %rax
+    pushq %rax
+    leaq  -96(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -32(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_large_object
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB138_3
+## if-then
+## local scalar init
+    leaq  -112(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $1, %eax
+    movslq %eax, %rax
+    movq  %rax, 16(%rsp)
+    movl  $40, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _calloc
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -112(%rbp), %rax
+    addq  $38, %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## assign
+    movq  -104(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -112(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -104(%rbp), %rax
+    pushq %rax
+    movq  -112(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB138_2
+## if-else
+_LBB138_3:
+_LBB138_2:
+## for-pre
+## for-cond
+_LBB139_1:
+    movq  -56(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB139_2
+## for-body
+## local scalar init
+    leaq  -120(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -56(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _node_l
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -128(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $1, %eax
+    movslq %eax, %rax
+    movq  %rax, 16(%rsp)
+    movl  $40, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _calloc
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -128(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -120(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _node_l
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -128(%rbp), %rax
+    addq  $37, %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -128(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _is_fpnum
+    addq  $8, %rsp
+    popq  %rdx
+    movb  %al, (%rdx)
+## assign
+    leaq  -132(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -128(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _get_size
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -128(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  -132(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    movl  $8, %eax
+    movl  %eax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movl  8(%rsp), %esi
+    callq _align_to
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## add-assign
+    leaq  -44(%rbp), %rax
+    pushq %rax
+    movq  -128(%rbp), %rax
+    addq  $32, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    addl  %eax, (%rdx)
+    movl  (%rdx), %eax
+## assign
+    movq  -104(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -128(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -104(%rbp), %rax
+    pushq %rax
+    movq  -128(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-post
+_LBB139_4:
+## assign
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -56(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _node_r
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB139_1
+_LBB139_2:
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    leaq  -96(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    callq _is_stack_aligned
+    addq  $8, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  -44(%rbp), %eax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -136(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    pushq %rax
+    movl  $16, %eax
+    movl  %eax, %edi
+    popq  %rax
+    cltd
+    idivl %edi
+    movl  %edx, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB140_3
+## if-then
+## add-assign
+    leaq  -44(%rbp), %rax
+    pushq %rax
+    movl  $8, %eax
+    popq  %rdx
+    addl  %eax, (%rdx)
+    movl  (%rdx), %eax
+    jmp   _LBB140_2
+## if-else
+_LBB140_3:
+_LBB140_2:
+## local scalar init
+    leaq  -140(%rbp), %rax
+    pushq %rax
+    movl  -44(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -144(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -148(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-pre
+## assign
+    leaq  -160(%rbp), %rax
+    pushq %rax
+    movq  -40(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB141_1:
+    movq  -160(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB141_2
+## for-body
+## if-cond
+    movq  -160(%rbp), %rax
+    addq  $38, %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    je    _LBB142_3
+## if-then
+## assign
+    movq  -160(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    callq _get_local_area_size
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -160(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    movl  $24, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    leaq  -148(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB141_4
+    jmp   _LBB142_2
+## if-else
+_LBB142_3:
+_LBB142_2:
+## if-cond
+    movq  -160(%rbp), %rax
+    addq  $37, %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    je    _LBB143_3
+## if-then
+## if-cond
+    movq  -160(%rbp), %rax
+    addq  $32, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $8, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB145_2
+    movl  -152(%rbp), %eax
+    pushq %rax
+    movl  $6, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB145_2
+    movl  $1, %eax
+_LBB145_2:
+    cmpl  $0, %eax
+    je    _LBB144_3
+## if-then
+## sub-assign
+    leaq  -140(%rbp), %rax
+    pushq %rax
+    movq  -160(%rbp), %rax
+    addq  $32, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    subl  %eax, (%rdx)
+    movl  (%rdx), %eax
+## assign
+    movq  -160(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movl  -140(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -160(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  -152(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -160(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _opsize
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movl  8(%rsp), %esi
+    callq _arg_reg
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    leaq  -152(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB144_2
+## if-else
+_LBB144_3:
+_LBB144_2:
+    jmp   _LBB141_4
+    jmp   _LBB143_2
+## if-else
+_LBB143_3:
+_LBB143_2:
+## if-cond
+    movq  -160(%rbp), %rax
+    addq  $32, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $8, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB147_2
+    movl  -148(%rbp), %eax
+    pushq %rax
+    movl  $6, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB147_2
+    movl  $1, %eax
+_LBB147_2:
+    cmpl  $0, %eax
+    je    _LBB146_3
+## if-then
+## sub-assign
+    leaq  -140(%rbp), %rax
+    pushq %rax
+    movq  -160(%rbp), %rax
+    addq  $32, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    subl  %eax, (%rdx)
+    movl  (%rdx), %eax
+## assign
+    movq  -160(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movl  -140(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -160(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  -148(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -160(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _opsize
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movl  8(%rsp), %esi
+    callq _arg_reg
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    leaq  -148(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB146_2
+## if-else
+_LBB146_3:
+## if-cond
+    movq  -160(%rbp), %rax
+    addq  $32, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $16, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB149_2
+    movl  -148(%rbp), %eax
+    pushq %rax
+    movl  $5, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB149_2
+    movl  $1, %eax
+_LBB149_2:
+    cmpl  $0, %eax
+    je    _LBB148_3
+## if-then
+## sub-assign
+    leaq  -140(%rbp), %rax
+    pushq %rax
+    movq  -160(%rbp), %rax
+    addq  $32, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    subl  %eax, (%rdx)
+    movl  (%rdx), %eax
+## assign
+    movq  -160(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movl  -140(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -160(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  -148(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movl  8(%rsp), %esi
+    callq _arg_reg
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -160(%rbp), %rax
+    addq  $20, %rax
+    pushq %rax
+    movl  -140(%rbp), %eax
+    pushq %rax
+    movl  $8, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -160(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _get_size
+    addq  $16, %rsp
+    pushq %rax
+    movl  $12, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB150_3
+## if-then
+## assign
+    movq  -160(%rbp), %rax
+    addq  $28, %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  -148(%rbp), %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    movl  %eax, 16(%rsp)
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movl  8(%rsp), %esi
+    callq _arg_reg
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB150_2
+## if-else
+_LBB150_3:
+## assign
+    movq  -160(%rbp), %rax
+    addq  $28, %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  -148(%rbp), %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    movl  %eax, 16(%rsp)
+    movl  $3, %eax
+    movl  %eax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movl  8(%rsp), %esi
+    callq _arg_reg
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+_LBB150_2:
+## add-assign
+    leaq  -148(%rbp), %rax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    addl  %eax, (%rdx)
+    movl  (%rdx), %eax
+    jmp   _LBB148_2
+## if-else
+_LBB148_3:
+## assign
+    movq  -160(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movl  -144(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -160(%rbp), %rax
+    addq  $36, %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## add-assign
+    leaq  -144(%rbp), %rax
+    pushq %rax
+    movq  -160(%rbp), %rax
+    addq  $32, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    addl  %eax, (%rdx)
+    movl  (%rdx), %eax
+_LBB148_2:
+_LBB146_2:
+## for-post
+_LBB141_4:
+## assign
+    leaq  -160(%rbp), %rax
+    pushq %rax
+    movq  -160(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB141_1
+_LBB141_2:
+## assign
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    movl  -152(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  $0, %eax
+    cmpl  $0, %eax
+    je    _LBB151_3
+## if-then
+    subq  $16, %rsp
+    movq  -40(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _print_argument_list
+    addq  $16, %rsp
+    jmp   _LBB151_2
+## if-else
+_LBB151_3:
+_LBB151_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -44(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _gen_sub_stack_pointer
+    addq  $16, %rsp
+## for-pre
+## assign
+    leaq  -168(%rbp), %rax
+    pushq %rax
+    movq  -40(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB152_1:
+    movq  -168(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB152_2
+## for-body
+## if-cond
+    movq  -168(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB153_3
+## if-then
+    jmp   _LBB152_4
+    jmp   _LBB153_2
+## if-else
+_LBB153_3:
+_LBB153_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -168(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -168(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movl  $39, %eax
+    movl  %eax, 8(%rsp)
+    movq  -168(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _gen_store_a
+    addq  $32, %rsp
+## for-post
+_LBB152_4:
+## assign
+    leaq  -168(%rbp), %rax
+    pushq %rax
+    movq  -168(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB152_1
+_LBB152_2:
+## for-pre
+## assign
+    leaq  -168(%rbp), %rax
+    pushq %rax
+    movq  -40(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB154_1:
+    movq  -168(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB154_2
+## for-body
+## if-cond
+    movq  -168(%rbp), %rax
+    addq  $36, %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    je    _LBB155_3
+## if-then
+    jmp   _LBB154_4
+    jmp   _LBB155_2
+## if-else
+_LBB155_3:
+_LBB155_2:
+## if-cond
+    movq  -168(%rbp), %rax
+    addq  $38, %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    je    _LBB156_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $25, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  $34, %eax
+    movl  %eax, 8(%rsp)
+    movq  -168(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movq  -168(%rbp), %rax
+    addq  $24, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB154_4
+    jmp   _LBB156_2
+## if-else
+_LBB156_3:
+_LBB156_2:
+## if-cond
+    movq  -168(%rbp), %rax
+    addq  $37, %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    je    _LBB157_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $19, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  $39, %eax
+    movl  %eax, 8(%rsp)
+    movq  -168(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movq  -168(%rbp), %rax
+    addq  $24, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB154_4
+    jmp   _LBB157_2
+## if-else
+_LBB157_3:
+_LBB157_2:
+## if-cond
+    movq  -168(%rbp), %rax
+    addq  $32, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $8, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB158_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  $39, %eax
+    movl  %eax, 8(%rsp)
+    movq  -168(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movq  -168(%rbp), %rax
+    addq  $24, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  $39, %eax
+    movl  %eax, 8(%rsp)
+    movq  -168(%rbp), %rax
+    addq  $20, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movq  -168(%rbp), %rax
+    addq  $28, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB154_4
+    jmp   _LBB158_2
+## if-else
+_LBB158_3:
+_LBB158_2:
+## if-cond
+    movq  -168(%rbp), %rax
+    addq  $32, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $8, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setle %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB159_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  $39, %eax
+    movl  %eax, 8(%rsp)
+    movq  -168(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movq  -168(%rbp), %rax
+    addq  $24, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB159_2
+## if-else
+_LBB159_3:
+_LBB159_2:
+## for-post
+_LBB154_4:
+## assign
+    leaq  -168(%rbp), %rax
+    pushq %rax
+    movq  -168(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB154_1
+_LBB154_2:
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_variadic
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB160_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  -48(%rbp), %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _imm
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  $1, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB160_2
+## if-else
+_LBB160_3:
+_LBB160_2:
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_pointer
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB161_3
+## if-then
+## local scalar init
+    leaq  -172(%rbp), %rax
+    pushq %rax
+## cond-?
+    subq  $8, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _is_static
+    addq  $8, %rsp
+    cmpq  $0, %rax
+    je    _LBB162_3
+## cond-then
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movslq %eax, %rax
+    jmp   _LBB162_2
+## cond-else
+_LBB162_3:
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+_LBB162_2:
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_global_var
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB163_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $28, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movl  -172(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _symb
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    jmp   _LBB163_2
+## if-else
+_LBB163_3:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $28, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  $34, %eax
+    movl  %eax, 8(%rsp)
+    movq  $-1, %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    addq  $28, %rax
+    movl  (%rax), %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+_LBB163_2:
+    jmp   _LBB161_2
+## if-else
+_LBB161_3:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $28, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _label
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+_LBB161_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -44(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _gen_add_stack_pointer
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -40(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free_argument_list
+    addq  $16, %rsp
+## if-cond
+    subq  $16, %rsp
+    movq  -32(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_medium_object
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB164_3
+## if-then
+## local scalar init
+    leaq  -176(%rbp), %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    callq _get_local_area_size
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movl  $34, %eax
+    movl  %eax, 8(%rsp)
+    movl  -176(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movl  $34, %eax
+    movl  %eax, 8(%rsp)
+    movl  -176(%rbp), %eax
+    pushq %rax
+    movl  $8, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $25, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  $34, %eax
+    movl  %eax, 8(%rsp)
+    movl  -176(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  $4, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB164_2
+## if-else
+_LBB164_3:
+_LBB164_2:
+_LBB137_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_gen_builtin_va_start:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1895(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1896(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1897(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1898(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1899(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1900(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1901(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1902(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1903(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1904(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1905(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1906(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1907(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+_LBB165_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_gen_func_call_builtin:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## if-cond
+    movq  -16(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB167_3
+## if-then
+    jmp   _LBB166_0
+    jmp   _LBB167_2
+## if-else
+_LBB167_3:
+_LBB167_2:
+## switch-value
+    movq  -16(%rbp), %rax
+    addq  $28, %rax
+    movb  (%rax), %al
+    movzbl %al, %eax
+## begin jump table
+    cmpl  $34, %eax
+    je    _LBB168_2017
+    cmpl  $35, %eax
+    je    _LBB168_2022
+    jmp   _LBB168_2023
+    jmp   _LBB168_2
+## end jump table
+_LBB168_2017:
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _node_l
+    addq  $8, %rsp
+    addq  $8, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_func_call_builtin
+    addq  $16, %rsp
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1920(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB169_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _gen_builtin_va_start
+    addq  $16, %rsp
+    jmp   _LBB169_2
+## if-else
+_LBB169_3:
+_LBB169_2:
+    jmp   _LBB166_0
+_LBB168_2022:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $7, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  $8, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _imm
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  $39, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movl  $39, %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB166_0
+_LBB168_2023:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_func_call_builtin
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_func_call_builtin
+    addq  $16, %rsp
+    jmp   _LBB166_0
+_LBB168_2:
+_LBB166_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_gen_label:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+    movl  %edx, -16(%rbp)
+## func body
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  _LABEL_NAME_PREFIX_1443(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movl  -12(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -16(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _gen_label_name
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1934(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+_LBB170_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_gen_ident:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $160, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## if-cond
+    movq  -16(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB173_2
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB173_2
+    movl  $0, %eax
+_LBB173_2:
+    cmpl  $0, %eax
+    je    _LBB172_3
+## if-then
+    jmp   _LBB171_0
+    jmp   _LBB172_2
+## if-else
+_LBB172_3:
+_LBB172_2:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_array
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB175_2
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_small_object
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB175_2
+    movl  $0, %eax
+_LBB175_2:
+    cmpl  $0, %eax
+    je    _LBB174_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_address
+    addq  $16, %rsp
+    jmp   _LBB171_0
+    jmp   _LBB174_2
+## if-else
+_LBB174_3:
+_LBB174_2:
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_global_var
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB176_3
+## if-then
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1946(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB179_2
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1947(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB179_2
+    movl  $0, %eax
+_LBB179_2:
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB178_2
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1948(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB178_2
+    movl  $0, %eax
+_LBB178_2:
+    cmpl  $0, %eax
+    je    _LBB177_3
+## if-then
+## local scalar init
+    leaq  -152(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $1, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $2, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $3, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $5, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $6, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $7, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $9, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $10, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $11, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $12, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $13, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $14, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $15, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $17, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $18, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $19, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $20, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $21, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $22, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $23, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $25, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $26, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $27, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $28, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $29, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $30, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $31, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $33, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $34, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $35, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $36, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $37, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $38, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $39, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $40, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $41, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $42, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $43, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $44, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $45, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $46, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $47, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $48, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $49, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $50, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $51, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $52, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $53, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $54, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $55, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $56, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $57, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $58, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $59, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $60, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $61, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $62, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $63, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $64, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $65, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $66, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $67, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $68, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $69, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $70, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $71, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $72, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $73, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $74, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $75, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $76, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $77, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $78, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $79, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $80, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $81, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $82, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $83, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $84, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $85, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $86, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $87, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $88, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $89, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $90, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $91, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $92, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $93, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $94, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $95, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $96, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $97, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $98, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $99, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $100, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $101, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $102, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $103, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $104, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $105, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $106, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $107, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $108, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $109, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $110, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $111, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $112, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $113, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $114, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $115, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $116, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $117, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $118, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $119, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $120, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $121, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $122, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $123, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $124, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $125, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $126, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    addq  $127, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+    subq  $32, %rsp
+    leaq  -152(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_1951(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _sprintf
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    leaq  -152(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _symb
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  $4, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  $4, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB177_2
+## if-else
+_LBB177_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_odd_size_object
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB180_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_address
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _gen_load_to_a
+    addq  $32, %rsp
+    jmp   _LBB180_2
+## if-else
+_LBB180_3:
+## local scalar init
+    leaq  -156(%rbp), %rax
+    pushq %rax
+## cond-?
+    subq  $8, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _is_static
+    addq  $8, %rsp
+    cmpq  $0, %rax
+    je    _LBB181_3
+## cond-then
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movslq %eax, %rax
+    jmp   _LBB181_2
+## cond-else
+_LBB181_3:
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+_LBB181_2:
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -160(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _register_from_type
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movl  -156(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _symb
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  -160(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+_LBB180_2:
+_LBB177_2:
+    jmp   _LBB176_2
+## if-else
+_LBB176_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_enumerator
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB182_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _get_mem_offset
+    addq  $16, %rsp
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _imm
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  $3, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB182_2
+## if-else
+_LBB182_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_func
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB183_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $25, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _symb
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  $4, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB183_2
+## if-else
+_LBB183_3:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movl  $34, %eax
+    movl  %eax, 8(%rsp)
+    movq  $-1, %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _get_mem_offset
+    addq  $8, %rsp
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _gen_load_to_a
+    addq  $32, %rsp
+_LBB183_2:
+_LBB182_2:
+_LBB176_2:
+_LBB171_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_gen_address:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## if-cond
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB185_3
+## if-then
+    jmp   _LBB184_0
+    jmp   _LBB185_2
+## if-else
+_LBB185_3:
+_LBB185_2:
+## switch-value
+    movq  -16(%rbp), %rax
+    addq  $28, %rax
+    movb  (%rax), %al
+    movzbl %al, %eax
+## begin jump table
+    cmpl  $70, %eax
+    je    _LBB186_2075
+    cmpl  $64, %eax
+    je    _LBB186_2076
+    cmpl  $32, %eax
+    je    _LBB186_2083
+    cmpl  $29, %eax
+    je    _LBB186_2084
+    jmp   _LBB186_2085
+    jmp   _LBB186_2
+## end jump table
+_LBB186_2075:
+_LBB186_2076:
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_global_var
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB187_3
+## if-then
+## local scalar init
+    leaq  -20(%rbp), %rax
+    pushq %rax
+## cond-?
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _is_static
+    addq  $8, %rsp
+    cmpq  $0, %rax
+    je    _LBB188_3
+## cond-then
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movslq %eax, %rax
+    jmp   _LBB188_2
+## cond-else
+_LBB188_3:
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+_LBB188_2:
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $25, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _symb
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  $4, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB187_2
+## if-else
+_LBB187_3:
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _get_mem_offset
+    addq  $16, %rsp
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $25, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  $34, %eax
+    movl  %eax, 8(%rsp)
+    movl  -24(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  $4, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+_LBB187_2:
+    jmp   _LBB186_2
+_LBB186_2083:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    jmp   _LBB186_2
+_LBB186_2084:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_address
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $6, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _get_mem_offset
+    addq  $16, %rsp
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _imm
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  $4, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB186_2
+_LBB186_2085:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1986(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    jmp   _LBB186_2
+_LBB186_2:
+_LBB184_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_gen_load_to_a:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movl  %edx, -20(%rbp)
+    movl  %ecx, -24(%rbp)
+## func body
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_array
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB190_3
+## if-then
+    jmp   _LBB189_0
+    jmp   _LBB190_2
+## if-else
+_LBB190_3:
+_LBB190_2:
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_small_object
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB191_3
+## if-then
+    jmp   _LBB189_0
+    jmp   _LBB191_2
+## if-else
+_LBB191_3:
+_LBB191_2:
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_fpnum
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB192_3
+## if-then
+## local scalar init
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $80, %eax
+    movl  %eax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _register_from_type
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $19, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  -20(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -24(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  -28(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB192_2
+## if-else
+_LBB192_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_odd_size_object
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB193_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _get_size
+    addq  $16, %rsp
+    movl  %eax, 16(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -24(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _gen_load_pieces
+    addq  $32, %rsp
+    jmp   _LBB193_2
+## if-else
+_LBB193_3:
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _register_from_type
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  -20(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -24(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  -32(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+_LBB193_2:
+_LBB192_2:
+_LBB189_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_gen_store_a:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movl  %edx, -20(%rbp)
+    movl  %ecx, -24(%rbp)
+## func body
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_small_object
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB195_3
+## if-then
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_fpnum
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB196_3
+## if-then
+## local scalar init
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $80, %eax
+    movl  %eax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _register_from_type
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $19, %eax
+    movl  %eax, 16(%rsp)
+    movl  -28(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movl  -20(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -24(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB196_2
+## if-else
+_LBB196_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_odd_size_object
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB197_3
+## if-then
+    subq  $48, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 40(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _get_size
+    addq  $16, %rsp
+    movl  %eax, 32(%rsp)
+    movl  $0, %eax
+    movl  %eax, 24(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    movl  -24(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  40(%rsp), %rdi
+    movl  32(%rsp), %esi
+    movl  24(%rsp), %edx
+    movl  16(%rsp), %ecx
+    movl  8(%rsp), %r8d
+    callq _gen_store_pieces
+    addq  $48, %rsp
+    jmp   _LBB197_2
+## if-else
+_LBB197_3:
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _register_from_type
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movl  -32(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movl  -20(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -24(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+_LBB197_2:
+_LBB196_2:
+    jmp   _LBB195_2
+## if-else
+_LBB195_3:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -24(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _gen_copy_large_object
+    addq  $32, %rsp
+_LBB195_2:
+_LBB194_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_gen_compare_to_zero:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _register_from_type
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $18, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  $0, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _imm
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+_LBB198_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_gen_push_a:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movl  %edx, -20(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $8, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _gen_sub_stack_pointer
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $19, %eax
+    movl  %eax, 16(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movl  $39, %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+_LBB199_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_gen_pop_to:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movl  %edx, -20(%rbp)
+## func body
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $19, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  $39, %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $8, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _gen_add_stack_pointer
+    addq  $16, %rsp
+_LBB200_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_gen_div:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movl  %edx, -20(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $15, %eax
+    movl  %eax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _register_from_type
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  -20(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _register_from_type
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_unsigned
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB202_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $15, %eax
+    movl  %eax, 16(%rsp)
+    movl  -24(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -24(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $9, %eax
+    movl  %eax, 16(%rsp)
+    movl  -28(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    jmp   _LBB201_0
+    jmp   _LBB202_2
+## if-else
+_LBB202_3:
+_LBB202_2:
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_long
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB203_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $44, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _code1
+    addq  $16, %rsp
+    jmp   _LBB203_2
+## if-else
+_LBB203_3:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $43, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _code1
+    addq  $16, %rsp
+_LBB203_2:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $10, %eax
+    movl  %eax, 16(%rsp)
+    movl  -28(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+_LBB201_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_gen_preincdec:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movl  %edx, -20(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _register_from_type
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $15, %eax
+    movl  %eax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _register_from_type
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_pointer
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB205_3
+## if-then
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _underlying
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _get_size
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB205_2
+## if-else
+_LBB205_3:
+_LBB205_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_address
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  -28(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  -32(%rbp), %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _imm
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  -28(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movl  -28(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movl  -28(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -24(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+_LBB204_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_gen_postincdec:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movl  %edx, -20(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _register_from_type
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $10, %eax
+    movl  %eax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _register_from_type
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_pointer
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB207_3
+## if-then
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _underlying
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _get_size
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB207_2
+## if-else
+_LBB207_3:
+_LBB207_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_address
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movl  $19, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  -24(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movl  -24(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -28(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  -32(%rbp), %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _imm
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  -28(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movl  -28(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+_LBB206_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_gen_relational:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movl  %edx, -20(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _register_from_type
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $15, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _register_from_type
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $26, %eax
+    movl  %eax, 16(%rsp)
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movl  -24(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -28(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $27, %eax
+    movl  %eax, 16(%rsp)
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $18, %eax
+    movl  %eax, 16(%rsp)
+    movl  -28(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -24(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $4, %eax
+    movl  %eax, 16(%rsp)
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movl  $3, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+_LBB208_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_gen_equality:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movl  %edx, -20(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _register_from_type
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $15, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _register_from_type
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $26, %eax
+    movl  %eax, 16(%rsp)
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $27, %eax
+    movl  %eax, 16(%rsp)
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $18, %eax
+    movl  %eax, 16(%rsp)
+    movl  -28(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -24(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $4, %eax
+    movl  %eax, 16(%rsp)
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movl  $3, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+_LBB209_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_jump_id:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+    movl  $100, %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    jmp   _LBB210_0
+_LBB210_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_gen_switch_table_:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $592, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movl  %edx, -20(%rbp)
+    movq  %rcx, -32(%rbp)
+## func body
+## if-cond
+    movq  -16(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB212_3
+## if-then
+    jmp   _LBB211_0
+    jmp   _LBB212_2
+## if-else
+_LBB212_3:
+_LBB212_2:
+## switch-value
+    movq  -16(%rbp), %rax
+    addq  $28, %rax
+    movb  (%rax), %al
+    movzbl %al, %eax
+## begin jump table
+    cmpl  $9, %eax
+    je    _LBB213_2236
+    cmpl  $10, %eax
+    je    _LBB213_2237
+    cmpl  $11, %eax
+    je    _LBB213_2241
+    cmpl  $2, %eax
+    je    _LBB213_2242
+    cmpl  $1, %eax
+    je    _LBB213_2243
+    jmp   _LBB213_2248
+    jmp   _LBB213_2
+## end jump table
+_LBB213_2236:
+    jmp   _LBB211_0
+_LBB213_2237:
+## local scalar init
+    leaq  -36(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _register_from_type
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $18, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_ival
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _imm
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $30, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  -20(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _jump_id
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _make_label
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, 16(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  -32(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    movq  (%rsp), %rcx
+    callq _gen_switch_table_
+    addq  $32, %rsp
+    jmp   _LBB211_0
+_LBB213_2241:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $32, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  -20(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _jump_id
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _make_label
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    jmp   _LBB211_0
+_LBB213_2242:
+_LBB213_2243:
+    subq  $16, %rsp
+    leaq  -584(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _begin_ast_walk
+    addq  $16, %rsp
+## while-cond
+_LBB214_4:
+## assign
+    leaq  -592(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    leaq  -584(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _next_ast_list_item
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB214_2
+## while-body
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -592(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  -32(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    movq  (%rsp), %rcx
+    callq _gen_switch_table_
+    addq  $32, %rsp
+    jmp   _LBB214_4
+_LBB214_2:
+    subq  $16, %rsp
+    leaq  -584(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _end_ast_walk
+    addq  $16, %rsp
+    jmp   _LBB213_2
+_LBB213_2248:
+    jmp   _LBB213_2
+_LBB213_2:
+_LBB211_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_gen_switch_table:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movl  %edx, -20(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2159(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_comment
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, 16(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    movq  (%rsp), %rcx
+    callq _gen_switch_table_
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $32, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  -20(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  $2, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _make_label
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2160(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_comment
+    addq  $16, %rsp
+_LBB215_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_gen_convert_a:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movq  %rdx, -24(%rbp)
+## func body
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _is_identical
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB217_3
+## if-then
+    jmp   _LBB216_0
+    jmp   _LBB217_2
+## if-else
+_LBB217_3:
+_LBB217_2:
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_char
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB218_3
+## if-then
+## local scalar init
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _register_from_type
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _register_from_type
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -36(%rbp), %rax
+    pushq %rax
+## cond-?
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _is_unsigned
+    addq  $8, %rsp
+    cmpl  $0, %eax
+    je    _LBB219_3
+## cond-then
+    movl  $4, %eax
+    jmp   _LBB219_2
+## cond-else
+_LBB219_3:
+    movl  $1, %eax
+_LBB219_2:
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    movl  -28(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -32(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB218_2
+## if-else
+_LBB218_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_short
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB220_3
+## if-then
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_long
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB222_2
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_int
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB222_2
+    movl  $0, %eax
+_LBB222_2:
+    cmpl  $0, %eax
+    je    _LBB221_3
+## if-then
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_unsigned
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB223_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $5, %eax
+    movl  %eax, 16(%rsp)
+    movl  $2, %eax
+    movl  %eax, 8(%rsp)
+    movl  $4, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB223_2
+## if-else
+_LBB223_3:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $2, %eax
+    movl  %eax, 16(%rsp)
+    movl  $2, %eax
+    movl  %eax, 8(%rsp)
+    movl  $4, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+_LBB223_2:
+    jmp   _LBB221_2
+## if-else
+_LBB221_3:
+_LBB221_2:
+    jmp   _LBB220_2
+## if-else
+_LBB220_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_int
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB224_3
+## if-then
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_long
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB226_2
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_int
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB226_2
+    movl  $0, %eax
+_LBB226_2:
+    cmpl  $0, %eax
+    je    _LBB225_3
+## if-then
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_unsigned
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB227_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movl  $3, %eax
+    movl  %eax, 8(%rsp)
+    movl  $3, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB227_2
+## if-else
+_LBB227_3:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $3, %eax
+    movl  %eax, 16(%rsp)
+    movl  $3, %eax
+    movl  %eax, 8(%rsp)
+    movl  $4, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+_LBB227_2:
+    jmp   _LBB225_2
+## if-else
+_LBB225_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_float
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB228_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $45, %eax
+    movl  %eax, 16(%rsp)
+    movl  $3, %eax
+    movl  %eax, 8(%rsp)
+    movl  $84, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB228_2
+## if-else
+_LBB228_3:
+_LBB228_2:
+_LBB225_2:
+    jmp   _LBB224_2
+## if-else
+_LBB224_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_float
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB229_3
+## if-then
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_int
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB230_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $48, %eax
+    movl  %eax, 16(%rsp)
+    movl  $84, %eax
+    movl  %eax, 8(%rsp)
+    movl  $3, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB230_2
+## if-else
+_LBB230_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_double
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB231_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $46, %eax
+    movl  %eax, 16(%rsp)
+    movl  $84, %eax
+    movl  %eax, 8(%rsp)
+    movl  $84, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB231_2
+## if-else
+_LBB231_3:
+_LBB231_2:
+_LBB230_2:
+    jmp   _LBB229_2
+## if-else
+_LBB229_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_double
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB232_3
+## if-then
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_int
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB233_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $49, %eax
+    movl  %eax, 16(%rsp)
+    movl  $84, %eax
+    movl  %eax, 8(%rsp)
+    movl  $3, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB233_2
+## if-else
+_LBB233_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_float
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB234_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $47, %eax
+    movl  %eax, 16(%rsp)
+    movl  $84, %eax
+    movl  %eax, 8(%rsp)
+    movl  $84, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB234_2
+## if-else
+_LBB234_3:
+_LBB234_2:
+_LBB233_2:
+    jmp   _LBB232_2
+## if-else
+_LBB232_3:
+_LBB232_2:
+_LBB229_2:
+_LBB224_2:
+_LBB220_2:
+_LBB218_2:
+_LBB216_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_gen_copy_large_object:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movl  %edx, -20(%rbp)
+    movl  %ecx, -24(%rbp)
+## func body
+## local scalar init
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _get_size
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## while-cond
+_LBB236_4:
+    movl  -32(%rbp), %eax
+    pushq %rax
+    movl  -28(%rbp), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB236_2
+## while-body
+## local scalar init
+    leaq  -36(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movl  -32(%rbp), %eax
+    movl  %eax, %edx
+    popq  %rax
+    subl  %edx, %eax
+    movl  %eax, (%rsp)
+    movl  (%rsp), %edi
+    callq _piece_size
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $50, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  -36(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _piece_opsize
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movl  8(%rsp), %esi
+    callq _regi
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movl  -32(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  -40(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movl  -40(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movl  -20(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -24(%rbp), %eax
+    pushq %rax
+    movl  -32(%rbp), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+## add-assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  -36(%rbp), %eax
+    popq  %rdx
+    addl  %eax, (%rdx)
+    movl  (%rdx), %eax
+    jmp   _LBB236_4
+_LBB236_2:
+_LBB235_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_gen_init_scalar_local:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movq  %rdx, -24(%rbp)
+    movl  %ecx, -28(%rbp)
+    movq  %r8, -40(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2213(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_comment
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_address
+    addq  $16, %rsp
+## if-cond
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB238_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $6, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  -28(%rbp), %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _imm
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  $4, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB238_2
+## if-else
+_LBB238_3:
+_LBB238_2:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $26, %eax
+    movl  %eax, 16(%rsp)
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+## if-cond
+    movq  -40(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB239_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -40(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $27, %eax
+    movl  %eax, 16(%rsp)
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _gen_store_a
+    addq  $32, %rsp
+    jmp   _LBB239_2
+## if-else
+_LBB239_3:
+## local scalar init
+    leaq  -44(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $15, %eax
+    movl  %eax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _register_from_type
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $27, %eax
+    movl  %eax, 16(%rsp)
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  $0, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _imm
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  -44(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movl  -44(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+_LBB239_2:
+_LBB237_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_append_new_bit:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+    movl  %edx, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $1, %eax
+    movslq %eax, %rax
+    movq  %rax, 16(%rsp)
+    movl  $24, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _calloc
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -32(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -32(%rbp), %rax
+    addq  $20, %rax
+    pushq %rax
+    movl  -16(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB241_3
+## if-then
+## assign
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB240_0
+    jmp   _LBB241_2
+## if-else
+_LBB241_3:
+_LBB241_2:
+## for-pre
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB242_1:
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    je    _LBB242_2
+## for-body
+## for-post
+_LBB242_4:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB242_1
+_LBB242_2:
+## assign
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+_LBB240_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_free_memory_bit:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## while-cond
+_LBB244_4:
+    movq  -16(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB244_2
+## while-body
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB244_4
+_LBB244_2:
+_LBB243_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_gen_init_bit_local:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $64, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movl  %edx, -20(%rbp)
+    movq  %rcx, -32(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2273(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_comment
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_address
+    addq  $16, %rsp
+## if-cond
+    movl  -20(%rbp), %eax
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB246_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $6, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  -20(%rbp), %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _imm
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  $4, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB246_2
+## if-else
+_LBB246_3:
+_LBB246_2:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  $0, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _imm
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  $13, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movl  $13, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+## for-pre
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB247_1:
+    movq  -40(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB247_2
+## for-body
+## local scalar init
+    leaq  -44(%rbp), %rax
+    pushq %rax
+    movq  -40(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    movq  -40(%rbp), %rax
+    addq  $20, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -52(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    notl  %eax
+    pushq %rax
+    movl  -44(%rbp), %eax
+    pushq %rax
+    movl  $1, %eax
+    movl  %eax, %edx
+    popq  %rax
+    subl  %edx, %eax
+    movl  %eax, %ecx
+    popq  %rax
+    shll  %cl, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -52(%rbp), %rax
+    pushq %rax
+    movl  -52(%rbp), %eax
+    notl  %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## shl-assign
+    leaq  -52(%rbp), %rax
+    pushq %rax
+    movl  -48(%rbp), %eax
+    movl  %eax, %ecx
+    popq  %rdx
+    movl  (%rdx), %eax
+    shll  %cl, %eax
+    movl  %eax, (%rdx)
+## assign
+    leaq  -52(%rbp), %rax
+    pushq %rax
+    movl  -52(%rbp), %eax
+    notl  %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_address
+    addq  $16, %rsp
+## if-cond
+    movl  -20(%rbp), %eax
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB248_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $6, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  -20(%rbp), %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _imm
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  $4, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB248_2
+## if-else
+_LBB248_3:
+_LBB248_2:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $26, %eax
+    movl  %eax, 16(%rsp)
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -40(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $27, %eax
+    movl  %eax, 16(%rsp)
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2278(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_comment
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movl  $3, %eax
+    movl  %eax, 8(%rsp)
+    movl  $13, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movl  $13, %eax
+    movl  %eax, 8(%rsp)
+    movl  $53, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $11, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  -48(%rbp), %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _imm
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  $13, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  $3, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $16, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  -52(%rbp), %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _imm
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  $3, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $14, %eax
+    movl  %eax, 16(%rsp)
+    movl  $13, %eax
+    movl  %eax, 8(%rsp)
+    movl  $3, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movl  $3, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movl  $53, %eax
+    movl  %eax, 8(%rsp)
+    movl  $3, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+## for-post
+_LBB247_4:
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movq  -40(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB247_1
+_LBB247_2:
+_LBB245_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_print_object:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $160, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -136(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $1, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $2, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $3, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $5, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $6, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $7, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $9, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $10, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $11, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $12, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $13, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $14, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $15, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $17, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $18, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $19, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $20, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $21, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $22, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $23, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $25, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $26, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $27, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $28, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $29, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $30, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $31, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $33, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $34, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $35, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $36, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $37, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $38, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $39, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $40, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $41, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $42, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $43, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $44, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $45, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $46, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $47, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $48, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $49, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $50, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $51, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $52, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $53, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $54, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $55, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $56, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $57, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $58, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $59, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $60, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $61, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $62, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $63, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $64, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $65, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $66, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $67, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $68, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $69, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $70, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $71, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $72, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $73, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $74, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $75, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $76, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $77, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $78, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $79, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $80, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $81, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $82, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $83, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $84, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $85, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $86, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $87, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $88, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $89, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $90, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $91, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $92, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $93, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $94, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $95, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $96, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $97, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $98, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $99, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $100, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $101, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $102, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $103, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $104, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $105, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $106, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $107, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $108, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $109, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $110, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $111, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $112, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $113, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $114, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $115, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $116, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $117, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $118, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $119, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $120, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $121, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $122, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $123, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $124, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $125, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $126, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $127, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  -136(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _make_type_name
+    addq  $16, %rsp
+    subq  $32, %rsp
+    leaq  _L_str_2288(%rip), %rax
+    movq  %rax, 24(%rsp)
+    leaq  -136(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _printf
+    addq  $32, %rsp
+## for-pre
+## assign
+    leaq  -140(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB250_1:
+    movl  -140(%rbp), %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB250_2
+## for-body
+## local scalar init
+    leaq  -152(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $32, %eax
+    pushq %rax
+    movl  -140(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $48, %rsp
+    leaq  _L_str_2291(%rip), %rax
+    movq  %rax, 40(%rsp)
+    movl  -140(%rbp), %eax
+    movl  %eax, 32(%rsp)
+    movq  -152(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    movl  %eax, 24(%rsp)
+    movq  -152(%rbp), %rax
+    addq  $20, %rax
+    movl  (%rax), %eax
+    movl  %eax, 16(%rsp)
+    movq  -152(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  40(%rsp), %rdi
+    movl  32(%rsp), %esi
+    movl  24(%rsp), %edx
+    movl  16(%rsp), %ecx
+    movq  8(%rsp), %r8
+    movb  $0, %al
+    callq _printf
+    addq  $48, %rsp
+## if-cond
+    movq  -152(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    je    _LBB251_3
+## if-then
+## local scalar init
+    leaq  -160(%rbp), %rax
+    pushq %rax
+    movq  -152(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-pre
+## for-cond
+_LBB252_1:
+    movq  -160(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB252_2
+## for-body
+    subq  $16, %rsp
+    leaq  _L_str_2295(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    subq  $32, %rsp
+    leaq  _L_str_2296(%rip), %rax
+    movq  %rax, 24(%rsp)
+    movq  -160(%rbp), %rax
+    addq  $20, %rax
+    movl  (%rax), %eax
+    movl  %eax, 16(%rsp)
+    movq  -160(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    movl  %eax, 8(%rsp)
+    movq  -160(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movq  (%rsp), %rcx
+    movb  $0, %al
+    callq _printf
+    addq  $32, %rsp
+## for-post
+_LBB252_4:
+## assign
+    leaq  -160(%rbp), %rax
+    pushq %rax
+    movq  -160(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB252_1
+_LBB252_2:
+    jmp   _LBB251_2
+## if-else
+_LBB251_3:
+_LBB251_2:
+## for-post
+_LBB250_4:
+    leaq  -140(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB250_1
+_LBB250_2:
+_LBB249_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_zero_clear_bytes:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $64, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_array
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB254_3
+## if-then
+## local scalar init
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _get_array_length
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _underlying
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _get_size
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-pre
+## assign
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB255_1:
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movl  -20(%rbp), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB255_2
+## for-body
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  -24(%rbp), %eax
+    pushq %rax
+    movl  -28(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $32, %eax
+    pushq %rax
+    movl  -32(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _underlying
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _zero_clear_bytes
+    addq  $16, %rsp
+## for-post
+_LBB255_4:
+    leaq  -28(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB255_1
+_LBB255_2:
+    jmp   _LBB254_2
+## if-else
+_LBB254_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_struct
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB256_3
+## if-then
+## for-pre
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _first_member
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB257_1:
+    movq  -40(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB257_2
+## for-body
+## local scalar init
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    movq  -40(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -48(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_bitfield
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB258_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $32, %eax
+    pushq %rax
+    movq  -48(%rbp), %rax
+    addq  $28, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  %rax, 24(%rsp)
+    movq  -48(%rbp), %rax
+    addq  $92, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, 16(%rsp)
+    movq  -48(%rbp), %rax
+    addq  $91, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _append_new_bit
+    addq  $32, %rsp
+    jmp   _LBB258_2
+## if-else
+_LBB258_3:
+_LBB258_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $32, %eax
+    pushq %rax
+    movq  -48(%rbp), %rax
+    addq  $28, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  %rax, 8(%rsp)
+    movq  -48(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _zero_clear_bytes
+    addq  $16, %rsp
+## for-post
+_LBB257_4:
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -40(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _next_member
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB257_1
+_LBB257_2:
+    jmp   _LBB256_2
+## if-else
+_LBB256_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_union
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB259_3
+## if-then
+## local scalar init
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _first_member
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -56(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _zero_clear_bytes
+    addq  $16, %rsp
+    jmp   _LBB259_2
+## if-else
+_LBB259_3:
+## local scalar init
+    leaq  -60(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _get_size
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-pre
+## assign
+    leaq  -64(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB260_1:
+    movl  -64(%rbp), %eax
+    pushq %rax
+    movl  -60(%rbp), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB260_2
+## for-body
+## assign
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $32, %eax
+    pushq %rax
+    movl  -64(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $16, %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $32, %eax
+    pushq %rax
+    movl  -64(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $20, %rax
+    pushq %rax
+## cond-?
+    movl  -64(%rbp), %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB261_3
+## cond-then
+    movl  -60(%rbp), %eax
+    jmp   _LBB261_2
+## cond-else
+_LBB261_3:
+    movl  $0, %eax
+_LBB261_2:
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $32, %eax
+    pushq %rax
+    movl  -64(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $8, %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-post
+_LBB260_4:
+    leaq  -64(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB260_1
+_LBB260_2:
+_LBB259_2:
+_LBB256_2:
+_LBB254_2:
+_LBB253_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_init_object_byte:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _get_size
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  -20(%rbp), %eax
+    movslq %eax, %rax
+    movq  %rax, 16(%rsp)
+    movl  $32, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _calloc
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movl  -20(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _zero_clear_bytes
+    addq  $16, %rsp
+_LBB262_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_free_object_byte:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    popq  %rax
+    movq  $0, %rdx
+    movq  %rdx, (%rax)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## for-pre
+## assign
+    leaq  -36(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB264_1:
+    movl  -36(%rbp), %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB264_2
+## for-body
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $32, %eax
+    pushq %rax
+    movl  -36(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    je    _LBB265_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $32, %eax
+    pushq %rax
+    movl  -36(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free_memory_bit
+    addq  $16, %rsp
+    jmp   _LBB265_2
+## if-else
+_LBB265_3:
+_LBB265_2:
+## for-post
+_LBB264_4:
+    leaq  -36(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB264_1
+_LBB264_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+## assign
+    movq  -8(%rbp), %rax
+    pushq %rax
+    leaq  -32(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    movq  16(%rax), %r10
+    movq  %r10, 16(%rdx)
+_LBB263_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_assign_init:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $608, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movq  %rdx, -24(%rbp)
+## func body
+## if-cond
+    movq  -24(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB267_3
+## if-then
+    jmp   _LBB266_0
+    jmp   _LBB267_2
+## if-else
+_LBB267_3:
+_LBB267_2:
+## switch-value
+    movq  -24(%rbp), %rax
+    addq  $28, %rax
+    movb  (%rax), %al
+    movzbl %al, %eax
+## begin jump table
+    cmpl  $71, %eax
+    je    _LBB268_2458
+    cmpl  $1, %eax
+    je    _LBB268_2462
+    jmp   _LBB268_2467
+    jmp   _LBB268_2
+## end jump table
+_LBB268_2458:
+## local scalar init
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _node_ival
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $32, %eax
+    pushq %rax
+    movl  -28(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  %rax, 24(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _underlying
+    addq  $16, %rsp
+    movq  %rax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _assign_init
+    addq  $32, %rsp
+    jmp   _LBB268_2
+_LBB268_2462:
+    subq  $16, %rsp
+    leaq  -576(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _begin_ast_walk
+    addq  $16, %rsp
+## while-cond
+_LBB269_4:
+## assign
+    leaq  -584(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    leaq  -576(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _next_ast_list_item
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB269_2
+## while-body
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -584(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _assign_init
+    addq  $32, %rsp
+    jmp   _LBB269_4
+_LBB269_2:
+    subq  $16, %rsp
+    leaq  -576(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _end_ast_walk
+    addq  $16, %rsp
+    jmp   _LBB268_2
+_LBB268_2467:
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_struct_or_union
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB270_3
+## if-then
+## local scalar init
+    leaq  -588(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _get_size
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-pre
+## assign
+    leaq  -592(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB271_1:
+    movl  -592(%rbp), %eax
+    pushq %rax
+    movl  -588(%rbp), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB271_2
+## for-body
+## assign
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $32, %eax
+    pushq %rax
+    movl  -592(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $16, %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $32, %eax
+    pushq %rax
+    movl  -592(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $20, %rax
+    pushq %rax
+## cond-?
+    movl  -592(%rbp), %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB272_3
+## cond-then
+    movl  -588(%rbp), %eax
+    jmp   _LBB272_2
+## cond-else
+_LBB272_3:
+    movl  $0, %eax
+_LBB272_2:
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $32, %eax
+    pushq %rax
+    movl  -592(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $8, %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-post
+_LBB271_4:
+    leaq  -592(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB271_1
+_LBB271_2:
+    jmp   _LBB270_2
+## if-else
+_LBB270_3:
+## local scalar init
+    leaq  -596(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $20, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    je    _LBB273_3
+## if-then
+## for-pre
+## assign
+    leaq  -608(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB274_1:
+    movq  -608(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB274_2
+## for-body
+## if-cond
+    movq  -608(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB275_3
+## if-then
+    jmp   _LBB274_2
+    jmp   _LBB275_2
+## if-else
+_LBB275_3:
+_LBB275_2:
+## for-post
+_LBB274_4:
+## assign
+    leaq  -608(%rbp), %rax
+    pushq %rax
+    movq  -608(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB274_1
+_LBB274_2:
+## assign
+    movq  -608(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB273_2
+## if-else
+_LBB273_3:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+_LBB273_2:
+## for-pre
+## assign
+    leaq  -600(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB276_1:
+    movl  -600(%rbp), %eax
+    pushq %rax
+    movl  -596(%rbp), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB276_2
+## for-body
+## assign
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $32, %eax
+    pushq %rax
+    movl  -600(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $16, %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-post
+_LBB276_4:
+    leaq  -600(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB276_1
+_LBB276_2:
+_LBB270_2:
+    jmp   _LBB268_2
+_LBB268_2:
+_LBB266_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_eval_const_expr__:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## if-cond
+    movq  -8(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB278_3
+## if-then
+    movl  $0, %eax
+    movslq %eax, %rax
+    jmp   _LBB277_0
+    jmp   _LBB278_2
+## if-else
+_LBB278_3:
+_LBB278_2:
+## switch-value
+    movq  -8(%rbp), %rax
+    addq  $28, %rax
+    movb  (%rax), %al
+    movzbl %al, %eax
+## begin jump table
+    cmpl  $36, %eax
+    je    _LBB279_2495
+    cmpl  $37, %eax
+    je    _LBB279_2496
+    cmpl  $38, %eax
+    je    _LBB279_2497
+    cmpl  $39, %eax
+    je    _LBB279_2498
+    cmpl  $40, %eax
+    je    _LBB279_2499
+    cmpl  $41, %eax
+    je    _LBB279_2500
+    cmpl  $42, %eax
+    je    _LBB279_2501
+    cmpl  $30, %eax
+    je    _LBB279_2502
+    cmpl  $63, %eax
+    je    _LBB279_2503
+    cmpl  $65, %eax
+    je    _LBB279_2504
+    jmp   _LBB279_2505
+    jmp   _LBB279_2
+## end jump table
+_LBB279_2495:
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _eval_const_expr__
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _eval_const_expr__
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    jmp   _LBB277_0
+_LBB279_2496:
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _eval_const_expr__
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _eval_const_expr__
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    jmp   _LBB277_0
+_LBB279_2497:
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _eval_const_expr__
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _eval_const_expr__
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    jmp   _LBB277_0
+_LBB279_2498:
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _eval_const_expr__
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _eval_const_expr__
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    movq  %rax, %rdi
+    popq  %rax
+    cqto
+    idivq %rdi
+    jmp   _LBB277_0
+_LBB279_2499:
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _eval_const_expr__
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _eval_const_expr__
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    movq  %rax, %rdi
+    popq  %rax
+    cqto
+    idivq %rdi
+    movq  %rdx, %rax
+    jmp   _LBB277_0
+_LBB279_2500:
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _eval_const_expr__
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _eval_const_expr__
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    movq  %rax, %rcx
+    popq  %rax
+    shlq  %cl, %rax
+    jmp   _LBB277_0
+_LBB279_2501:
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _eval_const_expr__
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _eval_const_expr__
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    movq  %rax, %rcx
+    popq  %rax
+    sarq  %cl, %rax
+    jmp   _LBB277_0
+_LBB279_2502:
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _eval_const_expr__
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -16(%rbp), %rax
+    jmp   _LBB277_0
+_LBB279_2503:
+_LBB279_2504:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_ival
+    addq  $16, %rsp
+    jmp   _LBB277_0
+_LBB279_2505:
+    movl  $0, %eax
+    movslq %eax, %rax
+    jmp   _LBB277_0
+_LBB279_2:
+_LBB277_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_gen_init_scalar_global:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movq  %rdx, -24(%rbp)
+## func body
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _data_name_from_type
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -24(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB281_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_2418(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  -32(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+    jmp   _LBB280_0
+    jmp   _LBB281_2
+## if-else
+_LBB281_3:
+_LBB281_2:
+## switch-value
+    movq  -24(%rbp), %rax
+    addq  $28, %rax
+    movb  (%rax), %al
+    movzbl %al, %eax
+## begin jump table
+    cmpl  $65, %eax
+    je    _LBB282_2522
+    cmpl  $64, %eax
+    je    _LBB282_2524
+    cmpl  $31, %eax
+    je    _LBB282_2532
+    cmpl  $30, %eax
+    je    _LBB282_2536
+    cmpl  $67, %eax
+    je    _LBB282_2537
+    cmpl  $36, %eax
+    je    _LBB282_2538
+    cmpl  $37, %eax
+    je    _LBB282_2539
+    cmpl  $38, %eax
+    je    _LBB282_2540
+    cmpl  $39, %eax
+    je    _LBB282_2541
+    cmpl  $40, %eax
+    je    _LBB282_2542
+    jmp   _LBB282_2543
+    jmp   _LBB282_2
+## end jump table
+_LBB282_2522:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_2423(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  -32(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_ival
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movq  (%rsp), %rcx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+    jmp   _LBB282_2
+_LBB282_2524:
+## if-cond
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    movl  $0, %eax
+    je    _LBB284_2
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_enumerator
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB284_2
+    movl  $1, %eax
+_LBB284_2:
+    cmpl  $0, %eax
+    je    _LBB283_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_2425(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  -32(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _get_mem_offset
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movl  (%rsp), %ecx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+    jmp   _LBB283_2
+## if-else
+_LBB283_3:
+_LBB283_2:
+## if-cond
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    movl  $0, %eax
+    je    _LBB286_2
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_global_var
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB286_2
+    movl  $1, %eax
+_LBB286_2:
+    cmpl  $0, %eax
+    je    _LBB285_3
+## if-then
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_2428(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  -32(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+## if-cond
+    subq  $16, %rsp
+    movq  -40(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_static
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB287_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -40(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movq  -40(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _gen_symbol_name
+    addq  $32, %rsp
+    jmp   _LBB287_2
+## if-else
+_LBB287_3:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -40(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _gen_symbol_name
+    addq  $32, %rsp
+_LBB287_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1417(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    jmp   _LBB285_2
+## if-else
+_LBB285_3:
+_LBB285_2:
+## if-cond
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    movl  $0, %eax
+    je    _LBB289_2
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_func
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB289_2
+    movl  $1, %eax
+_LBB289_2:
+    cmpl  $0, %eax
+    je    _LBB288_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_2428(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  -32(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _gen_symbol_name
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1417(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    jmp   _LBB288_2
+## if-else
+_LBB288_3:
+_LBB288_2:
+    jmp   _LBB282_2
+_LBB282_2532:
+## local scalar init
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _node_l
+    addq  $8, %rsp
+    addq  $8, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_2428(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  -32(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+## if-cond
+    subq  $16, %rsp
+    movq  -48(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_static
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB290_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -48(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movq  -48(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _gen_symbol_name
+    addq  $32, %rsp
+    jmp   _LBB290_2
+## if-else
+_LBB290_3:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -48(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _gen_symbol_name
+    addq  $32, %rsp
+_LBB290_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1417(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    jmp   _LBB282_2
+_LBB282_2536:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _gen_init_scalar_global
+    addq  $32, %rsp
+    jmp   _LBB282_2
+_LBB282_2537:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_2428(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  -32(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _gen_string_literal_name
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1417(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    jmp   _LBB282_2
+_LBB282_2538:
+_LBB282_2539:
+_LBB282_2540:
+_LBB282_2541:
+_LBB282_2542:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_2423(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  -32(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _eval_const_expr__
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movq  (%rsp), %rcx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+    jmp   _LBB282_2
+_LBB282_2543:
+    jmp   _LBB282_2
+_LBB282_2:
+_LBB280_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_gen_object_byte:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -36(%rbp), %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -32(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_static
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB292_3
+## if-then
+## assign
+    leaq  -36(%rbp), %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2458(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -32(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _gen_symbol_name
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1417(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    jmp   _LBB292_2
+## if-else
+_LBB292_3:
+_LBB292_2:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -32(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _gen_symbol_name
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1934(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+## for-pre
+## assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB293_1:
+    movl  -20(%rbp), %eax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB293_2
+## for-body
+## local scalar init
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $32, %eax
+    pushq %rax
+    movl  -20(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -48(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB294_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2464(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    jmp   _LBB293_4
+    jmp   _LBB294_2
+## if-else
+_LBB294_3:
+_LBB294_2:
+## if-cond
+    movq  -48(%rbp), %rax
+    addq  $20, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB295_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -48(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movq  -48(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _gen_init_scalar_global
+    addq  $32, %rsp
+    jmp   _LBB295_2
+## if-else
+_LBB295_3:
+_LBB295_2:
+## for-post
+_LBB293_4:
+    leaq  -20(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB293_1
+_LBB293_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1417(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+_LBB291_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_gen_initializer:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $112, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movq  %rdx, -24(%rbp)
+## func body
+## local scalar init
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    popq  %rax
+    movq  $0, %rdx
+    movq  %rdx, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+    subq  $16, %rsp
+    leaq  -48(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _init_object_byte
+    addq  $16, %rsp
+    subq  $32, %rsp
+    leaq  -48(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _assign_init
+    addq  $32, %rsp
+## if-cond
+    movl  $0, %eax
+    cmpl  $0, %eax
+    je    _LBB297_3
+## if-then
+    subq  $16, %rsp
+    leaq  -48(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _print_object
+    addq  $16, %rsp
+    jmp   _LBB297_2
+## if-else
+_LBB297_3:
+_LBB297_2:
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_global_var
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB299_2
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_extern
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB299_2
+    movl  $1, %eax
+_LBB299_2:
+    cmpl  $0, %eax
+    je    _LBB298_3
+## if-then
+## for-pre
+## assign
+    leaq  -52(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB300_1:
+    movl  -52(%rbp), %eax
+    pushq %rax
+    leaq  -48(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB300_2
+## for-body
+## local scalar init
+    leaq  -64(%rbp), %rax
+    pushq %rax
+    leaq  -48(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $32, %eax
+    pushq %rax
+    movl  -52(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -64(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    je    _LBB301_3
+## if-then
+## local scalar init
+    leaq  -72(%rbp), %rax
+    pushq %rax
+    movq  -64(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -84(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-pre
+## for-cond
+_LBB302_1:
+    movq  -72(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB302_2
+## for-body
+## local scalar init
+    leaq  -88(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -72(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _eval_const_expr__
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -92(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    notl  %eax
+    pushq %rax
+    movq  -72(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    popq  %rax
+    shll  %cl, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -92(%rbp), %rax
+    pushq %rax
+    movl  -92(%rbp), %eax
+    notl  %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## and-assign
+    leaq  -88(%rbp), %rax
+    pushq %rax
+    movl  -92(%rbp), %eax
+    popq  %rdx
+    andl  %eax, (%rdx)
+    movl  (%rdx), %eax
+## shl-assign
+    leaq  -88(%rbp), %rax
+    pushq %rax
+    movq  -72(%rbp), %rax
+    addq  $20, %rax
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    popq  %rdx
+    movl  (%rdx), %eax
+    shll  %cl, %eax
+    movl  %eax, (%rdx)
+## or-assign
+    leaq  -84(%rbp), %rax
+    pushq %rax
+    movl  -88(%rbp), %eax
+    popq  %rdx
+    orl   %eax, (%rdx)
+    movl  (%rdx), %eax
+## for-post
+_LBB302_4:
+## assign
+    leaq  -72(%rbp), %rax
+    pushq %rax
+    movq  -72(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB302_1
+_LBB302_2:
+## assign
+    leaq  -80(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $65, %eax
+    movl  %eax, 16(%rsp)
+    movl  $0, %eax
+    movq  %rax, 8(%rsp)
+    movl  $0, %eax
+    movq  %rax, (%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _new_ast_node
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -80(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -84(%rbp), %eax
+    movslq %eax, %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _set_node_ival
+    addq  $16, %rsp
+## assign
+    movq  -64(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -80(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB301_2
+## if-else
+_LBB301_3:
+_LBB301_2:
+## for-post
+_LBB300_4:
+    leaq  -52(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB300_1
+_LBB300_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  -48(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_object_byte
+    addq  $16, %rsp
+    jmp   _LBB298_2
+## if-else
+_LBB298_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_local_var
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB304_2
+    movq  -24(%rbp), %rax
+    cmpq  $0, %rax
+    movl  $0, %eax
+    je    _LBB304_2
+    movl  $1, %eax
+_LBB304_2:
+    cmpl  $0, %eax
+    je    _LBB303_3
+## if-then
+## for-pre
+## assign
+    leaq  -96(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB305_1:
+    movl  -96(%rbp), %eax
+    pushq %rax
+    leaq  -48(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB305_2
+## for-body
+## local scalar init
+    leaq  -104(%rbp), %rax
+    pushq %rax
+    leaq  -48(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $32, %eax
+    pushq %rax
+    movl  -96(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -104(%rbp), %rax
+    addq  $20, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB306_3
+## if-then
+## if-cond
+    movq  -104(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    je    _LBB307_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  -96(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  -104(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    movq  (%rsp), %rcx
+    callq _gen_init_bit_local
+    addq  $32, %rsp
+    jmp   _LBB307_2
+## if-else
+_LBB307_3:
+    subq  $48, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 40(%rsp)
+    movq  -104(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 32(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  -96(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    movq  -104(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  40(%rsp), %rdi
+    movq  32(%rsp), %rsi
+    movq  24(%rsp), %rdx
+    movl  16(%rsp), %ecx
+    movq  8(%rsp), %r8
+    callq _gen_init_scalar_local
+    addq  $48, %rsp
+_LBB307_2:
+    jmp   _LBB306_2
+## if-else
+_LBB306_3:
+_LBB306_2:
+## for-post
+_LBB305_4:
+    leaq  -96(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB305_1
+_LBB305_2:
+    jmp   _LBB303_2
+## if-else
+_LBB303_3:
+_LBB303_2:
+_LBB298_2:
+    subq  $16, %rsp
+    leaq  -48(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free_object_byte
+    addq  $16, %rsp
+_LBB296_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_gen_code:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $768, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    addq  $12, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## if-cond
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB309_3
+## if-then
+    jmp   _LBB308_0
+    jmp   _LBB309_2
+## if-else
+_LBB309_3:
+_LBB309_2:
+## assign
+    leaq  -36(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _register_from_type
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $10, %eax
+    movl  %eax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _register_from_type
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -44(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $15, %eax
+    movl  %eax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _register_from_type
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $20, %eax
+    movl  %eax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _register_from_type
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## switch-value
+    movq  -16(%rbp), %rax
+    addq  $28, %rax
+    movb  (%rax), %al
+    movzbl %al, %eax
+## begin jump table
+    cmpl  $1, %eax
+    je    _LBB310_2615
+    cmpl  $2, %eax
+    je    _LBB310_2616
+    cmpl  $13, %eax
+    je    _LBB310_2621
+    cmpl  $14, %eax
+    je    _LBB310_2622
+    cmpl  $15, %eax
+    je    _LBB310_2625
+    cmpl  $16, %eax
+    je    _LBB310_2628
+    cmpl  $17, %eax
+    je    _LBB310_2631
+    cmpl  $7, %eax
+    je    _LBB310_2634
+    cmpl  $8, %eax
+    je    _LBB310_2636
+    cmpl  $9, %eax
+    je    _LBB310_2639
+    cmpl  $10, %eax
+    je    _LBB310_2641
+    cmpl  $11, %eax
+    je    _LBB310_2642
+    cmpl  $5, %eax
+    je    _LBB310_2643
+    cmpl  $3, %eax
+    je    _LBB310_2651
+    cmpl  $4, %eax
+    je    _LBB310_2652
+    cmpl  $12, %eax
+    je    _LBB310_2653
+    cmpl  $6, %eax
+    je    _LBB310_2654
+    cmpl  $64, %eax
+    je    _LBB310_2655
+    cmpl  $70, %eax
+    je    _LBB310_2656
+    cmpl  $29, %eax
+    je    _LBB310_2657
+    cmpl  $34, %eax
+    je    _LBB310_2663
+    cmpl  $33, %eax
+    je    _LBB310_2664
+    cmpl  $18, %eax
+    je    _LBB310_2667
+    cmpl  $19, %eax
+    je    _LBB310_2674
+    cmpl  $20, %eax
+    je    _LBB310_2676
+    cmpl  $21, %eax
+    je    _LBB310_2678
+    cmpl  $22, %eax
+    je    _LBB310_2680
+    cmpl  $23, %eax
+    je    _LBB310_2682
+    cmpl  $24, %eax
+    je    _LBB310_2684
+    cmpl  $25, %eax
+    je    _LBB310_2686
+    cmpl  $26, %eax
+    je    _LBB310_2688
+    cmpl  $27, %eax
+    je    _LBB310_2690
+    cmpl  $28, %eax
+    je    _LBB310_2692
+    cmpl  $31, %eax
+    je    _LBB310_2694
+    cmpl  $30, %eax
+    je    _LBB310_2695
+    cmpl  $32, %eax
+    je    _LBB310_2696
+    cmpl  $65, %eax
+    je    _LBB310_2697
+    cmpl  $67, %eax
+    je    _LBB310_2698
+    cmpl  $66, %eax
+    je    _LBB310_2699
+    cmpl  $63, %eax
+    je    _LBB310_2700
+    cmpl  $36, %eax
+    je    _LBB310_2701
+    cmpl  $37, %eax
+    je    _LBB310_2706
+    cmpl  $38, %eax
+    je    _LBB310_2711
+    cmpl  $39, %eax
+    je    _LBB310_2716
+    cmpl  $40, %eax
+    je    _LBB310_2721
+    cmpl  $41, %eax
+    je    _LBB310_2722
+    cmpl  $42, %eax
+    je    _LBB310_2723
+    cmpl  $43, %eax
+    je    _LBB310_2724
+    cmpl  $44, %eax
+    je    _LBB310_2725
+    cmpl  $45, %eax
+    je    _LBB310_2726
+    cmpl  $46, %eax
+    je    _LBB310_2727
+    cmpl  $54, %eax
+    je    _LBB310_2728
+    cmpl  $55, %eax
+    je    _LBB310_2730
+    cmpl  $56, %eax
+    je    _LBB310_2733
+    cmpl  $57, %eax
+    je    _LBB310_2734
+    cmpl  $58, %eax
+    je    _LBB310_2735
+    cmpl  $53, %eax
+    je    _LBB310_2736
+    cmpl  $59, %eax
+    je    _LBB310_2737
+    cmpl  $60, %eax
+    je    _LBB310_2738
+    cmpl  $61, %eax
+    je    _LBB310_2739
+    cmpl  $62, %eax
+    je    _LBB310_2740
+    cmpl  $47, %eax
+    je    _LBB310_2741
+    cmpl  $48, %eax
+    je    _LBB310_2747
+    cmpl  $49, %eax
+    je    _LBB310_2753
+    cmpl  $50, %eax
+    je    _LBB310_2759
+    cmpl  $51, %eax
+    je    _LBB310_2765
+    cmpl  $52, %eax
+    je    _LBB310_2771
+    jmp   _LBB310_2777
+    jmp   _LBB310_2
+## end jump table
+_LBB310_2615:
+_LBB310_2616:
+    subq  $16, %rsp
+    leaq  -592(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _begin_ast_walk
+    addq  $16, %rsp
+## while-cond
+_LBB311_4:
+## assign
+    leaq  -600(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    leaq  -592(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _next_ast_list_item
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB311_2
+## while-body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -600(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    jmp   _LBB311_4
+_LBB311_2:
+    subq  $16, %rsp
+    leaq  -592(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _end_ast_walk
+    addq  $16, %rsp
+    jmp   _LBB310_2
+_LBB310_2621:
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    leaq  _scope_2506(%rip), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+## assign
+    leaq  _scope_2506(%rip), %rax
+    addq  $0, %rax
+    pushq %rax
+    leaq  _next_scope_2508(%rip), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  _scope_2506(%rip), %rax
+    addq  $4, %rax
+    pushq %rax
+    leaq  _scope_2506(%rip), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  _scope_2506(%rip), %rax
+    addq  $8, %rax
+    pushq %rax
+    leaq  _scope_2506(%rip), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+## assign
+    leaq  _scope_2506(%rip), %rax
+    pushq %rax
+    leaq  -32(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    jmp   _LBB310_2
+_LBB310_2622:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2523(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_comment
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2524(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_comment
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _scope_2506(%rip), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, 16(%rsp)
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _gen_label
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_compare_to_zero
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $30, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    leaq  _scope_2506(%rip), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, 8(%rsp)
+    movl  $2, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _make_label
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    jmp   _LBB310_2
+_LBB310_2625:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2526(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_comment
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2527(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_comment
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _scope_2506(%rip), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, 16(%rsp)
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _gen_label
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $32, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    leaq  _scope_2506(%rip), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, 8(%rsp)
+    movl  $1, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _make_label
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _scope_2506(%rip), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, 16(%rsp)
+    movl  $2, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _gen_label
+    addq  $32, %rsp
+    jmp   _LBB310_2
+_LBB310_2628:
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    leaq  _scope_2506(%rip), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+## assign
+    leaq  _scope_2506(%rip), %rax
+    addq  $0, %rax
+    pushq %rax
+    leaq  _next_scope_2508(%rip), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  _scope_2506(%rip), %rax
+    addq  $4, %rax
+    pushq %rax
+    leaq  _scope_2506(%rip), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  _scope_2506(%rip), %rax
+    addq  $8, %rax
+    pushq %rax
+    leaq  _scope_2506(%rip), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2529(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_comment
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _scope_2506(%rip), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, 16(%rsp)
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _gen_label
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_compare_to_zero
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $30, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    leaq  _scope_2506(%rip), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, 8(%rsp)
+    movl  $2, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _make_label
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2530(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_comment
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $32, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    leaq  _scope_2506(%rip), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, 8(%rsp)
+    movl  $4, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _make_label
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _scope_2506(%rip), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, 16(%rsp)
+    movl  $2, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _gen_label
+    addq  $32, %rsp
+## assign
+    leaq  _scope_2506(%rip), %rax
+    pushq %rax
+    leaq  -32(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    jmp   _LBB310_2
+_LBB310_2631:
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    leaq  _scope_2506(%rip), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+## assign
+    leaq  _scope_2506(%rip), %rax
+    addq  $0, %rax
+    pushq %rax
+    leaq  _next_scope_2508(%rip), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  _scope_2506(%rip), %rax
+    addq  $4, %rax
+    pushq %rax
+    leaq  _scope_2506(%rip), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  _scope_2506(%rip), %rax
+    addq  $8, %rax
+    pushq %rax
+    leaq  _scope_2506(%rip), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2532(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_comment
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _scope_2506(%rip), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, 16(%rsp)
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _gen_label
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2533(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_comment
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _scope_2506(%rip), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, 16(%rsp)
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _gen_label
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_compare_to_zero
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $30, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    leaq  _scope_2506(%rip), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, 8(%rsp)
+    movl  $2, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _make_label
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $32, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    leaq  _scope_2506(%rip), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, 8(%rsp)
+    movl  $1, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _make_label
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _scope_2506(%rip), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, 16(%rsp)
+    movl  $2, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _gen_label
+    addq  $32, %rsp
+## assign
+    leaq  _scope_2506(%rip), %rax
+    pushq %rax
+    leaq  -32(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    jmp   _LBB310_2
+_LBB310_2634:
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    leaq  _scope_2506(%rip), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+## assign
+    leaq  _scope_2506(%rip), %rax
+    addq  $0, %rax
+    pushq %rax
+    leaq  _next_scope_2508(%rip), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2535(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_comment
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_compare_to_zero
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $30, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    leaq  _scope_2506(%rip), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, 8(%rsp)
+    movl  $3, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _make_label
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+## assign
+    leaq  _scope_2506(%rip), %rax
+    pushq %rax
+    leaq  -32(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    jmp   _LBB310_2
+_LBB310_2636:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2537(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_comment
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $32, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    leaq  _scope_2506(%rip), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, 8(%rsp)
+    movl  $2, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _make_label
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2538(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_comment
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _scope_2506(%rip), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, 16(%rsp)
+    movl  $3, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _gen_label
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _scope_2506(%rip), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, 16(%rsp)
+    movl  $2, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _gen_label
+    addq  $32, %rsp
+    jmp   _LBB310_2
+_LBB310_2639:
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    leaq  _scope_2506(%rip), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+## assign
+    leaq  _scope_2506(%rip), %rax
+    addq  $0, %rax
+    pushq %rax
+    leaq  _next_scope_2508(%rip), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  _scope_2506(%rip), %rax
+    addq  $4, %rax
+    pushq %rax
+    leaq  _scope_2506(%rip), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2540(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_comment
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    leaq  _scope_2506(%rip), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _gen_switch_table
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _scope_2506(%rip), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, 16(%rsp)
+    movl  $2, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _gen_label
+    addq  $32, %rsp
+## assign
+    leaq  _scope_2506(%rip), %rax
+    pushq %rax
+    leaq  -32(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    jmp   _LBB310_2
+_LBB310_2641:
+_LBB310_2642:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _scope_2506(%rip), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _jump_id
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _gen_label
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    jmp   _LBB310_2
+_LBB310_2643:
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    cmpq  $0, %rax
+    je    _LBB312_3
+## if-then
+## local scalar init
+    leaq  -608(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _node_l
+    addq  $8, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+## if-cond
+    subq  $16, %rsp
+    movq  -608(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_medium_object
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB313_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movl  $29, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  $29, %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  $4, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  $29, %eax
+    movl  %eax, 8(%rsp)
+    movl  $8, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  $19, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB313_2
+## if-else
+_LBB313_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -608(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_large_object
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB314_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $27, %eax
+    movl  %eax, 16(%rsp)
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -608(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _gen_copy_large_object
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    movl  $4, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB314_2
+## if-else
+_LBB314_3:
+_LBB314_2:
+_LBB313_2:
+    jmp   _LBB312_2
+## if-else
+_LBB312_3:
+_LBB312_2:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $32, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    leaq  _scope_2506(%rip), %rax
+    addq  $12, %rax
+    movl  (%rax), %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _make_label
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    jmp   _LBB310_2
+_LBB310_2651:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $32, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    leaq  _scope_2506(%rip), %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    movl  %eax, 8(%rsp)
+    movl  $2, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _make_label
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    jmp   _LBB310_2
+_LBB310_2652:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $32, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    leaq  _scope_2506(%rip), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    movl  %eax, 8(%rsp)
+    movl  $4, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _make_label
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    jmp   _LBB310_2
+_LBB310_2653:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _scope_2506(%rip), %rax
+    addq  $12, %rax
+    movl  (%rax), %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _jump_id
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _gen_label
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    jmp   _LBB310_2
+_LBB310_2654:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $32, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    leaq  _scope_2506(%rip), %rax
+    addq  $12, %rax
+    movl  (%rax), %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _jump_id
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _make_label
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    jmp   _LBB310_2
+_LBB310_2655:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_ident
+    addq  $16, %rsp
+    jmp   _LBB310_2
+_LBB310_2656:
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_local_var
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB316_2
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    cmpq  $0, %rax
+    movl  $0, %eax
+    je    _LBB316_2
+    movl  $1, %eax
+_LBB316_2:
+    cmpl  $0, %eax
+    je    _LBB315_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _gen_initializer
+    addq  $32, %rsp
+    jmp   _LBB315_2
+## if-else
+_LBB315_3:
+_LBB315_2:
+    jmp   _LBB310_2
+_LBB310_2657:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_address
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _gen_load_to_a
+    addq  $32, %rsp
+## if-cond
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_bitfield
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB317_3
+## if-then
+## local scalar init
+    leaq  -616(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _node_r
+    addq  $8, %rsp
+    addq  $8, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -620(%rbp), %rax
+    pushq %rax
+    movl  $32, %eax
+    pushq %rax
+    movq  -616(%rbp), %rax
+    addq  $92, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, %edx
+    popq  %rax
+    subl  %edx, %eax
+    pushq %rax
+    movq  -616(%rbp), %rax
+    addq  $91, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, %edx
+    popq  %rax
+    subl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -624(%rbp), %rax
+    pushq %rax
+    movl  $32, %eax
+    pushq %rax
+    movq  -616(%rbp), %rax
+    addq  $92, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, %edx
+    popq  %rax
+    subl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $11, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  -620(%rbp), %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _imm
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  $3, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_unsigned
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB318_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $12, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  -624(%rbp), %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _imm
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  $3, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB318_2
+## if-else
+_LBB318_3:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $13, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  -624(%rbp), %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _imm
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  $3, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+_LBB318_2:
+    jmp   _LBB317_2
+## if-else
+_LBB317_3:
+_LBB317_2:
+    jmp   _LBB310_2
+_LBB310_2663:
+## if-cond
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_builtin
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB319_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_func_call_builtin
+    addq  $16, %rsp
+    jmp   _LBB319_2
+## if-else
+_LBB319_3:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_func_call
+    addq  $16, %rsp
+_LBB319_2:
+    jmp   _LBB310_2
+_LBB310_2664:
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    leaq  _scope_2506(%rip), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+## assign
+    leaq  _scope_2506(%rip), %rax
+    addq  $0, %rax
+    pushq %rax
+    leaq  _next_scope_2508(%rip), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  _scope_2506(%rip), %rax
+    addq  $12, %rax
+    pushq %rax
+    leaq  _scope_2506(%rip), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _set_local_area_offset
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_func_prologue
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2565(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_comment
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_func_param_list
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2566(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_comment
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_func_body
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _scope_2506(%rip), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, 16(%rsp)
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _gen_label
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_func_epilogue
+    addq  $16, %rsp
+## assign
+    leaq  _scope_2506(%rip), %rax
+    pushq %rax
+    leaq  -32(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    jmp   _LBB310_2
+_LBB310_2667:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2568(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_comment
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_address
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $26, %eax
+    movl  %eax, 16(%rsp)
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $27, %eax
+    movl  %eax, 16(%rsp)
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    addq  $28, %rax
+    movb  (%rax), %al
+    movzbl %al, %eax
+    pushq %rax
+    movl  $29, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB321_2
+    subq  $16, %rsp
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_bitfield
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB321_2
+    movl  $1, %eax
+_LBB321_2:
+    cmpl  $0, %eax
+    je    _LBB320_3
+## if-then
+## local scalar init
+    leaq  -632(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _node_r
+    addq  $8, %rsp
+    addq  $8, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -636(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    notl  %eax
+    pushq %rax
+    movq  -632(%rbp), %rax
+    addq  $92, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $1, %eax
+    movl  %eax, %edx
+    popq  %rax
+    subl  %edx, %eax
+    movl  %eax, %ecx
+    popq  %rax
+    shll  %cl, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -636(%rbp), %rax
+    pushq %rax
+    movl  -636(%rbp), %eax
+    notl  %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## shl-assign
+    leaq  -636(%rbp), %rax
+    pushq %rax
+    movq  -632(%rbp), %rax
+    addq  $91, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, %ecx
+    popq  %rdx
+    movl  (%rdx), %eax
+    shll  %cl, %eax
+    movl  %eax, (%rdx)
+## assign
+    leaq  -636(%rbp), %rax
+    pushq %rax
+    movl  -636(%rbp), %eax
+    notl  %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2572(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_comment
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movl  $3, %eax
+    movl  %eax, 8(%rsp)
+    movl  $13, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movl  $13, %eax
+    movl  %eax, 8(%rsp)
+    movl  $53, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $11, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -632(%rbp), %rax
+    addq  $91, %rax
+    movb  (%rax), %al
+    movsbq %al, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _imm
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  $13, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  $3, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $16, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  -636(%rbp), %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _imm
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  $3, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $14, %eax
+    movl  %eax, 16(%rsp)
+    movl  $13, %eax
+    movl  %eax, 8(%rsp)
+    movl  $3, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movl  $3, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movl  $53, %eax
+    movl  %eax, 8(%rsp)
+    movl  $3, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB310_2
+    jmp   _LBB320_2
+## if-else
+_LBB320_3:
+_LBB320_2:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _gen_store_a
+    addq  $32, %rsp
+    jmp   _LBB310_2
+_LBB310_2674:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2575(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_comment
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_address
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $26, %eax
+    movl  %eax, 16(%rsp)
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $27, %eax
+    movl  %eax, 16(%rsp)
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $6, %eax
+    movl  %eax, 16(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB310_2
+_LBB310_2676:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2577(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_comment
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_address
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $26, %eax
+    movl  %eax, 16(%rsp)
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $27, %eax
+    movl  %eax, 16(%rsp)
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $7, %eax
+    movl  %eax, 16(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB310_2
+_LBB310_2678:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2579(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_comment
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_address
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $26, %eax
+    movl  %eax, 16(%rsp)
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $27, %eax
+    movl  %eax, 16(%rsp)
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $8, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB310_2
+_LBB310_2680:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2581(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_comment
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_address
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $26, %eax
+    movl  %eax, 16(%rsp)
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -48(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $27, %eax
+    movl  %eax, 16(%rsp)
+    movl  $29, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  $29, %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  $20, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _gen_div
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movl  $29, %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB310_2
+_LBB310_2682:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2583(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_comment
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_address
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $26, %eax
+    movl  %eax, 16(%rsp)
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -48(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $27, %eax
+    movl  %eax, 16(%rsp)
+    movl  $29, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  $29, %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  $20, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _gen_div
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movl  -44(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movl  $29, %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB310_2
+_LBB310_2684:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2585(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_comment
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_address
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $26, %eax
+    movl  %eax, 16(%rsp)
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -40(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $27, %eax
+    movl  %eax, 16(%rsp)
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $11, %eax
+    movl  %eax, 16(%rsp)
+    movl  $11, %eax
+    movl  %eax, 8(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB310_2
+_LBB310_2686:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2587(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_comment
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_address
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $26, %eax
+    movl  %eax, 16(%rsp)
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -40(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $27, %eax
+    movl  %eax, 16(%rsp)
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_unsigned
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB322_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $12, %eax
+    movl  %eax, 16(%rsp)
+    movl  $11, %eax
+    movl  %eax, 8(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB322_2
+## if-else
+_LBB322_3:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $13, %eax
+    movl  %eax, 16(%rsp)
+    movl  $11, %eax
+    movl  %eax, 8(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+_LBB322_2:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB310_2
+_LBB310_2688:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2589(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_comment
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_address
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $26, %eax
+    movl  %eax, 16(%rsp)
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $27, %eax
+    movl  %eax, 16(%rsp)
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $14, %eax
+    movl  %eax, 16(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB310_2
+_LBB310_2690:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2591(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_comment
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_address
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $26, %eax
+    movl  %eax, 16(%rsp)
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $27, %eax
+    movl  %eax, 16(%rsp)
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $15, %eax
+    movl  %eax, 16(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB310_2
+_LBB310_2692:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2593(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_comment
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_address
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $26, %eax
+    movl  %eax, 16(%rsp)
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $27, %eax
+    movl  %eax, 16(%rsp)
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $16, %eax
+    movl  %eax, 16(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _mem
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB310_2
+_LBB310_2694:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_address
+    addq  $16, %rsp
+    jmp   _LBB310_2
+_LBB310_2695:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _gen_convert_a
+    addq  $32, %rsp
+    jmp   _LBB310_2
+_LBB310_2696:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _gen_load_to_a
+    addq  $32, %rsp
+    jmp   _LBB310_2
+_LBB310_2697:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_ival
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _imm
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB310_2
+_LBB310_2698:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $25, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  _STR_LIT_NAME_PREFIX_1445(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _symb
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  $4, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB310_2
+_LBB310_2699:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $19, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  _FP_LIT_NAME_PREFIX_1447(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _symb
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  $84, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB310_2
+_LBB310_2700:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _get_size
+    addq  $16, %rsp
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _imm
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  $3, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB310_2
+_LBB310_2701:
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_fpnum
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB323_3
+## if-then
+## local scalar init
+    leaq  -640(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $80, %eax
+    movl  %eax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _register_from_type
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -644(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $85, %eax
+    movl  %eax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _register_from_type
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movl  -640(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _gen_push_a
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movl  -644(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _gen_pop_to
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $20, %eax
+    movl  %eax, 16(%rsp)
+    movl  -644(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -640(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB310_2
+    jmp   _LBB323_2
+## if-else
+_LBB323_3:
+_LBB323_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $26, %eax
+    movl  %eax, 16(%rsp)
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $27, %eax
+    movl  %eax, 16(%rsp)
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $6, %eax
+    movl  %eax, 16(%rsp)
+    movl  -44(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB310_2
+_LBB310_2706:
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_fpnum
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB324_3
+## if-then
+## local scalar init
+    leaq  -648(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $80, %eax
+    movl  %eax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _register_from_type
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -652(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $85, %eax
+    movl  %eax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _register_from_type
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movl  -648(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _gen_push_a
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $19, %eax
+    movl  %eax, 16(%rsp)
+    movl  -648(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -652(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movl  -648(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _gen_pop_to
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $21, %eax
+    movl  %eax, 16(%rsp)
+    movl  -652(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -648(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB310_2
+    jmp   _LBB324_2
+## if-else
+_LBB324_3:
+_LBB324_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $26, %eax
+    movl  %eax, 16(%rsp)
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -44(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $27, %eax
+    movl  %eax, 16(%rsp)
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $7, %eax
+    movl  %eax, 16(%rsp)
+    movl  -44(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB310_2
+_LBB310_2711:
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_fpnum
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB325_3
+## if-then
+## local scalar init
+    leaq  -656(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $80, %eax
+    movl  %eax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _register_from_type
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -660(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $85, %eax
+    movl  %eax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _register_from_type
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movl  -656(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _gen_push_a
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movl  -660(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _gen_pop_to
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $22, %eax
+    movl  %eax, 16(%rsp)
+    movl  -660(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -656(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB310_2
+    jmp   _LBB325_2
+## if-else
+_LBB325_3:
+_LBB325_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $26, %eax
+    movl  %eax, 16(%rsp)
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $27, %eax
+    movl  %eax, 16(%rsp)
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $8, %eax
+    movl  %eax, 16(%rsp)
+    movl  -44(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB310_2
+_LBB310_2716:
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_fpnum
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB326_3
+## if-then
+## local scalar init
+    leaq  -664(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $80, %eax
+    movl  %eax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _register_from_type
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -668(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $85, %eax
+    movl  %eax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _register_from_type
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movl  -664(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _gen_push_a
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $19, %eax
+    movl  %eax, 16(%rsp)
+    movl  -664(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -668(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movl  -664(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _gen_pop_to
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $23, %eax
+    movl  %eax, 16(%rsp)
+    movl  -668(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -664(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB310_2
+    jmp   _LBB326_2
+## if-else
+_LBB326_3:
+_LBB326_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $26, %eax
+    movl  %eax, 16(%rsp)
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -48(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $27, %eax
+    movl  %eax, 16(%rsp)
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  $20, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _gen_div
+    addq  $32, %rsp
+    jmp   _LBB310_2
+_LBB310_2721:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $26, %eax
+    movl  %eax, 16(%rsp)
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -48(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $27, %eax
+    movl  %eax, 16(%rsp)
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  $20, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _gen_div
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movl  -44(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB310_2
+_LBB310_2722:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $26, %eax
+    movl  %eax, 16(%rsp)
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -40(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $27, %eax
+    movl  %eax, 16(%rsp)
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $11, %eax
+    movl  %eax, 16(%rsp)
+    movl  $11, %eax
+    movl  %eax, 8(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB310_2
+_LBB310_2723:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $26, %eax
+    movl  %eax, 16(%rsp)
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -40(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $27, %eax
+    movl  %eax, 16(%rsp)
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_unsigned
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB327_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $12, %eax
+    movl  %eax, 16(%rsp)
+    movl  $11, %eax
+    movl  %eax, 8(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB327_2
+## if-else
+_LBB327_3:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $13, %eax
+    movl  %eax, 16(%rsp)
+    movl  $11, %eax
+    movl  %eax, 8(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+_LBB327_2:
+    jmp   _LBB310_2
+_LBB310_2724:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $26, %eax
+    movl  %eax, 16(%rsp)
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $27, %eax
+    movl  %eax, 16(%rsp)
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $14, %eax
+    movl  %eax, 16(%rsp)
+    movl  -44(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB310_2
+_LBB310_2725:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $26, %eax
+    movl  %eax, 16(%rsp)
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $27, %eax
+    movl  %eax, 16(%rsp)
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $15, %eax
+    movl  %eax, 16(%rsp)
+    movl  -44(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB310_2
+_LBB310_2726:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $26, %eax
+    movl  %eax, 16(%rsp)
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $27, %eax
+    movl  %eax, 16(%rsp)
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $16, %eax
+    movl  %eax, 16(%rsp)
+    movl  -44(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB310_2
+_LBB310_2727:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $17, %eax
+    movl  %eax, 16(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    jmp   _LBB310_2
+_LBB310_2728:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2629(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_comment
+    addq  $16, %rsp
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    leaq  _scope_2506(%rip), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+## assign
+    leaq  _scope_2506(%rip), %rax
+    addq  $0, %rax
+    pushq %rax
+    leaq  _next_scope_2508(%rip), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $18, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  $0, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _imm
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $30, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    leaq  _scope_2506(%rip), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, 8(%rsp)
+    movl  $3, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _make_label
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+## assign
+    leaq  _scope_2506(%rip), %rax
+    pushq %rax
+    leaq  -32(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    jmp   _LBB310_2
+_LBB310_2730:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2631(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_comment
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $32, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    leaq  _scope_2506(%rip), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, 8(%rsp)
+    movl  $2, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _make_label
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2632(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_comment
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _scope_2506(%rip), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, 16(%rsp)
+    movl  $3, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _gen_label
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _scope_2506(%rip), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, 16(%rsp)
+    movl  $2, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _gen_label
+    addq  $32, %rsp
+    jmp   _LBB310_2
+_LBB310_2733:
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    leaq  _scope_2506(%rip), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+## assign
+    leaq  _scope_2506(%rip), %rax
+    addq  $0, %rax
+    pushq %rax
+    leaq  _next_scope_2508(%rip), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_compare_to_zero
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  $1, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _imm
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  $3, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $31, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    leaq  _scope_2506(%rip), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, 8(%rsp)
+    movl  $2, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _make_label
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_compare_to_zero
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  $1, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _imm
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  $3, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $31, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    leaq  _scope_2506(%rip), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, 8(%rsp)
+    movl  $2, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _make_label
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  $0, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _imm
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  $3, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _scope_2506(%rip), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, 16(%rsp)
+    movl  $2, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _gen_label
+    addq  $32, %rsp
+## assign
+    leaq  _scope_2506(%rip), %rax
+    pushq %rax
+    leaq  -32(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    jmp   _LBB310_2
+_LBB310_2734:
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    leaq  _scope_2506(%rip), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+## assign
+    leaq  _scope_2506(%rip), %rax
+    addq  $0, %rax
+    pushq %rax
+    leaq  _next_scope_2508(%rip), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_compare_to_zero
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  $0, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _imm
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  $3, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $30, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    leaq  _scope_2506(%rip), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, 8(%rsp)
+    movl  $2, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _make_label
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_compare_to_zero
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  $0, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _imm
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  $3, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $30, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    leaq  _scope_2506(%rip), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, 8(%rsp)
+    movl  $2, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _make_label
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  $1, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _imm
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  $3, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _scope_2506(%rip), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, 16(%rsp)
+    movl  $2, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _gen_label
+    addq  $32, %rsp
+## assign
+    leaq  _scope_2506(%rip), %rax
+    pushq %rax
+    leaq  -32(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    jmp   _LBB310_2
+_LBB310_2735:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_compare_to_zero
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $33, %eax
+    movl  %eax, 16(%rsp)
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $4, %eax
+    movl  %eax, 16(%rsp)
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB310_2
+_LBB310_2736:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    jmp   _LBB310_2
+_LBB310_2737:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  $6, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _gen_preincdec
+    addq  $32, %rsp
+    jmp   _LBB310_2
+_LBB310_2738:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  $7, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _gen_preincdec
+    addq  $32, %rsp
+    jmp   _LBB310_2
+_LBB310_2739:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  $6, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _gen_postincdec
+    addq  $32, %rsp
+    jmp   _LBB310_2
+_LBB310_2740:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  $7, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _gen_postincdec
+    addq  $32, %rsp
+    jmp   _LBB310_2
+_LBB310_2741:
+## if-cond
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_fpnum
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB328_3
+## if-then
+## local scalar init
+    leaq  -680(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _node_l
+    addq  $8, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -684(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $80, %eax
+    movl  %eax, 16(%rsp)
+    movq  -680(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _register_from_type
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -688(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $85, %eax
+    movl  %eax, 16(%rsp)
+    movq  -680(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _register_from_type
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -680(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  -684(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _gen_push_a
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $19, %eax
+    movl  %eax, 16(%rsp)
+    movl  -684(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -688(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -680(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  -684(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _gen_pop_to
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $24, %eax
+    movl  %eax, 16(%rsp)
+    movl  -684(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -688(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $39, %eax
+    movl  %eax, 16(%rsp)
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $16, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  $1, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _imm
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  $1, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $4, %eax
+    movl  %eax, 16(%rsp)
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movl  $3, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB310_2
+    jmp   _LBB328_2
+## if-else
+_LBB328_3:
+_LBB328_2:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  $35, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _gen_relational
+    addq  $32, %rsp
+    jmp   _LBB310_2
+_LBB310_2747:
+## if-cond
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_fpnum
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB329_3
+## if-then
+## local scalar init
+    leaq  -696(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _node_l
+    addq  $8, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -700(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $80, %eax
+    movl  %eax, 16(%rsp)
+    movq  -696(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _register_from_type
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -704(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $85, %eax
+    movl  %eax, 16(%rsp)
+    movq  -696(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _register_from_type
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -696(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  -700(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _gen_push_a
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $19, %eax
+    movl  %eax, 16(%rsp)
+    movl  -700(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -704(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -696(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  -700(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _gen_pop_to
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $24, %eax
+    movl  %eax, 16(%rsp)
+    movl  -700(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -704(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $40, %eax
+    movl  %eax, 16(%rsp)
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $16, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  $1, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _imm
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  $1, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $4, %eax
+    movl  %eax, 16(%rsp)
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movl  $3, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB310_2
+    jmp   _LBB329_2
+## if-else
+_LBB329_3:
+_LBB329_2:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  $36, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _gen_relational
+    addq  $32, %rsp
+    jmp   _LBB310_2
+_LBB310_2753:
+## if-cond
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_fpnum
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB330_3
+## if-then
+## local scalar init
+    leaq  -712(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _node_l
+    addq  $8, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -716(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $80, %eax
+    movl  %eax, 16(%rsp)
+    movq  -712(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _register_from_type
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -720(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $85, %eax
+    movl  %eax, 16(%rsp)
+    movq  -712(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _register_from_type
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -712(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  -716(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _gen_push_a
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $19, %eax
+    movl  %eax, 16(%rsp)
+    movl  -716(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -720(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -712(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  -716(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _gen_pop_to
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $24, %eax
+    movl  %eax, 16(%rsp)
+    movl  -716(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -720(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $41, %eax
+    movl  %eax, 16(%rsp)
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $16, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  $1, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _imm
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  $1, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $4, %eax
+    movl  %eax, 16(%rsp)
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movl  $3, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB310_2
+    jmp   _LBB330_2
+## if-else
+_LBB330_3:
+_LBB330_2:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  $37, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _gen_relational
+    addq  $32, %rsp
+    jmp   _LBB310_2
+_LBB310_2759:
+## if-cond
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_fpnum
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB331_3
+## if-then
+## local scalar init
+    leaq  -728(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _node_l
+    addq  $8, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -732(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $80, %eax
+    movl  %eax, 16(%rsp)
+    movq  -728(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _register_from_type
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -736(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $85, %eax
+    movl  %eax, 16(%rsp)
+    movq  -728(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _register_from_type
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -728(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  -732(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _gen_push_a
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $19, %eax
+    movl  %eax, 16(%rsp)
+    movl  -732(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -736(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -728(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  -732(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _gen_pop_to
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $24, %eax
+    movl  %eax, 16(%rsp)
+    movl  -732(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -736(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $42, %eax
+    movl  %eax, 16(%rsp)
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $16, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  $1, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _imm
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  $1, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $4, %eax
+    movl  %eax, 16(%rsp)
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movl  $3, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB310_2
+    jmp   _LBB331_2
+## if-else
+_LBB331_3:
+_LBB331_2:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  $38, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _gen_relational
+    addq  $32, %rsp
+    jmp   _LBB310_2
+_LBB310_2765:
+## if-cond
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_fpnum
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB332_3
+## if-then
+## local scalar init
+    leaq  -744(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _node_l
+    addq  $8, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -748(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $80, %eax
+    movl  %eax, 16(%rsp)
+    movq  -744(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _register_from_type
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -752(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $85, %eax
+    movl  %eax, 16(%rsp)
+    movq  -744(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _register_from_type
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -744(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  -748(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _gen_push_a
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $19, %eax
+    movl  %eax, 16(%rsp)
+    movl  -748(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -752(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -744(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  -748(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _gen_pop_to
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $24, %eax
+    movl  %eax, 16(%rsp)
+    movl  -748(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -752(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $33, %eax
+    movl  %eax, 16(%rsp)
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $16, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  $1, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _imm
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  $1, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $4, %eax
+    movl  %eax, 16(%rsp)
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movl  $3, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB310_2
+    jmp   _LBB332_2
+## if-else
+_LBB332_3:
+_LBB332_2:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  $33, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _gen_equality
+    addq  $32, %rsp
+    jmp   _LBB310_2
+_LBB310_2771:
+## if-cond
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_fpnum
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB333_3
+## if-then
+## local scalar init
+    leaq  -760(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _node_l
+    addq  $8, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -764(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $80, %eax
+    movl  %eax, 16(%rsp)
+    movq  -760(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _register_from_type
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -768(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $85, %eax
+    movl  %eax, 16(%rsp)
+    movq  -760(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _register_from_type
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -760(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  -764(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _gen_push_a
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $19, %eax
+    movl  %eax, 16(%rsp)
+    movl  -764(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -768(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -760(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  -764(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _gen_pop_to
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $24, %eax
+    movl  %eax, 16(%rsp)
+    movl  -764(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -768(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $34, %eax
+    movl  %eax, 16(%rsp)
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _code2
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $16, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movl  $1, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _imm
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  $1, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $4, %eax
+    movl  %eax, 16(%rsp)
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movl  $3, %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _code3
+    addq  $32, %rsp
+    jmp   _LBB310_2
+    jmp   _LBB333_2
+## if-else
+_LBB333_3:
+_LBB333_2:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  $34, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _gen_equality
+    addq  $32, %rsp
+    jmp   _LBB310_2
+_LBB310_2777:
+    jmp   _LBB310_2
+_LBB310_2:
+_LBB308_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_gen_global_vars:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $576, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+    subq  $16, %rsp
+    leaq  -560(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _begin_ast_walk
+    addq  $16, %rsp
+## while-cond
+_LBB335_4:
+## assign
+    leaq  -568(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    leaq  -560(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _next_ast_node
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB335_2
+## while-body
+## if-cond
+    movq  -568(%rbp), %rax
+    addq  $28, %rax
+    movb  (%rax), %al
+    movzbl %al, %eax
+    pushq %rax
+    movl  $70, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB336_3
+## if-then
+## if-cond
+    subq  $16, %rsp
+    movq  -568(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_global_var
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB337_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -568(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -568(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _gen_initializer
+    addq  $32, %rsp
+    jmp   _LBB337_2
+## if-else
+_LBB337_3:
+_LBB337_2:
+    subq  $16, %rsp
+    leaq  -560(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _skip_ast_children
+    addq  $16, %rsp
+    jmp   _LBB336_2
+## if-else
+_LBB336_3:
+_LBB336_2:
+    jmp   _LBB335_4
+_LBB335_2:
+    subq  $16, %rsp
+    leaq  -560(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _end_ast_walk
+    addq  $16, %rsp
+_LBB334_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_gen_string_literal:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## for-pre
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB339_1:
+    movq  -24(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB339_2
+## for-body
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_string_literal
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB340_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _gen_string_literal_name
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1934(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2703(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _print_string_literal
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2704(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    jmp   _LBB340_2
+## if-else
+_LBB340_3:
+_LBB340_2:
+## for-post
+_LBB339_4:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    addq  $40, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB339_1
+_LBB339_2:
+_LBB338_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_gen_fpnum_literal:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## for-pre
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB342_1:
+    movq  -24(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB342_2
+## for-body
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_fpnum_literal
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB343_3
+## if-then
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movl  $0, %eax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _strtod
+    addq  $24, %rsp
+    popq  %rdx
+    movsd %xmm0, (%rdx)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    leaq  -32(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _gen_fpnum_literal_name
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1934(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_2719(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  -40(%rbp), %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1417(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    jmp   _LBB343_2
+## if-else
+_LBB343_3:
+_LBB343_2:
+## for-post
+_LBB342_4:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    addq  $40, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB342_1
+_LBB342_2:
+_LBB341_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _gen_x64
+_gen_x64:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movq  %rdx, -24(%rbp)
+## func body
+## if-cond
+    movl  _att_syntax_1004(%rip), %eax
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB345_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2730(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    jmp   _LBB345_2
+## if-else
+_LBB345_3:
+_LBB345_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2731(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_global_vars
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2732(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_string_literal
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_fpnum_literal
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _gen_code
+    addq  $16, %rsp
+_LBB344_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
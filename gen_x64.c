@@ -433,6 +433,17 @@ static int opsize(const struct data_type *type)
         return I64;
     if (is_enum(type))
         return I32;
+    /* small struct objects are moved with a register of their size
+     * so that the bytes next to them are not overwritten. the ones of
+     * other sizes are moved in pieces */
+    if (is_struct_or_union(type)) {
+        switch (get_size(type)) {
+        case 1: return I8;
+        case 2: return I16;
+        case 4: return I32;
+        default: break;
+        }
+    }
     return I64;
 }
 
@@ -491,6 +502,88 @@ static int is_large_object(const struct data_type *type)
     return get_size(type) > 16;
 }
 
+/* small struct objects of 3, 5, 6 or 7 bytes have no register of their
+ * size. they are moved in pieces of 4, 2 and 1 bytes */
+static int is_odd_size_object(const struct data_type *type)
+{
+    const int size = get_size(type);
+
+    if (!is_struct_or_union(type))
+        return 0;
+    return size == 3 || size == 5 || size == 6 || size == 7;
+}
+
+static int piece_size(int rest)
+{
+    if (rest >= 8)
+        return 8;
+    if (rest >= 4)
+        return 4;
+    if (rest >= 2)
+        return 2;
+    return 1;
+}
+
+static int piece_opsize(int piece)
+{
+    switch (piece) {
+    case 1: return I8;
+    case 2: return I16;
+    case 4: return I32;
+    default: return I64;
+    }
+}
+
+/* stores the low bytes of reg to memory without touching the bytes after
+ * them. reg is given without size such as A_ */
+static void gen_store_pieces(FILE *fp, int size, enum operand reg,
+        enum operand addr, int offset)
+{
+    int disp = 0;
+
+    if (piece_size(size) == size) {
+        code3(fp, MOV, regi(reg, piece_opsize(size)), mem(addr, offset));
+        return;
+    }
+
+    code3(fp, MOV, regi(reg, I64), R11);
+    for (;;) {
+        const int piece = piece_size(size - disp);
+
+        code3(fp, MOV, regi(R11_, piece_opsize(piece)), mem(addr, offset + disp));
+        disp += piece;
+        if (disp == size)
+            break;
+        code3(fp, SHR, imm(8 * piece), R11);
+    }
+}
+
+/* loads the bytes of an odd size object to rax without reading the bytes
+ * after them */
+static void gen_load_pieces(FILE *fp, int size, enum operand addr, int offset)
+{
+    int disp = 0;
+
+    while (disp < size) {
+        const int piece = piece_size(size - disp);
+        const enum operand dst = disp == 0 ? R11D : R10D;
+
+        if (piece == 4)
+            code3(fp, MOV, mem(addr, offset + disp), dst);
+        else if (piece == 2)
+            code3(fp, MOVZW, mem(addr, offset + disp), dst);
+        else
+            code3(fp, MOVZB, mem(addr, offset + disp), dst);
+
+        if (disp > 0) {
+            code3(fp, SHL, imm(8 * disp), R10);
+            code3(fp, OR, R10, R11);
+        }
+        disp += piece;
+    }
+    code3(fp, MOV, R11, RAX);
+}
+
 static void gen_add_stack_pointer(FILE *fp, int byte)
 {
     if (!byte)
@@ -521,29 +614,20 @@ static void gen_func_param_list_variadic_(FILE *fp)
 static int gen_store_param(FILE *fp, const struct symbol *sym, int stored_regs)
 {
     const int size = get_size(sym->type);
-    const int N8 = size / 8;
-    const int N4 = (size - 8 * N8) / 4;
     int offset = 0;
     int r = stored_regs;
-    int i;
 
     code3(fp, MOV, RBP, R10);
     code3(fp, SUB, imm(sym->mem_offset), R10);
 
-    for (i = 0; i < N8; i++) {
-        const int reg_ = arg_reg(r, I64);
-        code3(fp, MOV, reg_, mem(R10, offset));
+    /* the last register has the bytes left after the 8 byte ones */
+    while (offset < size) {
+        const int rest = size - offset < 8 ? size - offset : 8;
+        gen_store_pieces(fp, rest, arg_reg(r, I0), R10, offset);
         r++;
         offset += 8;
     }
 
-    for (i = 0; i < N4; i++) {
-        const int reg_ = arg_reg(r, I32);
-        code3(fp, MOV, reg_, mem(R10, offset));
-        r++;
-        offset += 4;
-    }
-
     return r;
 }
 
@@ -582,7 +666,11 @@ static void gen_func_param_list_(FILE *fp, const struct data_type *func_type)
             const int reg_ = arg_reg(stored_reg_count, opsize(sym->type));
             const int disp = -1 * sym->mem_offset;
 
-            code3(fp, MOV, reg_, mem(RBP, disp));
+            if (is_odd_size_object(sym->type))
+                gen_store_pieces(fp, param_size, arg_reg(stored_reg_count, I0),
+                        RBP, disp);
+            else
+                code3(fp, MOV, reg_, mem(RBP, disp));
             stored_reg_count++;
         }
         else if (param_size <= 16 && stored_reg_count < 5) {
@@ -602,7 +690,7 @@ static void gen_func_param_list_(FILE *fp, const struct data_type *func_type)
 
 static void gen_func_param_list(FILE *fp, const struct ast_node *node)
 {
-    const struct ast_node *func = node->l;
+    const struct ast_node *func = node_l(node);
 
     if (is_variadic(func->sym))
         gen_func_param_list_variadic_(fp);
@@ -611,22 +699,21 @@ static void gen_func_param_list(FILE *fp, const struct ast_node *node)
 }
 
 static int local_area_size = 0;
-static int find_max_return_size(const struct ast_node *node)
+static int find_max_return_size(const struct ast_node *tree)
 {
-    int size = 0, l, r;
-
-    if (!node)
-        return 0;
+    struct ast_walker walk;
+    const struct ast_node *node;
+    int size = 0;
 
-    if (node->kind == NOD_CALL)
-        if (!is_small_object(node->type))
-            size = get_size(node->type);
-
-    l = find_max_return_size(node->l);
-    r = find_max_return_size(node->r);
+    begin_ast_walk(&walk, tree);
+    while ((node = next_ast_node(&walk)) != NULL) {
+        if (node->kind == NOD_CALL && !is_small_object(node->type)) {
+            const int call_size = get_size(node->type);
+            size = call_size > size ? call_size : size;
+        }
+    }
+    end_ast_walk(&walk);
 
-    size = l > size ? l : size;
-    size = r > size ? r : size;
     return size;
 }
 
@@ -637,13 +724,13 @@ static int get_local_area_size(void)
 
 static void set_local_area_offset(const struct ast_node *node)
 {
-    const struct ast_node *func = node->l->l;
+    const struct ast_node *func = node_l(node_l(node));
     int local_var_size = 0;
     int ret_val_size = 0;
 
     local_var_size = get_mem_offset(func);
 
-    ret_val_size = find_max_return_size(node->r);
+    ret_val_size = find_max_return_size(node_r(node));
     ret_val_size = align_to(ret_val_size, 16);
 
     local_area_size = local_var_size + ret_val_size;
@@ -651,7 +738,7 @@ static void set_local_area_offset(const struct ast_node *node)
 
 static void gen_func_prologue(FILE *fp, const struct ast_node *node)
 {
-    const struct ast_node *func = node->l;
+    const struct ast_node *func = node_l(node);
 
     if (!is_static(func->sym))
         fprintf(fp, "    .global _%s\n", func->sym->name);
@@ -710,14 +797,14 @@ static void print_argument_list(const struct argument *args)
 static void gen_func_call(FILE *fp, const struct ast_node *node)
 {
     /* TODO divide this function */
-    const struct symbol *func_sym = node->l->sym;
+    const struct symbol *func_sym = node_l(node)->sym;
     const struct data_type *ret_type = node->type;
     struct argument *args = NULL;
     int total_area_size = 0;
     int total_fp = 0;
 
     {
-        const struct ast_node *list = node->r;
+        const struct ast_node *list = node_r(node);
         struct argument head = {0};
         struct argument *tail = &head;
 
@@ -730,13 +817,13 @@ static void gen_func_call(FILE *fp, const struct ast_node *node)
             tail = arg;
         }
 
-        for (; list; list = list->r) {
-            const struct ast_node *arg_node = list->l;
+        for (; list; list = node_r(list)) {
+            const struct ast_node *arg_node = node_l(list);
             struct argument *arg;
             int size;
 
             arg = calloc(1, sizeof(struct argument));
-            arg->expr = arg_node->l;
+            arg->expr = node_l(arg_node);
             arg->is_fp = is_fpnum(arg->expr->type);
 
             /* 8 byte align */
@@ -922,10 +1009,10 @@ static void gen_func_call_builtin(FILE *fp, const struct ast_node *node)
 
     case NOD_CALL:
         {
-            const struct symbol *func_sym = node->l->sym;
+            const struct symbol *func_sym = node_l(node)->sym;
 
             /* push args to stack */
-            gen_func_call_builtin(fp, node->r);
+            gen_func_call_builtin(fp, node_r(node));
 
             /* call */
             if (!strcmp(func_sym->name, "__builtin_va_start"))
@@ -936,7 +1023,7 @@ static void gen_func_call_builtin(FILE *fp, const struct ast_node *node)
 
     case NOD_ARG:
         /* push args */
-        gen_code(fp, node->l);
+        gen_code(fp, node_l(node));
         /* no count pushes and pops as builtins are not function calls */
         code3(fp, SUB, imm(8), RSP);
         code3(fp, MOV, RAX, mem(RSP, 0));
@@ -944,8 +1031,8 @@ static void gen_func_call_builtin(FILE *fp, const struct ast_node *node)
 
     default:
         /* walk tree from the rightmost arg */
-        gen_func_call_builtin(fp, node->r);
-        gen_func_call_builtin(fp, node->l);
+        gen_func_call_builtin(fp, node_r(node));
+        gen_func_call_builtin(fp, node_l(node));
         return;
     }
 }
@@ -979,6 +1066,9 @@ static void gen_ident(FILE *fp, const struct ast_node *node)
             sprintf(buf, "%s@GOTPCREL", sym->name);
             code3(fp, MOV, symb(buf, -1), RAX);
             code3(fp, MOV, mem(RAX, 0), RAX);
+        } else if (is_odd_size_object(node->type)) {
+            gen_address(fp, node);
+            gen_load_to_a(fp, node->type, RAX, 0);
         } else {
             const int id = is_static(sym) ? sym->id : -1;
             const int a_ = register_from_type(A_, node->type);
@@ -1016,12 +1106,12 @@ static void gen_address(FILE *fp, const struct ast_node *node)
         break;
 
     case NOD_DEREF:
-        gen_code(fp, node->l);
+        gen_code(fp, node_l(node));
         break;
 
     case NOD_STRUCT_REF:
-        gen_address(fp, node->l);
-        code3(fp, ADD, imm(get_mem_offset(node->r)), RAX);
+        gen_address(fp, node_l(node));
+        code3(fp, ADD, imm(get_mem_offset(node_r(node))), RAX);
         break;
 
     default:
@@ -1044,6 +1134,8 @@ static void gen_load_to_a(FILE *fp, const struct data_type *type,
     if (is_fpnum(type)) {
         const int x0_ = register_from_type(XMM0_, type);
         code3(fp, MOVS, mem(addr, offset), x0_);
+    } else if (is_odd_size_object(type)) {
+        gen_load_pieces(fp, get_size(type), addr, offset);
     } else {
         const int a_ = register_from_type(A_, type);
         code3(fp, MOV, mem(addr, offset), a_);
@@ -1058,6 +1150,9 @@ static void gen_store_a(FILE *fp, const struct data_type *type,
             const int x0_ = register_from_type(XMM0_, type);
             code3(fp, MOVS, x0_, mem(addr, offset));
         }
+        else if (is_odd_size_object(type)) {
+            gen_store_pieces(fp, get_size(type), A_, addr, offset);
+        }
         else {
             const int a_ = register_from_type(A_, type);
             code3(fp, MOV, a_, mem(addr, offset));
@@ -1116,7 +1211,7 @@ static void gen_preincdec(FILE *fp, const struct ast_node *node, enum opecode op
     if (is_pointer(node->type))
         stride = get_size(underlying(node->type));
 
-    gen_address(fp, node->l);
+    gen_address(fp, node_l(node));
     code3(fp, MOV, mem(RAX, 0), d_);
     code3(fp, op, imm(stride), d_);
     code3(fp, MOV, d_, mem(RAX, 0));
@@ -1132,7 +1227,7 @@ static void gen_postincdec(FILE *fp, const struct ast_node *node, enum opecode o
     if (is_pointer(node->type))
         stride = get_size(underlying(node->type));
 
-    gen_address(fp, node->l);
+    gen_address(fp, node_l(node));
     code3(fp, MOV, RAX, RDX);
     code3(fp, MOV, mem(RAX, 0), a_);
     code3(fp, MOV, a_, c_);
@@ -1142,12 +1237,12 @@ static void gen_postincdec(FILE *fp, const struct ast_node *node, enum opecode o
 
 static void gen_relational(FILE *fp, const struct ast_node *node, enum opecode op)
 {
-    const int a_ = register_from_type(A_, node->l->type);
-    const int d_ = register_from_type(D_, node->r->type);
+    const int a_ = register_from_type(A_, node_l(node)->type);
+    const int d_ = register_from_type(D_, node_r(node)->type);
 
-    gen_code(fp, node->l);
+    gen_code(fp, node_l(node));
     code2(fp, PUSH, RAX);
-    gen_code(fp, node->r);
+    gen_code(fp, node_r(node));
     code3(fp, MOV, a_, d_);
     code2(fp, POP, RAX);
     code3(fp, CMP, d_, a_);
@@ -1157,12 +1252,12 @@ static void gen_relational(FILE *fp, const struct ast_node *node, enum opecode o
 
 static void gen_equality(FILE *fp, const struct ast_node *node, enum opecode op)
 {
-    const int a_ = register_from_type(A_, node->l->type);
-    const int d_ = register_from_type(D_, node->r->type);
+    const int a_ = register_from_type(A_, node_l(node)->type);
+    const int d_ = register_from_type(D_, node_r(node)->type);
 
-    gen_code(fp, node->l);
+    gen_code(fp, node_l(node));
     code2(fp, PUSH, RAX);
-    gen_code(fp, node->r);
+    gen_code(fp, node_r(node));
     code2(fp, POP, RDX);
     code3(fp, CMP, d_, a_);
     code2(fp, op,   AL);
@@ -1204,12 +1299,12 @@ static void gen_switch_table_(FILE *fp, const struct ast_node *node,
 
     case NOD_CASE:
         {
-            const int a_ = register_from_type(A_, node->l->type);
+            const int a_ = register_from_type(A_, node_l(node)->type);
 
-            code3(fp, CMP, imm(node->l->ival), a_);
+            code3(fp, CMP, imm(node_ival(node_l(node))), a_);
             code2(fp, JE,  make_label(switch_scope, jump_id(node)));
             /* check next statement if it is another case statement */
-            gen_switch_table_(fp, node->r, switch_scope, ctrl_type);
+            gen_switch_table_(fp, node_r(node), switch_scope, ctrl_type);
         }
         return;
 
@@ -1219,8 +1314,15 @@ static void gen_switch_table_(FILE *fp, const struct ast_node *node,
 
     case NOD_COMPOUND:
     case NOD_LIST:
-        gen_switch_table_(fp, node->l, switch_scope, ctrl_type);
-        gen_switch_table_(fp, node->r, switch_scope, ctrl_type);
+        {
+            struct ast_walker walk;
+            const struct ast_node *item;
+
+            begin_ast_walk(&walk, node);
+            while ((item = next_ast_list_item(&walk)) != NULL)
+                gen_switch_table_(fp, item, switch_scope, ctrl_type);
+            end_ast_walk(&walk);
+        }
         break;
 
     default:
@@ -1231,7 +1333,7 @@ static void gen_switch_table_(FILE *fp, const struct ast_node *node,
 static void gen_switch_table(FILE *fp, const struct ast_node *node, int switch_scope)
 {
     gen_comment(fp, "begin jump table");
-    gen_switch_table_(fp, node->r, switch_scope, node->l->type);
+    gen_switch_table_(fp, node_r(node), switch_scope, node_l(node)->type);
     /* for switch without default */
     code2(fp, JMP, make_label(switch_scope, JMP_EXIT));
     gen_comment(fp, "end jump table");
@@ -1286,20 +1388,16 @@ static void gen_copy_large_object(FILE *fp, const struct data_type *type,
 {
     /* assuming src addess is in rax */
     const int size = get_size(type);
-    const int N8 = size / 8;
-    const int N4 = (size - 8 * N8) / 4;
     int disp = 0;
-    int i;
 
-    for (i = 0; i < N8; i++) {
-        code3(fp, MOV, mem(RAX, disp), R10);
-        code3(fp, MOV, R10, mem(addr, offset + disp));
-        disp += 8;
-    }
-    for (i = 0; i < N4; i++) {
-        code3(fp, MOV, mem(RAX, disp), R10D);
-        code3(fp, MOV, R10D, mem(addr, offset + disp));
-        disp += 4;
+    /* the tail of an odd size is copied in pieces of 4, 2 and 1 bytes */
+    while (disp < size) {
+        const int piece = piece_size(size - disp);
+        const int r10_ = regi(R10_, piece_opsize(piece));
+
+        code3(fp, MOV, mem(RAX, disp), r10_);
+        code3(fp, MOV, r10_, mem(addr, offset + disp));
+        disp += piece;
     }
 }
 
@@ -1507,11 +1605,8 @@ static void free_object_byte(struct object_byte *obj)
     struct object_byte o = {0};
     int i;
     for (i = 0; i < obj->size; i++) {
-        if (obj->bytes[i].bit) {
+        if (obj->bytes[i].bit)
             free_memory_bit(obj->bytes[i].bit);
-            /* TODO improve this un-const cast */
-            free_ast_node((struct ast_node *) obj->bytes[i].init);
-        }
     }
     free(obj->bytes);
     *obj = o;
@@ -1528,16 +1623,23 @@ static void assign_init(struct memory_byte *base,
     case NOD_INIT:
         {
             /* move cursor by designator */
-            const int offset = expr->l->ival;
+            const int offset = node_ival(node_l(expr));
 
-            assign_init(base + offset, underlying(type), expr->r);
+            assign_init(base + offset, underlying(type), node_r(expr));
         }
         break;
 
     case NOD_LIST:
         /* pass to the next initializer */
-        assign_init(base, type, expr->l);
-        assign_init(base, type, expr->r);
+        {
+            struct ast_walker walk;
+            const struct ast_node *item;
+
+            begin_ast_walk(&walk, expr);
+            while ((item = next_ast_list_item(&walk)) != NULL)
+                assign_init(base, type, item);
+            end_ast_walk(&walk);
+        }
         break;
 
     default:
@@ -1589,47 +1691,47 @@ static long eval_const_expr__(const struct ast_node *node)
     switch (node->kind) {
 
     case NOD_ADD:
-        l = eval_const_expr__(node->l);
-        r = eval_const_expr__(node->r);
+        l = eval_const_expr__(node_l(node));
+        r = eval_const_expr__(node_r(node));
         return l + r;
 
     case NOD_SUB:
-        l = eval_const_expr__(node->l);
-        r = eval_const_expr__(node->r);
+        l = eval_const_expr__(node_l(node));
+        r = eval_const_expr__(node_r(node));
         return l - r;
 
     case NOD_MUL:
-        l = eval_const_expr__(node->l);
-        r = eval_const_expr__(node->r);
+        l = eval_const_expr__(node_l(node));
+        r = eval_const_expr__(node_r(node));
         return l * r;
 
     case NOD_DIV:
-        l = eval_const_expr__(node->l);
-        r = eval_const_expr__(node->r);
+        l = eval_const_expr__(node_l(node));
+        r = eval_const_expr__(node_r(node));
         return l / r;
 
     case NOD_MOD:
-        l = eval_const_expr__(node->l);
-        r = eval_const_expr__(node->r);
+        l = eval_const_expr__(node_l(node));
+        r = eval_const_expr__(node_r(node));
         return l % r;
 
     case NOD_SHL:
-        l = eval_const_expr__(node->l);
-        r = eval_const_expr__(node->r);
+        l = eval_const_expr__(node_l(node));
+        r = eval_const_expr__(node_r(node));
         return l << r;
 
     case NOD_SHR:
-        l = eval_const_expr__(node->l);
-        r = eval_const_expr__(node->r);
+        l = eval_const_expr__(node_l(node));
+        r = eval_const_expr__(node_r(node));
         return l >> r;
 
     case NOD_CAST:
-        l = eval_const_expr__(node->l);
+        l = eval_const_expr__(node_l(node));
         return l;
 
     case NOD_SIZEOF:
     case NOD_NUM:
-        return node->ival;
+        return node_ival(node);
 
     default:
         return 0;
@@ -1649,7 +1751,7 @@ static void gen_init_scalar_global(FILE *fp, const struct data_type *type,
     switch (expr->kind) {
 
     case NOD_NUM:
-        fprintf(fp, "    .%s %ld\n", szname, expr->ival);
+        fprintf(fp, "    .%s %ld\n", szname, node_ival(expr));
         break;
 
     case NOD_IDENT:
@@ -1677,7 +1779,7 @@ static void gen_init_scalar_global(FILE *fp, const struct data_type *type,
     case NOD_ADDR:
         {
             /* TODO make function taking sym */
-            const struct symbol *sym = expr->l->sym;
+            const struct symbol *sym = node_l(expr)->sym;
             fprintf(fp, "    .%s ", szname);
             if (is_static(sym))
                 gen_symbol_name(fp, sym->name, sym->id);
@@ -1689,7 +1791,7 @@ static void gen_init_scalar_global(FILE *fp, const struct data_type *type,
 
     case NOD_CAST:
         /* TODO come up better way to handle scalar universaly */
-        gen_init_scalar_global(fp, type, expr->l);
+        gen_init_scalar_global(fp, type, node_l(expr));
         break;
 
     case NOD_STRING:
@@ -1783,7 +1885,7 @@ static void gen_initializer(FILE *fp,
                 }
                 /* TODO improve this node will be strayed */
                 n = new_ast_node(NOD_NUM, NULL, NULL);
-                n->ival = byte_data;
+                set_node_ival(n, byte_data);
                 byte->init = n;
             }
         }
@@ -1828,8 +1930,15 @@ static void gen_code(FILE *fp, const struct ast_node *node)
 
     case NOD_LIST:
     case NOD_COMPOUND:
-        gen_code(fp, node->l);
-        gen_code(fp, node->r);
+        {
+            struct ast_walker walk;
+            const struct ast_node *item;
+
+            begin_ast_walk(&walk, node);
+            while ((item = next_ast_list_item(&walk)) != NULL)
+                gen_code(fp, item);
+            end_ast_walk(&walk);
+        }
         break;
 
     case NOD_FOR:
@@ -1838,8 +1947,8 @@ static void gen_code(FILE *fp, const struct ast_node *node)
         scope.brk = scope.curr;
         scope.conti = scope.curr;
 
-        gen_code(fp, node->l);
-        gen_code(fp, node->r);
+        gen_code(fp, node_l(node));
+        gen_code(fp, node_r(node));
 
         scope = tmp;
         break;
@@ -1847,23 +1956,23 @@ static void gen_code(FILE *fp, const struct ast_node *node)
     case NOD_FOR_PRE_COND:
         /* pre */
         gen_comment(fp, "for-pre");
-        gen_code(fp, node->l);
+        gen_code(fp, node_l(node));
         /* cond */
         gen_comment(fp, "for-cond");
         gen_label(fp, scope.curr, JMP_ENTER);
-        gen_code(fp, node->r);
-        gen_compare_to_zero(fp, node->r->type);
+        gen_code(fp, node_r(node));
+        gen_compare_to_zero(fp, node_r(node)->type);
         code2(fp, JE, make_label(scope.curr, JMP_EXIT));
         break;
 
     case NOD_FOR_BODY_POST:
         /* body */
         gen_comment(fp, "for-body");
-        gen_code(fp, node->l);
+        gen_code(fp, node_l(node));
         /* post */
         gen_comment(fp, "for-post");
         gen_label(fp, scope.curr, JMP_CONTINUE);
-        gen_code(fp, node->r);
+        gen_code(fp, node_r(node));
         code2(fp, JMP, make_label(scope.curr, JMP_ENTER));
         gen_label(fp, scope.curr, JMP_EXIT);
         break;
@@ -1876,11 +1985,11 @@ static void gen_code(FILE *fp, const struct ast_node *node)
 
         gen_comment(fp, "while-cond");
         gen_label(fp, scope.curr, JMP_CONTINUE);
-        gen_code(fp, node->l);
-        gen_compare_to_zero(fp, node->l->type);
+        gen_code(fp, node_l(node));
+        gen_compare_to_zero(fp, node_l(node)->type);
         code2(fp, JE,  make_label(scope.curr, JMP_EXIT));
         gen_comment(fp, "while-body");
-        gen_code(fp, node->r);
+        gen_code(fp, node_r(node));
         code2(fp, JMP, make_label(scope.curr, JMP_CONTINUE));
         gen_label(fp, scope.curr, JMP_EXIT);
 
@@ -1895,11 +2004,11 @@ static void gen_code(FILE *fp, const struct ast_node *node)
 
         gen_comment(fp, "do-while-body");
         gen_label(fp, scope.curr, JMP_ENTER);
-        gen_code(fp, node->l);
+        gen_code(fp, node_l(node));
         gen_comment(fp, "do-while-cond");
         gen_label(fp, scope.curr, JMP_CONTINUE);
-        gen_code(fp, node->r);
-        gen_compare_to_zero(fp, node->r->type);
+        gen_code(fp, node_r(node));
+        gen_compare_to_zero(fp, node_r(node)->type);
         code2(fp, JE,  make_label(scope.curr, JMP_EXIT));
         code2(fp, JMP, make_label(scope.curr, JMP_ENTER));
         gen_label(fp, scope.curr, JMP_EXIT);
@@ -1913,10 +2022,10 @@ static void gen_code(FILE *fp, const struct ast_node *node)
         scope.curr = next_scope++;
 
         gen_comment(fp, "if-cond");
-        gen_code(fp, node->l);
-        gen_compare_to_zero(fp, node->l->type);
+        gen_code(fp, node_l(node));
+        gen_compare_to_zero(fp, node_l(node)->type);
         code2(fp, JE,  make_label(scope.curr, JMP_ELSE));
-        gen_code(fp, node->r);
+        gen_code(fp, node_r(node));
 
         scope = tmp;
         break;
@@ -1924,12 +2033,12 @@ static void gen_code(FILE *fp, const struct ast_node *node)
     case NOD_IF_THEN:
         /* then */
         gen_comment(fp, "if-then");
-        gen_code(fp, node->l);
+        gen_code(fp, node_l(node));
         code2(fp, JMP, make_label(scope.curr, JMP_EXIT));
         /* else */
         gen_comment(fp, "if-else");
         gen_label(fp, scope.curr, JMP_ELSE);
-        gen_code(fp, node->r);
+        gen_code(fp, node_r(node));
         gen_label(fp, scope.curr, JMP_EXIT);
         break;
 
@@ -1939,9 +2048,9 @@ static void gen_code(FILE *fp, const struct ast_node *node)
         scope.brk = scope.curr;
 
         gen_comment(fp, "switch-value");
-        gen_code(fp, node->l);
+        gen_code(fp, node_l(node));
         gen_switch_table(fp, node, scope.curr);
-        gen_code(fp, node->r);
+        gen_code(fp, node_r(node));
         gen_label(fp, scope.curr, JMP_EXIT);
 
         scope = tmp;
@@ -1950,13 +2059,13 @@ static void gen_code(FILE *fp, const struct ast_node *node)
     case NOD_CASE:
     case NOD_DEFAULT:
         gen_label(fp, scope.curr, jump_id(node));
-        gen_code(fp, node->r);
+        gen_code(fp, node_r(node));
         break;
 
     case NOD_RETURN:
-        if (node->l) {
-            const struct data_type *expr_type = node->l->type;
-            gen_code(fp, node->l);
+        if (node_l(node)) {
+            const struct data_type *expr_type = node_l(node)->type;
+            gen_code(fp, node_l(node));
 
             if (is_medium_object(expr_type)) {
                 /* use rax and rdx to load returning value */
@@ -1984,12 +2093,12 @@ static void gen_code(FILE *fp, const struct ast_node *node)
         break;
 
     case NOD_LABEL:
-        gen_label(fp, scope.func, jump_id(node->l));
-        gen_code(fp, node->r);
+        gen_label(fp, scope.func, jump_id(node_l(node)));
+        gen_code(fp, node_r(node));
         break;
 
     case NOD_GOTO:
-        code2(fp, JMP, make_label(scope.func, jump_id(node->l)));
+        code2(fp, JMP, make_label(scope.func, jump_id(node_l(node))));
         break;
 
     case NOD_IDENT:
@@ -1997,16 +2106,16 @@ static void gen_code(FILE *fp, const struct ast_node *node)
         break;
 
     case NOD_DECL_IDENT:
-        if (is_local_var(node->sym) && node->l)
-            gen_initializer(fp, node, node->l);
+        if (is_local_var(node->sym) && node_l(node))
+            gen_initializer(fp, node, node_l(node));
         break;
 
     case NOD_STRUCT_REF:
         gen_address(fp, node);
         gen_load_to_a(fp, node->type, RAX, 0);
 
-        if (is_bitfield(node->r->sym)) {
-            const struct symbol *sym = node->r->sym;
+        if (is_bitfield(node_r(node)->sym)) {
+            const struct symbol *sym = node_r(node)->sym;
             const int sl = 32 - sym->bit_width - sym->bit_offset;
             const int sr = 32 - sym->bit_width;
             code3(fp, SHL, imm(sl), EAX);
@@ -2019,7 +2128,7 @@ static void gen_code(FILE *fp, const struct ast_node *node)
         break;
 
     case NOD_CALL:
-        if (is_builtin(node->l->sym))
+        if (is_builtin(node_l(node)->sym))
             gen_func_call_builtin(fp, node);
         else
             gen_func_call(fp, node);
@@ -2032,26 +2141,26 @@ static void gen_code(FILE *fp, const struct ast_node *node)
 
         set_local_area_offset(node);
 
-        gen_func_prologue(fp, node->l);
+        gen_func_prologue(fp, node_l(node));
         gen_comment(fp, "func params");
-        gen_func_param_list(fp, node->l);
+        gen_func_param_list(fp, node_l(node));
         gen_comment(fp, "func body");
-        gen_func_body(fp, node->r);
+        gen_func_body(fp, node_r(node));
         gen_label(fp, scope.curr, JMP_RETURN);
-        gen_func_epilogue(fp, node->r);
+        gen_func_epilogue(fp, node_r(node));
 
         scope = tmp;
         break;
 
     case NOD_ASSIGN:
         gen_comment(fp, "assign");
-        gen_address(fp, node->l);
+        gen_address(fp, node_l(node));
         code2(fp, PUSH, RAX);
-        gen_code(fp, node->r);
+        gen_code(fp, node_r(node));
         code2(fp, POP,  RDX);
 
-        if (node->l->kind == NOD_STRUCT_REF && is_bitfield(node->l->r->sym)) {
-            const struct symbol *sym = node->l->r->sym;
+        if (node_l(node)->kind == NOD_STRUCT_REF && is_bitfield(node_r(node_l(node))->sym)) {
+            const struct symbol *sym = node_r(node_l(node))->sym;
             int mask;
             mask = ~1 << (sym->bit_width - 1);
             mask = ~mask;
@@ -2070,14 +2179,14 @@ static void gen_code(FILE *fp, const struct ast_node *node)
             break;
         }
 
-        gen_store_a(fp, node->l->type, RDX, 0);
+        gen_store_a(fp, node_l(node)->type, RDX, 0);
         break;
 
     case NOD_ADD_ASSIGN:
         gen_comment(fp, "add-assign");
-        gen_address(fp, node->l);
+        gen_address(fp, node_l(node));
         code2(fp, PUSH, RAX);
-        gen_code(fp, node->r);
+        gen_code(fp, node_r(node));
         code2(fp, POP,  RDX);
         code3(fp, ADD, a_, mem(RDX, 0));
         code3(fp, MOV, mem(RDX, 0), a_);
@@ -2085,9 +2194,9 @@ static void gen_code(FILE *fp, const struct ast_node *node)
 
     case NOD_SUB_ASSIGN:
         gen_comment(fp, "sub-assign");
-        gen_address(fp, node->l);
+        gen_address(fp, node_l(node));
         code2(fp, PUSH, RAX);
-        gen_code(fp, node->r);
+        gen_code(fp, node_r(node));
         code2(fp, POP,  RDX);
         code3(fp, SUB, a_, mem(RDX, 0));
         code3(fp, MOV, mem(RDX, 0), a_);
@@ -2095,9 +2204,9 @@ static void gen_code(FILE *fp, const struct ast_node *node)
 
     case NOD_MUL_ASSIGN:
         gen_comment(fp, "mul-assign");
-        gen_address(fp, node->l);
+        gen_address(fp, node_l(node));
         code2(fp, PUSH, RAX);
-        gen_code(fp, node->r);
+        gen_code(fp, node_r(node));
         code2(fp, POP,  RDX);
         code3(fp, IMUL, mem(RDX, 0), a_);
         code3(fp, MOV, a_, mem(RDX, 0));
@@ -2105,23 +2214,21 @@ static void gen_code(FILE *fp, const struct ast_node *node)
 
     case NOD_DIV_ASSIGN:
         gen_comment(fp, "div-assign");
-        gen_address(fp, node->l);
+        gen_address(fp, node_l(node));
         code2(fp, PUSH, RAX);
-        gen_code(fp, node->r);
+        gen_code(fp, node_r(node));
         code3(fp, MOV, a_, di_);
         code2(fp, POP, RSI);
         code3(fp, MOV, mem(RSI, 0), a_);
-        /* rax -> rdx:rax */
-        code1(fp, CLTD);
-        code2(fp, IDIV, di_);
+        gen_div(fp, node, DI_);
         code3(fp, MOV, a_, mem(RSI, 0));
         break;
 
     case NOD_MOD_ASSIGN:
         gen_comment(fp, "mod-assign");
-        gen_address(fp, node->l);
+        gen_address(fp, node_l(node));
         code2(fp, PUSH, RAX);
-        gen_code(fp, node->r);
+        gen_code(fp, node_r(node));
         code3(fp, MOV, a_, di_);
         code2(fp, POP, RSI);
         code3(fp, MOV, mem(RSI, 0), a_);
@@ -2132,9 +2239,9 @@ static void gen_code(FILE *fp, const struct ast_node *node)
 
     case NOD_SHL_ASSIGN:
         gen_comment(fp, "shl-assign");
-        gen_address(fp, node->l);
+        gen_address(fp, node_l(node));
         code2(fp, PUSH, RAX);
-        gen_code(fp, node->r);
+        gen_code(fp, node_r(node));
         code3(fp, MOV, a_, c_);
         code2(fp, POP, RDX);
         code3(fp, MOV, mem(RDX, 0), a_);
@@ -2144,9 +2251,9 @@ static void gen_code(FILE *fp, const struct ast_node *node)
 
     case NOD_SHR_ASSIGN:
         gen_comment(fp, "shr-assign");
-        gen_address(fp, node->l);
+        gen_address(fp, node_l(node));
         code2(fp, PUSH, RAX);
-        gen_code(fp, node->r);
+        gen_code(fp, node_r(node));
         code3(fp, MOV, a_, c_);
         code2(fp, POP, RDX);
         code3(fp, MOV, mem(RDX, 0), a_);
@@ -2159,9 +2266,9 @@ static void gen_code(FILE *fp, const struct ast_node *node)
 
     case NOD_OR_ASSIGN:
         gen_comment(fp, "or-assign");
-        gen_address(fp, node->l);
+        gen_address(fp, node_l(node));
         code2(fp, PUSH, RAX);
-        gen_code(fp, node->r);
+        gen_code(fp, node_r(node));
         code2(fp, POP, RDX);
         code3(fp, OR, a_, mem(RDX, 0));
         code3(fp, MOV, mem(RDX, 0), a_);
@@ -2169,9 +2276,9 @@ static void gen_code(FILE *fp, const struct ast_node *node)
 
     case NOD_XOR_ASSIGN:
         gen_comment(fp, "xor-assign");
-        gen_address(fp, node->l);
+        gen_address(fp, node_l(node));
         code2(fp, PUSH, RAX);
-        gen_code(fp, node->r);
+        gen_code(fp, node_r(node));
         code2(fp, POP, RDX);
         code3(fp, XOR, a_, mem(RDX, 0));
         code3(fp, MOV, mem(RDX, 0), a_);
@@ -2179,30 +2286,30 @@ static void gen_code(FILE *fp, const struct ast_node *node)
 
     case NOD_AND_ASSIGN:
         gen_comment(fp, "and-assign");
-        gen_address(fp, node->l);
+        gen_address(fp, node_l(node));
         code2(fp, PUSH, RAX);
-        gen_code(fp, node->r);
+        gen_code(fp, node_r(node));
         code2(fp, POP,  RDX);
         code3(fp, AND, a_, mem(RDX, 0));
         code3(fp, MOV, mem(RDX, 0), a_);
         break;
 
     case NOD_ADDR:
-        gen_address(fp, node->l);
+        gen_address(fp, node_l(node));
         break;
 
     case NOD_CAST:
-        gen_code(fp, node->l);
-        gen_convert_a(fp, node->l->type, node->type);
+        gen_code(fp, node_l(node));
+        gen_convert_a(fp, node_l(node)->type, node->type);
         break;
 
     case NOD_DEREF:
-        gen_code(fp, node->l);
+        gen_code(fp, node_l(node));
         gen_load_to_a(fp, node->type, RAX, 0);
         break;
 
     case NOD_NUM:
-        code3(fp, MOV, imm(node->ival), a_);
+        code3(fp, MOV, imm(node_ival(node)), a_);
         break;
 
     case NOD_STRING:
@@ -2214,23 +2321,23 @@ static void gen_code(FILE *fp, const struct ast_node *node)
         break;
 
     case NOD_SIZEOF:
-        code3(fp, MOV, imm(get_size(node->l->type)), EAX);
+        code3(fp, MOV, imm(get_size(node_l(node)->type)), EAX);
         break;
 
     case NOD_ADD:
         if (is_fpnum(node->type)) {
             const int x0_ = register_from_type(XMM0_, node->type);
             const int x1_ = register_from_type(XMM1_, node->type);
-            gen_code(fp, node->l);
+            gen_code(fp, node_l(node));
             gen_push_a(fp, node->type, x0_);
-            gen_code(fp, node->r);
+            gen_code(fp, node_r(node));
             gen_pop_to(fp, node->type, x1_);
             code3(fp, ADDS, x1_, x0_);
             break;
         }
-        gen_code(fp, node->l);
+        gen_code(fp, node_l(node));
         code2(fp, PUSH, RAX);
-        gen_code(fp, node->r);
+        gen_code(fp, node_r(node));
         code2(fp, POP, RDX);
         code3(fp, ADD, d_, a_);
         break;
@@ -2239,17 +2346,17 @@ static void gen_code(FILE *fp, const struct ast_node *node)
         if (is_fpnum(node->type)) {
             const int x0_ = register_from_type(XMM0_, node->type);
             const int x1_ = register_from_type(XMM1_, node->type);
-            gen_code(fp, node->l);
+            gen_code(fp, node_l(node));
             gen_push_a(fp, node->type, x0_);
-            gen_code(fp, node->r);
+            gen_code(fp, node_r(node));
             code3(fp, MOVS, x0_, x1_);
             gen_pop_to(fp, node->type, x0_);
             code3(fp, SUBS, x1_, x0_);
             break;
         }
-        gen_code(fp, node->l);
+        gen_code(fp, node_l(node));
         code2(fp, PUSH, RAX);
-        gen_code(fp, node->r);
+        gen_code(fp, node_r(node));
         code3(fp, MOV, a_, d_);
         code2(fp, POP, RAX);
         code3(fp, SUB, d_, a_);
@@ -2259,16 +2366,16 @@ static void gen_code(FILE *fp, const struct ast_node *node)
         if (is_fpnum(node->type)) {
             const int x0_ = register_from_type(XMM0_, node->type);
             const int x1_ = register_from_type(XMM1_, node->type);
-            gen_code(fp, node->l);
+            gen_code(fp, node_l(node));
             gen_push_a(fp, node->type, x0_);
-            gen_code(fp, node->r);
+            gen_code(fp, node_r(node));
             gen_pop_to(fp, node->type, x1_);
             code3(fp, MULS, x1_, x0_);
             break;
         }
-        gen_code(fp, node->l);
+        gen_code(fp, node_l(node));
         code2(fp, PUSH, RAX);
-        gen_code(fp, node->r);
+        gen_code(fp, node_r(node));
         code2(fp, POP, RDX);
         code3(fp, IMUL, d_, a_);
         break;
@@ -2277,28 +2384,26 @@ static void gen_code(FILE *fp, const struct ast_node *node)
         if (is_fpnum(node->type)) {
             const int x0_ = register_from_type(XMM0_, node->type);
             const int x1_ = register_from_type(XMM1_, node->type);
-            gen_code(fp, node->l);
+            gen_code(fp, node_l(node));
             gen_push_a(fp, node->type, x0_);
-            gen_code(fp, node->r);
+            gen_code(fp, node_r(node));
             code3(fp, MOVS, x0_, x1_);
             gen_pop_to(fp, node->type, x0_);
             code3(fp, DIVS, x1_, x0_);
             break;
         }
-        gen_code(fp, node->l);
+        gen_code(fp, node_l(node));
         code2(fp, PUSH, RAX);
-        gen_code(fp, node->r);
+        gen_code(fp, node_r(node));
         code3(fp, MOV, a_, di_);
         code2(fp, POP, RAX);
-        /* rax -> rdx:rax */
-        code1(fp, CLTD);
-        code2(fp, IDIV, di_);
+        gen_div(fp, node, DI_);
         break;
 
     case NOD_MOD:
-        gen_code(fp, node->l);
+        gen_code(fp, node_l(node));
         code2(fp, PUSH, RAX);
-        gen_code(fp, node->r);
+        gen_code(fp, node_r(node));
         code3(fp, MOV, a_, di_);
         code2(fp, POP, RAX);
         gen_div(fp, node, DI_);
@@ -2306,18 +2411,18 @@ static void gen_code(FILE *fp, const struct ast_node *node)
         break;
 
     case NOD_SHL:
-        gen_code(fp, node->l);
+        gen_code(fp, node_l(node));
         code2(fp, PUSH, RAX);
-        gen_code(fp, node->r);
+        gen_code(fp, node_r(node));
         code3(fp, MOV, a_, c_);
         code2(fp, POP, RAX);
         code3(fp, SHL, CL, a_);
         break;
 
     case NOD_SHR:
-        gen_code(fp, node->l);
+        gen_code(fp, node_l(node));
         code2(fp, PUSH, RAX);
-        gen_code(fp, node->r);
+        gen_code(fp, node_r(node));
         code3(fp, MOV, a_, c_);
         code2(fp, POP, RAX);
         if (is_unsigned(node->type))
@@ -2327,31 +2432,31 @@ static void gen_code(FILE *fp, const struct ast_node *node)
         break;
 
     case NOD_OR:
-        gen_code(fp, node->l);
+        gen_code(fp, node_l(node));
         code2(fp, PUSH, RAX);
-        gen_code(fp, node->r);
+        gen_code(fp, node_r(node));
         code2(fp, POP, RDX);
         code3(fp, OR, d_, a_);
         break;
 
     case NOD_XOR:
-        gen_code(fp, node->l);
+        gen_code(fp, node_l(node));
         code2(fp, PUSH, RAX);
-        gen_code(fp, node->r);
+        gen_code(fp, node_r(node));
         code2(fp, POP, RDX);
         code3(fp, XOR, d_, a_);
         break;
 
     case NOD_AND:
-        gen_code(fp, node->l);
+        gen_code(fp, node_l(node));
         code2(fp, PUSH, RAX);
-        gen_code(fp, node->r);
+        gen_code(fp, node_r(node));
         code2(fp, POP, RDX);
         code3(fp, AND, d_, a_);
         break;
 
     case NOD_NOT:
-        gen_code(fp, node->l);
+        gen_code(fp, node_l(node));
         code2(fp, NOT, a_);
         break;
 
@@ -2361,10 +2466,10 @@ static void gen_code(FILE *fp, const struct ast_node *node)
         tmp = scope;
         scope.curr = next_scope++;
 
-        gen_code(fp, node->l);
+        gen_code(fp, node_l(node));
         code3(fp, CMP, imm(0), a_);
         code2(fp, JE,  make_label(scope.curr, JMP_ELSE));
-        gen_code(fp, node->r);
+        gen_code(fp, node_r(node));
 
         scope = tmp;
         break;
@@ -2372,12 +2477,12 @@ static void gen_code(FILE *fp, const struct ast_node *node)
     case NOD_COND_THEN:
         /* then */
         gen_comment(fp, "cond-then");
-        gen_code(fp, node->l);
+        gen_code(fp, node_l(node));
         code2(fp, JMP, make_label(scope.curr, JMP_EXIT));
         /* else */
         gen_comment(fp, "cond-else");
         gen_label(fp, scope.curr, JMP_ELSE);
-        gen_code(fp, node->r);
+        gen_code(fp, node_r(node));
         gen_label(fp, scope.curr, JMP_EXIT);
         break;
 
@@ -2385,14 +2490,14 @@ static void gen_code(FILE *fp, const struct ast_node *node)
         tmp = scope;
         scope.curr = next_scope++;
 
-        gen_code(fp, node->l);
-        gen_compare_to_zero(fp, node->l->type);
+        gen_code(fp, node_l(node));
+        gen_compare_to_zero(fp, node_l(node)->type);
         /* set true and jump */
         code3(fp, MOV, imm(1), EAX);
         code2(fp, JNE, make_label(scope.curr, JMP_EXIT));
 
-        gen_code(fp, node->r);
-        gen_compare_to_zero(fp, node->r->type);
+        gen_code(fp, node_r(node));
+        gen_compare_to_zero(fp, node_r(node)->type);
         /* set true and jump */
         code3(fp, MOV, imm(1), EAX);
         code2(fp, JNE,  make_label(scope.curr, JMP_EXIT));
@@ -2408,14 +2513,14 @@ static void gen_code(FILE *fp, const struct ast_node *node)
         tmp = scope;
         scope.curr = next_scope++;
 
-        gen_code(fp, node->l);
-        gen_compare_to_zero(fp, node->l->type);
+        gen_code(fp, node_l(node));
+        gen_compare_to_zero(fp, node_l(node)->type);
         /* set false and jump */
         code3(fp, MOV, imm(0), EAX);
         code2(fp, JE,  make_label(scope.curr, JMP_EXIT));
 
-        gen_code(fp, node->r);
-        gen_compare_to_zero(fp, node->r->type);
+        gen_code(fp, node_r(node));
+        gen_compare_to_zero(fp, node_r(node)->type);
         /* set false and jump */
         code3(fp, MOV, imm(0), EAX);
         code2(fp, JE,  make_label(scope.curr, JMP_EXIT));
@@ -2428,15 +2533,15 @@ static void gen_code(FILE *fp, const struct ast_node *node)
         break;
 
     case NOD_LOGICAL_NOT:
-        gen_code(fp, node->l);
-        gen_compare_to_zero(fp, node->l->type);
+        gen_code(fp, node_l(node));
+        gen_compare_to_zero(fp, node_l(node)->type);
         code2(fp, SETE,  AL);
         code3(fp, MOVZB, AL, a_);
         break;
 
     case NOD_COMMA:
-        gen_code(fp, node->l);
-        gen_code(fp, node->r);
+        gen_code(fp, node_l(node));
+        gen_code(fp, node_r(node));
         break;
 
     case NOD_PREINC:
@@ -2456,13 +2561,13 @@ static void gen_code(FILE *fp, const struct ast_node *node)
         break;
 
     case NOD_LT:
-        if (is_fpnum(node->l->type)) {
-            const struct data_type *type = node->l->type;
+        if (is_fpnum(node_l(node)->type)) {
+            const struct data_type *type = node_l(node)->type;
             const int x0_ = register_from_type(XMM0_, type);
             const int x1_ = register_from_type(XMM1_, type);
-            gen_code(fp, node->l);
+            gen_code(fp, node_l(node));
             gen_push_a(fp, type, x0_);
-            gen_code(fp, node->r);
+            gen_code(fp, node_r(node));
             code3(fp, MOVS, x0_, x1_);
             gen_pop_to(fp, type, x0_);
             code3(fp, UCOMIS, x0_, x1_);
@@ -2475,13 +2580,13 @@ static void gen_code(FILE *fp, const struct ast_node *node)
         break;
 
     case NOD_GT:
-        if (is_fpnum(node->l->type)) {
-            const struct data_type *type = node->l->type;
+        if (is_fpnum(node_l(node)->type)) {
+            const struct data_type *type = node_l(node)->type;
             const int x0_ = register_from_type(XMM0_, type);
             const int x1_ = register_from_type(XMM1_, type);
-            gen_code(fp, node->l);
+            gen_code(fp, node_l(node));
             gen_push_a(fp, type, x0_);
-            gen_code(fp, node->r);
+            gen_code(fp, node_r(node));
             code3(fp, MOVS, x0_, x1_);
             gen_pop_to(fp, type, x0_);
             code3(fp, UCOMIS, x0_, x1_);
@@ -2494,13 +2599,13 @@ static void gen_code(FILE *fp, const struct ast_node *node)
         break;
 
     case NOD_LE:
-        if (is_fpnum(node->l->type)) {
-            const struct data_type *type = node->l->type;
+        if (is_fpnum(node_l(node)->type)) {
+            const struct data_type *type = node_l(node)->type;
             const int x0_ = register_from_type(XMM0_, type);
             const int x1_ = register_from_type(XMM1_, type);
-            gen_code(fp, node->l);
+            gen_code(fp, node_l(node));
             gen_push_a(fp, type, x0_);
-            gen_code(fp, node->r);
+            gen_code(fp, node_r(node));
             code3(fp, MOVS, x0_, x1_);
             gen_pop_to(fp, type, x0_);
             code3(fp, UCOMIS, x0_, x1_);
@@ -2513,13 +2618,13 @@ static void gen_code(FILE *fp, const struct ast_node *node)
         break;
 
     case NOD_GE:
-        if (is_fpnum(node->l->type)) {
-            const struct data_type *type = node->l->type;
+        if (is_fpnum(node_l(node)->type)) {
+            const struct data_type *type = node_l(node)->type;
             const int x0_ = register_from_type(XMM0_, type);
             const int x1_ = register_from_type(XMM1_, type);
-            gen_code(fp, node->l);
+            gen_code(fp, node_l(node));
             gen_push_a(fp, type, x0_);
-            gen_code(fp, node->r);
+            gen_code(fp, node_r(node));
             code3(fp, MOVS, x0_, x1_);
             gen_pop_to(fp, type, x0_);
             code3(fp, UCOMIS, x0_, x1_);
@@ -2532,13 +2637,13 @@ static void gen_code(FILE *fp, const struct ast_node *node)
         break;
 
     case NOD_EQ:
-        if (is_fpnum(node->l->type)) {
-            const struct data_type *type = node->l->type;
+        if (is_fpnum(node_l(node)->type)) {
+            const struct data_type *type = node_l(node)->type;
             const int x0_ = register_from_type(XMM0_, type);
             const int x1_ = register_from_type(XMM1_, type);
-            gen_code(fp, node->l);
+            gen_code(fp, node_l(node));
             gen_push_a(fp, type, x0_);
-            gen_code(fp, node->r);
+            gen_code(fp, node_r(node));
             code3(fp, MOVS, x0_, x1_);
             gen_pop_to(fp, type, x0_);
             code3(fp, UCOMIS, x0_, x1_);
@@ -2551,13 +2656,13 @@ static void gen_code(FILE *fp, const struct ast_node *node)
         break;
 
     case NOD_NE:
-        if (is_fpnum(node->l->type)) {
-            const struct data_type *type = node->l->type;
+        if (is_fpnum(node_l(node)->type)) {
+            const struct data_type *type = node_l(node)->type;
             const int x0_ = register_from_type(XMM0_, type);
             const int x1_ = register_from_type(XMM1_, type);
-            gen_code(fp, node->l);
+            gen_code(fp, node_l(node));
             gen_push_a(fp, type, x0_);
-            gen_code(fp, node->r);
+            gen_code(fp, node_r(node));
             code3(fp, MOVS, x0_, x1_);
             gen_pop_to(fp, type, x0_);
             code3(fp, UCOMIS, x0_, x1_);
@@ -2574,19 +2679,20 @@ static void gen_code(FILE *fp, const struct ast_node *node)
     }
 }
 
-static void gen_global_vars(FILE *fp, const struct ast_node *node)
+static void gen_global_vars(FILE *fp, const struct ast_node *tree)
 {
-    if (!node)
-        return;
+    struct ast_walker walk;
+    const struct ast_node *node;
 
-    if (node->kind == NOD_DECL_IDENT) {
-        if (is_global_var(node->sym))
-            gen_initializer(fp, node, node->l);
-        return;
+    begin_ast_walk(&walk, tree);
+    while ((node = next_ast_node(&walk)) != NULL) {
+        if (node->kind == NOD_DECL_IDENT) {
+            if (is_global_var(node->sym))
+                gen_initializer(fp, node, node_l(node));
+            skip_ast_children(&walk);
+        }
     }
-
-    gen_global_vars(fp, node->l);
-    gen_global_vars(fp, node->r);
+    end_ast_walk(&walk);
 }
 
 static void gen_string_literal(FILE *fp, const struct symbol_table *table)
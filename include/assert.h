@@ -5,6 +5,6 @@
 #include <stdlib.h>
 
 #define assert(expr) \
-    (expr) ? ((void)0) : (fprintf(stderr, "Assertion failed: (expr)\n"), abort())
+    (expr) ? ((void)0) : (fprintf(stderr, "Assertion failed: (%s)\n", #expr), abort())
 
 #endif /* __ASSERT_H */
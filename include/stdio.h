@@ -19,6 +19,8 @@ FILE *fopen(const char *path, const char *mode);
 int fclose(FILE *stream);
 
 int fgetc(FILE *stream);
+size_t fread(void *ptr, size_t size, size_t count, FILE *stream);
+size_t fwrite(const void *ptr, size_t size, size_t count, FILE *stream);
 int ungetc(int c, FILE *stream);
 
 int fprintf(FILE *stream, const char *format, ...);
@@ -5,10 +5,15 @@
 
 size_t strlen(const char *s);
 int strcmp(const char *s1, const char *s2);
+int memcmp(const void *s1, const void *s2, size_t n);
 
 char *strcpy(char * dst, const char *src);
 char *strncpy(char * dst, const char *src, size_t len);
 
 char *strchr(const char *s, int c);
 
+void *memset(void *b, int c, size_t len);
+void *memcpy(void *dst, const void *src, size_t n);
+void *memchr(const void *s, int c, size_t n);
+
 #endif /* __STRING_H */
@@ -0,0 +1,15 @@
+#ifndef __TIME_H
+#define __TIME_H
+
+struct timespec {
+    long tv_sec;
+    long tv_nsec;
+};
+
+typedef int clockid_t;
+
+#define CLOCK_MONOTONIC 6
+
+int clock_gettime(clockid_t clock_id, struct timespec *tp);
+
+#endif /* __TIME_H */
@@ -0,0 +1,6350 @@
+    .data
+
+_char_class_618:
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+
+_keywords_639:
+    .quad _L_str_640
+    .long 132
+    .zero 1
+    .zero 1
+    .zero 1
+    .zero 1
+    .quad _L_str_641
+    .long 133
+    .zero 1
+    .zero 1
+    .zero 1
+    .zero 1
+    .quad _L_str_642
+    .long 134
+    .zero 1
+    .zero 1
+    .zero 1
+    .zero 1
+    .quad _L_str_643
+    .long 135
+    .zero 1
+    .zero 1
+    .zero 1
+    .zero 1
+    .quad _L_str_644
+    .long 136
+    .zero 1
+    .zero 1
+    .zero 1
+    .zero 1
+    .quad _L_str_645
+    .long 137
+    .zero 1
+    .zero 1
+    .zero 1
+    .zero 1
+    .quad _L_str_646
+    .long 138
+    .zero 1
+    .zero 1
+    .zero 1
+    .zero 1
+    .quad _L_str_647
+    .long 139
+    .zero 1
+    .zero 1
+    .zero 1
+    .zero 1
+    .quad _L_str_648
+    .long 140
+    .zero 1
+    .zero 1
+    .zero 1
+    .zero 1
+    .quad _L_str_649
+    .long 141
+    .zero 1
+    .zero 1
+    .zero 1
+    .zero 1
+    .quad _L_str_650
+    .long 142
+    .zero 1
+    .zero 1
+    .zero 1
+    .zero 1
+    .quad _L_str_651
+    .long 143
+    .zero 1
+    .zero 1
+    .zero 1
+    .zero 1
+    .quad _L_str_652
+    .long 144
+    .zero 1
+    .zero 1
+    .zero 1
+    .zero 1
+    .quad _L_str_653
+    .long 145
+    .zero 1
+    .zero 1
+    .zero 1
+    .zero 1
+    .quad _L_str_654
+    .long 146
+    .zero 1
+    .zero 1
+    .zero 1
+    .zero 1
+    .quad _L_str_655
+    .long 147
+    .zero 1
+    .zero 1
+    .zero 1
+    .zero 1
+    .quad _L_str_656
+    .long 148
+    .zero 1
+    .zero 1
+    .zero 1
+    .zero 1
+    .quad _L_str_657
+    .long 149
+    .zero 1
+    .zero 1
+    .zero 1
+    .zero 1
+    .quad _L_str_658
+    .long 150
+    .zero 1
+    .zero 1
+    .zero 1
+    .zero 1
+    .quad _L_str_659
+    .long 151
+    .zero 1
+    .zero 1
+    .zero 1
+    .zero 1
+    .quad _L_str_660
+    .long 152
+    .zero 1
+    .zero 1
+    .zero 1
+    .zero 1
+    .quad _L_str_661
+    .long 153
+    .zero 1
+    .zero 1
+    .zero 1
+    .zero 1
+    .quad _L_str_662
+    .long 154
+    .zero 1
+    .zero 1
+    .zero 1
+    .zero 1
+    .quad _L_str_663
+    .long 155
+    .zero 1
+    .zero 1
+    .zero 1
+    .zero 1
+    .quad _L_str_664
+    .long 156
+    .zero 1
+    .zero 1
+    .zero 1
+    .zero 1
+    .quad _L_str_665
+    .long 157
+    .zero 1
+    .zero 1
+    .zero 1
+    .zero 1
+    .quad _L_str_666
+    .long 158
+    .zero 1
+    .zero 1
+    .zero 1
+    .zero 1
+    .quad _L_str_667
+    .long 159
+    .zero 1
+    .zero 1
+    .zero 1
+    .zero 1
+    .quad _L_str_668
+    .long 160
+    .zero 1
+    .zero 1
+    .zero 1
+    .zero 1
+
+_keyword_table_669:
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+    .quad 0
+
+_no_value_766:
+    .quad 0
+    .quad 0
+
+    .text
+
+_L_str_640:
+    .asciz "if"
+
+_L_str_641:
+    .asciz "else"
+
+_L_str_642:
+    .asciz "switch"
+
+_L_str_643:
+    .asciz "case"
+
+_L_str_644:
+    .asciz "default"
+
+_L_str_645:
+    .asciz "do"
+
+_L_str_646:
+    .asciz "for"
+
+_L_str_647:
+    .asciz "while"
+
+_L_str_648:
+    .asciz "break"
+
+_L_str_649:
+    .asciz "continue"
+
+_L_str_650:
+    .asciz "return"
+
+_L_str_651:
+    .asciz "goto"
+
+_L_str_652:
+    .asciz "sizeof"
+
+_L_str_653:
+    .asciz "struct"
+
+_L_str_654:
+    .asciz "union"
+
+_L_str_655:
+    .asciz "enum"
+
+_L_str_656:
+    .asciz "typedef"
+
+_L_str_657:
+    .asciz "extern"
+
+_L_str_658:
+    .asciz "static"
+
+_L_str_659:
+    .asciz "const"
+
+_L_str_660:
+    .asciz "void"
+
+_L_str_661:
+    .asciz "char"
+
+_L_str_662:
+    .asciz "short"
+
+_L_str_663:
+    .asciz "int"
+
+_L_str_664:
+    .asciz "long"
+
+_L_str_665:
+    .asciz "float"
+
+_L_str_666:
+    .asciz "double"
+
+_L_str_667:
+    .asciz "signed"
+
+_L_str_668:
+    .asciz "unsigned"
+
+_L_str_687:
+    .asciz "Assertion failed: (%s)\012"
+
+_L_str_688:
+    .asciz "!keyword_table[h] || keyword_table[h] == kw"
+
+_L_str_834:
+    .asciz ""
+
+_L_str_922:
+    .asciz "error: unterminated /* comment\012"
+
+_L_str_975:
+    .asciz "error: missing terminating '\"' character\012"
+
+_L_str_1065:
+    .asciz "++"
+
+_L_str_1066:
+    .asciz "+="
+
+_L_str_1069:
+    .asciz "--"
+
+_L_str_1070:
+    .asciz "-="
+
+_L_str_1071:
+    .asciz "->"
+
+_L_str_1074:
+    .asciz "*="
+
+_L_str_1077:
+    .asciz "/="
+
+_L_str_1080:
+    .asciz "%="
+
+_L_str_1083:
+    .asciz "=="
+
+_L_str_1086:
+    .asciz "!="
+
+_L_str_1089:
+    .asciz "<="
+
+_L_str_1090:
+    .asciz "<<="
+
+_L_str_1093:
+    .asciz ">="
+
+_L_str_1094:
+    .asciz ">>="
+
+_L_str_1097:
+    .asciz "||"
+
+_L_str_1098:
+    .asciz "|="
+
+_L_str_1101:
+    .asciz "&&"
+
+_L_str_1102:
+    .asciz "&="
+
+_L_str_1105:
+    .asciz "^="
+
+_L_str_1107:
+    .asciz "(){}[]:;,?~"
+
+_L_str_1121:
+    .asciz "(%d) => "
+
+_L_str_1123:
+    .asciz "\"\\n\"\012"
+
+_L_str_1126:
+    .asciz "\"%c\"\012"
+
+_L_str_1164:
+    .asciz "\"%s\"\012"
+
+_L_str_1177:
+    .asciz "<<"
+
+_L_str_1179:
+    .asciz ">>"
+
+_L_str_1194:
+    .asciz "..."
+
+_L_str_1196:
+    .asciz "EOF"
+
+_readc:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    movb  (%rax), %al
+    movsbl %al, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB1_3
+## if-then
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    jmp   _LBB0_0
+    jmp   _LBB1_2
+## if-else
+_LBB1_3:
+_LBB1_2:
+    movl  -12(%rbp), %eax
+    jmp   _LBB0_0
+_LBB0_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_unreadc:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+## func body
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB3_3
+## if-then
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    subq  $1, %rcx
+    movq  %rcx, (%rdx)
+    jmp   _LBB3_2
+## if-else
+_LBB3_3:
+_LBB3_2:
+_LBB2_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_offset_of:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+    movq  -8(%rbp), %rax
+    addq  $32, %rax
+    movl  (%rax), %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    jmp   _LBB4_0
+_LBB4_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_init_char_class:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+## func body
+## for-pre
+## assign
+    leaq  -4(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB6_1:
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  $256, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB6_2
+## for-body
+## if-cond
+    subq  $16, %rsp
+    movl  -4(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _isspace
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB7_3
+## if-then
+## or-assign
+    leaq  _char_class_618(%rip), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  -4(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    orb   %al, (%rdx)
+    movb  (%rdx), %al
+    jmp   _LBB7_2
+## if-else
+_LBB7_3:
+_LBB7_2:
+## if-cond
+    subq  $16, %rsp
+    movl  -4(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _isdigit
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB8_3
+## if-then
+## or-assign
+    leaq  _char_class_618(%rip), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  -4(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    orb   %al, (%rdx)
+    movb  (%rdx), %al
+    jmp   _LBB8_2
+## if-else
+_LBB8_3:
+_LBB8_2:
+## if-cond
+    subq  $16, %rsp
+    movl  -4(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _isalnum
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB10_2
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  $95, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB10_2
+    movl  $0, %eax
+_LBB10_2:
+    cmpl  $0, %eax
+    je    _LBB9_3
+## if-then
+## or-assign
+    leaq  _char_class_618(%rip), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  -4(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $4, %eax
+    popq  %rdx
+    orb   %al, (%rdx)
+    movb  (%rdx), %al
+    jmp   _LBB9_2
+## if-else
+_LBB9_3:
+_LBB9_2:
+## for-post
+_LBB6_4:
+    leaq  -4(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB6_1
+_LBB6_2:
+## or-assign
+    leaq  _char_class_618(%rip), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $8, %eax
+    popq  %rdx
+    orb   %al, (%rdx)
+    movb  (%rdx), %al
+## or-assign
+    leaq  _char_class_618(%rip), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $10, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $8, %eax
+    popq  %rdx
+    orb   %al, (%rdx)
+    movb  (%rdx), %al
+## or-assign
+    leaq  _char_class_618(%rip), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $42, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $8, %eax
+    popq  %rdx
+    orb   %al, (%rdx)
+    movb  (%rdx), %al
+## or-assign
+    leaq  _char_class_618(%rip), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $34, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $8, %eax
+    popq  %rdx
+    orb   %al, (%rdx)
+    movb  (%rdx), %al
+## or-assign
+    leaq  _char_class_618(%rip), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $92, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $8, %eax
+    popq  %rdx
+    orb   %al, (%rdx)
+    movb  (%rdx), %al
+_LBB5_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_is_class:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movl  %edi, -4(%rbp)
+    movl  %esi, -8(%rbp)
+## func body
+    leaq  _char_class_618(%rip), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  -4(%rbp), %eax
+    movzbl %al, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movzbl %al, %eax
+    pushq %rax
+    movl  -8(%rbp), %eax
+    popq  %rdx
+    andl  %edx, %eax
+    jmp   _LBB11_0
+_LBB11_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_keyword_hash:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -17(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -18(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    popq  %rdx
+    movb  %al, (%rdx)
+    movl  $5, %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    pushq %rax
+    movl  $14, %eax
+    pushq %rax
+    movb  -17(%rbp), %al
+    movzbl %al, %eax
+    popq  %rdx
+    imull %edx, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $5, %eax
+    pushq %rax
+    movb  -18(%rbp), %al
+    movzbl %al, %eax
+    popq  %rdx
+    imull %edx, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $64, %eax
+    movslq %eax, %rax
+    movq  %rax, %rdi
+    popq  %rax
+    xorq  %rdx, %rdx
+    divq  %rdi
+    movq  %rdx, %rax
+    jmp   _LBB12_0
+_LBB12_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_init_keyword_table:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+## func body
+## local scalar init
+    leaq  -4(%rbp), %rax
+    pushq %rax
+    movl  $464, %eax
+    pushq %rax
+    movl  $16, %eax
+    movl  %eax, %edi
+    popq  %rax
+    cltd
+    idivl %edi
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-pre
+## assign
+    leaq  -8(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB14_1:
+    movl  -8(%rbp), %eax
+    pushq %rax
+    movl  -4(%rbp), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB14_2
+## for-body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    leaq  _keywords_639(%rip), %rax
+    pushq %rax
+    movl  $16, %eax
+    pushq %rax
+    movl  -8(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _strlen
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _keyword_hash
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## cond-?
+    leaq  _keyword_table_669(%rip), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -20(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB16_2
+    leaq  _keyword_table_669(%rip), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -20(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB16_2
+    movl  $0, %eax
+_LBB16_2:
+    cmpq  $0, %rax
+    je    _LBB15_3
+## cond-then
+    movl  $0, %eax
+    jmp   _LBB15_2
+## cond-else
+_LBB15_3:
+    subq  $32, %rsp
+    movq  ___stderrp@GOTPCREL(%rip), %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_687(%rip), %rax
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_688(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+    callq _abort
+_LBB15_2:
+## assign
+    leaq  _keyword_table_669(%rip), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -20(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-post
+_LBB14_4:
+    leaq  -8(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB14_1
+_LBB14_2:
+_LBB13_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_keyword_or_identifier:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movq  %rdx, -24(%rbp)
+## func body
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    leaq  _keyword_table_669(%rip), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _keyword_hash
+    addq  $24, %rsp
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -32(%rbp), %rax
+    cmpq  $0, %rax
+    movl  $0, %eax
+    je    _LBB19_2
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  -32(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB19_2
+    movl  $1, %eax
+_LBB19_2:
+    cmpl  $0, %eax
+    je    _LBB18_3
+## if-then
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB18_2
+## if-else
+_LBB18_3:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $130, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+_LBB18_2:
+_LBB17_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_make_text:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _insert_string
+    addq  $16, %rsp
+    jmp   _LBB20_0
+_LBB20_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_make_text_len:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movq  %rdx, -24(%rbp)
+## func body
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _insert_string_len
+    addq  $32, %rsp
+    jmp   _LBB21_0
+_LBB21_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_init_position:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+_LBB22_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _init_token
+_init_token:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $-1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $12, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $4, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _init_position
+    addq  $16, %rsp
+_LBB23_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_init_token_value:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $0, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+_LBB24_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _init_token_array
+_init_token_array:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $20, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $36, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $40, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $44, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+_LBB25_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _clear_token_array
+_clear_token_array:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## for-pre
+## assign
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $40, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB27_1:
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB27_2
+## for-body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+## for-post
+_LBB27_4:
+    leaq  -12(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB27_1
+_LBB27_2:
+## for-pre
+## assign
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $44, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB28_1:
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $32, %rax
+    movl  (%rax), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB28_2
+## for-body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+## for-post
+_LBB28_4:
+    leaq  -12(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB28_1
+_LBB28_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _init_token_array
+    addq  $16, %rsp
+_LBB26_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _token_at
+_token_at:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+## func body
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $1024, %eax
+    movl  %eax, %edi
+    popq  %rax
+    cltd
+    idivl %edi
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $16, %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $1024, %eax
+    movl  %eax, %edi
+    popq  %rax
+    cltd
+    idivl %edi
+    movl  %edx, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    jmp   _LBB29_0
+_LBB29_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_value_at:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+## func body
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $1024, %eax
+    movl  %eax, %edi
+    popq  %rax
+    cltd
+    idivl %edi
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $16, %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $1024, %eax
+    movl  %eax, %edi
+    popq  %rax
+    cltd
+    idivl %edi
+    movl  %edx, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    jmp   _LBB30_0
+_LBB30_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _token_value_of
+_token_value_of:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## if-cond
+    movq  -16(%rbp), %rax
+    addq  $12, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB32_3
+## if-then
+    leaq  _no_value_766(%rip), %rax
+    jmp   _LBB31_0
+    jmp   _LBB32_2
+## if-else
+_LBB32_3:
+_LBB32_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $12, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $1, %eax
+    movl  %eax, %edx
+    popq  %rax
+    subl  %edx, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _value_at
+    addq  $16, %rsp
+    jmp   _LBB31_0
+_LBB31_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _release_tokens
+_release_tokens:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $1024, %eax
+    movl  %eax, %edi
+    popq  %rax
+    cltd
+    idivl %edi
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB35_2
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $20, %rax
+    movl  (%rax), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setge %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB35_2
+    movl  $0, %eax
+_LBB35_2:
+    cmpl  $0, %eax
+    je    _LBB34_3
+## if-then
+    jmp   _LBB33_0
+    jmp   _LBB34_2
+## if-else
+_LBB34_3:
+_LBB34_2:
+## for-pre
+## for-cond
+_LBB36_1:
+    movq  -8(%rbp), %rax
+    addq  $40, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  -16(%rbp), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB36_2
+## for-body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $40, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $40, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-post
+_LBB36_4:
+    movq  -8(%rbp), %rax
+    addq  $40, %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB36_1
+_LBB36_2:
+## assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  -16(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $1024, %eax
+    movl  %eax, %edi
+    popq  %rax
+    cltd
+    idivl %edi
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-pre
+## for-cond
+_LBB37_1:
+    movq  -8(%rbp), %rax
+    addq  $44, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  -20(%rbp), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB37_2
+## for-body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $44, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+## assign
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $44, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-post
+_LBB37_4:
+    movq  -8(%rbp), %rax
+    addq  $44, %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB37_1
+_LBB37_2:
+_LBB33_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_has_token_value:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movl  %edi, -4(%rbp)
+## func body
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  $130, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB42_2
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  $128, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB42_2
+    movl  $0, %eax
+_LBB42_2:
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB41_2
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  $129, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB41_2
+    movl  $0, %eax
+_LBB41_2:
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB40_2
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  $131, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB40_2
+    movl  $0, %eax
+_LBB40_2:
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB39_2
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  $-1, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB39_2
+    movl  $0, %eax
+_LBB39_2:
+    jmp   _LBB38_0
+_LBB38_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_push_token:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $20, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $1024, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB44_3
+## if-then
+## local scalar init
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movl  $8, %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _realloc
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movl  $4, %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _realloc
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    subq  $8, %rsp
+    movl  $16, %eax
+    pushq %rax
+    movl  $1024, %eax
+    popq  %rdx
+    imull %edx, %eax
+    movslq %eax, %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _malloc
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $36, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB44_2
+## if-else
+_LBB44_3:
+_LBB44_2:
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $36, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $32, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $1024, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB45_3
+## if-then
+## assign
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movl  $8, %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $32, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    imull %edx, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _realloc
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $32, %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    subq  $8, %rsp
+    movl  $16, %eax
+    pushq %rax
+    movl  $1024, %eax
+    popq  %rdx
+    imull %edx, %eax
+    movslq %eax, %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _malloc
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB45_2
+## if-else
+_LBB45_3:
+_LBB45_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $20, %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _token_at
+    addq  $16, %rsp
+    jmp   _LBB43_0
+_LBB43_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _read_next_token
+_read_next_token:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _push_token
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $36, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _value_at
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _get_next_token
+    addq  $32, %rsp
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _has_token_value
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB47_3
+## if-then
+## assign
+    movq  -24(%rbp), %rax
+    addq  $12, %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $36, %rax
+    movl  (%rax), %edx
+    addl  $1, %edx
+    movl  %edx, (%rax)
+    movl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB47_2
+## if-else
+_LBB47_3:
+_LBB47_2:
+    movq  -16(%rbp), %rax
+    addq  $20, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $1, %eax
+    movl  %eax, %edx
+    popq  %rax
+    subl  %edx, %eax
+    jmp   _LBB46_0
+_LBB46_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _copy_token_range
+_copy_token_range:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movl  %edx, -20(%rbp)
+    movl  %ecx, -24(%rbp)
+## func body
+## for-pre
+## assign
+    leaq  -36(%rbp), %rax
+    pushq %rax
+    movl  -20(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB49_1:
+    movl  -36(%rbp), %eax
+    pushq %rax
+    movl  -24(%rbp), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setle %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB49_2
+## for-body
+## local scalar init
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movl  8(%rsp), %esi
+    callq _token_at
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _push_token
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -32(%rbp), %rax
+    pushq %rax
+    movq  -48(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+## if-cond
+    movq  -48(%rbp), %rax
+    addq  $12, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    je    _LBB50_3
+## if-then
+## assign
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $36, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _value_at
+    addq  $16, %rsp
+    pushq %rax
+    subq  $24, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -48(%rbp), %rax
+    addq  $12, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $1, %eax
+    movl  %eax, %edx
+    popq  %rax
+    subl  %edx, %eax
+    movl  %eax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movl  8(%rsp), %esi
+    callq _value_at
+    addq  $24, %rsp
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+## assign
+    movq  -32(%rbp), %rax
+    addq  $12, %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $36, %rax
+    movl  (%rax), %edx
+    addl  $1, %edx
+    movl  %edx, (%rax)
+    movl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB50_2
+## if-else
+_LBB50_3:
+_LBB50_2:
+## for-post
+_LBB49_4:
+    leaq  -36(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB49_1
+_LBB49_2:
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _push_token
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -32(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _init_token
+    addq  $16, %rsp
+## assign
+    movq  -32(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $184, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -32(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  -24(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movl  8(%rsp), %esi
+    callq _token_at
+    addq  $24, %rsp
+    addq  $4, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+_LBB48_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _new_lexer
+_new_lexer:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+## func body
+## local scalar init
+    leaq  -8(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movl  $56, %eax
+    movslq %eax, %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _malloc
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    subq  $8, %rsp
+    callq _new_string_table
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    callq _init_char_class
+    callq _init_keyword_table
+## assign
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $40, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $48, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $52, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    movq  -8(%rbp), %rax
+    jmp   _LBB51_0
+_LBB51_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _set_source
+_set_source:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## assign
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    leaq  _L_str_834(%rip), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+_LBB52_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _set_source_text
+_set_source_text:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## assign
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+_LBB53_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_read_next_chunk:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB55_3
+## if-then
+    movl  $0, %eax
+    jmp   _LBB54_0
+    jmp   _LBB55_2
+## if-else
+_LBB55_3:
+_LBB55_2:
+## add-assign
+    movq  -8(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _strlen
+    addq  $8, %rsp
+    popq  %rdx
+    addl  %eax, (%rdx)
+    movl  (%rdx), %eax
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _read_text
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -16(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB56_3
+## if-then
+## assign
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movl  $0, %eax
+    jmp   _LBB54_0
+    jmp   _LBB56_2
+## if-else
+_LBB56_3:
+_LBB56_2:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movl  $1, %eax
+    jmp   _LBB54_0
+_LBB54_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _free_lexer
+_free_lexer:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## if-cond
+    movq  -8(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB58_3
+## if-then
+    jmp   _LBB57_0
+    jmp   _LBB58_2
+## if-else
+_LBB58_3:
+_LBB58_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free_string_table
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $40, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+_LBB57_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_read_escape_sequence:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -12(%rbp), %rax
+    addq  $1, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -12(%rbp), %rax
+    addq  $2, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -12(%rbp), %rax
+    addq  $3, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $92, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## assign
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _readc
+    addq  $8, %rsp
+    popq  %rdx
+    movb  %al, (%rdx)
+## assign
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    leaq  -12(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _escape_sequence_to_char
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB60_3
+## if-then
+    movl  -16(%rbp), %eax
+    jmp   _LBB59_0
+    jmp   _LBB60_2
+## if-else
+_LBB60_3:
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    jmp   _LBB59_0
+_LBB60_2:
+_LBB59_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_convert_escape_sequence:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-pre
+## for-cond
+_LBB62_1:
+    movl  $1, %eax
+    cmpl  $0, %eax
+    je    _LBB62_2
+## for-body
+## if-cond
+    movq  -24(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $92, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB63_3
+## if-then
+## local scalar init
+    leaq  -44(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -44(%rbp), %rax
+    addq  $1, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -44(%rbp), %rax
+    addq  $2, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -44(%rbp), %rax
+    addq  $3, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    leaq  -24(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+## assign
+    leaq  -44(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $92, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## assign
+    leaq  -44(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    movb  (%rax), %al
+    popq  %rdx
+    movb  %al, (%rdx)
+## assign
+    leaq  -44(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    leaq  -44(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  -48(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _escape_sequence_to_char
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB64_3
+## if-then
+## assign
+    movq  -32(%rbp), %rax
+    pushq %rax
+    movl  -48(%rbp), %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+    jmp   _LBB64_2
+## if-else
+_LBB64_3:
+## if-cond
+    movq  -24(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $120, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB65_3
+## if-then
+    leaq  -24(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+## assign
+    movq  -32(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    leaq  -40(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $16, %eax
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movl  (%rsp), %edx
+    callq _strtol
+    addq  $24, %rsp
+    popq  %rdx
+    movb  %al, (%rdx)
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -40(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB65_2
+## if-else
+_LBB65_3:
+## assign
+    movq  -32(%rbp), %rax
+    pushq %rax
+    movl  $92, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+    leaq  -32(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+## assign
+    movq  -32(%rbp), %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    movb  (%rax), %al
+    popq  %rdx
+    movb  %al, (%rdx)
+_LBB65_2:
+_LBB64_2:
+    jmp   _LBB63_2
+## if-else
+_LBB63_3:
+## assign
+    movq  -32(%rbp), %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    movb  (%rax), %al
+    popq  %rdx
+    movb  %al, (%rdx)
+_LBB63_2:
+## if-cond
+    movq  -32(%rbp), %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB66_3
+## if-then
+    jmp   _LBB62_2
+    jmp   _LBB66_2
+## if-else
+_LBB66_3:
+_LBB66_2:
+    leaq  -32(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    leaq  -24(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+## for-post
+_LBB62_4:
+    jmp   _LBB62_1
+_LBB62_2:
+    movq  -16(%rbp), %rax
+    jmp   _LBB61_0
+_LBB61_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_skip_spaces:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## while-cond
+_LBB68_4:
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, 8(%rsp)
+    movl  $1, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _is_class
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB68_2
+## while-body
+    leaq  -16(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    jmp   _LBB68_4
+_LBB68_2:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+_LBB67_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_skip_line_comment:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## for-pre
+## for-cond
+_LBB70_1:
+    movl  $1, %eax
+    cmpl  $0, %eax
+    je    _LBB70_2
+## for-body
+## local scalar init
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _readc
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $10, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB71_3
+## if-then
+    jmp   _LBB70_2
+    jmp   _LBB71_2
+## if-else
+_LBB71_3:
+_LBB71_2:
+## for-post
+_LBB70_4:
+    jmp   _LBB70_1
+_LBB70_2:
+_LBB69_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_skip_block_comment:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## for-pre
+## for-cond
+_LBB73_1:
+    movl  $1, %eax
+    cmpl  $0, %eax
+    je    _LBB73_2
+## for-body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## while-cond
+_LBB74_4:
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, 8(%rsp)
+    movl  $8, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _is_class
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB74_2
+## while-body
+    leaq  -16(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    jmp   _LBB74_4
+_LBB74_2:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _readc
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  -20(%rbp), %eax
+    pushq %rax
+    movl  $42, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB75_3
+## if-then
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _readc
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  -24(%rbp), %eax
+    pushq %rax
+    movl  $47, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB76_3
+## if-then
+    jmp   _LBB72_0
+    jmp   _LBB76_2
+## if-else
+_LBB76_3:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -24(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _unreadc
+    addq  $16, %rsp
+    jmp   _LBB73_4
+_LBB76_2:
+    jmp   _LBB75_2
+## if-else
+_LBB75_3:
+## if-cond
+    movl  -20(%rbp), %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB77_3
+## if-then
+    subq  $16, %rsp
+    leaq  _L_str_922(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    jmp   _LBB72_0
+    jmp   _LBB77_2
+## if-else
+_LBB77_3:
+_LBB77_2:
+_LBB75_2:
+## for-post
+_LBB73_4:
+    jmp   _LBB73_1
+_LBB73_2:
+_LBB72_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_scan_number:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movq  %rdx, -24(%rbp)
+## func body
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -44(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-pre
+## for-cond
+_LBB79_1:
+    subq  $16, %rsp
+    movq  -40(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, 8(%rsp)
+    movl  $2, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _is_class
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB80_2
+    movq  -40(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $46, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB80_2
+    movl  $0, %eax
+_LBB80_2:
+    cmpl  $0, %eax
+    je    _LBB79_2
+## for-body
+## if-cond
+    movq  -40(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $46, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB81_3
+## if-then
+## assign
+    leaq  -44(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB81_2
+## if-else
+_LBB81_3:
+_LBB81_2:
+## for-post
+_LBB79_4:
+    leaq  -40(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    jmp   _LBB79_1
+_LBB79_2:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    movq  -40(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -32(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -40(%rbp), %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    movq  %rax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _make_text_len
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movl  -44(%rbp), %eax
+    cmpl  $0, %eax
+    je    _LBB82_3
+## if-then
+## assign
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $129, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB82_2
+## if-else
+_LBB82_3:
+## assign
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $128, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movl  $0, %eax
+    movq  %rax, 8(%rsp)
+    movl  $10, %eax
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movl  (%rsp), %edx
+    callq _strtol
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+_LBB82_2:
+_LBB78_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_scan_word:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movq  %rdx, -24(%rbp)
+## func body
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## while-cond
+_LBB84_4:
+    subq  $16, %rsp
+    movq  -40(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, 8(%rsp)
+    movl  $4, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _is_class
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB84_2
+## while-body
+    leaq  -40(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    jmp   _LBB84_4
+_LBB84_2:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    movq  -40(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -32(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -40(%rbp), %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    movq  %rax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _make_text_len
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $32, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -40(%rbp), %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _keyword_or_identifier
+    addq  $32, %rsp
+_LBB83_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_grow_literal_buffer:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+## func body
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $48, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $52, %rax
+    movl  (%rax), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB86_3
+## if-then
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+## cond-?
+    movq  -8(%rbp), %rax
+    addq  $52, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    je    _LBB87_3
+## cond-then
+    movq  -8(%rbp), %rax
+    addq  $52, %rax
+    movl  (%rax), %eax
+    jmp   _LBB87_2
+## cond-else
+_LBB87_3:
+    movl  $1024, %eax
+_LBB87_2:
+    popq  %rdx
+    movl  %eax, (%rdx)
+## while-cond
+_LBB88_4:
+    movq  -8(%rbp), %rax
+    addq  $48, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    pushq %rax
+    movl  -16(%rbp), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB88_2
+## while-body
+## mul-assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull (%rdx), %eax
+    movl  %eax, (%rdx)
+    jmp   _LBB88_4
+_LBB88_2:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $40, %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    addq  $40, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movl  -16(%rbp), %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _realloc
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $52, %rax
+    pushq %rax
+    movl  -16(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB86_2
+## if-else
+_LBB86_3:
+_LBB86_2:
+    movq  -8(%rbp), %rax
+    addq  $40, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $48, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    jmp   _LBB85_0
+_LBB85_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_scan_string_literal:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movq  %rdx, -24(%rbp)
+## func body
+## assign
+    movq  -8(%rbp), %rax
+    addq  $48, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-pre
+## for-cond
+_LBB90_1:
+    movl  $1, %eax
+    cmpl  $0, %eax
+    je    _LBB90_2
+## for-body
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## while-cond
+_LBB91_4:
+    subq  $16, %rsp
+    movq  -32(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, 8(%rsp)
+    movl  $8, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _is_class
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB91_2
+## while-body
+    leaq  -32(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    jmp   _LBB91_4
+_LBB91_2:
+    subq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -32(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _grow_literal_buffer
+    addq  $16, %rsp
+    movq  %rax, 24(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movq  -32(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _memcpy
+    addq  $32, %rsp
+## add-assign
+    movq  -8(%rbp), %rax
+    addq  $48, %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    popq  %rdx
+    addl  %eax, (%rdx)
+    movl  (%rdx), %eax
+## assign
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -36(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _readc
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  -36(%rbp), %eax
+    pushq %rax
+    movl  $34, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB94_2
+    movl  -36(%rbp), %eax
+    pushq %rax
+    movl  $10, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB94_2
+    movl  $0, %eax
+_LBB94_2:
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB93_2
+    movl  -36(%rbp), %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB93_2
+    movl  $0, %eax
+_LBB93_2:
+    cmpl  $0, %eax
+    je    _LBB92_3
+## if-then
+## if-cond
+    movl  -36(%rbp), %eax
+    pushq %rax
+    movl  $34, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB95_3
+## if-then
+    subq  $16, %rsp
+    leaq  _L_str_975(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _unreadc
+    addq  $16, %rsp
+    jmp   _LBB95_2
+## if-else
+_LBB95_3:
+_LBB95_2:
+## assign
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _grow_literal_buffer
+    addq  $16, %rsp
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $40, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $40, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _convert_escape_sequence
+    addq  $16, %rsp
+## assign
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $40, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _make_text
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $131, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB89_0
+    jmp   _LBB92_2
+## if-else
+_LBB92_3:
+## if-cond
+    movl  -36(%rbp), %eax
+    pushq %rax
+    movl  $92, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB96_3
+## if-then
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _readc
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  $2, %eax
+    movl  %eax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movl  8(%rsp), %esi
+    callq _grow_literal_buffer
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -48(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  -36(%rbp), %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## assign
+    movq  -48(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  -40(%rbp), %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## add-assign
+    movq  -8(%rbp), %rax
+    addq  $48, %rax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    addl  %eax, (%rdx)
+    movl  (%rdx), %eax
+## if-cond
+    movl  -40(%rbp), %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB97_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -40(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _unreadc
+    addq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $48, %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    subl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB97_2
+## if-else
+_LBB97_3:
+_LBB97_2:
+    jmp   _LBB90_4
+    jmp   _LBB96_2
+## if-else
+_LBB96_3:
+## assign
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $1, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _grow_literal_buffer
+    addq  $16, %rsp
+    pushq %rax
+    movl  -36(%rbp), %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+    movq  -8(%rbp), %rax
+    addq  $48, %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB90_4
+_LBB96_2:
+_LBB92_2:
+## for-post
+_LBB90_4:
+    jmp   _LBB90_1
+_LBB90_2:
+_LBB89_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_scan_char_literal:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movq  %rdx, -24(%rbp)
+## func body
+## local scalar init
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _readc
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movl  $92, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB99_3
+## if-then
+## assign
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _read_escape_sequence
+    addq  $8, %rsp
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB99_2
+## if-else
+_LBB99_3:
+## assign
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  -28(%rbp), %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+_LBB99_2:
+## assign
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $128, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _readc
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movl  $39, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB100_3
+## if-then
+    jmp   _LBB100_2
+## if-else
+_LBB100_3:
+_LBB100_2:
+_LBB98_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_match_one_more:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movq  %rdx, -24(%rbp)
+    movl  %ecx, -28(%rbp)
+    movl  %r8d, -32(%rbp)
+## func body
+## assign
+    leaq  -36(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _readc
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  -36(%rbp), %eax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB102_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _unreadc
+    addq  $16, %rsp
+## assign
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  -28(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    movl  $0, %eax
+    jmp   _LBB101_0
+    jmp   _LBB102_2
+## if-else
+_LBB102_3:
+_LBB102_2:
+## assign
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  -32(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    movl  $1, %eax
+    jmp   _LBB101_0
+_LBB101_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_match_two_more:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movq  %rdx, -24(%rbp)
+    movl  %ecx, -28(%rbp)
+    movl  %r8d, -32(%rbp)
+    movl  %r9d, -36(%rbp)
+## func body
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _readc
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  -40(%rbp), %eax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB104_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -40(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _unreadc
+    addq  $16, %rsp
+## assign
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  -28(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    movl  $0, %eax
+    jmp   _LBB103_0
+    jmp   _LBB104_2
+## if-else
+_LBB104_3:
+_LBB104_2:
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _readc
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  -40(%rbp), %eax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB105_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -40(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _unreadc
+    addq  $16, %rsp
+## assign
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  -32(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    movl  $1, %eax
+    jmp   _LBB103_0
+    jmp   _LBB105_2
+## if-else
+_LBB105_3:
+_LBB105_2:
+## assign
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  -36(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    movl  $2, %eax
+    jmp   _LBB103_0
+_LBB103_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _get_next_token
+_get_next_token:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movq  %rdx, -24(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _init_token
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _init_token_value
+    addq  $16, %rsp
+## for-pre
+## for-cond
+_LBB107_1:
+    movl  $1, %eax
+    cmpl  $0, %eax
+    je    _LBB107_2
+## for-body
+## local scalar init
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _readc
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -16(%rbp), %rax
+    addq  $4, %rax
+    addq  $0, %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $1, %eax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _offset_of
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movl  -28(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  $1, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _is_class
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB108_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _skip_spaces
+    addq  $16, %rsp
+    jmp   _LBB107_4
+    jmp   _LBB108_2
+## if-else
+_LBB108_3:
+_LBB108_2:
+## if-cond
+    subq  $16, %rsp
+    movl  -28(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  $2, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _is_class
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB109_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -28(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _unreadc
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _scan_number
+    addq  $32, %rsp
+    jmp   _LBB107_2
+    jmp   _LBB109_2
+## if-else
+_LBB109_3:
+_LBB109_2:
+## if-cond
+    subq  $16, %rsp
+    movl  -28(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _isalpha
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB111_2
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movl  $95, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB111_2
+    movl  $0, %eax
+_LBB111_2:
+    cmpl  $0, %eax
+    je    _LBB110_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -28(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _unreadc
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _scan_word
+    addq  $32, %rsp
+    jmp   _LBB107_2
+    jmp   _LBB110_2
+## if-else
+_LBB110_3:
+_LBB110_2:
+## if-cond
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movl  $34, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB112_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _scan_string_literal
+    addq  $32, %rsp
+    jmp   _LBB107_2
+    jmp   _LBB112_2
+## if-else
+_LBB112_3:
+_LBB112_2:
+## if-cond
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movl  $39, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB113_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _scan_char_literal
+    addq  $32, %rsp
+    jmp   _LBB107_2
+    jmp   _LBB113_2
+## if-else
+_LBB113_3:
+_LBB113_2:
+## if-cond
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movl  $47, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB114_3
+## if-then
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _readc
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  -32(%rbp), %eax
+    pushq %rax
+    movl  $47, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB115_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _skip_line_comment
+    addq  $16, %rsp
+    jmp   _LBB107_4
+    jmp   _LBB115_2
+## if-else
+_LBB115_3:
+## if-cond
+    movl  -32(%rbp), %eax
+    pushq %rax
+    movl  $42, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB116_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _skip_block_comment
+    addq  $16, %rsp
+    jmp   _LBB107_4
+    jmp   _LBB116_2
+## if-else
+_LBB116_3:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -32(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _unreadc
+    addq  $16, %rsp
+_LBB116_2:
+_LBB115_2:
+    jmp   _LBB114_2
+## if-else
+_LBB114_3:
+_LBB114_2:
+## if-cond
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movl  $46, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB117_3
+## if-then
+## local scalar init
+    leaq  -36(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _readc
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  -36(%rbp), %eax
+    pushq %rax
+    movl  $46, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB118_3
+## if-then
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _readc
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  -40(%rbp), %eax
+    pushq %rax
+    movl  $46, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB119_3
+## if-then
+## assign
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $183, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB107_2
+    jmp   _LBB119_2
+## if-else
+_LBB119_3:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -40(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _unreadc
+    addq  $16, %rsp
+_LBB119_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _unreadc
+    addq  $16, %rsp
+    jmp   _LBB118_2
+## if-else
+_LBB118_3:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _unreadc
+    addq  $16, %rsp
+_LBB118_2:
+## assign
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  -28(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB107_2
+    jmp   _LBB117_2
+## if-else
+_LBB117_3:
+_LBB117_2:
+## if-cond
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movl  $43, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB120_3
+## if-then
+## if-cond
+    subq  $48, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 40(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 32(%rsp)
+    leaq  _L_str_1065(%rip), %rax
+    movq  %rax, 24(%rsp)
+    movl  -28(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    movl  $162, %eax
+    movl  %eax, 8(%rsp)
+    movq  40(%rsp), %rdi
+    movq  32(%rsp), %rsi
+    movq  24(%rsp), %rdx
+    movl  16(%rsp), %ecx
+    movl  8(%rsp), %r8d
+    callq _match_one_more
+    addq  $48, %rsp
+    cmpl  $0, %eax
+    je    _LBB121_3
+## if-then
+    jmp   _LBB107_2
+    jmp   _LBB121_2
+## if-else
+_LBB121_3:
+_LBB121_2:
+    subq  $48, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 40(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 32(%rsp)
+    leaq  _L_str_1066(%rip), %rax
+    movq  %rax, 24(%rsp)
+    movl  -28(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    movl  $173, %eax
+    movl  %eax, 8(%rsp)
+    movq  40(%rsp), %rdi
+    movq  32(%rsp), %rsi
+    movq  24(%rsp), %rdx
+    movl  16(%rsp), %ecx
+    movl  8(%rsp), %r8d
+    callq _match_one_more
+    addq  $48, %rsp
+    jmp   _LBB107_2
+    jmp   _LBB120_2
+## if-else
+_LBB120_3:
+_LBB120_2:
+## if-cond
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movl  $45, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB122_3
+## if-then
+## if-cond
+    subq  $48, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 40(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 32(%rsp)
+    leaq  _L_str_1069(%rip), %rax
+    movq  %rax, 24(%rsp)
+    movl  -28(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    movl  $163, %eax
+    movl  %eax, 8(%rsp)
+    movq  40(%rsp), %rdi
+    movq  32(%rsp), %rsi
+    movq  24(%rsp), %rdx
+    movl  16(%rsp), %ecx
+    movl  8(%rsp), %r8d
+    callq _match_one_more
+    addq  $48, %rsp
+    cmpl  $0, %eax
+    je    _LBB123_3
+## if-then
+    jmp   _LBB107_2
+    jmp   _LBB123_2
+## if-else
+_LBB123_3:
+_LBB123_2:
+## if-cond
+    subq  $48, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 40(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 32(%rsp)
+    leaq  _L_str_1070(%rip), %rax
+    movq  %rax, 24(%rsp)
+    movl  -28(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    movl  $174, %eax
+    movl  %eax, 8(%rsp)
+    movq  40(%rsp), %rdi
+    movq  32(%rsp), %rsi
+    movq  24(%rsp), %rdx
+    movl  16(%rsp), %ecx
+    movl  8(%rsp), %r8d
+    callq _match_one_more
+    addq  $48, %rsp
+    cmpl  $0, %eax
+    je    _LBB124_3
+## if-then
+    jmp   _LBB107_2
+    jmp   _LBB124_2
+## if-else
+_LBB124_3:
+_LBB124_2:
+    subq  $48, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 40(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 32(%rsp)
+    leaq  _L_str_1071(%rip), %rax
+    movq  %rax, 24(%rsp)
+    movl  -28(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    movl  $172, %eax
+    movl  %eax, 8(%rsp)
+    movq  40(%rsp), %rdi
+    movq  32(%rsp), %rsi
+    movq  24(%rsp), %rdx
+    movl  16(%rsp), %ecx
+    movl  8(%rsp), %r8d
+    callq _match_one_more
+    addq  $48, %rsp
+    jmp   _LBB107_2
+    jmp   _LBB122_2
+## if-else
+_LBB122_3:
+_LBB122_2:
+## if-cond
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movl  $42, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB125_3
+## if-then
+    subq  $48, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 40(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 32(%rsp)
+    leaq  _L_str_1074(%rip), %rax
+    movq  %rax, 24(%rsp)
+    movl  -28(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    movl  $175, %eax
+    movl  %eax, 8(%rsp)
+    movq  40(%rsp), %rdi
+    movq  32(%rsp), %rsi
+    movq  24(%rsp), %rdx
+    movl  16(%rsp), %ecx
+    movl  8(%rsp), %r8d
+    callq _match_one_more
+    addq  $48, %rsp
+    jmp   _LBB107_2
+    jmp   _LBB125_2
+## if-else
+_LBB125_3:
+_LBB125_2:
+## if-cond
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movl  $47, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB126_3
+## if-then
+    subq  $48, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 40(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 32(%rsp)
+    leaq  _L_str_1077(%rip), %rax
+    movq  %rax, 24(%rsp)
+    movl  -28(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    movl  $176, %eax
+    movl  %eax, 8(%rsp)
+    movq  40(%rsp), %rdi
+    movq  32(%rsp), %rsi
+    movq  24(%rsp), %rdx
+    movl  16(%rsp), %ecx
+    movl  8(%rsp), %r8d
+    callq _match_one_more
+    addq  $48, %rsp
+    jmp   _LBB107_2
+    jmp   _LBB126_2
+## if-else
+_LBB126_3:
+_LBB126_2:
+## if-cond
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movl  $37, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB127_3
+## if-then
+    subq  $48, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 40(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 32(%rsp)
+    leaq  _L_str_1080(%rip), %rax
+    movq  %rax, 24(%rsp)
+    movl  -28(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    movl  $177, %eax
+    movl  %eax, 8(%rsp)
+    movq  40(%rsp), %rdi
+    movq  32(%rsp), %rsi
+    movq  24(%rsp), %rdx
+    movl  16(%rsp), %ecx
+    movl  8(%rsp), %r8d
+    callq _match_one_more
+    addq  $48, %rsp
+    jmp   _LBB107_2
+    jmp   _LBB127_2
+## if-else
+_LBB127_3:
+_LBB127_2:
+## if-cond
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movl  $61, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB128_3
+## if-then
+    subq  $48, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 40(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 32(%rsp)
+    leaq  _L_str_1083(%rip), %rax
+    movq  %rax, 24(%rsp)
+    movl  -28(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    movl  $166, %eax
+    movl  %eax, 8(%rsp)
+    movq  40(%rsp), %rdi
+    movq  32(%rsp), %rsi
+    movq  24(%rsp), %rdx
+    movl  16(%rsp), %ecx
+    movl  8(%rsp), %r8d
+    callq _match_one_more
+    addq  $48, %rsp
+    jmp   _LBB107_2
+    jmp   _LBB128_2
+## if-else
+_LBB128_3:
+_LBB128_2:
+## if-cond
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movl  $33, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB129_3
+## if-then
+    subq  $48, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 40(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 32(%rsp)
+    leaq  _L_str_1086(%rip), %rax
+    movq  %rax, 24(%rsp)
+    movl  -28(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    movl  $167, %eax
+    movl  %eax, 8(%rsp)
+    movq  40(%rsp), %rdi
+    movq  32(%rsp), %rsi
+    movq  24(%rsp), %rdx
+    movl  16(%rsp), %ecx
+    movl  8(%rsp), %r8d
+    callq _match_one_more
+    addq  $48, %rsp
+    jmp   _LBB107_2
+    jmp   _LBB129_2
+## if-else
+_LBB129_3:
+_LBB129_2:
+## if-cond
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movl  $60, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB130_3
+## if-then
+## if-cond
+    subq  $48, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 40(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 32(%rsp)
+    leaq  _L_str_1089(%rip), %rax
+    movq  %rax, 24(%rsp)
+    movl  -28(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    movl  $164, %eax
+    movl  %eax, 8(%rsp)
+    movq  40(%rsp), %rdi
+    movq  32(%rsp), %rsi
+    movq  24(%rsp), %rdx
+    movl  16(%rsp), %ecx
+    movl  8(%rsp), %r8d
+    callq _match_one_more
+    addq  $48, %rsp
+    cmpl  $0, %eax
+    je    _LBB131_3
+## if-then
+    jmp   _LBB107_2
+    jmp   _LBB131_2
+## if-else
+_LBB131_3:
+_LBB131_2:
+    subq  $48, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 40(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 32(%rsp)
+    leaq  _L_str_1090(%rip), %rax
+    movq  %rax, 24(%rsp)
+    movl  -28(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    movl  $168, %eax
+    movl  %eax, 8(%rsp)
+    movl  $178, %eax
+    movl  %eax, (%rsp)
+    movq  40(%rsp), %rdi
+    movq  32(%rsp), %rsi
+    movq  24(%rsp), %rdx
+    movl  16(%rsp), %ecx
+    movl  8(%rsp), %r8d
+    movl  (%rsp), %r9d
+    callq _match_two_more
+    addq  $48, %rsp
+    jmp   _LBB107_2
+    jmp   _LBB130_2
+## if-else
+_LBB130_3:
+_LBB130_2:
+## if-cond
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movl  $62, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB132_3
+## if-then
+## if-cond
+    subq  $48, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 40(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 32(%rsp)
+    leaq  _L_str_1093(%rip), %rax
+    movq  %rax, 24(%rsp)
+    movl  -28(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    movl  $165, %eax
+    movl  %eax, 8(%rsp)
+    movq  40(%rsp), %rdi
+    movq  32(%rsp), %rsi
+    movq  24(%rsp), %rdx
+    movl  16(%rsp), %ecx
+    movl  8(%rsp), %r8d
+    callq _match_one_more
+    addq  $48, %rsp
+    cmpl  $0, %eax
+    je    _LBB133_3
+## if-then
+    jmp   _LBB107_2
+    jmp   _LBB133_2
+## if-else
+_LBB133_3:
+_LBB133_2:
+    subq  $48, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 40(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 32(%rsp)
+    leaq  _L_str_1094(%rip), %rax
+    movq  %rax, 24(%rsp)
+    movl  -28(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    movl  $169, %eax
+    movl  %eax, 8(%rsp)
+    movl  $179, %eax
+    movl  %eax, (%rsp)
+    movq  40(%rsp), %rdi
+    movq  32(%rsp), %rsi
+    movq  24(%rsp), %rdx
+    movl  16(%rsp), %ecx
+    movl  8(%rsp), %r8d
+    movl  (%rsp), %r9d
+    callq _match_two_more
+    addq  $48, %rsp
+    jmp   _LBB107_2
+    jmp   _LBB132_2
+## if-else
+_LBB132_3:
+_LBB132_2:
+## if-cond
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movl  $124, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB134_3
+## if-then
+## if-cond
+    subq  $48, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 40(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 32(%rsp)
+    leaq  _L_str_1097(%rip), %rax
+    movq  %rax, 24(%rsp)
+    movl  -28(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    movl  $170, %eax
+    movl  %eax, 8(%rsp)
+    movq  40(%rsp), %rdi
+    movq  32(%rsp), %rsi
+    movq  24(%rsp), %rdx
+    movl  16(%rsp), %ecx
+    movl  8(%rsp), %r8d
+    callq _match_one_more
+    addq  $48, %rsp
+    cmpl  $0, %eax
+    je    _LBB135_3
+## if-then
+    jmp   _LBB107_2
+    jmp   _LBB135_2
+## if-else
+_LBB135_3:
+_LBB135_2:
+    subq  $48, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 40(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 32(%rsp)
+    leaq  _L_str_1098(%rip), %rax
+    movq  %rax, 24(%rsp)
+    movl  -28(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    movl  $180, %eax
+    movl  %eax, 8(%rsp)
+    movq  40(%rsp), %rdi
+    movq  32(%rsp), %rsi
+    movq  24(%rsp), %rdx
+    movl  16(%rsp), %ecx
+    movl  8(%rsp), %r8d
+    callq _match_one_more
+    addq  $48, %rsp
+    jmp   _LBB107_2
+    jmp   _LBB134_2
+## if-else
+_LBB134_3:
+_LBB134_2:
+## if-cond
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movl  $38, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB136_3
+## if-then
+## if-cond
+    subq  $48, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 40(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 32(%rsp)
+    leaq  _L_str_1101(%rip), %rax
+    movq  %rax, 24(%rsp)
+    movl  -28(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    movl  $171, %eax
+    movl  %eax, 8(%rsp)
+    movq  40(%rsp), %rdi
+    movq  32(%rsp), %rsi
+    movq  24(%rsp), %rdx
+    movl  16(%rsp), %ecx
+    movl  8(%rsp), %r8d
+    callq _match_one_more
+    addq  $48, %rsp
+    cmpl  $0, %eax
+    je    _LBB137_3
+## if-then
+    jmp   _LBB107_2
+    jmp   _LBB137_2
+## if-else
+_LBB137_3:
+_LBB137_2:
+    subq  $48, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 40(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 32(%rsp)
+    leaq  _L_str_1102(%rip), %rax
+    movq  %rax, 24(%rsp)
+    movl  -28(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    movl  $182, %eax
+    movl  %eax, 8(%rsp)
+    movq  40(%rsp), %rdi
+    movq  32(%rsp), %rsi
+    movq  24(%rsp), %rdx
+    movl  16(%rsp), %ecx
+    movl  8(%rsp), %r8d
+    callq _match_one_more
+    addq  $48, %rsp
+    jmp   _LBB107_2
+    jmp   _LBB136_2
+## if-else
+_LBB136_3:
+_LBB136_2:
+## if-cond
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movl  $94, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB138_3
+## if-then
+    subq  $48, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 40(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 32(%rsp)
+    leaq  _L_str_1105(%rip), %rax
+    movq  %rax, 24(%rsp)
+    movl  -28(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    movl  $181, %eax
+    movl  %eax, 8(%rsp)
+    movq  40(%rsp), %rdi
+    movq  32(%rsp), %rsi
+    movq  24(%rsp), %rdx
+    movl  16(%rsp), %ecx
+    movl  8(%rsp), %r8d
+    callq _match_one_more
+    addq  $48, %rsp
+    jmp   _LBB107_2
+    jmp   _LBB138_2
+## if-else
+_LBB138_3:
+_LBB138_2:
+## if-cond
+    subq  $16, %rsp
+    leaq  _L_str_1107(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movl  -28(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _strchr
+    addq  $16, %rsp
+    cmpq  $0, %rax
+    je    _LBB139_3
+## if-then
+## assign
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  -28(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB107_2
+    jmp   _LBB139_2
+## if-else
+_LBB139_3:
+_LBB139_2:
+## if-cond
+    movl  -28(%rbp), %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB140_3
+## if-then
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _read_next_chunk
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB141_3
+## if-then
+    jmp   _LBB107_4
+    jmp   _LBB141_2
+## if-else
+_LBB141_3:
+_LBB141_2:
+## assign
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $184, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB107_2
+    jmp   _LBB140_2
+## if-else
+_LBB140_3:
+_LBB140_2:
+## assign
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $-1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  -28(%rbp), %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB107_2
+## for-post
+_LBB107_4:
+    jmp   _LBB107_1
+_LBB107_2:
+## assign
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _offset_of
+    addq  $24, %rsp
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $4, %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, %edx
+    popq  %rax
+    subl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    jmp   _LBB106_0
+_LBB106_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _print_token
+_print_token:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+    subq  $16, %rsp
+    leaq  _L_str_1121(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $4, %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $10, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB143_3
+## if-then
+    subq  $16, %rsp
+    leaq  _L_str_1123(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    jmp   _LBB142_0
+    jmp   _LBB143_2
+## if-else
+_LBB143_3:
+_LBB143_2:
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $127, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB144_3
+## if-then
+    subq  $16, %rsp
+    leaq  _L_str_1126(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    jmp   _LBB142_0
+    jmp   _LBB144_2
+## if-else
+_LBB144_3:
+_LBB144_2:
+## switch-value
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+## begin jump table
+    cmpl  $128, %eax
+    je    _LBB145_1230
+    cmpl  $129, %eax
+    je    _LBB145_1231
+    cmpl  $130, %eax
+    je    _LBB145_1232
+    cmpl  $131, %eax
+    je    _LBB145_1233
+    cmpl  $132, %eax
+    je    _LBB145_1234
+    cmpl  $133, %eax
+    je    _LBB145_1235
+    cmpl  $134, %eax
+    je    _LBB145_1236
+    cmpl  $135, %eax
+    je    _LBB145_1237
+    cmpl  $136, %eax
+    je    _LBB145_1238
+    cmpl  $137, %eax
+    je    _LBB145_1239
+    cmpl  $138, %eax
+    je    _LBB145_1240
+    cmpl  $139, %eax
+    je    _LBB145_1241
+    cmpl  $140, %eax
+    je    _LBB145_1242
+    cmpl  $141, %eax
+    je    _LBB145_1243
+    cmpl  $142, %eax
+    je    _LBB145_1244
+    cmpl  $143, %eax
+    je    _LBB145_1245
+    cmpl  $144, %eax
+    je    _LBB145_1246
+    cmpl  $145, %eax
+    je    _LBB145_1247
+    cmpl  $146, %eax
+    je    _LBB145_1248
+    cmpl  $147, %eax
+    je    _LBB145_1249
+    cmpl  $148, %eax
+    je    _LBB145_1250
+    cmpl  $149, %eax
+    je    _LBB145_1251
+    cmpl  $150, %eax
+    je    _LBB145_1252
+    cmpl  $151, %eax
+    je    _LBB145_1253
+    cmpl  $152, %eax
+    je    _LBB145_1254
+    cmpl  $153, %eax
+    je    _LBB145_1255
+    cmpl  $154, %eax
+    je    _LBB145_1256
+    cmpl  $155, %eax
+    je    _LBB145_1257
+    cmpl  $156, %eax
+    je    _LBB145_1258
+    cmpl  $157, %eax
+    je    _LBB145_1259
+    cmpl  $158, %eax
+    je    _LBB145_1260
+    cmpl  $159, %eax
+    je    _LBB145_1261
+    cmpl  $160, %eax
+    je    _LBB145_1262
+    cmpl  $161, %eax
+    je    _LBB145_1263
+    jmp   _LBB145_1265
+    jmp   _LBB145_2
+## end jump table
+_LBB145_1230:
+_LBB145_1231:
+_LBB145_1232:
+_LBB145_1233:
+_LBB145_1234:
+_LBB145_1235:
+_LBB145_1236:
+_LBB145_1237:
+_LBB145_1238:
+_LBB145_1239:
+_LBB145_1240:
+_LBB145_1241:
+_LBB145_1242:
+_LBB145_1243:
+_LBB145_1244:
+_LBB145_1245:
+_LBB145_1246:
+_LBB145_1247:
+_LBB145_1248:
+_LBB145_1249:
+_LBB145_1250:
+_LBB145_1251:
+_LBB145_1252:
+_LBB145_1253:
+_LBB145_1254:
+_LBB145_1255:
+_LBB145_1256:
+_LBB145_1257:
+_LBB145_1258:
+_LBB145_1259:
+_LBB145_1260:
+_LBB145_1261:
+_LBB145_1262:
+_LBB145_1263:
+    subq  $16, %rsp
+    leaq  _L_str_1164(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    jmp   _LBB142_0
+_LBB145_1265:
+    jmp   _LBB145_2
+_LBB145_2:
+## switch-value
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+## begin jump table
+    cmpl  $162, %eax
+    je    _LBB146_1270
+    cmpl  $163, %eax
+    je    _LBB146_1271
+    cmpl  $164, %eax
+    je    _LBB146_1272
+    cmpl  $165, %eax
+    je    _LBB146_1273
+    cmpl  $166, %eax
+    je    _LBB146_1274
+    cmpl  $167, %eax
+    je    _LBB146_1275
+    cmpl  $168, %eax
+    je    _LBB146_1276
+    cmpl  $169, %eax
+    je    _LBB146_1278
+    cmpl  $170, %eax
+    je    _LBB146_1280
+    cmpl  $171, %eax
+    je    _LBB146_1281
+    cmpl  $172, %eax
+    je    _LBB146_1282
+    cmpl  $173, %eax
+    je    _LBB146_1283
+    cmpl  $174, %eax
+    je    _LBB146_1284
+    cmpl  $175, %eax
+    je    _LBB146_1285
+    cmpl  $176, %eax
+    je    _LBB146_1286
+    cmpl  $177, %eax
+    je    _LBB146_1287
+    cmpl  $178, %eax
+    je    _LBB146_1288
+    cmpl  $179, %eax
+    je    _LBB146_1289
+    cmpl  $180, %eax
+    je    _LBB146_1290
+    cmpl  $181, %eax
+    je    _LBB146_1291
+    cmpl  $182, %eax
+    je    _LBB146_1292
+    cmpl  $183, %eax
+    je    _LBB146_1293
+    cmpl  $184, %eax
+    je    _LBB146_1295
+    jmp   _LBB146_1297
+    jmp   _LBB146_2
+## end jump table
+_LBB146_1270:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    leaq  _L_str_1065(%rip), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB146_2
+_LBB146_1271:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    leaq  _L_str_1069(%rip), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB146_2
+_LBB146_1272:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    leaq  _L_str_1089(%rip), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB146_2
+_LBB146_1273:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    leaq  _L_str_1093(%rip), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB146_2
+_LBB146_1274:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    leaq  _L_str_1083(%rip), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB146_2
+_LBB146_1275:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    leaq  _L_str_1086(%rip), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB146_2
+_LBB146_1276:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    leaq  _L_str_1177(%rip), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB146_2
+_LBB146_1278:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    leaq  _L_str_1179(%rip), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB146_2
+_LBB146_1280:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    leaq  _L_str_1097(%rip), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB146_2
+_LBB146_1281:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    leaq  _L_str_1101(%rip), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB146_2
+_LBB146_1282:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    leaq  _L_str_1071(%rip), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB146_2
+_LBB146_1283:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    leaq  _L_str_1066(%rip), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB146_2
+_LBB146_1284:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    leaq  _L_str_1070(%rip), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB146_2
+_LBB146_1285:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    leaq  _L_str_1074(%rip), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB146_2
+_LBB146_1286:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    leaq  _L_str_1077(%rip), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB146_2
+_LBB146_1287:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    leaq  _L_str_1080(%rip), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB146_2
+_LBB146_1288:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    leaq  _L_str_1090(%rip), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB146_2
+_LBB146_1289:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    leaq  _L_str_1094(%rip), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB146_2
+_LBB146_1290:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    leaq  _L_str_1098(%rip), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB146_2
+_LBB146_1291:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    leaq  _L_str_1105(%rip), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB146_2
+_LBB146_1292:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    leaq  _L_str_1102(%rip), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB146_2
+_LBB146_1293:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    leaq  _L_str_1194(%rip), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB146_2
+_LBB146_1295:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    leaq  _L_str_1196(%rip), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB146_2
+_LBB146_1297:
+    jmp   _LBB146_2
+_LBB146_2:
+    subq  $16, %rsp
+    leaq  _L_str_1164(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+_LBB142_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
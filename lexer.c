@@ -1,9 +1,11 @@
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
+#include <assert.h>
 #include "lexer.h"
 #include "string_table.h"
 #include "esc_seq.h"
+#include "preprocessor.h"
 
 static int readc(struct lexer *l)
 {
@@ -12,101 +14,110 @@ static int readc(struct lexer *l)
     if (c == '\0')
         return EOF;
 
-    if (c == '\n') {
-        l->pos.y++;
-        l->prevx = l->pos.x;
-        l->pos.x = 0;
-    } else {
-        l->prevx = l->pos.x;
-        l->pos.x++;
-    }
-
     return c;
 }
 
 static void unreadc(struct lexer *l, int c)
 {
-    if (l->pos.x == 0) {
-        if (l->pos.y > 1)
-            l->pos.y--;
-        else
-            l->pos.y = 1;
-        l->pos.x = l->prevx;
-    } else {
-        l->pos.x--;
-    }
-
     if (l->next != l->head)
         l->next--;
 }
 
-static void keyword_or_identifier(struct token *tok)
-{
-    const char *text = tok->text;
-
-    if (!strcmp(text, "if"))
-        tok->kind = TOK_IF;
-    else if (!strcmp(text, "else"))
-        tok->kind = TOK_ELSE;
-    else if (!strcmp(text, "switch"))
-        tok->kind = TOK_SWITCH;
-    else if (!strcmp(text, "case"))
-        tok->kind = TOK_CASE;
-    else if (!strcmp(text, "default"))
-        tok->kind = TOK_DEFAULT;
-
-    else if (!strcmp(text, "do"))
-        tok->kind = TOK_DO;
-    else if (!strcmp(text, "for"))
-        tok->kind = TOK_FOR;
-    else if (!strcmp(text, "while"))
-        tok->kind = TOK_WHILE;
-
-    else if (!strcmp(text, "break"))
-        tok->kind = TOK_BREAK;
-    else if (!strcmp(text, "continue"))
-        tok->kind = TOK_CONTINUE;
-    else if (!strcmp(text, "return"))
-        tok->kind = TOK_RETURN;
-    else if (!strcmp(text, "goto"))
-        tok->kind = TOK_GOTO;
-
-    else if (!strcmp(text, "sizeof"))
-        tok->kind = TOK_SIZEOF;
-    else if (!strcmp(text, "struct"))
-        tok->kind = TOK_STRUCT;
-    else if (!strcmp(text, "union"))
-        tok->kind = TOK_UNION;
-    else if (!strcmp(text, "enum"))
-        tok->kind = TOK_ENUM;
-    else if (!strcmp(text, "typedef"))
-        tok->kind = TOK_TYPEDEF;
-    else if (!strcmp(text, "extern"))
-        tok->kind = TOK_EXTERN;
-    else if (!strcmp(text, "static"))
-        tok->kind = TOK_STATIC;
-    else if (!strcmp(text, "const"))
-        tok->kind = TOK_CONST;
-
-    else if (!strcmp(text, "void"))
-        tok->kind = TOK_VOID;
-    else if (!strcmp(text, "char"))
-        tok->kind = TOK_CHAR;
-    else if (!strcmp(text, "short"))
-        tok->kind = TOK_SHORT;
-    else if (!strcmp(text, "int"))
-        tok->kind = TOK_INT;
-    else if (!strcmp(text, "long"))
-        tok->kind = TOK_LONG;
-    else if (!strcmp(text, "float"))
-        tok->kind = TOK_FLOAT;
-    else if (!strcmp(text, "double"))
-        tok->kind = TOK_DOUBLE;
-    else if (!strcmp(text, "signed"))
-        tok->kind = TOK_SIGNED;
-    else if (!strcmp(text, "unsigned"))
-        tok->kind = TOK_UNSIGNED;
+static int offset_of(const struct lexer *l, const char *p)
+{
+    return l->base + (p - l->head);
+}
+
+/* character classes to scan a run of characters in a tight loop */
+enum char_class {
+    CHAR_SPACE   = 1 << 0,
+    CHAR_DIGIT   = 1 << 1,
+    CHAR_IDENT   = 1 << 2,
+    /* characters that need care in comments and string literals */
+    CHAR_SPECIAL = 1 << 3
+};
+
+static unsigned char char_class[256];
+
+static void init_char_class(void)
+{
+    int c;
+
+    for (c = 1; c < 256; c++) {
+        if (isspace(c))
+            char_class[c] |= CHAR_SPACE;
+        if (isdigit(c))
+            char_class[c] |= CHAR_DIGIT;
+        if (isalnum(c) || c == '_')
+            char_class[c] |= CHAR_IDENT;
+    }
+
+    /* the null character ends the text */
+    char_class[0] |= CHAR_SPECIAL;
+    char_class['\n'] |= CHAR_SPECIAL;
+    char_class['*'] |= CHAR_SPECIAL;
+    char_class['"'] |= CHAR_SPECIAL;
+    char_class['\\'] |= CHAR_SPECIAL;
+}
+
+static int is_class(int c, int cls)
+{
+    return char_class[(unsigned char) c] & cls;
+}
+
+struct keyword {
+    const char *name;
+    int kind;
+};
+
+static const struct keyword keywords[] = {
+    {"if", TOK_IF}, {"else", TOK_ELSE}, {"switch", TOK_SWITCH},
+    {"case", TOK_CASE}, {"default", TOK_DEFAULT}, {"do", TOK_DO},
+    {"for", TOK_FOR}, {"while", TOK_WHILE}, {"break", TOK_BREAK},
+    {"continue", TOK_CONTINUE}, {"return", TOK_RETURN}, {"goto", TOK_GOTO},
+    {"sizeof", TOK_SIZEOF}, {"struct", TOK_STRUCT}, {"union", TOK_UNION},
+    {"enum", TOK_ENUM}, {"typedef", TOK_TYPEDEF}, {"extern", TOK_EXTERN},
+    {"static", TOK_STATIC}, {"const", TOK_CONST}, {"void", TOK_VOID},
+    {"char", TOK_CHAR}, {"short", TOK_SHORT}, {"int", TOK_INT},
+    {"long", TOK_LONG}, {"float", TOK_FLOAT}, {"double", TOK_DOUBLE},
+    {"signed", TOK_SIGNED}, {"unsigned", TOK_UNSIGNED}
+};
+
+/* (5 * length + 14 * first char + 5 * last char) % 64 has no collisions
+ * among the keywords. so a word is a keyword only if it equals the one
+ * in its slot */
+#define KEYWORD_TABLE_SIZE 64
+static const struct keyword *keyword_table[KEYWORD_TABLE_SIZE];
+
+static int keyword_hash(const char *text, size_t len)
+{
+    const unsigned char first = text[0];
+    const unsigned char last = text[len - 1];
+
+    return (5 * len + 14 * first + 5 * last) % KEYWORD_TABLE_SIZE;
+}
+
+static void init_keyword_table(void)
+{
+    const int N = sizeof(keywords) / sizeof(keywords[0]);
+    int i;
 
+    for (i = 0; i < N; i++) {
+        const struct keyword *kw = &keywords[i];
+        const int h = keyword_hash(kw->name, strlen(kw->name));
+
+        assert(!keyword_table[h] || keyword_table[h] == kw);
+        keyword_table[h] = kw;
+    }
+}
+
+static void keyword_or_identifier(struct token *tok, struct token_value *val,
+        size_t len)
+{
+    const struct keyword *kw = keyword_table[keyword_hash(val->text, len)];
+
+    if (kw && !strcmp(val->text, kw->name))
+        tok->kind = kw->kind;
     else
         tok->kind = TOK_IDENT;
 }
@@ -116,44 +127,220 @@ static const char *make_text(struct lexer *l, const char *str)
     return insert_string(l->strtab, str);
 }
 
+static const char *make_text_len(struct lexer *l, const char *str, size_t len)
+{
+    return insert_string_len(l->strtab, str, len);
+}
+
 static void init_position(struct position *pos)
 {
-    pos->x = 0;
-    pos->y = 1;
-    pos->filename = NULL;
+    pos->offset = 0;
 }
 
 void init_token(struct token *tok)
 {
     tok->kind = TOK_UNKNOWN;
-    tok->value = 0;
-    tok->fpnum = 0;
-    tok->text = NULL;
+    tok->length = 0;
+    tok->data = 0;
 
     init_position(&tok->pos);
 }
 
+static void init_token_value(struct token_value *val)
+{
+    val->value = 0;
+    val->text = NULL;
+}
+
+void init_token_array(struct token_array *a)
+{
+    a->token_blocks = NULL;
+    a->value_starts = NULL;
+    a->token_block_count = 0;
+    a->token_count = 0;
+
+    a->value_blocks = NULL;
+    a->value_block_count = 0;
+    a->value_count = 0;
+
+    a->first_token_block = 0;
+    a->first_value_block = 0;
+}
+
+void clear_token_array(struct token_array *a)
+{
+    int i;
+
+    /* texts are kept in the string table */
+    for (i = a->first_token_block; i < a->token_block_count; i++)
+        free(a->token_blocks[i]);
+    for (i = a->first_value_block; i < a->value_block_count; i++)
+        free(a->value_blocks[i]);
+    free(a->token_blocks);
+    free(a->value_starts);
+    free(a->value_blocks);
+
+    init_token_array(a);
+}
+
+struct token *token_at(const struct token_array *a, int index)
+{
+    return &a->token_blocks[index / TOKEN_BLOCK_SIZE][index % TOKEN_BLOCK_SIZE];
+}
+
+static struct token_value *value_at(const struct token_array *a, int index)
+{
+    return &a->value_blocks[index / TOKEN_BLOCK_SIZE][index % TOKEN_BLOCK_SIZE];
+}
+
+const struct token_value *token_value_of(const struct token_array *a,
+        const struct token *tok)
+{
+    static const struct token_value no_value = {0, NULL};
+    if (!tok->data)
+        return &no_value;
+    return value_at(a, tok->data - 1);
+}
+
+void release_tokens(struct token_array *a, int index)
+{
+    const int block = index / TOKEN_BLOCK_SIZE;
+    int value_block;
+
+    if (index < 0 || index >= a->token_count)
+        return;
+
+    for (; a->first_token_block < block; a->first_token_block++) {
+        free(a->token_blocks[a->first_token_block]);
+        a->token_blocks[a->first_token_block] = NULL;
+    }
+
+    /* values are read in the order of tokens */
+    value_block = a->value_starts[block] / TOKEN_BLOCK_SIZE;
+    for (; a->first_value_block < value_block; a->first_value_block++) {
+        free(a->value_blocks[a->first_value_block]);
+        a->value_blocks[a->first_value_block] = NULL;
+    }
+}
+
+static int has_token_value(int kind)
+{
+    return kind == TOK_IDENT || kind == TOK_NUM || kind == TOK_FPNUM ||
+        kind == TOK_STRING_LITERAL || kind == TOK_UNKNOWN;
+}
+
+/* adds a token at the end with room for its value */
+static struct token *push_token(struct token_array *a)
+{
+    if (a->token_count == a->token_block_count * TOKEN_BLOCK_SIZE) {
+        const int count = a->token_block_count + 1;
+
+        a->token_blocks = realloc(a->token_blocks, sizeof(struct token *) * count);
+        a->value_starts = realloc(a->value_starts, sizeof(int) * count);
+        a->token_blocks[a->token_block_count] =
+            malloc(sizeof(struct token) * TOKEN_BLOCK_SIZE);
+        a->value_starts[a->token_block_count] = a->value_count;
+        a->token_block_count = count;
+    }
+    if (a->value_count == a->value_block_count * TOKEN_BLOCK_SIZE) {
+        a->value_blocks = realloc(a->value_blocks,
+                sizeof(struct token_value *) * (a->value_block_count + 1));
+        a->value_blocks[a->value_block_count++] =
+            malloc(sizeof(struct token_value) * TOKEN_BLOCK_SIZE);
+    }
+
+    return token_at(a, a->token_count++);
+}
+
+int read_next_token(struct lexer *l, struct token_array *a)
+{
+    struct token *tok = push_token(a);
+
+    /* the next value slot is taken only by tokens having a value */
+    get_next_token(l, tok, value_at(a, a->value_count));
+
+    if (has_token_value(tok->kind))
+        tok->data = ++a->value_count;
+
+    return a->token_count - 1;
+}
+
+void copy_token_range(struct token_array *dst,
+        const struct token_array *src, int begin, int end)
+{
+    struct token *tok;
+    int i;
+
+    for (i = begin; i <= end; i++) {
+        const struct token *orig = token_at(src, i);
+
+        tok = push_token(dst);
+        *tok = *orig;
+        if (orig->data) {
+            *value_at(dst, dst->value_count) = *value_at(src, orig->data - 1);
+            tok->data = ++dst->value_count;
+        }
+    }
+
+    /* the parser stops at the end of the copy */
+    tok = push_token(dst);
+    init_token(tok);
+    tok->kind = TOK_EOF;
+    tok->pos = token_at(src, end)->pos;
+}
+
 struct lexer *new_lexer(void)
 {
     struct lexer *l = malloc(sizeof(struct lexer));
 
     l->strtab = new_string_table();
+    init_char_class();
+    init_keyword_table();
+    l->pp = NULL;
     l->head = NULL;
     l->next = NULL;
-
-    init_position(&l->pos);
-    l->prevx = 0;
+    l->base = 0;
+    l->literal = NULL;
+    l->literal_len = 0;
+    l->literal_size = 0;
 
     return l;
 }
 
+void set_source(struct lexer *l, struct preprocessor *pp)
+{
+    l->pp = pp;
+    l->head = "";
+    l->next = l->head;
+    l->base = 0;
+}
+
 void set_source_text(struct lexer *l, const char *text)
 {
+    l->pp = NULL;
     l->head = text;
-    l->next = text;
+    l->next = l->head;
+    l->base = 0;
+}
+
+/* chunks end at a new line so that no token is split */
+static int read_next_chunk(struct lexer *l)
+{
+    const char *text;
+
+    if (!l->pp)
+        return 0;
+
+    l->base += strlen(l->head);
+    text = read_text(l->pp);
+    if (!text) {
+        l->pp = NULL;
+        return 0;
+    }
 
-    init_position(&l->pos);
-    l->prevx = 0;
+    l->head = text;
+    l->next = text;
+    return 1;
 }
 
 void free_lexer(struct lexer *l)
@@ -161,12 +348,10 @@ void free_lexer(struct lexer *l)
     if (!l)
         return;
     free_string_table(l->strtab);
+    free(l->literal);
     free(l);
 }
 
-static void read_line_number(struct lexer *l);
-static void read_column_number(struct lexer *l);
-
 static int read_escape_sequence(struct lexer *l)
 {
     char es[4] = {'\0'};
@@ -228,14 +413,11 @@ static const char *convert_escape_sequence(const char *src, char *dst)
 
 static void skip_spaces(struct lexer *l)
 {
-    for (;;) {
-        const int c = readc(l);
+    const char *p = l->next;
 
-        if (!isspace(c)) {
-            unreadc(l, c);
-            break;
-        }
-    }
+    while (is_class(*p, CHAR_SPACE))
+        p++;
+    l->next = p;
 }
 
 static void skip_line_comment(struct lexer *l)
@@ -251,8 +433,15 @@ static void skip_line_comment(struct lexer *l)
 static void skip_block_comment(struct lexer *l)
 {
     for (;;) {
-        const int c = readc(l);
+        const char *p = l->next;
+        int c;
+
+        /* most characters are neither special nor newline */
+        while (!is_class(*p, CHAR_SPECIAL))
+            p++;
+        l->next = p;
 
+        c = readc(l);
         if (c == '*') {
             const int c1 = readc(l);
             if (c1 == '/') {
@@ -262,10 +451,6 @@ static void skip_block_comment(struct lexer *l)
                 continue;
             }
         }
-        else if (c == '#') {
-            read_column_number(l);
-            continue;
-        }
         else if (c == EOF) {
             /* TODO error handling */
             printf("error: unterminated /* comment\n");
@@ -274,98 +459,118 @@ static void skip_block_comment(struct lexer *l)
     }
 }
 
-static void scan_number(struct lexer *l, struct token *tok)
+static void scan_number(struct lexer *l, struct token *tok,
+        struct token_value *val)
 {
-    static char buf[128] = {'\0'};
-    char *p = buf;
+    const char *start = l->next;
+    const char *p = start;
     int is_fp = 0;
 
-    for (;;) {
-        const int c = readc(l);
-
-        if (c == '.')
+    for (; is_class(*p, CHAR_DIGIT) || *p == '.'; p++) {
+        if (*p == '.')
             is_fp = 1;
+    }
+    l->next = p;
 
-        if (isdigit(c) || c == '.') {
-            *p++ = c;
-            continue;
-        }
-        else {
-            *p = '\0';
-            unreadc(l, c);
-            tok->text = make_text(l, buf);
-            if (is_fp) {
-                tok->kind = TOK_FPNUM;
-                tok->fpnum = strtod(tok->text, &p);
-            } else {
-                tok->kind = TOK_NUM;
-                tok->value = strtol(tok->text, &p, 10);
-            }
-            return;
-        }
+    val->text = make_text_len(l, start, p - start);
+    if (is_fp) {
+        tok->kind = TOK_FPNUM;
+    } else {
+        tok->kind = TOK_NUM;
+        val->value = strtol(val->text, NULL, 10);
     }
 }
 
-static void scan_word(struct lexer *l, struct token *tok)
+static void scan_word(struct lexer *l, struct token *tok,
+        struct token_value *val)
 {
-    static char buf[128] = {'\0'};
-    char *p = buf;
+    const char *start = l->next;
+    const char *p = start;
 
-    for (;;) {
-        const int c = readc(l);
+    while (is_class(*p, CHAR_IDENT))
+        p++;
+    l->next = p;
 
-        if (isalnum(c) || c == '_') {
-            *p++ = c;
-            continue;
-        }
-        else {
-            *p = '\0';
-            unreadc(l, c);
-            tok->text = make_text(l, buf);
-            keyword_or_identifier(tok);
-            return;
-        }
+    val->text = make_text_len(l, start, p - start);
+    keyword_or_identifier(tok, val, p - start);
+}
+
+/* makes room for len more characters in the literal buffer */
+static char *grow_literal_buffer(struct lexer *l, int len)
+{
+    if (l->literal_len + len + 1 > l->literal_size) {
+        int size = l->literal_size ? l->literal_size : 1024;
+
+        while (l->literal_len + len + 1 > size)
+            size *= 2;
+        l->literal = realloc(l->literal, size);
+        l->literal_size = size;
     }
+
+    return l->literal + l->literal_len;
 }
 
-static void scan_string_literal(struct lexer *l, struct token *tok)
+static void scan_string_literal(struct lexer *l, struct token *tok,
+        struct token_value *val)
 {
-    static char buf[1024] = {'\0'};
-    char *p = buf;
+    l->literal_len = 0;
 
     for (;;) {
-        const int c = readc(l);
+        const char *s = l->next;
+        int c;
 
-        if (c == '"') {
-            static char no_esc_seq[1024] = {'\0'};
-            *p = '\0';
-            convert_escape_sequence(buf, no_esc_seq);
-            tok->text = make_text(l, no_esc_seq);
+        /* copy the run of plain characters at once */
+        while (!is_class(*s, CHAR_SPECIAL))
+            s++;
+        memcpy(grow_literal_buffer(l, s - l->next), l->next, s - l->next);
+        l->literal_len += s - l->next;
+        l->next = s;
+
+        c = readc(l);
+        if (c == '"' || c == '\n' || c == EOF) {
+            if (c != '"') {
+                /* TODO error handling */
+                printf("error: missing terminating '\"' character\n");
+                unreadc(l, c);
+            }
+            /* escape sequences never get longer, so they are converted
+             * in place */
+            *grow_literal_buffer(l, 0) = '\0';
+            convert_escape_sequence(l->literal, l->literal);
+            val->text = make_text(l, l->literal);
             tok->kind = TOK_STRING_LITERAL;
             return;
         }
         else if (c == '\\') {
             const int c1 = readc(l);
-            *p++ = c;
-            *p++ = c1;
+            char *p = grow_literal_buffer(l, 2);
+            p[0] = c;
+            p[1] = c1;
+            l->literal_len += 2;
+            if (c1 == EOF) {
+                unreadc(l, c1);
+                l->literal_len--;
+            }
             continue;
         }
         else {
-            *p++ = c;
+            *grow_literal_buffer(l, 1) = c;
+            l->literal_len++;
             continue;
         }
     }
 }
 
-static void scan_char_literal(struct lexer *l, struct token *tok)
+static void scan_char_literal(struct lexer *l, struct token *tok,
+        struct token_value *val)
 {
     int c = readc(l);
 
     if (c == '\\')
         /* TODO support hex and octal literal */
-        tok->value = read_escape_sequence(l);
+        val->value = read_escape_sequence(l);
     else
-        tok->value = c;
+        val->value = c;
     tok->kind = TOK_NUM;
 
     c = readc(l);
@@ -412,52 +617,48 @@ static int match_two_more(struct lexer *l, struct token *tok,
     return 2;
 }
 
-enum token_kind get_next_token(struct lexer *l, struct token *tok)
+enum token_kind get_next_token(struct lexer *l, struct token *tok,
+        struct token_value *val)
 {
     init_token(tok);
+    init_token_value(val);
 
     for (;;) {
         const int c = readc(l);
-        tok->pos = l->pos;
+        tok->pos.offset = offset_of(l, l->next - 1);
 
         /* space */
-        if (isspace(c)) {
+        if (is_class(c, CHAR_SPACE)) {
             skip_spaces(l);
             continue;
         }
 
         /* number */
-        if (isdigit(c)) {
+        if (is_class(c, CHAR_DIGIT)) {
             unreadc(l, c);
-            scan_number(l, tok);
+            scan_number(l, tok, val);
             break;
         }
 
         /* word */
         if (isalpha(c) || c == '_') {
             unreadc(l, c);
-            scan_word(l, tok);
+            scan_word(l, tok, val);
             break;
         }
 
         /* string literal */
         if (c == '"') {
-            scan_string_literal(l, tok);
+            scan_string_literal(l, tok, val);
             break;
         }
 
         /* char literal */
         if (c == '\'') {
-            scan_char_literal(l, tok);
+            scan_char_literal(l, tok, val);
             break;
         }
 
-        /* line number */
-        if (c == '#') {
-            read_line_number(l);
-            continue;
-        }
-
         /* comments */
         if (c == '/') {
             const int c1 = readc(l);
@@ -573,24 +774,27 @@ enum token_kind get_next_token(struct lexer *l, struct token *tok)
         }
 
         if (c == EOF) {
+            if (read_next_chunk(l))
+                continue;
             tok->kind = TOK_EOF;
             break;
         }
 
         /* unknown */
         tok->kind = TOK_UNKNOWN;
-        tok->value = c;
+        val->value = c;
         break;
     }
 
+    tok->length = offset_of(l, l->next) - tok->pos.offset;
     return tok->kind;
 }
 
-void print_token(const struct token *tok)
+void print_token(const struct token *tok, const struct token_value *val)
 {
     const char *s;
 
-    printf("(%d, %d) => ", tok->pos.y, tok->pos.x);
+    printf("(%d) => ", tok->pos.offset);
 
     if (tok->kind == '\n') {
         printf("\"\\n\"\n");
@@ -639,7 +843,7 @@ void print_token(const struct token *tok)
     case TOK_SIGNED:
     case TOK_UNSIGNED:
     case TOK_TYPE_NAME:
-        printf("\"%s\"\n", tok->text);
+        printf("\"%s\"\n", val->text);
         return;
     default:
         break;
@@ -679,89 +883,3 @@ void print_token(const struct token *tok)
     }
     printf("\"%s\"\n", s);
 }
-
-static void read_spaces(struct lexer *l)
-{
-    for (;;) {
-        const int c = readc(l);
-        if (c == ' '  ||
-            c == '\t' ||
-            c == '\v' ||
-            c == '\f') {
-            continue;
-        } else {
-            unreadc(l, c);
-            break;
-        }
-    }
-}
-
-static void read_char(struct lexer *l, int expected)
-{
-    const int c = readc(l);
-    if (c != expected) {
-        /* error */
-    }
-}
-
-static int read_number(struct lexer *l)
-{
-    int num = 0;
-
-    for (;;) {
-        const int c = readc(l);
-        if (isdigit(c)) {
-            num = num * 10 + c - '0';
-        } else {
-            unreadc(l, c);
-            break;
-        }
-    }
-
-    return num;
-}
-
-static void read_file_path(struct lexer *l, char *path)
-{
-    char *buf = path;
-
-    for (;;) {
-        const int c = readc(l);
-        if (isalnum(c) || c == '_' || c == '-' || c == '.' || c == '/') {
-            *buf++ = c;
-        } else {
-            *buf = '\0';
-            unreadc(l, c);
-            break;
-        }
-    }
-}
-
-static void read_line_number(struct lexer *l)
-{
-    static char path[256] = {'\0'};
-    int num = 0;
-
-    read_spaces(l);
-
-    num = read_number(l);
-
-    read_spaces(l);
-
-    read_char(l, '"');
-    read_file_path(l, path);
-    read_char(l, '"');
-
-    read_spaces(l);
-
-    read_char(l, '\n');
-
-    l->pos.y = num;
-    l->pos.filename = make_text(l, path);
-}
-
-static void read_column_number(struct lexer *l)
-{
-    const int col = read_number(l);
-    l->pos.x = col;
-}
@@ -73,32 +73,87 @@ enum token_kind {
     TOK_EOF
 };
 
+/* tokens are small and kept in a dense array. text and value of
+ * identifiers and literals are in a side table of the array, as other
+ * tokens have none. floating point values are converted from the text by
+ * the parser */
 struct token {
     int kind;
+    /* offset in the text */
+    struct position pos;
+    int length;
+    /* index in the side table plus one. 0 if the token has no text or value */
+    int data;
+};
+
+struct token_value {
     long value;
-    double fpnum;
     const char *text;
-    struct position pos;
+};
+
+#define TOKEN_BLOCK_SIZE 1024
+
+/* tokens and values are kept in blocks that never move. blocks behind the
+ * tokens in use are released as parsing goes */
+struct token_array {
+    struct token **token_blocks;
+    /* index of the first value read in each token block */
+    int *value_starts;
+    int token_block_count;
+    int token_count;
+
+    struct token_value **value_blocks;
+    int value_block_count;
+    int value_count;
+
+    /* blocks before these have been released */
+    int first_token_block;
+    int first_value_block;
 };
 
 struct string_table;
+struct preprocessor;
 
 struct lexer {
     struct string_table *strtab;
+    /* text is read in chunks from the preprocessor. base is the offset of
+     * the current chunk in the whole text */
+    struct preprocessor *pp;
     const char *head;
     const char *next;
-
-    struct position pos;
-    int prevx;
+    int base;
+    /* string literals are copied here before escape sequences are
+     * converted. it grows to fit the longest one */
+    char *literal;
+    int literal_len;
+    int literal_size;
 };
 
 extern void init_token(struct token *tok);
-extern void print_token(const struct token *tok);
+extern void print_token(const struct token *tok, const struct token_value *val);
+
+/* token array */
+extern void init_token_array(struct token_array *a);
+extern void clear_token_array(struct token_array *a);
+extern struct token *token_at(const struct token_array *a, int index);
+extern const struct token_value *token_value_of(const struct token_array *a,
+        const struct token *tok);
+/* frees the blocks having only tokens before index */
+extern void release_tokens(struct token_array *a, int index);
+/* appends tokens from begin to end inclusive and TOK_EOF after them */
+extern void copy_token_range(struct token_array *dst,
+        const struct token_array *src, int begin, int end);
 
 extern struct lexer *new_lexer(void);
 extern void free_lexer(struct lexer *l);
 
-extern enum token_kind get_next_token(struct lexer *l, struct token *tok);
+extern enum token_kind get_next_token(struct lexer *l, struct token *tok,
+        struct token_value *val);
+/* reads the next token into the array and returns its index */
+extern int read_next_token(struct lexer *l, struct token_array *a);
+/* tokens are read from the text preprocessed by pp */
+extern void set_source(struct lexer *l, struct preprocessor *pp);
+/* tokens are read from a text ending with a null character */
 extern void set_source_text(struct lexer *l, const char *text);
 
 #endif /* _H */
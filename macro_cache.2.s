@@ -0,0 +1,1066 @@
+    .data
+
+    .text
+
+_L_str_332:
+    .asciz "%-24s %10d\012"
+
+_L_str_333:
+    .asciz "expansion cache hits"
+
+_L_str_334:
+    .asciz "expansion cache misses"
+
+_L_str_335:
+    .asciz "%-24s %7ld.%ld%%\012"
+
+_L_str_336:
+    .asciz "expansion cache hit rate"
+
+_L_str_337:
+    .asciz "expansion cache flushes"
+
+_L_str_338:
+    .asciz "expansions cached"
+
+_L_str_346:
+    .asciz "{\"hits\": %d, \"misses\": %d, \"flushes\": %d, \"entries\": %d}"
+
+_hash_string:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-pre
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB1_1:
+    movq  -16(%rbp), %rax
+    movb  (%rax), %al
+    movzbl %al, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB1_2
+## for-body
+## assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $31, %eax
+    pushq %rax
+    movl  -20(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    movb  (%rax), %al
+    movzbl %al, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-post
+_LBB1_4:
+    leaq  -16(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    jmp   _LBB1_1
+_LBB1_2:
+    movl  -20(%rbp), %eax
+    pushq %rax
+    movl  $1237, %eax
+    movl  %eax, %edi
+    popq  %rax
+    xorl  %edx, %edx
+    divl  %edi
+    movl  %edx, %eax
+    jmp   _LBB0_0
+_LBB0_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_copy_string:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _strlen
+    addq  $8, %rsp
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movl  $1, %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _malloc
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $32, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _strncpy
+    addq  $32, %rsp
+    movq  -24(%rbp), %rax
+    jmp   _LBB2_0
+_LBB2_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _new_macro_cache
+_new_macro_cache:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $0, %rsp
+## func params
+## func body
+    subq  $16, %rsp
+    movl  $1, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movl  $19808, %eax
+    movslq %eax, %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _calloc
+    addq  $16, %rsp
+    jmp   _LBB3_0
+_LBB3_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_clear_cache:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## for-pre
+## assign
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB5_1:
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $1237, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB5_2
+## for-body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $9896, %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-pre
+## for-cond
+_LBB6_1:
+    movq  -24(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB6_2
+## for-body
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+## for-post
+_LBB6_4:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB6_1
+_LBB6_2:
+## for-pre
+## for-cond
+_LBB7_1:
+    movq  -40(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB7_2
+## for-body
+## assign
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    movq  -40(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -40(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -40(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+## for-post
+_LBB7_4:
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movq  -48(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB7_1
+_LBB7_2:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $9896, %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-post
+_LBB5_4:
+    leaq  -12(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB5_1
+_LBB5_2:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $19792, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+_LBB4_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _free_macro_cache
+_free_macro_cache:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## if-cond
+    movq  -8(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB9_3
+## if-then
+    jmp   _LBB8_0
+    jmp   _LBB9_2
+## if-else
+_LBB9_3:
+_LBB9_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _clear_cache
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+_LBB8_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _find_expansion
+_find_expansion:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## for-pre
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _hash_string
+    addq  $8, %rsp
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB11_1:
+    movq  -24(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB11_2
+## for-body
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB12_3
+## if-then
+    movq  -8(%rbp), %rax
+    addq  $19796, %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    jmp   _LBB10_0
+    jmp   _LBB12_2
+## if-else
+_LBB12_3:
+_LBB12_2:
+## for-post
+_LBB11_4:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB11_1
+_LBB11_2:
+    movq  -8(%rbp), %rax
+    addq  $19800, %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    movl  $0, %eax
+    jmp   _LBB10_0
+_LBB10_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _add_expansion
+_add_expansion:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movq  %rdx, -24(%rbp)
+## func body
+## local scalar init
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _hash_string
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $19792, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $8192, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB14_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _clear_cache
+    addq  $16, %rsp
+    jmp   _LBB14_2
+## if-else
+_LBB14_3:
+_LBB14_2:
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movl  $24, %eax
+    movslq %eax, %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _malloc
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -40(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _copy_string
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -40(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _copy_string
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -40(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -28(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -28(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movq  -40(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -8(%rbp), %rax
+    addq  $19792, %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+_LBB13_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_find_watched:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movl  %edx, -20(%rbp)
+## func body
+## for-pre
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $9896, %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -20(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB16_1:
+    movq  -32(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB16_2
+## for-body
+## if-cond
+    subq  $16, %rsp
+    movq  -32(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB17_3
+## if-then
+    movq  -32(%rbp), %rax
+    jmp   _LBB15_0
+    jmp   _LBB17_2
+## if-else
+_LBB17_3:
+_LBB17_2:
+## for-post
+_LBB16_4:
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB16_1
+_LBB16_2:
+    movl  $0, %eax
+    jmp   _LBB15_0
+_LBB15_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _watch_name
+_watch_name:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _hash_string
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _find_watched
+    addq  $32, %rsp
+    cmpq  $0, %rax
+    je    _LBB19_3
+## if-then
+    jmp   _LBB18_0
+    jmp   _LBB19_2
+## if-else
+_LBB19_3:
+_LBB19_2:
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movl  $16, %eax
+    movslq %eax, %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _malloc
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -32(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _copy_string
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -32(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $9896, %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -20(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $9896, %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -20(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+_LBB18_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _macro_changed
+_macro_changed:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## if-cond
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _hash_string
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _find_watched
+    addq  $32, %rsp
+    cmpq  $0, %rax
+    je    _LBB21_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _clear_cache
+    addq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $19804, %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB21_2
+## if-else
+_LBB21_3:
+_LBB21_2:
+_LBB20_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _print_macro_cache_stats
+_print_macro_cache_stats:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $19796, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $19800, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+## cond-?
+    movq  -24(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB23_3
+## cond-then
+    movl  $1000, %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $19796, %rax
+    movl  (%rax), %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    movq  %rax, %rdi
+    popq  %rax
+    cqto
+    idivq %rdi
+    jmp   _LBB23_2
+## cond-else
+_LBB23_3:
+    movl  $0, %eax
+    movslq %eax, %rax
+_LBB23_2:
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_332(%rip), %rax
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_333(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $19796, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movl  (%rsp), %ecx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_332(%rip), %rax
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_334(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $19800, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movl  (%rsp), %ecx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+    subq  $48, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 40(%rsp)
+    leaq  _L_str_335(%rip), %rax
+    movq  %rax, 32(%rsp)
+    leaq  _L_str_336(%rip), %rax
+    movq  %rax, 24(%rsp)
+    movq  -32(%rbp), %rax
+    pushq %rax
+    movl  $10, %eax
+    movslq %eax, %rax
+    movq  %rax, %rdi
+    popq  %rax
+    cqto
+    idivq %rdi
+    movq  %rax, 16(%rsp)
+    movq  -32(%rbp), %rax
+    pushq %rax
+    movl  $10, %eax
+    movslq %eax, %rax
+    movq  %rax, %rdi
+    popq  %rax
+    cqto
+    idivq %rdi
+    movq  %rdx, %rax
+    movq  %rax, 8(%rsp)
+    movq  40(%rsp), %rdi
+    movq  32(%rsp), %rsi
+    movq  24(%rsp), %rdx
+    movq  16(%rsp), %rcx
+    movq  8(%rsp), %r8
+    movb  $0, %al
+    callq _fprintf
+    addq  $48, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_332(%rip), %rax
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_337(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $19804, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movl  (%rsp), %ecx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_332(%rip), %rax
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_338(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $19792, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movl  (%rsp), %ecx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+_LBB22_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _print_macro_cache_stats_json
+_print_macro_cache_stats_json:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+    subq  $48, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 40(%rsp)
+    leaq  _L_str_346(%rip), %rax
+    movq  %rax, 32(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $19796, %rax
+    movl  (%rax), %eax
+    movl  %eax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $19800, %rax
+    movl  (%rax), %eax
+    movl  %eax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $19804, %rax
+    movl  (%rax), %eax
+    movl  %eax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $19792, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movq  40(%rsp), %rdi
+    movq  32(%rsp), %rsi
+    movl  24(%rsp), %edx
+    movl  16(%rsp), %ecx
+    movl  8(%rsp), %r8d
+    movl  (%rsp), %r9d
+    movb  $0, %al
+    callq _fprintf
+    addq  $48, %rsp
+_LBB24_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
@@ -0,0 +1,148 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "macro_cache.h"
+
+static unsigned int hash_string(const char *s)
+{
+    const unsigned char *p;
+    unsigned int h = 0;
+
+    for (p = (const unsigned char *) s; *p != '\0'; p++)
+        h = 31 * h + *p;
+
+    return h % MACRO_CACHE_HASH_SIZE;
+}
+
+static char *copy_string(const char *s)
+{
+    const size_t alloc = strlen(s) + 1;
+    char *dst = malloc(sizeof(char) * alloc);
+
+    strncpy(dst, s, alloc);
+    return dst;
+}
+
+struct macro_cache *new_macro_cache(void)
+{
+    return calloc(1, sizeof(struct macro_cache));
+}
+
+static void clear_cache(struct macro_cache *cache)
+{
+    int i;
+
+    for (i = 0; i < MACRO_CACHE_HASH_SIZE; i++) {
+        struct cached_expansion *ent = cache->entries[i], *ent_next;
+        struct watched_name *w = cache->names[i], *w_next;
+
+        for (; ent; ent = ent_next) {
+            ent_next = ent->next;
+            free(ent->key);
+            free(ent->text);
+            free(ent);
+        }
+        for (; w; w = w_next) {
+            w_next = w->next;
+            free(w->name);
+            free(w);
+        }
+        cache->entries[i] = NULL;
+        cache->names[i] = NULL;
+    }
+    cache->entry_count = 0;
+}
+
+void free_macro_cache(struct macro_cache *cache)
+{
+    if (!cache)
+        return;
+
+    clear_cache(cache);
+    free(cache);
+}
+
+const char *find_expansion(struct macro_cache *cache, const char *key)
+{
+    const struct cached_expansion *ent;
+
+    for (ent = cache->entries[hash_string(key)]; ent; ent = ent->next) {
+        if (!strcmp(ent->key, key)) {
+            cache->hits++;
+            return ent->text;
+        }
+    }
+
+    cache->misses++;
+    return NULL;
+}
+
+void add_expansion(struct macro_cache *cache, const char *key, const char *text)
+{
+    const unsigned int h = hash_string(key);
+    struct cached_expansion *ent;
+
+    if (cache->entry_count == MACRO_CACHE_MAX_ENTRIES)
+        clear_cache(cache);
+
+    ent = malloc(sizeof(struct cached_expansion));
+    ent->key = copy_string(key);
+    ent->text = copy_string(text);
+    ent->next = cache->entries[h];
+    cache->entries[h] = ent;
+    cache->entry_count++;
+}
+
+static struct watched_name *find_watched(const struct macro_cache *cache,
+        const char *name, unsigned int h)
+{
+    struct watched_name *w;
+
+    for (w = cache->names[h]; w; w = w->next)
+        if (!strcmp(w->name, name))
+            return w;
+
+    return NULL;
+}
+
+void watch_name(struct macro_cache *cache, const char *name)
+{
+    const unsigned int h = hash_string(name);
+    struct watched_name *w;
+
+    if (find_watched(cache, name, h))
+        return;
+
+    w = malloc(sizeof(struct watched_name));
+    w->name = copy_string(name);
+    w->next = cache->names[h];
+    cache->names[h] = w;
+}
+
+void macro_changed(struct macro_cache *cache, const char *name)
+{
+    /* any of the expansions may depend on it */
+    if (find_watched(cache, name, hash_string(name))) {
+        clear_cache(cache);
+        cache->invalidations++;
+    }
+}
+
+void print_macro_cache_stats(FILE *fp, const struct macro_cache *cache)
+{
+    const long lookups = cache->hits + cache->misses;
+    /* in tenths of a percent */
+    const long rate = lookups ? 1000 * (long) cache->hits / lookups : 0;
+
+    fprintf(fp, "%-24s %10d\n", "expansion cache hits", cache->hits);
+    fprintf(fp, "%-24s %10d\n", "expansion cache misses", cache->misses);
+    fprintf(fp, "%-24s %7ld.%ld%%\n", "expansion cache hit rate", rate / 10, rate % 10);
+    fprintf(fp, "%-24s %10d\n", "expansion cache flushes", cache->invalidations);
+    fprintf(fp, "%-24s %10d\n", "expansions cached", cache->entry_count);
+}
+
+void print_macro_cache_stats_json(FILE *fp, const struct macro_cache *cache)
+{
+    fprintf(fp, "{\"hits\": %d, \"misses\": %d, \"flushes\": %d, \"entries\": %d}",
+            cache->hits, cache->misses, cache->invalidations, cache->entry_count);
+}
@@ -0,0 +1,52 @@
+#ifndef MACRO_CACHE_H
+#define MACRO_CACHE_H
+
+#include <stdio.h>
+
+#define MACRO_CACHE_HASH_SIZE 1237 /* a prime number */
+/* the cache is cleared when it holds this many expansions */
+#define MACRO_CACHE_MAX_ENTRIES 8192
+
+/* the text a macro invocation expanded to. the key is the macro name,
+ * followed by the argument tokens for a function-like macro */
+struct cached_expansion {
+    char *key;
+    char *text;
+    struct cached_expansion *next;
+};
+
+/* a name looked up while expanding a cached invocation */
+struct watched_name {
+    char *name;
+    struct watched_name *next;
+};
+
+struct macro_cache {
+    struct cached_expansion *entries[MACRO_CACHE_HASH_SIZE];
+    struct watched_name *names[MACRO_CACHE_HASH_SIZE];
+    int entry_count;
+
+    /* statistics */
+    int hits;
+    int misses;
+    int invalidations;
+};
+
+extern struct macro_cache *new_macro_cache(void);
+extern void free_macro_cache(struct macro_cache *cache);
+
+/* returns NULL on a miss */
+extern const char *find_expansion(struct macro_cache *cache, const char *key);
+extern void add_expansion(struct macro_cache *cache, const char *key,
+        const char *text);
+
+/* expansions in the cache are dropped when a watched name is defined or
+ * undefined, as names not defined yet may make a difference as well */
+extern void watch_name(struct macro_cache *cache, const char *name);
+extern void macro_changed(struct macro_cache *cache, const char *name);
+
+extern void print_macro_cache_stats(FILE *fp, const struct macro_cache *cache);
+extern void print_macro_cache_stats_json(FILE *fp,
+        const struct macro_cache *cache);
+
+#endif /* _H */
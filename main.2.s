@@ -0,0 +1,8986 @@
+    .data
+
+_dir_1556:
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+
+    .text
+
+_L_str_1526:
+    .asciz "/.-_"
+
+_L_str_1534:
+    .asciz ".pch"
+
+_L_str_1560:
+    .asciz "include"
+
+_L_str_1573:
+    .asciz "-E"
+
+_L_str_1576:
+    .asciz "-S"
+
+_L_str_1579:
+    .asciz "-c"
+
+_L_str_1582:
+    .asciz "-o"
+
+_L_str_1585:
+    .asciz "acc: error: missing file name after '-o'\012"
+
+_L_str_1588:
+    .asciz "-MD"
+
+_L_str_1589:
+    .asciz "-MMD"
+
+_L_str_1592:
+    .asciz "-MF"
+
+_L_str_1593:
+    .asciz "-MT"
+
+_L_str_1597:
+    .asciz "acc: error: missing argument after '%s'\012"
+
+_L_str_1600:
+    .asciz "--precompile"
+
+_L_str_1603:
+    .asciz "acc: error: missing header after '--precompile'\012"
+
+_L_str_1608:
+    .asciz "--print-tree"
+
+_L_str_1611:
+    .asciz "--mem-stats"
+
+_L_str_1614:
+    .asciz "--pp-stats"
+
+_L_str_1617:
+    .asciz "--pp-stats=json"
+
+_L_str_1620:
+    .asciz "-H"
+
+_L_str_1623:
+    .asciz "--pp-stats-file"
+
+_L_str_1626:
+    .asciz "acc: error: missing file name after '--pp-stats-file'\012"
+
+_L_str_1629:
+    .asciz "--defer-static"
+
+_L_str_1632:
+    .asciz "-I"
+
+_L_str_1633:
+    .asciz "-isystem"
+
+_L_str_1637:
+    .asciz "acc: error: missing path after '%s'\012"
+
+_L_str_1643:
+    .asciz "acc: error: unsupported option '%s'\012"
+
+_L_str_1652:
+    .asciz "acc: error: no input files\012"
+
+_L_str_1655:
+    .asciz "acc: error: use -E, -S, -c or --print-tree option\012"
+
+_L_str_1684:
+    .asciz ".d"
+
+_L_str_1697:
+    .asciz "w"
+
+_L_str_1699:
+    .asciz "acc: error: could not write dependencies to '%s'\012"
+
+_L_str_1717:
+    .asciz "acc: error: no such file or directory: '%s'\012"
+
+_L_str_1727:
+    .asciz "\012"
+
+_L_str_1752:
+    .asciz ".h"
+
+_L_str_1754:
+    .asciz "pch"
+
+_L_str_1757:
+    .asciz "acc: error: no output file for '%s'\012"
+
+_L_str_1761:
+    .asciz "acc: error: could not precompile '%s' into '%s'\012"
+
+_L_str_1775:
+    .asciz "acc: error: could not write report to '%s'\012"
+
+_is_filename_x:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+## func body
+## local scalar init
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-pre
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB1_1:
+    movq  -24(%rbp), %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    je    _LBB1_2
+## for-body
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _isalnum
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB3_2
+    subq  $16, %rsp
+    leaq  _L_str_1526(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _strchr
+    addq  $16, %rsp
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB3_2
+    movl  $1, %eax
+_LBB3_2:
+    cmpl  $0, %eax
+    je    _LBB2_3
+## if-then
+    movl  $0, %eax
+    jmp   _LBB0_0
+    jmp   _LBB2_2
+## if-else
+_LBB2_3:
+_LBB2_2:
+## for-post
+_LBB1_4:
+    leaq  -24(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    leaq  -28(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB1_1
+_LBB1_2:
+## if-cond
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movl  $3, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB4_3
+## if-then
+    movl  $0, %eax
+    jmp   _LBB0_0
+    jmp   _LBB4_2
+## if-else
+_LBB4_3:
+_LBB4_2:
+## if-cond
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movl  $2, %eax
+    movl  %eax, %edx
+    popq  %rax
+    subl  %edx, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $46, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB6_2
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movl  $1, %eax
+    movl  %eax, %edx
+    popq  %rax
+    subl  %edx, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB6_2
+    movl  $1, %eax
+_LBB6_2:
+    cmpl  $0, %eax
+    je    _LBB5_3
+## if-then
+    movl  $1, %eax
+    jmp   _LBB0_0
+    jmp   _LBB5_2
+## if-else
+_LBB5_3:
+_LBB5_2:
+    movl  $0, %eax
+    jmp   _LBB0_0
+_LBB0_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_is_pch_filename:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _strlen
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    movslq %eax, %rax
+    movq  %rax, %rdx
+    popq  %rax
+    cmpq  %rdx, %rax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB8_2
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $4, %eax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1534(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB8_2
+    movl  $1, %eax
+_LBB8_2:
+    jmp   _LBB7_0
+_LBB7_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_add_default_include_dir:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-pre
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB10_1:
+    movq  -16(%rbp), %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    je    _LBB10_2
+## for-body
+## if-cond
+    movq  -16(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $47, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB11_3
+## if-then
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB11_2
+## if-else
+_LBB11_3:
+_LBB11_2:
+## for-post
+_LBB10_4:
+    leaq  -16(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    jmp   _LBB10_1
+_LBB10_2:
+## if-cond
+    movq  -24(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB12_3
+## if-then
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB12_2
+## if-else
+_LBB12_3:
+_LBB12_2:
+## if-cond
+    movq  -32(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    leaq  _L_str_1560(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _strlen
+    addq  $8, %rsp
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $256, %eax
+    movslq %eax, %rax
+    movq  %rax, %rdx
+    popq  %rax
+    cmpq  %rdx, %rax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB13_3
+## if-then
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB13_2
+## if-else
+_LBB13_3:
+_LBB13_2:
+    subq  $32, %rsp
+    leaq  _dir_1556(%rip), %rax
+    movq  %rax, 24(%rsp)
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -32(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _memcpy
+    addq  $32, %rsp
+    subq  $16, %rsp
+    leaq  _dir_1556(%rip), %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1560(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcpy
+    addq  $16, %rsp
+    subq  $16, %rsp
+    leaq  _dir_1556(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movl  $1, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _add_include_dir
+    addq  $16, %rsp
+_LBB9_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _main
+_main:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $144, %rsp
+## func params
+    movl  %edi, -4(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -104(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -104(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    popq  %rax
+    movq  $0, %rdx
+    movq  %rdx, (%rax)
+## local scalar init
+    leaq  -104(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -104(%rbp), %rax
+    addq  $20, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -104(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    popq  %rax
+    movq  $0, %rdx
+    movq  %rdx, (%rax)
+## local scalar init
+    leaq  -104(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    popq  %rax
+    movq  $0, %rdx
+    movq  %rdx, (%rax)
+## local scalar init
+    leaq  -104(%rbp), %rax
+    addq  $40, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -104(%rbp), %rax
+    addq  $44, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -104(%rbp), %rax
+    addq  $48, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -104(%rbp), %rax
+    addq  $52, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -104(%rbp), %rax
+    addq  $56, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -104(%rbp), %rax
+    addq  $60, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -104(%rbp), %rax
+    addq  $64, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -104(%rbp), %rax
+    addq  $68, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -104(%rbp), %rax
+    addq  $72, %rax
+    pushq %rax
+    popq  %rax
+    movq  $0, %rdx
+    movq  %rdx, (%rax)
+## local scalar init
+    leaq  -104(%rbp), %rax
+    addq  $80, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -112(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -120(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -128(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -4(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## while-cond
+_LBB15_4:
+    movq  -120(%rbp), %rax
+    pushq %rax
+    movq  -128(%rbp), %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB15_2
+## while-body
+## if-cond
+    subq  $16, %rsp
+    leaq  _L_str_1573(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -120(%rbp), %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB16_3
+## if-then
+## assign
+    leaq  -104(%rbp), %rax
+    addq  $40, %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB16_2
+## if-else
+_LBB16_3:
+## if-cond
+    subq  $16, %rsp
+    leaq  _L_str_1576(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -120(%rbp), %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB17_3
+## if-then
+## assign
+    leaq  -104(%rbp), %rax
+    addq  $44, %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB17_2
+## if-else
+_LBB17_3:
+## if-cond
+    subq  $16, %rsp
+    leaq  _L_str_1579(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -120(%rbp), %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB18_3
+## if-then
+## assign
+    leaq  -104(%rbp), %rax
+    addq  $48, %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB18_2
+## if-else
+_LBB18_3:
+## if-cond
+    subq  $16, %rsp
+    leaq  _L_str_1582(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -120(%rbp), %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB19_3
+## if-then
+## if-cond
+    leaq  -120(%rbp), %rax
+    movq  (%rax), %rdx
+    addq  $8, %rdx
+    movq  %rdx, (%rax)
+    movq  %rdx, %rax
+    pushq %rax
+    movq  -128(%rbp), %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB20_3
+## if-then
+    subq  $16, %rsp
+    leaq  _L_str_1585(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    movl  $1, %eax
+    jmp   _LBB14_0
+    jmp   _LBB20_2
+## if-else
+_LBB20_3:
+_LBB20_2:
+## if-cond
+    subq  $16, %rsp
+    movq  -120(%rbp), %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movl  $115, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _is_filename_x
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB22_2
+    subq  $16, %rsp
+    movq  -120(%rbp), %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_pch_filename
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB22_2
+    movl  $0, %eax
+_LBB22_2:
+    cmpl  $0, %eax
+    je    _LBB21_3
+## if-then
+## assign
+    leaq  -104(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -120(%rbp), %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB21_2
+## if-else
+_LBB21_3:
+_LBB21_2:
+    jmp   _LBB19_2
+## if-else
+_LBB19_3:
+## if-cond
+    subq  $16, %rsp
+    leaq  _L_str_1588(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -120(%rbp), %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB24_2
+    subq  $16, %rsp
+    leaq  _L_str_1589(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -120(%rbp), %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB24_2
+    movl  $0, %eax
+_LBB24_2:
+    cmpl  $0, %eax
+    je    _LBB23_3
+## if-then
+## assign
+    leaq  -104(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -104(%rbp), %rax
+    addq  $20, %rax
+    pushq %rax
+    subq  $24, %rsp
+    leaq  _L_str_1589(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  -120(%rbp), %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _strcmp
+    addq  $24, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB23_2
+## if-else
+_LBB23_3:
+## if-cond
+    subq  $16, %rsp
+    leaq  _L_str_1592(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -120(%rbp), %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB26_2
+    subq  $16, %rsp
+    leaq  _L_str_1593(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -120(%rbp), %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB26_2
+    movl  $0, %eax
+_LBB26_2:
+    cmpl  $0, %eax
+    je    _LBB25_3
+## if-then
+## local scalar init
+    leaq  -132(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    leaq  _L_str_1593(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  -120(%rbp), %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _strcmp
+    addq  $24, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    leaq  -120(%rbp), %rax
+    movq  (%rax), %rdx
+    addq  $8, %rdx
+    movq  %rdx, (%rax)
+    movq  %rdx, %rax
+    pushq %rax
+    movq  -128(%rbp), %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB27_3
+## if-then
+    subq  $16, %rsp
+    leaq  _L_str_1597(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -120(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    movl  $1, %eax
+    jmp   _LBB14_0
+    jmp   _LBB27_2
+## if-else
+_LBB27_3:
+_LBB27_2:
+## if-cond
+    movl  -132(%rbp), %eax
+    cmpl  $0, %eax
+    je    _LBB28_3
+## if-then
+## assign
+    leaq  -104(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    movq  -120(%rbp), %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB28_2
+## if-else
+_LBB28_3:
+## assign
+    leaq  -104(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    movq  -120(%rbp), %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+_LBB28_2:
+    jmp   _LBB25_2
+## if-else
+_LBB25_3:
+## if-cond
+    subq  $16, %rsp
+    leaq  _L_str_1600(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -120(%rbp), %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB29_3
+## if-then
+## if-cond
+    leaq  -120(%rbp), %rax
+    movq  (%rax), %rdx
+    addq  $8, %rdx
+    movq  %rdx, (%rax)
+    movq  %rdx, %rax
+    pushq %rax
+    movq  -128(%rbp), %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB30_3
+## if-then
+    subq  $16, %rsp
+    leaq  _L_str_1603(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    movl  $1, %eax
+    jmp   _LBB14_0
+    jmp   _LBB30_2
+## if-else
+_LBB30_3:
+_LBB30_2:
+## assign
+    leaq  -104(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movq  -120(%rbp), %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB29_2
+## if-else
+_LBB29_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -120(%rbp), %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movl  $99, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _is_filename_x
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB31_3
+## if-then
+## assign
+    leaq  -112(%rbp), %rax
+    pushq %rax
+    movq  -120(%rbp), %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB31_2
+## if-else
+_LBB31_3:
+## if-cond
+    subq  $16, %rsp
+    leaq  _L_str_1608(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -120(%rbp), %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB32_3
+## if-then
+## assign
+    leaq  -104(%rbp), %rax
+    addq  $52, %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB32_2
+## if-else
+_LBB32_3:
+## if-cond
+    subq  $16, %rsp
+    leaq  _L_str_1611(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -120(%rbp), %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB33_3
+## if-then
+## assign
+    leaq  -104(%rbp), %rax
+    addq  $56, %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB33_2
+## if-else
+_LBB33_3:
+## if-cond
+    subq  $16, %rsp
+    leaq  _L_str_1614(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -120(%rbp), %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB34_3
+## if-then
+## assign
+    leaq  -104(%rbp), %rax
+    addq  $60, %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB34_2
+## if-else
+_LBB34_3:
+## if-cond
+    subq  $16, %rsp
+    leaq  _L_str_1617(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -120(%rbp), %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB35_3
+## if-then
+## assign
+    leaq  -104(%rbp), %rax
+    addq  $64, %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB35_2
+## if-else
+_LBB35_3:
+## if-cond
+    subq  $16, %rsp
+    leaq  _L_str_1620(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -120(%rbp), %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB36_3
+## if-then
+## assign
+    leaq  -104(%rbp), %rax
+    addq  $68, %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB36_2
+## if-else
+_LBB36_3:
+## if-cond
+    subq  $16, %rsp
+    leaq  _L_str_1623(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -120(%rbp), %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB37_3
+## if-then
+## if-cond
+    leaq  -120(%rbp), %rax
+    movq  (%rax), %rdx
+    addq  $8, %rdx
+    movq  %rdx, (%rax)
+    movq  %rdx, %rax
+    pushq %rax
+    movq  -128(%rbp), %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB38_3
+## if-then
+    subq  $16, %rsp
+    leaq  _L_str_1626(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    movl  $1, %eax
+    jmp   _LBB14_0
+    jmp   _LBB38_2
+## if-else
+_LBB38_3:
+_LBB38_2:
+## assign
+    leaq  -104(%rbp), %rax
+    addq  $72, %rax
+    pushq %rax
+    movq  -120(%rbp), %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB37_2
+## if-else
+_LBB37_3:
+## if-cond
+    subq  $16, %rsp
+    leaq  _L_str_1629(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -120(%rbp), %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB39_3
+## if-then
+## assign
+    leaq  -104(%rbp), %rax
+    addq  $80, %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB39_2
+## if-else
+_LBB39_3:
+## if-cond
+    subq  $16, %rsp
+    leaq  _L_str_1632(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -120(%rbp), %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB41_2
+    subq  $16, %rsp
+    leaq  _L_str_1633(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -120(%rbp), %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB41_2
+    movl  $0, %eax
+_LBB41_2:
+    cmpl  $0, %eax
+    je    _LBB40_3
+## if-then
+## local scalar init
+    leaq  -136(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    leaq  _L_str_1633(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  -120(%rbp), %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _strcmp
+    addq  $24, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    leaq  -120(%rbp), %rax
+    movq  (%rax), %rdx
+    addq  $8, %rdx
+    movq  %rdx, (%rax)
+    movq  %rdx, %rax
+    pushq %rax
+    movq  -128(%rbp), %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB42_3
+## if-then
+    subq  $16, %rsp
+    leaq  _L_str_1637(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -120(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    movl  $1, %eax
+    jmp   _LBB14_0
+    jmp   _LBB42_2
+## if-else
+_LBB42_3:
+_LBB42_2:
+    subq  $16, %rsp
+    movq  -120(%rbp), %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movl  -136(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _add_include_dir
+    addq  $16, %rsp
+    jmp   _LBB40_2
+## if-else
+_LBB40_3:
+## if-cond
+    movq  -120(%rbp), %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $45, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB44_2
+    movq  -120(%rbp), %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $73, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB44_2
+    movl  $1, %eax
+_LBB44_2:
+    cmpl  $0, %eax
+    je    _LBB43_3
+## if-then
+    subq  $16, %rsp
+    movq  -120(%rbp), %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  %rax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _add_include_dir
+    addq  $16, %rsp
+    jmp   _LBB43_2
+## if-else
+_LBB43_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -120(%rbp), %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _strlen
+    addq  $16, %rsp
+    pushq %rax
+    movl  $0, %eax
+    movslq %eax, %rax
+    movq  %rax, %rdx
+    popq  %rax
+    cmpq  %rdx, %rax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB46_2
+    movq  -120(%rbp), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $45, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB46_2
+    movl  $1, %eax
+_LBB46_2:
+    cmpl  $0, %eax
+    je    _LBB45_3
+## if-then
+    subq  $16, %rsp
+    leaq  _L_str_1643(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -120(%rbp), %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    movl  $1, %eax
+    jmp   _LBB14_0
+    jmp   _LBB45_2
+## if-else
+_LBB45_3:
+_LBB45_2:
+_LBB43_2:
+_LBB40_2:
+_LBB39_2:
+_LBB37_2:
+_LBB36_2:
+_LBB35_2:
+_LBB34_2:
+_LBB33_2:
+_LBB32_2:
+_LBB31_2:
+_LBB29_2:
+_LBB25_2:
+_LBB23_2:
+_LBB19_2:
+_LBB18_2:
+_LBB17_2:
+_LBB16_2:
+    leaq  -120(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $8, %rcx
+    movq  %rcx, (%rdx)
+    jmp   _LBB15_4
+_LBB15_2:
+## if-cond
+    leaq  -104(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    je    _LBB47_3
+## if-then
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _add_default_include_dir
+    addq  $16, %rsp
+## assign
+    leaq  -140(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    leaq  -104(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    leaq  -104(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _precompile
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    callq _free_arenas
+    callq _free_include_dirs
+    movl  -140(%rbp), %eax
+    jmp   _LBB14_0
+    jmp   _LBB47_2
+## if-else
+_LBB47_3:
+_LBB47_2:
+## if-cond
+    movq  -112(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB48_3
+## if-then
+    subq  $16, %rsp
+    leaq  _L_str_1652(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    movl  $1, %eax
+    jmp   _LBB14_0
+    jmp   _LBB48_2
+## if-else
+_LBB48_3:
+_LBB48_2:
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _add_default_include_dir
+    addq  $16, %rsp
+## if-cond
+    leaq  -104(%rbp), %rax
+    addq  $48, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB52_2
+    leaq  -104(%rbp), %rax
+    addq  $44, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB52_2
+    movl  $1, %eax
+_LBB52_2:
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB51_2
+    leaq  -104(%rbp), %rax
+    addq  $40, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB51_2
+    movl  $1, %eax
+_LBB51_2:
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB50_2
+    leaq  -104(%rbp), %rax
+    addq  $52, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB50_2
+    movl  $1, %eax
+_LBB50_2:
+    cmpl  $0, %eax
+    je    _LBB49_3
+## if-then
+    subq  $16, %rsp
+    leaq  _L_str_1655(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    movl  $1, %eax
+    jmp   _LBB14_0
+    jmp   _LBB49_2
+## if-else
+_LBB49_3:
+_LBB49_2:
+## local scalar init
+    leaq  -144(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -112(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    leaq  -104(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _compile
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    callq _free_arenas
+    callq _free_include_dirs
+    movl  -144(%rbp), %eax
+    jmp   _LBB14_0
+_LBB14_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_make_output_filename:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+    movq  %rdx, -24(%rbp)
+    movq  %rcx, -32(%rbp)
+## func body
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _strlen
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -40(%rbp), %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    movq  %rax, %rdx
+    popq  %rax
+    cmpq  %rdx, %rax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB54_3
+## if-then
+    jmp   _LBB53_0
+    jmp   _LBB54_2
+## if-else
+_LBB54_3:
+_LBB54_2:
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcpy
+    addq  $16, %rsp
+## if-cond
+    movq  -24(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  -40(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $99, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB55_3
+## if-then
+## assign
+    movq  -24(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  -40(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+    jmp   _LBB55_2
+## if-else
+_LBB55_3:
+_LBB55_2:
+_LBB53_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_make_dep_filename:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movq  %rdx, -24(%rbp)
+## func body
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _strlen
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## if-cond
+    movq  -32(%rbp), %rax
+    pushq %rax
+    movl  $3, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    movq  %rax, %rdx
+    popq  %rax
+    cmpq  %rdx, %rax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB57_3
+## if-then
+    jmp   _LBB56_0
+    jmp   _LBB57_2
+## if-else
+_LBB57_3:
+_LBB57_2:
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcpy
+    addq  $16, %rsp
+## for-pre
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB58_1:
+    movq  -40(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    movslq %eax, %rax
+    movq  %rax, %rdx
+    popq  %rax
+    cmpq  %rdx, %rax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB58_2
+## for-body
+## if-cond
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  -40(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $47, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB59_3
+## if-then
+    jmp   _LBB58_2
+    jmp   _LBB59_2
+## if-else
+_LBB59_3:
+_LBB59_2:
+## if-cond
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  -40(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $46, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB60_3
+## if-then
+## assign
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  -40(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+    jmp   _LBB58_2
+    jmp   _LBB60_2
+## if-else
+_LBB60_3:
+_LBB60_2:
+## for-post
+_LBB58_4:
+    leaq  -40(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    subq  $1, %rcx
+    movq  %rcx, (%rdx)
+    jmp   _LBB58_1
+_LBB58_2:
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    pushq %rax
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _strlen
+    addq  $16, %rsp
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1684(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcpy
+    addq  $16, %rsp
+_LBB56_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_write_dep_file:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $304, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movq  %rdx, -24(%rbp)
+## func body
+## local scalar init
+    leaq  -280(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $1, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $2, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $3, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $5, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $6, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $7, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $9, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $10, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $11, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $12, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $13, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $14, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $15, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $17, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $18, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $19, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $20, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $21, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $22, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $23, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $25, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $26, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $27, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $28, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $29, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $30, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $31, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $33, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $34, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $35, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $36, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $37, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $38, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $39, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $40, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $41, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $42, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $43, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $44, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $45, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $46, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $47, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $48, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $49, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $50, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $51, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $52, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $53, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $54, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $55, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $56, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $57, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $58, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $59, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $60, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $61, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $62, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $63, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $64, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $65, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $66, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $67, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $68, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $69, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $70, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $71, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $72, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $73, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $74, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $75, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $76, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $77, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $78, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $79, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $80, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $81, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $82, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $83, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $84, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $85, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $86, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $87, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $88, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $89, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $90, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $91, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $92, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $93, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $94, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $95, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $96, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $97, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $98, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $99, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $100, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $101, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $102, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $103, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $104, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $105, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $106, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $107, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $108, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $109, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $110, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $111, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $112, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $113, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $114, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $115, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $116, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $117, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $118, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $119, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $120, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $121, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $122, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $123, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $124, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $125, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $126, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $127, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $128, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $129, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $130, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $131, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $132, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $133, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $134, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $135, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $136, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $137, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $138, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $139, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $140, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $141, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $142, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $143, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $144, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $145, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $146, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $147, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $148, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $149, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $150, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $151, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $152, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $153, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $154, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $155, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $156, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $157, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $158, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $159, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $160, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $161, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $162, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $163, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $164, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $165, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $166, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $167, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $168, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $169, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $170, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $171, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $172, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $173, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $174, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $175, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $176, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $177, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $178, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $179, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $180, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $181, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $182, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $183, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $184, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $185, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $186, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $187, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $188, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $189, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $190, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $191, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $192, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $193, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $194, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $195, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $196, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $197, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $198, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $199, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $200, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $201, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $202, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $203, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $204, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $205, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $206, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $207, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $208, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $209, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $210, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $211, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $212, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $213, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $214, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $215, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $216, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $217, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $218, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $219, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $220, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $221, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $222, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $223, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $224, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $225, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $226, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $227, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $228, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $229, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $230, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $231, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $232, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $233, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $234, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $235, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $236, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $237, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $238, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $239, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $240, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $241, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $242, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $243, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $244, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $245, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $246, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $247, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $248, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $249, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $250, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $251, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $252, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $253, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $254, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $255, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -288(%rbp), %rax
+    pushq %rax
+## cond-?
+    movq  -24(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    je    _LBB62_3
+## cond-then
+    movq  -24(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    jmp   _LBB62_2
+## cond-else
+_LBB62_3:
+    movq  -16(%rbp), %rax
+_LBB62_2:
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -296(%rbp), %rax
+    pushq %rax
+    leaq  -280(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -24(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    je    _LBB63_3
+## if-then
+## assign
+    leaq  -296(%rbp), %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB63_2
+## if-else
+_LBB63_3:
+    subq  $32, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  -280(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  $256, %eax
+    pushq %rax
+    movl  $1, %eax
+    movl  %eax, %edi
+    popq  %rax
+    cltd
+    idivl %edi
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _make_dep_filename
+    addq  $32, %rsp
+_LBB63_2:
+## assign
+    leaq  -304(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -296(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_1697(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _fopen
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -304(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB64_3
+## if-then
+    subq  $32, %rsp
+    movq  ___stderrp@GOTPCREL(%rip), %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_1699(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  -296(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+    movl  $1, %eax
+    jmp   _LBB61_0
+    jmp   _LBB64_2
+## if-else
+_LBB64_3:
+_LBB64_2:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -304(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -288(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    addq  $20, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movl  (%rsp), %ecx
+    callq _write_dependencies
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -304(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _fclose
+    addq  $16, %rsp
+    movl  $0, %eax
+    jmp   _LBB61_0
+_LBB61_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_compile:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $336, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -64(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $1, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $2, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $3, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $5, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $6, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $7, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $9, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $10, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $11, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $12, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $13, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $14, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $15, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $17, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $18, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $19, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $20, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $21, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $22, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $23, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $25, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $26, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $27, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $28, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $29, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $30, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $31, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $33, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $34, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $35, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $36, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $37, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $38, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $39, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $40, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $41, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $42, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $43, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $44, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $45, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $46, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $47, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $48, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $49, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $50, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $51, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $52, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $53, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $54, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $55, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $56, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $57, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $58, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $59, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $60, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $61, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $62, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $63, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $64, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $65, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $66, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $67, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $68, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $69, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $70, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $71, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $72, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $73, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $74, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $75, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $76, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $77, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $78, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $79, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $80, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $81, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $82, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $83, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $84, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $85, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $86, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $87, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $88, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $89, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $90, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $91, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $92, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $93, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $94, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $95, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $96, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $97, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $98, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $99, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $100, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $101, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $102, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $103, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $104, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $105, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $106, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $107, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $108, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $109, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $110, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $111, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $112, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $113, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $114, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $115, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $116, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $117, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $118, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $119, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $120, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $121, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $122, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $123, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $124, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $125, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $126, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $127, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $128, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $129, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $130, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $131, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $132, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $133, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $134, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $135, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $136, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $137, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $138, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $139, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $140, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $141, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $142, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $143, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $144, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $145, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $146, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $147, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $148, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $149, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $150, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $151, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $152, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $153, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $154, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $155, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $156, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $157, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $158, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $159, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $160, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $161, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $162, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $163, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $164, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $165, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $166, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $167, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $168, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $169, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $170, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $171, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $172, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $173, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $174, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $175, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $176, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $177, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $178, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $179, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $180, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $181, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $182, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $183, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $184, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $185, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $186, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $187, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $188, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $189, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $190, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $191, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $192, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $193, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $194, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $195, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $196, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $197, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $198, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $199, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $200, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $201, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $202, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $203, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $204, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $205, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $206, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $207, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $208, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $209, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $210, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $211, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $212, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $213, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $214, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $215, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $216, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $217, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $218, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $219, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $220, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $221, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $222, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $223, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $224, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $225, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $226, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $227, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $228, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $229, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $230, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $231, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $232, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $233, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $234, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $235, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $236, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $237, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $238, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $239, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $240, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $241, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $242, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $243, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $244, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $245, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $246, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $247, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $248, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $249, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $250, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $251, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $252, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $253, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $254, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -320(%rbp), %rax
+    addq  $255, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -324(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    callq _new_preprocessor
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _preprocess_file
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB66_3
+## if-then
+    subq  $16, %rsp
+    leaq  _L_str_1717(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+## assign
+    leaq  -324(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB65_1818
+    jmp   _LBB66_2
+## if-else
+_LBB66_3:
+_LBB66_2:
+## if-cond
+    movq  -16(%rbp), %rax
+    addq  $40, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    je    _LBB67_3
+## if-then
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _print_text
+    addq  $16, %rsp
+## if-cond
+    movq  -24(%rbp), %rax
+    addq  $144, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB68_3
+## if-then
+## assign
+    leaq  -324(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB68_2
+## if-else
+_LBB68_3:
+## if-cond
+    movq  -16(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    je    _LBB69_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $111, %eax
+    movl  %eax, 16(%rsp)
+    leaq  -320(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $256, %eax
+    pushq %rax
+    movl  $1, %eax
+    movl  %eax, %edi
+    popq  %rax
+    cltd
+    idivl %edi
+    movslq %eax, %rax
+    movq  %rax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movq  8(%rsp), %rdx
+    movq  (%rsp), %rcx
+    callq _make_output_filename
+    addq  $32, %rsp
+## if-cond
+    subq  $32, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  -320(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _write_dep_file
+    addq  $32, %rsp
+    cmpl  $0, %eax
+    je    _LBB70_3
+## if-then
+## assign
+    leaq  -324(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB70_2
+## if-else
+_LBB70_3:
+_LBB70_2:
+    jmp   _LBB69_2
+## if-else
+_LBB69_3:
+_LBB69_2:
+_LBB68_2:
+    jmp   _LBB65_1818
+    jmp   _LBB67_2
+## if-else
+_LBB67_3:
+_LBB67_2:
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    callq _new_symbol_table
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    callq _new_diagnostic
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -40(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _get_source_map
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    callq _new_parser
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -48(%rbp), %rax
+    addq  $120, %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $80, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    subq  $40, %rsp
+    movq  -48(%rbp), %rax
+    movq  %rax, 32(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -32(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -40(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  32(%rsp), %rdi
+    movq  24(%rsp), %rsi
+    movq  16(%rsp), %rdx
+    movq  8(%rsp), %rcx
+    callq _parse_source
+    addq  $40, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $32, %rsp
+    movq  -56(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -32(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -40(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _analyze_semantics
+    addq  $32, %rsp
+## if-cond
+    movq  -16(%rbp), %rax
+    addq  $52, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    je    _LBB71_3
+## if-then
+    subq  $16, %rsp
+    movq  -56(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _print_tree
+    addq  $16, %rsp
+    subq  $16, %rsp
+    leaq  _L_str_1727(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -32(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _print_symbol_table
+    addq  $16, %rsp
+    jmp   _LBB65_1818
+    jmp   _LBB71_2
+## if-else
+_LBB71_3:
+_LBB71_2:
+## if-cond
+    movq  -40(%rbp), %rax
+    addq  $168, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB72_3
+## if-then
+    subq  $16, %rsp
+    movq  -40(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _print_warnings
+    addq  $16, %rsp
+    jmp   _LBB72_2
+## if-else
+_LBB72_3:
+_LBB72_2:
+## if-cond
+    movq  -40(%rbp), %rax
+    addq  $172, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB74_2
+    movq  -24(%rbp), %rax
+    addq  $144, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB74_2
+    movl  $0, %eax
+_LBB74_2:
+    cmpl  $0, %eax
+    je    _LBB73_3
+## if-then
+    subq  $16, %rsp
+    movq  -40(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _print_errors
+    addq  $16, %rsp
+## assign
+    leaq  -324(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB65_1818
+    jmp   _LBB73_2
+## if-else
+_LBB73_3:
+_LBB73_2:
+## if-cond
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    je    _LBB75_3
+## if-then
+    subq  $16, %rsp
+    leaq  -320(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcpy
+    addq  $16, %rsp
+    jmp   _LBB75_2
+## if-else
+_LBB75_3:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+## cond-?
+    movq  -16(%rbp), %rax
+    addq  $44, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    je    _LBB76_3
+## cond-then
+    movl  $115, %eax
+    jmp   _LBB76_2
+## cond-else
+_LBB76_3:
+    movl  $111, %eax
+_LBB76_2:
+    movl  %eax, 16(%rsp)
+    leaq  -320(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $256, %eax
+    pushq %rax
+    movl  $1, %eax
+    movl  %eax, %edi
+    popq  %rax
+    cltd
+    idivl %edi
+    movslq %eax, %rax
+    movq  %rax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movq  8(%rsp), %rdx
+    movq  (%rsp), %rcx
+    callq _make_output_filename
+    addq  $32, %rsp
+_LBB75_2:
+## if-cond
+    movq  -16(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB78_2
+    movq  -16(%rbp), %rax
+    addq  $44, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB79_2
+    movq  -16(%rbp), %rax
+    addq  $48, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB79_2
+    movl  $0, %eax
+_LBB79_2:
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB78_2
+    movl  $1, %eax
+_LBB78_2:
+    cmpl  $0, %eax
+    je    _LBB77_3
+## if-then
+## if-cond
+    subq  $32, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  -320(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _write_dep_file
+    addq  $32, %rsp
+    cmpl  $0, %eax
+    je    _LBB80_3
+## if-then
+## assign
+    leaq  -324(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB65_1818
+    jmp   _LBB80_2
+## if-else
+_LBB80_3:
+_LBB80_2:
+    jmp   _LBB77_2
+## if-else
+_LBB77_3:
+_LBB77_2:
+## if-cond
+    movq  -16(%rbp), %rax
+    addq  $44, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    je    _LBB81_3
+## if-then
+## assign
+    leaq  -64(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    leaq  -320(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_1697(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _fopen
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -64(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB82_3
+## if-then
+## assign
+    leaq  -324(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB65_1818
+    jmp   _LBB82_2
+## if-else
+_LBB82_3:
+_LBB82_2:
+    subq  $32, %rsp
+    movq  -64(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -56(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -32(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _gen_x64
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -64(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _fclose
+    addq  $16, %rsp
+    jmp   _LBB81_2
+## if-else
+_LBB81_3:
+_LBB81_2:
+_LBB65_1818:
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _print_pp_report
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB83_3
+## if-then
+## assign
+    leaq  -324(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB83_2
+## if-else
+_LBB83_3:
+_LBB83_2:
+    subq  $16, %rsp
+    movq  -48(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free_parser
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -40(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free_diagnostic
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -32(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free_symbol_table
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free_preprocessor
+    addq  $16, %rsp
+## if-cond
+    movq  -16(%rbp), %rax
+    addq  $56, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    je    _LBB84_3
+## if-then
+    callq _print_arena_stats
+    jmp   _LBB84_2
+## if-else
+_LBB84_3:
+_LBB84_2:
+    callq _reset_arenas
+    movl  -324(%rbp), %eax
+    jmp   _LBB65_0
+_LBB65_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_precompile:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $304, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    callq _new_preprocessor
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $1, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $2, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $3, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $5, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $6, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $7, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $9, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $10, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $11, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $12, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $13, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $14, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $15, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $17, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $18, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $19, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $20, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $21, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $22, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $23, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $25, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $26, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $27, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $28, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $29, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $30, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $31, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $33, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $34, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $35, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $36, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $37, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $38, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $39, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $40, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $41, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $42, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $43, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $44, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $45, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $46, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $47, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $48, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $49, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $50, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $51, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $52, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $53, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $54, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $55, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $56, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $57, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $58, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $59, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $60, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $61, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $62, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $63, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $64, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $65, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $66, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $67, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $68, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $69, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $70, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $71, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $72, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $73, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $74, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $75, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $76, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $77, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $78, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $79, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $80, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $81, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $82, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $83, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $84, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $85, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $86, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $87, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $88, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $89, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $90, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $91, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $92, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $93, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $94, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $95, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $96, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $97, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $98, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $99, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $100, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $101, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $102, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $103, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $104, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $105, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $106, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $107, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $108, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $109, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $110, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $111, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $112, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $113, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $114, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $115, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $116, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $117, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $118, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $119, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $120, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $121, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $122, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $123, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $124, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $125, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $126, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $127, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $128, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $129, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $130, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $131, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $132, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $133, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $134, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $135, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $136, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $137, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $138, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $139, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $140, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $141, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $142, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $143, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $144, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $145, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $146, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $147, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $148, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $149, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $150, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $151, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $152, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $153, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $154, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $155, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $156, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $157, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $158, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $159, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $160, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $161, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $162, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $163, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $164, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $165, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $166, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $167, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $168, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $169, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $170, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $171, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $172, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $173, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $174, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $175, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $176, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $177, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $178, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $179, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $180, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $181, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $182, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $183, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $184, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $185, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $186, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $187, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $188, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $189, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $190, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $191, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $192, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $193, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $194, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $195, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $196, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $197, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $198, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $199, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $200, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $201, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $202, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $203, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $204, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $205, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $206, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $207, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $208, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $209, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $210, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $211, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $212, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $213, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $214, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $215, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $216, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $217, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $218, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $219, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $220, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $221, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $222, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $223, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $224, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $225, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $226, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $227, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $228, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $229, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $230, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $231, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $232, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $233, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $234, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $235, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $236, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $237, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $238, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $239, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $240, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $241, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $242, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $243, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $244, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $245, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $246, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $247, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $248, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $249, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $250, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $251, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $252, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $253, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $254, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $255, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -288(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _strlen
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -292(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    movl  $0, %eax
+    je    _LBB87_2
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_pch_filename
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB87_2
+    movl  $1, %eax
+_LBB87_2:
+    cmpl  $0, %eax
+    je    _LBB86_3
+## if-then
+    subq  $16, %rsp
+    leaq  -280(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcpy
+    addq  $16, %rsp
+    jmp   _LBB86_2
+## if-else
+_LBB86_3:
+## if-cond
+    movq  -288(%rbp), %rax
+    pushq %rax
+    movl  $2, %eax
+    movslq %eax, %rax
+    movq  %rax, %rdx
+    popq  %rax
+    cmpq  %rdx, %rax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB90_2
+    movq  -288(%rbp), %rax
+    pushq %rax
+    movl  $3, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $256, %eax
+    movslq %eax, %rax
+    movq  %rax, %rdx
+    popq  %rax
+    cmpq  %rdx, %rax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB90_2
+    movl  $1, %eax
+_LBB90_2:
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB89_2
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  -288(%rbp), %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $2, %eax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1752(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB89_2
+    movl  $1, %eax
+_LBB89_2:
+    cmpl  $0, %eax
+    je    _LBB88_3
+## if-then
+    subq  $16, %rsp
+    leaq  -280(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcpy
+    addq  $16, %rsp
+    subq  $16, %rsp
+    leaq  -280(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  -288(%rbp), %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1754(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcpy
+    addq  $16, %rsp
+    jmp   _LBB88_2
+## if-else
+_LBB88_3:
+    subq  $16, %rsp
+    leaq  _L_str_1757(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+## assign
+    leaq  -292(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB85_1858
+_LBB88_2:
+_LBB86_2:
+## if-cond
+    subq  $32, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    leaq  -280(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _precompile_header
+    addq  $32, %rsp
+    cmpl  $0, %eax
+    je    _LBB91_3
+## if-then
+    subq  $32, %rsp
+    leaq  _L_str_1761(%rip), %rax
+    movq  %rax, 24(%rsp)
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    leaq  -280(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _printf
+    addq  $32, %rsp
+## assign
+    leaq  -292(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB91_2
+## if-else
+_LBB91_3:
+## if-cond
+    movq  -24(%rbp), %rax
+    addq  $144, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB92_3
+## if-then
+## assign
+    leaq  -292(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB92_2
+## if-else
+_LBB92_3:
+_LBB92_2:
+_LBB91_2:
+_LBB85_1858:
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _print_pp_report
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB93_3
+## if-then
+## assign
+    leaq  -292(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB93_2
+## if-else
+_LBB93_3:
+_LBB93_2:
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free_preprocessor
+    addq  $16, %rsp
+    callq _reset_arenas
+    movl  -292(%rbp), %eax
+    jmp   _LBB85_0
+_LBB85_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_print_pp_report:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  ___stderrp@GOTPCREL(%rip), %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -16(%rbp), %rax
+    addq  $64, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB97_2
+    movq  -16(%rbp), %rax
+    addq  $60, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB97_2
+    movl  $1, %eax
+_LBB97_2:
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB96_2
+    movq  -16(%rbp), %rax
+    addq  $68, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB96_2
+    movl  $1, %eax
+_LBB96_2:
+    cmpl  $0, %eax
+    je    _LBB95_3
+## if-then
+    movl  $0, %eax
+    jmp   _LBB94_0
+    jmp   _LBB95_2
+## if-else
+_LBB95_3:
+_LBB95_2:
+## if-cond
+    movq  -16(%rbp), %rax
+    addq  $72, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    je    _LBB98_3
+## if-then
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -16(%rbp), %rax
+    addq  $72, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_1697(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _fopen
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -24(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB99_3
+## if-then
+    subq  $32, %rsp
+    movq  ___stderrp@GOTPCREL(%rip), %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_1775(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $72, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+    movl  $1, %eax
+    jmp   _LBB94_0
+    jmp   _LBB99_2
+## if-else
+_LBB99_3:
+_LBB99_2:
+    jmp   _LBB98_2
+## if-else
+_LBB98_3:
+_LBB98_2:
+## if-cond
+    movq  -16(%rbp), %rax
+    addq  $64, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    je    _LBB100_3
+## if-then
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _print_preprocessor_stats_json
+    addq  $16, %rsp
+    jmp   _LBB100_2
+## if-else
+_LBB100_3:
+## if-cond
+    movq  -16(%rbp), %rax
+    addq  $60, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    je    _LBB101_3
+## if-then
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _print_preprocessor_stats
+    addq  $16, %rsp
+    jmp   _LBB101_2
+## if-else
+_LBB101_3:
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _print_include_tree
+    addq  $16, %rsp
+_LBB101_2:
+_LBB100_2:
+## if-cond
+    movq  -24(%rbp), %rax
+    pushq %rax
+    movq  ___stderrp@GOTPCREL(%rip), %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB102_3
+## if-then
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _fclose
+    addq  $16, %rsp
+    jmp   _LBB102_2
+## if-else
+_LBB102_3:
+_LBB102_2:
+    movl  $0, %eax
+    jmp   _LBB94_0
+_LBB94_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
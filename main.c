@@ -9,13 +9,28 @@
 #include "parse.h"
 #include "semantics.h"
 #include "preprocessor.h"
+#include "arena.h"
+#include "search_path.h"
 
 struct option {
     const char *out_filename;
+    const char *precompile;
+    /* -MD -MMD -MF -MT */
+    int make_deps;
+    int skip_system_deps;
+    const char *dep_filename;
+    const char *dep_target;
     int preprocess;
     int preprocess_compile;
     int preprocess_compile_assemble;
     int print_tree;
+    int print_mem_stats;
+    int print_pp_stats;
+    int print_pp_stats_json;
+    int print_include_tree;
+    /* reports go to stderr unless a file is named */
+    const char *pp_stats_filename;
+    int defer_static_bodies;
 };
 
 static int is_filename_x(const char *name, int ext)
@@ -36,7 +51,37 @@ static int is_filename_x(const char *name, int ext)
     return 0;
 }
 
+static int is_pch_filename(const char *name)
+{
+    const size_t len = strlen(name);
+
+    return len > 4 && !strcmp(name + len - 4, ".pch");
+}
+
 static int compile(const char *infile, const struct option *opt);
+static int print_pp_report(const struct preprocessor *pp, const struct option *opt);
+static int precompile(const char *header, const struct option *opt);
+
+static void add_default_include_dir(const char *argv0)
+{
+    /* the headers next to the compiler */
+    static char dir[256] = {'\0'};
+    const char *s, *slash = NULL;
+    size_t len = 0;
+
+    for (s = argv0; *s; s++)
+        if (*s == '/')
+            slash = s;
+
+    if (slash)
+        len = slash - argv0 + 1;
+    if (len + strlen("include") + 1 > sizeof(dir))
+        len = 0;
+
+    memcpy(dir, argv0, len);
+    strcpy(dir + len, "include");
+    add_include_dir(dir, 1);
+}
 
 int main(int argc, char **argv)
 {
@@ -60,15 +105,72 @@ int main(int argc, char **argv)
                 printf("acc: error: missing file name after '-o'\n");
                 return 1;
             }
-            if (is_filename_x(*argp, 's'))
+            if (is_filename_x(*argp, 's') || is_pch_filename(*argp))
                 opt.out_filename = *argp;
         }
+        else if (!strcmp("-MD", *argp) || !strcmp("-MMD", *argp)) {
+            opt.make_deps = 1;
+            opt.skip_system_deps = !strcmp("-MMD", *argp);
+        }
+        else if (!strcmp("-MF", *argp) || !strcmp("-MT", *argp)) {
+            const int is_target = !strcmp("-MT", *argp);
+            if (++argp == endp) {
+                printf("acc: error: missing argument after '%s'\n", *(argp - 1));
+                return 1;
+            }
+            if (is_target)
+                opt.dep_target = *argp;
+            else
+                opt.dep_filename = *argp;
+        }
+        else if (!strcmp("--precompile", *argp)) {
+            if (++argp == endp) {
+                printf("acc: error: missing header after '--precompile'\n");
+                return 1;
+            }
+            opt.precompile = *argp;
+        }
         else if (is_filename_x(*argp, 'c')) {
             infile = *argp;
         }
         else if (!strcmp("--print-tree", *argp)) {
             opt.print_tree = 1;
         }
+        else if (!strcmp("--mem-stats", *argp)) {
+            opt.print_mem_stats = 1;
+        }
+        else if (!strcmp("--pp-stats", *argp)) {
+            opt.print_pp_stats = 1;
+        }
+        else if (!strcmp("--pp-stats=json", *argp)) {
+            opt.print_pp_stats_json = 1;
+        }
+        else if (!strcmp("-H", *argp)) {
+            opt.print_include_tree = 1;
+        }
+        else if (!strcmp("--pp-stats-file", *argp)) {
+            if (++argp == endp) {
+                printf("acc: error: missing file name after '--pp-stats-file'\n");
+                return 1;
+            }
+            opt.pp_stats_filename = *argp;
+        }
+        else if (!strcmp("--defer-static", *argp)) {
+            /* bodies of static functions never named are not parsed, so
+             * they are not checked beyond pairing of brackets */
+            opt.defer_static_bodies = 1;
+        }
+        else if (!strcmp("-I", *argp) || !strcmp("-isystem", *argp)) {
+            const int is_system = !strcmp("-isystem", *argp);
+            if (++argp == endp) {
+                printf("acc: error: missing path after '%s'\n", *(argp - 1));
+                return 1;
+            }
+            add_include_dir(*argp, is_system);
+        }
+        else if ((*argp)[0] == '-' && (*argp)[1] == 'I') {
+            add_include_dir(*argp + 2, 0);
+        }
         else if (strlen(*argp) > 0 && *argp[0] == '-') {
             printf("acc: error: unsupported option '%s'\n", *argp);
             return 1;
@@ -79,11 +181,22 @@ int main(int argc, char **argv)
         argp++;
     }
 
+    if (opt.precompile) {
+        int ret;
+        add_default_include_dir(argv[0]);
+        ret = precompile(opt.precompile, &opt);
+        free_arenas();
+        free_include_dirs();
+        return ret;
+    }
+
     if (!infile) {
         printf("acc: error: no input files\n");
         return 1;
     }
 
+    add_default_include_dir(argv[0]);
+
     if (!opt.preprocess_compile_assemble &&
         !opt.preprocess_compile &&
         !opt.preprocess &&
@@ -92,10 +205,16 @@ int main(int argc, char **argv)
         return 1;
     }
 
-    return compile(infile, &opt);
+    {
+        const int ret = compile(infile, &opt);
+        free_arenas();
+        free_include_dirs();
+        return ret;
+    }
 }
 
-static void make_output_filename(const char *input, char *output, size_t size)
+static void make_output_filename(const char *input, int ext, char *output,
+        size_t size)
 {
     const size_t len = strlen(input);
     if (len > size - 1)
@@ -103,7 +222,54 @@ static void make_output_filename(const char *input, char *output, size_t size)
 
     strcpy(output, input);
     if (output[len - 1] == 'c')
-        output[len - 1] = 's';
+        output[len - 1] = ext;
+}
+
+/* foo.s -> foo.d */
+static void make_dep_filename(const char *output, char *depfile, size_t size)
+{
+    const size_t len = strlen(output);
+    size_t i;
+
+    depfile[0] = '\0';
+    if (len + 3 > size)
+        return;
+
+    strcpy(depfile, output);
+    for (i = len; i > 0; i--) {
+        if (depfile[i - 1] == '/')
+            break;
+        if (depfile[i - 1] == '.') {
+            depfile[i - 1] = '\0';
+            break;
+        }
+    }
+    strcpy(depfile + strlen(depfile), ".d");
+}
+
+static int write_dep_file(const struct preprocessor *pp, const char *output,
+        const struct option *opt)
+{
+    char depfile[256] = {'\0'};
+    const char *target = opt->dep_target ? opt->dep_target : output;
+    const char *path = depfile;
+    FILE *fp;
+
+    if (opt->dep_filename)
+        path = opt->dep_filename;
+    else
+        make_dep_filename(output, depfile, sizeof(depfile)/sizeof(depfile[0]));
+
+    fp = fopen(path, "w");
+    if (!fp) {
+        fprintf(stderr, "acc: error: could not write dependencies to '%s'\n", path);
+        return 1;
+    }
+
+    write_dependencies(pp, fp, target, opt->skip_system_deps);
+    fclose(fp);
+
+    return 0;
 }
 
 static int compile(const char *infile, const struct option *opt)
@@ -119,19 +285,36 @@ static int compile(const char *infile, const struct option *opt)
 
     /* preprocess */
     pp = new_preprocessor();
-    preprocess_file(pp, infile);
+    if (preprocess_file(pp, infile)) {
+        printf("acc: error: no such file or directory: '%s'\n", infile);
+        ret = 1;
+        goto finalize;
+    }
 
     if (opt->preprocess) {
-        printf("%s", get_text(pp));
+        print_text(pp);
+        if (pp->error_count > 0) {
+            ret = 1;
+        }
+        else if (opt->make_deps) {
+            /* foo.c -> foo.o as the target, the same as for -c */
+            make_output_filename(infile, 'o',
+                    outfile, sizeof(outfile)/sizeof(outfile[0]));
+            if (write_dep_file(pp, outfile, opt))
+                ret = 1;
+        }
         goto finalize;
     }
 
     /* parse */
     symtab = new_symbol_table();
     diag = new_diagnostic();
+    diag->srcmap = get_source_map(pp);
 
     parser = new_parser();
-    tree = parse_text(parser, get_text(pp), symtab, diag);
+    parser->defer_static_bodies = opt->defer_static_bodies;
+    /* preprocessed text is read as parsing goes */
+    tree = parse_source(parser, pp, symtab, diag);
 
     /* semantics */
     analyze_semantics(tree, symtab, diag);
@@ -147,19 +330,29 @@ static int compile(const char *infile, const struct option *opt)
     if (diag->warning_count > 0)
         print_warnings(diag);
 
-    if (diag->error_count > 0) {
+    /* errors of the preprocessor have been printed as they were found */
+    if (diag->error_count > 0 || pp->error_count > 0) {
         print_errors(diag);
         ret = 1;
         goto finalize;
     }
 
+    if (opt->out_filename)
+        strcpy(outfile, opt->out_filename);
+    else
+        make_output_filename(infile, opt->preprocess_compile ? 's' : 'o',
+                outfile, sizeof(outfile)/sizeof(outfile[0]));
+
+    /* every file has been read by now */
+    if (opt->make_deps && (opt->preprocess_compile || opt->preprocess_compile_assemble)) {
+        if (write_dep_file(pp, outfile, opt)) {
+            ret = 1;
+            goto finalize;
+        }
+    }
+
     /* compile */
     if (opt->preprocess_compile) {
-        if (opt->out_filename)
-            strcpy(outfile, opt->out_filename);
-        else
-            make_output_filename(infile, outfile, sizeof(outfile)/sizeof(outfile[0]));
-
         fp = fopen(outfile, "w");
         if (!fp) {
             ret = 1;
@@ -170,11 +363,88 @@ static int compile(const char *infile, const struct option *opt)
     }
 
 finalize:
-    free_ast_node(tree);
+    if (print_pp_report(pp, opt))
+        ret = 1;
+
     free_parser(parser);
     free_diagnostic(diag);
     free_symbol_table(symtab);
     free_preprocessor(pp);
 
+    if (opt->print_mem_stats)
+        print_arena_stats();
+    /* drops the tree, types and symbols of this translation unit at once */
+    reset_arenas();
+
+    return ret;
+}
+
+static int precompile(const char *header, const struct option *opt)
+{
+    struct preprocessor *pp = new_preprocessor();
+    char outfile[256] = {'\0'};
+    const size_t len = strlen(header);
+    int ret = 0;
+
+    if (opt->out_filename && is_pch_filename(opt->out_filename)) {
+        strcpy(outfile, opt->out_filename);
+    }
+    else if (len > 2 && len + 3 < sizeof(outfile) && !strcmp(header + len - 2, ".h")) {
+        /* foo.h -> foo.pch */
+        strcpy(outfile, header);
+        strcpy(outfile + len - 1, "pch");
+    }
+    else {
+        printf("acc: error: no output file for '%s'\n", header);
+        ret = 1;
+        goto finalize;
+    }
+
+    if (precompile_header(pp, header, outfile)) {
+        printf("acc: error: could not precompile '%s' into '%s'\n", header, outfile);
+        ret = 1;
+    }
+    else if (pp->error_count > 0) {
+        ret = 1;
+    }
+
+finalize:
+    if (print_pp_report(pp, opt))
+        ret = 1;
+
+    free_preprocessor(pp);
+    reset_arenas();
+
     return ret;
 }
+
+/* reports are kept apart from the text of -E on stdout */
+static int print_pp_report(const struct preprocessor *pp, const struct option *opt)
+{
+    FILE *fp = stderr;
+
+    if (!opt->print_pp_stats_json && !opt->print_pp_stats &&
+        !opt->print_include_tree)
+        return 0;
+
+    if (opt->pp_stats_filename) {
+        fp = fopen(opt->pp_stats_filename, "w");
+        if (!fp) {
+            fprintf(stderr, "acc: error: could not write report to '%s'\n",
+                    opt->pp_stats_filename);
+            return 1;
+        }
+    }
+
+    /* the json one has all the others */
+    if (opt->print_pp_stats_json)
+        print_preprocessor_stats_json(fp, pp);
+    else if (opt->print_pp_stats)
+        print_preprocessor_stats(fp, pp);
+    else
+        print_include_tree(fp, pp);
+
+    if (fp != stderr)
+        fclose(fp);
+    return 0;
+}
@@ -0,0 +1,16565 @@
+    .data
+
+_binary_operators_1971:
+    .long 170
+    .long 56
+    .long 1
+    .long 171
+    .long 57
+    .long 2
+    .long 124
+    .long 43
+    .long 3
+    .long 94
+    .long 44
+    .long 4
+    .long 38
+    .long 45
+    .long 5
+    .long 166
+    .long 51
+    .long 6
+    .long 167
+    .long 52
+    .long 6
+    .long 60
+    .long 47
+    .long 7
+    .long 62
+    .long 48
+    .long 7
+    .long 164
+    .long 49
+    .long 7
+    .long 165
+    .long 50
+    .long 7
+    .long 168
+    .long 41
+    .long 8
+    .long 169
+    .long 42
+    .long 8
+    .long 43
+    .long 36
+    .long 9
+    .long 45
+    .long 37
+    .long 9
+    .long 42
+    .long 38
+    .long 10
+    .long 47
+    .long 39
+    .long 10
+    .long 37
+    .long 40
+    .long 10
+
+    .text
+
+_L_str_1357:
+    .asciz "expected '%c'"
+
+_L_str_1560:
+    .asciz "expression is not a constant expression"
+
+_L_str_1756:
+    .asciz "type specifier missing, defaults to 'int'"
+
+_L_str_1836:
+    .asciz "expected expression"
+
+_L_str_2343:
+    .asciz "unknown type name '%s'"
+
+_L_str_2344:
+    .asciz "type name requires a specifier or qualifier"
+
+_L_str_2579:
+    .asciz "initializing wide char array with non-wide string literal"
+
+_L_str_2725:
+    .asciz "unmatched ')'"
+
+_L_str_2726:
+    .asciz "unmatched ']'"
+
+_L_str_2728:
+    .asciz "expected ')'"
+
+_L_str_2729:
+    .asciz "expected ']'"
+
+_L_str_2795:
+    .asciz "unexpected token"
+
+    .global _append
+_append:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $1, %eax
+    movl  %eax, 16(%rsp)
+    movl  $0, %eax
+    movq  %rax, 8(%rsp)
+    movl  $0, %eax
+    movq  %rax, (%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _new_ast_node
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movl  $1, %eax
+    cmpl  $0, %eax
+    je    _LBB1_3
+## if-then
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _set_node_l
+    addq  $16, %rsp
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    je    _LBB2_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _set_node_r
+    addq  $16, %rsp
+    jmp   _LBB2_2
+## if-else
+_LBB2_3:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+_LBB2_2:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB1_2
+## if-else
+_LBB1_3:
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _set_node_r
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _set_node_l
+    addq  $16, %rsp
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+_LBB1_2:
+_LBB0_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_new_node:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movl  %edi, -4(%rbp)
+    movq  %rsi, -16(%rbp)
+    movq  %rdx, -24(%rbp)
+## func body
+    subq  $32, %rsp
+    movl  -4(%rbp), %eax
+    movl  %eax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  24(%rsp), %edi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _new_ast_node
+    addq  $32, %rsp
+    jmp   _LBB3_0
+_LBB3_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_token_of:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  %rax, 8(%rsp)
+    movl  -12(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _token_at
+    addq  $16, %rsp
+    jmp   _LBB4_0
+_LBB4_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_read_token:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _read_next_token
+    addq  $16, %rsp
+_LBB5_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_release_read_tokens:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  %rax, 8(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $60, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _release_tokens
+    addq  $16, %rsp
+_LBB6_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_token_text:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _token_value_of
+    addq  $16, %rsp
+    addq  $8, %rax
+    movq  (%rax), %rax
+    jmp   _LBB7_0
+_LBB7_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_token_value:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _token_value_of
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    jmp   _LBB8_0
+_LBB8_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_gettok:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $60, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    addq  $20, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $1, %eax
+    movl  %eax, %edx
+    popq  %rax
+    subl  %edx, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB11_2
+    movq  -8(%rbp), %rax
+    addq  $60, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB12_2
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $60, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _token_of
+    addq  $16, %rsp
+    addq  $0, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $184, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB12_2
+    movl  $0, %eax
+_LBB12_2:
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB11_2
+    movl  $1, %eax
+_LBB11_2:
+    cmpl  $0, %eax
+    je    _LBB10_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _read_token
+    addq  $16, %rsp
+    jmp   _LBB10_2
+## if-else
+_LBB10_3:
+_LBB10_2:
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $60, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    addq  $20, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $1, %eax
+    movl  %eax, %edx
+    popq  %rax
+    subl  %edx, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB13_3
+## if-then
+    movq  -8(%rbp), %rax
+    addq  $60, %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB13_2
+## if-else
+_LBB13_3:
+_LBB13_2:
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $56, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $60, %rax
+    movl  (%rax), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB14_3
+## if-then
+## assign
+    movq  -8(%rbp), %rax
+    addq  $56, %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $60, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _type_name_or_identifier
+    addq  $16, %rsp
+    jmp   _LBB14_2
+## if-else
+_LBB14_3:
+_LBB14_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $60, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _token_of
+    addq  $16, %rsp
+    jmp   _LBB9_0
+_LBB9_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_current_token:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $60, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB16_3
+## if-then
+    movq  -8(%rbp), %rax
+    addq  $64, %rax
+    jmp   _LBB15_0
+    jmp   _LBB16_2
+## if-else
+_LBB16_3:
+_LBB16_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $60, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _token_of
+    addq  $16, %rsp
+    jmp   _LBB15_0
+_LBB15_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_ungettok:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $60, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setge %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB18_3
+## if-then
+    movq  -8(%rbp), %rax
+    addq  $60, %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    subl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB18_2
+## if-else
+_LBB18_3:
+_LBB18_2:
+_LBB17_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_tokpos:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _current_token
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -16(%rbp), %rax
+    addq  $4, %rax
+    jmp   _LBB19_0
+_LBB19_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_new_node_:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movl  %edi, -4(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  -4(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    movl  $0, %eax
+    movq  %rax, 8(%rsp)
+    movl  $0, %eax
+    movq  %rax, (%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _new_ast_node
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_pos
+    addq  $16, %rsp
+    pushq %rax
+    movq  -16(%rbp), %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    movq  -24(%rbp), %rax
+    jmp   _LBB20_0
+_LBB20_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_consume:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _gettok
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB22_3
+## if-then
+    movq  -24(%rbp), %rax
+    jmp   _LBB21_0
+    jmp   _LBB22_2
+## if-else
+_LBB22_3:
+_LBB22_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _ungettok
+    addq  $16, %rsp
+    movl  $0, %eax
+    jmp   _LBB21_0
+_LBB21_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_nexttok:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _gettok
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _ungettok
+    addq  $16, %rsp
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    jmp   _LBB23_0
+_LBB23_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_peektok:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _gettok
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _ungettok
+    addq  $16, %rsp
+    movl  -20(%rbp), %eax
+    jmp   _LBB24_0
+_LBB24_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_type_name_or_identifier:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $60, %rax
+    movl  (%rax), %eax
+    movl  %eax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movl  8(%rsp), %esi
+    callq _token_of
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $130, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB26_3
+## if-then
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    addq  $80, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _token_text
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _find_type_name_symbol
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -24(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB27_3
+## if-then
+## assign
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $161, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB27_2
+## if-else
+_LBB27_3:
+_LBB27_2:
+    jmp   _LBB26_2
+## if-else
+_LBB26_3:
+_LBB26_2:
+_LBB25_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_syntax_error:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $208, %rsp
+## func params
+    movq  %rdi, -48(%rbp)
+    movq  %rsi, -40(%rbp)
+    movq  %rdx, -32(%rbp)
+    movq  %rcx, -24(%rbp)
+    movq  %r8, -16(%rbp)
+    movq  %r9, -8(%rbp)
+## func body
+    leaq  -40(%rbp), %rax
+    subq  $8, %rsp
+    movq  %rax, (%rsp)
+    leaq  -72(%rbp), %rax
+    subq  $8, %rsp
+    movq  %rax, (%rsp)
+## __builtin_va_start
+    pop    %rax ## &va_list
+    pop    %rdx ## &last
+    leaq   -48(%rbp), %rdi ## gp_offset
+    subq   %rdi, %rdx      ## gp_offset
+    addq   $8, %rdx         ## gp_offset
+    movq   %rdx, (%rax)    ## gp_offset
+    movl   $48, 4(%rax)     ## fp_offset
+    leaq   16(%rbp), %rdi  ## overflow_arg_area
+    movq   %rdi, 8(%rax)   ## overflow_arg_area
+    leaq   -48(%rbp), %rdi ## reg_save_area
+    movq   %rdi, 16(%rax)  ## reg_save_area
+## end of __builtin_va_start
+## local scalar init
+    leaq  -200(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $1, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $2, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $3, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $5, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $6, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $7, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $9, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $10, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $11, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $12, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $13, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $14, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $15, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $17, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $18, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $19, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $20, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $21, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $22, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $23, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $25, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $26, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $27, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $28, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $29, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $30, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $31, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $33, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $34, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $35, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $36, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $37, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $38, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $39, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $40, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $41, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $42, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $43, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $44, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $45, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $46, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $47, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $48, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $49, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $50, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $51, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $52, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $53, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $54, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $55, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $56, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $57, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $58, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $59, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $60, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $61, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $62, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $63, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $64, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $65, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $66, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $67, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $68, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $69, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $70, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $71, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $72, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $73, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $74, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $75, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $76, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $77, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $78, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $79, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $80, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $81, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $82, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $83, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $84, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $85, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $86, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $87, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $88, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $89, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $90, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $91, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $92, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $93, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $94, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $95, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $96, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $97, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $98, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $99, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $100, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $101, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $102, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $103, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $104, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $105, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $106, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $107, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $108, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $109, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $110, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $111, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $112, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $113, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $114, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $115, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $116, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $117, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $118, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $119, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $120, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $121, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $122, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $123, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $124, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $125, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $126, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    addq  $127, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+    subq  $32, %rsp
+    leaq  -200(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -40(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    leaq  -72(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _vsprintf
+    addq  $32, %rsp
+## if-cond
+    movq  -48(%rbp), %rax
+    addq  $104, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB29_3
+## if-then
+## local scalar init
+    leaq  -208(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -48(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _current_token
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $32, %rsp
+    movq  -48(%rbp), %rax
+    addq  $88, %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    movq  -208(%rbp), %rax
+    addq  $4, %rax
+    movq  %rax, 16(%rsp)
+    leaq  -200(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _add_error
+    addq  $32, %rsp
+## assign
+    movq  -48(%rbp), %rax
+    addq  $104, %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB29_2
+## if-else
+_LBB29_3:
+_LBB29_2:
+_LBB28_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_expect:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _gettok
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $104, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    je    _LBB31_3
+## if-then
+    jmp   _LBB30_0
+    jmp   _LBB31_2
+## if-else
+_LBB31_3:
+_LBB31_2:
+## if-cond
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB32_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_1357(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movl  -12(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    movb  $0, %al
+    callq _syntax_error
+    addq  $32, %rsp
+    jmp   _LBB32_2
+## if-else
+_LBB32_3:
+_LBB32_2:
+_LBB30_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_expect_or_recover:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _gettok
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB34_3
+## if-then
+    jmp   _LBB33_0
+    jmp   _LBB34_2
+## if-else
+_LBB34_3:
+_LBB34_2:
+## for-pre
+## for-cond
+_LBB35_1:
+    movl  $1, %eax
+    cmpl  $0, %eax
+    je    _LBB35_2
+## for-body
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _gettok
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB37_2
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $184, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB37_2
+    movl  $0, %eax
+_LBB37_2:
+    cmpl  $0, %eax
+    je    _LBB36_3
+## if-then
+    jmp   _LBB35_2
+    jmp   _LBB36_2
+## if-else
+_LBB36_3:
+_LBB36_2:
+## for-post
+_LBB35_4:
+    jmp   _LBB35_1
+_LBB35_2:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $104, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB33_0
+_LBB33_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _new_parser
+_new_parser:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+## func body
+## local scalar init
+    leaq  -8(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $1, %eax
+    movslq %eax, %rax
+    movq  %rax, 16(%rsp)
+    movl  $144, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _calloc
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $64, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _init_token
+    addq  $16, %rsp
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    subq  $8, %rsp
+    callq _new_lexer
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _init_token_array
+    addq  $16, %rsp
+## assign
+    movq  -8(%rbp), %rax
+    addq  $56, %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $60, %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    movq  -8(%rbp), %rax
+    jmp   _LBB38_0
+_LBB38_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _free_parser
+_free_parser:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## if-cond
+    movq  -8(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB40_3
+## if-then
+    jmp   _LBB39_0
+    jmp   _LBB40_2
+## if-else
+_LBB40_3:
+_LBB40_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free_lexer
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+_LBB39_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_implicit_cast:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -32(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _is_identical
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB42_3
+## if-then
+    movq  -8(%rbp), %rax
+    jmp   _LBB41_0
+    jmp   _LBB42_2
+## if-else
+_LBB42_3:
+_LBB42_2:
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -32(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _is_compatible
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB43_3
+## if-then
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $30, %eax
+    movl  %eax, 16(%rsp)
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $0, %eax
+    movq  %rax, (%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _new_ast_node
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -40(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -40(%rbp), %rax
+    jmp   _LBB41_0
+    jmp   _LBB43_2
+## if-else
+_LBB43_3:
+_LBB43_2:
+    movq  -8(%rbp), %rax
+    jmp   _LBB41_0
+_LBB41_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_integer_promotion:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_enum
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB47_2
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_char
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB47_2
+    movl  $0, %eax
+_LBB47_2:
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB46_2
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_short
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB46_2
+    movl  $0, %eax
+_LBB46_2:
+    cmpl  $0, %eax
+    je    _LBB45_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    callq _type_int
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _implicit_cast
+    addq  $16, %rsp
+    jmp   _LBB44_0
+    jmp   _LBB45_2
+## if-else
+_LBB45_3:
+_LBB45_2:
+    movq  -8(%rbp), %rax
+    jmp   _LBB44_0
+_LBB44_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_arithmetic_conversion:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _node_l
+    addq  $8, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _node_r
+    addq  $8, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_fpnum
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB50_2
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_fpnum
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB50_2
+    movl  $0, %eax
+_LBB50_2:
+    cmpl  $0, %eax
+    je    _LBB49_3
+## if-then
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_double
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB51_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _implicit_cast
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _set_node_r
+    addq  $16, %rsp
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB51_2
+## if-else
+_LBB51_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_double
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB52_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _implicit_cast
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _set_node_l
+    addq  $16, %rsp
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB52_2
+## if-else
+_LBB52_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_float
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB53_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _implicit_cast
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _set_node_r
+    addq  $16, %rsp
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB53_2
+## if-else
+_LBB53_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_float
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB54_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _implicit_cast
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _set_node_l
+    addq  $16, %rsp
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB54_2
+## if-else
+_LBB54_3:
+_LBB54_2:
+_LBB53_2:
+_LBB52_2:
+_LBB51_2:
+    movq  -8(%rbp), %rax
+    jmp   _LBB48_0
+    jmp   _LBB49_2
+## if-else
+_LBB49_3:
+_LBB49_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _integer_promotion
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _set_node_l
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _integer_promotion
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _set_node_r
+    addq  $16, %rsp
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _node_l
+    addq  $8, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _node_r
+    addq  $8, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_pointer
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB55_3
+## if-then
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -8(%rbp), %rax
+    jmp   _LBB48_0
+    jmp   _LBB55_2
+## if-else
+_LBB55_3:
+_LBB55_2:
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_pointer
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB56_3
+## if-then
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -8(%rbp), %rax
+    jmp   _LBB48_0
+    jmp   _LBB56_2
+## if-else
+_LBB56_3:
+_LBB56_2:
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_array
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB57_3
+## if-then
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -8(%rbp), %rax
+    jmp   _LBB48_0
+    jmp   _LBB57_2
+## if-else
+_LBB57_3:
+_LBB57_2:
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_array
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB58_3
+## if-then
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -8(%rbp), %rax
+    jmp   _LBB48_0
+    jmp   _LBB58_2
+## if-else
+_LBB58_3:
+_LBB58_2:
+## local scalar init
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _integer_rank
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _integer_rank
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movl  -32(%rbp), %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB59_3
+## if-then
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB59_2
+## if-else
+_LBB59_3:
+## if-cond
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movl  -32(%rbp), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB60_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _implicit_cast
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _set_node_r
+    addq  $16, %rsp
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB60_2
+## if-else
+_LBB60_3:
+## if-cond
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movl  -32(%rbp), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB61_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _implicit_cast
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _set_node_l
+    addq  $16, %rsp
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB61_2
+## if-else
+_LBB61_3:
+_LBB61_2:
+_LBB60_2:
+_LBB59_2:
+    movq  -8(%rbp), %rax
+    jmp   _LBB48_0
+_LBB48_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_typed_:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## if-cond
+    movq  -8(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB63_3
+## if-then
+    movl  $0, %eax
+    jmp   _LBB62_0
+    jmp   _LBB63_2
+## if-else
+_LBB63_3:
+_LBB63_2:
+## switch-value
+    movq  -8(%rbp), %rax
+    addq  $28, %rax
+    movb  (%rax), %al
+    movzbl %al, %eax
+## begin jump table
+    cmpl  $18, %eax
+    je    _LBB64_1543
+    cmpl  $19, %eax
+    je    _LBB64_1544
+    cmpl  $20, %eax
+    je    _LBB64_1545
+    cmpl  $21, %eax
+    je    _LBB64_1546
+    cmpl  $22, %eax
+    je    _LBB64_1547
+    cmpl  $23, %eax
+    je    _LBB64_1548
+    cmpl  $24, %eax
+    je    _LBB64_1549
+    cmpl  $25, %eax
+    je    _LBB64_1550
+    cmpl  $26, %eax
+    je    _LBB64_1551
+    cmpl  $27, %eax
+    je    _LBB64_1552
+    cmpl  $28, %eax
+    je    _LBB64_1553
+    cmpl  $41, %eax
+    je    _LBB64_1554
+    cmpl  $42, %eax
+    je    _LBB64_1555
+    cmpl  $34, %eax
+    je    _LBB64_1556
+    cmpl  $31, %eax
+    je    _LBB64_1557
+    cmpl  $32, %eax
+    je    _LBB64_1558
+    cmpl  $29, %eax
+    je    _LBB64_1559
+    cmpl  $53, %eax
+    je    _LBB64_1560
+    cmpl  $70, %eax
+    je    _LBB64_1561
+    cmpl  $67, %eax
+    je    _LBB64_1562
+    cmpl  $64, %eax
+    je    _LBB64_1563
+    cmpl  $56, %eax
+    je    _LBB64_1564
+    cmpl  $57, %eax
+    je    _LBB64_1565
+    cmpl  $58, %eax
+    je    _LBB64_1566
+    cmpl  $51, %eax
+    je    _LBB64_1567
+    cmpl  $52, %eax
+    je    _LBB64_1568
+    cmpl  $47, %eax
+    je    _LBB64_1569
+    cmpl  $48, %eax
+    je    _LBB64_1570
+    cmpl  $49, %eax
+    je    _LBB64_1571
+    cmpl  $50, %eax
+    je    _LBB64_1572
+    cmpl  $1, %eax
+    je    _LBB64_1573
+    cmpl  $2, %eax
+    je    _LBB64_1574
+    cmpl  $65, %eax
+    je    _LBB64_1575
+    cmpl  $66, %eax
+    je    _LBB64_1576
+    cmpl  $36, %eax
+    je    _LBB64_1577
+    cmpl  $37, %eax
+    je    _LBB64_1584
+    cmpl  $38, %eax
+    je    _LBB64_1587
+    cmpl  $39, %eax
+    je    _LBB64_1588
+    cmpl  $40, %eax
+    je    _LBB64_1589
+    cmpl  $63, %eax
+    je    _LBB64_1590
+    cmpl  $59, %eax
+    je    _LBB64_1591
+    cmpl  $60, %eax
+    je    _LBB64_1592
+    cmpl  $61, %eax
+    je    _LBB64_1593
+    cmpl  $62, %eax
+    je    _LBB64_1594
+    cmpl  $54, %eax
+    je    _LBB64_1595
+    cmpl  $55, %eax
+    je    _LBB64_1596
+    cmpl  $43, %eax
+    je    _LBB64_1597
+    cmpl  $44, %eax
+    je    _LBB64_1598
+    cmpl  $45, %eax
+    je    _LBB64_1599
+    cmpl  $46, %eax
+    je    _LBB64_1600
+    cmpl  $68, %eax
+    je    _LBB64_1601
+    jmp   _LBB64_1602
+    jmp   _LBB64_2
+## end jump table
+_LBB64_1543:
+_LBB64_1544:
+_LBB64_1545:
+_LBB64_1546:
+_LBB64_1547:
+_LBB64_1548:
+_LBB64_1549:
+_LBB64_1550:
+_LBB64_1551:
+_LBB64_1552:
+_LBB64_1553:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _node_l
+    addq  $8, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB64_2
+_LBB64_1554:
+_LBB64_1555:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _node_l
+    addq  $8, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB64_2
+_LBB64_1556:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    subq  $8, %rsp
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _underlying
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _return_type
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB64_2
+_LBB64_1557:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    subq  $8, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _type_pointer
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB64_2
+_LBB64_1558:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    subq  $8, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _underlying
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB65_3
+## if-then
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _node_l
+    addq  $8, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB65_2
+## if-else
+_LBB65_3:
+_LBB65_2:
+    jmp   _LBB64_2
+_LBB64_1559:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _node_r
+    addq  $8, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB64_2
+_LBB64_1560:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _node_r
+    addq  $8, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB64_2
+_LBB64_1561:
+_LBB64_1562:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB64_2
+_LBB64_1563:
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_func
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB66_3
+## if-then
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _type_pointer
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB66_2
+## if-else
+_LBB66_3:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+_LBB66_2:
+    jmp   _LBB64_2
+_LBB64_1564:
+_LBB64_1565:
+_LBB64_1566:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    subq  $8, %rsp
+    callq _type_int
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB64_2
+_LBB64_1567:
+_LBB64_1568:
+_LBB64_1569:
+_LBB64_1570:
+_LBB64_1571:
+_LBB64_1572:
+## assign
+    leaq  -8(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _arithmetic_conversion
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    subq  $8, %rsp
+    callq _type_int
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB64_2
+_LBB64_1573:
+_LBB64_1574:
+    jmp   _LBB64_2
+_LBB64_1575:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+## cond-?
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _node_ival
+    addq  $8, %rsp
+    pushq %rax
+    movl  $32, %eax
+    movq  %rax, %rcx
+    popq  %rax
+    sarq  %cl, %rax
+    cmpq  $0, %rax
+    je    _LBB67_3
+## cond-then
+    subq  $8, %rsp
+    callq _type_long
+    addq  $8, %rsp
+    jmp   _LBB67_2
+## cond-else
+_LBB67_3:
+    subq  $8, %rsp
+    callq _type_int
+    addq  $8, %rsp
+_LBB67_2:
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB64_2
+_LBB64_1576:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    subq  $8, %rsp
+    callq _type_double
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB64_2
+_LBB64_1577:
+## if-cond
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_array
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB69_2
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_pointer
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB69_2
+    movl  $0, %eax
+_LBB69_2:
+    cmpl  $0, %eax
+    je    _LBB68_3
+## if-then
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    subq  $32, %rsp
+    movl  $65, %eax
+    movl  %eax, 24(%rsp)
+    movl  $0, %eax
+    movq  %rax, 16(%rsp)
+    movl  $0, %eax
+    movq  %rax, 8(%rsp)
+    movl  24(%rsp), %edi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _new_node
+    addq  $32, %rsp
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _typed_
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _underlying
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _get_size
+    addq  $16, %rsp
+    movslq %eax, %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _set_node_ival
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    subq  $32, %rsp
+    movl  $38, %eax
+    movl  %eax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movl  24(%rsp), %edi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _new_ast_node
+    addq  $32, %rsp
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _typed_
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _set_node_r
+    addq  $16, %rsp
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _node_l
+    addq  $8, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB64_2
+    jmp   _LBB68_2
+## if-else
+_LBB68_3:
+_LBB68_2:
+## if-cond
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_array
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB71_2
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_pointer
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB71_2
+    movl  $0, %eax
+_LBB71_2:
+    cmpl  $0, %eax
+    je    _LBB70_3
+## if-then
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    subq  $32, %rsp
+    movl  $65, %eax
+    movl  %eax, 24(%rsp)
+    movl  $0, %eax
+    movq  %rax, 16(%rsp)
+    movl  $0, %eax
+    movq  %rax, 8(%rsp)
+    movl  24(%rsp), %edi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _new_node
+    addq  $32, %rsp
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _typed_
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _underlying
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _get_size
+    addq  $16, %rsp
+    movslq %eax, %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _set_node_ival
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    subq  $32, %rsp
+    movl  $38, %eax
+    movl  %eax, 24(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movl  24(%rsp), %edi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _new_ast_node
+    addq  $32, %rsp
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _typed_
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _set_node_l
+    addq  $16, %rsp
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _node_r
+    addq  $8, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB64_2
+    jmp   _LBB70_2
+## if-else
+_LBB70_3:
+_LBB70_2:
+## assign
+    leaq  -8(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _arithmetic_conversion
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB64_2
+_LBB64_1584:
+## if-cond
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_pointer
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB73_2
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_pointer
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB73_2
+    movl  $1, %eax
+_LBB73_2:
+    cmpl  $0, %eax
+    je    _LBB72_3
+## if-then
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    subq  $8, %rsp
+    callq _type_long
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB64_2
+    jmp   _LBB72_2
+## if-else
+_LBB72_3:
+_LBB72_2:
+## assign
+    leaq  -8(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _arithmetic_conversion
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB64_2
+_LBB64_1587:
+_LBB64_1588:
+_LBB64_1589:
+## assign
+    leaq  -8(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _arithmetic_conversion
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB64_2
+_LBB64_1590:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    subq  $8, %rsp
+    callq _type_int
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB64_2
+_LBB64_1591:
+_LBB64_1592:
+_LBB64_1593:
+_LBB64_1594:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _node_l
+    addq  $8, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB64_2
+_LBB64_1595:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _node_r
+    addq  $8, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB64_2
+_LBB64_1596:
+## assign
+    leaq  -8(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _arithmetic_conversion
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB64_2
+_LBB64_1597:
+_LBB64_1598:
+_LBB64_1599:
+## assign
+    leaq  -8(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _arithmetic_conversion
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB64_2
+_LBB64_1600:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _integer_promotion
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _set_node_l
+    addq  $16, %rsp
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _node_l
+    addq  $8, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB64_2
+_LBB64_1601:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    subq  $8, %rsp
+    callq _type_int
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB64_2
+_LBB64_1602:
+    jmp   _LBB64_2
+_LBB64_2:
+    movq  -8(%rbp), %rax
+    jmp   _LBB62_0
+_LBB62_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_branch_:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movq  %rdx, -24(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _set_node_l
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _set_node_r
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _typed_
+    addq  $16, %rsp
+    jmp   _LBB74_0
+_LBB74_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_new_node_num:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $65, %eax
+    movl  %eax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _new_node_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _set_node_ival
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _typed_
+    addq  $16, %rsp
+    jmp   _LBB75_0
+_LBB75_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_new_node_fpnum:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movss %xmm0, -4(%rbp)
+    movq  %rdi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $66, %eax
+    movl  %eax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _new_node_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movss -4(%rbp), %xmm0
+    movss %xmm0, (%rsp)
+    movq  8(%rsp), %rdi
+    movss (%rsp), %xmm0
+    callq _set_node_fval
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _typed_
+    addq  $16, %rsp
+    jmp   _LBB76_0
+_LBB76_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_new_node_decl_ident:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $70, %eax
+    movl  %eax, 16(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $32, %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _new_node_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _typed_
+    addq  $16, %rsp
+    jmp   _LBB77_0
+_LBB77_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_eval_const_expr:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## if-cond
+    movq  -8(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB79_3
+## if-then
+    movl  $0, %eax
+    movslq %eax, %rax
+    jmp   _LBB78_0
+    jmp   _LBB79_2
+## if-else
+_LBB79_3:
+_LBB79_2:
+## switch-value
+    movq  -8(%rbp), %rax
+    addq  $28, %rax
+    movb  (%rax), %al
+    movzbl %al, %eax
+## begin jump table
+    cmpl  $36, %eax
+    je    _LBB80_1647
+    cmpl  $37, %eax
+    je    _LBB80_1648
+    cmpl  $38, %eax
+    je    _LBB80_1649
+    cmpl  $39, %eax
+    je    _LBB80_1650
+    cmpl  $40, %eax
+    je    _LBB80_1651
+    cmpl  $41, %eax
+    je    _LBB80_1652
+    cmpl  $42, %eax
+    je    _LBB80_1653
+    cmpl  $30, %eax
+    je    _LBB80_1654
+    cmpl  $63, %eax
+    je    _LBB80_1655
+    cmpl  $65, %eax
+    je    _LBB80_1656
+    cmpl  $70, %eax
+    je    _LBB80_1657
+    cmpl  $64, %eax
+    je    _LBB80_1658
+    jmp   _LBB80_1662
+    jmp   _LBB80_2
+## end jump table
+_LBB80_1647:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _eval_const_expr
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _eval_const_expr
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -24(%rbp), %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    jmp   _LBB78_0
+_LBB80_1648:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _eval_const_expr
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _eval_const_expr
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -24(%rbp), %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    jmp   _LBB78_0
+_LBB80_1649:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _eval_const_expr
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _eval_const_expr
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -24(%rbp), %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    jmp   _LBB78_0
+_LBB80_1650:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _eval_const_expr
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _eval_const_expr
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -24(%rbp), %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    movq  %rax, %rdi
+    popq  %rax
+    cqto
+    idivq %rdi
+    jmp   _LBB78_0
+_LBB80_1651:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _eval_const_expr
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _eval_const_expr
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -24(%rbp), %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    movq  %rax, %rdi
+    popq  %rax
+    cqto
+    idivq %rdi
+    movq  %rdx, %rax
+    jmp   _LBB78_0
+_LBB80_1652:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _eval_const_expr
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _eval_const_expr
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -24(%rbp), %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    movq  %rax, %rcx
+    popq  %rax
+    shlq  %cl, %rax
+    jmp   _LBB78_0
+_LBB80_1653:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _eval_const_expr
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _eval_const_expr
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -24(%rbp), %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    movq  %rax, %rcx
+    popq  %rax
+    sarq  %cl, %rax
+    jmp   _LBB78_0
+_LBB80_1654:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _eval_const_expr
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -24(%rbp), %rax
+    jmp   _LBB78_0
+_LBB80_1655:
+_LBB80_1656:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_ival
+    addq  $16, %rsp
+    jmp   _LBB78_0
+_LBB80_1657:
+_LBB80_1658:
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $13, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB81_3
+## if-then
+    subq  $32, %rsp
+    movq  -16(%rbp), %rax
+    addq  $88, %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_pos
+    addq  $16, %rsp
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_1560(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _add_error
+    addq  $32, %rsp
+    movl  $0, %eax
+    movslq %eax, %rax
+    jmp   _LBB78_0
+    jmp   _LBB81_2
+## if-else
+_LBB81_3:
+_LBB81_2:
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $28, %rax
+    movl  (%rax), %eax
+    movslq %eax, %rax
+    jmp   _LBB78_0
+_LBB80_1662:
+    subq  $32, %rsp
+    movq  -16(%rbp), %rax
+    addq  $88, %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_pos
+    addq  $16, %rsp
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_1560(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _add_error
+    addq  $32, %rsp
+    movl  $0, %eax
+    movslq %eax, %rax
+    jmp   _LBB78_0
+_LBB80_2:
+_LBB78_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_convert_:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## if-cond
+    movq  -16(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB83_3
+## if-then
+    movl  $0, %eax
+    jmp   _LBB82_0
+    jmp   _LBB83_2
+## if-else
+_LBB83_3:
+_LBB83_2:
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_array
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB87_2
+    movq  -8(%rbp), %rax
+    addq  $108, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB87_2
+    movl  $1, %eax
+_LBB87_2:
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB86_2
+    movq  -8(%rbp), %rax
+    addq  $112, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB86_2
+    movl  $1, %eax
+_LBB86_2:
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB85_2
+    movq  -8(%rbp), %rax
+    addq  $116, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB88_2
+    movq  -16(%rbp), %rax
+    addq  $28, %rax
+    movb  (%rax), %al
+    movzbl %al, %eax
+    pushq %rax
+    movl  $67, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB88_2
+    movl  $1, %eax
+_LBB88_2:
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB85_2
+    movl  $1, %eax
+_LBB85_2:
+    cmpl  $0, %eax
+    je    _LBB84_3
+## if-then
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $30, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _tokpos
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _new_node_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $0, %eax
+    movq  %rax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _branch_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    subq  $8, %rsp
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _underlying
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _type_pointer
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -24(%rbp), %rax
+    jmp   _LBB82_0
+    jmp   _LBB84_2
+## if-else
+_LBB84_3:
+_LBB84_2:
+    movq  -16(%rbp), %rax
+    jmp   _LBB82_0
+_LBB82_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_define_sym:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movq  %rdx, -24(%rbp)
+    movl  %ecx, -28(%rbp)
+    movq  %r8, -40(%rbp)
+## func body
+## assign
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    subq  $40, %rsp
+    movq  -8(%rbp), %rax
+    addq  $80, %rax
+    movq  (%rax), %rax
+    movq  %rax, 32(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  -28(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  32(%rsp), %rdi
+    movq  24(%rsp), %rsi
+    movl  16(%rsp), %edx
+    movq  8(%rsp), %rcx
+    callq _define_symbol
+    addq  $40, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -48(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    movq  -40(%rbp), %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    movq  -48(%rbp), %rax
+    jmp   _LBB89_0
+_LBB89_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_use_sym:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movl  %edx, -20(%rbp)
+## func body
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    addq  $80, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movl  (%rsp), %edx
+    callq _use_symbol
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -32(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_func
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB91_3
+## if-then
+## if-cond
+    movq  -32(%rbp), %rax
+    addq  $56, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    je    _LBB92_3
+## if-then
+## assign
+    movq  -32(%rbp), %rax
+    addq  $56, %rax
+    movq  (%rax), %rax
+    addq  $89, %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+    jmp   _LBB92_2
+## if-else
+_LBB92_3:
+_LBB92_2:
+## assign
+    movq  -32(%rbp), %rax
+    addq  $89, %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+    jmp   _LBB91_2
+## if-else
+_LBB91_3:
+_LBB91_2:
+    movq  -32(%rbp), %rax
+    jmp   _LBB90_0
+_LBB90_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_use_member_sym:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movq  %rdx, -24(%rbp)
+## func body
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _find_member
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -32(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB94_3
+## if-then
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $40, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 32(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    callq _type_int
+    movq  %rax, 16(%rsp)
+    movl  $12, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _tokpos
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  32(%rsp), %rdi
+    movq  24(%rsp), %rsi
+    movq  16(%rsp), %rdx
+    movl  8(%rsp), %ecx
+    movq  (%rsp), %r8
+    callq _define_sym
+    addq  $40, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -40(%rbp), %rax
+    addq  $82, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+    movq  -40(%rbp), %rax
+    jmp   _LBB93_0
+    jmp   _LBB94_2
+## if-else
+_LBB94_3:
+_LBB94_2:
+    movq  -32(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    jmp   _LBB93_0
+_LBB93_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_define_case:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+    movl  %edx, -16(%rbp)
+    movq  %rcx, -24(%rbp)
+## func body
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    addq  $80, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movl  -12(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -16(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movl  8(%rsp), %esi
+    movl  (%rsp), %edx
+    callq _define_case_symbol
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -32(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    movq  -32(%rbp), %rax
+    jmp   _LBB95_0
+_LBB95_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_define_label:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movq  %rdx, -24(%rbp)
+## func body
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    addq  $80, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _define_label_symbol
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -32(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    movq  -32(%rbp), %rax
+    jmp   _LBB96_0
+_LBB96_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_use_label:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $80, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _use_label_symbol
+    addq  $16, %rsp
+    jmp   _LBB97_0
+_LBB97_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_define_string:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $80, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _define_string_symbol
+    addq  $16, %rsp
+    jmp   _LBB98_0
+_LBB98_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_define_fpnum:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $80, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _define_fpnum_symbol
+    addq  $16, %rsp
+    jmp   _LBB99_0
+_LBB99_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_define_ellipsis:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $80, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _define_ellipsis_symbol
+    addq  $16, %rsp
+    jmp   _LBB100_0
+_LBB100_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_begin_scope:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $80, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _symbol_scope_begin
+    addq  $16, %rsp
+_LBB101_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_end_scope:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $80, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _symbol_scope_end
+    addq  $16, %rsp
+_LBB102_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_begin_switch:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $80, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _symbol_switch_begin
+    addq  $16, %rsp
+_LBB103_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_end_switch:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $80, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _symbol_switch_end
+    addq  $16, %rsp
+_LBB104_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_is_type_spec:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movl  %edi, -4(%rbp)
+## func body
+## switch-value
+    movl  -4(%rbp), %eax
+## begin jump table
+    cmpl  $152, %eax
+    je    _LBB106_1793
+    cmpl  $153, %eax
+    je    _LBB106_1794
+    cmpl  $154, %eax
+    je    _LBB106_1795
+    cmpl  $155, %eax
+    je    _LBB106_1796
+    cmpl  $156, %eax
+    je    _LBB106_1797
+    cmpl  $157, %eax
+    je    _LBB106_1798
+    cmpl  $158, %eax
+    je    _LBB106_1799
+    cmpl  $159, %eax
+    je    _LBB106_1800
+    cmpl  $160, %eax
+    je    _LBB106_1801
+    cmpl  $145, %eax
+    je    _LBB106_1802
+    cmpl  $146, %eax
+    je    _LBB106_1803
+    cmpl  $147, %eax
+    je    _LBB106_1804
+    cmpl  $161, %eax
+    je    _LBB106_1805
+    jmp   _LBB106_1806
+    jmp   _LBB106_2
+## end jump table
+_LBB106_1793:
+_LBB106_1794:
+_LBB106_1795:
+_LBB106_1796:
+_LBB106_1797:
+_LBB106_1798:
+_LBB106_1799:
+_LBB106_1800:
+_LBB106_1801:
+_LBB106_1802:
+_LBB106_1803:
+_LBB106_1804:
+_LBB106_1805:
+    movl  $1, %eax
+    jmp   _LBB105_0
+_LBB106_1806:
+    movl  $0, %eax
+    jmp   _LBB105_0
+_LBB106_2:
+_LBB105_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_is_storage_class_spec:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movl  %edi, -4(%rbp)
+## func body
+## switch-value
+    movl  -4(%rbp), %eax
+## begin jump table
+    cmpl  $150, %eax
+    je    _LBB108_1817
+    cmpl  $149, %eax
+    je    _LBB108_1818
+    cmpl  $148, %eax
+    je    _LBB108_1819
+    jmp   _LBB108_1820
+    jmp   _LBB108_2
+## end jump table
+_LBB108_1817:
+_LBB108_1818:
+_LBB108_1819:
+    movl  $1, %eax
+    jmp   _LBB107_0
+_LBB108_1820:
+    movl  $0, %eax
+    jmp   _LBB107_0
+_LBB108_2:
+_LBB107_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_is_type_qual:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movl  %edi, -4(%rbp)
+## func body
+## switch-value
+    movl  -4(%rbp), %eax
+## begin jump table
+    cmpl  $151, %eax
+    je    _LBB110_1831
+    jmp   _LBB110_1832
+    jmp   _LBB110_2
+## end jump table
+_LBB110_1831:
+    movl  $1, %eax
+    jmp   _LBB109_0
+_LBB110_1832:
+    movl  $0, %eax
+    jmp   _LBB109_0
+_LBB110_2:
+_LBB109_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_is_type_spec_qual:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movl  %edi, -4(%rbp)
+## func body
+    subq  $16, %rsp
+    movl  -4(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _is_type_spec
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB112_2
+    subq  $16, %rsp
+    movl  -4(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _is_type_qual
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB112_2
+    movl  $0, %eax
+_LBB112_2:
+    jmp   _LBB111_0
+_LBB111_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_is_start_of_decl:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movl  %edi, -4(%rbp)
+## func body
+    subq  $16, %rsp
+    movl  -4(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _is_type_spec_qual
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB114_2
+    subq  $16, %rsp
+    movl  -4(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _is_storage_class_spec
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB114_2
+    movl  $0, %eax
+_LBB114_2:
+    jmp   _LBB113_0
+_LBB113_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_default_to_int:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## if-cond
+    movq  -16(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB116_3
+## if-then
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _gettok
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    addq  $88, %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    movq  -24(%rbp), %rax
+    addq  $4, %rax
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_1756(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _add_warning
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _ungettok
+    addq  $16, %rsp
+    callq _type_int
+    jmp   _LBB115_0
+    jmp   _LBB116_2
+## if-else
+_LBB116_3:
+_LBB116_2:
+    movq  -16(%rbp), %rax
+    jmp   _LBB115_0
+_LBB115_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_identifier:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $130, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _consume
+    addq  $16, %rsp
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB118_3
+## if-then
+    movl  $0, %eax
+    jmp   _LBB117_0
+    jmp   _LBB118_2
+## if-else
+_LBB118_3:
+_LBB118_2:
+    subq  $16, %rsp
+    movl  $64, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _tokpos
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movl  8(%rsp), %edi
+    movq  (%rsp), %rsi
+    callq _new_node_
+    addq  $16, %rsp
+    jmp   _LBB117_0
+_LBB117_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_primary_expression:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _gettok
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## switch-value
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+## begin jump table
+    cmpl  $128, %eax
+    je    _LBB120_1930
+    cmpl  $129, %eax
+    je    _LBB120_1931
+    cmpl  $131, %eax
+    je    _LBB120_1932
+    cmpl  $130, %eax
+    je    _LBB120_1933
+    cmpl  $40, %eax
+    je    _LBB120_1934
+    jmp   _LBB120_1935
+    jmp   _LBB120_2
+## end jump table
+_LBB120_1930:
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _token_value
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _tokpos
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _new_node_num
+    addq  $16, %rsp
+    jmp   _LBB119_0
+_LBB120_1931:
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _token_text
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movl  $0, %eax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strtod
+    addq  $16, %rsp
+    cvtsd2ss %xmm0, %xmm0
+    movss %xmm0, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _tokpos
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movss 16(%rsp), %xmm0
+    movq  8(%rsp), %rdi
+    callq _new_node_fpnum
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _token_text
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _define_fpnum
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -16(%rbp), %rax
+    jmp   _LBB119_0
+_LBB120_1932:
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $67, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _tokpos
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _new_node_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _token_text
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _define_string
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _typed_
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _convert_
+    addq  $16, %rsp
+    jmp   _LBB119_0
+_LBB120_1933:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _ungettok
+    addq  $16, %rsp
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _identifier
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -28(%rbp), %rax
+    pushq %rax
+## cond-?
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  $40, %eax
+    movl  %eax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movl  8(%rsp), %esi
+    callq _nexttok
+    addq  $24, %rsp
+    cmpl  $0, %eax
+    je    _LBB121_3
+## cond-then
+    movl  $10, %eax
+    jmp   _LBB121_2
+## cond-else
+_LBB121_3:
+    movl  $9, %eax
+_LBB121_2:
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _token_text
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movl  -28(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movl  (%rsp), %edx
+    callq _use_sym
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _typed_
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _convert_
+    addq  $16, %rsp
+    jmp   _LBB119_0
+_LBB120_1934:
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _expression
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $41, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _expect
+    addq  $16, %rsp
+    movq  -16(%rbp), %rax
+    jmp   _LBB119_0
+_LBB120_1935:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1836(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _syntax_error
+    addq  $16, %rsp
+    movl  $0, %eax
+    jmp   _LBB119_0
+_LBB120_2:
+_LBB119_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_argument_expression:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _assignment_expression
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -32(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB123_3
+## if-then
+    movl  $0, %eax
+    jmp   _LBB122_0
+    jmp   _LBB123_2
+## if-else
+_LBB123_3:
+_LBB123_2:
+## if-cond
+    movq  -16(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB124_3
+## if-then
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_ellipsis
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB125_3
+## if-then
+## if-cond
+    subq  $16, %rsp
+    movq  -32(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_char
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB127_2
+    subq  $16, %rsp
+    movq  -32(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_short
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB127_2
+    movl  $0, %eax
+_LBB127_2:
+    cmpl  $0, %eax
+    je    _LBB126_3
+## if-then
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -32(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    callq _type_int
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _implicit_cast
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB126_2
+## if-else
+_LBB126_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -32(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_float
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB128_3
+## if-then
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -32(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    callq _type_double
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _implicit_cast
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB128_2
+## if-else
+_LBB128_3:
+_LBB128_2:
+_LBB126_2:
+    jmp   _LBB125_2
+## if-else
+_LBB125_3:
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -32(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _implicit_cast
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+_LBB125_2:
+    jmp   _LBB124_2
+## if-else
+_LBB124_3:
+_LBB124_2:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $35, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _tokpos
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _new_node_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $32, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -32(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  $0, %eax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _branch_
+    addq  $32, %rsp
+    jmp   _LBB122_0
+_LBB122_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_argument_expression_list:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _first_param
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    popq  %rax
+    movq  $0, %rdx
+    movq  %rdx, (%rax)
+## for-pre
+## for-cond
+_LBB130_1:
+    movl  $1, %eax
+    cmpl  $0, %eax
+    je    _LBB130_2
+## for-body
+## local scalar init
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _argument_expression
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _next_param
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -48(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB131_3
+## if-then
+    jmp   _LBB130_2
+    jmp   _LBB131_2
+## if-else
+_LBB131_3:
+_LBB131_2:
+    subq  $16, %rsp
+    leaq  -40(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -48(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _append
+    addq  $16, %rsp
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $44, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _consume
+    addq  $16, %rsp
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB132_3
+## if-then
+    jmp   _LBB130_2
+    jmp   _LBB132_2
+## if-else
+_LBB132_3:
+_LBB132_2:
+## for-post
+_LBB130_4:
+    jmp   _LBB130_1
+_LBB130_2:
+    leaq  -40(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    jmp   _LBB129_0
+_LBB129_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_struct_ref:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $29, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _tokpos
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _new_node_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _identifier
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _current_token
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _token_text
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _use_member_sym
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _typed_
+    addq  $16, %rsp
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -32(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _branch_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -32(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _convert_
+    addq  $16, %rsp
+    jmp   _LBB133_0
+_LBB133_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_postfix_expression:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $80, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _primary_expression
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-pre
+## for-cond
+_LBB135_1:
+    movl  $1, %eax
+    cmpl  $0, %eax
+    je    _LBB135_2
+## for-body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -64(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _gettok
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## switch-value
+    movq  -64(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+## begin jump table
+    cmpl  $46, %eax
+    je    _LBB136_1991
+    cmpl  $172, %eax
+    je    _LBB136_1992
+    cmpl  $40, %eax
+    je    _LBB136_1993
+    cmpl  $91, %eax
+    je    _LBB136_1997
+    cmpl  $162, %eax
+    je    _LBB136_1998
+    cmpl  $163, %eax
+    je    _LBB136_1999
+    jmp   _LBB136_2000
+    jmp   _LBB136_2
+## end jump table
+_LBB136_1991:
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _struct_ref
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB136_2
+_LBB136_1992:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $32, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _tokpos
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _new_node_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $0, %eax
+    movq  %rax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _branch_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _struct_ref
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB136_2
+_LBB136_1993:
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $34, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _tokpos
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _new_node_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $41, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _nexttok
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB137_3
+## if-then
+## local scalar init
+    leaq  -72(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _underlying
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -72(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _argument_expression_list
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -40(%rbp), %rax
+    movq  %rax, 8(%rsp)
+## cond-?
+    movq  -48(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB138_3
+## cond-then
+    subq  $16, %rsp
+    movq  -48(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_ival
+    addq  $16, %rsp
+    jmp   _LBB138_2
+## cond-else
+_LBB138_3:
+    movl  $0, %eax
+    movslq %eax, %rax
+_LBB138_2:
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _set_node_ival
+    addq  $16, %rsp
+    jmp   _LBB137_2
+## if-else
+_LBB137_3:
+_LBB137_2:
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -40(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -48(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _branch_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $41, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _expect
+    addq  $16, %rsp
+    jmp   _LBB136_2
+_LBB136_1997:
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $36, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _tokpos
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _new_node_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -32(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _expression
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _branch_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $93, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _expect
+    addq  $16, %rsp
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $32, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _tokpos
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _new_node_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $0, %eax
+    movq  %rax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _branch_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _convert_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB136_2
+_LBB136_1998:
+## assign
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $61, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _tokpos
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _new_node_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -56(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $0, %eax
+    movq  %rax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _branch_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB136_2
+_LBB136_1999:
+## assign
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $62, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _tokpos
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _new_node_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -56(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $0, %eax
+    movq  %rax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _branch_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB136_2
+_LBB136_2000:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _ungettok
+    addq  $16, %rsp
+    movq  -16(%rbp), %rax
+    jmp   _LBB134_0
+_LBB136_2:
+## for-post
+_LBB135_4:
+    jmp   _LBB135_1
+_LBB135_2:
+_LBB134_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_cast_expression:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $40, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _consume
+    addq  $16, %rsp
+    cmpq  $0, %rax
+    je    _LBB140_3
+## if-then
+## local scalar init
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _peektok
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movl  -12(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _is_type_spec_qual
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB141_3
+## if-then
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _type_name
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $41, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _expect
+    addq  $16, %rsp
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $30, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _tokpos
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _new_node_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _cast_expression
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _set_node_l
+    addq  $16, %rsp
+## assign
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -24(%rbp), %rax
+    jmp   _LBB139_0
+    jmp   _LBB141_2
+## if-else
+_LBB141_3:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _ungettok
+    addq  $16, %rsp
+_LBB141_2:
+    jmp   _LBB140_2
+## if-else
+_LBB140_3:
+_LBB140_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _unary_expression
+    addq  $16, %rsp
+    jmp   _LBB139_0
+_LBB139_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_unary_expression:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $64, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _gettok
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## switch-value
+    movq  -32(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+## begin jump table
+    cmpl  $43, %eax
+    je    _LBB143_2030
+    cmpl  $45, %eax
+    je    _LBB143_2031
+    cmpl  $42, %eax
+    je    _LBB143_2032
+    cmpl  $38, %eax
+    je    _LBB143_2033
+    cmpl  $33, %eax
+    je    _LBB143_2034
+    cmpl  $126, %eax
+    je    _LBB143_2035
+    cmpl  $162, %eax
+    je    _LBB143_2036
+    cmpl  $163, %eax
+    je    _LBB143_2037
+    cmpl  $144, %eax
+    je    _LBB143_2038
+    jmp   _LBB143_2048
+    jmp   _LBB143_2
+## end jump table
+_LBB143_2030:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _cast_expression
+    addq  $16, %rsp
+    jmp   _LBB142_0
+_LBB143_2031:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movq  %rax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _tokpos
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _new_node_num
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $38, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _tokpos
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _new_node_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $32, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _cast_expression
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _branch_
+    addq  $32, %rsp
+    jmp   _LBB142_0
+_LBB143_2032:
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $32, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _tokpos
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _new_node_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $32, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _cast_expression
+    addq  $16, %rsp
+    movq  %rax, 16(%rsp)
+    movl  $0, %eax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _branch_
+    addq  $32, %rsp
+    jmp   _LBB142_0
+_LBB143_2033:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $112, %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $31, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _tokpos
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _new_node_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _cast_expression
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movl  $0, %eax
+    movq  %rax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _branch_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $112, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    movq  -16(%rbp), %rax
+    jmp   _LBB142_0
+_LBB143_2034:
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $58, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _tokpos
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _new_node_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $32, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _cast_expression
+    addq  $16, %rsp
+    movq  %rax, 16(%rsp)
+    movl  $0, %eax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _branch_
+    addq  $32, %rsp
+    jmp   _LBB142_0
+_LBB143_2035:
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $46, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _tokpos
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _new_node_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $32, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _cast_expression
+    addq  $16, %rsp
+    movq  %rax, 16(%rsp)
+    movl  $0, %eax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _branch_
+    addq  $32, %rsp
+    jmp   _LBB142_0
+_LBB143_2036:
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $59, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _tokpos
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _new_node_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $32, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _unary_expression
+    addq  $16, %rsp
+    movq  %rax, 16(%rsp)
+    movl  $0, %eax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _branch_
+    addq  $32, %rsp
+    jmp   _LBB142_0
+_LBB143_2037:
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $60, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _tokpos
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _new_node_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $32, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _unary_expression
+    addq  $16, %rsp
+    movq  %rax, 16(%rsp)
+    movl  $0, %eax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _branch_
+    addq  $32, %rsp
+    jmp   _LBB142_0
+_LBB143_2038:
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $63, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _tokpos
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _new_node_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $40, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _consume
+    addq  $16, %rsp
+    cmpq  $0, %rax
+    je    _LBB144_3
+## if-then
+## local scalar init
+    leaq  -36(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _peektok
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movl  -36(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _is_type_spec_qual
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB145_3
+## if-then
+## local scalar init
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _type_name
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $69, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _tokpos
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _new_node_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -56(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -48(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $41, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _expect
+    addq  $16, %rsp
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -56(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $0, %eax
+    movq  %rax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _branch_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _get_size
+    addq  $16, %rsp
+    movslq %eax, %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _set_node_ival
+    addq  $16, %rsp
+    movq  -16(%rbp), %rax
+    jmp   _LBB142_0
+    jmp   _LBB145_2
+## if-else
+_LBB145_3:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _ungettok
+    addq  $16, %rsp
+_LBB145_2:
+    jmp   _LBB144_2
+## if-else
+_LBB144_3:
+_LBB144_2:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $108, %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _unary_expression
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movl  $0, %eax
+    movq  %rax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _branch_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+## cond-?
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB146_3
+## cond-then
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _get_size
+    addq  $16, %rsp
+    jmp   _LBB146_2
+## cond-else
+_LBB146_3:
+    movl  $0, %eax
+_LBB146_2:
+    movslq %eax, %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _set_node_ival
+    addq  $16, %rsp
+## assign
+    movq  -8(%rbp), %rax
+    addq  $108, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    movq  -16(%rbp), %rax
+    jmp   _LBB142_0
+_LBB143_2048:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _ungettok
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _postfix_expression
+    addq  $16, %rsp
+    jmp   _LBB142_0
+_LBB143_2:
+_LBB142_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_find_binary_operator:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movl  %edi, -4(%rbp)
+## func body
+## local scalar init
+    leaq  -8(%rbp), %rax
+    pushq %rax
+    movl  $216, %eax
+    pushq %rax
+    movl  $12, %eax
+    movl  %eax, %edi
+    popq  %rax
+    cltd
+    idivl %edi
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-pre
+## assign
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB148_1:
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  -8(%rbp), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB148_2
+## for-body
+## if-cond
+    leaq  _binary_operators_1971(%rip), %rax
+    pushq %rax
+    movl  $12, %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  -4(%rbp), %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB149_3
+## if-then
+    leaq  _binary_operators_1971(%rip), %rax
+    pushq %rax
+    movl  $12, %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    jmp   _LBB147_0
+    jmp   _LBB149_2
+## if-else
+_LBB149_3:
+_LBB149_2:
+## for-post
+_LBB148_4:
+    leaq  -12(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB148_1
+_LBB148_2:
+    movl  $0, %eax
+    jmp   _LBB147_0
+_LBB147_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_binary_expression:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _cast_expression
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-pre
+## for-cond
+_LBB151_1:
+    movl  $1, %eax
+    cmpl  $0, %eax
+    je    _LBB151_2
+## for-body
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _gettok
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -32(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  (%rsp), %edi
+    callq _find_binary_operator
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -40(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB153_2
+    movq  -40(%rbp), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB153_2
+    movl  $0, %eax
+_LBB153_2:
+    cmpl  $0, %eax
+    je    _LBB152_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _ungettok
+    addq  $16, %rsp
+    movq  -24(%rbp), %rax
+    jmp   _LBB150_0
+    jmp   _LBB152_2
+## if-else
+_LBB152_3:
+_LBB152_2:
+## assign
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -40(%rbp), %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _tokpos
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _new_node_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -48(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -40(%rbp), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _binary_expression
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _branch_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-post
+_LBB151_4:
+    jmp   _LBB151_1
+_LBB151_2:
+_LBB150_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_conditional_expression:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $64, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movl  8(%rsp), %esi
+    callq _binary_expression
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _gettok
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## switch-value
+    movq  -56(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+## begin jump table
+    cmpl  $63, %eax
+    je    _LBB155_2107
+    jmp   _LBB155_2108
+    jmp   _LBB155_2
+## end jump table
+_LBB155_2107:
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _expression
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $58, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _expect
+    addq  $16, %rsp
+## assign
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _conditional_expression
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $55, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _tokpos
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _new_node_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -40(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -48(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _branch_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $54, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _tokpos
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _new_node_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -32(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _branch_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB155_2
+_LBB155_2108:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _ungettok
+    addq  $16, %rsp
+    jmp   _LBB155_2
+_LBB155_2:
+    movq  -16(%rbp), %rax
+    jmp   _LBB154_0
+_LBB154_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_assign_:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+    movq  %rdx, -24(%rbp)
+## func body
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  -12(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _tokpos
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _new_node_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _assignment_expression
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -40(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _implicit_cast
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $32, %rsp
+    movq  -32(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -40(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _branch_
+    addq  $32, %rsp
+    jmp   _LBB156_0
+_LBB156_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_assignment_expression:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _conditional_expression
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _gettok
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## switch-value
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+## begin jump table
+    cmpl  $61, %eax
+    je    _LBB158_2135
+    cmpl  $173, %eax
+    je    _LBB158_2136
+    cmpl  $174, %eax
+    je    _LBB158_2137
+    cmpl  $175, %eax
+    je    _LBB158_2138
+    cmpl  $176, %eax
+    je    _LBB158_2139
+    cmpl  $177, %eax
+    je    _LBB158_2140
+    cmpl  $178, %eax
+    je    _LBB158_2141
+    cmpl  $179, %eax
+    je    _LBB158_2142
+    cmpl  $180, %eax
+    je    _LBB158_2143
+    cmpl  $181, %eax
+    je    _LBB158_2144
+    cmpl  $182, %eax
+    je    _LBB158_2145
+    jmp   _LBB158_2146
+    jmp   _LBB158_2
+## end jump table
+_LBB158_2135:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $18, %eax
+    movl  %eax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movq  8(%rsp), %rdx
+    callq _assign_
+    addq  $32, %rsp
+    jmp   _LBB157_0
+_LBB158_2136:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $19, %eax
+    movl  %eax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movq  8(%rsp), %rdx
+    callq _assign_
+    addq  $32, %rsp
+    jmp   _LBB157_0
+_LBB158_2137:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $20, %eax
+    movl  %eax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movq  8(%rsp), %rdx
+    callq _assign_
+    addq  $32, %rsp
+    jmp   _LBB157_0
+_LBB158_2138:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $21, %eax
+    movl  %eax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movq  8(%rsp), %rdx
+    callq _assign_
+    addq  $32, %rsp
+    jmp   _LBB157_0
+_LBB158_2139:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $22, %eax
+    movl  %eax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movq  8(%rsp), %rdx
+    callq _assign_
+    addq  $32, %rsp
+    jmp   _LBB157_0
+_LBB158_2140:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $23, %eax
+    movl  %eax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movq  8(%rsp), %rdx
+    callq _assign_
+    addq  $32, %rsp
+    jmp   _LBB157_0
+_LBB158_2141:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $24, %eax
+    movl  %eax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movq  8(%rsp), %rdx
+    callq _assign_
+    addq  $32, %rsp
+    jmp   _LBB157_0
+_LBB158_2142:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $25, %eax
+    movl  %eax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movq  8(%rsp), %rdx
+    callq _assign_
+    addq  $32, %rsp
+    jmp   _LBB157_0
+_LBB158_2143:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $26, %eax
+    movl  %eax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movq  8(%rsp), %rdx
+    callq _assign_
+    addq  $32, %rsp
+    jmp   _LBB157_0
+_LBB158_2144:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $27, %eax
+    movl  %eax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movq  8(%rsp), %rdx
+    callq _assign_
+    addq  $32, %rsp
+    jmp   _LBB157_0
+_LBB158_2145:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $28, %eax
+    movl  %eax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movq  8(%rsp), %rdx
+    callq _assign_
+    addq  $32, %rsp
+    jmp   _LBB157_0
+_LBB158_2146:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _ungettok
+    addq  $16, %rsp
+    movq  -16(%rbp), %rax
+    jmp   _LBB157_0
+_LBB158_2:
+_LBB157_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_expression:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _assignment_expression
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-pre
+## for-cond
+_LBB160_1:
+    movl  $1, %eax
+    cmpl  $0, %eax
+    je    _LBB160_2
+## for-body
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $44, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _consume
+    addq  $16, %rsp
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB161_3
+## if-then
+    movq  -16(%rbp), %rax
+    jmp   _LBB159_0
+    jmp   _LBB161_2
+## if-else
+_LBB161_3:
+_LBB161_2:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _assignment_expression
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -24(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB162_3
+## if-then
+    movq  -16(%rbp), %rax
+    jmp   _LBB159_0
+    jmp   _LBB162_2
+## if-else
+_LBB162_3:
+_LBB162_2:
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $53, %eax
+    movl  %eax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _new_node
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _typed_
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-post
+_LBB160_4:
+    jmp   _LBB160_1
+_LBB160_2:
+_LBB159_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_constant_expression:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _conditional_expression
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -24(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB164_3
+## if-then
+    movl  $0, %eax
+    jmp   _LBB163_0
+    jmp   _LBB164_2
+## if-else
+_LBB164_3:
+_LBB164_2:
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $68, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _tokpos
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _new_node_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $0, %eax
+    movq  %rax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _branch_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _eval_const_expr
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _set_node_ival
+    addq  $16, %rsp
+    movq  -16(%rbp), %rax
+    jmp   _LBB163_0
+_LBB163_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_compound_statement:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $123, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _expect
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _begin_scope
+    addq  $16, %rsp
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $2, %eax
+    movl  %eax, 16(%rsp)
+    movl  $0, %eax
+    movq  %rax, 8(%rsp)
+    movl  $0, %eax
+    movq  %rax, (%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _new_node
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _declaration_list
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _set_node_l
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _statement_list
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _set_node_r
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _end_scope
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $125, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _expect
+    addq  $16, %rsp
+    movq  -16(%rbp), %rax
+    jmp   _LBB165_0
+_LBB165_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_expression_statement:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $59, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _nexttok
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB167_3
+## if-then
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _expression
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB167_2
+## if-else
+_LBB167_3:
+_LBB167_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $59, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _expect
+    addq  $16, %rsp
+    movq  -16(%rbp), %rax
+    jmp   _LBB166_0
+_LBB166_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_for_statement:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $64, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -64(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $138, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _expect
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $40, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _expect
+    addq  $16, %rsp
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _expression_statement
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -24(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB169_3
+## if-then
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $0, %eax
+    movl  %eax, 16(%rsp)
+    movl  $0, %eax
+    movq  %rax, 8(%rsp)
+    movl  $0, %eax
+    movq  %rax, (%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _new_node
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB169_2
+## if-else
+_LBB169_3:
+_LBB169_2:
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _expression_statement
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -32(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB170_3
+## if-then
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $1, %eax
+    movslq %eax, %rax
+    movq  %rax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _tokpos
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _new_node_num
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB170_2
+## if-else
+_LBB170_3:
+_LBB170_2:
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $41, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _nexttok
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB171_3
+## if-then
+## assign
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _expression
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB171_2
+## if-else
+_LBB171_3:
+_LBB171_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $41, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _expect
+    addq  $16, %rsp
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _statement
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $14, %eax
+    movl  %eax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -32(%rbp), %rax
+    movq  %rax, (%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _new_node
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -64(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $15, %eax
+    movl  %eax, 16(%rsp)
+    movq  -40(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -48(%rbp), %rax
+    movq  %rax, (%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _new_node
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $13, %eax
+    movl  %eax, 16(%rsp)
+    movq  -56(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -64(%rbp), %rax
+    movq  %rax, (%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _new_node
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -16(%rbp), %rax
+    jmp   _LBB168_0
+_LBB168_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_while_statement:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $139, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _expect
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $40, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _expect
+    addq  $16, %rsp
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _expression
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $41, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _expect
+    addq  $16, %rsp
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _statement
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $16, %eax
+    movl  %eax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -32(%rbp), %rax
+    movq  %rax, (%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _new_node
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -16(%rbp), %rax
+    jmp   _LBB172_0
+_LBB172_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_dowhile_statement:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $137, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _expect
+    addq  $16, %rsp
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _statement
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $139, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _expect
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $40, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _expect
+    addq  $16, %rsp
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _expression
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $41, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _expect
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $59, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _expect
+    addq  $16, %rsp
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $17, %eax
+    movl  %eax, 16(%rsp)
+    movq  -32(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _new_node
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -16(%rbp), %rax
+    jmp   _LBB173_0
+_LBB173_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_break_statement:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $140, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _expect
+    addq  $16, %rsp
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $3, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _tokpos
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _new_node_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $59, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _expect
+    addq  $16, %rsp
+    movq  -16(%rbp), %rax
+    jmp   _LBB174_0
+_LBB174_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_continue_statement:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $141, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _expect
+    addq  $16, %rsp
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $4, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _tokpos
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _new_node_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $59, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _expect
+    addq  $16, %rsp
+    movq  -16(%rbp), %rax
+    jmp   _LBB175_0
+_LBB175_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_return_statement:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $142, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _expect
+    addq  $16, %rsp
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $5, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _tokpos
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _new_node_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $59, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _nexttok
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB177_3
+## if-then
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _expression
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $96, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _return_type
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _implicit_cast
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB177_2
+## if-else
+_LBB177_3:
+_LBB177_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $59, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _expect
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  $0, %eax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _branch_
+    addq  $32, %rsp
+    jmp   _LBB176_0
+_LBB176_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_goto_statement:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $143, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _expect
+    addq  $16, %rsp
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _identifier
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _current_token
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _token_text
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _use_label
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $59, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _expect
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movl  $6, %eax
+    movl  %eax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  $0, %eax
+    movq  %rax, 8(%rsp)
+    movl  24(%rsp), %edi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _new_node
+    addq  $32, %rsp
+    jmp   _LBB178_0
+_LBB178_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_if_statement:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $132, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _expect
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $40, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _expect
+    addq  $16, %rsp
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _expression
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $41, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _expect
+    addq  $16, %rsp
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _statement
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $133, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _consume
+    addq  $16, %rsp
+    cmpq  $0, %rax
+    je    _LBB180_3
+## if-then
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _statement
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB180_2
+## if-else
+_LBB180_3:
+_LBB180_2:
+## assign
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $8, %eax
+    movl  %eax, 16(%rsp)
+    movq  -32(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -40(%rbp), %rax
+    movq  %rax, (%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _new_node
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $7, %eax
+    movl  %eax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -48(%rbp), %rax
+    movq  %rax, (%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _new_node
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -16(%rbp), %rax
+    jmp   _LBB179_0
+_LBB179_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_switch_statement:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $134, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _expect
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $40, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _expect
+    addq  $16, %rsp
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _expression
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _integer_promotion
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $41, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _expect
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _begin_switch
+    addq  $16, %rsp
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _statement
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _end_switch
+    addq  $16, %rsp
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $9, %eax
+    movl  %eax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -32(%rbp), %rax
+    movq  %rax, (%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _new_node
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -16(%rbp), %rax
+    jmp   _LBB181_0
+_LBB181_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_case_statement:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $135, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _expect
+    addq  $16, %rsp
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _gettok
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    movq  -40(%rbp), %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _ungettok
+    addq  $16, %rsp
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _constant_expression
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $58, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _expect
+    addq  $16, %rsp
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $10, %eax
+    movl  %eax, 16(%rsp)
+    leaq  -28(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _new_node_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $0, %eax
+    movq  %rax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _branch_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    subq  $40, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 32(%rsp)
+    movl  $4, %eax
+    movl  %eax, 24(%rsp)
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_ival
+    addq  $16, %rsp
+    movl  %eax, 16(%rsp)
+    leaq  -28(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  32(%rsp), %rdi
+    movl  24(%rsp), %esi
+    movl  16(%rsp), %edx
+    movq  8(%rsp), %rcx
+    callq _define_case
+    addq  $40, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _statement
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _set_node_r
+    addq  $16, %rsp
+    movq  -16(%rbp), %rax
+    jmp   _LBB182_0
+_LBB182_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_default_statement:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $136, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _expect
+    addq  $16, %rsp
+## assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _tokpos
+    addq  $8, %rsp
+    movl  (%rax), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $58, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _expect
+    addq  $16, %rsp
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $11, %eax
+    movl  %eax, 16(%rsp)
+    leaq  -20(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _new_node_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  $0, %eax
+    movq  %rax, 8(%rsp)
+    movl  $0, %eax
+    movq  %rax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _branch_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    subq  $40, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 32(%rsp)
+    movl  $5, %eax
+    movl  %eax, 24(%rsp)
+    movl  -24(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    leaq  -20(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  32(%rsp), %rdi
+    movl  24(%rsp), %esi
+    movl  16(%rsp), %edx
+    movq  8(%rsp), %rcx
+    callq _define_case
+    addq  $40, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _statement
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _set_node_r
+    addq  $16, %rsp
+    movq  -16(%rbp), %rax
+    jmp   _LBB183_0
+_LBB183_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_labeled_statement:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    leaq  -28(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _decl_identifier
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $58, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _expect
+    addq  $16, %rsp
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -40(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  -28(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _define_label
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $12, %eax
+    movl  %eax, 16(%rsp)
+    movl  $0, %eax
+    movq  %rax, 8(%rsp)
+    movl  $0, %eax
+    movq  %rax, (%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _new_node
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _new_node_decl_ident
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _set_node_l
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _statement
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _set_node_r
+    addq  $16, %rsp
+    movq  -16(%rbp), %rax
+    jmp   _LBB184_0
+_LBB184_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_null_statement:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $59, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _expect
+    addq  $16, %rsp
+    movl  $0, %eax
+    jmp   _LBB185_0
+_LBB185_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_statement:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## switch-value
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _peektok
+    addq  $16, %rsp
+## begin jump table
+    cmpl  $138, %eax
+    je    _LBB187_2310
+    cmpl  $139, %eax
+    je    _LBB187_2311
+    cmpl  $137, %eax
+    je    _LBB187_2312
+    cmpl  $140, %eax
+    je    _LBB187_2313
+    cmpl  $141, %eax
+    je    _LBB187_2314
+    cmpl  $142, %eax
+    je    _LBB187_2315
+    cmpl  $143, %eax
+    je    _LBB187_2316
+    cmpl  $132, %eax
+    je    _LBB187_2317
+    cmpl  $134, %eax
+    je    _LBB187_2318
+    cmpl  $135, %eax
+    je    _LBB187_2319
+    cmpl  $136, %eax
+    je    _LBB187_2320
+    cmpl  $123, %eax
+    je    _LBB187_2321
+    cmpl  $59, %eax
+    je    _LBB187_2322
+    jmp   _LBB187_2323
+    jmp   _LBB187_2
+## end jump table
+_LBB187_2310:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _for_statement
+    addq  $16, %rsp
+    jmp   _LBB186_0
+_LBB187_2311:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _while_statement
+    addq  $16, %rsp
+    jmp   _LBB186_0
+_LBB187_2312:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _dowhile_statement
+    addq  $16, %rsp
+    jmp   _LBB186_0
+_LBB187_2313:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _break_statement
+    addq  $16, %rsp
+    jmp   _LBB186_0
+_LBB187_2314:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _continue_statement
+    addq  $16, %rsp
+    jmp   _LBB186_0
+_LBB187_2315:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _return_statement
+    addq  $16, %rsp
+    jmp   _LBB186_0
+_LBB187_2316:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _goto_statement
+    addq  $16, %rsp
+    jmp   _LBB186_0
+_LBB187_2317:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _if_statement
+    addq  $16, %rsp
+    jmp   _LBB186_0
+_LBB187_2318:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _switch_statement
+    addq  $16, %rsp
+    jmp   _LBB186_0
+_LBB187_2319:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _case_statement
+    addq  $16, %rsp
+    jmp   _LBB186_0
+_LBB187_2320:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _default_statement
+    addq  $16, %rsp
+    jmp   _LBB186_0
+_LBB187_2321:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _compound_statement
+    addq  $16, %rsp
+    jmp   _LBB186_0
+_LBB187_2322:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _null_statement
+    addq  $16, %rsp
+    jmp   _LBB186_0
+_LBB187_2323:
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $130, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _consume
+    addq  $16, %rsp
+    cmpq  $0, %rax
+    je    _LBB188_3
+## if-then
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $58, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _nexttok
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB189_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _ungettok
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _labeled_statement
+    addq  $16, %rsp
+    jmp   _LBB186_0
+    jmp   _LBB189_2
+## if-else
+_LBB189_3:
+_LBB189_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _ungettok
+    addq  $16, %rsp
+    jmp   _LBB188_2
+## if-else
+_LBB188_3:
+_LBB188_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _expression_statement
+    addq  $16, %rsp
+    jmp   _LBB186_0
+_LBB187_2:
+_LBB186_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_direct_abstract_declarator:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+    movq  -16(%rbp), %rax
+    jmp   _LBB190_0
+_LBB190_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_abstract_declarator:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _pointer
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _direct_abstract_declarator
+    addq  $16, %rsp
+    jmp   _LBB191_0
+_LBB191_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_type_qualifier:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _gettok
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## switch-value
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+## begin jump table
+    cmpl  $151, %eax
+    je    _LBB193_2355
+    jmp   _LBB193_2356
+    jmp   _LBB193_2
+## end jump table
+_LBB193_2355:
+    movl  $1, %eax
+    jmp   _LBB192_0
+_LBB193_2356:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _ungettok
+    addq  $16, %rsp
+    movl  $0, %eax
+    jmp   _LBB192_0
+_LBB193_2:
+_LBB192_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_specifier_qualifier_list:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-pre
+## for-cond
+_LBB195_1:
+    movl  $1, %eax
+    cmpl  $0, %eax
+    je    _LBB195_2
+## for-body
+## local scalar init
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _peektok
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movl  -28(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _is_type_qual
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB196_3
+## if-then
+## assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movl  8(%rsp), %esi
+    callq _type_qualifier
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB196_2
+## if-else
+_LBB196_3:
+## if-cond
+    subq  $16, %rsp
+    movl  -28(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _is_type_spec
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB197_3
+## if-then
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _type_specifier
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB197_2
+## if-else
+_LBB197_3:
+    jmp   _LBB195_2
+_LBB197_2:
+_LBB196_2:
+## for-post
+_LBB195_4:
+    jmp   _LBB195_1
+_LBB195_2:
+## if-cond
+    movl  -20(%rbp), %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB198_3
+## if-then
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _make_const
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB198_2
+## if-else
+_LBB198_3:
+_LBB198_2:
+## if-cond
+    movl  -24(%rbp), %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB199_3
+## if-then
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _make_unsigned
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB199_2
+## if-else
+_LBB199_3:
+_LBB199_2:
+    movq  -16(%rbp), %rax
+    jmp   _LBB194_0
+_LBB194_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_type_name:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _specifier_qualifier_list
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _abstract_declarator
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -16(%rbp), %rax
+    jmp   _LBB200_0
+_LBB200_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_decl_identifier:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $130, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _consume
+    addq  $16, %rsp
+    cmpq  $0, %rax
+    je    _LBB202_3
+## if-then
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _current_token
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -32(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _token_text
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB202_2
+## if-else
+_LBB202_3:
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _current_token
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+_LBB202_2:
+## assign
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    movq  -24(%rbp), %rax
+    jmp   _LBB201_0
+_LBB201_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_struct_declarator:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $58, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _nexttok
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB204_3
+## if-then
+## local scalar init
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    leaq  -28(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _decl_identifier
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $40, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 32(%rsp)
+    movq  -40(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  $12, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -28(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  32(%rsp), %rdi
+    movq  24(%rsp), %rsi
+    movq  16(%rsp), %rdx
+    movl  8(%rsp), %ecx
+    movq  (%rsp), %r8
+    callq _define_sym
+    addq  $40, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB204_2
+## if-else
+_LBB204_3:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $12, %eax
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movl  (%rsp), %edx
+    callq _declarator
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+_LBB204_2:
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $58, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _consume
+    addq  $16, %rsp
+    cmpq  $0, %rax
+    je    _LBB205_3
+## if-then
+## local scalar init
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _constant_expression
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -24(%rbp), %rax
+    addq  $90, %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## assign
+    movq  -24(%rbp), %rax
+    addq  $92, %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -48(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _node_ival
+    addq  $8, %rsp
+    popq  %rdx
+    movb  %al, (%rdx)
+    jmp   _LBB205_2
+## if-else
+_LBB205_3:
+_LBB205_2:
+    movq  -24(%rbp), %rax
+    jmp   _LBB203_0
+_LBB203_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_struct_declarator_list:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## do-while-body
+_LBB207_1:
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _struct_declarator
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -32(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _new_member
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _append_member
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## do-while-cond
+_LBB207_4:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $44, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _consume
+    addq  $16, %rsp
+    cmpq  $0, %rax
+    je    _LBB207_2
+    jmp   _LBB207_1
+_LBB207_2:
+    movq  -24(%rbp), %rax
+    jmp   _LBB206_0
+_LBB206_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_struct_declaration:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _specifier_qualifier_list
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _struct_declarator_list
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $59, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _expect
+    addq  $16, %rsp
+    movq  -16(%rbp), %rax
+    jmp   _LBB208_0
+_LBB208_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_struct_declaration_list:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-pre
+## for-cond
+_LBB210_1:
+    movl  $1, %eax
+    cmpl  $0, %eax
+    je    _LBB210_2
+## for-body
+## local scalar init
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _peektok
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movl  -20(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _is_type_spec_qual
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB211_3
+## if-then
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _struct_declaration
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -32(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _append_member
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB211_2
+## if-else
+_LBB211_3:
+## if-cond
+    movl  -20(%rbp), %eax
+    pushq %rax
+    movl  $125, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB213_2
+    movl  -20(%rbp), %eax
+    pushq %rax
+    movl  $184, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB213_2
+    movl  $0, %eax
+_LBB213_2:
+    cmpl  $0, %eax
+    je    _LBB212_3
+## if-then
+    jmp   _LBB210_2
+    jmp   _LBB212_2
+## if-else
+_LBB212_3:
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _gettok
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -40(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $130, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB214_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_2343(%rip), %rax
+    movq  %rax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -40(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _token_text
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _syntax_error
+    addq  $32, %rsp
+    jmp   _LBB214_2
+## if-else
+_LBB214_3:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2344(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _syntax_error
+    addq  $16, %rsp
+_LBB214_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _ungettok
+    addq  $16, %rsp
+    jmp   _LBB210_2
+_LBB212_2:
+_LBB211_2:
+## for-post
+_LBB210_4:
+    jmp   _LBB210_1
+_LBB210_2:
+    movq  -16(%rbp), %rax
+    jmp   _LBB209_0
+_LBB209_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_struct_or_union:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _gettok
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## switch-value
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+## begin jump table
+    cmpl  $145, %eax
+    je    _LBB216_2456
+    cmpl  $146, %eax
+    je    _LBB216_2457
+    jmp   _LBB216_2458
+    jmp   _LBB216_2
+## end jump table
+_LBB216_2456:
+    movl  $14, %eax
+    jmp   _LBB215_0
+_LBB216_2457:
+    movl  $15, %eax
+    jmp   _LBB215_0
+_LBB216_2458:
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    jmp   _LBB215_0
+_LBB216_2:
+_LBB215_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_type_struct_or_union:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movl  %edi, -4(%rbp)
+## func body
+## if-cond
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  $14, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB218_3
+## if-then
+    callq _type_struct
+    jmp   _LBB217_0
+    jmp   _LBB218_2
+## if-else
+_LBB218_3:
+    callq _type_union
+    jmp   _LBB217_0
+_LBB218_2:
+_LBB217_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_compute_struct_or_union_size:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+## func body
+## if-cond
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $14, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB220_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _compute_struct_size
+    addq  $16, %rsp
+    jmp   _LBB220_2
+## if-else
+_LBB220_3:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _compute_union_size
+    addq  $16, %rsp
+_LBB220_2:
+_LBB219_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_struct_or_union_specifier:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $64, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -44(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _struct_or_union
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    leaq  -28(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _decl_identifier
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $123, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _consume
+    addq  $16, %rsp
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB222_3
+## if-then
+## local scalar init
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -40(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -44(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movl  (%rsp), %edx
+    callq _use_sym
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -56(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    jmp   _LBB221_0
+    jmp   _LBB222_2
+## if-else
+_LBB222_3:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movl  -44(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  (%rsp), %edi
+    callq _type_struct_or_union
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -64(%rbp), %rax
+    pushq %rax
+    subq  $40, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 32(%rsp)
+    movq  -40(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  -44(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    leaq  -28(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  32(%rsp), %rdi
+    movq  24(%rsp), %rsi
+    movq  16(%rsp), %rdx
+    movl  8(%rsp), %ecx
+    movq  (%rsp), %r8
+    callq _define_sym
+    addq  $40, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -64(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+_LBB222_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _begin_scope
+    addq  $16, %rsp
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _struct_declaration_list
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _add_member_list
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _end_scope
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $125, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _expect
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -44(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _compute_struct_or_union_size
+    addq  $16, %rsp
+    movq  -24(%rbp), %rax
+    jmp   _LBB221_0
+_LBB221_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_enumerator:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $64, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -44(%rbp), %rax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $130, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _nexttok
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB224_3
+## if-then
+    movl  $0, %eax
+    jmp   _LBB223_0
+    jmp   _LBB224_2
+## if-else
+_LBB224_3:
+_LBB224_2:
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    leaq  -28(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _decl_identifier
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $40, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 32(%rsp)
+    movq  -40(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    callq _type_int
+    movq  %rax, 16(%rsp)
+    movl  $13, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -28(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  32(%rsp), %rdi
+    movq  24(%rsp), %rsi
+    movq  16(%rsp), %rdx
+    movl  8(%rsp), %ecx
+    movq  (%rsp), %r8
+    callq _define_sym
+    addq  $40, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $61, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _consume
+    addq  $16, %rsp
+    cmpq  $0, %rax
+    je    _LBB225_3
+## if-then
+## local scalar init
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _constant_expression
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -44(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -56(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _node_ival
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB225_2
+## if-else
+_LBB225_3:
+_LBB225_2:
+## assign
+    movq  -24(%rbp), %rax
+    addq  $28, %rax
+    pushq %rax
+    movl  -44(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    movl  -44(%rbp), %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    jmp   _LBB223_0
+_LBB223_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_enumerator_list:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## do-while-body
+_LBB227_1:
+## assign
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  -12(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movl  8(%rsp), %esi
+    callq _enumerator
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## do-while-cond
+_LBB227_4:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $44, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _consume
+    addq  $16, %rsp
+    cmpq  $0, %rax
+    je    _LBB227_2
+    jmp   _LBB227_1
+_LBB227_2:
+_LBB226_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_enum_specifier:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $147, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _expect
+    addq  $16, %rsp
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    leaq  -20(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _decl_identifier
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $123, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _consume
+    addq  $16, %rsp
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB229_3
+## if-then
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -32(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $16, %eax
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movl  (%rsp), %edx
+    callq _use_sym
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -40(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    jmp   _LBB228_0
+    jmp   _LBB229_2
+## if-else
+_LBB229_3:
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    callq _type_enum
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    subq  $40, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 32(%rsp)
+    movq  -32(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  $16, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -20(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  32(%rsp), %rdi
+    movq  24(%rsp), %rsi
+    movq  16(%rsp), %rdx
+    movl  8(%rsp), %ecx
+    movq  (%rsp), %r8
+    callq _define_sym
+    addq  $40, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+_LBB229_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _enumerator_list
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $125, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _expect
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _compute_enum_size
+    addq  $16, %rsp
+    movq  -16(%rbp), %rax
+    jmp   _LBB228_0
+_LBB228_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_type_specifier:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movq  %rdx, -24(%rbp)
+## func body
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _gettok
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## switch-value
+    movq  -32(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+## begin jump table
+    cmpl  $152, %eax
+    je    _LBB231_2540
+    cmpl  $153, %eax
+    je    _LBB231_2541
+    cmpl  $154, %eax
+    je    _LBB231_2542
+    cmpl  $155, %eax
+    je    _LBB231_2543
+    cmpl  $156, %eax
+    je    _LBB231_2544
+    cmpl  $157, %eax
+    je    _LBB231_2545
+    cmpl  $158, %eax
+    je    _LBB231_2546
+    cmpl  $159, %eax
+    je    _LBB231_2547
+    cmpl  $160, %eax
+    je    _LBB231_2548
+    cmpl  $145, %eax
+    je    _LBB231_2549
+    cmpl  $146, %eax
+    je    _LBB231_2550
+    cmpl  $147, %eax
+    je    _LBB231_2551
+    cmpl  $161, %eax
+    je    _LBB231_2552
+    jmp   _LBB231_2556
+    jmp   _LBB231_2
+## end jump table
+_LBB231_2540:
+    callq _type_void
+    jmp   _LBB230_0
+_LBB231_2541:
+    callq _type_char
+    jmp   _LBB230_0
+_LBB231_2542:
+    callq _type_short
+    jmp   _LBB230_0
+_LBB231_2543:
+    callq _type_int
+    jmp   _LBB230_0
+_LBB231_2544:
+    callq _type_long
+    jmp   _LBB230_0
+_LBB231_2545:
+    callq _type_float
+    jmp   _LBB230_0
+_LBB231_2546:
+    callq _type_double
+    jmp   _LBB230_0
+_LBB231_2547:
+## assign
+    movq  -24(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    movq  -16(%rbp), %rax
+    jmp   _LBB230_0
+_LBB231_2548:
+## assign
+    movq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    movq  -16(%rbp), %rax
+    jmp   _LBB230_0
+_LBB231_2549:
+_LBB231_2550:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _ungettok
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _struct_or_union_specifier
+    addq  $16, %rsp
+    jmp   _LBB230_0
+_LBB231_2551:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _ungettok
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _enum_specifier
+    addq  $16, %rsp
+    jmp   _LBB230_0
+_LBB231_2552:
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    addq  $80, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -32(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _token_text
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _find_type_name_symbol
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -40(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _type_type_name
+    addq  $16, %rsp
+    jmp   _LBB230_0
+_LBB231_2556:
+    movl  $0, %eax
+    jmp   _LBB230_0
+_LBB231_2:
+_LBB230_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_parameter_declaration:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    leaq  -28(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _declaration_specifiers
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_void
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB234_2
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $42, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _nexttok
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB234_2
+    movl  $1, %eax
+_LBB234_2:
+    cmpl  $0, %eax
+    je    _LBB233_3
+## if-then
+    movl  $0, %eax
+    jmp   _LBB232_0
+    jmp   _LBB233_2
+## if-else
+_LBB233_3:
+_LBB233_2:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $11, %eax
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movl  (%rsp), %edx
+    callq _declarator
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -24(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -24(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _convert_array_to_pointer
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -24(%rbp), %rax
+    jmp   _LBB232_0
+_LBB232_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_parameter_list:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-pre
+## for-cond
+_LBB236_1:
+    movl  $1, %eax
+    cmpl  $0, %eax
+    je    _LBB236_2
+## for-body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _parameter_declaration
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _new_parameter
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _append_parameter
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $44, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _consume
+    addq  $16, %rsp
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB237_3
+## if-then
+    jmp   _LBB236_2
+    jmp   _LBB237_2
+## if-else
+_LBB237_3:
+_LBB237_2:
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $183, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _nexttok
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB238_3
+## if-then
+    jmp   _LBB236_2
+    jmp   _LBB238_2
+## if-else
+_LBB238_3:
+_LBB238_2:
+## for-post
+_LBB236_4:
+    jmp   _LBB236_1
+_LBB236_2:
+    movq  -16(%rbp), %rax
+    jmp   _LBB235_0
+_LBB235_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_parameter_type_list:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _symbol_of
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _parameter_list
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $183, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _consume
+    addq  $16, %rsp
+    cmpq  $0, %rax
+    je    _LBB240_3
+## if-then
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _define_ellipsis
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -40(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _new_parameter
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _append_parameter
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -32(%rbp), %rax
+    addq  $87, %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+    jmp   _LBB240_2
+## if-else
+_LBB240_3:
+_LBB240_2:
+    movq  -24(%rbp), %rax
+    jmp   _LBB239_0
+_LBB239_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_array:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $91, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _consume
+    addq  $16, %rsp
+    cmpq  $0, %rax
+    je    _LBB242_3
+## if-then
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $93, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _nexttok
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB243_3
+## if-then
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _constant_expression
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB243_2
+## if-else
+_LBB243_3:
+_LBB243_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $93, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _expect
+    addq  $16, %rsp
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -32(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _array
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -32(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _type_array
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -24(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB244_3
+## if-then
+    subq  $16, %rsp
+    movq  -32(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_ival
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _set_array_length
+    addq  $16, %rsp
+    jmp   _LBB244_2
+## if-else
+_LBB244_3:
+_LBB244_2:
+    jmp   _LBB242_2
+## if-else
+_LBB242_3:
+_LBB242_2:
+    movq  -32(%rbp), %rax
+    jmp   _LBB241_0
+_LBB241_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_direct_declarator:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $80, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movl  %edx, -20(%rbp)
+## func body
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -44(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $40, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _consume
+    addq  $16, %rsp
+    cmpq  $0, %rax
+    je    _LBB246_3
+## if-then
+## local scalar init
+    leaq  -64(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    callq _type_placeholder
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movl  (%rsp), %edx
+    callq _declarator
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $41, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _expect
+    addq  $16, %rsp
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movq  -64(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB246_2
+## if-else
+_LBB246_3:
+_LBB246_2:
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $130, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _nexttok
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB247_3
+## if-then
+## assign
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    leaq  -44(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _decl_identifier
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB247_2
+## if-else
+_LBB247_3:
+_LBB247_2:
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $91, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _nexttok
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB248_3
+## if-then
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _array
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB248_2
+## if-else
+_LBB248_3:
+_LBB248_2:
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $40, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _consume
+    addq  $16, %rsp
+    cmpq  $0, %rax
+    je    _LBB249_3
+## if-then
+## local scalar init
+    leaq  -72(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -40(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB250_3
+## if-then
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _type_function
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $40, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 32(%rsp)
+    movq  -56(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  $10, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -44(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  32(%rsp), %rdi
+    movq  24(%rsp), %rsi
+    movq  16(%rsp), %rdx
+    movl  8(%rsp), %ecx
+    movq  (%rsp), %r8
+    callq _define_sym
+    addq  $40, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _begin_scope
+    addq  $16, %rsp
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $41, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _nexttok
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB251_3
+## if-then
+## assign
+    leaq  -72(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -40(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _parameter_type_list
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB251_2
+## if-else
+_LBB251_3:
+_LBB251_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $41, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _expect
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -72(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _add_parameter_list
+    addq  $16, %rsp
+    jmp   _LBB250_2
+## if-else
+_LBB250_3:
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _type_function
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -40(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _set_symbol
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _begin_scope
+    addq  $16, %rsp
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $41, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _nexttok
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB252_3
+## if-then
+## assign
+    leaq  -72(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -40(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _parameter_type_list
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB252_2
+## if-else
+_LBB252_3:
+_LBB252_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _end_scope
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $41, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _expect
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -72(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _add_parameter_list
+    addq  $16, %rsp
+_LBB250_2:
+    jmp   _LBB249_2
+## if-else
+_LBB249_3:
+## if-cond
+    movl  -20(%rbp), %eax
+    pushq %rax
+    movl  $9, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB253_3
+## if-then
+## if-cond
+    movq  -56(%rbp), %rax
+    cmpq  $0, %rax
+    movl  $0, %eax
+    je    _LBB255_2
+    movq  -40(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB255_2
+    movl  $1, %eax
+_LBB255_2:
+    cmpl  $0, %eax
+    je    _LBB254_3
+## if-then
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $40, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 32(%rsp)
+    movq  -56(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  $9, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -44(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  32(%rsp), %rdi
+    movq  24(%rsp), %rsi
+    movq  16(%rsp), %rdx
+    movl  8(%rsp), %ecx
+    movq  (%rsp), %r8
+    callq _define_sym
+    addq  $40, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB254_2
+## if-else
+_LBB254_3:
+_LBB254_2:
+    jmp   _LBB253_2
+## if-else
+_LBB253_3:
+## if-cond
+    movq  -40(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB256_3
+## if-then
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $40, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 32(%rsp)
+    movq  -56(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    leaq  -44(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  32(%rsp), %rdi
+    movq  24(%rsp), %rsi
+    movq  16(%rsp), %rdx
+    movl  8(%rsp), %ecx
+    movq  (%rsp), %r8
+    callq _define_sym
+    addq  $40, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB256_2
+## if-else
+_LBB256_3:
+_LBB256_2:
+_LBB253_2:
+_LBB249_2:
+## if-cond
+    movq  -32(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB257_3
+## if-then
+## assign
+    movq  -40(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -40(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _swap_placeholder
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB257_2
+## if-else
+_LBB257_3:
+_LBB257_2:
+    movq  -40(%rbp), %rax
+    jmp   _LBB245_0
+_LBB245_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_pointer:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## while-cond
+_LBB259_4:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $42, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _consume
+    addq  $16, %rsp
+    cmpq  $0, %rax
+    je    _LBB259_2
+## while-body
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _type_pointer
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB259_4
+_LBB259_2:
+    movq  -24(%rbp), %rax
+    jmp   _LBB258_0
+_LBB258_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_declarator:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movl  %edx, -20(%rbp)
+## func body
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -32(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _pointer
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -32(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _direct_declarator
+    addq  $32, %rsp
+    jmp   _LBB260_0
+_LBB260_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_initializer:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $116, %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _is_array
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $123, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _consume
+    addq  $16, %rsp
+    cmpq  $0, %rax
+    je    _LBB262_3
+## if-then
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _initializer_list
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $125, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _expect
+    addq  $16, %rsp
+    jmp   _LBB262_2
+## if-else
+_LBB262_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_array
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB264_2
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $131, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _nexttok
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB264_2
+    movl  $1, %eax
+_LBB264_2:
+    cmpl  $0, %eax
+    je    _LBB263_3
+## if-then
+## if-cond
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _underlying
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_char
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB265_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2579(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _syntax_error
+    addq  $16, %rsp
+    jmp   _LBB265_2
+## if-else
+_LBB265_3:
+_LBB265_2:
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _string_initializer
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB263_2
+## if-else
+_LBB263_3:
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _assignment_expression
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+_LBB263_2:
+_LBB262_2:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $116, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $72, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _tokpos
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _new_node_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    je    _LBB266_3
+## if-then
+## assign
+    movq  -40(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -40(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $24, %rax
+    movl  (%rax), %eax
+    movslq %eax, %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _set_node_ival
+    addq  $16, %rsp
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -32(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _implicit_cast
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB266_2
+## if-else
+_LBB266_3:
+_LBB266_2:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $71, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _tokpos
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _new_node_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -40(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _set_node_l
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -32(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _set_node_r
+    addq  $16, %rsp
+    movq  -24(%rbp), %rax
+    jmp   _LBB261_0
+_LBB261_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_root_initializer:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+## save address to returning value
+    pushq %rdi
+    movq  %rsi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    popq  %rax
+    movq  $0, %rdx
+    movq  %rdx, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    popq  %rax
+    movq  $0, %rdx
+    movq  %rdx, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $28, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $36, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## assign
+    leaq  -48(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    leaq  -48(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    movq  16(%rax), %r10
+    movq  %r10, 16(%rdx)
+    movq  24(%rax), %r10
+    movq  %r10, 24(%rdx)
+    movq  32(%rax), %r10
+    movq  %r10, 32(%rdx)
+    movq  %rdx, %rax
+    jmp   _LBB267_0
+_LBB267_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_child_initializer:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+## save address to returning value
+    pushq %rdi
+    movq  %rsi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    popq  %rax
+    movq  $0, %rdx
+    movq  %rdx, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    popq  %rax
+    movq  $0, %rdx
+    movq  %rdx, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $28, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $36, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## assign
+    leaq  -48(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _is_array
+    addq  $8, %rsp
+    cmpl  $0, %eax
+    je    _LBB269_3
+## if-then
+## assign
+    leaq  -48(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _underlying
+    addq  $16, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -48(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _get_array_length
+    addq  $16, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -48(%rbp), %rax
+    addq  $36, %rax
+    pushq %rax
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _has_unkown_array_length
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB269_2
+## if-else
+_LBB269_3:
+## if-cond
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _is_struct_or_union
+    addq  $8, %rsp
+    cmpl  $0, %eax
+    je    _LBB270_3
+## if-then
+## assign
+    leaq  -48(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _first_member
+    addq  $16, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -48(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    leaq  -48(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB270_2
+## if-else
+_LBB270_3:
+_LBB270_2:
+_LBB269_2:
+    leaq  -48(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    movq  16(%rax), %r10
+    movq  %r10, 16(%rdx)
+    movq  24(%rax), %r10
+    movq  %r10, 24(%rdx)
+    movq  32(%rax), %r10
+    movq  %r10, 32(%rdx)
+    movq  %rdx, %rax
+    jmp   _LBB268_0
+_LBB268_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_next_initializer:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_array
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB272_3
+## if-then
+    movq  -8(%rbp), %rax
+    addq  $28, %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $28, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $32, %rax
+    movl  (%rax), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB274_2
+    movq  -8(%rbp), %rax
+    addq  $36, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB274_2
+    movl  $0, %eax
+_LBB274_2:
+    cmpl  $0, %eax
+    je    _LBB273_3
+## if-then
+## assign
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _get_size
+    addq  $8, %rsp
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $28, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB273_2
+## if-else
+_LBB273_3:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+_LBB273_2:
+    jmp   _LBB272_2
+## if-else
+_LBB272_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_struct_or_union
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB275_3
+## if-then
+## assign
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _next_member
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    movl  $0, %eax
+    je    _LBB277_2
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_union
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB277_2
+    movl  $1, %eax
+_LBB277_2:
+    cmpl  $0, %eax
+    je    _LBB276_3
+## if-then
+## assign
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $28, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB276_2
+## if-else
+_LBB276_3:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+_LBB276_2:
+    jmp   _LBB275_2
+## if-else
+_LBB275_3:
+_LBB275_2:
+_LBB272_2:
+_LBB271_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_initializer_list:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $128, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    leaq  -128(%rbp), %rdi
+    movq  (%rsp), %rsi
+    callq _child_initializer
+    addq  $8, %rsp
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    movq  16(%rax), %r10
+    movq  %r10, 16(%rdx)
+    movq  24(%rax), %r10
+    movq  %r10, 24(%rdx)
+    movq  32(%rax), %r10
+    movq  %r10, 32(%rdx)
+## local scalar init
+    leaq  -64(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-pre
+## for-cond
+_LBB279_1:
+    movl  $1, %eax
+    cmpl  $0, %eax
+    je    _LBB279_2
+## for-body
+## local scalar init
+    leaq  -72(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -80(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -72(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    leaq  -56(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _initializer
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -72(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB280_3
+## if-then
+    jmp   _LBB279_2
+    jmp   _LBB280_2
+## if-else
+_LBB280_3:
+_LBB280_2:
+## assign
+    leaq  -80(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $1, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _tokpos
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _new_node_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -64(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -80(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -64(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -72(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _branch_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    leaq  -56(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _next_initializer
+    addq  $16, %rsp
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $44, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _consume
+    addq  $16, %rsp
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB281_3
+## if-then
+    jmp   _LBB279_2
+    jmp   _LBB281_2
+## if-else
+_LBB281_3:
+_LBB281_2:
+## for-post
+_LBB279_4:
+    jmp   _LBB279_1
+_LBB279_2:
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _has_unkown_array_length
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB282_3
+## if-then
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  -56(%rbp), %rax
+    addq  $28, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _set_array_length
+    addq  $16, %rsp
+    jmp   _LBB282_2
+## if-else
+_LBB282_3:
+_LBB282_2:
+    movq  -64(%rbp), %rax
+    jmp   _LBB278_0
+_LBB278_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_string_initializer:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $160, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    leaq  -160(%rbp), %rdi
+    movq  (%rsp), %rsi
+    callq _child_initializer
+    addq  $8, %rsp
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    movq  16(%rax), %r10
+    movq  %r10, 16(%rdx)
+    movq  24(%rax), %r10
+    movq  %r10, 24(%rdx)
+    movq  32(%rax), %r10
+    movq  %r10, 32(%rdx)
+## local scalar init
+    leaq  -64(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -72(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -80(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -88(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -96(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -104(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _gettok
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -112(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -104(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _token_text
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## do-while-body
+_LBB284_1:
+## assign
+    leaq  -88(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -112(%rbp), %rax
+    movb  (%rax), %al
+    movsbq %al, %rax
+    movq  %rax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _tokpos
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _new_node_num
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -80(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $72, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _tokpos
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _new_node_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -80(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  -56(%rbp), %rax
+    addq  $28, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    subq  $8, %rsp
+    leaq  -56(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _get_size
+    addq  $8, %rsp
+    popq  %rdx
+    imull %edx, %eax
+    movslq %eax, %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _set_node_ival
+    addq  $16, %rsp
+## assign
+    movq  -80(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    leaq  -56(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -72(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $71, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _tokpos
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _new_node_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -72(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -80(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _set_node_l
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -72(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -88(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _set_node_r
+    addq  $16, %rsp
+## assign
+    leaq  -64(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $1, %eax
+    movl  %eax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _tokpos
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _new_node_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -96(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -64(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -96(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -72(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _branch_
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    leaq  -56(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _next_initializer
+    addq  $16, %rsp
+## do-while-cond
+_LBB284_4:
+    leaq  -112(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    movb  (%rax), %al
+    cmpb  $0, %al
+    je    _LBB284_2
+    jmp   _LBB284_1
+_LBB284_2:
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _has_unkown_array_length
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB285_3
+## if-then
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  -56(%rbp), %rax
+    addq  $28, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _set_array_length
+    addq  $16, %rsp
+    jmp   _LBB285_2
+## if-else
+_LBB285_3:
+_LBB285_2:
+    movq  -96(%rbp), %rax
+    jmp   _LBB283_0
+_LBB283_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_init_declarator:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $144, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movl  %edx, -20(%rbp)
+## func body
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -36(%rbp), %rax
+    pushq %rax
+## cond-?
+    movl  -20(%rbp), %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB287_3
+## cond-then
+    movl  $17, %eax
+    jmp   _LBB287_2
+## cond-else
+_LBB287_3:
+    movl  $9, %eax
+_LBB287_2:
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movl  (%rsp), %edx
+    callq _declarator
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -48(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB288_3
+## if-then
+    movl  $0, %eax
+    jmp   _LBB286_0
+    jmp   _LBB288_2
+## if-else
+_LBB288_3:
+_LBB288_2:
+## assign
+    movq  -48(%rbp), %rax
+    addq  $80, %rax
+    pushq %rax
+    movl  -20(%rbp), %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## assign
+    movq  -48(%rbp), %rax
+    addq  $81, %rax
+    pushq %rax
+    movl  -20(%rbp), %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -48(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_func
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB291_2
+    subq  $16, %rsp
+    movq  -48(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_extern
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB291_2
+    movl  $1, %eax
+_LBB291_2:
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB290_2
+    subq  $16, %rsp
+    movq  -48(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_static
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB290_2
+    movl  $1, %eax
+_LBB290_2:
+    cmpl  $0, %eax
+    je    _LBB289_3
+## if-then
+## assign
+    movq  -48(%rbp), %rax
+    addq  $80, %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+    jmp   _LBB289_2
+## if-else
+_LBB289_3:
+_LBB289_2:
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -48(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _new_node_decl_ident
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $61, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _consume
+    addq  $16, %rsp
+    cmpq  $0, %rax
+    je    _LBB292_3
+## if-then
+## local scalar init
+    leaq  -88(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -48(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    leaq  -144(%rbp), %rdi
+    movq  (%rsp), %rsi
+    callq _root_initializer
+    addq  $8, %rsp
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    movq  16(%rax), %r10
+    movq  %r10, 16(%rdx)
+    movq  24(%rax), %r10
+    movq  %r10, 24(%rdx)
+    movq  32(%rax), %r10
+    movq  %r10, 32(%rdx)
+    subq  $16, %rsp
+    movq  -32(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  -88(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _initializer
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _set_node_l
+    addq  $16, %rsp
+    jmp   _LBB292_2
+## if-else
+_LBB292_3:
+_LBB292_2:
+    subq  $16, %rsp
+    movq  -32(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _typed_
+    addq  $16, %rsp
+    jmp   _LBB286_0
+_LBB286_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_init_declarator_list:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movl  %edx, -20(%rbp)
+## func body
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    popq  %rax
+    movq  $0, %rdx
+    movq  %rdx, (%rax)
+## for-pre
+## for-cond
+_LBB294_1:
+    movl  $1, %eax
+    cmpl  $0, %eax
+    je    _LBB294_2
+## for-body
+## local scalar init
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movl  (%rsp), %edx
+    callq _init_declarator
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -48(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB295_3
+## if-then
+    jmp   _LBB294_2
+    jmp   _LBB295_2
+## if-else
+_LBB295_3:
+_LBB295_2:
+    subq  $16, %rsp
+    leaq  -40(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -48(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _append
+    addq  $16, %rsp
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $44, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _consume
+    addq  $16, %rsp
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB296_3
+## if-then
+    jmp   _LBB294_2
+    jmp   _LBB296_2
+## if-else
+_LBB296_3:
+_LBB296_2:
+## for-post
+_LBB294_4:
+    jmp   _LBB294_1
+_LBB294_2:
+    leaq  -40(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    jmp   _LBB293_0
+_LBB293_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_storage_class_specifier:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _gettok
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB298_3
+## if-then
+    movl  $0, %eax
+    jmp   _LBB297_0
+    jmp   _LBB298_2
+## if-else
+_LBB298_3:
+_LBB298_2:
+## switch-value
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+## begin jump table
+    cmpl  $148, %eax
+    je    _LBB299_2787
+    cmpl  $149, %eax
+    je    _LBB299_2788
+    cmpl  $150, %eax
+    je    _LBB299_2789
+    jmp   _LBB299_2790
+    jmp   _LBB299_2
+## end jump table
+_LBB299_2787:
+    movl  $1, %eax
+    jmp   _LBB297_0
+_LBB299_2788:
+    movl  $2, %eax
+    jmp   _LBB297_0
+_LBB299_2789:
+    movl  $3, %eax
+    jmp   _LBB297_0
+_LBB299_2790:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _ungettok
+    addq  $16, %rsp
+    movl  $0, %eax
+    jmp   _LBB297_0
+_LBB299_2:
+_LBB297_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_declaration_specifiers:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-pre
+## for-cond
+_LBB301_1:
+    movl  $1, %eax
+    cmpl  $0, %eax
+    je    _LBB301_2
+## for-body
+## local scalar init
+    leaq  -44(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _peektok
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movl  -44(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _is_storage_class_spec
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB302_3
+## if-then
+## assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movl  8(%rsp), %esi
+    callq _storage_class_specifier
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB302_2
+## if-else
+_LBB302_3:
+## if-cond
+    subq  $16, %rsp
+    movl  -44(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _is_type_qual
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB303_3
+## if-then
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  -24(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movl  8(%rsp), %esi
+    callq _type_qualifier
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB303_2
+## if-else
+_LBB303_3:
+## if-cond
+    subq  $16, %rsp
+    movl  -44(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _is_type_spec
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB304_3
+## if-then
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -40(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  -28(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _type_specifier
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB304_2
+## if-else
+_LBB304_3:
+    jmp   _LBB301_2
+_LBB304_2:
+_LBB303_2:
+_LBB302_2:
+## for-post
+_LBB301_4:
+    jmp   _LBB301_1
+_LBB301_2:
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -40(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _default_to_int
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movl  -24(%rbp), %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB305_3
+## if-then
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -40(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _make_const
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB305_2
+## if-else
+_LBB305_3:
+_LBB305_2:
+## if-cond
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB306_3
+## if-then
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -40(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _make_unsigned
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB306_2
+## if-else
+_LBB306_3:
+_LBB306_2:
+## assign
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movl  -20(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    movq  -40(%rbp), %rax
+    jmp   _LBB300_0
+_LBB300_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_is_referenced:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $56, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    je    _LBB308_3
+## if-then
+    movq  -8(%rbp), %rax
+    addq  $56, %rax
+    movq  (%rax), %rax
+    addq  $89, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    jmp   _LBB307_0
+    jmp   _LBB308_2
+## if-else
+_LBB308_3:
+_LBB308_2:
+    movq  -8(%rbp), %rax
+    addq  $89, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    jmp   _LBB307_0
+_LBB307_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_skip_body:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $60, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-pre
+## for-cond
+_LBB310_1:
+    movl  $1, %eax
+    cmpl  $0, %eax
+    je    _LBB310_2
+## for-body
+## while-cond
+_LBB311_4:
+    movl  -20(%rbp), %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    addq  $20, %rax
+    movl  (%rax), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setge %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB311_2
+## while-body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _read_token
+    addq  $16, %rsp
+    jmp   _LBB311_4
+_LBB311_2:
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movl  8(%rsp), %esi
+    callq _token_of
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $184, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB312_3
+## if-then
+    movl  $0, %eax
+    jmp   _LBB309_0
+    jmp   _LBB312_2
+## if-else
+_LBB312_3:
+## if-cond
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $123, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB313_3
+## if-then
+    leaq  -24(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB313_2
+## if-else
+_LBB313_3:
+## if-cond
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $125, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB315_2
+    leaq  -24(%rbp), %rax
+    movl  (%rax), %edx
+    subl  $1, %edx
+    movl  %edx, (%rax)
+    movl  %edx, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB315_2
+    movl  $1, %eax
+_LBB315_2:
+    cmpl  $0, %eax
+    je    _LBB314_3
+## if-then
+    jmp   _LBB310_2
+    jmp   _LBB314_2
+## if-else
+_LBB314_3:
+## if-cond
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $40, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB316_3
+## if-then
+    leaq  -28(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB316_2
+## if-else
+_LBB316_3:
+## if-cond
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $91, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB317_3
+## if-then
+    leaq  -32(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB317_2
+## if-else
+_LBB317_3:
+## if-cond
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $41, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB319_2
+    leaq  -28(%rbp), %rax
+    movl  (%rax), %edx
+    subl  $1, %edx
+    movl  %edx, (%rax)
+    movl  %edx, %eax
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB319_2
+    movl  $1, %eax
+_LBB319_2:
+    cmpl  $0, %eax
+    je    _LBB318_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    addq  $88, %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $4, %rax
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_2725(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _add_error
+    addq  $32, %rsp
+    jmp   _LBB318_2
+## if-else
+_LBB318_3:
+## if-cond
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $93, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB321_2
+    leaq  -32(%rbp), %rax
+    movl  (%rax), %edx
+    subl  $1, %edx
+    movl  %edx, (%rax)
+    movl  %edx, %eax
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB321_2
+    movl  $1, %eax
+_LBB321_2:
+    cmpl  $0, %eax
+    je    _LBB320_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    addq  $88, %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $4, %rax
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_2726(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _add_error
+    addq  $32, %rsp
+    jmp   _LBB320_2
+## if-else
+_LBB320_3:
+_LBB320_2:
+_LBB318_2:
+_LBB317_2:
+_LBB316_2:
+_LBB314_2:
+_LBB313_2:
+_LBB312_2:
+## if-cond
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB322_3
+## if-then
+## assign
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB322_2
+## if-else
+_LBB322_3:
+_LBB322_2:
+## if-cond
+    movl  -32(%rbp), %eax
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB323_3
+## if-then
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB323_2
+## if-else
+_LBB323_3:
+_LBB323_2:
+    leaq  -20(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+## for-post
+_LBB310_4:
+    jmp   _LBB310_1
+_LBB310_2:
+## if-cond
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB324_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    addq  $88, %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $4, %rax
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_2728(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _add_error
+    addq  $32, %rsp
+    jmp   _LBB324_2
+## if-else
+_LBB324_3:
+_LBB324_2:
+## if-cond
+    movl  -32(%rbp), %eax
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB325_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    addq  $88, %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $4, %rax
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_2729(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _add_error
+    addq  $32, %rsp
+    jmp   _LBB325_2
+## if-else
+_LBB325_3:
+_LBB325_2:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $60, %rax
+    pushq %rax
+    movl  -20(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    movl  $1, %eax
+    jmp   _LBB309_0
+_LBB309_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_defer_body:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movl  %edx, -20(%rbp)
+## func body
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $120, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB330_2
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_static
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB330_2
+    movl  $0, %eax
+_LBB330_2:
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB329_2
+    movq  -16(%rbp), %rax
+    addq  $83, %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    movl  $1, %eax
+    jne   _LBB329_2
+    movl  $0, %eax
+_LBB329_2:
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB328_2
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_referenced
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB328_2
+    movl  $0, %eax
+_LBB328_2:
+    cmpl  $0, %eax
+    je    _LBB327_3
+## if-then
+    movl  $0, %eax
+    jmp   _LBB326_0
+    jmp   _LBB327_2
+## if-else
+_LBB327_3:
+_LBB327_2:
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _skip_body
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB331_3
+## if-then
+    movl  $0, %eax
+    jmp   _LBB326_0
+    jmp   _LBB331_2
+## if-else
+_LBB331_3:
+_LBB331_2:
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movl  $72, %eax
+    movslq %eax, %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _malloc
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -32(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -32(%rbp), %rax
+    addq  $8, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _init_token_array
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -32(%rbp), %rax
+    addq  $8, %rax
+    movq  %rax, 24(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  %rax, 16(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $60, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    callq _copy_token_range
+    addq  $32, %rsp
+## assign
+    movq  -32(%rbp), %rax
+    addq  $56, %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    addq  $80, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _symbol_mark
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -32(%rbp), %rax
+    addq  $60, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -32(%rbp), %rax
+    addq  $64, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $136, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    je    _LBB332_3
+## if-then
+## assign
+    movq  -8(%rbp), %rax
+    addq  $136, %rax
+    movq  (%rax), %rax
+    addq  $64, %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB332_2
+## if-else
+_LBB332_3:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $128, %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+_LBB332_2:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $136, %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -16(%rbp), %rax
+    addq  $82, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _end_scope
+    addq  $16, %rsp
+    movl  $1, %eax
+    jmp   _LBB326_0
+_LBB326_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_declaration:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $60, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    leaq  -32(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _declaration_specifiers
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -32(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movl  (%rsp), %edx
+    callq _init_declarator_list
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -16(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB334_3
+## if-then
+    jmp   _LBB334_2
+## if-else
+_LBB334_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $123, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _nexttok
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB336_2
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _symbol_of
+    addq  $16, %rsp
+    movq  %rax, 16(%rsp)
+    movl  -28(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _defer_body
+    addq  $32, %rsp
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB336_2
+    movl  $1, %eax
+_LBB336_2:
+    cmpl  $0, %eax
+    je    _LBB335_3
+## if-then
+    movq  -16(%rbp), %rax
+    jmp   _LBB333_0
+    jmp   _LBB335_2
+## if-else
+_LBB335_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $123, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _nexttok
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB337_3
+## if-then
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $96, %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _compound_statement
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $33, %eax
+    movl  %eax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -40(%rbp), %rax
+    movq  %rax, (%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _new_node
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _end_scope
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $96, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _compute_func_size
+    addq  $16, %rsp
+## assign
+    movq  -8(%rbp), %rax
+    addq  $96, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -16(%rbp), %rax
+    jmp   _LBB333_0
+    jmp   _LBB337_2
+## if-else
+_LBB337_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_function
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB338_3
+## if-then
+## local scalar init
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _symbol_of
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -48(%rbp), %rax
+    addq  $82, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## assign
+    movq  -48(%rbp), %rax
+    addq  $83, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _end_scope
+    addq  $16, %rsp
+    jmp   _LBB338_2
+## if-else
+_LBB338_3:
+_LBB338_2:
+_LBB337_2:
+_LBB335_2:
+_LBB334_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $59, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _expect_or_recover
+    addq  $16, %rsp
+    movq  -16(%rbp), %rax
+    jmp   _LBB333_0
+_LBB333_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_declaration_list:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-pre
+## for-cond
+_LBB340_1:
+    movl  $1, %eax
+    cmpl  $0, %eax
+    je    _LBB340_2
+## for-body
+## local scalar init
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _peektok
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movl  -20(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _is_start_of_decl
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB341_3
+## if-then
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _declaration
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $1, %eax
+    movl  %eax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -32(%rbp), %rax
+    movq  %rax, (%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _new_node
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB341_2
+## if-else
+_LBB341_3:
+    jmp   _LBB340_2
+_LBB341_2:
+## for-post
+_LBB340_4:
+    jmp   _LBB340_1
+_LBB340_2:
+    movq  -16(%rbp), %rax
+    jmp   _LBB339_0
+_LBB339_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_statement_list:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-pre
+## for-cond
+_LBB343_1:
+    movl  $1, %eax
+    cmpl  $0, %eax
+    je    _LBB343_2
+## for-body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _release_read_tokens
+    addq  $16, %rsp
+## assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _peektok
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  -20(%rbp), %eax
+    pushq %rax
+    movl  $125, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB345_2
+    movl  -20(%rbp), %eax
+    pushq %rax
+    movl  $184, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB345_2
+    movl  $0, %eax
+_LBB345_2:
+    cmpl  $0, %eax
+    je    _LBB344_3
+## if-then
+    movq  -16(%rbp), %rax
+    jmp   _LBB342_0
+    jmp   _LBB344_2
+## if-else
+_LBB344_3:
+_LBB344_2:
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $1, %eax
+    movl  %eax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _statement
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _new_node
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-post
+_LBB343_4:
+    jmp   _LBB343_1
+_LBB343_2:
+_LBB342_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_extern_decl:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _peektok
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movl  -12(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _is_start_of_decl
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB347_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _declaration
+    addq  $16, %rsp
+    jmp   _LBB346_0
+    jmp   _LBB347_2
+## if-else
+_LBB347_3:
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _gettok
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $130, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB348_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_2343(%rip), %rax
+    movq  %rax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _token_text
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _syntax_error
+    addq  $32, %rsp
+    jmp   _LBB348_2
+## if-else
+_LBB348_3:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2795(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _syntax_error
+    addq  $16, %rsp
+_LBB348_2:
+## for-pre
+## for-cond
+_LBB349_1:
+    movl  $1, %eax
+    cmpl  $0, %eax
+    je    _LBB349_2
+## for-body
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _gettok
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _is_start_of_decl
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB351_2
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $184, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB351_2
+    movl  $0, %eax
+_LBB351_2:
+    cmpl  $0, %eax
+    je    _LBB350_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _ungettok
+    addq  $16, %rsp
+## assign
+    movq  -8(%rbp), %rax
+    addq  $104, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB349_2
+    jmp   _LBB350_2
+## if-else
+_LBB350_3:
+_LBB350_2:
+## for-post
+_LBB349_4:
+    jmp   _LBB349_1
+_LBB349_2:
+    movl  $0, %eax
+    jmp   _LBB346_0
+_LBB347_2:
+_LBB346_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_parse_deferred_bodies:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $96, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -64(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    movq  16(%rax), %r10
+    movq  %r10, 16(%rdx)
+    movq  24(%rax), %r10
+    movq  %r10, 24(%rdx)
+    movq  32(%rax), %r10
+    movq  %r10, 32(%rdx)
+    movq  40(%rax), %r10
+    movq  %r10, 40(%rdx)
+## local scalar init
+    leaq  -68(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $60, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -72(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $56, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## do-while-body
+_LBB353_1:
+## assign
+    leaq  -76(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-pre
+## assign
+    leaq  -88(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $128, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB354_1:
+    movq  -88(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB354_2
+## for-body
+## if-cond
+    movq  -88(%rbp), %rax
+    addq  $60, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB356_2
+    subq  $16, %rsp
+    movq  -88(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_referenced
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB356_2
+    movl  $0, %eax
+_LBB356_2:
+    cmpl  $0, %eax
+    je    _LBB355_3
+## if-then
+    jmp   _LBB354_4
+    jmp   _LBB355_2
+## if-else
+_LBB355_3:
+_LBB355_2:
+## assign
+    movq  -88(%rbp), %rax
+    addq  $60, %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -76(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movq  -88(%rbp), %rax
+    addq  $8, %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    movq  16(%rax), %r10
+    movq  %r10, 16(%rdx)
+    movq  24(%rax), %r10
+    movq  %r10, 24(%rdx)
+    movq  32(%rax), %r10
+    movq  %r10, 32(%rdx)
+    movq  40(%rax), %r10
+    movq  %r10, 40(%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $60, %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $56, %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $80, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  -88(%rbp), %rax
+    addq  $56, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _hide_symbols_since
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _declaration
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _append
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $80, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _show_hidden_symbols
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _clear_token_array
+    addq  $16, %rsp
+## assign
+    movq  -88(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    movq  16(%rax), %r10
+    movq  %r10, 16(%rdx)
+    movq  24(%rax), %r10
+    movq  %r10, 24(%rdx)
+    movq  32(%rax), %r10
+    movq  %r10, 32(%rdx)
+    movq  40(%rax), %r10
+    movq  %r10, 40(%rdx)
+## for-post
+_LBB354_4:
+## assign
+    leaq  -88(%rbp), %rax
+    pushq %rax
+    movq  -88(%rbp), %rax
+    addq  $64, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB354_1
+_LBB354_2:
+## do-while-cond
+_LBB353_4:
+    movl  -76(%rbp), %eax
+    cmpl  $0, %eax
+    je    _LBB353_2
+    jmp   _LBB353_1
+_LBB353_2:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    leaq  -64(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    movq  16(%rax), %r10
+    movq  %r10, 16(%rdx)
+    movq  24(%rax), %r10
+    movq  %r10, 24(%rdx)
+    movq  32(%rax), %r10
+    movq  %r10, 32(%rdx)
+    movq  40(%rax), %r10
+    movq  %r10, 40(%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $60, %rax
+    pushq %rax
+    movl  -68(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $56, %rax
+    pushq %rax
+    movl  -72(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+_LBB352_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_free_deferred_bodies:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## for-pre
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $128, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB358_1:
+    movq  -16(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB358_2
+## for-body
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $64, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _clear_token_array
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+## for-post
+_LBB358_4:
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB358_1
+_LBB358_2:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $128, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $136, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+_LBB357_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_translation_unit:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -24(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    popq  %rax
+    movq  $0, %rdx
+    movq  %rdx, (%rax)
+## while-cond
+_LBB360_4:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $184, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _consume
+    addq  $16, %rsp
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB360_2
+## while-body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _release_read_tokens
+    addq  $16, %rsp
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _extern_decl
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -32(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB361_3
+## if-then
+    jmp   _LBB360_4
+    jmp   _LBB361_2
+## if-else
+_LBB361_3:
+_LBB361_2:
+    subq  $16, %rsp
+    leaq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -32(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _append
+    addq  $16, %rsp
+    jmp   _LBB360_4
+_LBB360_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _parse_deferred_bodies
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free_deferred_bodies
+    addq  $16, %rsp
+    leaq  -24(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    jmp   _LBB359_0
+_LBB359_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _parse_source
+_parse_source:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movq  %rdx, -24(%rbp)
+    movq  %rcx, -32(%rbp)
+## func body
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -16(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB363_3
+## if-then
+    movl  $0, %eax
+    jmp   _LBB362_0
+    jmp   _LBB363_2
+## if-else
+_LBB363_3:
+_LBB363_2:
+## if-cond
+    movq  -24(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB365_2
+    movq  -32(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB365_2
+    movl  $0, %eax
+_LBB365_2:
+    cmpl  $0, %eax
+    je    _LBB364_3
+## if-then
+    movl  $0, %eax
+    jmp   _LBB362_0
+    jmp   _LBB364_2
+## if-else
+_LBB364_3:
+_LBB364_2:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $80, %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $88, %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _set_source
+    addq  $16, %rsp
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _translation_unit
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _clear_token_array
+    addq  $16, %rsp
+    movq  -40(%rbp), %rax
+    jmp   _LBB362_0
+_LBB362_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
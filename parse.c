@@ -14,16 +14,16 @@ void append(struct ast_list *list, struct ast_node *node)
 
     if (1) {
         /* append to tail */
-        n->l = node;
+        set_node_l(n, node);
         if (list->head)
-            list->tail->r = n;
+            set_node_r(list->tail, n);
         else
             list->head = n;
         list->tail = n;
     } else {
         /* insert to head */
-        n->r = node;
-        n->l = list->head;
+        set_node_r(n, node);
+        set_node_l(n, list->head);
         list->head = n;
     }
 }
@@ -38,31 +38,63 @@ static struct ast_node *new_node(enum ast_node_kind kind,
 
 static void type_name_or_identifier(struct parser *p);
 
+static struct token *token_of(const struct parser *p, int index)
+{
+    return token_at(&p->tokens, index);
+}
+
+static void read_token(struct parser *p)
+{
+    read_next_token(p->lex, &p->tokens);
+}
+
+/* tokens before the current one are not looked at again. the block of the
+ * current one is kept for ungettok() */
+static void release_read_tokens(struct parser *p)
+{
+    release_tokens(&p->tokens, p->curr);
+}
+
+static const char *token_text(const struct parser *p, const struct token *tok)
+{
+    return token_value_of(&p->tokens, tok)->text;
+}
+
+static long token_value(const struct parser *p, const struct token *tok)
+{
+    return token_value_of(&p->tokens, tok)->value;
+}
+
 static const struct token *gettok(struct parser *p)
 {
-    const int N = TOKEN_BUFFER_SIZE;
+    /* stays at TOK_EOF */
+    if (p->curr == p->tokens.token_count - 1 &&
+        (p->curr < 0 || token_of(p, p->curr)->kind != TOK_EOF))
+        read_token(p);
 
-    if (p->head == p->curr) {
-        p->curr = (p->curr + 1) % N;
+    if (p->curr < p->tokens.token_count - 1)
+        p->curr++;
+
+    /* identifiers are classified when read first with the symbols so far */
+    if (p->head < p->curr) {
         p->head = p->curr;
-        get_next_token(p->lex, &p->tokbuf[p->curr]);
         type_name_or_identifier(p);
-    } else {
-        p->curr = (p->curr + 1) % N;
     }
 
-    return &p->tokbuf[p->curr];
+    return token_of(p, p->curr);
 }
 
 static const struct token *current_token(const struct parser *p)
 {
-    return &p->tokbuf[p->curr];
+    if (p->curr < 0)
+        return &p->bof;
+    return token_of(p, p->curr);
 }
 
 static void ungettok(struct parser *p)
 {
-    const int N = TOKEN_BUFFER_SIZE;
-    p->curr = (p->curr - 1 + N) % N;
+    if (p->curr >= 0)
+        p->curr--;
 }
 
 static const struct position *tokpos(const struct parser *p)
@@ -74,7 +106,7 @@ static const struct position *tokpos(const struct parser *p)
 static struct ast_node *new_node_(enum ast_node_kind kind, const struct position *pos)
 {
     struct ast_node *node = new_ast_node(kind, NULL, NULL);
-    node->pos = *pos;
+    *node_pos(node) = *pos;
     return node;
 }
 
@@ -109,10 +141,10 @@ static int peektok(struct parser *p)
 
 static void type_name_or_identifier(struct parser *p)
 {
-    struct token *tok = &p->tokbuf[p->curr];
+    struct token *tok = token_of(p, p->curr);
 
     if (tok->kind == TOK_IDENT) {
-        const struct symbol *sym = find_type_name_symbol(p->symtab, tok->text);
+        const struct symbol *sym = find_type_name_symbol(p->symtab, token_text(p, tok));
         if (sym)
             tok->kind = TOK_TYPE_NAME;
     }
@@ -166,14 +198,13 @@ static void expect_or_recover(struct parser *p, enum token_kind query)
 struct parser *new_parser(void)
 {
     struct parser *p = calloc(1, sizeof(struct parser));
-    int i;
 
-    for (i = 0; i < TOKEN_BUFFER_SIZE; i++)
-        init_token(&p->tokbuf[i]);
+    init_token(&p->bof);
 
     p->lex = new_lexer();
-    p->head = 0;
-    p->curr = 0;
+    init_token_array(&p->tokens);
+    p->head = -1;
+    p->curr = -1;
 
     return p;
 }
@@ -215,25 +246,25 @@ static struct ast_node *integer_promotion(struct ast_node *node)
 
 static struct ast_node *arithmetic_conversion(struct ast_node *node)
 {
-    struct data_type *t1 = node->l->type;
-    struct data_type *t2 = node->r->type;
+    struct data_type *t1 = node_l(node)->type;
+    struct data_type *t2 = node_r(node)->type;
 
     /* real floating */
     if (is_fpnum(t1) || is_fpnum(t2)) {
         if (is_double(t1)) {
-            node->r = implicit_cast(node->r, t1);
+            set_node_r(node, implicit_cast(node_r(node), t1));
             node->type = t1;
         }
         else if (is_double(t2)) {
-            node->l = implicit_cast(node->l, t2);
+            set_node_l(node, implicit_cast(node_l(node), t2));
             node->type = t2;
         }
         else if (is_float(t1)) {
-            node->r = implicit_cast(node->r, t1);
+            set_node_r(node, implicit_cast(node_r(node), t1));
             node->type = t1;
         }
         else if (is_float(t2)) {
-            node->l = implicit_cast(node->l, t2);
+            set_node_l(node, implicit_cast(node_l(node), t2));
             node->type = t2;
         }
 
@@ -241,12 +272,12 @@ static struct ast_node *arithmetic_conversion(struct ast_node *node)
     }
 
     /* 6.3.1.8 the integer promotions are performed on both operands. */
-    node->l = integer_promotion(node->l);
-    node->r = integer_promotion(node->r);
+    set_node_l(node, integer_promotion(node_l(node)));
+    set_node_r(node, integer_promotion(node_r(node)));
 
     /* pointer */
-    t1 = node->l->type;
-    t2 = node->r->type;
+    t1 = node_l(node)->type;
+    t2 = node_r(node)->type;
 
     if (is_pointer(t1)) {
         node->type = t1;
@@ -276,11 +307,11 @@ static struct ast_node *arithmetic_conversion(struct ast_node *node)
             node->type = t1;
         }
         else if (r1 > r2) {
-            node->r = implicit_cast(node->r, t1);
+            set_node_r(node, implicit_cast(node_r(node), t1));
             node->type = t1;
         }
         else if (r1 < r2) {
-            node->l = implicit_cast(node->l, t2);
+            set_node_l(node, implicit_cast(node_l(node), t2));
             node->type = t2;
         }
 
@@ -306,34 +337,34 @@ static struct ast_node *typed_(struct ast_node *node)
     case NOD_OR_ASSIGN:
     case NOD_XOR_ASSIGN:
     case NOD_AND_ASSIGN:
-        node->type = node->l->type;
+        node->type = node_l(node)->type;
         break;
 
     case NOD_SHL:
     case NOD_SHR:
-        node->type = node->l->type;
+        node->type = node_l(node)->type;
         break;
 
     case NOD_CALL:
-        node->type = return_type(underlying(node->l->type));
+        node->type = return_type(underlying(node_l(node)->type));
         break;
 
     case NOD_ADDR:
-        node->type = type_pointer(node->l->type);
+        node->type = type_pointer(node_l(node)->type);
         break;
 
     case NOD_DEREF:
-        node->type = underlying(node->l->type);
+        node->type = underlying(node_l(node)->type);
         if (!node->type)
-            node->type = node->l->type;
+            node->type = node_l(node)->type;
         break;
 
     case NOD_STRUCT_REF:
-        node->type = node->r->type;
+        node->type = node_r(node)->type;
         break;
 
     case NOD_COMMA:
-        node->type = node->r->type;
+        node->type = node_r(node)->type;
         break;
 
     /* nodes with symbol */
@@ -377,7 +408,7 @@ static struct ast_node *typed_(struct ast_node *node)
     /* nodes with literal */
     case NOD_NUM:
         /* TODO improve long/int decision */
-        node->type = node->ival >> 32 ? type_long() : type_int();
+        node->type = node_ival(node) >> 32 ? type_long() : type_int();
         break;
 
     case NOD_FPNUM:
@@ -386,22 +417,22 @@ static struct ast_node *typed_(struct ast_node *node)
 
     case NOD_ADD:
         /* pionter arithmetic */
-        if (is_array(node->l->type) || is_pointer(node->l->type)) {
+        if (is_array(node_l(node)->type) || is_pointer(node_l(node)->type)) {
             /* pointer + x */
             struct ast_node *num = typed_(NEW_(NOD_NUM));
-            num->ival = get_size(underlying(node->l->type));
-            node->r = typed_(new_ast_node(NOD_MUL, num, node->r));
+            set_node_ival(num, get_size(underlying(node_l(node)->type)));
+            set_node_r(node, typed_(new_ast_node(NOD_MUL, num, node_r(node))));
 
-            node->type = node->l->type;
+            node->type = node_l(node)->type;
             break;
         }
-        if (is_array(node->r->type) || is_pointer(node->r->type)) {
+        if (is_array(node_r(node)->type) || is_pointer(node_r(node)->type)) {
             /* x + pointer */
             struct ast_node *num = typed_(NEW_(NOD_NUM));
-            num->ival = get_size(underlying(node->r->type));
-            node->l = typed_(new_ast_node(NOD_MUL, num, node->l));
+            set_node_ival(num, get_size(underlying(node_r(node)->type)));
+            set_node_l(node, typed_(new_ast_node(NOD_MUL, num, node_l(node))));
 
-            node->type = node->r->type;
+            node->type = node_r(node)->type;
             break;
         }
         node = arithmetic_conversion(node);
@@ -409,7 +440,7 @@ static struct ast_node *typed_(struct ast_node *node)
 
     case NOD_SUB:
         /* pionter arithmetic */
-        if (is_pointer(node->l->type) && is_pointer(node->r->type)) {
+        if (is_pointer(node_l(node)->type) && is_pointer(node_r(node)->type)) {
             node->type = type_long();
             break;
         }
@@ -430,13 +461,13 @@ static struct ast_node *typed_(struct ast_node *node)
     case NOD_PREDEC:
     case NOD_POSTINC:
     case NOD_POSTDEC:
-        node->type = node->l->type;
+        node->type = node_l(node)->type;
         break;
 
     /* 6.5.15 Conditional operator. The result is the value of
      * the second or third operand */
     case NOD_COND:
-        node->type = node->r->type;
+        node->type = node_r(node)->type;
         break;
 
     case NOD_COND_THEN:
@@ -454,8 +485,8 @@ static struct ast_node *typed_(struct ast_node *node)
     /* 6.5.3.3 Unary arithmetic operators. The integer promotions
      * are performed on the operand, and the result has the promoted type. */
     case NOD_NOT:
-        node->l = integer_promotion(node->l);
-        node->type = node->l->type;
+        set_node_l(node, integer_promotion(node_l(node)));
+        node->type = node_l(node)->type;
         break;
 
     case NOD_CONST_EXPR:
@@ -472,22 +503,22 @@ static struct ast_node *typed_(struct ast_node *node)
 static struct ast_node *branch_(struct ast_node *node,
         struct ast_node *l, struct ast_node *r)
 {
-    node->l = l;
-    node->r = r;
+    set_node_l(node, l);
+    set_node_r(node, r);
     return typed_(node);
 }
 
 static struct ast_node *new_node_num(long num, const struct position *pos)
 {
     struct ast_node *node = new_node_(NOD_NUM, pos);
-    node->ival = num;
+    set_node_ival(node, num);
     return typed_(node);
 }
 
 static struct ast_node *new_node_fpnum(float num, const struct position *pos)
 {
     struct ast_node *node = new_node_(NOD_FPNUM, pos);
-    node->fval = num;
+    set_node_fval(node, num);
     return typed_(node);
 }
 
@@ -508,58 +539,58 @@ static long eval_const_expr(const struct ast_node *node, struct parser *p)
     switch (node->kind) {
 
     case NOD_ADD:
-        l = eval_const_expr(node->l, p);
-        r = eval_const_expr(node->r, p);
+        l = eval_const_expr(node_l(node), p);
+        r = eval_const_expr(node_r(node), p);
         return l + r;
 
     case NOD_SUB:
-        l = eval_const_expr(node->l, p);
-        r = eval_const_expr(node->r, p);
+        l = eval_const_expr(node_l(node), p);
+        r = eval_const_expr(node_r(node), p);
         return l - r;
 
     case NOD_MUL:
-        l = eval_const_expr(node->l, p);
-        r = eval_const_expr(node->r, p);
+        l = eval_const_expr(node_l(node), p);
+        r = eval_const_expr(node_r(node), p);
         return l * r;
 
     case NOD_DIV:
-        l = eval_const_expr(node->l, p);
-        r = eval_const_expr(node->r, p);
+        l = eval_const_expr(node_l(node), p);
+        r = eval_const_expr(node_r(node), p);
         return l / r;
 
     case NOD_MOD:
-        l = eval_const_expr(node->l, p);
-        r = eval_const_expr(node->r, p);
+        l = eval_const_expr(node_l(node), p);
+        r = eval_const_expr(node_r(node), p);
         return l % r;
 
     case NOD_SHL:
-        l = eval_const_expr(node->l, p);
-        r = eval_const_expr(node->r, p);
+        l = eval_const_expr(node_l(node), p);
+        r = eval_const_expr(node_r(node), p);
         return l << r;
 
     case NOD_SHR:
-        l = eval_const_expr(node->l, p);
-        r = eval_const_expr(node->r, p);
+        l = eval_const_expr(node_l(node), p);
+        r = eval_const_expr(node_r(node), p);
         return l >> r;
 
     case NOD_CAST:
-        l = eval_const_expr(node->l, p);
+        l = eval_const_expr(node_l(node), p);
         return l;
 
     case NOD_SIZEOF:
     case NOD_NUM:
-        return node->ival;
+        return node_ival(node);
 
     case NOD_DECL_IDENT:
     case NOD_IDENT:
         if (node->sym->kind != SYM_ENUMERATOR) {
-            add_error(p->diag, &node->pos, "expression is not a constant expression");
+            add_error(p->diag, node_pos(node), "expression is not a constant expression");
             return 0;
         }
         return node->sym->mem_offset;
 
     default:
-        add_error(p->diag, &node->pos, "expression is not a constant expression");
+        add_error(p->diag, node_pos(node), "expression is not a constant expression");
         return 0;
     }
 }
@@ -605,6 +636,13 @@ static struct symbol *use_sym(struct parser *p, const char *ident, int sym_kind)
 
     sym = use_symbol(p->symtab, ident, sym_kind);
 
+    /* a call or an address makes a deferred body needed */
+    if (is_func(sym)) {
+        if (sym->orig)
+            sym->orig->is_referenced = 1;
+        sym->is_referenced = 1;
+    }
+
     return sym;
 }
 
@@ -790,23 +828,23 @@ static struct ast_node *primary_expression(struct parser *p)
     switch (tok->kind) {
 
     case TOK_NUM:
-        return new_node_num(tok->value, tokpos(p));
+        return new_node_num(token_value(p, tok), tokpos(p));
 
     case TOK_FPNUM:
-        tree = new_node_fpnum(tok->fpnum, tokpos(p));
-        tree->sym = define_fpnum(p, tok->text);
+        tree = new_node_fpnum(strtod(token_text(p, tok), NULL), tokpos(p));
+        tree->sym = define_fpnum(p, token_text(p, tok));
         return tree;
 
     case TOK_STRING_LITERAL:
         tree = new_node_(NOD_STRING, tokpos(p));
-        tree->sym = define_string(p, tok->text);
+        tree->sym = define_string(p, token_text(p, tok));
         return convert_(p, typed_(tree));
 
     case TOK_IDENT:
         ungettok(p);
         tree = identifier(p);
         sym_kind = nexttok(p, '(') ? SYM_FUNC : SYM_VAR;
-        tree->sym = use_sym(p, tok->text, sym_kind);
+        tree->sym = use_sym(p, token_text(p, tok), sym_kind);
         return convert_(p, typed_(tree));
 
     case '(':
@@ -882,7 +920,7 @@ static struct ast_node *struct_ref(struct parser *p, struct ast_node *strc)
     ref = new_node_(NOD_STRUCT_REF, tokpos(p));
 
     member = identifier(p);
-    member->sym = use_member_sym(p, strc->type, current_token(p)->text);
+    member->sym = use_member_sym(p, strc->type, token_text(p, current_token(p)));
     typed_(member);
 
     ref = branch_(ref, strc, member);
@@ -925,7 +963,7 @@ static struct ast_node *postfix_expression(struct parser *p)
             if (!nexttok(p, ')')) {
                 const struct data_type *func_type = underlying(tree->type);
                 args = argument_expression_list(p, func_type);
-                call->ival = args ? args->ival : 0;
+                set_node_ival(call, args ? node_ival(args) : 0);
             }
             tree = branch_(call, tree, args);
             expect(p, ')');
@@ -974,7 +1012,7 @@ static struct ast_node *cast_expression(struct parser *p)
             expect(p, ')');
 
             tree = new_node_(NOD_CAST, tokpos(p));
-            tree->l = cast_expression(p);
+            set_node_l(tree, cast_expression(p));
             tree->type = type;
             return tree;
         }
@@ -1050,7 +1088,7 @@ static struct ast_node *unary_expression(struct parser *p)
 
                 expect(p, ')');
                 tree = branch_(tree, tname, NULL);
-                tree->ival = get_size(tree->l->type);
+                set_node_ival(tree, get_size(node_l(tree)->type));
                 return tree;
             } else {
                 /* unget '(' then try 'sizeof expression' */
@@ -1059,7 +1097,7 @@ static struct ast_node *unary_expression(struct parser *p)
         }
         p->is_sizeof_operand = 1;
         tree = branch_(tree, unary_expression(p), NULL);
-        tree->ival = tree->l ? get_size(tree->l->type) : 0;
+        set_node_ival(tree, node_l(tree) ? get_size(node_l(tree)->type) : 0);
         p->is_sizeof_operand = 0;
 
         return tree;
@@ -1071,319 +1109,98 @@ static struct ast_node *unary_expression(struct parser *p)
 }
 
 /*
- * multiplicative_expression
- *     cast_expression
- *     multiplicative_expression '*' cast_expression
- *     multiplicative_expression '/' cast_expression
- */
-static struct ast_node *multiplicative_expression(struct parser *p)
-{
-    struct ast_node *tree = cast_expression(p);
-    struct ast_node *expr = NULL;
-
-    for (;;) {
-        const struct token *tok = gettok(p);
-
-        switch (tok->kind) {
-
-        case '*':
-            expr = new_node_(NOD_MUL, tokpos(p));
-            tree = branch_(expr, tree, cast_expression(p));
-            break;
-
-        case '/':
-            expr = new_node_(NOD_DIV, tokpos(p));
-            tree = branch_(expr, tree, cast_expression(p));
-            break;
-
-        case '%':
-            expr = new_node_(NOD_MOD, tokpos(p));
-            tree = branch_(expr, tree, cast_expression(p));
-            break;
-
-        default:
-            ungettok(p);
-            return tree;
-        }
-    }
-}
-
-/*
- * additive_expression
- *     multiplicative_expression
- *     additive_expression '+' multiplicative_expression
- *     additive_expression '-' multiplicative_expression
- */
-static struct ast_node *additive_expression(struct parser *p)
-{
-    struct ast_node *tree = multiplicative_expression(p);
-    struct ast_node *expr = NULL;
-
-    for (;;) {
-        const struct token *tok = gettok(p);
-
-        switch (tok->kind) {
-
-        case '+':
-            expr = new_node_(NOD_ADD, tokpos(p));
-            tree = branch_(expr, tree, multiplicative_expression(p));
-            break;
-
-        case '-':
-            expr = new_node_(NOD_SUB, tokpos(p));
-            tree = branch_(expr, tree, multiplicative_expression(p));
-            break;
-
-        default:
-            ungettok(p);
-            return tree;
-        }
-    }
-}
-
-/*
- * shift_expression
- *     additive_expression
- *     shift_expression TOK_SHL additive_expression
- *     shift_expression TOK_SHR additive_expression
- */
-static struct ast_node *shift_expression(struct parser *p)
-{
-    struct ast_node *tree = additive_expression(p);
-    struct ast_node *expr = NULL;
-
-    for (;;) {
-        const struct token *tok = gettok(p);
-
-        switch (tok->kind) {
-
-        case TOK_SHL:
-            expr = new_node_(NOD_SHL, tokpos(p));
-            tree = branch_(expr, tree, additive_expression(p));
-            break;
-
-        case TOK_SHR:
-            expr = new_node_(NOD_SHR, tokpos(p));
-            tree = branch_(expr, tree, additive_expression(p));
-            break;
-
-        default:
-            ungettok(p);
-            return tree;
-        }
-    }
-}
-
-/*
- * relational_expression
- *     shift_expression
- *     relational_expression '<' shift_expression
- *     relational_expression '>' shift_expression
- *     relational_expression TOK_LE shift_expression
- *     relational_expression TOK_GE shift_expression
- */
-static struct ast_node *relational_expression(struct parser *p)
-{
-    struct ast_node *tree = shift_expression(p);
-    struct ast_node *rela = NULL;
-
-    for (;;) {
-        const struct token *tok = gettok(p);
-
-        switch (tok->kind) {
-
-        case '<':
-            rela = new_node_(NOD_LT, tokpos(p));
-            tree = branch_(rela, tree, shift_expression(p));
-            break;
-
-        case '>':
-            rela = new_node_(NOD_GT, tokpos(p));
-            tree = branch_(rela, tree, shift_expression(p));
-            break;
-
-        case TOK_LE:
-            rela = new_node_(NOD_LE, tokpos(p));
-            tree = branch_(rela, tree, shift_expression(p));
-            break;
-
-        case TOK_GE:
-            rela = new_node_(NOD_GE, tokpos(p));
-            tree = branch_(rela, tree, shift_expression(p));
-            break;
-
-        default:
-            ungettok(p);
-            return tree;
-        }
-    }
-}
-
-/*
- * equality_expression
- *     relational_expression
- *     equality_expression TOK_EQ relational_expression
- *     equality_expression TOK_NE relational_expression
- */
-static struct ast_node *equality_expression(struct parser *p)
-{
-    struct ast_node *tree = relational_expression(p);
-    struct ast_node *equa = NULL;
-
-    for (;;) {
-        const struct token *tok = gettok(p);
-
-        switch (tok->kind) {
-
-        case TOK_EQ:
-            equa = new_node_(NOD_EQ, tokpos(p));
-            tree = branch_(equa, tree, relational_expression(p));
-            break;
-
-        case TOK_NE:
-            equa = new_node_(NOD_NE, tokpos(p));
-            tree = branch_(equa, tree, relational_expression(p));
-            break;
-
-        default:
-            ungettok(p);
-            return tree;
-        }
-    }
-}
-
-/*
- * and_expression
- *     equality_expression
- *     and_expression '&' equality_expression
- */
-static struct ast_node *and_expression(struct parser *p)
-{
-    struct ast_node *tree = equality_expression(p);
-    struct ast_node *expr = NULL;
-
-    for (;;) {
-        const struct token *tok = gettok(p);
-
-        switch (tok->kind) {
+ * binary operators from the lowest precedence. operators of the same
+ * precedence are left associative
+ *
+ * logical_or_expression      TOK_LOGICAL_OR
+ * logical_and_expression     TOK_LOGICAL_AND
+ * inclusive_or_expression    '|'
+ * exclusive_or_expression    '^'
+ * and_expression             '&'
+ * equality_expression        TOK_EQ TOK_NE
+ * relational_expression      '<' '>' TOK_LE TOK_GE
+ * shift_expression           TOK_SHL TOK_SHR
+ * additive_expression        '+' '-'
+ * multiplicative_expression  '*' '/' '%'
+ */
+enum precedence {
+    PREC_NONE,
+    PREC_LOGICAL_OR,
+    PREC_LOGICAL_AND,
+    PREC_INCLUSIVE_OR,
+    PREC_EXCLUSIVE_OR,
+    PREC_AND,
+    PREC_EQUALITY,
+    PREC_RELATIONAL,
+    PREC_SHIFT,
+    PREC_ADDITIVE,
+    PREC_MULTIPLICATIVE
+};
 
-        case '&':
-            expr = new_node_(NOD_AND, tokpos(p));
-            tree = branch_(expr, tree, equality_expression(p));
-            break;
+struct binary_operator {
+    int token_kind;
+    int node_kind;
+    int prec;
+};
 
-        default:
-            ungettok(p);
-            return tree;
-        }
-    }
-}
+static const struct binary_operator binary_operators[] = {
+    {TOK_LOGICAL_OR,  NOD_LOGICAL_OR,  PREC_LOGICAL_OR},
+    {TOK_LOGICAL_AND, NOD_LOGICAL_AND, PREC_LOGICAL_AND},
+    {'|',             NOD_OR,          PREC_INCLUSIVE_OR},
+    {'^',             NOD_XOR,         PREC_EXCLUSIVE_OR},
+    {'&',             NOD_AND,         PREC_AND},
+    {TOK_EQ,          NOD_EQ,          PREC_EQUALITY},
+    {TOK_NE,          NOD_NE,          PREC_EQUALITY},
+    {'<',             NOD_LT,          PREC_RELATIONAL},
+    {'>',             NOD_GT,          PREC_RELATIONAL},
+    {TOK_LE,          NOD_LE,          PREC_RELATIONAL},
+    {TOK_GE,          NOD_GE,          PREC_RELATIONAL},
+    {TOK_SHL,         NOD_SHL,         PREC_SHIFT},
+    {TOK_SHR,         NOD_SHR,         PREC_SHIFT},
+    {'+',             NOD_ADD,         PREC_ADDITIVE},
+    {'-',             NOD_SUB,         PREC_ADDITIVE},
+    {'*',             NOD_MUL,         PREC_MULTIPLICATIVE},
+    {'/',             NOD_DIV,         PREC_MULTIPLICATIVE},
+    {'%',             NOD_MOD,         PREC_MULTIPLICATIVE}
+};
 
-/*
- * exclusive_or_expression
- *     and_expression
- *     exclusive_or_expression '^' and_expression
- */
-static struct ast_node *exclusive_or_expression(struct parser *p)
+static const struct binary_operator *find_binary_operator(int token_kind)
 {
-    struct ast_node *tree = and_expression(p);
-    struct ast_node *expr = NULL;
-
-    for (;;) {
-        const struct token *tok = gettok(p);
-
-        switch (tok->kind) {
+    const int count = sizeof(binary_operators) / sizeof(binary_operators[0]);
+    int i;
 
-        case '^':
-            expr = new_node_(NOD_XOR, tokpos(p));
-            tree = branch_(expr, tree, and_expression(p));
-            break;
+    for (i = 0; i < count; i++)
+        if (binary_operators[i].token_kind == token_kind)
+            return &binary_operators[i];
 
-        default:
-            ungettok(p);
-            return tree;
-        }
-    }
+    return NULL;
 }
 
 /*
- * inclusive_or_expression
- *     exclusive_or_expression
- *     inclusive_or_expression '|' exclusive_or_expression
+ * binary_expression
+ *     cast_expression
+ *     binary_expression binary_operator binary_expression
+ *
+ * precedence climbing. operators binding tighter than the one just read are
+ * taken into its right operand, so an operand is a single call to
+ * cast_expression instead of a descent through every precedence level
  */
-static struct ast_node *inclusive_or_expression(struct parser *p)
+static struct ast_node *binary_expression(struct parser *p, int min_prec)
 {
-    struct ast_node *tree = exclusive_or_expression(p);
-    struct ast_node *expr = NULL;
+    struct ast_node *tree = cast_expression(p);
 
     for (;;) {
         const struct token *tok = gettok(p);
+        const struct binary_operator *op = find_binary_operator(tok->kind);
+        struct ast_node *expr = NULL;
 
-        switch (tok->kind) {
-
-        case '|':
-            expr = new_node_(NOD_OR, tokpos(p));
-            tree = branch_(expr, tree, exclusive_or_expression(p));
-            break;
-
-        default:
+        if (!op || op->prec < min_prec) {
             ungettok(p);
             return tree;
         }
-    }
-}
-
-/*
- * logical_and_expression
- *     inclusive_or_expression
- *     logical_and_expression TOK_LOGICAL_AND inclusive_or_expression
- */
-static struct ast_node *logical_and_expression(struct parser *p)
-{
-    struct ast_node *tree = inclusive_or_expression(p);
-    struct ast_node *logi = NULL;
 
-    for (;;) {
-        const struct token *tok = gettok(p);
-
-        switch (tok->kind) {
-
-        case TOK_LOGICAL_AND:
-            logi = new_node_(NOD_LOGICAL_AND, tokpos(p));
-            tree = branch_(logi, tree, inclusive_or_expression(p));
-            break;
-
-        default:
-            ungettok(p);
-            return tree;
-        }
-    }
-}
-
-/*
- * logical_or_expression
- *     logical_and_expression
- *     logical_or_expression TOK_LOGICAL_OR logical_and_expression
- */
-static struct ast_node *logical_or_expression(struct parser *p)
-{
-    struct ast_node *tree = logical_and_expression(p);
-    struct ast_node *logi = NULL;
-
-    for (;;) {
-        const struct token *tok = gettok(p);
-
-        switch (tok->kind) {
-
-        case TOK_LOGICAL_OR:
-            logi = new_node_(NOD_LOGICAL_OR, tokpos(p));
-            tree = branch_(logi, tree, logical_and_expression(p));
-            break;
-
-        default:
-            ungettok(p);
-            return tree;
-        }
+        expr = new_node_(op->node_kind, tokpos(p));
+        tree = branch_(expr, tree, binary_expression(p, op->prec + 1));
     }
 }
 
@@ -1398,7 +1215,7 @@ static struct ast_node *conditional_expression(struct parser *p)
     struct ast_node *then_else = NULL, *cond = NULL, *then = NULL, *els = NULL;
     const struct token *tok = NULL;
 
-    tree = logical_or_expression(p);
+    tree = binary_expression(p, PREC_LOGICAL_OR);
     tok = gettok(p);
 
     switch (tok->kind) {
@@ -1528,7 +1345,7 @@ static struct ast_node *constant_expression(struct parser *p)
 
     tree = new_node_(NOD_CONST_EXPR, tokpos(p));
     tree = branch_(tree, expr, NULL);
-    tree->ival = eval_const_expr(expr, p);
+    set_node_ival(tree, eval_const_expr(expr, p));
 
     return tree;
 }
@@ -1548,8 +1365,8 @@ static struct ast_node *compound_statement(struct parser *p)
 
     begin_scope(p);
     tree = new_node(NOD_COMPOUND, NULL, NULL);
-    tree->l = declaration_list(p);
-    tree->r = statement_list(p);
+    set_node_l(tree, declaration_list(p));
+    set_node_r(tree, statement_list(p));
     end_scope(p);
 
     expect(p, '}');
@@ -1714,7 +1531,7 @@ static struct ast_node *goto_statement(struct parser *p)
 
     expect(p, TOK_GOTO);
     ident = identifier(p);
-    ident->sym = use_label(p, current_token(p)->text);
+    ident->sym = use_label(p, token_text(p, current_token(p)));
     expect(p, ';');
 
     return new_node(NOD_GOTO, ident, NULL);
@@ -1794,9 +1611,9 @@ static struct ast_node *case_statement(struct parser *p)
 
     tree = new_node_(NOD_CASE, &valpos);
     tree = branch_(tree, expr, NULL);
-    tree->sym = define_case(p, SYM_CASE, expr->ival, &valpos);
+    tree->sym = define_case(p, SYM_CASE, node_ival(expr), &valpos);
 
-    tree->r = statement(p);
+    set_node_r(tree, statement(p));
     return tree;
 }
 
@@ -1821,7 +1638,7 @@ static struct ast_node *default_statement(struct parser *p)
     tree = branch_(tree, NULL, NULL);
     tree->sym = define_case(p, SYM_DEFAULT, no_case_value, &defpos);
 
-    tree->r = statement(p);
+    set_node_r(tree, statement(p));
     return tree;
 }
 
@@ -1843,8 +1660,8 @@ static struct ast_node *labeled_statement(struct parser *p)
     sym = define_label(p, ident, &pos);
 
     tree = NEW_(NOD_LABEL);
-    tree->l = new_node_decl_ident(sym);
-    tree->r = statement(p);
+    set_node_l(tree, new_node_decl_ident(sym));
+    set_node_r(tree, statement(p));
 
     return tree;
 }
@@ -2021,7 +1838,7 @@ static const char *decl_identifier(struct parser *p, struct position *pos)
 
     if (consume(p, TOK_IDENT)) {
         tok = current_token(p);
-        ident = tok->text;
+        ident = token_text(p, tok);
     } else {
         tok = current_token(p);
         ident = NULL;
@@ -2055,8 +1872,7 @@ static struct symbol *struct_declarator(struct parser *p, struct data_type *type
     if (consume(p, ':')) {
         struct ast_node *expr = constant_expression(p);
         sym->is_bitfield = 1;
-        sym->bit_width = expr->ival;
-        free_ast_node(expr);
+        sym->bit_width = node_ival(expr);
     }
 
     return sym;
@@ -2115,7 +1931,7 @@ static struct member *struct_declaration_list(struct parser *p)
         else {
             const struct token *tok = gettok(p);
             if (tok->kind == TOK_IDENT)
-                syntax_error(p, "unknown type name '%s'", tok->text);
+                syntax_error(p, "unknown type name '%s'", token_text(p, tok));
             else
                 syntax_error(p, "type name requires a specifier or qualifier");
             ungettok(p);
@@ -2221,8 +2037,7 @@ static int enumerator(struct parser *p, int next_value)
 
     if (consume(p, '=')) {
         struct ast_node *expr = constant_expression(p);
-        val = expr->ival;
-        free_ast_node(expr);
+        val = node_ival(expr);
     }
 
     sym->mem_offset = val;
@@ -2327,7 +2142,7 @@ static struct data_type *type_specifier(struct parser *p, struct data_type *type
 
     case TOK_TYPE_NAME:
         {
-            struct symbol *sym = find_type_name_symbol(p->symtab, tok->text);
+            struct symbol *sym = find_type_name_symbol(p->symtab, token_text(p, tok));
             return type_type_name(sym);
         }
 
@@ -2422,10 +2237,8 @@ static struct data_type *array(struct parser *p, struct data_type *type)
         t = array(p, t);
         t = type_array(t);
 
-        if (expr) {
-            set_array_length(t, expr->ival);
-            free_ast_node(expr);
-        }
+        if (expr)
+            set_array_length(t, node_ival(expr));
     }
 
     return t;
@@ -2581,13 +2394,13 @@ static struct ast_node *initializer(struct parser *p, struct initializer_context
     desi = new_node_(NOD_DESIG, tokpos(p));
     if (init->type) {
         desi->type = init->type;
-        desi->ival = init->mem_offset;
+        set_node_ival(desi, init->mem_offset);
         expr = implicit_cast(expr, init->type);
     }
 
     tree = new_node_(NOD_INIT, tokpos(p));
-    tree->l = desi;
-    tree->r = expr;
+    set_node_l(tree, desi);
+    set_node_r(tree, expr);
 
     return tree;
 }
@@ -2681,18 +2494,18 @@ static struct ast_node *string_initializer(struct parser *p,
     struct ast_node *list = NULL, *init = NULL, *desi = NULL, *num = NULL;
     struct ast_node *tree = NULL;
     const struct token *tok = gettok(p);
-    const char *ch = tok->text;
+    const char *ch = token_text(p, tok);
 
     do {
         num = new_node_num(*ch, tokpos(p));
 
         desi = new_node_(NOD_DESIG, tokpos(p));
-        desi->ival = child_init.index * get_size(child_init.type);
+        set_node_ival(desi, child_init.index * get_size(child_init.type));
         desi->type = child_init.type;
 
         init = new_node_(NOD_INIT, tokpos(p));
-        init->l = desi;
-        init->r = num;
+        set_node_l(init, desi);
+        set_node_r(init, num);
 
         list = new_node_(NOD_LIST, tokpos(p));
         tree = branch_(list, tree, init);
@@ -2731,7 +2544,7 @@ static struct ast_node *init_declarator(struct parser *p, struct data_type *type
 
     if (consume(p, '=')) {
         struct initializer_context init = root_initializer(sym->type);
-        tree->l = initializer(p, &init);
+        set_node_l(tree, initializer(p, &init));
     }
 
     return typed_(tree);
@@ -2831,6 +2644,92 @@ static struct data_type *declaration_specifiers(struct parser *p, int *sclass)
     return type;
 }
 
+static int is_referenced(const struct symbol *func_sym)
+{
+    if (func_sym->orig)
+        return func_sym->orig->is_referenced;
+    return func_sym->is_referenced;
+}
+
+/* moves to the '}' closing the body at the next token by matching braces.
+ * identifiers in it are left to be classified when the body is parsed.
+ * parentheses and brackets are checked to pair up, which is the only check
+ * a body gets if it is never parsed. returns 0 at the end of input */
+static int skip_body(struct parser *p)
+{
+    const struct token *tok;
+    int index = p->curr + 1;
+    int depth = 0;
+    int parens = 0, brackets = 0;
+
+    for (;;) {
+        while (index >= p->tokens.token_count)
+            read_token(p);
+        tok = token_of(p, index);
+
+        if (tok->kind == TOK_EOF)
+            return 0;
+        else if (tok->kind == '{')
+            depth++;
+        else if (tok->kind == '}' && --depth == 0)
+            break;
+        else if (tok->kind == '(')
+            parens++;
+        else if (tok->kind == '[')
+            brackets++;
+        else if (tok->kind == ')' && --parens < 0)
+            add_error(p->diag, &tok->pos, "unmatched ')'");
+        else if (tok->kind == ']' && --brackets < 0)
+            add_error(p->diag, &tok->pos, "unmatched ']'");
+
+        if (parens < 0)
+            parens = 0;
+        if (brackets < 0)
+            brackets = 0;
+        index++;
+    }
+
+    if (parens > 0)
+        add_error(p->diag, &tok->pos, "expected ')'");
+    if (brackets > 0)
+        add_error(p->diag, &tok->pos, "expected ']'");
+
+    p->curr = index;
+    return 1;
+}
+
+/* skips the body of a static function not named so far. the function is
+ * declared as if by a prototype until the body is parsed */
+static int defer_body(struct parser *p, struct symbol *func_sym, int begin)
+{
+    struct deferred_body *body;
+
+    if (!p->defer_static_bodies || !is_static(func_sym) ||
+        func_sym->is_redefined || is_referenced(func_sym))
+        return 0;
+
+    if (!skip_body(p))
+        return 0;
+
+    body = malloc(sizeof(struct deferred_body));
+    body->func_sym = func_sym;
+    init_token_array(&body->tokens);
+    copy_token_range(&body->tokens, &p->tokens, begin, p->curr);
+    body->symbol_mark = symbol_mark(p->symtab);
+    body->is_parsed = 0;
+    body->next = NULL;
+
+    if (p->deferred_tail)
+        p->deferred_tail->next = body;
+    else
+        p->deferred = body;
+    p->deferred_tail = body;
+
+    func_sym->is_defined = 0;
+    end_scope(p);
+    return 1;
+}
+
 /* declaration
  *     declaration_specifiers ';'
  *     declaration_specifiers init_declarator_list ';'
@@ -2839,6 +2738,7 @@ static struct ast_node *declaration(struct parser *p)
 {
     struct ast_node *tree = NULL;
     struct data_type *type = NULL;
+    const int begin = p->curr + 1;
     int sclass = 0;
 
     type = declaration_specifiers(p, &sclass);
@@ -2847,6 +2747,9 @@ static struct ast_node *declaration(struct parser *p)
     if (!tree) {
         /* no object is declared */
     }
+    else if (nexttok(p, '{') && defer_body(p, symbol_of(tree->type), begin)) {
+        return tree;
+    }
     else if (nexttok(p, '{')) {
         /* a function is being defined */
         struct ast_node *stmt = NULL;
@@ -2901,7 +2804,10 @@ static struct ast_node *statement_list(struct parser *p)
     struct ast_node *tree = NULL;
 
     for (;;) {
-        const int next = peektok(p);
+        int next;
+
+        release_read_tokens(p);
+        next = peektok(p);
 
         if (next == '}' || next == TOK_EOF)
             return tree;
@@ -2920,7 +2826,7 @@ static struct ast_node *extern_decl(struct parser *p)
         const struct token *tok = gettok(p);
 
         if (tok->kind == TOK_IDENT)
-            syntax_error(p, "unknown type name '%s'", tok->text);
+            syntax_error(p, "unknown type name '%s'", token_text(p, tok));
         else
             syntax_error(p, "unexpected token");
 
@@ -2938,6 +2844,58 @@ static struct ast_node *extern_decl(struct parser *p)
     }
 }
 
+/* parses the deferred bodies of functions that have been named, including
+ * the ones named in the bodies parsed here. they are definitions after
+ * the whole translation unit as they are after their prototypes. symbols
+ * defined after a body are hidden while it is parsed */
+static void parse_deferred_bodies(struct parser *p, struct ast_list *list)
+{
+    const struct token_array tokens = p->tokens;
+    const int curr = p->curr;
+    const int head = p->head;
+    int found;
+
+    do {
+        struct deferred_body *body;
+
+        found = 0;
+        for (body = p->deferred; body; body = body->next) {
+            if (body->is_parsed || !is_referenced(body->func_sym))
+                continue;
+
+            body->is_parsed = 1;
+            found = 1;
+
+            /* tokens are classified again in the scopes of the body */
+            p->tokens = body->tokens;
+            p->curr = -1;
+            p->head = -1;
+            hide_symbols_since(p->symtab, body->symbol_mark);
+            append(list, declaration(p));
+            show_hidden_symbols(p->symtab);
+            clear_token_array(&p->tokens);
+            body->tokens = p->tokens;
+        }
+    } while (found);
+
+    p->tokens = tokens;
+    p->curr = curr;
+    p->head = head;
+}
+
+static void free_deferred_bodies(struct parser *p)
+{
+    struct deferred_body *body, *next;
+
+    for (body = p->deferred; body; body = next) {
+        next = body->next;
+        clear_token_array(&body->tokens);
+        free(body);
+    }
+    p->deferred = NULL;
+    p->deferred_tail = NULL;
+}
+
 /* translation_unit
  *     extern_declaration
  *     translation_unit extern_declaration
@@ -2947,7 +2905,10 @@ static struct ast_node *translation_unit(struct parser *p)
     struct ast_list list = {0};
 
     while (!consume(p, TOK_EOF)) {
-        struct ast_node *decl = extern_decl(p);
+        struct ast_node *decl;
+
+        release_read_tokens(p);
+        decl = extern_decl(p);
 
         if (!decl)
             continue;
@@ -2955,13 +2916,18 @@ static struct ast_node *translation_unit(struct parser *p)
         append(&list, decl);
     }
 
+    parse_deferred_bodies(p, &list);
+    free_deferred_bodies(p);
+
     return list.head;
 }
 
-struct ast_node *parse_text(struct parser *p, const char *text,
+struct ast_node *parse_source(struct parser *p, struct preprocessor *pp,
         struct symbol_table *symtab, struct diagnostic *diag)
 {
-    if (!text)
+    struct ast_node *tree = NULL;
+
+    if (!pp)
         return NULL;
 
     if (!symtab || !diag)
@@ -2969,7 +2935,11 @@ struct ast_node *parse_text(struct parser *p, const char *text,
 
     p->symtab = symtab;
     p->diag = diag;
-    set_source_text(p->lex, text);
+    set_source(p->lex, pp);
+
+    tree = translation_unit(p);
 
-    return translation_unit(p);
+    clear_token_array(&p->tokens);
+
+    return tree;
 }
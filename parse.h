@@ -7,12 +7,29 @@
 #include "diagnostic.h"
 #include "type.h"
 
-#define TOKEN_BUFFER_SIZE 4
+/* a static function whose body has been skipped. it is parsed at the end
+ * of the translation unit once the function is named in an expression */
+struct deferred_body {
+    struct symbol *func_sym;
+    /* tokens of the definition up to the closing '}', as the ones read
+     * by the parser are released as it goes */
+    struct token_array tokens;
+    /* symbols defined after the body are hidden from it */
+    int symbol_mark;
+    int is_parsed;
+    struct deferred_body *next;
+};
 
 struct parser {
     struct lexer *lex;
-    struct token tokbuf[TOKEN_BUFFER_SIZE];
+    /* tokens are read from the lexer while parsing, so that parsing goes
+     * along with preprocessing. curr is the index of current token and head
+     * is the furthest token read so far. tokens before the current
+     * declaration or statement are released */
+    struct token_array tokens;
     int head, curr;
+    /* current token before reading the first one */
+    struct token bof;
 
     struct symbol_table *symtab;
     struct diagnostic *diag;
@@ -25,11 +42,16 @@ struct parser {
     int is_sizeof_operand;
     int is_addressof_operand;
     int is_array_initializer;
+
+    /* static function bodies unused in the translation unit are not parsed */
+    int defer_static_bodies;
+    struct deferred_body *deferred;
+    struct deferred_body *deferred_tail;
 };
 
 extern struct parser *new_parser(void);
 extern void free_parser(struct parser *p);
-extern struct ast_node *parse_text(struct parser *p, const char *text,
+extern struct ast_node *parse_source(struct parser *p, struct preprocessor *pp,
         struct symbol_table *symtab, struct diagnostic *diag);
 
 #endif /* _H */
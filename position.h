@@ -1,9 +1,10 @@
 #ifndef POSITION_H
 #define POSITION_H
 
+/* offset in the text given to the lexer. line, column and file name are
+ * looked up in the source map only when they are needed */
 struct position {
-    int x, y;
-    const char *filename;
+    int offset;
 };
 
 #endif /* _H */
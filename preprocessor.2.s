@@ -0,0 +1,31759 @@
+    .data
+
+_buf_834:
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+
+_punctuators_1225:
+    .quad _L_str_1226
+    .quad _L_str_1227
+    .quad _L_str_1228
+    .quad _L_str_1229
+    .quad _L_str_1230
+    .quad _L_str_1231
+    .quad _L_str_1232
+    .quad _L_str_1233
+    .quad _L_str_1234
+    .quad _L_str_1235
+    .quad _L_str_1236
+    .quad _L_str_1237
+    .quad _L_str_1238
+    .quad _L_str_1239
+    .quad _L_str_1240
+    .quad _L_str_1241
+    .quad _L_str_1242
+    .quad _L_str_1243
+    .quad _L_str_1244
+    .quad _L_str_1245
+    .quad _L_str_1246
+    .quad _L_str_1247
+    .quad _L_str_1248
+    .quad 0
+
+_name_1461:
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+
+_msg_1465:
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+
+_ident_1578:
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+
+_repl_1579:
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+
+_ident_1596:
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+
+_name_1614:
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+
+_num_1629:
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+
+_name_1630:
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+
+_direc_1647:
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+
+_tok_1946:
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+
+_ident_2392:
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+
+_ident_2399:
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+
+_guard_2560:
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+
+_pchname_2810:
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+
+    .text
+
+_L_str_924:
+    .asciz "%10s %10s %10s  %s\012"
+
+_L_str_925:
+    .asciz "read"
+
+_L_str_926:
+    .asciz "emitted"
+
+_L_str_927:
+    .asciz "time(us)"
+
+_L_str_928:
+    .asciz "file"
+
+_L_str_931:
+    .asciz "%10ld %10ld %10ld  "
+
+_L_str_932:
+    .asciz ". "
+
+_L_str_933:
+    .asciz "%s\012"
+
+_L_str_961:
+    .asciz "%-24s %10s %10s %10s\012"
+
+_L_str_962:
+    .asciz "macro"
+
+_L_str_963:
+    .asciz "expansions"
+
+_L_str_964:
+    .asciz "bytes"
+
+_L_str_965:
+    .asciz "depth"
+
+_L_str_966:
+    .asciz "%-24s %10d %10ld %10d\012"
+
+_L_str_974:
+    .asciz "\012"
+
+_L_str_982:
+    .asciz "\""
+
+_L_str_984:
+    .asciz "\\%c"
+
+_L_str_985:
+    .asciz "\\u%04x"
+
+_L_str_986:
+    .asciz "%c"
+
+_L_str_999:
+    .asciz "{\012  \"includes\": ["
+
+_L_str_1001:
+    .asciz "\012    {"
+
+_L_str_1002:
+    .asciz ",\012    {"
+
+_L_str_1003:
+    .asciz "\"path\": "
+
+_L_str_1004:
+    .asciz ", \"depth\": %d, \"bytes_read\": %ld, "
+
+_L_str_1005:
+    .asciz "\"bytes_emitted\": %ld, \"time_us\": %ld}"
+
+_L_str_1007:
+    .asciz "\012  ],\012  \"macros\": ["
+
+_L_str_1009:
+    .asciz "\"name\": "
+
+_L_str_1010:
+    .asciz ", \"expansions\": %d, \"output_bytes\": %ld, "
+
+_L_str_1011:
+    .asciz "\"max_rescan_depth\": %d}"
+
+_L_str_1013:
+    .asciz "\012  ],\012  \"expansion_cache\": "
+
+_L_str_1014:
+    .asciz "\012}\012"
+
+_L_str_1027:
+    .asciz "# %d \"%s\"\012"
+
+_L_str_1043:
+    .asciz "%s"
+
+_L_str_1052:
+    .asciz "\033[1m"
+
+_L_str_1053:
+    .asciz "%s:"
+
+_L_str_1054:
+    .asciz "%d:%d: "
+
+_L_str_1055:
+    .asciz "\033[31m"
+
+_L_str_1056:
+    .asciz "%s: "
+
+_L_str_1057:
+    .asciz "error"
+
+_L_str_1058:
+    .asciz "\033[39m"
+
+_L_str_1059:
+    .asciz "\033[0m"
+
+_L_str_1226:
+    .asciz "..."
+
+_L_str_1227:
+    .asciz "<<="
+
+_L_str_1228:
+    .asciz ">>="
+
+_L_str_1229:
+    .asciz "->"
+
+_L_str_1230:
+    .asciz "++"
+
+_L_str_1231:
+    .asciz "--"
+
+_L_str_1232:
+    .asciz "<<"
+
+_L_str_1233:
+    .asciz ">>"
+
+_L_str_1234:
+    .asciz "<="
+
+_L_str_1235:
+    .asciz ">="
+
+_L_str_1236:
+    .asciz "=="
+
+_L_str_1237:
+    .asciz "!="
+
+_L_str_1238:
+    .asciz "&&"
+
+_L_str_1239:
+    .asciz "||"
+
+_L_str_1240:
+    .asciz "*="
+
+_L_str_1241:
+    .asciz "/="
+
+_L_str_1242:
+    .asciz "%="
+
+_L_str_1243:
+    .asciz "+="
+
+_L_str_1244:
+    .asciz "-="
+
+_L_str_1245:
+    .asciz "&="
+
+_L_str_1246:
+    .asciz "^="
+
+_L_str_1247:
+    .asciz "|="
+
+_L_str_1248:
+    .asciz "##"
+
+_L_str_1305:
+    .asciz "expected a new line"
+
+_L_str_1340:
+    .asciz "unterminated /* comment"
+
+_L_str_1354:
+    .asciz "unterminated \" for string literal"
+
+_L_str_1373:
+    .asciz "unterminated ' for character literal"
+
+_L_str_1454:
+    .asciz "expected \"FILENAME\" or <FILENAME>"
+
+_L_str_1466:
+    .asciz "'%s' file not found"
+
+_L_str_1519:
+    .asciz "if"
+
+_L_str_1520:
+    .asciz "ifdef"
+
+_L_str_1521:
+    .asciz "ifndef"
+
+_L_str_1524:
+    .asciz "else"
+
+_L_str_1525:
+    .asciz "elif"
+
+_L_str_1528:
+    .asciz "endif"
+
+_L_str_1585:
+    .asciz "'' macro redefined\012"
+
+_L_str_1604:
+    .asciz "# "
+
+_L_str_1616:
+    .asciz "once"
+
+_L_str_1620:
+    .asciz "pragma"
+
+_L_str_1632:
+    .asciz "line"
+
+_L_str_1634:
+    .asciz "#line directive requires a positive integer argument"
+
+_L_str_1637:
+    .asciz "invalid filename for #line directive"
+
+_L_str_1648:
+    .asciz "include"
+
+_L_str_1649:
+    .asciz "define"
+
+_L_str_1650:
+    .asciz "undef"
+
+_L_str_1765:
+    .asciz "#"
+
+_L_str_1803:
+    .asciz "/*"
+
+_L_str_1832:
+    .asciz "unterminated argument list"
+
+_L_str_1859:
+    .asciz ")"
+
+_L_str_1861:
+    .asciz "too few arguments for macro"
+
+_L_str_1863:
+    .asciz ","
+
+_L_str_1865:
+    .asciz "too many arguments for macro"
+
+_L_str_1867:
+    .asciz "("
+
+_L_str_2013:
+    .asciz "defined"
+
+_L_str_2017:
+    .asciz "macro name missing after 'defined'"
+
+_L_str_2021:
+    .asciz "missing ')' after 'defined'"
+
+_L_str_2024:
+    .asciz "1"
+
+_L_str_2025:
+    .asciz "0"
+
+_L_str_2129:
+    .asciz "invalid integer constant in expression"
+
+_L_str_2143:
+    .asciz "expected value in expression"
+
+_L_str_2146:
+    .asciz "expected ')' in expression"
+
+_L_str_2149:
+    .asciz "'defined' generated by macro expansion in #if"
+
+_L_str_2151:
+    .asciz "invalid token in expression"
+
+_L_str_2161:
+    .asciz "+"
+
+_L_str_2162:
+    .asciz "-"
+
+_L_str_2165:
+    .asciz "~"
+
+_L_str_2168:
+    .asciz "!"
+
+_L_str_2181:
+    .asciz "*"
+
+_L_str_2185:
+    .asciz "/"
+
+_L_str_2186:
+    .asciz "%"
+
+_L_str_2191:
+    .asciz "division by zero in #if"
+
+_L_str_2248:
+    .asciz "<"
+
+_L_str_2251:
+    .asciz ">"
+
+_L_str_2288:
+    .asciz "&"
+
+_L_str_2301:
+    .asciz "^"
+
+_L_str_2314:
+    .asciz "|"
+
+_L_str_2353:
+    .asciz "?"
+
+_L_str_2354:
+    .asciz ":"
+
+_L_str_2355:
+    .asciz "expected ':' in expression"
+
+_L_str_2365:
+    .asciz "extra tokens at end of #if expression"
+
+_L_str_2409:
+    .asciz "#elif without #if"
+
+_L_str_2422:
+    .asciz "#else without #if"
+
+_L_str_2435:
+    .asciz "#endif without #if"
+
+_L_str_2538:
+    .asciz "r"
+
+_L_str_2572:
+    .asciz "unterminated conditional directive"
+
+_L_str_2598:
+    .asciz "\\ "
+
+_L_str_2599:
+    .asciz "$$"
+
+_L_str_2612:
+    .asciz " "
+
+_L_str_2613:
+    .asciz " \\\012 "
+
+_L_str_2655:
+    .asciz ""
+
+_L_str_2720:
+    .asciz "w"
+
+_L_str_2723:
+    .asciz "ACCPCH2"
+
+_L_str_2801:
+    .asciz ".h"
+
+_L_str_2802:
+    .asciz "pch"
+
+_zero_clear:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## assign
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $0, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $0, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+_LBB0_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _strbuf_init
+_strbuf_init:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _zero_clear
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strbuf_grow
+    addq  $16, %rsp
+## assign
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+_LBB1_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _strbuf_copy
+_strbuf_copy:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _strlen
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strbuf_grow
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcpy
+    addq  $16, %rsp
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+_LBB2_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _strbuf_append
+_strbuf_append:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _strlen
+    addq  $16, %rsp
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -40(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strbuf_grow
+    addq  $16, %rsp
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## while-cond
+_LBB4_4:
+    movq  -24(%rbp), %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    je    _LBB4_2
+## while-body
+## assign
+    leaq  -32(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    pushq %rax
+    leaq  -24(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    movb  (%rax), %al
+    popq  %rdx
+    movb  %al, (%rdx)
+    jmp   _LBB4_4
+_LBB4_2:
+## assign
+    movq  -32(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -40(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+_LBB3_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _strbuf_append_char
+_strbuf_append_char:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movb  %sil, -9(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movb  -9(%rbp), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB6_3
+## if-then
+    jmp   _LBB5_0
+    jmp   _LBB6_2
+## if-else
+_LBB6_3:
+_LBB6_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strbuf_grow
+    addq  $16, %rsp
+## assign
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movb  -9(%rbp), %al
+    popq  %rdx
+    movb  %al, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+_LBB5_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _strbuf_grow
+_strbuf_grow:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+## cond-?
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $0, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpq  $0, %rax
+    je    _LBB8_3
+## cond-then
+    movl  $32, %eax
+    movslq %eax, %rax
+    jmp   _LBB8_2
+## cond-else
+_LBB8_3:
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+_LBB8_2:
+    popq  %rdx
+    movq  %rax, (%rdx)
+## while-cond
+_LBB9_4:
+    movq  -24(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  %rax, %rdx
+    popq  %rax
+    cmpq  %rdx, %rax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB9_2
+## while-body
+## mul-assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $2, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq (%rdx), %rax
+    movq  %rax, (%rdx)
+    jmp   _LBB9_4
+_LBB9_2:
+## if-cond
+    movq  -24(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB10_3
+## if-then
+    jmp   _LBB7_0
+    jmp   _LBB10_2
+## if-else
+_LBB10_3:
+_LBB10_2:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movl  $1, %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _realloc
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+_LBB7_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _strbuf_free
+_strbuf_free:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $0, %eax
+    movslq %eax, %rax
+    movq  %rax, %rdx
+    popq  %rax
+    cmpq  %rdx, %rax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB12_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _zero_clear
+    addq  $16, %rsp
+    jmp   _LBB12_2
+## if-else
+_LBB12_3:
+_LBB12_2:
+_LBB11_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_hash_fn:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-pre
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB14_1:
+    movq  -24(%rbp), %rax
+    movb  (%rax), %al
+    movzbl %al, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB14_2
+## for-body
+## assign
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    movl  $31, %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    movb  (%rax), %al
+    movzbl %al, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-post
+_LBB14_4:
+    leaq  -24(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    jmp   _LBB14_1
+_LBB14_2:
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $1237, %eax
+    movl  %eax, %edi
+    popq  %rax
+    xorl  %edx, %edx
+    divl  %edi
+    movl  %edx, %eax
+    jmp   _LBB13_0
+_LBB13_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_new_param:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movl  $16, %eax
+    movslq %eax, %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _malloc
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _strlen
+    addq  $8, %rsp
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movl  $1, %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _malloc
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $32, %rsp
+    movq  -32(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _strncpy
+    addq  $32, %rsp
+## assign
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -16(%rbp), %rax
+    jmp   _LBB15_0
+_LBB15_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_free_param:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## if-cond
+    movq  -8(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB17_3
+## if-then
+    jmp   _LBB16_0
+    jmp   _LBB17_2
+## if-else
+_LBB17_3:
+_LBB17_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free_param
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+_LBB16_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_new_entry:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movl  $56, %eax
+    movslq %eax, %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _malloc
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _strlen
+    addq  $8, %rsp
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movl  $1, %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _malloc
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $32, %rsp
+    movq  -32(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _strncpy
+    addq  $32, %rsp
+## assign
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -16(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -16(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -16(%rbp), %rax
+    addq  $28, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -16(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -16(%rbp), %rax
+    addq  $40, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -16(%rbp), %rax
+    addq  $48, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -16(%rbp), %rax
+    jmp   _LBB18_0
+_LBB18_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_free_entry:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## if-cond
+    movq  -8(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB20_3
+## if-then
+    jmp   _LBB19_0
+    jmp   _LBB20_2
+## if-else
+_LBB20_3:
+_LBB20_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free_param
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+_LBB19_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_new_macro_table:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+## func body
+## local scalar init
+    leaq  -8(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movl  $19792, %eax
+    movslq %eax, %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _malloc
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-pre
+## assign
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB22_1:
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $1237, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB22_2
+## for-body
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $9896, %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-post
+_LBB22_4:
+    leaq  -12(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB22_1
+_LBB22_2:
+    movq  -8(%rbp), %rax
+    jmp   _LBB21_0
+_LBB21_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_free_macro_table:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## if-cond
+    movq  -8(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB24_3
+## if-then
+    jmp   _LBB23_0
+    jmp   _LBB24_2
+## if-else
+_LBB24_3:
+_LBB24_2:
+## for-pre
+## assign
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB25_1:
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $1237, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB25_2
+## for-body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -24(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB26_3
+## if-then
+    jmp   _LBB25_4
+    jmp   _LBB26_2
+## if-else
+_LBB26_3:
+_LBB26_2:
+## while-cond
+_LBB27_4:
+    movq  -24(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB27_2
+## while-body
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    addq  $40, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free_entry
+    addq  $16, %rsp
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB27_4
+_LBB27_2:
+## for-post
+_LBB25_4:
+    leaq  -12(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB25_1
+_LBB25_2:
+## for-pre
+## assign
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB28_1:
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $1237, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB28_2
+## for-body
+## for-pre
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $9896, %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB29_1:
+    movq  -40(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB29_2
+## for-body
+## assign
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    movq  -40(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -40(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -40(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+## for-post
+_LBB29_4:
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movq  -48(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB29_1
+_LBB29_2:
+## for-post
+_LBB28_4:
+    leaq  -12(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB28_1
+_LBB28_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+_LBB23_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_lookup_macro:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _hash_fn
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-pre
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -28(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB31_1:
+    movq  -24(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB31_2
+## for-body
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB32_3
+## if-then
+    movq  -24(%rbp), %rax
+    jmp   _LBB30_0
+    jmp   _LBB32_2
+## if-else
+_LBB32_3:
+_LBB32_2:
+## for-post
+_LBB31_4:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    addq  $40, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB31_1
+_LBB31_2:
+    movl  $0, %eax
+    jmp   _LBB30_0
+_LBB30_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_find_macro_stats:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _hash_fn
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-pre
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $9896, %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -28(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB34_1:
+    movq  -24(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB34_2
+## for-body
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB35_3
+## if-then
+    movq  -24(%rbp), %rax
+    jmp   _LBB33_0
+    jmp   _LBB35_2
+## if-else
+_LBB35_3:
+_LBB35_2:
+## for-post
+_LBB34_4:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB34_1
+_LBB34_2:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $1, %eax
+    movslq %eax, %rax
+    movq  %rax, 16(%rsp)
+    movl  $40, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _calloc
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    subq  $8, %rsp
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _strlen
+    addq  $16, %rsp
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _malloc
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcpy
+    addq  $16, %rsp
+## assign
+    movq  -24(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $9896, %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -28(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $9896, %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -28(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -24(%rbp), %rax
+    jmp   _LBB33_0
+_LBB33_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_insert_macro:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _hash_fn
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-pre
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -28(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB37_1:
+    movq  -24(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB37_2
+## for-body
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB38_3
+## if-then
+    movq  -24(%rbp), %rax
+    jmp   _LBB36_0
+    jmp   _LBB38_2
+## if-else
+_LBB38_3:
+_LBB38_2:
+## for-post
+_LBB37_4:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    addq  $40, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB37_1
+_LBB37_2:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _new_entry
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -24(%rbp), %rax
+    addq  $48, %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _find_macro_stats
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -24(%rbp), %rax
+    addq  $40, %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -28(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -28(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -24(%rbp), %rax
+    jmp   _LBB36_0
+_LBB36_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_remove_macro:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## for-pre
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _hash_fn
+    addq  $8, %rsp
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB40_1:
+    movq  -24(%rbp), %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    je    _LBB40_2
+## for-body
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    movq  (%rax), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB41_3
+## if-then
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -24(%rbp), %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    addq  $40, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -32(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free_entry
+    addq  $16, %rsp
+    jmp   _LBB39_0
+    jmp   _LBB41_2
+## if-else
+_LBB41_3:
+_LBB41_2:
+## for-post
+_LBB40_4:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    movq  (%rax), %rax
+    addq  $40, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB40_1
+_LBB40_2:
+_LBB39_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_add_replacement:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _strlen
+    addq  $8, %rsp
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movl  $1, %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _malloc
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -32(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _strncpy
+    addq  $32, %rsp
+## assign
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+_LBB42_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_new_include_table:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+## func body
+## local scalar init
+    leaq  -8(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movl  $9912, %eax
+    movslq %eax, %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _malloc
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-pre
+## assign
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB44_1:
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $1237, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB44_2
+## for-body
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-post
+_LBB44_4:
+    leaq  -12(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB44_1
+_LBB44_2:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $9896, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $9904, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -8(%rbp), %rax
+    jmp   _LBB43_0
+_LBB43_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_free_include_table:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## if-cond
+    movq  -8(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB46_3
+## if-then
+    jmp   _LBB45_0
+    jmp   _LBB46_2
+## if-else
+_LBB46_3:
+_LBB46_2:
+## for-pre
+## assign
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB47_1:
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $1237, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB47_2
+## for-body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## while-cond
+_LBB48_4:
+    movq  -24(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB48_2
+## while-body
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB48_4
+_LBB48_2:
+## for-post
+_LBB47_4:
+    leaq  -12(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB47_1
+_LBB47_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+_LBB45_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_insert_include_file:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _strlen
+    addq  $16, %rsp
+    pushq %rax
+    movl  $1024, %eax
+    movslq %eax, %rax
+    movq  %rax, %rdx
+    popq  %rax
+    cmpq  %rdx, %rax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB50_3
+## if-then
+    subq  $16, %rsp
+    leaq  _buf_834(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcpy
+    addq  $16, %rsp
+    subq  $16, %rsp
+    leaq  _buf_834(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _normalize_path
+    addq  $16, %rsp
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    leaq  _buf_834(%rip), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB50_2
+## if-else
+_LBB50_3:
+_LBB50_2:
+## assign
+    leaq  -36(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _hash_fn
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _strlen
+    addq  $8, %rsp
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-pre
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -36(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB51_1:
+    movq  -32(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB51_2
+## for-body
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -32(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB52_3
+## if-then
+    movq  -32(%rbp), %rax
+    jmp   _LBB49_0
+    jmp   _LBB52_2
+## if-else
+_LBB52_3:
+_LBB52_2:
+## for-post
+_LBB51_4:
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB51_1
+_LBB51_2:
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movl  $48, %eax
+    movslq %eax, %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _malloc
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -32(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    subq  $8, %rsp
+    movl  $1, %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  -48(%rbp), %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _malloc
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $32, %rsp
+    movq  -32(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -48(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _strncpy
+    addq  $32, %rsp
+## assign
+    movq  -32(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -32(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -32(%rbp), %rax
+    addq  $20, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -32(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -32(%rbp), %rax
+    addq  $40, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -32(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -36(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -36(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -32(%rbp), %rax
+    jmp   _LBB49_0
+_LBB49_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_add_read_file:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## if-cond
+    movq  -16(%rbp), %rax
+    addq  $32, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    je    _LBB54_3
+## if-then
+    jmp   _LBB53_0
+    jmp   _LBB54_2
+## if-else
+_LBB54_3:
+_LBB54_2:
+## assign
+    movq  -16(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $9904, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    je    _LBB55_3
+## if-then
+## assign
+    movq  -8(%rbp), %rax
+    addq  $9904, %rax
+    movq  (%rax), %rax
+    addq  $40, %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB55_2
+## if-else
+_LBB55_3:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $9896, %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+_LBB55_2:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $9904, %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+_LBB53_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_new_include_profile:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $0, %rsp
+## func params
+## func body
+    subq  $16, %rsp
+    movl  $1, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movl  $40, %eax
+    movslq %eax, %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _calloc
+    addq  $16, %rsp
+    jmp   _LBB56_0
+_LBB56_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_free_include_profile:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## if-cond
+    movq  -8(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB58_3
+## if-then
+    jmp   _LBB57_0
+    jmp   _LBB58_2
+## if-else
+_LBB58_3:
+_LBB58_2:
+## for-pre
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB59_1:
+    movq  -16(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB59_2
+## for-body
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $40, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+## for-post
+_LBB59_4:
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB59_1
+_LBB59_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+_LBB57_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_add_include_record:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movq  %rdx, -24(%rbp)
+## func body
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $80, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $1, %eax
+    movslq %eax, %rax
+    movq  %rax, 16(%rsp)
+    movl  $48, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _calloc
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -40(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -40(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+## cond-?
+    movq  -8(%rbp), %rax
+    addq  $128, %rax
+    movq  (%rax), %rax
+    cmpl  $0, %eax
+    je    _LBB61_3
+## cond-then
+    movq  -8(%rbp), %rax
+    addq  $128, %rax
+    movq  (%rax), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    jmp   _LBB61_2
+## cond-else
+_LBB61_3:
+    movl  $0, %eax
+_LBB61_2:
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -40(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -32(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    je    _LBB62_3
+## if-then
+## assign
+    movq  -32(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $40, %rax
+    pushq %rax
+    movq  -40(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB62_2
+## if-else
+_LBB62_3:
+## assign
+    movq  -32(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -40(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+_LBB62_2:
+## assign
+    movq  -32(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movq  -40(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -40(%rbp), %rax
+    jmp   _LBB60_0
+_LBB60_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_now_microseconds:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+## func body
+    subq  $16, %rsp
+    movl  $6, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movl  8(%rsp), %edi
+    movq  (%rsp), %rsi
+    callq _clock_gettime
+    addq  $16, %rsp
+    leaq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $1000000, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    pushq %rax
+    leaq  -16(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $1000, %eax
+    movslq %eax, %rax
+    movq  %rax, %rdi
+    popq  %rax
+    cqto
+    idivq %rdi
+    popq  %rdx
+    addq  %rdx, %rax
+    jmp   _LBB63_0
+_LBB63_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_mark_profile:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## assign
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    subq  $8, %rsp
+    callq _now_microseconds
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+_LBB64_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_switch_record:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movq  %rdx, -24(%rbp)
+## func body
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    je    _LBB66_3
+## if-then
+## add-assign
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    addq  $24, %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    popq  %rdx
+    addq  %rax, (%rdx)
+    movq  (%rdx), %rax
+## add-assign
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    addq  $32, %rax
+    pushq %rax
+    subq  $8, %rsp
+    callq _now_microseconds
+    addq  $8, %rsp
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    popq  %rdx
+    addq  %rax, (%rdx)
+    movq  (%rdx), %rax
+    jmp   _LBB66_2
+## if-else
+_LBB66_3:
+_LBB66_2:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _mark_profile
+    addq  $16, %rsp
+_LBB65_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _new_preprocessor
+_new_preprocessor:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+## func body
+## assign
+    leaq  -8(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movl  $152, %eax
+    movslq %eax, %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _malloc
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    subq  $8, %rsp
+    movl  $24, %eax
+    movslq %eax, %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _malloc
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movl  $1024, %eax
+    pushq %rax
+    movl  $16, %eax
+    popq  %rdx
+    imull %edx, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    pushq %rax
+    movl  $1, %eax
+    movl  %eax, %edx
+    popq  %rax
+    subl  %edx, %eax
+    movslq %eax, %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strbuf_init
+    addq  $16, %rsp
+## assign
+    movq  -8(%rbp), %rax
+    addq  $40, %rax
+    pushq %rax
+    subq  $8, %rsp
+    callq _new_macro_table
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $48, %rax
+    pushq %rax
+    subq  $8, %rsp
+    callq _new_include_table
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $56, %rax
+    pushq %rax
+    subq  $8, %rsp
+    callq _new_source_map
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $64, %rax
+    pushq %rax
+    subq  $8, %rsp
+    callq _new_macro_cache
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $80, %rax
+    pushq %rax
+    subq  $8, %rsp
+    callq _new_include_profile
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $88, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $28, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $96, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $104, %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $108, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $112, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $116, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $120, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $136, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $128, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $144, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $72, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $76, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    movq  -8(%rbp), %rax
+    jmp   _LBB67_0
+_LBB67_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _free_preprocessor
+_free_preprocessor:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## if-cond
+    movq  -8(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB69_3
+## if-then
+    jmp   _LBB68_0
+    jmp   _LBB69_2
+## if-else
+_LBB69_3:
+_LBB69_2:
+## for-pre
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $136, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB70_1:
+    movq  -16(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB70_2
+## for-body
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $136, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-pre
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $120, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB71_1:
+    movq  -32(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB71_2
+## for-body
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -32(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+## for-post
+_LBB71_4:
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -40(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB71_1
+_LBB71_2:
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+## for-post
+_LBB70_4:
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB70_1
+_LBB70_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _strbuf_free
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $40, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free_macro_table
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $48, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free_include_table
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $56, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free_source_map
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $64, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free_macro_cache
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $80, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free_include_profile
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+_LBB68_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _print_include_tree
+_print_include_tree:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+    subq  $48, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 40(%rsp)
+    leaq  _L_str_924(%rip), %rax
+    movq  %rax, 32(%rsp)
+    leaq  _L_str_925(%rip), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_926(%rip), %rax
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_927(%rip), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_928(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  40(%rsp), %rdi
+    movq  32(%rsp), %rsi
+    movq  24(%rsp), %rdx
+    movq  16(%rsp), %rcx
+    movq  8(%rsp), %r8
+    movq  (%rsp), %r9
+    movb  $0, %al
+    callq _fprintf
+    addq  $48, %rsp
+## for-pre
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $80, %rax
+    movq  (%rax), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB73_1:
+    movq  -24(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB73_2
+## for-body
+    subq  $48, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 40(%rsp)
+    leaq  _L_str_931(%rip), %rax
+    movq  %rax, 32(%rsp)
+    movq  -24(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    movq  -24(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  40(%rsp), %rdi
+    movq  32(%rsp), %rsi
+    movq  24(%rsp), %rdx
+    movq  16(%rsp), %rcx
+    movq  8(%rsp), %r8
+    movb  $0, %al
+    callq _fprintf
+    addq  $48, %rsp
+## for-pre
+## assign
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB74_1:
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB74_2
+## for-body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_932(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+## for-post
+_LBB74_4:
+    leaq  -28(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB74_1
+_LBB74_2:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_933(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+## for-post
+_LBB73_4:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    addq  $40, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB73_1
+_LBB73_2:
+_LBB72_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_sorted_macros:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -36(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-pre
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB76_1:
+    movl  -40(%rbp), %eax
+    pushq %rax
+    movl  $1237, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB76_2
+## for-body
+## for-pre
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $9896, %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -40(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB77_1:
+    movq  -32(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB77_2
+## for-body
+## if-cond
+    movq  -32(%rbp), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB78_3
+## if-then
+    leaq  -36(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB78_2
+## if-else
+_LBB78_3:
+_LBB78_2:
+## for-post
+_LBB77_4:
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB77_1
+_LBB77_2:
+## for-post
+_LBB76_4:
+    leaq  -40(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB76_1
+_LBB76_2:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movl  $8, %eax
+    pushq %rax
+## cond-?
+    movl  -36(%rbp), %eax
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB79_3
+## cond-then
+    movl  -36(%rbp), %eax
+    jmp   _LBB79_2
+## cond-else
+_LBB79_3:
+    movl  $1, %eax
+_LBB79_2:
+    popq  %rdx
+    imull %edx, %eax
+    movslq %eax, %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _malloc
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -36(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-pre
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB80_1:
+    movl  -40(%rbp), %eax
+    pushq %rax
+    movl  $1237, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB80_2
+## for-body
+## for-pre
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $9896, %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -40(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB81_1:
+    movq  -32(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB81_2
+## for-body
+## if-cond
+    movq  -32(%rbp), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB82_3
+## if-then
+    jmp   _LBB81_4
+    jmp   _LBB82_2
+## if-else
+_LBB82_3:
+_LBB82_2:
+## for-pre
+## assign
+    leaq  -44(%rbp), %rax
+    pushq %rax
+    movl  -36(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB83_1:
+    movl  -44(%rbp), %eax
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB84_2
+    movq  -24(%rbp), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -44(%rbp), %eax
+    pushq %rax
+    movl  $1, %eax
+    movl  %eax, %edx
+    popq  %rax
+    subl  %edx, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, %rdx
+    popq  %rax
+    cmpq  %rdx, %rax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB84_2
+    movl  $1, %eax
+_LBB84_2:
+    cmpl  $0, %eax
+    je    _LBB83_2
+## for-body
+## assign
+    movq  -24(%rbp), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -44(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -44(%rbp), %eax
+    pushq %rax
+    movl  $1, %eax
+    movl  %eax, %edx
+    popq  %rax
+    subl  %edx, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-post
+_LBB83_4:
+    leaq  -44(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    subl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB83_1
+_LBB83_2:
+## assign
+    movq  -24(%rbp), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -44(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    leaq  -36(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+## for-post
+_LBB81_4:
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB81_1
+_LBB81_2:
+## for-post
+_LBB80_4:
+    leaq  -40(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB80_1
+_LBB80_2:
+## assign
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movl  -36(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    movq  -24(%rbp), %rax
+    jmp   _LBB75_0
+_LBB75_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_print_macro_table:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    leaq  -20(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _sorted_macros
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $48, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 40(%rsp)
+    leaq  _L_str_961(%rip), %rax
+    movq  %rax, 32(%rsp)
+    leaq  _L_str_962(%rip), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_963(%rip), %rax
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_964(%rip), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_965(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  40(%rsp), %rdi
+    movq  32(%rsp), %rsi
+    movq  24(%rsp), %rdx
+    movq  16(%rsp), %rcx
+    movq  8(%rsp), %r8
+    movq  (%rsp), %r9
+    movb  $0, %al
+    callq _fprintf
+    addq  $48, %rsp
+## for-pre
+## assign
+    leaq  -36(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB86_1:
+    movl  -36(%rbp), %eax
+    pushq %rax
+    movl  -20(%rbp), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB86_2
+## for-body
+    subq  $48, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 40(%rsp)
+    leaq  _L_str_966(%rip), %rax
+    movq  %rax, 32(%rsp)
+    movq  -32(%rbp), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -36(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    movq  -32(%rbp), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -36(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    movl  %eax, 16(%rsp)
+    movq  -32(%rbp), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -36(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  -32(%rbp), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -36(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    addq  $24, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movq  40(%rsp), %rdi
+    movq  32(%rsp), %rsi
+    movq  24(%rsp), %rdx
+    movl  16(%rsp), %ecx
+    movq  8(%rsp), %r8
+    movl  (%rsp), %r9d
+    movb  $0, %al
+    callq _fprintf
+    addq  $48, %rsp
+## for-post
+_LBB86_4:
+    leaq  -36(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB86_1
+_LBB86_2:
+    subq  $16, %rsp
+    movq  -32(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+_LBB85_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _print_preprocessor_stats
+_print_preprocessor_stats:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _print_include_tree
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_974(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $40, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _print_macro_table
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_974(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $64, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _print_macro_cache_stats
+    addq  $16, %rsp
+_LBB87_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_print_json_string:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_982(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+## for-pre
+## for-cond
+_LBB89_1:
+    movq  -16(%rbp), %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    je    _LBB89_2
+## for-body
+## if-cond
+    movq  -16(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $34, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB91_2
+    movq  -16(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $92, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB91_2
+    movl  $0, %eax
+_LBB91_2:
+    cmpl  $0, %eax
+    je    _LBB90_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_984(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+    jmp   _LBB90_2
+## if-else
+_LBB90_3:
+## if-cond
+    movq  -16(%rbp), %rax
+    movb  (%rax), %al
+    movzbl %al, %eax
+    pushq %rax
+    movl  $32, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB92_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_985(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+    jmp   _LBB92_2
+## if-else
+_LBB92_3:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_986(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+_LBB92_2:
+_LBB90_2:
+## for-post
+_LBB89_4:
+    leaq  -16(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    jmp   _LBB89_1
+_LBB89_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_982(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+_LBB88_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _print_preprocessor_stats_json
+_print_preprocessor_stats_json:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -16(%rbp), %rax
+    addq  $40, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    leaq  -28(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _sorted_macros
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_999(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+## for-pre
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $80, %rax
+    movq  (%rax), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB94_1:
+    movq  -24(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB94_2
+## for-body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+## cond-?
+    movq  -24(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $80, %rax
+    movq  (%rax), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpq  $0, %rax
+    je    _LBB95_3
+## cond-then
+    leaq  _L_str_1001(%rip), %rax
+    jmp   _LBB95_2
+## cond-else
+_LBB95_3:
+    leaq  _L_str_1002(%rip), %rax
+_LBB95_2:
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1003(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _print_json_string
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_1004(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    movl  %eax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    movq  (%rsp), %rcx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_1005(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movq  (%rsp), %rcx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+## for-post
+_LBB94_4:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    addq  $40, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB94_1
+_LBB94_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1007(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+## for-pre
+## assign
+    leaq  -44(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB96_1:
+    movl  -44(%rbp), %eax
+    pushq %rax
+    movl  -28(%rbp), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB96_2
+## for-body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+## cond-?
+    movl  -44(%rbp), %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpq  $0, %rax
+    je    _LBB97_3
+## cond-then
+    leaq  _L_str_1001(%rip), %rax
+    jmp   _LBB97_2
+## cond-else
+_LBB97_3:
+    leaq  _L_str_1002(%rip), %rax
+_LBB97_2:
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1009(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -40(%rbp), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -44(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _print_json_string
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_1010(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  -40(%rbp), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -44(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    movl  %eax, 8(%rsp)
+    movq  -40(%rbp), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -44(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    movq  (%rsp), %rcx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_1011(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  -40(%rbp), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -44(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    addq  $24, %rax
+    movl  (%rax), %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+## for-post
+_LBB96_4:
+    leaq  -44(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB96_1
+_LBB96_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1013(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $64, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _print_macro_cache_stats_json
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1014(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -40(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+_LBB93_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _get_source_map
+_get_source_map:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## if-cond
+    movq  -8(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB99_3
+## if-then
+    movl  $0, %eax
+    jmp   _LBB98_0
+    jmp   _LBB99_2
+## if-else
+_LBB99_3:
+_LBB99_2:
+    movq  -8(%rbp), %rax
+    addq  $56, %rax
+    movq  (%rax), %rax
+    jmp   _LBB98_0
+_LBB98_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_print_line_marker:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+    subq  $32, %rsp
+    leaq  _L_str_1027(%rip), %rax
+    movq  %rax, 24(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    movl  %eax, 16(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _printf
+    addq  $32, %rsp
+_LBB100_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _print_text
+_print_text:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $56, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## while-cond
+_LBB102_4:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _read_text
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB102_2
+## while-body
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -36(%rbp), %rax
+    pushq %rax
+    movl  -32(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-pre
+## for-cond
+_LBB103_1:
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB104_2
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $16, %eax
+    pushq %rax
+    movl  -28(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB104_2
+    movl  $1, %eax
+_LBB104_2:
+    cmpl  $0, %eax
+    je    _LBB103_2
+## for-body
+## local scalar init
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $16, %eax
+    pushq %rax
+    movl  -28(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $32, %rsp
+    movq  -24(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  -36(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  -32(%rbp), %eax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    movq  %rax, 24(%rsp)
+    movl  $1, %eax
+    movslq %eax, %rax
+    movq  %rax, 16(%rsp)
+    movq  -48(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  -36(%rbp), %eax
+    movl  %eax, %edx
+    popq  %rax
+    subl  %edx, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  ___stdoutp@GOTPCREL(%rip), %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movq  (%rsp), %rcx
+    callq _fwrite
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -48(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _print_line_marker
+    addq  $16, %rsp
+## assign
+    leaq  -36(%rbp), %rax
+    pushq %rax
+    movq  -48(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-post
+_LBB103_4:
+    leaq  -28(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB103_1
+_LBB103_2:
+    subq  $16, %rsp
+    leaq  _L_str_1043(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  -36(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  -32(%rbp), %eax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _printf
+    addq  $16, %rsp
+    jmp   _LBB102_4
+_LBB102_2:
+## for-pre
+## for-cond
+_LBB105_1:
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB105_2
+## for-body
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $16, %eax
+    pushq %rax
+    movl  -28(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _print_line_marker
+    addq  $16, %rsp
+## for-post
+_LBB105_4:
+    leaq  -28(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB105_1
+_LBB105_2:
+_LBB101_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_error_:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  ___stderrp@GOTPCREL(%rip), %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1052(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  ___stderrp@GOTPCREL(%rip), %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_1053(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $96, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  ___stderrp@GOTPCREL(%rip), %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_1054(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $104, %rax
+    movl  (%rax), %eax
+    movl  %eax, 8(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $108, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    movl  (%rsp), %ecx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  ___stderrp@GOTPCREL(%rip), %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1055(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  ___stderrp@GOTPCREL(%rip), %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_1056(%rip), %rax
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_1057(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  ___stderrp@GOTPCREL(%rip), %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1058(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  ___stderrp@GOTPCREL(%rip), %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_933(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  ___stderrp@GOTPCREL(%rip), %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1059(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $144, %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+_LBB106_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_is_skipping:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+    movq  -8(%rbp), %rax
+    addq  $116, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setg  %al
+    movzbl %al, %eax
+    jmp   _LBB107_0
+_LBB107_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_writec:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movb  %sil, -9(%rbp)
+## func body
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_skipping
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB110_2
+    movb  -9(%rbp), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $10, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB110_2
+    movl  $0, %eax
+_LBB110_2:
+    cmpl  $0, %eax
+    je    _LBB109_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movb  -9(%rbp), %al
+    movb  %al, (%rsp)
+    movq  8(%rsp), %rdi
+    movb  (%rsp), %sil
+    callq _strbuf_append_char
+    addq  $16, %rsp
+    jmp   _LBB109_2
+## if-else
+_LBB109_3:
+_LBB109_2:
+_LBB108_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_writes:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_skipping
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB112_3
+## if-then
+## for-pre
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB113_1:
+    movq  -24(%rbp), %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    je    _LBB113_2
+## for-body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    movb  (%rax), %al
+    movb  %al, (%rsp)
+    movq  8(%rsp), %rdi
+    movb  (%rsp), %sil
+    callq _strbuf_append_char
+    addq  $16, %rsp
+## for-post
+_LBB113_4:
+    leaq  -24(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    jmp   _LBB113_1
+_LBB113_2:
+    jmp   _LBB112_2
+## if-else
+_LBB112_3:
+_LBB112_2:
+_LBB111_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_text_offset:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+    movq  -8(%rbp), %rax
+    addq  $56, %rax
+    movq  (%rax), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    jmp   _LBB114_0
+_LBB114_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_mark_line:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_skipping
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB116_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    addq  $56, %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _text_offset
+    addq  $16, %rsp
+    movl  %eax, 16(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $104, %rax
+    movl  (%rax), %eax
+    movl  %eax, 8(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $96, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movq  (%rsp), %rcx
+    callq _add_line_marker
+    addq  $32, %rsp
+    jmp   _LBB116_2
+## if-else
+_LBB116_3:
+_LBB116_2:
+_LBB115_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_mark_column:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $32, %eax
+    movb  %al, (%rsp)
+    movq  8(%rsp), %rdi
+    movb  (%rsp), %sil
+    callq _writec
+    addq  $16, %rsp
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_skipping
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB118_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    addq  $56, %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _text_offset
+    addq  $16, %rsp
+    movl  %eax, 16(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $108, %rax
+    movl  (%rax), %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _add_column_marker
+    addq  $32, %rsp
+    jmp   _LBB118_2
+## if-else
+_LBB118_3:
+_LBB118_2:
+_LBB117_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_getc_:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+    movq  -8(%rbp), %rax
+    addq  $108, %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $28, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB120_3
+## if-then
+    movq  -8(%rbp), %rax
+    addq  $28, %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    subl  $1, %ecx
+    movl  %ecx, (%rdx)
+## assign
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    movl  $10, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB120_2
+## if-else
+_LBB120_3:
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB121_3
+## if-then
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    jmp   _LBB119_0
+    jmp   _LBB121_2
+## if-else
+_LBB121_3:
+## assign
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    movb  (%rax), %al
+    movzbl %al, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+_LBB121_2:
+_LBB120_2:
+## if-cond
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $10, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB122_3
+## if-then
+    movq  -8(%rbp), %rax
+    addq  $104, %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $112, %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $108, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $108, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB122_2
+## if-else
+_LBB122_3:
+_LBB122_2:
+    movl  -12(%rbp), %eax
+    jmp   _LBB119_0
+_LBB119_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_ungetc_:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+## func body
+## if-cond
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $10, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB124_3
+## if-then
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, %rdx
+    popq  %rax
+    cmpq  %rdx, %rax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB126_2
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $10, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB126_2
+    movl  $1, %eax
+_LBB126_2:
+    cmpl  $0, %eax
+    je    _LBB125_3
+## if-then
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    subq  $1, %rcx
+    movq  %rcx, (%rdx)
+    jmp   _LBB125_2
+## if-else
+_LBB125_3:
+    movq  -8(%rbp), %rax
+    addq  $28, %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+_LBB125_2:
+    movq  -8(%rbp), %rax
+    addq  $104, %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    subl  $1, %ecx
+    movl  %ecx, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $108, %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $112, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB124_2
+## if-else
+_LBB124_3:
+## if-cond
+    movl  -12(%rbp), %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB127_3
+## if-then
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    subq  $1, %rcx
+    movq  %rcx, (%rdx)
+    jmp   _LBB127_2
+## if-else
+_LBB127_3:
+_LBB127_2:
+    movq  -8(%rbp), %rax
+    addq  $108, %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    subl  $1, %ecx
+    movl  %ecx, (%rdx)
+_LBB124_2:
+_LBB123_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_readc:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## while-cond
+_LBB129_4:
+    movq  -8(%rbp), %rax
+    addq  $28, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB131_2
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $92, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB131_2
+    movl  $1, %eax
+_LBB131_2:
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB130_2
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $10, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB130_2
+    movl  $1, %eax
+_LBB130_2:
+    cmpl  $0, %eax
+    je    _LBB129_2
+## while-body
+## add-assign
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    addq  %rax, (%rdx)
+    movq  (%rdx), %rax
+    movq  -8(%rbp), %rax
+    addq  $104, %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $112, %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $108, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $108, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB129_4
+_LBB129_2:
+## assign
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _getc_
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $10, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB133_2
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB133_2
+    movl  $1, %eax
+_LBB133_2:
+    cmpl  $0, %eax
+    je    _LBB132_3
+## if-then
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    subl  $1, %ecx
+    movl  %ecx, (%rdx)
+    movq  -8(%rbp), %rax
+    addq  $28, %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB132_2
+## if-else
+_LBB132_3:
+_LBB132_2:
+    movl  -12(%rbp), %eax
+    jmp   _LBB128_0
+_LBB128_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_unreadc:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -12(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _ungetc_
+    addq  $16, %rsp
+_LBB134_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_is_whitespaces:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movl  %edi, -4(%rbp)
+## func body
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  $32, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB138_2
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  $9, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB138_2
+    movl  $0, %eax
+_LBB138_2:
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB137_2
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  $11, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB137_2
+    movl  $0, %eax
+_LBB137_2:
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB136_2
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  $12, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB136_2
+    movl  $0, %eax
+_LBB136_2:
+    jmp   _LBB135_0
+_LBB135_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_is_macroname:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movl  %edi, -4(%rbp)
+## func body
+    subq  $16, %rsp
+    movl  -4(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _isalnum
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB141_2
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  $95, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB141_2
+    movl  $0, %eax
+_LBB141_2:
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB140_2
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  $36, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB140_2
+    movl  $0, %eax
+_LBB140_2:
+    jmp   _LBB139_0
+_LBB139_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_new_token:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movl  %edi, -4(%rbp)
+    movq  %rsi, -16(%rbp)
+    movq  %rdx, -24(%rbp)
+    movl  %ecx, -28(%rbp)
+    movl  %r8d, -32(%rbp)
+## func body
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  -32(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    movl  $40, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _arena_alloc
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  -32(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _arena_alloc
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $32, %rsp
+    movq  -48(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _memcpy
+    addq  $32, %rsp
+## assign
+    movq  -48(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## assign
+    movq  -40(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  -4(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -40(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movq  -48(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -40(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movl  -28(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -40(%rbp), %rax
+    addq  $20, %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -40(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -40(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -40(%rbp), %rax
+    jmp   _LBB142_0
+_LBB142_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_is_ident_start:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movl  %edi, -4(%rbp)
+## func body
+    subq  $16, %rsp
+    movl  -4(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _isalpha
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB145_2
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  $95, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB145_2
+    movl  $0, %eax
+_LBB145_2:
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB144_2
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  $36, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB144_2
+    movl  $0, %eax
+_LBB144_2:
+    jmp   _LBB143_0
+_LBB143_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_token_kind:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _is_ident_start
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB147_3
+## if-then
+    movl  $0, %eax
+    jmp   _LBB146_0
+    jmp   _LBB147_2
+## if-else
+_LBB147_3:
+_LBB147_2:
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _isdigit
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB149_2
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $46, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB150_2
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _isdigit
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB150_2
+    movl  $1, %eax
+_LBB150_2:
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB149_2
+    movl  $0, %eax
+_LBB149_2:
+    cmpl  $0, %eax
+    je    _LBB148_3
+## if-then
+    movl  $1, %eax
+    jmp   _LBB146_0
+    jmp   _LBB148_2
+## if-else
+_LBB148_3:
+_LBB148_2:
+## if-cond
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $34, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB152_2
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $39, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB152_2
+    movl  $0, %eax
+_LBB152_2:
+    cmpl  $0, %eax
+    je    _LBB151_3
+## if-then
+    movl  $2, %eax
+    jmp   _LBB146_0
+    jmp   _LBB151_2
+## if-else
+_LBB151_3:
+_LBB151_2:
+    movl  $3, %eax
+    jmp   _LBB146_0
+_LBB146_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_punctuator_length:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## for-pre
+## assign
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB154_1:
+    leaq  _punctuators_1225(%rip), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    je    _LBB154_2
+## for-body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    leaq  _punctuators_1225(%rip), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## while-cond
+_LBB155_4:
+    movq  -24(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  -28(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    movl  $0, %eax
+    je    _LBB156_2
+    movq  -24(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  -28(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  -28(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB156_2
+    movl  $1, %eax
+_LBB156_2:
+    cmpl  $0, %eax
+    je    _LBB155_2
+## while-body
+    leaq  -28(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB155_4
+_LBB155_2:
+## if-cond
+    movq  -24(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  -28(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB157_3
+## if-then
+    movl  -28(%rbp), %eax
+    jmp   _LBB153_0
+    jmp   _LBB157_2
+## if-else
+_LBB157_3:
+_LBB157_2:
+## for-post
+_LBB154_4:
+    leaq  -12(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB154_1
+_LBB154_2:
+    movl  $1, %eax
+    jmp   _LBB153_0
+_LBB153_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_scan_pp_token:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _is_ident_start
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB159_3
+## if-then
+## while-cond
+_LBB160_4:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _is_macroname
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB160_2
+## while-body
+    leaq  -8(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    jmp   _LBB160_4
+_LBB160_2:
+    jmp   _LBB159_2
+## if-else
+_LBB159_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _isdigit
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB162_2
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $46, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB163_2
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _isdigit
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB163_2
+    movl  $1, %eax
+_LBB163_2:
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB162_2
+    movl  $0, %eax
+_LBB162_2:
+    cmpl  $0, %eax
+    je    _LBB161_3
+## if-then
+## for-pre
+## for-cond
+_LBB164_1:
+    movl  $1, %eax
+    cmpl  $0, %eax
+    je    _LBB164_2
+## for-body
+## if-cond
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $101, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB167_2
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $69, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB167_2
+    movl  $0, %eax
+_LBB167_2:
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB166_2
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $43, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB168_2
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $45, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB168_2
+    movl  $0, %eax
+_LBB168_2:
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB166_2
+    movl  $1, %eax
+_LBB166_2:
+    cmpl  $0, %eax
+    je    _LBB165_3
+## if-then
+## add-assign
+    leaq  -8(%rbp), %rax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    addq  %rax, (%rdx)
+    movq  (%rdx), %rax
+    jmp   _LBB165_2
+## if-else
+_LBB165_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _is_macroname
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB170_2
+    movq  -8(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $46, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB170_2
+    movl  $0, %eax
+_LBB170_2:
+    cmpl  $0, %eax
+    je    _LBB169_3
+## if-then
+    leaq  -8(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    jmp   _LBB169_2
+## if-else
+_LBB169_3:
+    jmp   _LBB164_2
+_LBB169_2:
+_LBB165_2:
+## for-post
+_LBB164_4:
+    jmp   _LBB164_1
+_LBB164_2:
+    jmp   _LBB161_2
+## if-else
+_LBB161_3:
+## if-cond
+    movq  -8(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $34, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB172_2
+    movq  -8(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $39, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB172_2
+    movl  $0, %eax
+_LBB172_2:
+    cmpl  $0, %eax
+    je    _LBB171_3
+## if-then
+## local scalar init
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    leaq  -8(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    movb  (%rax), %al
+    movsbl %al, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## while-cond
+_LBB173_4:
+    movq  -8(%rbp), %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    movl  $0, %eax
+    je    _LBB175_2
+    movq  -8(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB175_2
+    movl  $1, %eax
+_LBB175_2:
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB174_2
+    movq  -8(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $10, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB174_2
+    movl  $1, %eax
+_LBB174_2:
+    cmpl  $0, %eax
+    je    _LBB173_2
+## while-body
+## if-cond
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $92, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB177_2
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    movl  $0, %eax
+    je    _LBB177_2
+    movl  $1, %eax
+_LBB177_2:
+    cmpl  $0, %eax
+    je    _LBB176_3
+## if-then
+    leaq  -8(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    jmp   _LBB176_2
+## if-else
+_LBB176_3:
+_LBB176_2:
+    leaq  -8(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    jmp   _LBB173_4
+_LBB173_2:
+## if-cond
+    movq  -8(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB178_3
+## if-then
+    leaq  -8(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    jmp   _LBB178_2
+## if-else
+_LBB178_3:
+_LBB178_2:
+    jmp   _LBB171_2
+## if-else
+_LBB171_3:
+## add-assign
+    leaq  -8(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _punctuator_length
+    addq  $8, %rsp
+    popq  %rdx
+    addq  %rax, (%rdx)
+    movq  (%rdx), %rax
+_LBB171_2:
+_LBB161_2:
+_LBB159_2:
+    movq  -8(%rbp), %rax
+    jmp   _LBB158_0
+_LBB158_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_tokenize_text:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $96, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+    movq  %rdx, -24(%rbp)
+## func body
+## local scalar init
+    leaq  -64(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -64(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    popq  %rax
+    movq  $0, %rdx
+    movq  %rdx, (%rax)
+## local scalar init
+    leaq  -64(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -64(%rbp), %rax
+    addq  $20, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -64(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    popq  %rax
+    movq  $0, %rdx
+    movq  %rdx, (%rax)
+## local scalar init
+    leaq  -64(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    popq  %rax
+    movq  $0, %rdx
+    movq  %rdx, (%rax)
+## local scalar init
+    leaq  -72(%rbp), %rax
+    pushq %rax
+    leaq  -64(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -80(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -84(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## while-cond
+_LBB180_4:
+    movq  -80(%rbp), %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    je    _LBB180_2
+## while-body
+## local scalar init
+    leaq  -96(%rbp), %rax
+    pushq %rax
+    movq  -80(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -80(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _is_whitespaces
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB182_2
+    movq  -80(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $10, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB182_2
+    movl  $0, %eax
+_LBB182_2:
+    cmpl  $0, %eax
+    je    _LBB181_3
+## if-then
+## if-cond
+    movq  -80(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $10, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB184_2
+    movq  -24(%rbp), %rax
+    cmpq  $0, %rax
+    movl  $0, %eax
+    je    _LBB184_2
+    movl  $1, %eax
+_LBB184_2:
+    cmpl  $0, %eax
+    je    _LBB183_3
+## if-then
+    movq  -24(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB183_2
+## if-else
+_LBB183_3:
+_LBB183_2:
+## assign
+    leaq  -84(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    leaq  -80(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    jmp   _LBB180_4
+    jmp   _LBB181_2
+## if-else
+_LBB181_3:
+_LBB181_2:
+## if-cond
+    movq  -80(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $47, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB186_2
+    movq  -80(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $42, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB186_2
+    movl  $1, %eax
+_LBB186_2:
+    cmpl  $0, %eax
+    je    _LBB185_3
+## if-then
+## for-pre
+## add-assign
+    leaq  -80(%rbp), %rax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    addq  %rax, (%rdx)
+    movq  (%rdx), %rax
+## for-cond
+_LBB187_1:
+    movq  -80(%rbp), %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    movl  $0, %eax
+    je    _LBB188_2
+    movq  -80(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $42, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB189_2
+    movq  -80(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $47, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB189_2
+    movl  $1, %eax
+_LBB189_2:
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB188_2
+    movl  $1, %eax
+_LBB188_2:
+    cmpl  $0, %eax
+    je    _LBB187_2
+## for-body
+## if-cond
+    movq  -80(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $10, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB191_2
+    movq  -24(%rbp), %rax
+    cmpq  $0, %rax
+    movl  $0, %eax
+    je    _LBB191_2
+    movl  $1, %eax
+_LBB191_2:
+    cmpl  $0, %eax
+    je    _LBB190_3
+## if-then
+    movq  -24(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB190_2
+## if-else
+_LBB190_3:
+_LBB190_2:
+## for-post
+_LBB187_4:
+    leaq  -80(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    jmp   _LBB187_1
+_LBB187_2:
+## if-cond
+    movq  -80(%rbp), %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    je    _LBB192_3
+## if-then
+## add-assign
+    leaq  -80(%rbp), %rax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    addq  %rax, (%rdx)
+    movq  (%rdx), %rax
+    jmp   _LBB192_2
+## if-else
+_LBB192_3:
+_LBB192_2:
+## assign
+    leaq  -84(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB180_4
+    jmp   _LBB185_2
+## if-else
+_LBB185_3:
+_LBB185_2:
+## if-cond
+    movq  -80(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $47, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB194_2
+    movq  -80(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $47, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB194_2
+    movl  $1, %eax
+_LBB194_2:
+    cmpl  $0, %eax
+    je    _LBB193_3
+## if-then
+## while-cond
+_LBB195_4:
+    movq  -80(%rbp), %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    movl  $0, %eax
+    je    _LBB196_2
+    movq  -80(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $10, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB196_2
+    movl  $1, %eax
+_LBB196_2:
+    cmpl  $0, %eax
+    je    _LBB195_2
+## while-body
+    leaq  -80(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    jmp   _LBB195_4
+_LBB195_2:
+## assign
+    leaq  -84(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB180_4
+    jmp   _LBB193_2
+## if-else
+_LBB193_3:
+_LBB193_2:
+## assign
+    leaq  -80(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -80(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _scan_pp_token
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -72(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    subq  $40, %rsp
+    subq  $16, %rsp
+    movq  -96(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _token_kind
+    addq  $16, %rsp
+    movl  %eax, 32(%rsp)
+    movq  -96(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -80(%rbp), %rax
+    pushq %rax
+    movq  -96(%rbp), %rax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    movq  %rax, 16(%rsp)
+    movl  -84(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  -12(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  32(%rsp), %edi
+    movq  24(%rsp), %rsi
+    movq  16(%rsp), %rdx
+    movl  8(%rsp), %ecx
+    movl  (%rsp), %r8d
+    callq _new_token
+    addq  $40, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -72(%rbp), %rax
+    pushq %rax
+    movq  -72(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -84(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB180_4
+_LBB180_2:
+    leaq  -64(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    jmp   _LBB179_0
+_LBB179_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_new_line:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _whitespaces
+    addq  $16, %rsp
+## assign
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _readc
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $10, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB198_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1305(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _error_
+    addq  $16, %rsp
+    jmp   _LBB198_2
+## if-else
+_LBB198_3:
+_LBB198_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -12(%rbp), %eax
+    movb  %al, (%rsp)
+    movq  8(%rsp), %rdi
+    movb  (%rsp), %sil
+    callq _writec
+    addq  $16, %rsp
+_LBB197_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_discard_line:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## do-while-body
+_LBB200_1:
+## assign
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _readc
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## do-while-cond
+_LBB200_4:
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $10, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB201_2
+    movl  -12(%rbp), %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB201_2
+    movl  $1, %eax
+_LBB201_2:
+    cmpl  $0, %eax
+    je    _LBB200_2
+    jmp   _LBB200_1
+_LBB200_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -12(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _unreadc
+    addq  $16, %rsp
+_LBB199_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_line_comment:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## for-pre
+## for-cond
+_LBB203_1:
+    movl  $1, %eax
+    cmpl  $0, %eax
+    je    _LBB203_2
+## for-body
+## local scalar init
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _readc
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $10, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB204_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -12(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _unreadc
+    addq  $16, %rsp
+    jmp   _LBB203_2
+    jmp   _LBB204_2
+## if-else
+_LBB204_3:
+_LBB204_2:
+## for-post
+_LBB203_4:
+    jmp   _LBB203_1
+_LBB203_2:
+_LBB202_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_block_comment:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## for-pre
+## for-cond
+_LBB206_1:
+    movl  $1, %eax
+    cmpl  $0, %eax
+    je    _LBB206_2
+## for-body
+## local scalar init
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _readc
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $42, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB207_3
+## if-then
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _readc
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  -16(%rbp), %eax
+    pushq %rax
+    movl  $47, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB208_3
+## if-then
+    jmp   _LBB206_2
+    jmp   _LBB208_2
+## if-else
+_LBB208_3:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -16(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _unreadc
+    addq  $16, %rsp
+_LBB208_2:
+    jmp   _LBB207_2
+## if-else
+_LBB207_3:
+## if-cond
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $10, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB209_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -12(%rbp), %eax
+    movb  %al, (%rsp)
+    movq  8(%rsp), %rdi
+    movb  (%rsp), %sil
+    callq _writec
+    addq  $16, %rsp
+    jmp   _LBB209_2
+## if-else
+_LBB209_3:
+## if-cond
+    movl  -12(%rbp), %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB210_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1340(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _error_
+    addq  $16, %rsp
+    jmp   _LBB206_2
+    jmp   _LBB210_2
+## if-else
+_LBB210_3:
+_LBB210_2:
+_LBB209_2:
+_LBB207_2:
+## for-post
+_LBB206_4:
+    jmp   _LBB206_1
+_LBB206_2:
+_LBB205_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_string_literal:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## for-pre
+## for-cond
+_LBB212_1:
+    movl  $1, %eax
+    cmpl  $0, %eax
+    je    _LBB212_2
+## for-body
+## local scalar init
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _readc
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $34, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB213_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -12(%rbp), %eax
+    movb  %al, (%rsp)
+    movq  8(%rsp), %rdi
+    movb  (%rsp), %sil
+    callq _writec
+    addq  $16, %rsp
+    jmp   _LBB212_2
+    jmp   _LBB213_2
+## if-else
+_LBB213_3:
+## if-cond
+    movl  -12(%rbp), %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB214_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1354(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _error_
+    addq  $16, %rsp
+    jmp   _LBB212_2
+    jmp   _LBB214_2
+## if-else
+_LBB214_3:
+## if-cond
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $92, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB215_3
+## if-then
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _readc
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -12(%rbp), %eax
+    movb  %al, (%rsp)
+    movq  8(%rsp), %rdi
+    movb  (%rsp), %sil
+    callq _writec
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -16(%rbp), %eax
+    movb  %al, (%rsp)
+    movq  8(%rsp), %rdi
+    movb  (%rsp), %sil
+    callq _writec
+    addq  $16, %rsp
+    jmp   _LBB215_2
+## if-else
+_LBB215_3:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -12(%rbp), %eax
+    movb  %al, (%rsp)
+    movq  8(%rsp), %rdi
+    movb  (%rsp), %sil
+    callq _writec
+    addq  $16, %rsp
+_LBB215_2:
+_LBB214_2:
+_LBB213_2:
+## for-post
+_LBB212_4:
+    jmp   _LBB212_1
+_LBB212_2:
+_LBB211_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_character_literal:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## for-pre
+## for-cond
+_LBB217_1:
+    movl  $1, %eax
+    cmpl  $0, %eax
+    je    _LBB217_2
+## for-body
+## local scalar init
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _readc
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $39, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB218_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -12(%rbp), %eax
+    movb  %al, (%rsp)
+    movq  8(%rsp), %rdi
+    movb  (%rsp), %sil
+    callq _writec
+    addq  $16, %rsp
+    jmp   _LBB217_2
+    jmp   _LBB218_2
+## if-else
+_LBB218_3:
+## if-cond
+    movl  -12(%rbp), %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB219_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1373(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _error_
+    addq  $16, %rsp
+    jmp   _LBB217_2
+    jmp   _LBB219_2
+## if-else
+_LBB219_3:
+## if-cond
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $92, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB220_3
+## if-then
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _readc
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -12(%rbp), %eax
+    movb  %al, (%rsp)
+    movq  8(%rsp), %rdi
+    movb  (%rsp), %sil
+    callq _writec
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -16(%rbp), %eax
+    movb  %al, (%rsp)
+    movq  8(%rsp), %rdi
+    movb  (%rsp), %sil
+    callq _writec
+    addq  $16, %rsp
+    jmp   _LBB220_2
+## if-else
+_LBB220_3:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -12(%rbp), %eax
+    movb  %al, (%rsp)
+    movq  8(%rsp), %rdi
+    movb  (%rsp), %sil
+    callq _writec
+    addq  $16, %rsp
+_LBB220_2:
+_LBB219_2:
+_LBB218_2:
+## for-post
+_LBB217_4:
+    jmp   _LBB217_1
+_LBB217_2:
+_LBB216_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_whitespaces:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## for-pre
+## for-cond
+_LBB222_1:
+    movl  $1, %eax
+    cmpl  $0, %eax
+    je    _LBB222_2
+## for-body
+## local scalar init
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _readc
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $47, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB223_3
+## if-then
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _readc
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  -16(%rbp), %eax
+    pushq %rax
+    movl  $42, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB224_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _block_comment
+    addq  $16, %rsp
+    jmp   _LBB222_4
+    jmp   _LBB224_2
+## if-else
+_LBB224_3:
+## if-cond
+    movl  -16(%rbp), %eax
+    pushq %rax
+    movl  $47, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB225_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _line_comment
+    addq  $16, %rsp
+    jmp   _LBB222_4
+    jmp   _LBB225_2
+## if-else
+_LBB225_3:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -16(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _unreadc
+    addq  $16, %rsp
+_LBB225_2:
+_LBB224_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -12(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _unreadc
+    addq  $16, %rsp
+    jmp   _LBB222_2
+    jmp   _LBB223_2
+## if-else
+_LBB223_3:
+_LBB223_2:
+## if-cond
+    subq  $16, %rsp
+    movl  -12(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _is_whitespaces
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB226_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -12(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _unreadc
+    addq  $16, %rsp
+    jmp   _LBB222_2
+    jmp   _LBB226_2
+## if-else
+_LBB226_3:
+_LBB226_2:
+## for-post
+_LBB222_4:
+    jmp   _LBB222_1
+_LBB222_2:
+_LBB221_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_token:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _whitespaces
+    addq  $16, %rsp
+## for-pre
+## for-cond
+_LBB228_1:
+    movl  $1, %eax
+    cmpl  $0, %eax
+    je    _LBB228_2
+## for-body
+## local scalar init
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _readc
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movl  -28(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _is_macroname
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB229_3
+## if-then
+## assign
+    leaq  -24(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    pushq %rax
+    movl  -28(%rbp), %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+    jmp   _LBB229_2
+## if-else
+_LBB229_3:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -28(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _unreadc
+    addq  $16, %rsp
+    jmp   _LBB228_2
+_LBB229_2:
+## for-post
+_LBB228_4:
+    jmp   _LBB228_1
+_LBB228_2:
+## assign
+    movq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+_LBB227_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_token_list:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _whitespaces
+    addq  $16, %rsp
+## for-pre
+## for-cond
+_LBB231_1:
+    movl  $1, %eax
+    cmpl  $0, %eax
+    je    _LBB231_2
+## for-body
+## local scalar init
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _readc
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movl  $10, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB232_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -28(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _unreadc
+    addq  $16, %rsp
+    jmp   _LBB231_2
+    jmp   _LBB232_2
+## if-else
+_LBB232_3:
+_LBB232_2:
+## assign
+    leaq  -24(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    pushq %rax
+    movl  -28(%rbp), %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## for-post
+_LBB231_4:
+    jmp   _LBB231_1
+_LBB231_2:
+## assign
+    movq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+_LBB230_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_read_file_path:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-pre
+## for-cond
+_LBB234_1:
+    movl  $1, %eax
+    cmpl  $0, %eax
+    je    _LBB234_2
+## for-body
+## local scalar init
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _readc
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movl  -28(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _isalnum
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB239_2
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movl  $95, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB239_2
+    movl  $0, %eax
+_LBB239_2:
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB238_2
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movl  $45, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB238_2
+    movl  $0, %eax
+_LBB238_2:
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB237_2
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movl  $46, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB237_2
+    movl  $0, %eax
+_LBB237_2:
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB236_2
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movl  $47, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB236_2
+    movl  $0, %eax
+_LBB236_2:
+    cmpl  $0, %eax
+    je    _LBB235_3
+## if-then
+## assign
+    leaq  -24(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    pushq %rax
+    movl  -28(%rbp), %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+    jmp   _LBB235_2
+## if-else
+_LBB235_3:
+## assign
+    movq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -28(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _unreadc
+    addq  $16, %rsp
+    jmp   _LBB234_2
+_LBB235_2:
+## for-post
+_LBB234_4:
+    jmp   _LBB234_1
+_LBB234_2:
+_LBB233_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_file_path:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _whitespaces
+    addq  $16, %rsp
+## assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _readc
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  -20(%rbp), %eax
+    pushq %rax
+    movl  $34, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB241_3
+## if-then
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $34, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB241_2
+## if-else
+_LBB241_3:
+## if-cond
+    movl  -20(%rbp), %eax
+    pushq %rax
+    movl  $60, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB242_3
+## if-then
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $62, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB242_2
+## if-else
+_LBB242_3:
+    jmp   _LBB240_1553
+_LBB242_2:
+_LBB241_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _read_file_path
+    addq  $16, %rsp
+## assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _readc
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  -20(%rbp), %eax
+    pushq %rax
+    movl  -24(%rbp), %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB243_3
+## if-then
+    jmp   _LBB240_1553
+    jmp   _LBB243_2
+## if-else
+_LBB243_3:
+_LBB243_2:
+    movl  -24(%rbp), %eax
+    pushq %rax
+    movl  $62, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    jmp   _LBB240_0
+_LBB240_1553:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1454(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _error_
+    addq  $16, %rsp
+    movl  $0, %eax
+    jmp   _LBB240_0
+_LBB240_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_include_line:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    leaq  _name_1461(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _file_path
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    addq  $96, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    leaq  _name_1461(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movl  (%rsp), %edx
+    callq _find_include_file
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -16(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB245_3
+## if-then
+    subq  $32, %rsp
+    leaq  _msg_1465(%rip), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_1466(%rip), %rax
+    movq  %rax, 16(%rsp)
+    leaq  _name_1461(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _sprintf
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _msg_1465(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _error_
+    addq  $16, %rsp
+    jmp   _LBB245_2
+## if-else
+_LBB245_3:
+_LBB245_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _new_line
+    addq  $16, %rsp
+## if-cond
+    movq  -16(%rbp), %rax
+    cmpq  $0, %rax
+    movl  $0, %eax
+    je    _LBB247_2
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _load_precompiled_header
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB247_2
+    movl  $1, %eax
+_LBB247_2:
+    cmpl  $0, %eax
+    je    _LBB246_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _push_file
+    addq  $16, %rsp
+    jmp   _LBB246_2
+## if-else
+_LBB246_3:
+_LBB246_2:
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $136, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB248_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _mark_line
+    addq  $16, %rsp
+    jmp   _LBB248_2
+## if-else
+_LBB248_3:
+_LBB248_2:
+_LBB244_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_directive_name:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movq  %rdx, -24(%rbp)
+## func body
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## while-cond
+_LBB250_4:
+    subq  $16, %rsp
+    movq  -32(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _is_whitespaces
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB250_2
+## while-body
+    leaq  -32(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    jmp   _LBB250_4
+_LBB250_2:
+## if-cond
+    movq  -32(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $35, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB251_3
+## if-then
+    movl  $0, %eax
+    jmp   _LBB249_0
+    jmp   _LBB251_2
+## if-else
+_LBB251_3:
+_LBB251_2:
+    leaq  -32(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+## while-cond
+_LBB252_4:
+    subq  $16, %rsp
+    movq  -32(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _is_whitespaces
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB252_2
+## while-body
+    leaq  -32(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    jmp   _LBB252_4
+_LBB252_2:
+## while-cond
+_LBB253_4:
+    subq  $16, %rsp
+    movq  -32(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _is_macroname
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB254_2
+    movq  -40(%rbp), %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    movq  %rax, %rdx
+    popq  %rax
+    cmpq  %rdx, %rax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB254_2
+    movl  $1, %eax
+_LBB254_2:
+    cmpl  $0, %eax
+    je    _LBB253_2
+## while-body
+## assign
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    pushq %rax
+    leaq  -40(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    leaq  -32(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    movb  (%rax), %al
+    popq  %rdx
+    movb  %al, (%rdx)
+    jmp   _LBB253_4
+_LBB253_2:
+## assign
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  -40(%rbp), %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+    movq  -32(%rbp), %rax
+    jmp   _LBB249_0
+_LBB249_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_find_comment_or_literal:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## for-pre
+## for-cond
+_LBB256_1:
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    movq  %rax, %rdx
+    popq  %rax
+    cmpq  %rdx, %rax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB256_2
+## for-body
+## if-cond
+    movq  -8(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $47, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB259_2
+    movq  -8(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $34, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB259_2
+    movl  $0, %eax
+_LBB259_2:
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB258_2
+    movq  -8(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $39, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB258_2
+    movl  $0, %eax
+_LBB258_2:
+    cmpl  $0, %eax
+    je    _LBB257_3
+## if-then
+    movq  -8(%rbp), %rax
+    jmp   _LBB255_0
+    jmp   _LBB257_2
+## if-else
+_LBB257_3:
+_LBB257_2:
+## for-post
+_LBB256_4:
+    leaq  -8(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    jmp   _LBB256_1
+_LBB256_2:
+    movl  $0, %eax
+    jmp   _LBB255_0
+_LBB255_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_skip_line:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $64, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movq  %rdx, -24(%rbp)
+## func body
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-pre
+## for-cond
+_LBB261_1:
+    movl  $1, %eax
+    cmpl  $0, %eax
+    je    _LBB261_2
+## for-body
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -32(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  $10, %eax
+    movl  %eax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    movq  %rax, (%rsp)
+    movq  16(%rsp), %rdi
+    movl  8(%rsp), %esi
+    movq  (%rsp), %rdx
+    callq _memchr
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -40(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB262_3
+## if-then
+    movq  -16(%rbp), %rax
+    jmp   _LBB260_0
+    jmp   _LBB262_2
+## if-else
+_LBB262_3:
+_LBB262_2:
+## assign
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -32(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -40(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _find_comment_or_literal
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -48(%rbp), %rax
+    cmpq  $0, %rax
+    movl  $0, %eax
+    je    _LBB264_2
+    movq  -48(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $34, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB265_2
+    movq  -48(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $39, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB265_2
+    movl  $0, %eax
+_LBB265_2:
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB264_2
+    movl  $1, %eax
+_LBB264_2:
+    cmpl  $0, %eax
+    je    _LBB263_3
+## if-then
+## local scalar init
+    leaq  -52(%rbp), %rax
+    pushq %rax
+    movq  -48(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-pre
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -48(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB266_1:
+    movq  -32(%rbp), %rax
+    pushq %rax
+    movq  -40(%rbp), %rax
+    movq  %rax, %rdx
+    popq  %rax
+    cmpq  %rdx, %rax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB267_2
+    movq  -32(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  -52(%rbp), %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB267_2
+    movl  $1, %eax
+_LBB267_2:
+    cmpl  $0, %eax
+    je    _LBB266_2
+## for-body
+## if-cond
+    movq  -32(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $92, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB269_2
+    movq  -32(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movq  -40(%rbp), %rax
+    movq  %rax, %rdx
+    popq  %rax
+    cmpq  %rdx, %rax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB269_2
+    movl  $1, %eax
+_LBB269_2:
+    cmpl  $0, %eax
+    je    _LBB268_3
+## if-then
+    leaq  -32(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    jmp   _LBB268_2
+## if-else
+_LBB268_3:
+_LBB268_2:
+## for-post
+_LBB266_4:
+    leaq  -32(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    jmp   _LBB266_1
+_LBB266_2:
+## if-cond
+    movq  -32(%rbp), %rax
+    pushq %rax
+    movq  -40(%rbp), %rax
+    movq  %rax, %rdx
+    popq  %rax
+    cmpq  %rdx, %rax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB270_3
+## if-then
+    leaq  -32(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    jmp   _LBB270_2
+## if-else
+_LBB270_3:
+_LBB270_2:
+    jmp   _LBB261_4
+    jmp   _LBB263_2
+## if-else
+_LBB263_3:
+_LBB263_2:
+## if-cond
+    movq  -48(%rbp), %rax
+    cmpq  $0, %rax
+    movl  $0, %eax
+    je    _LBB272_2
+    movq  -48(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $42, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB272_2
+    movl  $1, %eax
+_LBB272_2:
+    cmpl  $0, %eax
+    je    _LBB271_3
+## if-then
+## for-pre
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -48(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB273_1:
+    movq  -32(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    movq  %rax, %rdx
+    popq  %rax
+    cmpq  %rdx, %rax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB274_2
+    movq  -32(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $42, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB275_2
+    movq  -32(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $47, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB275_2
+    movl  $1, %eax
+_LBB275_2:
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB274_2
+    movl  $1, %eax
+_LBB274_2:
+    cmpl  $0, %eax
+    je    _LBB273_2
+## for-body
+## if-cond
+    movq  -32(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $10, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB276_3
+## if-then
+    movq  -24(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB276_2
+## if-else
+_LBB276_3:
+_LBB276_2:
+## for-post
+_LBB273_4:
+    leaq  -32(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    jmp   _LBB273_1
+_LBB273_2:
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+## cond-?
+    movq  -32(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    movq  %rax, %rdx
+    popq  %rax
+    cmpq  %rdx, %rax
+    setl  %al
+    movzbl %al, %eax
+    cmpq  $0, %rax
+    je    _LBB277_3
+## cond-then
+    movq  -32(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    jmp   _LBB277_2
+## cond-else
+_LBB277_3:
+    movq  -16(%rbp), %rax
+_LBB277_2:
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB261_4
+    jmp   _LBB271_2
+## if-else
+_LBB271_3:
+_LBB271_2:
+## if-cond
+    movq  -48(%rbp), %rax
+    cmpq  $0, %rax
+    movl  $0, %eax
+    je    _LBB279_2
+    movq  -48(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $47, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB279_2
+    movl  $1, %eax
+_LBB279_2:
+    cmpl  $0, %eax
+    je    _LBB278_3
+## if-then
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -48(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB261_4
+    jmp   _LBB278_2
+## if-else
+_LBB278_3:
+_LBB278_2:
+    movq  -24(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+## if-cond
+    movq  -40(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    movq  %rax, %rdx
+    popq  %rax
+    cmpq  %rdx, %rax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB281_2
+    movq  -40(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $92, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB281_2
+    movl  $1, %eax
+_LBB281_2:
+    cmpl  $0, %eax
+    je    _LBB280_3
+## if-then
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -40(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB261_4
+    jmp   _LBB280_2
+## if-else
+_LBB280_3:
+_LBB280_2:
+    movq  -40(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    jmp   _LBB260_0
+## for-post
+_LBB261_4:
+    jmp   _LBB261_1
+_LBB261_2:
+_LBB260_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_skip_inactive_lines:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## add-assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $28, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    addl  %eax, (%rdx)
+    movl  (%rdx), %eax
+## assign
+    movq  -8(%rbp), %rax
+    addq  $28, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## while-cond
+_LBB283_4:
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, %rdx
+    popq  %rax
+    cmpq  %rdx, %rax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB283_2
+## while-body
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    addq  $1, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    addq  $2, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    addq  $3, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    addq  $5, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    addq  $6, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    addq  $7, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    addq  $9, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    addq  $10, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    addq  $11, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    addq  $12, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    addq  $13, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    addq  $14, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    addq  $15, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## if-cond
+    subq  $32, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  -40(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  $16, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _directive_name
+    addq  $32, %rsp
+    cmpq  $0, %rax
+    je    _LBB284_3
+## if-then
+## if-cond
+    subq  $16, %rsp
+    leaq  -40(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1519(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB287_2
+    subq  $16, %rsp
+    leaq  -40(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1520(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB287_2
+    movl  $0, %eax
+_LBB287_2:
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB286_2
+    subq  $16, %rsp
+    leaq  -40(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1521(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB286_2
+    movl  $0, %eax
+_LBB286_2:
+    cmpl  $0, %eax
+    je    _LBB285_3
+## if-then
+    leaq  -24(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB285_2
+## if-else
+_LBB285_3:
+## if-cond
+    subq  $16, %rsp
+    leaq  -40(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1524(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB289_2
+    subq  $16, %rsp
+    leaq  -40(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1525(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB289_2
+    movl  $0, %eax
+_LBB289_2:
+    cmpl  $0, %eax
+    je    _LBB288_3
+## if-then
+## if-cond
+    movl  -24(%rbp), %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB290_3
+## if-then
+    jmp   _LBB283_2
+    jmp   _LBB290_2
+## if-else
+_LBB290_3:
+_LBB290_2:
+    jmp   _LBB288_2
+## if-else
+_LBB288_3:
+## if-cond
+    subq  $16, %rsp
+    leaq  -40(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1528(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB291_3
+## if-then
+## if-cond
+    movl  -24(%rbp), %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB292_3
+## if-then
+    jmp   _LBB283_2
+    jmp   _LBB292_2
+## if-else
+_LBB292_3:
+_LBB292_2:
+    leaq  -24(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    subl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB291_2
+## if-else
+_LBB291_3:
+_LBB291_2:
+_LBB288_2:
+_LBB285_2:
+    jmp   _LBB284_2
+## if-else
+_LBB284_3:
+_LBB284_2:
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  -20(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _skip_line
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB283_4
+_LBB283_2:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## add-assign
+    movq  -8(%rbp), %rax
+    addq  $104, %rax
+    pushq %rax
+    movl  -20(%rbp), %eax
+    popq  %rdx
+    addl  %eax, (%rdx)
+    movl  (%rdx), %eax
+## assign
+    movq  -8(%rbp), %rax
+    addq  $108, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-pre
+## for-cond
+_LBB293_1:
+    movl  -20(%rbp), %eax
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB293_2
+## for-body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $10, %eax
+    movb  %al, (%rsp)
+    movq  8(%rsp), %rdi
+    movb  (%rsp), %sil
+    callq _writec
+    addq  $16, %rsp
+## for-post
+_LBB293_4:
+    leaq  -20(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    subl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB293_1
+_LBB293_2:
+_LBB282_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_skip_block:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+    movq  -8(%rbp), %rax
+    addq  $116, %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _skip_inactive_lines
+    addq  $16, %rsp
+_LBB294_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_parameter_list:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $192, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _readc
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movl  -20(%rbp), %eax
+    pushq %rax
+    movl  $40, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB296_3
+## if-then
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    popq  %rax
+    movq  $0, %rdx
+    movq  %rdx, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    leaq  -40(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $1, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $2, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $3, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $5, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $6, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $7, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $9, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $10, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $11, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $12, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $13, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $14, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $15, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $17, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $18, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $19, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $20, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $21, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $22, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $23, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $25, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $26, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $27, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $28, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $29, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $30, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $31, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $33, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $34, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $35, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $36, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $37, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $38, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $39, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $40, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $41, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $42, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $43, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $44, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $45, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $46, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $47, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $48, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $49, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $50, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $51, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $52, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $53, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $54, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $55, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $56, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $57, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $58, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $59, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $60, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $61, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $62, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $63, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $64, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $65, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $66, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $67, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $68, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $69, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $70, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $71, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $72, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $73, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $74, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $75, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $76, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $77, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $78, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $79, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $80, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $81, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $82, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $83, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $84, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $85, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $86, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $87, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $88, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $89, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $90, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $91, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $92, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $93, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $94, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $95, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $96, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $97, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $98, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $99, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $100, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $101, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $102, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $103, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $104, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $105, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $106, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $107, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $108, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $109, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $110, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $111, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $112, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $113, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $114, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $115, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $116, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $117, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $118, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $119, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $120, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $121, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $122, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $123, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $124, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $125, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $126, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    addq  $127, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _whitespaces
+    addq  $16, %rsp
+## assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _readc
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  -20(%rbp), %eax
+    pushq %rax
+    movl  $41, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB297_3
+## if-then
+    movl  $1, %eax
+    jmp   _LBB295_0
+    jmp   _LBB297_2
+## if-else
+_LBB297_3:
+_LBB297_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _unreadc
+    addq  $16, %rsp
+## for-pre
+## for-cond
+_LBB298_1:
+    movl  $1, %eax
+    cmpl  $0, %eax
+    je    _LBB298_2
+## for-body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  -176(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _token
+    addq  $16, %rsp
+## assign
+    leaq  -184(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    leaq  -176(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _new_param
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -48(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movq  -184(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    movq  -184(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _whitespaces
+    addq  $16, %rsp
+## assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _readc
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  -20(%rbp), %eax
+    pushq %rax
+    movl  $41, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB299_3
+## if-then
+    jmp   _LBB298_2
+    jmp   _LBB299_2
+## if-else
+_LBB299_3:
+## if-cond
+    movl  -20(%rbp), %eax
+    pushq %rax
+    movl  $44, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB300_3
+## if-then
+    jmp   _LBB298_4
+    jmp   _LBB300_2
+## if-else
+_LBB300_3:
+_LBB300_2:
+_LBB299_2:
+## for-post
+_LBB298_4:
+    jmp   _LBB298_1
+_LBB298_2:
+## assign
+    movq  -16(%rbp), %rax
+    pushq %rax
+    leaq  -40(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movl  $1, %eax
+    jmp   _LBB295_0
+    jmp   _LBB296_2
+## if-else
+_LBB296_3:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _unreadc
+    addq  $16, %rsp
+    movl  $0, %eax
+    jmp   _LBB295_0
+_LBB296_2:
+_LBB295_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_set_body:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## assign
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movq  %rax, (%rsp)
+    movq  16(%rsp), %rdi
+    movl  8(%rsp), %esi
+    movq  (%rsp), %rdx
+    callq _tokenize_text
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $28, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-pre
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB302_1:
+    movq  -16(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB302_2
+## for-body
+    movq  -8(%rbp), %rax
+    addq  $28, %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+## for-post
+_LBB302_4:
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB302_1
+_LBB302_2:
+## for-pre
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB303_1:
+    movq  -24(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB303_2
+## for-body
+## if-cond
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB304_3
+## if-then
+    jmp   _LBB303_4
+    jmp   _LBB304_2
+## if-else
+_LBB304_3:
+_LBB304_2:
+## for-pre
+## assign
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB305_1:
+    movq  -16(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB305_2
+## for-body
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB306_3
+## if-then
+## assign
+    movq  -24(%rbp), %rax
+    addq  $20, %rax
+    pushq %rax
+    movl  -28(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB305_2
+    jmp   _LBB306_2
+## if-else
+_LBB306_3:
+_LBB306_2:
+## for-post
+_LBB305_4:
+    leaq  -28(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB305_1
+_LBB305_2:
+## for-post
+_LBB303_4:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB303_1
+_LBB303_2:
+_LBB301_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_define_line:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _ident_1578(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _token
+    addq  $16, %rsp
+## assign
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    leaq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _parameter_list
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _repl_1579(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _token_list
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _new_line
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $64, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _ident_1578(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _macro_changed
+    addq  $16, %rsp
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    addq  $40, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    leaq  _ident_1578(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _lookup_macro
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -16(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB308_3
+## if-then
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _repl_1579(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB309_3
+## if-then
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _repl_1579(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _add_replacement
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _set_body
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1585(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _error_
+    addq  $16, %rsp
+    jmp   _LBB309_2
+## if-else
+_LBB309_3:
+_LBB309_2:
+    jmp   _LBB308_2
+## if-else
+_LBB308_3:
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    addq  $40, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    leaq  _ident_1578(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _insert_macro
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _repl_1579(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _add_replacement
+    addq  $16, %rsp
+## assign
+    movq  -16(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    movl  -28(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -16(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _set_body
+    addq  $16, %rsp
+_LBB308_2:
+_LBB307_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_undef_line:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _ident_1596(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _token
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _new_line
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $64, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _ident_1596(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _macro_changed
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $40, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _ident_1596(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _remove_macro
+    addq  $16, %rsp
+_LBB310_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_unknown_directive:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1604(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _writes
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _writes
+    addq  $16, %rsp
+## for-pre
+## for-cond
+_LBB312_1:
+    movl  $1, %eax
+    cmpl  $0, %eax
+    je    _LBB312_2
+## for-body
+## local scalar init
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _readc
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    movb  %al, (%rsp)
+    movq  8(%rsp), %rdi
+    movb  (%rsp), %sil
+    callq _writec
+    addq  $16, %rsp
+## if-cond
+    movl  -20(%rbp), %eax
+    pushq %rax
+    movl  $10, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB313_3
+## if-then
+    jmp   _LBB312_2
+    jmp   _LBB313_2
+## if-else
+_LBB313_3:
+_LBB313_2:
+## for-post
+_LBB312_4:
+    jmp   _LBB312_1
+_LBB312_2:
+_LBB311_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_pragma_line:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $160, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -160(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    movq  16(%rax), %r10
+    movq  %r10, 16(%rdx)
+    movq  24(%rax), %r10
+    movq  %r10, 24(%rdx)
+    movq  32(%rax), %r10
+    movq  %r10, 32(%rdx)
+    movq  40(%rax), %r10
+    movq  %r10, 40(%rdx)
+    movq  48(%rax), %r10
+    movq  %r10, 48(%rdx)
+    movq  56(%rax), %r10
+    movq  %r10, 56(%rdx)
+    movq  64(%rax), %r10
+    movq  %r10, 64(%rdx)
+    movq  72(%rax), %r10
+    movq  %r10, 72(%rdx)
+    movq  80(%rax), %r10
+    movq  %r10, 80(%rdx)
+    movq  88(%rax), %r10
+    movq  %r10, 88(%rdx)
+    movq  96(%rax), %r10
+    movq  %r10, 96(%rdx)
+    movq  104(%rax), %r10
+    movq  %r10, 104(%rdx)
+    movq  112(%rax), %r10
+    movq  %r10, 112(%rdx)
+    movq  120(%rax), %r10
+    movq  %r10, 120(%rdx)
+    movq  128(%rax), %r10
+    movq  %r10, 128(%rdx)
+    movq  136(%rax), %r10
+    movq  %r10, 136(%rdx)
+    movq  144(%rax), %r10
+    movq  %r10, 144(%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _name_1614(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _token
+    addq  $16, %rsp
+## if-cond
+    subq  $16, %rsp
+    leaq  _name_1614(%rip), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1616(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB315_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _new_line
+    addq  $16, %rsp
+## assign
+    movq  -8(%rbp), %rax
+    addq  $88, %rax
+    movq  (%rax), %rax
+    addq  $20, %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB315_2
+## if-else
+_LBB315_3:
+## assign
+    movq  -8(%rbp), %rax
+    pushq %rax
+    leaq  -160(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    movq  16(%rax), %r10
+    movq  %r10, 16(%rdx)
+    movq  24(%rax), %r10
+    movq  %r10, 24(%rdx)
+    movq  32(%rax), %r10
+    movq  %r10, 32(%rdx)
+    movq  40(%rax), %r10
+    movq  %r10, 40(%rdx)
+    movq  48(%rax), %r10
+    movq  %r10, 48(%rdx)
+    movq  56(%rax), %r10
+    movq  %r10, 56(%rdx)
+    movq  64(%rax), %r10
+    movq  %r10, 64(%rdx)
+    movq  72(%rax), %r10
+    movq  %r10, 72(%rdx)
+    movq  80(%rax), %r10
+    movq  %r10, 80(%rdx)
+    movq  88(%rax), %r10
+    movq  %r10, 88(%rdx)
+    movq  96(%rax), %r10
+    movq  %r10, 96(%rdx)
+    movq  104(%rax), %r10
+    movq  %r10, 104(%rdx)
+    movq  112(%rax), %r10
+    movq  %r10, 112(%rdx)
+    movq  120(%rax), %r10
+    movq  %r10, 120(%rdx)
+    movq  128(%rax), %r10
+    movq  %r10, 128(%rdx)
+    movq  136(%rax), %r10
+    movq  %r10, 136(%rdx)
+    movq  144(%rax), %r10
+    movq  %r10, 144(%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1620(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _unknown_directive
+    addq  $16, %rsp
+_LBB315_2:
+_LBB314_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_line_line:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1632(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB317_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _num_1629(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _token
+    addq  $16, %rsp
+    jmp   _LBB317_2
+## if-else
+_LBB317_3:
+    subq  $16, %rsp
+    leaq  _num_1629(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcpy
+    addq  $16, %rsp
+_LBB317_2:
+## if-cond
+    subq  $16, %rsp
+    leaq  _num_1629(%rip), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _isdigit
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB318_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1634(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _error_
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _discard_line
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _new_line
+    addq  $16, %rsp
+    jmp   _LBB316_0
+    jmp   _LBB318_2
+## if-else
+_LBB318_3:
+_LBB318_2:
+## assign
+    leaq  _name_1630(%rip), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _whitespaces
+    addq  $16, %rsp
+## assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _readc
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  -20(%rbp), %eax
+    pushq %rax
+    movl  $34, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB319_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _name_1630(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _read_file_path
+    addq  $16, %rsp
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _readc
+    addq  $16, %rsp
+    pushq %rax
+    movl  $34, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB320_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1637(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _error_
+    addq  $16, %rsp
+    jmp   _LBB320_2
+## if-else
+_LBB320_3:
+_LBB320_2:
+    jmp   _LBB319_2
+## if-else
+_LBB319_3:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _unreadc
+    addq  $16, %rsp
+_LBB319_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _discard_line
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _new_line
+    addq  $16, %rsp
+## assign
+    movq  -8(%rbp), %rax
+    addq  $104, %rax
+    pushq %rax
+    subq  $24, %rsp
+    leaq  _num_1629(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movl  $0, %eax
+    movq  %rax, 8(%rsp)
+    movl  $10, %eax
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movl  (%rsp), %edx
+    callq _strtol
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    leaq  _name_1630(%rip), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    je    _LBB321_3
+## if-then
+## assign
+    movq  -8(%rbp), %rax
+    addq  $96, %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    addq  $48, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    leaq  _name_1630(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _insert_include_file
+    addq  $24, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB321_2
+## if-else
+_LBB321_3:
+_LBB321_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _mark_line
+    addq  $16, %rsp
+_LBB316_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_directive_line:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _direc_1647(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _token
+    addq  $16, %rsp
+## if-cond
+    subq  $16, %rsp
+    leaq  _direc_1647(%rip), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1648(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB324_2
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_skipping
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB324_2
+    movl  $1, %eax
+_LBB324_2:
+    cmpl  $0, %eax
+    je    _LBB323_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _include_line
+    addq  $16, %rsp
+    jmp   _LBB323_2
+## if-else
+_LBB323_3:
+## if-cond
+    subq  $16, %rsp
+    leaq  _direc_1647(%rip), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1649(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB326_2
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_skipping
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB326_2
+    movl  $1, %eax
+_LBB326_2:
+    cmpl  $0, %eax
+    je    _LBB325_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _define_line
+    addq  $16, %rsp
+    jmp   _LBB325_2
+## if-else
+_LBB325_3:
+## if-cond
+    subq  $16, %rsp
+    leaq  _direc_1647(%rip), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1650(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB328_2
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_skipping
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB328_2
+    movl  $1, %eax
+_LBB328_2:
+    cmpl  $0, %eax
+    je    _LBB327_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _undef_line
+    addq  $16, %rsp
+    jmp   _LBB327_2
+## if-else
+_LBB327_3:
+## if-cond
+    subq  $16, %rsp
+    leaq  _direc_1647(%rip), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1519(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB329_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _if_part
+    addq  $16, %rsp
+    jmp   _LBB329_2
+## if-else
+_LBB329_3:
+## if-cond
+    subq  $16, %rsp
+    leaq  _direc_1647(%rip), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1520(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB330_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _ifdef_part
+    addq  $16, %rsp
+    jmp   _LBB330_2
+## if-else
+_LBB330_3:
+## if-cond
+    subq  $16, %rsp
+    leaq  _direc_1647(%rip), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1521(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB331_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _ifndef_part
+    addq  $16, %rsp
+    jmp   _LBB331_2
+## if-else
+_LBB331_3:
+## if-cond
+    subq  $16, %rsp
+    leaq  _direc_1647(%rip), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1525(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB332_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _elif_part
+    addq  $16, %rsp
+    jmp   _LBB332_2
+## if-else
+_LBB332_3:
+## if-cond
+    subq  $16, %rsp
+    leaq  _direc_1647(%rip), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1524(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB333_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _else_part
+    addq  $16, %rsp
+    jmp   _LBB333_2
+## if-else
+_LBB333_3:
+## if-cond
+    subq  $16, %rsp
+    leaq  _direc_1647(%rip), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1528(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB334_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _endif_line
+    addq  $16, %rsp
+    jmp   _LBB334_2
+## if-else
+_LBB334_3:
+## if-cond
+    subq  $16, %rsp
+    leaq  _direc_1647(%rip), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1620(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB336_2
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_skipping
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB336_2
+    movl  $1, %eax
+_LBB336_2:
+    cmpl  $0, %eax
+    je    _LBB335_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _pragma_line
+    addq  $16, %rsp
+    jmp   _LBB335_2
+## if-else
+_LBB335_3:
+## if-cond
+    subq  $16, %rsp
+    leaq  _direc_1647(%rip), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1632(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB339_2
+    subq  $16, %rsp
+    leaq  _direc_1647(%rip), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _isdigit
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB339_2
+    movl  $0, %eax
+_LBB339_2:
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB338_2
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_skipping
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB338_2
+    movl  $1, %eax
+_LBB338_2:
+    cmpl  $0, %eax
+    je    _LBB337_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _direc_1647(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _line_line
+    addq  $16, %rsp
+    jmp   _LBB337_2
+## if-else
+_LBB337_3:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _direc_1647(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _unknown_directive
+    addq  $16, %rsp
+_LBB337_2:
+_LBB335_2:
+_LBB334_2:
+_LBB333_2:
+_LBB332_2:
+_LBB331_2:
+_LBB330_2:
+_LBB329_2:
+_LBB327_2:
+_LBB325_2:
+_LBB323_2:
+_LBB322_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_is_punct:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+    movq  -8(%rbp), %rax
+    cmpq  $0, %rax
+    movl  $0, %eax
+    je    _LBB342_2
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB342_2
+    movl  $1, %eax
+_LBB342_2:
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB341_2
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB341_2
+    movl  $1, %eax
+_LBB341_2:
+    jmp   _LBB340_0
+_LBB340_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_copy_token:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $5, %eax
+    movl  %eax, 16(%rsp)
+    movl  $40, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _arena_alloc
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    movq  16(%rax), %r10
+    movq  %r10, 16(%rdx)
+    movq  24(%rax), %r10
+    movq  %r10, 24(%rdx)
+    movq  32(%rax), %r10
+    movq  %r10, 32(%rdx)
+## assign
+    movq  -16(%rbp), %rax
+    addq  $20, %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -16(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -16(%rbp), %rax
+    jmp   _LBB343_0
+_LBB343_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_copy_tokens:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $64, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    popq  %rax
+    movq  $0, %rdx
+    movq  %rdx, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $20, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    popq  %rax
+    movq  $0, %rdx
+    movq  %rdx, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    popq  %rax
+    movq  $0, %rdx
+    movq  %rdx, (%rax)
+## local scalar init
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    leaq  -48(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-pre
+## assign
+    leaq  -64(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB345_1:
+    movq  -64(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB345_2
+## for-body
+## assign
+    movq  -56(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -64(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _copy_token
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    movq  -56(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-post
+_LBB345_4:
+## assign
+    leaq  -64(%rbp), %rax
+    pushq %rax
+    movq  -64(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB345_1
+_LBB345_2:
+    leaq  -48(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    jmp   _LBB344_0
+_LBB344_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_in_hideset:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## for-pre
+## for-cond
+_LBB347_1:
+    movq  -8(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB347_2
+## for-body
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB348_3
+## if-then
+    movl  $1, %eax
+    jmp   _LBB346_0
+    jmp   _LBB348_2
+## if-else
+_LBB348_3:
+_LBB348_2:
+## for-post
+_LBB347_4:
+## assign
+    leaq  -8(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB347_1
+_LBB347_2:
+    movl  $0, %eax
+    jmp   _LBB346_0
+_LBB346_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_hideset_add:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _in_hideset
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB350_3
+## if-then
+    movq  -8(%rbp), %rax
+    jmp   _LBB349_0
+    jmp   _LBB350_2
+## if-else
+_LBB350_3:
+_LBB350_2:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $5, %eax
+    movl  %eax, 16(%rsp)
+    movl  $16, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _arena_alloc
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -24(%rbp), %rax
+    jmp   _LBB349_0
+_LBB349_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_hideset_union:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## for-pre
+## for-cond
+_LBB352_1:
+    movq  -8(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB352_2
+## for-body
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _hideset_add
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-post
+_LBB352_4:
+## assign
+    leaq  -8(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB352_1
+_LBB352_2:
+    movq  -16(%rbp), %rax
+    jmp   _LBB351_0
+_LBB351_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_hideset_intersection:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-pre
+## for-cond
+_LBB354_1:
+    movq  -8(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB354_2
+## for-body
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _in_hideset
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB355_3
+## if-then
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _hideset_add
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB355_2
+## if-else
+_LBB355_3:
+_LBB355_2:
+## for-post
+_LBB354_4:
+## assign
+    leaq  -8(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB354_1
+_LBB354_2:
+    movq  -24(%rbp), %rax
+    jmp   _LBB353_0
+_LBB353_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_stringize:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $64, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+## func body
+    subq  $16, %rsp
+    leaq  -64(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $0, %eax
+    movslq %eax, %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strbuf_init
+    addq  $16, %rsp
+    subq  $16, %rsp
+    leaq  -64(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $34, %eax
+    movb  %al, (%rsp)
+    movq  8(%rsp), %rdi
+    movb  (%rsp), %sil
+    callq _strbuf_append_char
+    addq  $16, %rsp
+## for-pre
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB357_1:
+    movq  -32(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB357_2
+## for-body
+## if-cond
+    movq  -32(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB359_2
+    movq  -32(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB359_2
+    movl  $1, %eax
+_LBB359_2:
+    cmpl  $0, %eax
+    je    _LBB358_3
+## if-then
+    subq  $16, %rsp
+    leaq  -64(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $32, %eax
+    movb  %al, (%rsp)
+    movq  8(%rsp), %rdi
+    movb  (%rsp), %sil
+    callq _strbuf_append_char
+    addq  $16, %rsp
+    jmp   _LBB358_2
+## if-else
+_LBB358_3:
+_LBB358_2:
+## for-pre
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB360_1:
+    movq  -40(%rbp), %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    je    _LBB360_2
+## for-body
+## if-cond
+    movq  -32(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB362_2
+    movq  -40(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $34, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB363_2
+    movq  -40(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $92, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB363_2
+    movl  $0, %eax
+_LBB363_2:
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB362_2
+    movl  $1, %eax
+_LBB362_2:
+    cmpl  $0, %eax
+    je    _LBB361_3
+## if-then
+    subq  $16, %rsp
+    leaq  -64(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $92, %eax
+    movb  %al, (%rsp)
+    movq  8(%rsp), %rdi
+    movb  (%rsp), %sil
+    callq _strbuf_append_char
+    addq  $16, %rsp
+    jmp   _LBB361_2
+## if-else
+_LBB361_3:
+_LBB361_2:
+    subq  $16, %rsp
+    leaq  -64(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -40(%rbp), %rax
+    movb  (%rax), %al
+    movb  %al, (%rsp)
+    movq  8(%rsp), %rdi
+    movb  (%rsp), %sil
+    callq _strbuf_append_char
+    addq  $16, %rsp
+## for-post
+_LBB360_4:
+    leaq  -40(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    jmp   _LBB360_1
+_LBB360_2:
+## for-post
+_LBB357_4:
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB357_1
+_LBB357_2:
+    subq  $16, %rsp
+    leaq  -64(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $34, %eax
+    movb  %al, (%rsp)
+    movq  8(%rsp), %rdi
+    movb  (%rsp), %sil
+    callq _strbuf_append_char
+    addq  $16, %rsp
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $40, %rsp
+    movl  $2, %eax
+    movl  %eax, 32(%rsp)
+    leaq  -64(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    leaq  -64(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movl  -12(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  $5, %eax
+    movl  %eax, (%rsp)
+    movl  32(%rsp), %edi
+    movq  24(%rsp), %rsi
+    movq  16(%rsp), %rdx
+    movl  8(%rsp), %ecx
+    movl  (%rsp), %r8d
+    callq _new_token
+    addq  $40, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    leaq  -64(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _strbuf_free
+    addq  $16, %rsp
+    movq  -24(%rbp), %rax
+    jmp   _LBB356_0
+_LBB356_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_paste:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _strlen
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _strlen
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $5, %eax
+    movl  %eax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _arena_alloc
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $32, %rsp
+    movq  -40(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _memcpy
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -40(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movq  -32(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _memcpy
+    addq  $32, %rsp
+## assign
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movq  -40(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -40(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _token_kind
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+_LBB364_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_expanded_arg:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## if-cond
+    movq  -16(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB366_3
+## if-then
+## assign
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _copy_tokens
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movl  $0, %eax
+    movq  %rax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _expand_tokens
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -16(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB366_2
+## if-else
+_LBB366_3:
+_LBB366_2:
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    jmp   _LBB365_0
+_LBB365_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_subst:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $144, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movq  %rdx, -24(%rbp)
+    movq  %rcx, -32(%rbp)
+## func body
+## local scalar init
+    leaq  -72(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -72(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    popq  %rax
+    movq  $0, %rdx
+    movq  %rdx, (%rax)
+## local scalar init
+    leaq  -72(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -72(%rbp), %rax
+    addq  $20, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -72(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    popq  %rax
+    movq  $0, %rdx
+    movq  %rdx, (%rax)
+## local scalar init
+    leaq  -72(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    popq  %rax
+    movq  $0, %rdx
+    movq  %rdx, (%rax)
+## local scalar init
+    leaq  -80(%rbp), %rax
+    pushq %rax
+    leaq  -72(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -88(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -112(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -120(%rbp), %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-pre
+## assign
+    leaq  -96(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB368_1:
+    movq  -96(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB368_2
+## for-body
+## local scalar init
+    leaq  -128(%rbp), %rax
+    pushq %rax
+    movq  -96(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -16(%rbp), %rax
+    addq  $24, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB372_2
+    subq  $16, %rsp
+    movq  -96(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1765(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _is_punct
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB372_2
+    movl  $1, %eax
+_LBB372_2:
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB371_2
+    movq  -128(%rbp), %rax
+    cmpq  $0, %rax
+    movl  $0, %eax
+    je    _LBB371_2
+    movl  $1, %eax
+_LBB371_2:
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB370_2
+    movq  -128(%rbp), %rax
+    addq  $20, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setge %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB370_2
+    movl  $1, %eax
+_LBB370_2:
+    cmpl  $0, %eax
+    je    _LBB369_3
+## if-then
+## assign
+    leaq  -136(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -24(%rbp), %rax
+    pushq %rax
+    movl  $24, %eax
+    pushq %rax
+    movq  -128(%rbp), %rax
+    addq  $20, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movq  -96(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    movl  %eax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movl  8(%rsp), %esi
+    callq _stringize
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -96(%rbp), %rax
+    pushq %rax
+    movq  -128(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB369_2
+## if-else
+_LBB369_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -96(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1248(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _is_punct
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB374_2
+    movq  -128(%rbp), %rax
+    cmpq  $0, %rax
+    movl  $0, %eax
+    je    _LBB374_2
+    movl  $1, %eax
+_LBB374_2:
+    cmpl  $0, %eax
+    je    _LBB373_3
+## if-then
+## if-cond
+    movq  -128(%rbp), %rax
+    addq  $20, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setge %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB375_3
+## if-then
+## assign
+    leaq  -136(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -24(%rbp), %rax
+    pushq %rax
+    movl  $24, %eax
+    pushq %rax
+    movq  -128(%rbp), %rax
+    addq  $20, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _copy_tokens
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB375_2
+## if-else
+_LBB375_3:
+## assign
+    leaq  -136(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -128(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _copy_token
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+_LBB375_2:
+## if-cond
+    movq  -136(%rbp), %rax
+    cmpq  $0, %rax
+    movl  $0, %eax
+    je    _LBB377_2
+    movq  -88(%rbp), %rax
+    cmpq  $0, %rax
+    movl  $0, %eax
+    je    _LBB377_2
+    movl  $1, %eax
+_LBB377_2:
+    cmpl  $0, %eax
+    je    _LBB376_3
+## if-then
+    subq  $16, %rsp
+    movq  -88(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -136(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _paste
+    addq  $16, %rsp
+## assign
+    leaq  -136(%rbp), %rax
+    pushq %rax
+    movq  -136(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB376_2
+## if-else
+_LBB376_3:
+_LBB376_2:
+## assign
+    leaq  -96(%rbp), %rax
+    pushq %rax
+    movq  -128(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB373_2
+## if-else
+_LBB373_3:
+## if-cond
+    movq  -96(%rbp), %rax
+    addq  $20, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setge %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB378_3
+## if-then
+## if-cond
+    subq  $16, %rsp
+    movq  -128(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1248(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _is_punct
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB379_3
+## if-then
+## assign
+    leaq  -136(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -24(%rbp), %rax
+    pushq %rax
+    movl  $24, %eax
+    pushq %rax
+    movq  -96(%rbp), %rax
+    addq  $20, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _copy_tokens
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB379_2
+## if-else
+_LBB379_3:
+## assign
+    leaq  -136(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    pushq %rax
+    movl  $24, %eax
+    pushq %rax
+    movq  -96(%rbp), %rax
+    addq  $20, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _expanded_arg
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _copy_tokens
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+_LBB379_2:
+## if-cond
+    movq  -136(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB380_3
+## if-then
+## assign
+    movq  -136(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movq  -96(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB380_2
+## if-else
+_LBB380_3:
+## assign
+    leaq  -88(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+_LBB380_2:
+    jmp   _LBB378_2
+## if-else
+_LBB378_3:
+## assign
+    leaq  -136(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -96(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _copy_token
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+_LBB378_2:
+_LBB373_2:
+_LBB369_2:
+## if-cond
+    movq  -136(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB381_3
+## if-then
+## assign
+    movq  -80(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    movq  -136(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## while-cond
+_LBB382_4:
+    movq  -80(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    je    _LBB382_2
+## while-body
+## assign
+    leaq  -80(%rbp), %rax
+    pushq %rax
+    movq  -80(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB382_4
+_LBB382_2:
+## assign
+    leaq  -88(%rbp), %rax
+    pushq %rax
+    movq  -80(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB381_2
+## if-else
+_LBB381_3:
+_LBB381_2:
+## for-post
+_LBB368_4:
+## assign
+    leaq  -96(%rbp), %rax
+    pushq %rax
+    movq  -96(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB368_1
+_LBB368_2:
+## for-pre
+## assign
+    leaq  -104(%rbp), %rax
+    pushq %rax
+    leaq  -72(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB383_1:
+    movq  -104(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB383_2
+## for-body
+## if-cond
+    movq  -104(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movq  -112(%rbp), %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB384_3
+## if-then
+## assign
+    leaq  -112(%rbp), %rax
+    pushq %rax
+    movq  -104(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -120(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -112(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -32(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _hideset_union
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB384_2
+## if-else
+_LBB384_3:
+_LBB384_2:
+## assign
+    movq  -104(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    movq  -120(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-post
+_LBB383_4:
+## assign
+    leaq  -104(%rbp), %rax
+    pushq %rax
+    movq  -104(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB383_1
+_LBB383_2:
+    leaq  -72(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    jmp   _LBB367_0
+_LBB367_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_read_literal:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movl  %edx, -20(%rbp)
+## func body
+## for-pre
+## for-cond
+_LBB386_1:
+    movl  $1, %eax
+    cmpl  $0, %eax
+    je    _LBB386_2
+## for-body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _readc
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  -24(%rbp), %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB388_2
+    movl  -24(%rbp), %eax
+    pushq %rax
+    movl  $10, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB388_2
+    movl  $0, %eax
+_LBB388_2:
+    cmpl  $0, %eax
+    je    _LBB387_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -24(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _unreadc
+    addq  $16, %rsp
+    jmp   _LBB386_2
+    jmp   _LBB387_2
+## if-else
+_LBB387_3:
+_LBB387_2:
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -24(%rbp), %eax
+    movb  %al, (%rsp)
+    movq  8(%rsp), %rdi
+    movb  (%rsp), %sil
+    callq _strbuf_append_char
+    addq  $16, %rsp
+## if-cond
+    movl  -24(%rbp), %eax
+    pushq %rax
+    movl  -20(%rbp), %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB389_3
+## if-then
+    jmp   _LBB386_2
+    jmp   _LBB389_2
+## if-else
+_LBB389_3:
+## if-cond
+    movl  -24(%rbp), %eax
+    pushq %rax
+    movl  $92, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB390_3
+## if-then
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _readc
+    addq  $16, %rsp
+    movb  %al, (%rsp)
+    movq  8(%rsp), %rdi
+    movb  (%rsp), %sil
+    callq _strbuf_append_char
+    addq  $16, %rsp
+    jmp   _LBB390_2
+## if-else
+_LBB390_3:
+_LBB390_2:
+_LBB389_2:
+## for-post
+_LBB386_4:
+    jmp   _LBB386_1
+_LBB386_2:
+_LBB385_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_read_comment:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1803(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strbuf_append
+    addq  $16, %rsp
+## for-pre
+## for-cond
+_LBB392_1:
+    movl  $1, %eax
+    cmpl  $0, %eax
+    je    _LBB392_2
+## for-body
+## local scalar init
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _readc
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  -20(%rbp), %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB393_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1340(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _error_
+    addq  $16, %rsp
+    jmp   _LBB392_2
+    jmp   _LBB393_2
+## if-else
+_LBB393_3:
+_LBB393_2:
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    movb  %al, (%rsp)
+    movq  8(%rsp), %rdi
+    movb  (%rsp), %sil
+    callq _strbuf_append_char
+    addq  $16, %rsp
+## if-cond
+    movl  -20(%rbp), %eax
+    pushq %rax
+    movl  $42, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB394_3
+## if-then
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _readc
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  -24(%rbp), %eax
+    pushq %rax
+    movl  $47, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB395_3
+## if-then
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -24(%rbp), %eax
+    movb  %al, (%rsp)
+    movq  8(%rsp), %rdi
+    movb  (%rsp), %sil
+    callq _strbuf_append_char
+    addq  $16, %rsp
+    jmp   _LBB392_2
+    jmp   _LBB395_2
+## if-else
+_LBB395_3:
+_LBB395_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -24(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _unreadc
+    addq  $16, %rsp
+    jmp   _LBB394_2
+## if-else
+_LBB394_3:
+_LBB394_2:
+## for-post
+_LBB392_4:
+    jmp   _LBB392_1
+_LBB392_2:
+_LBB391_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_read_source_args:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $224, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -168(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    movq  16(%rax), %r10
+    movq  %r10, 16(%rdx)
+    movq  24(%rax), %r10
+    movq  %r10, 24(%rdx)
+    movq  32(%rax), %r10
+    movq  %r10, 32(%rdx)
+    movq  40(%rax), %r10
+    movq  %r10, 40(%rdx)
+    movq  48(%rax), %r10
+    movq  %r10, 48(%rdx)
+    movq  56(%rax), %r10
+    movq  %r10, 56(%rdx)
+    movq  64(%rax), %r10
+    movq  %r10, 64(%rdx)
+    movq  72(%rax), %r10
+    movq  %r10, 72(%rdx)
+    movq  80(%rax), %r10
+    movq  %r10, 80(%rdx)
+    movq  88(%rax), %r10
+    movq  %r10, 88(%rdx)
+    movq  96(%rax), %r10
+    movq  %r10, 96(%rdx)
+    movq  104(%rax), %r10
+    movq  %r10, 104(%rdx)
+    movq  112(%rax), %r10
+    movq  %r10, 112(%rdx)
+    movq  120(%rax), %r10
+    movq  %r10, 120(%rdx)
+    movq  128(%rax), %r10
+    movq  %r10, 128(%rdx)
+    movq  136(%rax), %r10
+    movq  %r10, 136(%rdx)
+    movq  144(%rax), %r10
+    movq  %r10, 144(%rdx)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -204(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## do-while-body
+_LBB397_1:
+## assign
+    leaq  -208(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _readc
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## do-while-cond
+_LBB397_4:
+    subq  $16, %rsp
+    movl  -208(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _is_whitespaces
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB397_2
+    jmp   _LBB397_1
+_LBB397_2:
+## if-cond
+    movl  -208(%rbp), %eax
+    pushq %rax
+    movl  $40, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB398_3
+## if-then
+## assign
+    movq  -8(%rbp), %rax
+    pushq %rax
+    leaq  -168(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    movq  16(%rax), %r10
+    movq  %r10, 16(%rdx)
+    movq  24(%rax), %r10
+    movq  %r10, 24(%rdx)
+    movq  32(%rax), %r10
+    movq  %r10, 32(%rdx)
+    movq  40(%rax), %r10
+    movq  %r10, 40(%rdx)
+    movq  48(%rax), %r10
+    movq  %r10, 48(%rdx)
+    movq  56(%rax), %r10
+    movq  %r10, 56(%rdx)
+    movq  64(%rax), %r10
+    movq  %r10, 64(%rdx)
+    movq  72(%rax), %r10
+    movq  %r10, 72(%rdx)
+    movq  80(%rax), %r10
+    movq  %r10, 80(%rdx)
+    movq  88(%rax), %r10
+    movq  %r10, 88(%rdx)
+    movq  96(%rax), %r10
+    movq  %r10, 96(%rdx)
+    movq  104(%rax), %r10
+    movq  %r10, 104(%rdx)
+    movq  112(%rax), %r10
+    movq  %r10, 112(%rdx)
+    movq  120(%rax), %r10
+    movq  %r10, 120(%rdx)
+    movq  128(%rax), %r10
+    movq  %r10, 128(%rdx)
+    movq  136(%rax), %r10
+    movq  %r10, 136(%rdx)
+    movq  144(%rax), %r10
+    movq  %r10, 144(%rdx)
+    movl  $0, %eax
+    jmp   _LBB396_0
+    jmp   _LBB398_2
+## if-else
+_LBB398_3:
+_LBB398_2:
+    subq  $16, %rsp
+    leaq  -200(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $0, %eax
+    movslq %eax, %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strbuf_init
+    addq  $16, %rsp
+    subq  $16, %rsp
+    leaq  -200(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -208(%rbp), %eax
+    movb  %al, (%rsp)
+    movq  8(%rsp), %rdi
+    movb  (%rsp), %sil
+    callq _strbuf_append_char
+    addq  $16, %rsp
+## while-cond
+_LBB399_4:
+    movl  -204(%rbp), %eax
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB399_2
+## while-body
+## assign
+    leaq  -208(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _readc
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  -208(%rbp), %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB400_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1832(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _error_
+    addq  $16, %rsp
+    jmp   _LBB399_2
+    jmp   _LBB400_2
+## if-else
+_LBB400_3:
+## if-cond
+    movl  -208(%rbp), %eax
+    pushq %rax
+    movl  $47, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB401_3
+## if-then
+## local scalar init
+    leaq  -212(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _readc
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  -212(%rbp), %eax
+    pushq %rax
+    movl  $42, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB402_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  -200(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _read_comment
+    addq  $16, %rsp
+    jmp   _LBB399_4
+    jmp   _LBB402_2
+## if-else
+_LBB402_3:
+_LBB402_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -212(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _unreadc
+    addq  $16, %rsp
+    jmp   _LBB401_2
+## if-else
+_LBB401_3:
+_LBB401_2:
+_LBB400_2:
+    subq  $16, %rsp
+    leaq  -200(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -208(%rbp), %eax
+    movb  %al, (%rsp)
+    movq  8(%rsp), %rdi
+    movb  (%rsp), %sil
+    callq _strbuf_append_char
+    addq  $16, %rsp
+## if-cond
+    movl  -208(%rbp), %eax
+    pushq %rax
+    movl  $40, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB403_3
+## if-then
+    leaq  -204(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB403_2
+## if-else
+_LBB403_3:
+## if-cond
+    movl  -208(%rbp), %eax
+    pushq %rax
+    movl  $41, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB404_3
+## if-then
+    leaq  -204(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    subl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB404_2
+## if-else
+_LBB404_3:
+## if-cond
+    movl  -208(%rbp), %eax
+    pushq %rax
+    movl  $34, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB406_2
+    movl  -208(%rbp), %eax
+    pushq %rax
+    movl  $39, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB406_2
+    movl  $0, %eax
+_LBB406_2:
+    cmpl  $0, %eax
+    je    _LBB405_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  -200(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  -208(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _read_literal
+    addq  $32, %rsp
+    jmp   _LBB405_2
+## if-else
+_LBB405_3:
+_LBB405_2:
+_LBB404_2:
+_LBB403_2:
+    jmp   _LBB399_4
+_LBB399_2:
+## assign
+    leaq  -176(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    leaq  -200(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movl  $5, %eax
+    movl  %eax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  16(%rsp), %rdi
+    movl  8(%rsp), %esi
+    movq  (%rsp), %rdx
+    callq _tokenize_text
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    leaq  -200(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _strbuf_free
+    addq  $16, %rsp
+    movq  -176(%rbp), %rax
+    jmp   _LBB396_0
+_LBB396_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_collect_args:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $80, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movq  %rdx, -24(%rbp)
+    movq  %rcx, -32(%rbp)
+## func body
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -68(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -72(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -76(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movq  -16(%rbp), %rax
+    addq  $28, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB408_3
+## if-then
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $5, %eax
+    movl  %eax, 16(%rsp)
+    movl  $24, %eax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $28, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    imull %edx, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _arena_alloc
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -72(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB408_2
+## if-else
+_LBB408_3:
+_LBB408_2:
+## for-pre
+## assign
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB409_1:
+    movq  -56(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB409_2
+## for-body
+## assign
+    leaq  -64(%rbp), %rax
+    pushq %rax
+    movq  -56(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movl  -68(%rbp), %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB411_2
+    subq  $16, %rsp
+    movq  -56(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1859(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _is_punct
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB411_2
+    movl  $1, %eax
+_LBB411_2:
+    cmpl  $0, %eax
+    je    _LBB410_3
+## if-then
+## if-cond
+    movl  -72(%rbp), %eax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $28, %rax
+    movl  (%rax), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB412_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1861(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _error_
+    addq  $16, %rsp
+    jmp   _LBB412_2
+## if-else
+_LBB412_3:
+_LBB412_2:
+## assign
+    movq  -32(%rbp), %rax
+    pushq %rax
+    movq  -40(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -56(%rbp), %rax
+    jmp   _LBB407_0
+    jmp   _LBB410_2
+## if-else
+_LBB410_3:
+_LBB410_2:
+## if-cond
+    movl  -76(%rbp), %eax
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB414_2
+    movl  -72(%rbp), %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB415_2
+    movl  -68(%rbp), %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB417_2
+    subq  $16, %rsp
+    movq  -56(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1863(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _is_punct
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB417_2
+    movl  $1, %eax
+_LBB417_2:
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB416_2
+    movl  -72(%rbp), %eax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $28, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB416_2
+    movl  $1, %eax
+_LBB416_2:
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB415_2
+    movl  $0, %eax
+_LBB415_2:
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB414_2
+    movl  $1, %eax
+_LBB414_2:
+    cmpl  $0, %eax
+    je    _LBB413_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1865(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _error_
+    addq  $16, %rsp
+## assign
+    leaq  -76(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB413_2
+## if-else
+_LBB413_3:
+_LBB413_2:
+## if-cond
+    subq  $16, %rsp
+    movq  -56(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1867(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _is_punct
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB418_3
+## if-then
+    leaq  -68(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB418_2
+## if-else
+_LBB418_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -56(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1859(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _is_punct
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB419_3
+## if-then
+    leaq  -68(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    subl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB419_2
+## if-else
+_LBB419_3:
+_LBB419_2:
+_LBB418_2:
+## if-cond
+    movl  -76(%rbp), %eax
+    cmpl  $0, %eax
+    je    _LBB420_3
+## if-then
+    jmp   _LBB409_4
+    jmp   _LBB420_2
+## if-else
+_LBB420_3:
+_LBB420_2:
+## if-cond
+    movl  -68(%rbp), %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB422_2
+    subq  $16, %rsp
+    movq  -56(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1863(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _is_punct
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB422_2
+    movl  $1, %eax
+_LBB422_2:
+    cmpl  $0, %eax
+    je    _LBB421_3
+## if-then
+    leaq  -72(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+## assign
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB409_4
+    jmp   _LBB421_2
+## if-else
+_LBB421_3:
+_LBB421_2:
+## assign
+    movq  -56(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -48(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB423_3
+## if-then
+## assign
+    movq  -48(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    movq  -56(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB423_2
+## if-else
+_LBB423_3:
+## assign
+    movq  -40(%rbp), %rax
+    pushq %rax
+    movl  $24, %eax
+    pushq %rax
+    movl  -72(%rbp), %eax
+    pushq %rax
+    movl  $1, %eax
+    movl  %eax, %edx
+    popq  %rax
+    subl  %edx, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -56(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+_LBB423_2:
+## assign
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    movq  -56(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-post
+_LBB409_4:
+## assign
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    movq  -64(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB409_1
+_LBB409_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1832(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _error_
+    addq  $16, %rsp
+    movl  $0, %eax
+    jmp   _LBB407_0
+_LBB407_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_expand_tokens:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $128, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movq  %rdx, -24(%rbp)
+## func body
+## local scalar init
+    leaq  -64(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -64(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    popq  %rax
+    movq  $0, %rdx
+    movq  %rdx, (%rax)
+## local scalar init
+    leaq  -64(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -64(%rbp), %rax
+    addq  $20, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -64(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    popq  %rax
+    movq  $0, %rdx
+    movq  %rdx, (%rax)
+## local scalar init
+    leaq  -64(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    popq  %rax
+    movq  $0, %rdx
+    movq  %rdx, (%rax)
+## local scalar init
+    leaq  -72(%rbp), %rax
+    pushq %rax
+    leaq  -64(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## while-cond
+_LBB425_4:
+    movq  -16(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB425_2
+## while-body
+## local scalar init
+    leaq  -80(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -88(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -96(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -104(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -80(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB426_3
+## if-then
+## assign
+    leaq  -88(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    addq  $40, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movq  -80(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _lookup_macro
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB426_2
+## if-else
+_LBB426_3:
+_LBB426_2:
+## if-cond
+    movq  -80(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB428_2
+    movq  -8(%rbp), %rax
+    addq  $72, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB428_2
+    movl  $1, %eax
+_LBB428_2:
+    cmpl  $0, %eax
+    je    _LBB427_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $64, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  -80(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _watch_name
+    addq  $16, %rsp
+    jmp   _LBB427_2
+## if-else
+_LBB427_3:
+_LBB427_2:
+## if-cond
+    movq  -88(%rbp), %rax
+    cmpq  $0, %rax
+    movl  $0, %eax
+    je    _LBB430_2
+    subq  $16, %rsp
+    movq  -80(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  -88(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _in_hideset
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB430_2
+    movl  $1, %eax
+_LBB430_2:
+    cmpl  $0, %eax
+    je    _LBB429_3
+## if-then
+## assign
+    leaq  -88(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB429_2
+## if-else
+_LBB429_3:
+_LBB429_2:
+## if-cond
+    movq  -88(%rbp), %rax
+    cmpq  $0, %rax
+    movl  $0, %eax
+    je    _LBB432_2
+    movq  -88(%rbp), %rax
+    addq  $24, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB432_2
+    movl  $1, %eax
+_LBB432_2:
+    cmpl  $0, %eax
+    je    _LBB431_3
+## if-then
+## if-cond
+    movq  -80(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB434_2
+    movq  -24(%rbp), %rax
+    cmpq  $0, %rax
+    movl  $0, %eax
+    je    _LBB434_2
+    movl  $1, %eax
+_LBB434_2:
+    cmpl  $0, %eax
+    je    _LBB433_3
+## if-then
+## assign
+    movq  -80(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _read_source_args
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $76, %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB433_2
+## if-else
+_LBB433_3:
+_LBB433_2:
+## if-cond
+    subq  $16, %rsp
+    movq  -80(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1867(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _is_punct
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB435_3
+## if-then
+## assign
+    leaq  -88(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB435_2
+## if-else
+_LBB435_3:
+_LBB435_2:
+    jmp   _LBB431_2
+## if-else
+_LBB431_3:
+_LBB431_2:
+## if-cond
+    movq  -88(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB436_3
+## if-then
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movq  -80(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -80(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -72(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    movq  -80(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -72(%rbp), %rax
+    pushq %rax
+    movq  -80(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB425_4
+    jmp   _LBB436_2
+## if-else
+_LBB436_3:
+_LBB436_2:
+## if-cond
+    movq  -88(%rbp), %rax
+    addq  $24, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    je    _LBB437_3
+## if-then
+## local scalar init
+    leaq  -112(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -120(%rbp), %rax
+    pushq %rax
+    subq  $40, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 32(%rsp)
+    movq  -88(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -80(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    leaq  -112(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  32(%rsp), %rdi
+    movq  24(%rsp), %rsi
+    movq  16(%rsp), %rdx
+    movq  8(%rsp), %rcx
+    callq _collect_args
+    addq  $40, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -120(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB438_3
+## if-then
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB425_4
+    jmp   _LBB438_2
+## if-else
+_LBB438_3:
+_LBB438_2:
+## assign
+    leaq  -96(%rbp), %rax
+    pushq %rax
+    subq  $40, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 32(%rsp)
+    movq  -88(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -112(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -80(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  -120(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _hideset_intersection
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  -88(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _hideset_add
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  32(%rsp), %rdi
+    movq  24(%rsp), %rsi
+    movq  16(%rsp), %rdx
+    movq  8(%rsp), %rcx
+    callq _subst
+    addq  $40, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -104(%rbp), %rax
+    pushq %rax
+    movq  -120(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB437_2
+## if-else
+_LBB437_3:
+## assign
+    leaq  -96(%rbp), %rax
+    pushq %rax
+    subq  $40, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 32(%rsp)
+    movq  -88(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $0, %eax
+    movq  %rax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -80(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  -88(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _hideset_add
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  32(%rsp), %rdi
+    movq  24(%rsp), %rsi
+    movq  16(%rsp), %rdx
+    movq  8(%rsp), %rcx
+    callq _subst
+    addq  $40, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -104(%rbp), %rax
+    pushq %rax
+    movq  -80(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+_LBB437_2:
+## if-cond
+    movq  -96(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB439_3
+## if-then
+## local scalar init
+    leaq  -128(%rbp), %rax
+    pushq %rax
+    movq  -96(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -96(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movq  -80(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## while-cond
+_LBB440_4:
+    movq  -128(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    je    _LBB440_2
+## while-body
+## assign
+    leaq  -128(%rbp), %rax
+    pushq %rax
+    movq  -128(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB440_4
+_LBB440_2:
+## assign
+    movq  -128(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    movq  -104(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movq  -96(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB439_2
+## if-else
+_LBB439_3:
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movq  -104(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+_LBB439_2:
+    jmp   _LBB425_4
+_LBB425_2:
+    leaq  -64(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    jmp   _LBB424_0
+_LBB424_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_append_tokens:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## for-pre
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB442_1:
+    movq  -24(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB442_2
+## for-body
+## if-cond
+    movq  -24(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB444_2
+    movq  -24(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB444_2
+    movl  $1, %eax
+_LBB444_2:
+    cmpl  $0, %eax
+    je    _LBB443_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $32, %eax
+    movb  %al, (%rsp)
+    movq  8(%rsp), %rdi
+    movb  (%rsp), %sil
+    callq _strbuf_append_char
+    addq  $16, %rsp
+    jmp   _LBB443_2
+## if-else
+_LBB443_3:
+_LBB443_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strbuf_append
+    addq  $16, %rsp
+## for-post
+_LBB442_4:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB442_1
+_LBB442_2:
+_LBB441_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_rescan_depth:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-pre
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB446_1:
+    movq  -16(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB446_2
+## for-body
+## local scalar init
+    leaq  -36(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-pre
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB447_1:
+    movq  -32(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB447_2
+## for-body
+    leaq  -36(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+## for-post
+_LBB447_4:
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB447_1
+_LBB447_2:
+## if-cond
+    movl  -20(%rbp), %eax
+    pushq %rax
+    movl  -36(%rbp), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB448_3
+## if-then
+## assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  -36(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB448_2
+## if-else
+_LBB448_3:
+_LBB448_2:
+## for-post
+_LBB446_4:
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB446_1
+_LBB446_2:
+    movl  -20(%rbp), %eax
+    jmp   _LBB445_0
+_LBB445_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_expand_invocation:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $80, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movq  %rdx, -24(%rbp)
+    movq  %rcx, -32(%rbp)
+    movq  %r8, -40(%rbp)
+## func body
+    subq  $16, %rsp
+    leaq  -64(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $0, %eax
+    movslq %eax, %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strbuf_init
+    addq  $16, %rsp
+## assign
+    movq  -8(%rbp), %rax
+    addq  $72, %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $76, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -40(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _expand_tokens
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $72, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    leaq  -64(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _append_tokens
+    addq  $16, %rsp
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $76, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB450_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    addq  $64, %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    movq  -32(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    leaq  -64(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _add_expansion
+    addq  $32, %rsp
+    jmp   _LBB450_2
+## if-else
+_LBB450_3:
+_LBB450_2:
+## assign
+    leaq  -68(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _rescan_depth
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movq  -16(%rbp), %rax
+    addq  $48, %rax
+    movq  (%rax), %rax
+    addq  $24, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  -68(%rbp), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB451_3
+## if-then
+## assign
+    movq  -16(%rbp), %rax
+    addq  $48, %rax
+    movq  (%rax), %rax
+    addq  $24, %rax
+    pushq %rax
+    movl  -68(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB451_2
+## if-else
+_LBB451_3:
+_LBB451_2:
+## add-assign
+    movq  -16(%rbp), %rax
+    addq  $48, %rax
+    movq  (%rax), %rax
+    addq  $16, %rax
+    pushq %rax
+    leaq  -64(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    addq  %rax, (%rdx)
+    movq  (%rdx), %rax
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  -64(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _writes
+    addq  $16, %rsp
+    subq  $16, %rsp
+    leaq  -64(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _strbuf_free
+    addq  $16, %rsp
+_LBB449_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_expand:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $80, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _tok_1946(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _token
+    addq  $16, %rsp
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    addq  $40, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    leaq  _tok_1946(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _lookup_macro
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -16(%rbp), %rax
+    cmpq  $0, %rax
+    movl  $0, %eax
+    je    _LBB454_2
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_skipping
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB454_2
+    movl  $1, %eax
+_LBB454_2:
+    cmpl  $0, %eax
+    je    _LBB453_3
+## if-then
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -68(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movq  -16(%rbp), %rax
+    addq  $24, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    je    _LBB455_3
+## if-then
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    leaq  -68(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _read_source_args
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -32(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB456_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _tok_1946(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _writes
+    addq  $16, %rsp
+    jmp   _LBB452_0
+    jmp   _LBB456_2
+## if-else
+_LBB456_3:
+_LBB456_2:
+    jmp   _LBB455_2
+## if-else
+_LBB455_3:
+_LBB455_2:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $40, %rsp
+    movl  $0, %eax
+    movl  %eax, 32(%rsp)
+    leaq  _tok_1946(%rip), %rax
+    movq  %rax, 24(%rsp)
+    subq  $16, %rsp
+    leaq  _tok_1946(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _strlen
+    addq  $16, %rsp
+    movq  %rax, 16(%rsp)
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    movl  $5, %eax
+    movl  %eax, (%rsp)
+    movl  32(%rsp), %edi
+    movq  24(%rsp), %rsi
+    movq  16(%rsp), %rdx
+    movl  8(%rsp), %ecx
+    movl  (%rsp), %r8d
+    callq _new_token
+    addq  $40, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -24(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    leaq  -56(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $0, %eax
+    movslq %eax, %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strbuf_init
+    addq  $16, %rsp
+    subq  $16, %rsp
+    leaq  -56(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _append_tokens
+    addq  $16, %rsp
+## assign
+    leaq  -64(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    addq  $64, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    leaq  -56(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _find_expansion
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -64(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB457_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -64(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _writes
+    addq  $16, %rsp
+## add-assign
+    movq  -16(%rbp), %rax
+    addq  $48, %rax
+    movq  (%rax), %rax
+    addq  $16, %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -64(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _strlen
+    addq  $8, %rsp
+    popq  %rdx
+    addq  %rax, (%rdx)
+    movq  (%rdx), %rax
+    jmp   _LBB457_2
+## if-else
+_LBB457_3:
+    subq  $48, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 40(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 32(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  -56(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    leaq  -68(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  40(%rsp), %rdi
+    movq  32(%rsp), %rsi
+    movq  24(%rsp), %rdx
+    movq  16(%rsp), %rcx
+    movq  8(%rsp), %r8
+    callq _expand_invocation
+    addq  $48, %rsp
+_LBB457_2:
+    movq  -16(%rbp), %rax
+    addq  $48, %rax
+    movq  (%rax), %rax
+    addq  $8, %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    subq  $16, %rsp
+    leaq  -56(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _strbuf_free
+    addq  $16, %rsp
+## for-pre
+## for-cond
+_LBB458_1:
+    movl  -68(%rbp), %eax
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB458_2
+## for-body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $10, %eax
+    movb  %al, (%rsp)
+    movq  8(%rsp), %rdi
+    movb  (%rsp), %sil
+    callq _writec
+    addq  $16, %rsp
+## for-post
+_LBB458_4:
+    leaq  -68(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    subl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB458_1
+_LBB458_2:
+    subq  $16, %rsp
+    movl  $5, %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _reset_arena
+    addq  $16, %rsp
+    jmp   _LBB453_2
+## if-else
+_LBB453_3:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _tok_1946(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _writes
+    addq  $16, %rsp
+_LBB453_2:
+_LBB452_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_push_cond:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movl  $16, %eax
+    movslq %eax, %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _malloc
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $120, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $120, %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+_LBB459_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_pop_cond:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $120, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $120, %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+_LBB460_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_read_line_text:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## for-pre
+## for-cond
+_LBB462_1:
+    movl  $1, %eax
+    cmpl  $0, %eax
+    je    _LBB462_2
+## for-body
+## local scalar init
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _readc
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  -20(%rbp), %eax
+    pushq %rax
+    movl  $10, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB464_2
+    movl  -20(%rbp), %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB464_2
+    movl  $0, %eax
+_LBB464_2:
+    cmpl  $0, %eax
+    je    _LBB463_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _unreadc
+    addq  $16, %rsp
+    jmp   _LBB462_2
+    jmp   _LBB463_2
+## if-else
+_LBB463_3:
+## if-cond
+    movl  -20(%rbp), %eax
+    pushq %rax
+    movl  $47, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB465_3
+## if-then
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _readc
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  -24(%rbp), %eax
+    pushq %rax
+    movl  $42, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB466_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _block_comment
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $32, %eax
+    movb  %al, (%rsp)
+    movq  8(%rsp), %rdi
+    movb  (%rsp), %sil
+    callq _strbuf_append_char
+    addq  $16, %rsp
+    jmp   _LBB462_4
+    jmp   _LBB466_2
+## if-else
+_LBB466_3:
+_LBB466_2:
+## if-cond
+    movl  -24(%rbp), %eax
+    pushq %rax
+    movl  $47, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB467_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _discard_line
+    addq  $16, %rsp
+    jmp   _LBB462_4
+    jmp   _LBB467_2
+## if-else
+_LBB467_3:
+_LBB467_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -24(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _unreadc
+    addq  $16, %rsp
+    jmp   _LBB465_2
+## if-else
+_LBB465_3:
+_LBB465_2:
+_LBB463_2:
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    movb  %al, (%rsp)
+    movq  8(%rsp), %rdi
+    movb  (%rsp), %sil
+    callq _strbuf_append_char
+    addq  $16, %rsp
+## if-cond
+    movl  -20(%rbp), %eax
+    pushq %rax
+    movl  $34, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB469_2
+    movl  -20(%rbp), %eax
+    pushq %rax
+    movl  $39, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB469_2
+    movl  $0, %eax
+_LBB469_2:
+    cmpl  $0, %eax
+    je    _LBB468_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _read_literal
+    addq  $32, %rsp
+    jmp   _LBB468_2
+## if-else
+_LBB468_3:
+_LBB468_2:
+## for-post
+_LBB462_4:
+    jmp   _LBB462_1
+_LBB462_2:
+_LBB461_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_replace_defined:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $96, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -56(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    popq  %rax
+    movq  $0, %rdx
+    movq  %rdx, (%rax)
+## local scalar init
+    leaq  -56(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -56(%rbp), %rax
+    addq  $20, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -56(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    popq  %rax
+    movq  $0, %rdx
+    movq  %rdx, (%rax)
+## local scalar init
+    leaq  -56(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    popq  %rax
+    movq  $0, %rdx
+    movq  %rdx, (%rax)
+## local scalar init
+    leaq  -64(%rbp), %rax
+    pushq %rax
+    leaq  -56(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -72(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## while-cond
+_LBB471_4:
+    movq  -72(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB471_2
+## while-body
+## local scalar init
+    leaq  -80(%rbp), %rax
+    pushq %rax
+    movq  -72(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -72(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB473_2
+    subq  $16, %rsp
+    movq  -72(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2013(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB473_2
+    movl  $0, %eax
+_LBB473_2:
+    cmpl  $0, %eax
+    je    _LBB472_3
+## if-then
+## assign
+    movq  -64(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    movq  -72(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -64(%rbp), %rax
+    pushq %rax
+    movq  -72(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -72(%rbp), %rax
+    pushq %rax
+    movq  -72(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB471_4
+    jmp   _LBB472_2
+## if-else
+_LBB472_3:
+_LBB472_2:
+## assign
+    leaq  -92(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -80(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_1867(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _is_punct
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  -92(%rbp), %eax
+    cmpl  $0, %eax
+    je    _LBB474_3
+## if-then
+## assign
+    leaq  -80(%rbp), %rax
+    pushq %rax
+    movq  -80(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB474_2
+## if-else
+_LBB474_3:
+_LBB474_2:
+## if-cond
+    movq  -80(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB476_2
+    movq  -80(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB476_2
+    movl  $0, %eax
+_LBB476_2:
+    cmpl  $0, %eax
+    je    _LBB475_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2017(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _error_
+    addq  $16, %rsp
+    jmp   _LBB471_2
+    jmp   _LBB475_2
+## if-else
+_LBB475_3:
+_LBB475_2:
+## assign
+    leaq  -88(%rbp), %rax
+    pushq %rax
+    movq  -80(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movl  -92(%rbp), %eax
+    cmpl  $0, %eax
+    je    _LBB477_3
+## if-then
+## if-cond
+    subq  $16, %rsp
+    movq  -88(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1859(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _is_punct
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB478_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2021(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _error_
+    addq  $16, %rsp
+    jmp   _LBB471_2
+    jmp   _LBB478_2
+## if-else
+_LBB478_3:
+_LBB478_2:
+## assign
+    leaq  -88(%rbp), %rax
+    pushq %rax
+    movq  -88(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB477_2
+## if-else
+_LBB477_3:
+_LBB477_2:
+## assign
+    movq  -64(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    subq  $40, %rsp
+    movl  $1, %eax
+    movl  %eax, 32(%rsp)
+## cond-?
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $40, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  -80(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _lookup_macro
+    addq  $16, %rsp
+    cmpq  $0, %rax
+    je    _LBB479_3
+## cond-then
+    leaq  _L_str_2024(%rip), %rax
+    jmp   _LBB479_2
+## cond-else
+_LBB479_3:
+    leaq  _L_str_2025(%rip), %rax
+_LBB479_2:
+    movq  %rax, 24(%rsp)
+    movl  $1, %eax
+    movslq %eax, %rax
+    movq  %rax, 16(%rsp)
+    movq  -72(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    movl  %eax, 8(%rsp)
+    movl  $5, %eax
+    movl  %eax, (%rsp)
+    movl  32(%rsp), %edi
+    movq  24(%rsp), %rsi
+    movq  16(%rsp), %rdx
+    movl  8(%rsp), %ecx
+    movl  (%rsp), %r8d
+    callq _new_token
+    addq  $40, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -64(%rbp), %rax
+    pushq %rax
+    movq  -64(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -72(%rbp), %rax
+    pushq %rax
+    movq  -88(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB471_4
+_LBB471_2:
+## assign
+    movq  -64(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    leaq  -56(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    jmp   _LBB470_0
+_LBB470_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_consume_punct:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _is_punct
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB481_3
+## if-then
+    movl  $0, %eax
+    jmp   _LBB480_0
+    jmp   _LBB481_2
+## if-else
+_LBB481_3:
+_LBB481_2:
+## assign
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    movq  (%rax), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movl  $1, %eax
+    jmp   _LBB480_0
+_LBB480_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_make_value:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+## func body
+## assign
+    leaq  -32(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -32(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    leaq  -32(%rbp), %rax
+    movq  %rax, %rsi
+    movq  (%rsi), %rax
+    movq  8(%rsi), %rdx
+    jmp   _LBB482_0
+_LBB482_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_convert_operands:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $64, %rsp
+## func params
+    movq  %rbp, %r10
+    subq  $16, %r10
+    movq  %rdi, (%r10)
+    movq  %rsi, 8(%r10)
+    movq  %rbp, %r10
+    subq  $32, %r10
+    movq  %rdx, (%r10)
+    movq  %rcx, 8(%r10)
+    movq  %r8, -40(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -40(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  -16(%rbp), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB484_2
+    leaq  -32(%rbp), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB484_2
+    movl  $0, %eax
+_LBB484_2:
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _make_value
+    addq  $16, %rsp
+    movq  %rax, -64(%rbp)
+    movq  %rdx, -56(%rbp)
+    leaq  -64(%rbp), %rax
+    movq  %rax, %rsi
+    movq  (%rsi), %rax
+    movq  8(%rsi), %rdx
+    jmp   _LBB483_0
+_LBB483_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_unsigned_less:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## if-cond
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    movslq %eax, %rax
+    movq  %rax, %rdx
+    popq  %rax
+    cmpq  %rdx, %rax
+    setl  %al
+    movzbl %al, %eax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    movslq %eax, %rax
+    movq  %rax, %rdx
+    popq  %rax
+    cmpq  %rdx, %rax
+    setl  %al
+    movzbl %al, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB486_3
+## if-then
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    movslq %eax, %rax
+    movq  %rax, %rdx
+    popq  %rax
+    cmpq  %rdx, %rax
+    setl  %al
+    movzbl %al, %eax
+    jmp   _LBB485_0
+    jmp   _LBB486_2
+## if-else
+_LBB486_3:
+_LBB486_2:
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    movq  %rax, %rdx
+    popq  %rax
+    cmpq  %rdx, %rax
+    setl  %al
+    movzbl %al, %eax
+    jmp   _LBB485_0
+_LBB485_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_value_less:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rbp, %r10
+    subq  $16, %r10
+    movq  %rdi, (%r10)
+    movq  %rsi, 8(%r10)
+    movq  %rbp, %r10
+    subq  $32, %r10
+    movq  %rdx, (%r10)
+    movq  %rcx, 8(%r10)
+## func body
+## if-cond
+    leaq  -16(%rbp), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB489_2
+    leaq  -32(%rbp), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB489_2
+    movl  $0, %eax
+_LBB489_2:
+    cmpl  $0, %eax
+    je    _LBB488_3
+## if-then
+    subq  $16, %rsp
+    leaq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  -32(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _unsigned_less
+    addq  $16, %rsp
+    jmp   _LBB487_0
+    jmp   _LBB488_2
+## if-else
+_LBB488_3:
+_LBB488_2:
+    leaq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    leaq  -32(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, %rdx
+    popq  %rax
+    cmpq  %rdx, %rax
+    setl  %al
+    movzbl %al, %eax
+    jmp   _LBB487_0
+_LBB487_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_unsigned_shift_right:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    movq  %rax, %rcx
+    popq  %rax
+    shrq  %cl, %rax
+    jmp   _LBB490_0
+_LBB490_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_unsigned_divide:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movl  %edx, -20(%rbp)
+## func body
+## if-cond
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    movslq %eax, %rax
+    movq  %rax, %rdx
+    popq  %rax
+    cmpq  %rdx, %rax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB492_3
+## if-then
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _unsigned_less
+    addq  $24, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB492_2
+## if-else
+_LBB492_3:
+## if-cond
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    movslq %eax, %rax
+    movq  %rax, %rdx
+    popq  %rax
+    cmpq  %rdx, %rax
+    setge %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB493_3
+## if-then
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    movq  %rax, %rdi
+    popq  %rax
+    cqto
+    idivq %rdi
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB493_2
+## if-else
+_LBB493_3:
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  $1, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _unsigned_shift_right
+    addq  $24, %rsp
+    pushq %rax
+    movq  -16(%rbp), %rax
+    movq  %rax, %rdi
+    popq  %rax
+    cqto
+    idivq %rdi
+    pushq %rax
+    movl  $2, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _unsigned_less
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB494_3
+## if-then
+    leaq  -32(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    jmp   _LBB494_2
+## if-else
+_LBB494_3:
+_LBB494_2:
+_LBB493_2:
+_LBB492_2:
+## if-cond
+    movl  -20(%rbp), %eax
+    cmpl  $0, %eax
+    je    _LBB495_3
+## if-then
+    movq  -32(%rbp), %rax
+    jmp   _LBB491_0
+    jmp   _LBB495_2
+## if-else
+_LBB495_3:
+_LBB495_2:
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    jmp   _LBB491_0
+_LBB491_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_char_constant:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## if-cond
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $92, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB497_3
+## if-then
+## local scalar init
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -12(%rbp), %rax
+    addq  $1, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -12(%rbp), %rax
+    addq  $2, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -12(%rbp), %rax
+    addq  $3, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $92, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## assign
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    popq  %rdx
+    movb  %al, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    leaq  -12(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _escape_sequence_to_char
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB498_3
+## if-then
+    movl  -16(%rbp), %eax
+    movslq %eax, %rax
+    jmp   _LBB496_0
+    jmp   _LBB498_2
+## if-else
+_LBB498_3:
+_LBB498_2:
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbq %al, %rax
+    jmp   _LBB496_0
+    jmp   _LBB497_2
+## if-else
+_LBB497_3:
+_LBB497_2:
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbq %al, %rax
+    jmp   _LBB496_0
+_LBB496_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_number_constant:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $64, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -36(%rbp), %rax
+    pushq %rax
+    movl  $10, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movq  -24(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $48, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB501_2
+    movq  -24(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $120, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB502_2
+    movq  -24(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $88, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB502_2
+    movl  $0, %eax
+_LBB502_2:
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB501_2
+    movl  $1, %eax
+_LBB501_2:
+    cmpl  $0, %eax
+    je    _LBB500_3
+## if-then
+## assign
+    leaq  -36(%rbp), %rax
+    pushq %rax
+    movl  $16, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## add-assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    addq  %rax, (%rdx)
+    movq  (%rdx), %rax
+    jmp   _LBB500_2
+## if-else
+_LBB500_3:
+## if-cond
+    movq  -24(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $48, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB503_3
+## if-then
+## assign
+    leaq  -36(%rbp), %rax
+    pushq %rax
+    movl  $8, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB503_2
+## if-else
+_LBB503_3:
+_LBB503_2:
+_LBB500_2:
+## for-pre
+## for-cond
+_LBB504_1:
+    movq  -24(%rbp), %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    je    _LBB504_2
+## for-body
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _isdigit
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB505_3
+## if-then
+## assign
+    leaq  -44(%rbp), %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $48, %eax
+    movl  %eax, %edx
+    popq  %rax
+    subl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB505_2
+## if-else
+_LBB505_3:
+## if-cond
+    movl  -36(%rbp), %eax
+    pushq %rax
+    movl  $16, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB508_2
+    movq  -24(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $97, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setge %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB508_2
+    movl  $1, %eax
+_LBB508_2:
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB507_2
+    movq  -24(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $102, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setle %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB507_2
+    movl  $1, %eax
+_LBB507_2:
+    cmpl  $0, %eax
+    je    _LBB506_3
+## if-then
+## assign
+    leaq  -44(%rbp), %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $97, %eax
+    movl  %eax, %edx
+    popq  %rax
+    subl  %edx, %eax
+    pushq %rax
+    movl  $10, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB506_2
+## if-else
+_LBB506_3:
+## if-cond
+    movl  -36(%rbp), %eax
+    pushq %rax
+    movl  $16, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB511_2
+    movq  -24(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $65, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setge %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB511_2
+    movl  $1, %eax
+_LBB511_2:
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB510_2
+    movq  -24(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $70, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setle %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB510_2
+    movl  $1, %eax
+_LBB510_2:
+    cmpl  $0, %eax
+    je    _LBB509_3
+## if-then
+## assign
+    leaq  -44(%rbp), %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $65, %eax
+    movl  %eax, %edx
+    popq  %rax
+    subl  %edx, %eax
+    pushq %rax
+    movl  $10, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB509_2
+## if-else
+_LBB509_3:
+    jmp   _LBB504_2
+_LBB509_2:
+_LBB506_2:
+_LBB505_2:
+## if-cond
+    movl  -44(%rbp), %eax
+    pushq %rax
+    movl  -36(%rbp), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setge %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB512_3
+## if-then
+    jmp   _LBB504_2
+    jmp   _LBB512_2
+## if-else
+_LBB512_3:
+_LBB512_2:
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    pushq %rax
+    movl  -36(%rbp), %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    pushq %rax
+    movl  -44(%rbp), %eax
+    movslq %eax, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-post
+_LBB504_4:
+    leaq  -24(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    jmp   _LBB504_1
+_LBB504_2:
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    movslq %eax, %rax
+    movq  %rax, %rdx
+    popq  %rax
+    cmpq  %rdx, %rax
+    setl  %al
+    movzbl %al, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-pre
+## for-cond
+_LBB513_1:
+    movq  -24(%rbp), %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    je    _LBB513_2
+## for-body
+## if-cond
+    movq  -24(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $117, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB515_2
+    movq  -24(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $85, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB515_2
+    movl  $0, %eax
+_LBB515_2:
+    cmpl  $0, %eax
+    je    _LBB514_3
+## if-then
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB514_2
+## if-else
+_LBB514_3:
+## if-cond
+    movq  -24(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $108, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB517_2
+    movq  -24(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $76, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB517_2
+    movl  $1, %eax
+_LBB517_2:
+    cmpl  $0, %eax
+    je    _LBB516_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2129(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _error_
+    addq  $16, %rsp
+    jmp   _LBB513_2
+    jmp   _LBB516_2
+## if-else
+_LBB516_3:
+_LBB516_2:
+_LBB514_2:
+## for-post
+_LBB513_4:
+    leaq  -24(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    jmp   _LBB513_1
+_LBB513_2:
+    subq  $16, %rsp
+    movq  -32(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -40(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _make_value
+    addq  $16, %rsp
+    movq  %rax, -64(%rbp)
+    movq  %rdx, -56(%rbp)
+    leaq  -64(%rbp), %rax
+    movq  %rax, %rsi
+    movq  (%rsi), %rax
+    movq  8(%rsi), %rdx
+    jmp   _LBB499_0
+_LBB499_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_cond_primary:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $64, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movl  %edx, -20(%rbp)
+## func body
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## if-cond
+    movq  -32(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB519_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2143(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _error_
+    addq  $16, %rsp
+    leaq  -48(%rbp), %rax
+    movq  %rax, %rsi
+    movq  (%rsi), %rax
+    movq  8(%rsi), %rdx
+    jmp   _LBB518_0
+    jmp   _LBB519_2
+## if-else
+_LBB519_3:
+_LBB519_2:
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1867(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _consume_punct
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB520_3
+## if-then
+## assign
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movl  (%rsp), %edx
+    callq _cond_conditional
+    addq  $24, %rsp
+    movq  %rax, -64(%rbp)
+    movq  %rdx, -56(%rbp)
+    leaq  -64(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1859(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _consume_punct
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB521_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2146(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _error_
+    addq  $16, %rsp
+    jmp   _LBB521_2
+## if-else
+_LBB521_3:
+_LBB521_2:
+    leaq  -48(%rbp), %rax
+    movq  %rax, %rsi
+    movq  (%rsi), %rax
+    movq  8(%rsi), %rdx
+    jmp   _LBB518_0
+    jmp   _LBB520_2
+## if-else
+_LBB520_3:
+_LBB520_2:
+## if-cond
+    movq  -32(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB523_2
+    subq  $16, %rsp
+    movq  -32(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2013(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB523_2
+    movl  $1, %eax
+_LBB523_2:
+    cmpl  $0, %eax
+    je    _LBB522_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2149(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _error_
+    addq  $16, %rsp
+## assign
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1867(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _is_punct
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB524_3
+## if-then
+## while-cond
+_LBB525_4:
+    movq  -16(%rbp), %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    movl  $0, %eax
+    je    _LBB526_2
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1859(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _is_punct
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB526_2
+    movl  $1, %eax
+_LBB526_2:
+    cmpl  $0, %eax
+    je    _LBB525_2
+## while-body
+## assign
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    movq  (%rax), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB525_4
+_LBB525_2:
+    jmp   _LBB524_2
+## if-else
+_LBB524_3:
+_LBB524_2:
+## if-cond
+    movq  -16(%rbp), %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    je    _LBB527_3
+## if-then
+## assign
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    movq  (%rax), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB527_2
+## if-else
+_LBB527_3:
+_LBB527_2:
+    leaq  -48(%rbp), %rax
+    movq  %rax, %rsi
+    movq  (%rsi), %rax
+    movq  8(%rsi), %rdx
+    jmp   _LBB518_0
+    jmp   _LBB522_2
+## if-else
+_LBB522_3:
+_LBB522_2:
+## if-cond
+    movq  -32(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB528_3
+## if-then
+## assign
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -32(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _number_constant
+    addq  $24, %rsp
+    movq  %rax, -64(%rbp)
+    movq  %rdx, -56(%rbp)
+    leaq  -64(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    jmp   _LBB528_2
+## if-else
+_LBB528_3:
+## if-cond
+    movq  -32(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB530_2
+    movq  -32(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $39, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB530_2
+    movl  $1, %eax
+_LBB530_2:
+    cmpl  $0, %eax
+    je    _LBB529_3
+## if-then
+## assign
+    leaq  -48(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -32(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _char_constant
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB529_2
+## if-else
+_LBB529_3:
+## if-cond
+    movq  -32(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB531_3
+## if-then
+## assign
+    leaq  -48(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $0, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB531_2
+## if-else
+_LBB531_3:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2151(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _error_
+    addq  $16, %rsp
+_LBB531_2:
+_LBB529_2:
+_LBB528_2:
+## assign
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    leaq  -48(%rbp), %rax
+    movq  %rax, %rsi
+    movq  (%rsi), %rax
+    movq  8(%rsi), %rdx
+    jmp   _LBB518_0
+_LBB518_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_cond_unary:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $64, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movl  %edx, -20(%rbp)
+## func body
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2161(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _consume_punct
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB533_3
+## if-then
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _cond_unary
+    addq  $32, %rsp
+    movq  %rax, -64(%rbp)
+    movq  %rdx, -56(%rbp)
+    leaq  -64(%rbp), %rax
+    movq  %rax, %rsi
+    movq  (%rsi), %rax
+    movq  8(%rsi), %rdx
+    jmp   _LBB532_0
+    jmp   _LBB533_2
+## if-else
+_LBB533_3:
+_LBB533_2:
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2162(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _consume_punct
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB534_3
+## if-then
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movl  (%rsp), %edx
+    callq _cond_unary
+    addq  $24, %rsp
+    movq  %rax, -64(%rbp)
+    movq  %rdx, -56(%rbp)
+    leaq  -64(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+## assign
+    leaq  -40(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    leaq  -40(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    leaq  -40(%rbp), %rax
+    movq  %rax, %rsi
+    movq  (%rsi), %rax
+    movq  8(%rsi), %rdx
+    jmp   _LBB532_0
+    jmp   _LBB534_2
+## if-else
+_LBB534_3:
+_LBB534_2:
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2165(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _consume_punct
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB535_3
+## if-then
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movl  (%rsp), %edx
+    callq _cond_unary
+    addq  $24, %rsp
+    movq  %rax, -64(%rbp)
+    movq  %rdx, -56(%rbp)
+    leaq  -64(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+## assign
+    leaq  -40(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    leaq  -40(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    notq  %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    leaq  -40(%rbp), %rax
+    movq  %rax, %rsi
+    movq  (%rsi), %rax
+    movq  8(%rsi), %rdx
+    jmp   _LBB532_0
+    jmp   _LBB535_2
+## if-else
+_LBB535_3:
+_LBB535_2:
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2168(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _consume_punct
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB536_3
+## if-then
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movl  (%rsp), %edx
+    callq _cond_unary
+    addq  $24, %rsp
+    movq  %rax, -64(%rbp)
+    movq  %rdx, -56(%rbp)
+    leaq  -64(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    subq  $16, %rsp
+    leaq  -40(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _make_value
+    addq  $16, %rsp
+    movq  %rax, -64(%rbp)
+    movq  %rdx, -56(%rbp)
+    leaq  -64(%rbp), %rax
+    movq  %rax, %rsi
+    movq  (%rsi), %rax
+    movq  8(%rsi), %rdx
+    jmp   _LBB532_0
+    jmp   _LBB536_2
+## if-else
+_LBB536_3:
+_LBB536_2:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _cond_primary
+    addq  $32, %rsp
+    movq  %rax, -64(%rbp)
+    movq  %rdx, -56(%rbp)
+    leaq  -64(%rbp), %rax
+    movq  %rax, %rsi
+    movq  (%rsi), %rax
+    movq  8(%rsi), %rdx
+    jmp   _LBB532_0
+_LBB532_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_cond_multiplicative:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $96, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movl  %edx, -20(%rbp)
+## func body
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movl  (%rsp), %edx
+    callq _cond_unary
+    addq  $24, %rsp
+    movq  %rax, -96(%rbp)
+    movq  %rdx, -88(%rbp)
+    leaq  -96(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+## for-pre
+## for-cond
+_LBB538_1:
+    movl  $1, %eax
+    cmpl  $0, %eax
+    je    _LBB538_2
+## for-body
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2181(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _consume_punct
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB539_3
+## if-then
+## local scalar init
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movl  (%rsp), %edx
+    callq _cond_unary
+    addq  $24, %rsp
+    movq  %rax, -96(%rbp)
+    movq  %rdx, -88(%rbp)
+    leaq  -96(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $40, %rsp
+    leaq  -40(%rbp), %rax
+    movq  (%rax), %r10
+    movq  %r10, 24(%rsp)
+    movq  8(%rax), %r10
+    movq  %r10, 32(%rsp)
+    leaq  -56(%rbp), %rax
+    movq  (%rax), %r10
+    movq  %r10, 8(%rsp)
+    movq  8(%rax), %r10
+    movq  %r10, 16(%rsp)
+    leaq  -40(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    leaq  -56(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movq  %rax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  32(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movq  16(%rsp), %rcx
+    movq  (%rsp), %r8
+    callq _convert_operands
+    addq  $40, %rsp
+    movq  %rax, -96(%rbp)
+    movq  %rdx, -88(%rbp)
+    leaq  -96(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    jmp   _LBB539_2
+## if-else
+_LBB539_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2185(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _is_punct
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB541_2
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2186(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _is_punct
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB541_2
+    movl  $0, %eax
+_LBB541_2:
+    cmpl  $0, %eax
+    je    _LBB540_3
+## if-then
+## local scalar init
+    leaq  -60(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -16(%rbp), %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_2185(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _is_punct
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    movq  (%rax), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -80(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movl  (%rsp), %edx
+    callq _cond_unary
+    addq  $24, %rsp
+    movq  %rax, -96(%rbp)
+    movq  %rdx, -88(%rbp)
+    leaq  -96(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+## if-cond
+    leaq  -80(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $0, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB542_3
+## if-then
+## if-cond
+    movl  -20(%rbp), %eax
+    cmpl  $0, %eax
+    je    _LBB543_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2191(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _error_
+    addq  $16, %rsp
+    jmp   _LBB543_2
+## if-else
+_LBB543_3:
+_LBB543_2:
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $40, %rsp
+    leaq  -40(%rbp), %rax
+    movq  (%rax), %r10
+    movq  %r10, 24(%rsp)
+    movq  8(%rax), %r10
+    movq  %r10, 32(%rsp)
+    leaq  -80(%rbp), %rax
+    movq  (%rax), %r10
+    movq  %r10, 8(%rsp)
+    movq  8(%rax), %r10
+    movq  %r10, 16(%rsp)
+    movl  $0, %eax
+    movslq %eax, %rax
+    movq  %rax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  32(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movq  16(%rsp), %rcx
+    movq  (%rsp), %r8
+    callq _convert_operands
+    addq  $40, %rsp
+    movq  %rax, -96(%rbp)
+    movq  %rdx, -88(%rbp)
+    leaq  -96(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    jmp   _LBB542_2
+## if-else
+_LBB542_3:
+## if-cond
+    leaq  -40(%rbp), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB545_2
+    leaq  -80(%rbp), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB545_2
+    movl  $0, %eax
+_LBB545_2:
+    cmpl  $0, %eax
+    je    _LBB544_3
+## if-then
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $40, %rsp
+    leaq  -40(%rbp), %rax
+    movq  (%rax), %r10
+    movq  %r10, 24(%rsp)
+    movq  8(%rax), %r10
+    movq  %r10, 32(%rsp)
+    leaq  -80(%rbp), %rax
+    movq  (%rax), %r10
+    movq  %r10, 8(%rsp)
+    movq  8(%rax), %r10
+    movq  %r10, 16(%rsp)
+    subq  $32, %rsp
+    leaq  -40(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    leaq  -80(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movl  -60(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _unsigned_divide
+    addq  $32, %rsp
+    movq  %rax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  32(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movq  16(%rsp), %rcx
+    movq  (%rsp), %r8
+    callq _convert_operands
+    addq  $40, %rsp
+    movq  %rax, -96(%rbp)
+    movq  %rdx, -88(%rbp)
+    leaq  -96(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    jmp   _LBB544_2
+## if-else
+_LBB544_3:
+## assign
+    leaq  -40(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+## cond-?
+    movl  -60(%rbp), %eax
+    cmpq  $0, %rax
+    je    _LBB546_3
+## cond-then
+    leaq  -40(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    leaq  -80(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, %rdi
+    popq  %rax
+    cqto
+    idivq %rdi
+    jmp   _LBB546_2
+## cond-else
+_LBB546_3:
+    leaq  -40(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    leaq  -80(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, %rdi
+    popq  %rax
+    cqto
+    idivq %rdi
+    movq  %rdx, %rax
+_LBB546_2:
+    popq  %rdx
+    movq  %rax, (%rdx)
+_LBB544_2:
+_LBB542_2:
+    jmp   _LBB540_2
+## if-else
+_LBB540_3:
+    leaq  -40(%rbp), %rax
+    movq  %rax, %rsi
+    movq  (%rsi), %rax
+    movq  8(%rsi), %rdx
+    jmp   _LBB537_0
+_LBB540_2:
+_LBB539_2:
+## for-post
+_LBB538_4:
+    jmp   _LBB538_1
+_LBB538_2:
+_LBB537_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_cond_additive:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $80, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movl  %edx, -20(%rbp)
+## func body
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movl  (%rsp), %edx
+    callq _cond_multiplicative
+    addq  $24, %rsp
+    movq  %rax, -80(%rbp)
+    movq  %rdx, -72(%rbp)
+    leaq  -80(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+## for-pre
+## for-cond
+_LBB548_1:
+    movl  $1, %eax
+    cmpl  $0, %eax
+    je    _LBB548_2
+## for-body
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2161(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _consume_punct
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB549_3
+## if-then
+## assign
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movl  (%rsp), %edx
+    callq _cond_multiplicative
+    addq  $24, %rsp
+    movq  %rax, -80(%rbp)
+    movq  %rdx, -72(%rbp)
+    leaq  -80(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $40, %rsp
+    leaq  -40(%rbp), %rax
+    movq  (%rax), %r10
+    movq  %r10, 24(%rsp)
+    movq  8(%rax), %r10
+    movq  %r10, 32(%rsp)
+    leaq  -56(%rbp), %rax
+    movq  (%rax), %r10
+    movq  %r10, 8(%rsp)
+    movq  8(%rax), %r10
+    movq  %r10, 16(%rsp)
+    leaq  -40(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    leaq  -56(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  %rax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  32(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movq  16(%rsp), %rcx
+    movq  (%rsp), %r8
+    callq _convert_operands
+    addq  $40, %rsp
+    movq  %rax, -80(%rbp)
+    movq  %rdx, -72(%rbp)
+    leaq  -80(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    jmp   _LBB549_2
+## if-else
+_LBB549_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2162(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _consume_punct
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB550_3
+## if-then
+## assign
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movl  (%rsp), %edx
+    callq _cond_multiplicative
+    addq  $24, %rsp
+    movq  %rax, -80(%rbp)
+    movq  %rdx, -72(%rbp)
+    leaq  -80(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $40, %rsp
+    leaq  -40(%rbp), %rax
+    movq  (%rax), %r10
+    movq  %r10, 24(%rsp)
+    movq  8(%rax), %r10
+    movq  %r10, 32(%rsp)
+    leaq  -56(%rbp), %rax
+    movq  (%rax), %r10
+    movq  %r10, 8(%rsp)
+    movq  8(%rax), %r10
+    movq  %r10, 16(%rsp)
+    leaq  -40(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    leaq  -56(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    movq  %rax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  32(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movq  16(%rsp), %rcx
+    movq  (%rsp), %r8
+    callq _convert_operands
+    addq  $40, %rsp
+    movq  %rax, -80(%rbp)
+    movq  %rdx, -72(%rbp)
+    leaq  -80(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    jmp   _LBB550_2
+## if-else
+_LBB550_3:
+    leaq  -40(%rbp), %rax
+    movq  %rax, %rsi
+    movq  (%rsi), %rax
+    movq  8(%rsi), %rdx
+    jmp   _LBB547_0
+_LBB550_2:
+_LBB549_2:
+## for-post
+_LBB548_4:
+    jmp   _LBB548_1
+_LBB548_2:
+_LBB547_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_cond_shift:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $80, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movl  %edx, -20(%rbp)
+## func body
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movl  (%rsp), %edx
+    callq _cond_additive
+    addq  $24, %rsp
+    movq  %rax, -80(%rbp)
+    movq  %rdx, -72(%rbp)
+    leaq  -80(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+## for-pre
+## for-cond
+_LBB552_1:
+    movl  $1, %eax
+    cmpl  $0, %eax
+    je    _LBB552_2
+## for-body
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1232(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _consume_punct
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB553_3
+## if-then
+## assign
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movl  (%rsp), %edx
+    callq _cond_additive
+    addq  $24, %rsp
+    movq  %rax, -80(%rbp)
+    movq  %rdx, -72(%rbp)
+    leaq  -80(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+## shl-assign
+    leaq  -40(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    leaq  -56(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    popq  %rdx
+    movq  (%rdx), %rax
+    shlq  %cl, %rax
+    movq  %rax, (%rdx)
+    jmp   _LBB553_2
+## if-else
+_LBB553_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1233(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _consume_punct
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB554_3
+## if-then
+## assign
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movl  (%rsp), %edx
+    callq _cond_additive
+    addq  $24, %rsp
+    movq  %rax, -80(%rbp)
+    movq  %rdx, -72(%rbp)
+    leaq  -80(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+## if-cond
+    leaq  -40(%rbp), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    je    _LBB555_3
+## if-then
+## assign
+    leaq  -40(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    subq  $24, %rsp
+    leaq  -40(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    leaq  -56(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _unsigned_shift_right
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB555_2
+## if-else
+_LBB555_3:
+## shr-assign
+    leaq  -40(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    leaq  -56(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    popq  %rdx
+    movq  (%rdx), %rax
+    sarq  %cl, %rax
+    movq  %rax, (%rdx)
+_LBB555_2:
+    jmp   _LBB554_2
+## if-else
+_LBB554_3:
+    leaq  -40(%rbp), %rax
+    movq  %rax, %rsi
+    movq  (%rsi), %rax
+    movq  8(%rsi), %rdx
+    jmp   _LBB551_0
+_LBB554_2:
+_LBB553_2:
+## for-post
+_LBB552_4:
+    jmp   _LBB552_1
+_LBB552_2:
+_LBB551_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_cond_relational:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $80, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movl  %edx, -20(%rbp)
+## func body
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movl  (%rsp), %edx
+    callq _cond_shift
+    addq  $24, %rsp
+    movq  %rax, -80(%rbp)
+    movq  %rdx, -72(%rbp)
+    leaq  -80(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+## for-pre
+## for-cond
+_LBB557_1:
+    movl  $1, %eax
+    cmpl  $0, %eax
+    je    _LBB557_2
+## for-body
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2248(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _consume_punct
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB558_3
+## if-then
+## assign
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movl  (%rsp), %edx
+    callq _cond_shift
+    addq  $24, %rsp
+    movq  %rax, -80(%rbp)
+    movq  %rdx, -72(%rbp)
+    leaq  -80(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    subq  $32, %rsp
+    leaq  -40(%rbp), %rax
+    movq  (%rax), %r10
+    movq  %r10, 16(%rsp)
+    movq  8(%rax), %r10
+    movq  %r10, 24(%rsp)
+    leaq  -56(%rbp), %rax
+    movq  (%rax), %r10
+    movq  %r10, (%rsp)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  24(%rsp), %rsi
+    movq  (%rsp), %rdx
+    movq  8(%rsp), %rcx
+    callq _value_less
+    addq  $32, %rsp
+    movslq %eax, %rax
+    movq  %rax, 16(%rsp)
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movl  8(%rsp), %esi
+    callq _make_value
+    addq  $24, %rsp
+    movq  %rax, -80(%rbp)
+    movq  %rdx, -72(%rbp)
+    leaq  -80(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    jmp   _LBB558_2
+## if-else
+_LBB558_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2251(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _consume_punct
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB559_3
+## if-then
+## assign
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movl  (%rsp), %edx
+    callq _cond_shift
+    addq  $24, %rsp
+    movq  %rax, -80(%rbp)
+    movq  %rdx, -72(%rbp)
+    leaq  -80(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    subq  $32, %rsp
+    leaq  -56(%rbp), %rax
+    movq  (%rax), %r10
+    movq  %r10, 16(%rsp)
+    movq  8(%rax), %r10
+    movq  %r10, 24(%rsp)
+    leaq  -40(%rbp), %rax
+    movq  (%rax), %r10
+    movq  %r10, (%rsp)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  24(%rsp), %rsi
+    movq  (%rsp), %rdx
+    movq  8(%rsp), %rcx
+    callq _value_less
+    addq  $32, %rsp
+    movslq %eax, %rax
+    movq  %rax, 16(%rsp)
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movl  8(%rsp), %esi
+    callq _make_value
+    addq  $24, %rsp
+    movq  %rax, -80(%rbp)
+    movq  %rdx, -72(%rbp)
+    leaq  -80(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    jmp   _LBB559_2
+## if-else
+_LBB559_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1234(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _consume_punct
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB560_3
+## if-then
+## assign
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movl  (%rsp), %edx
+    callq _cond_shift
+    addq  $24, %rsp
+    movq  %rax, -80(%rbp)
+    movq  %rdx, -72(%rbp)
+    leaq  -80(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    subq  $32, %rsp
+    leaq  -56(%rbp), %rax
+    movq  (%rax), %r10
+    movq  %r10, 16(%rsp)
+    movq  8(%rax), %r10
+    movq  %r10, 24(%rsp)
+    leaq  -40(%rbp), %rax
+    movq  (%rax), %r10
+    movq  %r10, (%rsp)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  24(%rsp), %rsi
+    movq  (%rsp), %rdx
+    movq  8(%rsp), %rcx
+    callq _value_less
+    addq  $32, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    movslq %eax, %rax
+    movq  %rax, 16(%rsp)
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movl  8(%rsp), %esi
+    callq _make_value
+    addq  $24, %rsp
+    movq  %rax, -80(%rbp)
+    movq  %rdx, -72(%rbp)
+    leaq  -80(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    jmp   _LBB560_2
+## if-else
+_LBB560_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1235(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _consume_punct
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB561_3
+## if-then
+## assign
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movl  (%rsp), %edx
+    callq _cond_shift
+    addq  $24, %rsp
+    movq  %rax, -80(%rbp)
+    movq  %rdx, -72(%rbp)
+    leaq  -80(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    subq  $32, %rsp
+    leaq  -40(%rbp), %rax
+    movq  (%rax), %r10
+    movq  %r10, 16(%rsp)
+    movq  8(%rax), %r10
+    movq  %r10, 24(%rsp)
+    leaq  -56(%rbp), %rax
+    movq  (%rax), %r10
+    movq  %r10, (%rsp)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  24(%rsp), %rsi
+    movq  (%rsp), %rdx
+    movq  8(%rsp), %rcx
+    callq _value_less
+    addq  $32, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    movslq %eax, %rax
+    movq  %rax, 16(%rsp)
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movl  8(%rsp), %esi
+    callq _make_value
+    addq  $24, %rsp
+    movq  %rax, -80(%rbp)
+    movq  %rdx, -72(%rbp)
+    leaq  -80(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    jmp   _LBB561_2
+## if-else
+_LBB561_3:
+    leaq  -40(%rbp), %rax
+    movq  %rax, %rsi
+    movq  (%rsi), %rax
+    movq  8(%rsi), %rdx
+    jmp   _LBB556_0
+_LBB561_2:
+_LBB560_2:
+_LBB559_2:
+_LBB558_2:
+## for-post
+_LBB557_4:
+    jmp   _LBB557_1
+_LBB557_2:
+_LBB556_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_cond_equality:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $80, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movl  %edx, -20(%rbp)
+## func body
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movl  (%rsp), %edx
+    callq _cond_relational
+    addq  $24, %rsp
+    movq  %rax, -80(%rbp)
+    movq  %rdx, -72(%rbp)
+    leaq  -80(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+## for-pre
+## for-cond
+_LBB563_1:
+    movl  $1, %eax
+    cmpl  $0, %eax
+    je    _LBB563_2
+## for-body
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1236(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _consume_punct
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB564_3
+## if-then
+## assign
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movl  (%rsp), %edx
+    callq _cond_relational
+    addq  $24, %rsp
+    movq  %rax, -80(%rbp)
+    movq  %rdx, -72(%rbp)
+    leaq  -80(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    leaq  -40(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    leaq  -56(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    sete  %al
+    movzbl %al, %eax
+    movslq %eax, %rax
+    movq  %rax, 16(%rsp)
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movl  8(%rsp), %esi
+    callq _make_value
+    addq  $24, %rsp
+    movq  %rax, -80(%rbp)
+    movq  %rdx, -72(%rbp)
+    leaq  -80(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    jmp   _LBB564_2
+## if-else
+_LBB564_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1237(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _consume_punct
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB565_3
+## if-then
+## assign
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movl  (%rsp), %edx
+    callq _cond_relational
+    addq  $24, %rsp
+    movq  %rax, -80(%rbp)
+    movq  %rdx, -72(%rbp)
+    leaq  -80(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    leaq  -40(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    leaq  -56(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    setne %al
+    movzbl %al, %eax
+    movslq %eax, %rax
+    movq  %rax, 16(%rsp)
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movl  8(%rsp), %esi
+    callq _make_value
+    addq  $24, %rsp
+    movq  %rax, -80(%rbp)
+    movq  %rdx, -72(%rbp)
+    leaq  -80(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    jmp   _LBB565_2
+## if-else
+_LBB565_3:
+    leaq  -40(%rbp), %rax
+    movq  %rax, %rsi
+    movq  (%rsi), %rax
+    movq  8(%rsi), %rdx
+    jmp   _LBB562_0
+_LBB565_2:
+_LBB564_2:
+## for-post
+_LBB563_4:
+    jmp   _LBB563_1
+_LBB563_2:
+_LBB562_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_cond_and:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $80, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movl  %edx, -20(%rbp)
+## func body
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movl  (%rsp), %edx
+    callq _cond_equality
+    addq  $24, %rsp
+    movq  %rax, -80(%rbp)
+    movq  %rdx, -72(%rbp)
+    leaq  -80(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+## while-cond
+_LBB567_4:
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2288(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _consume_punct
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB567_2
+## while-body
+## local scalar init
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movl  (%rsp), %edx
+    callq _cond_equality
+    addq  $24, %rsp
+    movq  %rax, -80(%rbp)
+    movq  %rdx, -72(%rbp)
+    leaq  -80(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $40, %rsp
+    leaq  -40(%rbp), %rax
+    movq  (%rax), %r10
+    movq  %r10, 24(%rsp)
+    movq  8(%rax), %r10
+    movq  %r10, 32(%rsp)
+    leaq  -56(%rbp), %rax
+    movq  (%rax), %r10
+    movq  %r10, 8(%rsp)
+    movq  8(%rax), %r10
+    movq  %r10, 16(%rsp)
+    leaq  -40(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    leaq  -56(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    andq  %rdx, %rax
+    movq  %rax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  32(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movq  16(%rsp), %rcx
+    movq  (%rsp), %r8
+    callq _convert_operands
+    addq  $40, %rsp
+    movq  %rax, -80(%rbp)
+    movq  %rdx, -72(%rbp)
+    leaq  -80(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    jmp   _LBB567_4
+_LBB567_2:
+    leaq  -40(%rbp), %rax
+    movq  %rax, %rsi
+    movq  (%rsi), %rax
+    movq  8(%rsi), %rdx
+    jmp   _LBB566_0
+_LBB566_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_cond_xor:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $80, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movl  %edx, -20(%rbp)
+## func body
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movl  (%rsp), %edx
+    callq _cond_and
+    addq  $24, %rsp
+    movq  %rax, -80(%rbp)
+    movq  %rdx, -72(%rbp)
+    leaq  -80(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+## while-cond
+_LBB569_4:
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2301(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _consume_punct
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB569_2
+## while-body
+## local scalar init
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movl  (%rsp), %edx
+    callq _cond_and
+    addq  $24, %rsp
+    movq  %rax, -80(%rbp)
+    movq  %rdx, -72(%rbp)
+    leaq  -80(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $40, %rsp
+    leaq  -40(%rbp), %rax
+    movq  (%rax), %r10
+    movq  %r10, 24(%rsp)
+    movq  8(%rax), %r10
+    movq  %r10, 32(%rsp)
+    leaq  -56(%rbp), %rax
+    movq  (%rax), %r10
+    movq  %r10, 8(%rsp)
+    movq  8(%rax), %r10
+    movq  %r10, 16(%rsp)
+    leaq  -40(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    leaq  -56(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    xorq  %rdx, %rax
+    movq  %rax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  32(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movq  16(%rsp), %rcx
+    movq  (%rsp), %r8
+    callq _convert_operands
+    addq  $40, %rsp
+    movq  %rax, -80(%rbp)
+    movq  %rdx, -72(%rbp)
+    leaq  -80(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    jmp   _LBB569_4
+_LBB569_2:
+    leaq  -40(%rbp), %rax
+    movq  %rax, %rsi
+    movq  (%rsi), %rax
+    movq  8(%rsi), %rdx
+    jmp   _LBB568_0
+_LBB568_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_cond_or:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $80, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movl  %edx, -20(%rbp)
+## func body
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movl  (%rsp), %edx
+    callq _cond_xor
+    addq  $24, %rsp
+    movq  %rax, -80(%rbp)
+    movq  %rdx, -72(%rbp)
+    leaq  -80(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+## while-cond
+_LBB571_4:
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2314(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _consume_punct
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB571_2
+## while-body
+## local scalar init
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movl  (%rsp), %edx
+    callq _cond_xor
+    addq  $24, %rsp
+    movq  %rax, -80(%rbp)
+    movq  %rdx, -72(%rbp)
+    leaq  -80(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $40, %rsp
+    leaq  -40(%rbp), %rax
+    movq  (%rax), %r10
+    movq  %r10, 24(%rsp)
+    movq  8(%rax), %r10
+    movq  %r10, 32(%rsp)
+    leaq  -56(%rbp), %rax
+    movq  (%rax), %r10
+    movq  %r10, 8(%rsp)
+    movq  8(%rax), %r10
+    movq  %r10, 16(%rsp)
+    leaq  -40(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    leaq  -56(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    orq   %rdx, %rax
+    movq  %rax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  32(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movq  16(%rsp), %rcx
+    movq  (%rsp), %r8
+    callq _convert_operands
+    addq  $40, %rsp
+    movq  %rax, -80(%rbp)
+    movq  %rdx, -72(%rbp)
+    leaq  -80(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    jmp   _LBB571_4
+_LBB571_2:
+    leaq  -40(%rbp), %rax
+    movq  %rax, %rsi
+    movq  (%rsi), %rax
+    movq  8(%rsi), %rdx
+    jmp   _LBB570_0
+_LBB570_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_cond_logical_and:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $80, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movl  %edx, -20(%rbp)
+## func body
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movl  (%rsp), %edx
+    callq _cond_or
+    addq  $24, %rsp
+    movq  %rax, -80(%rbp)
+    movq  %rdx, -72(%rbp)
+    leaq  -80(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+## while-cond
+_LBB573_4:
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1238(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _consume_punct
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB573_2
+## while-body
+## local scalar init
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB574_2
+    leaq  -40(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    movl  $0, %eax
+    je    _LBB574_2
+    movl  $1, %eax
+_LBB574_2:
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movl  (%rsp), %edx
+    callq _cond_or
+    addq  $24, %rsp
+    movq  %rax, -80(%rbp)
+    movq  %rdx, -72(%rbp)
+    leaq  -80(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    leaq  -40(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    movl  $0, %eax
+    je    _LBB575_2
+    leaq  -56(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    movl  $0, %eax
+    je    _LBB575_2
+    movl  $1, %eax
+_LBB575_2:
+    movslq %eax, %rax
+    movq  %rax, 16(%rsp)
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movl  8(%rsp), %esi
+    callq _make_value
+    addq  $24, %rsp
+    movq  %rax, -80(%rbp)
+    movq  %rdx, -72(%rbp)
+    leaq  -80(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    jmp   _LBB573_4
+_LBB573_2:
+    leaq  -40(%rbp), %rax
+    movq  %rax, %rsi
+    movq  (%rsi), %rax
+    movq  8(%rsi), %rdx
+    jmp   _LBB572_0
+_LBB572_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_cond_logical_or:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $80, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movl  %edx, -20(%rbp)
+## func body
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movl  (%rsp), %edx
+    callq _cond_logical_and
+    addq  $24, %rsp
+    movq  %rax, -80(%rbp)
+    movq  %rdx, -72(%rbp)
+    leaq  -80(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+## while-cond
+_LBB577_4:
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1239(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _consume_punct
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB577_2
+## while-body
+## local scalar init
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB578_2
+    leaq  -40(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB578_2
+    movl  $1, %eax
+_LBB578_2:
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movl  (%rsp), %edx
+    callq _cond_logical_and
+    addq  $24, %rsp
+    movq  %rax, -80(%rbp)
+    movq  %rdx, -72(%rbp)
+    leaq  -80(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    leaq  -40(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    movl  $1, %eax
+    jne   _LBB579_2
+    leaq  -56(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    movl  $1, %eax
+    jne   _LBB579_2
+    movl  $0, %eax
+_LBB579_2:
+    movslq %eax, %rax
+    movq  %rax, 16(%rsp)
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movl  8(%rsp), %esi
+    callq _make_value
+    addq  $24, %rsp
+    movq  %rax, -80(%rbp)
+    movq  %rdx, -72(%rbp)
+    leaq  -80(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    jmp   _LBB577_4
+_LBB577_2:
+    leaq  -40(%rbp), %rax
+    movq  %rax, %rsi
+    movq  (%rsi), %rax
+    movq  8(%rsi), %rdx
+    jmp   _LBB576_0
+_LBB576_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_cond_conditional:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $96, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movl  %edx, -20(%rbp)
+## func body
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movl  (%rsp), %edx
+    callq _cond_logical_or
+    addq  $24, %rsp
+    movq  %rax, -96(%rbp)
+    movq  %rdx, -88(%rbp)
+    leaq  -96(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2353(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _consume_punct
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB581_3
+## if-then
+    leaq  -40(%rbp), %rax
+    movq  %rax, %rsi
+    movq  (%rsi), %rax
+    movq  8(%rsi), %rdx
+    jmp   _LBB580_0
+    jmp   _LBB581_2
+## if-else
+_LBB581_3:
+_LBB581_2:
+## assign
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB582_2
+    leaq  -40(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    movl  $0, %eax
+    je    _LBB582_2
+    movl  $1, %eax
+_LBB582_2:
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movl  (%rsp), %edx
+    callq _cond_conditional
+    addq  $24, %rsp
+    movq  %rax, -96(%rbp)
+    movq  %rdx, -88(%rbp)
+    leaq  -96(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2354(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _consume_punct
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB583_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2355(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _error_
+    addq  $16, %rsp
+    jmp   _LBB583_2
+## if-else
+_LBB583_3:
+_LBB583_2:
+## assign
+    leaq  -72(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB584_2
+    leaq  -40(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB584_2
+    movl  $1, %eax
+_LBB584_2:
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movl  (%rsp), %edx
+    callq _cond_conditional
+    addq  $24, %rsp
+    movq  %rax, -96(%rbp)
+    movq  %rdx, -88(%rbp)
+    leaq  -96(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    subq  $48, %rsp
+    leaq  -56(%rbp), %rax
+    movq  (%rax), %r10
+    movq  %r10, 32(%rsp)
+    movq  8(%rax), %r10
+    movq  %r10, 40(%rsp)
+    leaq  -72(%rbp), %rax
+    movq  (%rax), %r10
+    movq  %r10, 16(%rsp)
+    movq  8(%rax), %r10
+    movq  %r10, 24(%rsp)
+## cond-?
+    leaq  -40(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    je    _LBB585_3
+## cond-then
+    leaq  -56(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    jmp   _LBB585_2
+## cond-else
+_LBB585_3:
+    leaq  -72(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+_LBB585_2:
+    movq  %rax, 8(%rsp)
+    movq  32(%rsp), %rdi
+    movq  40(%rsp), %rsi
+    movq  16(%rsp), %rdx
+    movq  24(%rsp), %rcx
+    movq  8(%rsp), %r8
+    callq _convert_operands
+    addq  $48, %rsp
+    movq  %rax, -96(%rbp)
+    movq  %rdx, -88(%rbp)
+    leaq  -96(%rbp), %rax
+    movq  %rax, %rsi
+    movq  (%rsi), %rax
+    movq  8(%rsi), %rdx
+    jmp   _LBB580_0
+_LBB580_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_const_expression:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $80, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+    subq  $16, %rsp
+    leaq  -40(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $0, %eax
+    movslq %eax, %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strbuf_init
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  -40(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _read_line_text
+    addq  $16, %rsp
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    leaq  -40(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movl  $5, %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movq  %rax, (%rsp)
+    movq  16(%rsp), %rdi
+    movl  8(%rsp), %esi
+    movq  (%rsp), %rdx
+    callq _tokenize_text
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _replace_defined
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $0, %eax
+    movq  %rax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _expand_tokens
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    leaq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $1, %eax
+    movl  %eax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movl  (%rsp), %edx
+    callq _cond_conditional
+    addq  $24, %rsp
+    movq  %rax, -80(%rbp)
+    movq  %rdx, -72(%rbp)
+    leaq  -80(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+## if-cond
+    movq  -16(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB587_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2365(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _error_
+    addq  $16, %rsp
+    jmp   _LBB587_2
+## if-else
+_LBB587_3:
+_LBB587_2:
+    subq  $16, %rsp
+    leaq  -40(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _strbuf_free
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $5, %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _reset_arena
+    addq  $16, %rsp
+    leaq  -56(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    jmp   _LBB586_0
+_LBB586_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_begin_group:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -12(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _push_cond
+    addq  $16, %rsp
+## if-cond
+    movl  -12(%rbp), %eax
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB589_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _skip_block
+    addq  $16, %rsp
+    jmp   _LBB589_2
+## if-else
+_LBB589_3:
+_LBB589_2:
+_LBB588_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_skip_rest_of_group:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_skipping
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB591_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _skip_inactive_lines
+    addq  $16, %rsp
+    jmp   _LBB591_2
+## if-else
+_LBB591_3:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _skip_block
+    addq  $16, %rsp
+_LBB591_2:
+_LBB590_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_if_part:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _const_expression
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _new_line
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    setne %al
+    movzbl %al, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _begin_group
+    addq  $16, %rsp
+_LBB592_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_ifdef_part:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _ident_2392(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _token
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _new_line
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $40, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _ident_2392(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _lookup_macro
+    addq  $16, %rsp
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    setne %al
+    movzbl %al, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _begin_group
+    addq  $16, %rsp
+_LBB593_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_ifndef_part:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _ident_2399(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _token
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _new_line
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $40, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _ident_2399(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _lookup_macro
+    addq  $16, %rsp
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    sete  %al
+    movzbl %al, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _begin_group
+    addq  $16, %rsp
+_LBB594_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_elif_part:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $120, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB597_2
+    movq  -8(%rbp), %rax
+    addq  $120, %rax
+    movq  (%rax), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB597_2
+    movl  $0, %eax
+_LBB597_2:
+    cmpl  $0, %eax
+    je    _LBB596_3
+## if-then
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $120, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB598_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2409(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _error_
+    addq  $16, %rsp
+    jmp   _LBB598_2
+## if-else
+_LBB598_3:
+_LBB598_2:
+    subq  $16, %rsp
+    leaq  -40(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $0, %eax
+    movslq %eax, %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strbuf_init
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  -40(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _read_line_text
+    addq  $16, %rsp
+    subq  $16, %rsp
+    leaq  -40(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _strbuf_free
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _new_line
+    addq  $16, %rsp
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $120, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    je    _LBB599_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _skip_rest_of_group
+    addq  $16, %rsp
+    jmp   _LBB599_2
+## if-else
+_LBB599_3:
+_LBB599_2:
+    jmp   _LBB595_0
+    jmp   _LBB596_2
+## if-else
+_LBB596_3:
+_LBB596_2:
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _const_expression
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _new_line
+    addq  $16, %rsp
+## if-cond
+    movq  -16(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB600_3
+## if-then
+## assign
+    movq  -8(%rbp), %rax
+    addq  $120, %rax
+    movq  (%rax), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $116, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB600_2
+## if-else
+_LBB600_3:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _skip_inactive_lines
+    addq  $16, %rsp
+_LBB600_2:
+_LBB595_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_else_part:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $120, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB602_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2422(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _error_
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _new_line
+    addq  $16, %rsp
+    jmp   _LBB601_0
+    jmp   _LBB602_2
+## if-else
+_LBB602_3:
+_LBB602_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _new_line
+    addq  $16, %rsp
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $120, %rax
+    movq  (%rax), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    je    _LBB603_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _skip_rest_of_group
+    addq  $16, %rsp
+    jmp   _LBB603_2
+## if-else
+_LBB603_3:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $120, %rax
+    movq  (%rax), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $116, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+_LBB603_2:
+_LBB601_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_endif_line:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $120, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB605_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2435(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _error_
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _new_line
+    addq  $16, %rsp
+    jmp   _LBB604_0
+    jmp   _LBB605_2
+## if-else
+_LBB605_3:
+_LBB605_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _new_line
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _pop_cond
+    addq  $16, %rsp
+## assign
+    movq  -8(%rbp), %rax
+    addq  $116, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+_LBB604_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_text_lines:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## for-pre
+## for-cond
+_LBB607_1:
+    movl  $1, %eax
+    cmpl  $0, %eax
+    je    _LBB607_2
+## for-body
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $136, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    je    _LBB608_3
+## if-then
+    movl  $0, %eax
+    jmp   _LBB606_0
+    jmp   _LBB608_2
+## if-else
+_LBB608_3:
+_LBB608_2:
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $1024, %eax
+    pushq %rax
+    movl  $16, %eax
+    popq  %rdx
+    imull %edx, %eax
+    movslq %eax, %rax
+    movq  %rax, %rdx
+    popq  %rax
+    cmpq  %rdx, %rax
+    setge %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB610_2
+    movq  -8(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $10, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB610_2
+    movl  $1, %eax
+_LBB610_2:
+    cmpl  $0, %eax
+    je    _LBB609_3
+## if-then
+    movl  $0, %eax
+    jmp   _LBB606_0
+    jmp   _LBB609_2
+## if-else
+_LBB609_3:
+_LBB609_2:
+## assign
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _readc
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $47, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB611_3
+## if-then
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _readc
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  -16(%rbp), %eax
+    pushq %rax
+    movl  $47, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB612_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _line_comment
+    addq  $16, %rsp
+    jmp   _LBB607_4
+    jmp   _LBB612_2
+## if-else
+_LBB612_3:
+## if-cond
+    movl  -16(%rbp), %eax
+    pushq %rax
+    movl  $42, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB613_3
+## if-then
+## local scalar init
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $104, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _block_comment
+    addq  $16, %rsp
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $104, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  -20(%rbp), %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB614_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _mark_column
+    addq  $16, %rsp
+    jmp   _LBB614_2
+## if-else
+_LBB614_3:
+_LBB614_2:
+    jmp   _LBB607_4
+    jmp   _LBB613_2
+## if-else
+_LBB613_3:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -16(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _unreadc
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -12(%rbp), %eax
+    movb  %al, (%rsp)
+    movq  8(%rsp), %rdi
+    movb  (%rsp), %sil
+    callq _writec
+    addq  $16, %rsp
+    jmp   _LBB607_4
+_LBB613_2:
+_LBB612_2:
+    jmp   _LBB611_2
+## if-else
+_LBB611_3:
+## if-cond
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $34, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB615_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -12(%rbp), %eax
+    movb  %al, (%rsp)
+    movq  8(%rsp), %rdi
+    movb  (%rsp), %sil
+    callq _writec
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _string_literal
+    addq  $16, %rsp
+    jmp   _LBB607_4
+    jmp   _LBB615_2
+## if-else
+_LBB615_3:
+## if-cond
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $39, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB616_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -12(%rbp), %eax
+    movb  %al, (%rsp)
+    movq  8(%rsp), %rdi
+    movb  (%rsp), %sil
+    callq _writec
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _character_literal
+    addq  $16, %rsp
+    jmp   _LBB607_4
+    jmp   _LBB616_2
+## if-else
+_LBB616_3:
+## if-cond
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $35, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB617_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _directive_line
+    addq  $16, %rsp
+    jmp   _LBB607_4
+    jmp   _LBB617_2
+## if-else
+_LBB617_3:
+## if-cond
+    subq  $16, %rsp
+    movl  -12(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _is_macroname
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB618_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -12(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _unreadc
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _expand
+    addq  $16, %rsp
+    jmp   _LBB607_4
+    jmp   _LBB618_2
+## if-else
+_LBB618_3:
+## if-cond
+    movl  -12(%rbp), %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB619_3
+## if-then
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    jmp   _LBB606_0
+    jmp   _LBB619_2
+## if-else
+_LBB619_3:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -12(%rbp), %eax
+    movb  %al, (%rsp)
+    movq  8(%rsp), %rdi
+    movb  (%rsp), %sil
+    callq _writec
+    addq  $16, %rsp
+_LBB619_2:
+_LBB618_2:
+_LBB617_2:
+_LBB616_2:
+_LBB615_2:
+_LBB611_2:
+## for-post
+_LBB607_4:
+    jmp   _LBB607_1
+_LBB607_2:
+_LBB606_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_skip_blank_lines:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## for-pre
+## for-cond
+_LBB621_1:
+    movl  $1, %eax
+    cmpl  $0, %eax
+    je    _LBB621_2
+## for-body
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _isspace
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB622_3
+## if-then
+    leaq  -8(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    jmp   _LBB622_2
+## if-else
+_LBB622_3:
+## if-cond
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $47, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB624_2
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $42, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB624_2
+    movl  $1, %eax
+_LBB624_2:
+    cmpl  $0, %eax
+    je    _LBB623_3
+## if-then
+## for-pre
+## add-assign
+    leaq  -8(%rbp), %rax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    addq  %rax, (%rdx)
+    movq  (%rdx), %rax
+## for-cond
+_LBB625_1:
+    movq  -8(%rbp), %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    movl  $0, %eax
+    je    _LBB626_2
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $42, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB627_2
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $47, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB627_2
+    movl  $1, %eax
+_LBB627_2:
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB626_2
+    movl  $1, %eax
+_LBB626_2:
+    cmpl  $0, %eax
+    je    _LBB625_2
+## for-body
+## for-post
+_LBB625_4:
+    leaq  -8(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    jmp   _LBB625_1
+_LBB625_2:
+## if-cond
+    movq  -8(%rbp), %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    je    _LBB628_3
+## if-then
+## add-assign
+    leaq  -8(%rbp), %rax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    addq  %rax, (%rdx)
+    movq  (%rdx), %rax
+    jmp   _LBB628_2
+## if-else
+_LBB628_3:
+_LBB628_2:
+    jmp   _LBB623_2
+## if-else
+_LBB623_3:
+## if-cond
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $47, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB630_2
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $47, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB630_2
+    movl  $1, %eax
+_LBB630_2:
+    cmpl  $0, %eax
+    je    _LBB629_3
+## if-then
+## while-cond
+_LBB631_4:
+    movq  -8(%rbp), %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    movl  $0, %eax
+    je    _LBB632_2
+    movq  -8(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $10, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB632_2
+    movl  $1, %eax
+_LBB632_2:
+    cmpl  $0, %eax
+    je    _LBB631_2
+## while-body
+    leaq  -8(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    jmp   _LBB631_4
+_LBB631_2:
+    jmp   _LBB629_2
+## if-else
+_LBB629_3:
+## if-cond
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $92, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB634_2
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $10, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB634_2
+    movl  $1, %eax
+_LBB634_2:
+    cmpl  $0, %eax
+    je    _LBB633_3
+## if-then
+## add-assign
+    leaq  -8(%rbp), %rax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    addq  %rax, (%rdx)
+    movq  (%rdx), %rax
+    jmp   _LBB633_2
+## if-else
+_LBB633_3:
+    movq  -8(%rbp), %rax
+    jmp   _LBB620_0
+_LBB633_2:
+_LBB629_2:
+_LBB623_2:
+_LBB622_2:
+## for-post
+_LBB621_4:
+    jmp   _LBB621_1
+_LBB621_2:
+_LBB620_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_next_line:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## while-cond
+_LBB636_4:
+    movq  -8(%rbp), %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    je    _LBB636_2
+## while-body
+## if-cond
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $47, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB638_2
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $42, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB638_2
+    movl  $1, %eax
+_LBB638_2:
+    cmpl  $0, %eax
+    je    _LBB637_3
+## if-then
+## for-pre
+## add-assign
+    leaq  -8(%rbp), %rax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    addq  %rax, (%rdx)
+    movq  (%rdx), %rax
+## for-cond
+_LBB639_1:
+    movq  -8(%rbp), %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    movl  $0, %eax
+    je    _LBB640_2
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $42, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB641_2
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $47, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB641_2
+    movl  $1, %eax
+_LBB641_2:
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB640_2
+    movl  $1, %eax
+_LBB640_2:
+    cmpl  $0, %eax
+    je    _LBB639_2
+## for-body
+## for-post
+_LBB639_4:
+    leaq  -8(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    jmp   _LBB639_1
+_LBB639_2:
+## if-cond
+    movq  -8(%rbp), %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    je    _LBB642_3
+## if-then
+## add-assign
+    leaq  -8(%rbp), %rax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    addq  %rax, (%rdx)
+    movq  (%rdx), %rax
+    jmp   _LBB642_2
+## if-else
+_LBB642_3:
+_LBB642_2:
+    jmp   _LBB637_2
+## if-else
+_LBB637_3:
+## if-cond
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $47, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB644_2
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $47, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB644_2
+    movl  $1, %eax
+_LBB644_2:
+    cmpl  $0, %eax
+    je    _LBB643_3
+## if-then
+## while-cond
+_LBB645_4:
+    movq  -8(%rbp), %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    movl  $0, %eax
+    je    _LBB646_2
+    movq  -8(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $10, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB646_2
+    movl  $1, %eax
+_LBB646_2:
+    cmpl  $0, %eax
+    je    _LBB645_2
+## while-body
+    leaq  -8(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    jmp   _LBB645_4
+_LBB645_2:
+    jmp   _LBB643_2
+## if-else
+_LBB643_3:
+## if-cond
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $92, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB648_2
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $10, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB648_2
+    movl  $1, %eax
+_LBB648_2:
+    cmpl  $0, %eax
+    je    _LBB647_3
+## if-then
+## add-assign
+    leaq  -8(%rbp), %rax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    addq  %rax, (%rdx)
+    movq  (%rdx), %rax
+    jmp   _LBB647_2
+## if-else
+_LBB647_3:
+## if-cond
+    movq  -8(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $34, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB650_2
+    movq  -8(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $39, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB650_2
+    movl  $0, %eax
+_LBB650_2:
+    cmpl  $0, %eax
+    je    _LBB649_3
+## if-then
+## local scalar init
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    leaq  -8(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    movb  (%rax), %al
+    movsbl %al, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## while-cond
+_LBB651_4:
+    movq  -8(%rbp), %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    movl  $0, %eax
+    je    _LBB653_2
+    movq  -8(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB653_2
+    movl  $1, %eax
+_LBB653_2:
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB652_2
+    movq  -8(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $10, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB652_2
+    movl  $1, %eax
+_LBB652_2:
+    cmpl  $0, %eax
+    je    _LBB651_2
+## while-body
+## if-cond
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $92, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB655_2
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    movl  $0, %eax
+    je    _LBB655_2
+    movl  $1, %eax
+_LBB655_2:
+    cmpl  $0, %eax
+    je    _LBB654_3
+## if-then
+    leaq  -8(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    jmp   _LBB654_2
+## if-else
+_LBB654_3:
+_LBB654_2:
+    leaq  -8(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    jmp   _LBB651_4
+_LBB651_2:
+## if-cond
+    movq  -8(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB656_3
+## if-then
+    leaq  -8(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    jmp   _LBB656_2
+## if-else
+_LBB656_3:
+_LBB656_2:
+    jmp   _LBB649_2
+## if-else
+_LBB649_3:
+## if-cond
+    leaq  -8(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $10, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB657_3
+## if-then
+    jmp   _LBB636_2
+    jmp   _LBB657_2
+## if-else
+_LBB657_3:
+_LBB657_2:
+_LBB649_2:
+_LBB647_2:
+_LBB643_2:
+_LBB637_2:
+    jmp   _LBB636_4
+_LBB636_2:
+    movq  -8(%rbp), %rax
+    jmp   _LBB635_0
+_LBB635_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_find_include_guard:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $64, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movq  %rdx, -24(%rbp)
+## func body
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _skip_blank_lines
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $1, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $2, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $3, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $5, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $6, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $7, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $9, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $10, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $11, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $12, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $13, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $14, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $15, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -60(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -32(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    leaq  -48(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $16, %eax
+    movslq %eax, %rax
+    movq  %rax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _directive_name
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -32(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB660_2
+    subq  $16, %rsp
+    leaq  -48(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1521(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB660_2
+    movl  $0, %eax
+_LBB660_2:
+    cmpl  $0, %eax
+    je    _LBB659_3
+## if-then
+    movl  $0, %eax
+    jmp   _LBB658_0
+    jmp   _LBB659_2
+## if-else
+_LBB659_3:
+_LBB659_2:
+## while-cond
+_LBB661_4:
+    subq  $16, %rsp
+    movq  -32(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _is_whitespaces
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB661_2
+## while-body
+    leaq  -32(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    jmp   _LBB661_4
+_LBB661_2:
+## while-cond
+_LBB662_4:
+    subq  $16, %rsp
+    movq  -32(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _is_macroname
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB663_2
+    movq  -56(%rbp), %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    movq  %rax, %rdx
+    popq  %rax
+    cmpq  %rdx, %rax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB663_2
+    movl  $1, %eax
+_LBB663_2:
+    cmpl  $0, %eax
+    je    _LBB662_2
+## while-body
+## assign
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    pushq %rax
+    leaq  -56(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    leaq  -32(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    movb  (%rax), %al
+    popq  %rdx
+    movb  %al, (%rdx)
+    jmp   _LBB662_4
+_LBB662_2:
+## assign
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  -56(%rbp), %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## if-cond
+    movq  -56(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB664_3
+## if-then
+    movl  $0, %eax
+    jmp   _LBB658_0
+    jmp   _LBB664_2
+## if-else
+_LBB664_3:
+_LBB664_2:
+## for-pre
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -32(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _next_line
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB665_1:
+    movq  -32(%rbp), %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    je    _LBB665_2
+## for-body
+## if-cond
+    subq  $32, %rsp
+    movq  -32(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  -48(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  $16, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _directive_name
+    addq  $32, %rsp
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB666_3
+## if-then
+    jmp   _LBB665_4
+    jmp   _LBB666_2
+## if-else
+_LBB666_3:
+_LBB666_2:
+## if-cond
+    subq  $16, %rsp
+    leaq  -48(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1519(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB669_2
+    subq  $16, %rsp
+    leaq  -48(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1520(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB669_2
+    movl  $0, %eax
+_LBB669_2:
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB668_2
+    subq  $16, %rsp
+    leaq  -48(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1521(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB668_2
+    movl  $0, %eax
+_LBB668_2:
+    cmpl  $0, %eax
+    je    _LBB667_3
+## if-then
+    leaq  -60(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB667_2
+## if-else
+_LBB667_3:
+## if-cond
+    subq  $16, %rsp
+    leaq  -48(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1524(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB671_2
+    subq  $16, %rsp
+    leaq  -48(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1525(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB671_2
+    movl  $0, %eax
+_LBB671_2:
+    cmpl  $0, %eax
+    je    _LBB670_3
+## if-then
+## if-cond
+    movl  -60(%rbp), %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB672_3
+## if-then
+    movl  $0, %eax
+    jmp   _LBB658_0
+    jmp   _LBB672_2
+## if-else
+_LBB672_3:
+_LBB672_2:
+    jmp   _LBB670_2
+## if-else
+_LBB670_3:
+## if-cond
+    subq  $16, %rsp
+    leaq  -48(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_1528(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB673_3
+## if-then
+## if-cond
+    movl  -60(%rbp), %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB674_3
+## if-then
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -32(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _next_line
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _skip_blank_lines
+    addq  $16, %rsp
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    jmp   _LBB658_0
+    jmp   _LBB674_2
+## if-else
+_LBB674_3:
+_LBB674_2:
+    leaq  -60(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    subl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB673_2
+## if-else
+_LBB673_3:
+_LBB673_2:
+_LBB670_2:
+_LBB667_2:
+## for-post
+_LBB665_4:
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -32(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _next_line
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB665_1
+_LBB665_2:
+    movl  $0, %eax
+    jmp   _LBB658_0
+_LBB658_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_read_file:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movl  $1024, %eax
+    pushq %rax
+    movl  $16, %eax
+    popq  %rdx
+    imull %edx, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_2538(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _fopen
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -24(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB676_3
+## if-then
+    movl  $0, %eax
+    jmp   _LBB675_0
+    jmp   _LBB676_2
+## if-else
+_LBB676_3:
+_LBB676_2:
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -40(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _malloc
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-pre
+## for-cond
+_LBB677_1:
+    movl  $1, %eax
+    cmpl  $0, %eax
+    je    _LBB677_2
+## for-body
+## add-assign
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    subq  $40, %rsp
+    movq  -32(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  -48(%rbp), %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  %rax, 32(%rsp)
+    movl  $1, %eax
+    movslq %eax, %rax
+    movq  %rax, 24(%rsp)
+    movq  -40(%rbp), %rax
+    pushq %rax
+    movq  -48(%rbp), %rax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    movq  %rax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  32(%rsp), %rdi
+    movq  24(%rsp), %rsi
+    movq  16(%rsp), %rdx
+    movq  8(%rsp), %rcx
+    callq _fread
+    addq  $40, %rsp
+    popq  %rdx
+    addq  %rax, (%rdx)
+    movq  (%rdx), %rax
+## if-cond
+    movq  -48(%rbp), %rax
+    pushq %rax
+    movq  -40(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    movq  %rax, %rdx
+    popq  %rax
+    cmpq  %rdx, %rax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB678_3
+## if-then
+    jmp   _LBB677_2
+    jmp   _LBB678_2
+## if-else
+_LBB678_3:
+_LBB678_2:
+## mul-assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movl  $2, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq (%rdx), %rax
+    movq  %rax, (%rdx)
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -32(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -40(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _realloc
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-post
+_LBB677_4:
+    jmp   _LBB677_1
+_LBB677_2:
+## assign
+    movq  -32(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  -48(%rbp), %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _fclose
+    addq  $16, %rsp
+## assign
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movq  -48(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    movq  -32(%rbp), %rax
+    jmp   _LBB675_0
+_LBB675_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_can_skip_file:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## if-cond
+    movq  -16(%rbp), %rax
+    addq  $20, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    je    _LBB680_3
+## if-then
+    movl  $1, %eax
+    jmp   _LBB679_0
+    jmp   _LBB680_2
+## if-else
+_LBB680_3:
+_LBB680_2:
+## if-cond
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    movl  $0, %eax
+    je    _LBB682_2
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $40, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _lookup_macro
+    addq  $16, %rsp
+    cmpq  $0, %rax
+    movl  $0, %eax
+    je    _LBB682_2
+    movl  $1, %eax
+_LBB682_2:
+    cmpl  $0, %eax
+    je    _LBB681_3
+## if-then
+    movl  $1, %eax
+    jmp   _LBB679_0
+    jmp   _LBB681_2
+## if-else
+_LBB681_3:
+_LBB681_2:
+    movl  $0, %eax
+    jmp   _LBB679_0
+_LBB679_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_push_file:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $64, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    addq  $48, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _insert_include_file
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _can_skip_file
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB684_3
+## if-then
+    jmp   _LBB683_0
+    jmp   _LBB684_2
+## if-else
+_LBB684_3:
+_LBB684_2:
+## assign
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    leaq  -40(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _read_file
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -48(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB685_3
+## if-then
+    jmp   _LBB683_0
+    jmp   _LBB685_2
+## if-else
+_LBB685_3:
+_LBB685_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $48, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _add_read_file
+    addq  $16, %rsp
+## if-cond
+    movq  -24(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB686_3
+## if-then
+## local scalar init
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    movl  $128, %eax
+    pushq %rax
+    movl  $1, %eax
+    movl  %eax, %edi
+    popq  %rax
+    cltd
+    idivl %edi
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    subq  $32, %rsp
+    movq  -48(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _guard_2560(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  -56(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _find_include_guard
+    addq  $32, %rsp
+    cmpl  $0, %eax
+    je    _LBB687_3
+## if-then
+## assign
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    subq  $8, %rsp
+    movl  $1, %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  -56(%rbp), %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _malloc
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $32, %rsp
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _guard_2560(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  -56(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _strncpy
+    addq  $32, %rsp
+    jmp   _LBB687_2
+## if-else
+_LBB687_3:
+_LBB687_2:
+## assign
+    movq  -24(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB686_2
+## if-else
+_LBB686_3:
+_LBB686_2:
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movl  $152, %eax
+    movslq %eax, %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _malloc
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -32(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    movq  16(%rax), %r10
+    movq  %r10, 16(%rdx)
+    movq  24(%rax), %r10
+    movq  %r10, 24(%rdx)
+    movq  32(%rax), %r10
+    movq  %r10, 32(%rdx)
+    movq  40(%rax), %r10
+    movq  %r10, 40(%rdx)
+    movq  48(%rax), %r10
+    movq  %r10, 48(%rdx)
+    movq  56(%rax), %r10
+    movq  %r10, 56(%rdx)
+    movq  64(%rax), %r10
+    movq  %r10, 64(%rdx)
+    movq  72(%rax), %r10
+    movq  %r10, 72(%rdx)
+    movq  80(%rax), %r10
+    movq  %r10, 80(%rdx)
+    movq  88(%rax), %r10
+    movq  %r10, 88(%rdx)
+    movq  96(%rax), %r10
+    movq  %r10, 96(%rdx)
+    movq  104(%rax), %r10
+    movq  %r10, 104(%rdx)
+    movq  112(%rax), %r10
+    movq  %r10, 112(%rdx)
+    movq  120(%rax), %r10
+    movq  %r10, 120(%rdx)
+    movq  128(%rax), %r10
+    movq  %r10, 128(%rdx)
+    movq  136(%rax), %r10
+    movq  %r10, 136(%rdx)
+    movq  144(%rax), %r10
+    movq  %r10, 144(%rdx)
+## assign
+    movq  -32(%rbp), %rax
+    addq  $104, %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -32(%rbp), %rax
+    addq  $108, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -32(%rbp), %rax
+    addq  $88, %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -32(%rbp), %rax
+    addq  $96, %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -32(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -48(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -32(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movq  -48(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -32(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movq  -48(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  -40(%rbp), %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -32(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -32(%rbp), %rax
+    addq  $28, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -32(%rbp), %rax
+    addq  $120, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -32(%rbp), %rax
+    addq  $136, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -32(%rbp), %rax
+    addq  $144, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    addq  $80, %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _text_offset
+    addq  $16, %rsp
+    movslq %eax, %rax
+    movq  %rax, 16(%rsp)
+    movl  $0, %eax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _switch_record
+    addq  $32, %rsp
+## assign
+    movq  -32(%rbp), %rax
+    addq  $128, %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  -40(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _add_include_record
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $80, %rax
+    movq  (%rax), %rax
+    addq  $16, %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    addq  $128, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $136, %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -32(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _mark_line
+    addq  $16, %rsp
+_LBB683_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_pop_file:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $136, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -16(%rbp), %rax
+    addq  $120, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    je    _LBB689_3
+## if-then
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2572(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _error_
+    addq  $16, %rsp
+    jmp   _LBB689_2
+## if-else
+_LBB689_3:
+_LBB689_2:
+## while-cond
+_LBB690_4:
+    movq  -16(%rbp), %rax
+    addq  $120, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    je    _LBB690_2
+## while-body
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _pop_cond
+    addq  $16, %rsp
+    jmp   _LBB690_4
+_LBB690_2:
+## add-assign
+    movq  -8(%rbp), %rax
+    addq  $144, %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $144, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    addl  %eax, (%rdx)
+    movl  (%rdx), %eax
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    addq  $80, %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _text_offset
+    addq  $16, %rsp
+    movslq %eax, %rax
+    movq  %rax, 16(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $128, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _switch_record
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+## assign
+    movq  -8(%rbp), %rax
+    addq  $136, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $88, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    je    _LBB691_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _mark_line
+    addq  $16, %rsp
+    jmp   _LBB691_2
+## if-else
+_LBB691_3:
+_LBB691_2:
+_LBB688_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _preprocess_file
+_preprocess_file:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _push_file
+    addq  $16, %rsp
+## cond-?
+    movq  -8(%rbp), %rax
+    addq  $136, %rax
+    movq  (%rax), %rax
+    cmpl  $0, %eax
+    je    _LBB693_3
+## cond-then
+    movl  $0, %eax
+    jmp   _LBB693_2
+## cond-else
+_LBB693_3:
+    movl  $1, %eax
+_LBB693_2:
+    jmp   _LBB692_0
+_LBB692_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _read_text
+_read_text:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## assign
+    movq  -8(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $0, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $80, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _text_offset
+    addq  $16, %rsp
+    movslq %eax, %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _mark_profile
+    addq  $16, %rsp
+## while-cond
+_LBB695_4:
+    movq  -8(%rbp), %rax
+    addq  $136, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    movl  $0, %eax
+    je    _LBB696_2
+    movq  -8(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $1024, %eax
+    pushq %rax
+    movl  $16, %eax
+    popq  %rdx
+    imull %edx, %eax
+    movslq %eax, %rax
+    movq  %rax, %rdx
+    popq  %rax
+    cmpq  %rdx, %rax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB696_2
+    movl  $1, %eax
+_LBB696_2:
+    cmpl  $0, %eax
+    je    _LBB695_2
+## while-body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## while-cond
+_LBB697_4:
+    movq  -16(%rbp), %rax
+    addq  $136, %rax
+    movq  (%rax), %rax
+    addq  $136, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    je    _LBB697_2
+## while-body
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $136, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB697_4
+_LBB697_2:
+## if-cond
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    addq  $136, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _text_lines
+    addq  $16, %rsp
+    movslq %eax, %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB698_3
+## if-then
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _pop_file
+    addq  $16, %rsp
+    jmp   _LBB698_2
+## if-else
+_LBB698_3:
+_LBB698_2:
+    jmp   _LBB695_4
+_LBB695_2:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    addq  $80, %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _text_offset
+    addq  $16, %rsp
+    movslq %eax, %rax
+    movq  %rax, 16(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $80, %rax
+    movq  (%rax), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _switch_record
+    addq  $32, %rsp
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $0, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB699_3
+## if-then
+    movl  $0, %eax
+    jmp   _LBB694_0
+    jmp   _LBB699_2
+## if-else
+_LBB699_3:
+_LBB699_2:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    addq  $56, %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _add_source_text
+    addq  $32, %rsp
+    movq  -8(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    jmp   _LBB694_0
+_LBB694_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_write_make_path:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## for-pre
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB701_1:
+    movq  -24(%rbp), %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    je    _LBB701_2
+## for-body
+## if-cond
+    movq  -24(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $32, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB702_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2598(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    jmp   _LBB702_2
+## if-else
+_LBB702_3:
+## if-cond
+    movq  -24(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $36, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB703_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2599(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    jmp   _LBB703_2
+## if-else
+_LBB703_3:
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_986(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    movb  $0, %al
+    callq _fprintf
+    addq  $32, %rsp
+_LBB703_2:
+_LBB702_2:
+## for-post
+_LBB701_4:
+    leaq  -24(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    jmp   _LBB701_1
+_LBB701_2:
+_LBB700_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _write_dependencies
+_write_dependencies:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movq  %rdx, -24(%rbp)
+    movl  %ecx, -28(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _write_make_path
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2354(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+## for-pre
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $48, %rax
+    movq  (%rax), %rax
+    addq  $9896, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB705_1:
+    movq  -40(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB705_2
+## for-body
+## if-cond
+    movl  -28(%rbp), %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB708_2
+    movq  -40(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $48, %rax
+    movq  (%rax), %rax
+    addq  $9896, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB708_2
+    movl  $1, %eax
+_LBB708_2:
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB707_2
+    subq  $16, %rsp
+    movq  -40(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_system_header
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB707_2
+    movl  $1, %eax
+_LBB707_2:
+    cmpl  $0, %eax
+    je    _LBB706_3
+## if-then
+    jmp   _LBB705_4
+    jmp   _LBB706_2
+## if-else
+_LBB706_3:
+_LBB706_2:
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+## cond-?
+    movq  -40(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $48, %rax
+    movq  (%rax), %rax
+    addq  $9896, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpq  $0, %rax
+    je    _LBB709_3
+## cond-then
+    leaq  _L_str_2612(%rip), %rax
+    jmp   _LBB709_2
+## cond-else
+_LBB709_3:
+    leaq  _L_str_2613(%rip), %rax
+_LBB709_2:
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -40(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _write_make_path
+    addq  $16, %rsp
+## for-post
+_LBB705_4:
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movq  -40(%rbp), %rax
+    addq  $40, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB705_1
+_LBB705_2:
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_974(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    movb  $0, %al
+    callq _fprintf
+    addq  $16, %rsp
+_LBB704_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_write_int:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+## func body
+    subq  $32, %rsp
+    leaq  -12(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $4, %eax
+    movslq %eax, %rax
+    movq  %rax, 16(%rsp)
+    movl  $1, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movq  (%rsp), %rcx
+    callq _fwrite
+    addq  $32, %rsp
+_LBB710_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_write_string:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## if-cond
+    movq  -16(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB712_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _write_int
+    addq  $16, %rsp
+    jmp   _LBB711_0
+    jmp   _LBB712_2
+## if-else
+_LBB712_3:
+_LBB712_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _strlen
+    addq  $16, %rsp
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _write_int
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  $1, %eax
+    movslq %eax, %rax
+    movq  %rax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _strlen
+    addq  $16, %rsp
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  %rax, 8(%rsp)
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movq  (%rsp), %rcx
+    callq _fwrite
+    addq  $32, %rsp
+_LBB711_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_read_int:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB715_2
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    pushq %rax
+    movl  $4, %eax
+    movslq %eax, %rax
+    movq  %rax, %rdx
+    popq  %rax
+    cmpq  %rdx, %rax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB715_2
+    movl  $0, %eax
+_LBB715_2:
+    cmpl  $0, %eax
+    je    _LBB714_3
+## if-then
+## assign
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    movl  $0, %eax
+    jmp   _LBB713_0
+    jmp   _LBB714_2
+## if-else
+_LBB714_3:
+_LBB714_2:
+    subq  $32, %rsp
+    leaq  -12(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movl  $4, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _memcpy
+    addq  $32, %rsp
+## add-assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $4, %eax
+    popq  %rdx
+    addq  %rax, (%rdx)
+    movq  (%rdx), %rax
+    movl  -12(%rbp), %eax
+    jmp   _LBB713_0
+_LBB713_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_read_string:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _read_int
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movl  -12(%rbp), %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB717_3
+## if-then
+    movl  $0, %eax
+    jmp   _LBB716_0
+    jmp   _LBB717_2
+## if-else
+_LBB717_3:
+_LBB717_2:
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB721_2
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $1, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB721_2
+    movl  $0, %eax
+_LBB721_2:
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB720_2
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    movslq %eax, %rax
+    movq  %rax, %rdx
+    popq  %rax
+    cmpq  %rdx, %rax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB720_2
+    movl  $0, %eax
+_LBB720_2:
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB719_2
+    movq  -24(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $1, %eax
+    movl  %eax, %edx
+    popq  %rax
+    subl  %edx, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB719_2
+    movl  $0, %eax
+_LBB719_2:
+    cmpl  $0, %eax
+    je    _LBB718_3
+## if-then
+## assign
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    leaq  _L_str_2655(%rip), %rax
+    jmp   _LBB716_0
+    jmp   _LBB718_2
+## if-else
+_LBB718_3:
+_LBB718_2:
+## add-assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    addq  %rax, (%rdx)
+    movq  (%rdx), %rax
+    movq  -24(%rbp), %rax
+    jmp   _LBB716_0
+_LBB716_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_hash_text:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-pre
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB723_1:
+    movq  -32(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    movq  %rax, %rdx
+    popq  %rax
+    cmpq  %rdx, %rax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB723_2
+## for-body
+## assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $31, %eax
+    pushq %rax
+    movl  -20(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movzbl %al, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-post
+_LBB723_4:
+    leaq  -32(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    jmp   _LBB723_1
+_LBB723_2:
+    movl  -20(%rbp), %eax
+    jmp   _LBB722_0
+_LBB722_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_write_file_state:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    leaq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _read_file
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _write_string
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _write_string
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _write_int
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $20, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _write_int
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $32, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _write_int
+    addq  $16, %rsp
+## if-cond
+    movq  -32(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB725_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _write_int
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -32(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _hash_text
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _write_int
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -32(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+    jmp   _LBB725_2
+## if-else
+_LBB725_3:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _write_int
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _write_int
+    addq  $16, %rsp
+_LBB725_2:
+_LBB724_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_count_include_files:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-pre
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB727_1:
+    movl  -24(%rbp), %eax
+    pushq %rax
+    movl  $1237, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB727_2
+## for-body
+## for-pre
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -24(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB728_1:
+    movq  -16(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB728_2
+## for-body
+    leaq  -20(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+## for-post
+_LBB728_4:
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB728_1
+_LBB728_2:
+## for-post
+_LBB727_4:
+    leaq  -24(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB727_1
+_LBB727_2:
+    movl  -20(%rbp), %eax
+    jmp   _LBB726_0
+_LBB726_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_count_macros:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-pre
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB730_1:
+    movl  -24(%rbp), %eax
+    pushq %rax
+    movl  $1237, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB730_2
+## for-body
+## for-pre
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -24(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB731_1:
+    movq  -16(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB731_2
+## for-body
+    leaq  -20(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+## for-post
+_LBB731_4:
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $40, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB731_1
+_LBB731_2:
+## for-post
+_LBB730_4:
+    leaq  -24(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB730_1
+_LBB730_2:
+    movl  -20(%rbp), %eax
+    jmp   _LBB729_0
+_LBB729_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_write_macro:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _write_string
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _write_string
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $24, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _write_int
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $28, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _write_int
+    addq  $16, %rsp
+## for-pre
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB733_1:
+    movq  -24(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB733_2
+## for-body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _write_string
+    addq  $16, %rsp
+## for-post
+_LBB733_4:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB733_1
+_LBB733_2:
+_LBB732_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _precompile_header
+_precompile_header:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $96, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movq  %rdx, -24(%rbp)
+## func body
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $56, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _preprocess_file
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB735_3
+## if-then
+    movl  $1, %eax
+    jmp   _LBB734_0
+    jmp   _LBB735_2
+## if-else
+_LBB735_3:
+_LBB735_2:
+    subq  $16, %rsp
+    leaq  -80(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  $0, %eax
+    movslq %eax, %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strbuf_init
+    addq  $16, %rsp
+## while-cond
+_LBB736_4:
+## assign
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _read_text
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB736_2
+## while-body
+    subq  $16, %rsp
+    leaq  -80(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -56(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strbuf_append
+    addq  $16, %rsp
+    jmp   _LBB736_4
+_LBB736_2:
+## assign
+    leaq  -88(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_2720(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _fopen
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -88(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB737_3
+## if-then
+    subq  $16, %rsp
+    leaq  -80(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _strbuf_free
+    addq  $16, %rsp
+    movl  $1, %eax
+    jmp   _LBB734_0
+    jmp   _LBB737_2
+## if-else
+_LBB737_3:
+_LBB737_2:
+    subq  $16, %rsp
+    movq  -88(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2723(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _write_string
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -88(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _write_string
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -88(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $48, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _count_include_files
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _write_int
+    addq  $16, %rsp
+## for-pre
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $48, %rax
+    movq  (%rax), %rax
+    addq  $9896, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB738_1:
+    movq  -40(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB738_2
+## for-body
+    subq  $16, %rsp
+    movq  -88(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -40(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _write_file_state
+    addq  $16, %rsp
+## for-post
+_LBB738_4:
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movq  -40(%rbp), %rax
+    addq  $40, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB738_1
+_LBB738_2:
+## for-pre
+## assign
+    leaq  -92(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB739_1:
+    movl  -92(%rbp), %eax
+    pushq %rax
+    movl  $1237, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB739_2
+## for-body
+## for-pre
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $48, %rax
+    movq  (%rax), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -92(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB740_1:
+    movq  -40(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB740_2
+## for-body
+## if-cond
+    movq  -40(%rbp), %rax
+    addq  $32, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB741_3
+## if-then
+    subq  $16, %rsp
+    movq  -88(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -40(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _write_file_state
+    addq  $16, %rsp
+    jmp   _LBB741_2
+## if-else
+_LBB741_3:
+_LBB741_2:
+## for-post
+_LBB740_4:
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movq  -40(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB740_1
+_LBB740_2:
+## for-post
+_LBB739_4:
+    leaq  -92(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB739_1
+_LBB739_2:
+    subq  $16, %rsp
+    movq  -88(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $40, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _count_macros
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _write_int
+    addq  $16, %rsp
+## for-pre
+## assign
+    leaq  -92(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB742_1:
+    movl  -92(%rbp), %eax
+    pushq %rax
+    movl  $1237, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB742_2
+## for-body
+## for-pre
+## assign
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $40, %rax
+    movq  (%rax), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -92(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB743_1:
+    movq  -48(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB743_2
+## for-body
+    subq  $16, %rsp
+    movq  -88(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -48(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _write_macro
+    addq  $16, %rsp
+## for-post
+_LBB743_4:
+## assign
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    movq  -48(%rbp), %rax
+    addq  $40, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB743_1
+_LBB743_2:
+## for-post
+_LBB742_4:
+    leaq  -92(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB742_1
+_LBB742_2:
+    subq  $16, %rsp
+    movq  -88(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  -80(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _write_string
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -88(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -32(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _write_int
+    addq  $16, %rsp
+## for-pre
+## assign
+    leaq  -92(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB744_1:
+    movl  -92(%rbp), %eax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB744_2
+## for-body
+    subq  $16, %rsp
+    movq  -88(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -32(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $16, %eax
+    pushq %rax
+    movl  -92(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _write_int
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -88(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -32(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $16, %eax
+    pushq %rax
+    movl  -92(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _write_int
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -88(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -32(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $16, %eax
+    pushq %rax
+    movl  -92(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _write_string
+    addq  $16, %rsp
+## for-post
+_LBB744_4:
+    leaq  -92(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB744_1
+_LBB744_2:
+    subq  $16, %rsp
+    movq  -88(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -32(%rbp), %rax
+    addq  $32, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _write_int
+    addq  $16, %rsp
+## for-pre
+## assign
+    leaq  -92(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB745_1:
+    movl  -92(%rbp), %eax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    addq  $32, %rax
+    movl  (%rax), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB745_2
+## for-body
+    subq  $16, %rsp
+    movq  -88(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -32(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -92(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _write_int
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -88(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -32(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -92(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _write_int
+    addq  $16, %rsp
+## for-post
+_LBB745_4:
+    leaq  -92(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB745_1
+_LBB745_2:
+    subq  $16, %rsp
+    movq  -88(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _fclose
+    addq  $16, %rsp
+    subq  $16, %rsp
+    leaq  -80(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _strbuf_free
+    addq  $16, %rsp
+    movl  $0, %eax
+    jmp   _LBB734_0
+_LBB734_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_is_file_unchanged:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+    movl  %edx, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    leaq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _read_file
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -32(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB747_3
+## if-then
+    movl  -12(%rbp), %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    sete  %al
+    movzbl %al, %eax
+    jmp   _LBB746_0
+    jmp   _LBB747_2
+## if-else
+_LBB747_3:
+_LBB747_2:
+## assign
+    leaq  -36(%rbp), %rax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB748_2
+    movl  -16(%rbp), %eax
+    pushq %rax
+    subq  $16, %rsp
+    movq  -32(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _hash_text
+    addq  $16, %rsp
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB748_2
+    movl  $1, %eax
+_LBB748_2:
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  -32(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+    movl  -36(%rbp), %eax
+    jmp   _LBB746_0
+_LBB746_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_read_pch:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $208, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movl  %edx, -20(%rbp)
+## func body
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $56, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -36(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _text_offset
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -52(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _read_int
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-pre
+## assign
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB750_1:
+    movl  -56(%rbp), %eax
+    pushq %rax
+    movl  -52(%rbp), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB751_2
+    movq  -16(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB751_2
+    movl  $1, %eax
+_LBB751_2:
+    cmpl  $0, %eax
+    je    _LBB750_2
+## for-body
+## local scalar init
+    leaq  -64(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _read_string
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -72(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _read_string
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -76(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _read_int
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -80(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _read_int
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -84(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _read_int
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -88(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _read_int
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -92(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _read_int
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  -20(%rbp), %eax
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB752_3
+## if-then
+## if-cond
+    movq  -64(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB754_2
+    subq  $32, %rsp
+    movq  -64(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  -88(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    movl  -92(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _is_file_unchanged
+    addq  $32, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB754_2
+    movl  $0, %eax
+_LBB754_2:
+    cmpl  $0, %eax
+    je    _LBB753_3
+## if-then
+## assign
+    movq  -16(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB753_2
+## if-else
+_LBB753_3:
+_LBB753_2:
+    jmp   _LBB750_4
+    jmp   _LBB752_2
+## if-else
+_LBB752_3:
+_LBB752_2:
+## local scalar init
+    leaq  -104(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    addq  $48, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movq  -64(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _insert_include_file
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -72(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB755_3
+## if-then
+## assign
+    movq  -104(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    subq  $8, %rsp
+    movl  $1, %eax
+    movslq %eax, %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -72(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _strlen
+    addq  $8, %rsp
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _malloc
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -104(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  -72(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcpy
+    addq  $16, %rsp
+    jmp   _LBB755_2
+## if-else
+_LBB755_3:
+_LBB755_2:
+## assign
+    movq  -104(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movl  -76(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -104(%rbp), %rax
+    addq  $20, %rax
+    pushq %rax
+    movl  -80(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  -84(%rbp), %eax
+    cmpl  $0, %eax
+    je    _LBB756_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $48, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  -104(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _add_read_file
+    addq  $16, %rsp
+    jmp   _LBB756_2
+## if-else
+_LBB756_3:
+_LBB756_2:
+## for-post
+_LBB750_4:
+    leaq  -56(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB750_1
+_LBB750_2:
+## assign
+    leaq  -52(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _read_int
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-pre
+## assign
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB757_1:
+    movl  -56(%rbp), %eax
+    pushq %rax
+    movl  -52(%rbp), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB758_2
+    movq  -16(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB758_2
+    movl  $1, %eax
+_LBB758_2:
+    cmpl  $0, %eax
+    je    _LBB757_2
+## for-body
+## local scalar init
+    leaq  -112(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _read_string
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -120(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _read_string
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -124(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _read_int
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -128(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _read_int
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -144(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -144(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    popq  %rax
+    movq  $0, %rdx
+    movq  %rdx, (%rax)
+## local scalar init
+    leaq  -152(%rbp), %rax
+    pushq %rax
+    leaq  -144(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-pre
+## assign
+    leaq  -164(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB759_1:
+    movl  -164(%rbp), %eax
+    pushq %rax
+    movl  -128(%rbp), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB760_2
+    movq  -16(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB760_2
+    movl  $1, %eax
+_LBB760_2:
+    cmpl  $0, %eax
+    je    _LBB759_2
+## for-body
+## local scalar init
+    leaq  -176(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _read_string
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movl  -20(%rbp), %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB762_2
+    movq  -176(%rbp), %rax
+    cmpq  $0, %rax
+    movl  $0, %eax
+    je    _LBB762_2
+    movl  $1, %eax
+_LBB762_2:
+    cmpl  $0, %eax
+    je    _LBB761_3
+## if-then
+## assign
+    movq  -152(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -176(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _new_param
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -152(%rbp), %rax
+    pushq %rax
+    movq  -152(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB761_2
+## if-else
+_LBB761_3:
+_LBB761_2:
+## for-post
+_LBB759_4:
+    leaq  -164(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB759_1
+_LBB759_2:
+## if-cond
+    movl  -20(%rbp), %eax
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB765_2
+    movq  -112(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB765_2
+    movl  $0, %eax
+_LBB765_2:
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB764_2
+    movq  -120(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB764_2
+    movl  $0, %eax
+_LBB764_2:
+    cmpl  $0, %eax
+    je    _LBB763_3
+## if-then
+    jmp   _LBB757_4
+    jmp   _LBB763_2
+## if-else
+_LBB763_3:
+_LBB763_2:
+## assign
+    leaq  -160(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    addq  $40, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movq  -112(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _insert_macro
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -160(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -120(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _add_replacement
+    addq  $16, %rsp
+## assign
+    movq  -160(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    movl  -124(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -160(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    leaq  -144(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -160(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _set_body
+    addq  $16, %rsp
+## for-post
+_LBB757_4:
+    leaq  -56(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB757_1
+_LBB757_2:
+## assign
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _read_string
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movl  -20(%rbp), %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB767_2
+    movq  -48(%rbp), %rax
+    cmpq  $0, %rax
+    movl  $0, %eax
+    je    _LBB767_2
+    movl  $1, %eax
+_LBB767_2:
+    cmpl  $0, %eax
+    je    _LBB766_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $32, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  -48(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strbuf_append
+    addq  $16, %rsp
+    jmp   _LBB766_2
+## if-else
+_LBB766_3:
+_LBB766_2:
+## assign
+    leaq  -52(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _read_int
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-pre
+## assign
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB768_1:
+    movl  -56(%rbp), %eax
+    pushq %rax
+    movl  -52(%rbp), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB769_2
+    movq  -16(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB769_2
+    movl  $1, %eax
+_LBB769_2:
+    cmpl  $0, %eax
+    je    _LBB768_2
+## for-body
+## local scalar init
+    leaq  -180(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _read_int
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -184(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _read_int
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -192(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _read_string
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movl  -20(%rbp), %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB771_2
+    movq  -192(%rbp), %rax
+    cmpq  $0, %rax
+    movl  $0, %eax
+    je    _LBB771_2
+    movl  $1, %eax
+_LBB771_2:
+    cmpl  $0, %eax
+    je    _LBB770_3
+## if-then
+    subq  $32, %rsp
+    movq  -32(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  -36(%rbp), %eax
+    pushq %rax
+    movl  -180(%rbp), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    movl  %eax, 16(%rsp)
+    movl  -184(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $48, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  -192(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _insert_include_file
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movq  (%rsp), %rcx
+    callq _add_line_marker
+    addq  $32, %rsp
+    jmp   _LBB770_2
+## if-else
+_LBB770_3:
+_LBB770_2:
+## for-post
+_LBB768_4:
+    leaq  -56(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB768_1
+_LBB768_2:
+## assign
+    leaq  -52(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _read_int
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-pre
+## assign
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB772_1:
+    movl  -56(%rbp), %eax
+    pushq %rax
+    movl  -52(%rbp), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB773_2
+    movq  -16(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB773_2
+    movl  $1, %eax
+_LBB773_2:
+    cmpl  $0, %eax
+    je    _LBB772_2
+## for-body
+## local scalar init
+    leaq  -196(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _read_int
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -200(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _read_int
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  -20(%rbp), %eax
+    cmpl  $0, %eax
+    je    _LBB774_3
+## if-then
+    subq  $32, %rsp
+    movq  -32(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movl  -36(%rbp), %eax
+    pushq %rax
+    movl  -196(%rbp), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    movl  %eax, 16(%rsp)
+    movl  -200(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    callq _add_column_marker
+    addq  $32, %rsp
+    jmp   _LBB774_2
+## if-else
+_LBB774_3:
+_LBB774_2:
+## for-post
+_LBB772_4:
+    leaq  -56(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB772_1
+_LBB772_2:
+_LBB749_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_pch_path:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movq  %rdx, -24(%rbp)
+## func body
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _strlen
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -32(%rbp), %rax
+    pushq %rax
+    movl  $2, %eax
+    movslq %eax, %rax
+    movq  %rax, %rdx
+    popq  %rax
+    cmpq  %rdx, %rax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB778_2
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $2, %eax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2801(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB778_2
+    movl  $0, %eax
+_LBB778_2:
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB777_2
+    movq  -32(%rbp), %rax
+    pushq %rax
+    movl  $3, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    movq  %rax, %rdx
+    popq  %rax
+    cmpq  %rdx, %rax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB777_2
+    movl  $0, %eax
+_LBB777_2:
+    cmpl  $0, %eax
+    je    _LBB776_3
+## if-then
+    movl  $0, %eax
+    jmp   _LBB775_0
+    jmp   _LBB776_2
+## if-else
+_LBB776_3:
+_LBB776_2:
+    subq  $32, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -32(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _memcpy
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2802(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcpy
+    addq  $16, %rsp
+    movl  $1, %eax
+    jmp   _LBB775_0
+_LBB775_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_load_precompiled_header:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $96, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    popq  %rax
+    movq  $0, %rdx
+    movq  %rdx, (%rax)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -64(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $40, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _count_macros
+    addq  $16, %rsp
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB781_2
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $48, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _count_include_files
+    addq  $16, %rsp
+    pushq %rax
+    movl  $1, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB781_2
+    movl  $0, %eax
+_LBB781_2:
+    cmpl  $0, %eax
+    je    _LBB780_3
+## if-then
+    movl  $0, %eax
+    jmp   _LBB779_0
+    jmp   _LBB780_2
+## if-else
+_LBB780_3:
+_LBB780_2:
+## if-cond
+    subq  $32, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _pchname_2810(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movl  $256, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _pch_path
+    addq  $32, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB782_3
+## if-then
+    movl  $0, %eax
+    jmp   _LBB779_0
+    jmp   _LBB782_2
+## if-else
+_LBB782_3:
+_LBB782_2:
+## assign
+    leaq  -72(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    leaq  _pchname_2810(%rip), %rax
+    movq  %rax, 16(%rsp)
+    leaq  -64(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _read_file
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -72(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB783_3
+## if-then
+    movl  $0, %eax
+    jmp   _LBB779_0
+    jmp   _LBB783_2
+## if-else
+_LBB783_3:
+_LBB783_2:
+## assign
+    leaq  -40(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -72(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -40(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movq  -72(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  -64(%rbp), %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    leaq  -40(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _read_string
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    leaq  -40(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _read_string
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    leaq  -40(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB787_2
+    subq  $16, %rsp
+    movq  -48(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_2723(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB787_2
+    movl  $1, %eax
+_LBB787_2:
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB786_2
+    movq  -56(%rbp), %rax
+    cmpq  $0, %rax
+    movl  $0, %eax
+    je    _LBB786_2
+    movl  $1, %eax
+_LBB786_2:
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB785_2
+    subq  $16, %rsp
+    movq  -56(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB785_2
+    movl  $1, %eax
+_LBB785_2:
+    cmpl  $0, %eax
+    je    _LBB784_3
+## if-then
+## local scalar init
+    leaq  -80(%rbp), %rax
+    pushq %rax
+    leaq  -40(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  -40(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _read_pch
+    addq  $32, %rsp
+## if-cond
+    leaq  -40(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB788_3
+## if-then
+## local scalar init
+    leaq  -88(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $80, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -96(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $48, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _insert_include_file
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  -64(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    movq  (%rsp), %rdx
+    callq _add_include_record
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $32, %rsp
+    movq  -88(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _text_offset
+    addq  $16, %rsp
+    movslq %eax, %rax
+    movq  %rax, 16(%rsp)
+    movq  -96(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _switch_record
+    addq  $32, %rsp
+## assign
+    leaq  -40(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -80(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  -40(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _read_pch
+    addq  $32, %rsp
+    subq  $32, %rsp
+    movq  -88(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _text_offset
+    addq  $16, %rsp
+    movslq %eax, %rax
+    movq  %rax, 16(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $128, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _switch_record
+    addq  $32, %rsp
+    jmp   _LBB788_2
+## if-else
+_LBB788_3:
+_LBB788_2:
+    jmp   _LBB784_2
+## if-else
+_LBB784_3:
+## assign
+    leaq  -40(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+_LBB784_2:
+    subq  $16, %rsp
+    movq  -72(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+    leaq  -40(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    jmp   _LBB779_0
+_LBB779_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
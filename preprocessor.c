@@ -1,7 +1,15 @@
+/* for clock_gettime() */
+#define _POSIX_C_SOURCE 199309
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
+#include <time.h>
 #include "preprocessor.h"
+#include "arena.h"
+#include "search_path.h"
+#include "esc_seq.h"
+#include "source_map.h"
+#include "macro_cache.h"
 
 #define TERMINAL_COLOR_BLACK   "\x1b[30m"
 #define TERMINAL_COLOR_RED     "\x1b[31m"
@@ -117,7 +125,6 @@ static struct macro_param *new_param(const char *name)
 
     strncpy(dst, name, alloc);
     param->name = dst;
-    strbuf_init(&param->arg, 0);
     param->next = NULL;
 
     return param;
@@ -130,7 +137,6 @@ static void free_param(struct macro_param *param)
 
     free_param(param->next);
     free(param->name);
-    strbuf_free(&param->arg);
     free(param);
 }
 
@@ -143,9 +149,12 @@ static struct macro_entry *new_entry(const char *name)
     strncpy(dst, name, alloc);
     ent->name = dst;
     ent->repl = NULL;
+    ent->body = NULL;
     ent->is_func = 0;
+    ent->param_count = 0;
     ent->params = NULL;
     ent->next = NULL;
+    ent->stats = NULL;
 
     return ent;
 }
@@ -166,8 +175,10 @@ static struct macro_table *new_macro_table(void)
     struct macro_table *table = malloc(sizeof(struct macro_table));
     int i;
 
-    for (i = 0; i < PP_HASH_SIZE; i++)
+    for (i = 0; i < PP_HASH_SIZE; i++) {
         table->entries[i] = NULL;
+        table->stats[i] = NULL;
+    }
 
     return table;
 }
@@ -191,6 +202,16 @@ static void free_macro_table(struct macro_table *table)
         }
     }
 
+    for (i = 0; i < PP_HASH_SIZE; i++) {
+        struct macro_stats *stats, *next;
+
+        for (stats = table->stats[i]; stats; stats = next) {
+            next = stats->next;
+            free(stats->name);
+            free(stats);
+        }
+    }
+
     free(table);
 }
 
@@ -206,6 +227,25 @@ static struct macro_entry *lookup_macro(struct macro_table *table, const char *n
     return NULL;
 }
 
+static struct macro_stats *find_macro_stats(struct macro_table *table,
+        const char *name)
+{
+    struct macro_stats *stats;
+    const unsigned int h = hash_fn(name);
+
+    for (stats = table->stats[h]; stats; stats = stats->next)
+        if (!strcmp(name, stats->name))
+            return stats;
+
+    stats = calloc(1, sizeof(struct macro_stats));
+    stats->name = malloc(strlen(name) + 1);
+    strcpy(stats->name, name);
+    stats->next = table->stats[h];
+    table->stats[h] = stats;
+
+    return stats;
+}
+
 static struct macro_entry *insert_macro(struct macro_table *table, const char *name)
 {
     struct macro_entry *ent = NULL;
@@ -216,12 +256,28 @@ static struct macro_entry *insert_macro(struct macro_table *table, const char *n
             return ent;
 
     ent = new_entry(name);
+    ent->stats = find_macro_stats(table, name);
     ent->next = table->entries[h];
     table->entries[h] = ent;
 
     return ent;
 }
 
+static void remove_macro(struct macro_table *table, const char *name)
+{
+    struct macro_entry **ent;
+
+    for (ent = &table->entries[hash_fn(name)]; *ent; ent = &(*ent)->next) {
+        if (!strcmp(name, (*ent)->name)) {
+            struct macro_entry *found = *ent;
+
+            *ent = found->next;
+            free_entry(found);
+            return;
+        }
+    }
+}
+
 static void add_replacement(struct macro_entry *mac, const char *repl)
 {
     const size_t alloc = strlen(repl) + 1;
@@ -233,11 +289,157 @@ static void add_replacement(struct macro_entry *mac, const char *repl)
     mac->repl = dst;
 }
 
-static void reset_hideset(struct preprocessor *pp)
+static struct include_table *new_include_table(void)
+{
+    struct include_table *table = malloc(sizeof(struct include_table));
+    int i;
+
+    for (i = 0; i < PP_HASH_SIZE; i++)
+        table->entries[i] = NULL;
+    table->first_read = NULL;
+    table->last_read = NULL;
+
+    return table;
+}
+
+static void free_include_table(struct include_table *table)
 {
     int i;
-    for (i = 0; i < MAX_HIDESET; i++)
-        pp->hideset[i] = NULL;
+
+    if (!table)
+        return;
+
+    for (i = 0; i < PP_HASH_SIZE; i++) {
+        struct include_file *inc = table->entries[i], *tmp;
+
+        while (inc) {
+            tmp = inc->next;
+            free(inc->path);
+            free(inc->guard);
+            free(inc);
+            inc = tmp;
+        }
+    }
+
+    free(table);
+}
+
+/* files are keyed by their normalized paths, so that "o.h", "./o.h" and
+ * "sub/../o.h" are the same file for #pragma once and include guards */
+static struct include_file *insert_include_file(struct include_table *table,
+        const char *name)
+{
+    static char buf[1024] = {'\0'};
+    const char *path = name;
+    struct include_file *inc = NULL;
+    unsigned int h;
+    size_t alloc;
+
+    if (strlen(name) < sizeof(buf)) {
+        strcpy(buf, name);
+        normalize_path(buf);
+        path = buf;
+    }
+    h = hash_fn(path);
+    alloc = strlen(path) + 1;
+
+    for (inc = table->entries[h]; inc; inc = inc->next)
+        if (!strcmp(path, inc->path))
+            return inc;
+
+    inc = malloc(sizeof(struct include_file));
+    inc->path = malloc(sizeof(char) * alloc);
+    strncpy(inc->path, path, alloc);
+    inc->guard = NULL;
+    inc->is_guard_checked = 0;
+    inc->is_once = 0;
+    inc->is_read = 0;
+    inc->next_read = NULL;
+
+    inc->next = table->entries[h];
+    table->entries[h] = inc;
+
+    return inc;
+}
+
+static void add_read_file(struct include_table *table, struct include_file *inc)
+{
+    if (inc->is_read)
+        return;
+
+    inc->is_read = 1;
+    if (table->last_read)
+        table->last_read->next_read = inc;
+    else
+        table->first_read = inc;
+    table->last_read = inc;
+}
+
+static struct include_profile *new_include_profile(void)
+{
+    return calloc(1, sizeof(struct include_profile));
+}
+
+static void free_include_profile(struct include_profile *prof)
+{
+    struct include_record *rec, *rec_next;
+
+    if (!prof)
+        return;
+
+    for (rec = prof->first; rec; rec = rec_next) {
+        rec_next = rec->next;
+        free(rec);
+    }
+    free(prof);
+}
+
+static struct include_record *add_include_record(struct preprocessor *pp,
+        const char *path, long bytes_read)
+{
+    struct include_profile *prof = pp->profile;
+    struct include_record *rec = calloc(1, sizeof(struct include_record));
+
+    rec->path = path;
+    rec->depth = pp->record ? pp->record->depth + 1 : 0;
+    rec->bytes_read = bytes_read;
+
+    if (prof->last)
+        prof->last->next = rec;
+    else
+        prof->first = rec;
+    prof->last = rec;
+
+    return rec;
+}
+
+/* wall time, as waiting for files to be read is part of it */
+static long now_microseconds(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+/* starts counting text and time, from the text offset given */
+static void mark_profile(struct include_profile *prof, long offset)
+{
+    prof->mark_offset = offset;
+    prof->mark_time = now_microseconds();
+}
+
+/* counts text and time since the marks for the current record, and goes
+ * on with the next one */
+static void switch_record(struct include_profile *prof, long offset,
+        struct include_record *next)
+{
+    if (prof->current) {
+        prof->current->bytes_emitted += offset - prof->mark_offset;
+        prof->current->microseconds += now_microseconds() - prof->mark_time;
+    }
+    prof->current = next;
+    mark_profile(prof, offset);
 }
 
 struct preprocessor *new_preprocessor(void)
@@ -247,35 +449,226 @@ struct preprocessor *new_preprocessor(void)
     pp = malloc(sizeof(struct preprocessor));
 
     pp->text = malloc(sizeof(struct strbuf));
-    strbuf_init(pp->text, 1024 * 16 - 1);
+    strbuf_init(pp->text, PP_CHUNK_SIZE * 2 - 1);
     pp->mactab = new_macro_table(); 
+    pp->includes = new_include_table();
+    pp->srcmap = new_source_map();
+    pp->expansions = new_macro_cache();
+    pp->profile = new_include_profile();
+    pp->file = NULL;
+    pp->src = NULL;
+    pp->next = NULL;
+    pp->end = NULL;
+    pp->escaped_newlines = 0;
+    pp->pending_newlines = 0;
     pp->filename = NULL;
     pp->y = 1;
     pp->x = 0;
     pp->prevx = 0;
 
     pp->skip_depth = 0;
+    pp->conds = NULL;
+    pp->included = NULL;
+    pp->record = NULL;
+    pp->error_count = 0;
+    pp->is_caching = 0;
+    pp->has_read_source = 0;
 
-    reset_hideset(pp);
     return pp;
 }
 
 void free_preprocessor(struct preprocessor *pp)
 {
+    struct preprocessor *inc_pp, *inc_next;
+
     if (!pp)
         return;
 
+    /* files left open when the reader stopped early */
+    for (inc_pp = pp->included; inc_pp; inc_pp = inc_next) {
+        struct cond_group *cond, *cond_next;
+
+        inc_next = inc_pp->included;
+        for (cond = inc_pp->conds; cond; cond = cond_next) {
+            cond_next = cond->next;
+            free(cond);
+        }
+        free((char *) inc_pp->src);
+        free(inc_pp);
+    }
+
     strbuf_free(pp->text);
     free(pp->text);
     free_macro_table(pp->mactab);
+    free_include_table(pp->includes);
+    free_source_map(pp->srcmap);
+    free_macro_cache(pp->expansions);
+    free_include_profile(pp->profile);
     free(pp);
 }
 
-const char *get_text(const struct preprocessor *pp)
+void print_include_tree(FILE *fp, const struct preprocessor *pp)
+{
+    const struct include_record *rec;
+
+    /* the text and time of a file leave out those of the files it includes */
+    fprintf(fp, "%10s %10s %10s  %s\n", "read", "emitted", "time(us)", "file");
+
+    for (rec = pp->profile->first; rec; rec = rec->next) {
+        int i;
+
+        fprintf(fp, "%10ld %10ld %10ld  ", rec->bytes_read, rec->bytes_emitted,
+                rec->microseconds);
+        for (i = 0; i < rec->depth; i++)
+            fprintf(fp, ". ");
+        fprintf(fp, "%s\n", rec->path);
+    }
+}
+
+/* macros that have been invoked, defined at the end or not, by bytes
+ * expanded to */
+static struct macro_stats **sorted_macros(const struct macro_table *table,
+        int *count)
+{
+    struct macro_stats **macs;
+    struct macro_stats *mac;
+    int n = 0;
+    int i;
+
+    for (i = 0; i < PP_HASH_SIZE; i++)
+        for (mac = table->stats[i]; mac; mac = mac->next)
+            if (mac->expansion_count > 0)
+                n++;
+
+    macs = malloc(sizeof(struct macro_stats *) * (n > 0 ? n : 1));
+    n = 0;
+
+    for (i = 0; i < PP_HASH_SIZE; i++) {
+        for (mac = table->stats[i]; mac; mac = mac->next) {
+            int j;
+
+            if (mac->expansion_count == 0)
+                continue;
+
+            /* insertion sort */
+            for (j = n; j > 0 && macs[j - 1]->output_bytes < mac->output_bytes; j--)
+                macs[j] = macs[j - 1];
+            macs[j] = mac;
+            n++;
+        }
+    }
+
+    *count = n;
+    return macs;
+}
+
+static void print_macro_table(FILE *fp, const struct macro_table *table)
+{
+    int count = 0;
+    struct macro_stats **macs = sorted_macros(table, &count);
+    int i;
+
+    fprintf(fp, "%-24s %10s %10s %10s\n", "macro", "expansions", "bytes", "depth");
+
+    for (i = 0; i < count; i++)
+        fprintf(fp, "%-24s %10d %10ld %10d\n", macs[i]->name,
+                macs[i]->expansion_count, macs[i]->output_bytes,
+                macs[i]->max_depth);
+
+    free(macs);
+}
+
+void print_preprocessor_stats(FILE *fp, const struct preprocessor *pp)
+{
+    print_include_tree(fp, pp);
+    fprintf(fp, "\n");
+    print_macro_table(fp, pp->mactab);
+    fprintf(fp, "\n");
+    print_macro_cache_stats(fp, pp->expansions);
+}
+
+static void print_json_string(FILE *fp, const char *s)
+{
+    fprintf(fp, "\"");
+    for (; *s; s++) {
+        if (*s == '"' || *s == '\\')
+            fprintf(fp, "\\%c", *s);
+        else if ((unsigned char) *s < ' ')
+            fprintf(fp, "\\u%04x", *s);
+        else
+            fprintf(fp, "%c", *s);
+    }
+    fprintf(fp, "\"");
+}
+
+void print_preprocessor_stats_json(FILE *fp, const struct preprocessor *pp)
+{
+    const struct include_record *rec;
+    int count = 0;
+    struct macro_stats **macs = sorted_macros(pp->mactab, &count);
+    int i;
+
+    fprintf(fp, "{\n  \"includes\": [");
+    for (rec = pp->profile->first; rec; rec = rec->next) {
+        fprintf(fp, rec == pp->profile->first ? "\n    {" : ",\n    {");
+        fprintf(fp, "\"path\": ");
+        print_json_string(fp, rec->path);
+        fprintf(fp, ", \"depth\": %d, \"bytes_read\": %ld, ", rec->depth, rec->bytes_read);
+        fprintf(fp, "\"bytes_emitted\": %ld, \"time_us\": %ld}", rec->bytes_emitted,
+                rec->microseconds);
+    }
+    fprintf(fp, "\n  ],\n  \"macros\": [");
+    for (i = 0; i < count; i++) {
+        fprintf(fp, i == 0 ? "\n    {" : ",\n    {");
+        fprintf(fp, "\"name\": ");
+        print_json_string(fp, macs[i]->name);
+        fprintf(fp, ", \"expansions\": %d, \"output_bytes\": %ld, ",
+                macs[i]->expansion_count, macs[i]->output_bytes);
+        fprintf(fp, "\"max_rescan_depth\": %d}", macs[i]->max_depth);
+    }
+    fprintf(fp, "\n  ],\n  \"expansion_cache\": ");
+    print_macro_cache_stats_json(fp, pp->expansions);
+    fprintf(fp, "\n}\n");
+
+    free(macs);
+}
+
+struct source_map *get_source_map(struct preprocessor *pp)
 {
-    if (!pp || !pp->text)
+    if (!pp)
         return NULL;
-    return pp->text->buf;
+    return pp->srcmap;
+}
+
+static void print_line_marker(const struct line_marker *m)
+{
+    printf("# %d \"%s\"\n", m->line, m->filename);
+}
+
+void print_text(struct preprocessor *pp)
+{
+    const struct source_map *map = pp->srcmap;
+    const char *text;
+    int i = 0;
+
+    while ((text = read_text(pp)) != NULL) {
+        /* offset of the chunk in the whole text */
+        const int base = map->text_length - pp->text->len;
+        int offset = base;
+
+        for (; i < map->line_count && map->lines[i].offset < map->text_length; i++) {
+            const struct line_marker *m = &map->lines[i];
+
+            fwrite(text + offset - base, sizeof(char), m->offset - offset, stdout);
+            print_line_marker(m);
+            offset = m->offset;
+        }
+        printf("%s", text + offset - base);
+    }
+
+    /* files with nothing after them */
+    for (; i < map->line_count; i++)
+        print_line_marker(&map->lines[i]);
 }
 
 static void error_(struct preprocessor *pp, const char *msg)
@@ -288,12 +681,21 @@ static void error_(struct preprocessor *pp, const char *msg)
         fprintf(stderr, TERMINAL_COLOR_RESET);
         fprintf(stderr, "%s\n", msg);
     fprintf(stderr, TERMINAL_DECORATION_RESET);
+
+    pp->error_count++;
 }
 
 /* forward declarations */
-static void text_lines(struct preprocessor *pp);
-static void endif_line(struct preprocessor *pp);
+static int text_lines(struct preprocessor *pp);
+static void push_file(struct preprocessor *pp, const char *filename);
+static int load_precompiled_header(struct preprocessor *pp, const char *path);
 static void whitespaces(struct preprocessor *pp);
+static void if_part(struct preprocessor *pp);
+static void ifdef_part(struct preprocessor *pp);
+static void ifndef_part(struct preprocessor *pp);
+static void elif_part(struct preprocessor *pp);
+static void else_part(struct preprocessor *pp);
+static void endif_line(struct preprocessor *pp);
 
 static int is_skipping(struct preprocessor *pp)
 {
@@ -315,26 +717,45 @@ static void writes(struct preprocessor *pp, const char *c)
     }
 }
 
-static void write_line_directive(struct preprocessor *pp)
+/* offset in the whole output, counting the chunks read before */
+static int text_offset(const struct preprocessor *pp)
 {
-    static char buf[256] = {'\0'};
+    return pp->srcmap->text_length + pp->text->len;
+}
 
-    sprintf(buf, "# %d \"%s\"\n", pp->y, pp->filename);
-    writes(pp, buf);
+/* the text after this is at the current line of the file. the text itself
+ * has no line markers; they are printed from the map for -E */
+static void mark_line(struct preprocessor *pp)
+{
+    if (!is_skipping(pp))
+        add_line_marker(pp->srcmap, text_offset(pp), pp->y, pp->filename);
 }
 
-static void write_column_comment(struct preprocessor *pp)
+/* a block comment was removed from the middle of a line */
+static void mark_column(struct preprocessor *pp)
 {
-    char buf[32] = {'\0'};
-    const int pos = pp->x - 2; /* minus closing 'star and slash' */
-    sprintf(buf, "/*#%d*/", pos);
-    writes(pp, buf);
+    /* the comment still separates tokens */
+    writec(pp, ' ');
+    /* x is at the closing slash, which is the column before the next */
+    if (!is_skipping(pp))
+        add_column_marker(pp->srcmap, text_offset(pp), pp->x);
 }
 
 static int getc_(struct preprocessor *pp)
 {
-    const int c = fgetc(pp->fp);
+    int c;
+
     pp->x++;
+    if (pp->pending_newlines > 0) {
+        pp->pending_newlines--;
+        c = '\n';
+    }
+    else if (pp->next == pp->end) {
+        return EOF;
+    }
+    else {
+        c = (unsigned char) *pp->next++;
+    }
 
     if (c == '\n') {
         pp->y++;
@@ -347,39 +768,42 @@ static int getc_(struct preprocessor *pp)
 
 static void ungetc_(struct preprocessor *pp, int c)
 {
-    ungetc(c, pp->fp);
     if (c == '\n') {
+        /* newlines are all the same. step back over the buffer if possible */
+        if (pp->next > pp->src && pp->next[-1] == '\n')
+            pp->next--;
+        else
+            pp->pending_newlines++;
         pp->y--;
         pp->x = pp->prevx;
     }
     else {
+        if (c != EOF)
+            pp->next--;
         pp->x--;
     }
 }
 
 static int readc(struct preprocessor *pp)
 {
-    static int escapednl = 0;
-    const int c = getc_(pp);
+    int c;
 
-    if (c == '\n') {
-        if (escapednl > 0) {
-            /* pop nl from stack and put the nl back to stream
-             * that was just read. use ungetc as no need to decrease x */
-            escapednl--;
-            ungetc(c, pp->fp);
-        }
+    /* splice lines. the buffer is null terminated so next[1] is safe */
+    while (!pp->pending_newlines && pp->next[0] == '\\' && pp->next[1] == '\n') {
+        pp->next += 2;
+        pp->y++;
+        pp->prevx = pp->x + 2;
+        pp->x = 0;
+        pp->escaped_newlines++;
     }
-    else if (c == '\\') {
-        const int c1 = getc_(pp);
 
-        if (c1 == '\n') {
-            /* push nl to stack and read one more char */
-            escapednl++;
-            return readc(pp);
-        } else {
-            ungetc_(pp, c1);
-        }
+    c = getc_(pp);
+
+    if (c == '\n' && pp->escaped_newlines > 0) {
+        /* emit a newline for each spliced one to keep output lines in sync.
+         * the newline is given back without restoring x and y */
+        pp->escaped_newlines--;
+        pp->pending_newlines++;
     }
 
     return c;
@@ -401,6 +825,141 @@ static int is_macroname(int c)
     return isalnum(c) || c == '_' || c == '$';
 }
 
+static struct pp_token *new_token(int kind, const char *text, size_t len,
+        int has_space, int region)
+{
+    struct pp_token *tok = arena_alloc(region, sizeof(struct pp_token));
+    char *dst = arena_alloc(region, len + 1);
+
+    memcpy(dst, text, len);
+    dst[len] = '\0';
+
+    tok->kind = kind;
+    tok->text = dst;
+    tok->has_space = has_space;
+    tok->param = -1;
+    tok->hideset = NULL;
+    tok->next = NULL;
+
+    return tok;
+}
+
+static int is_ident_start(int c)
+{
+    return isalpha(c) || c == '_' || c == '$';
+}
+
+static int token_kind(const char *text)
+{
+    if (is_ident_start(text[0]))
+        return PPT_IDENT;
+    if (isdigit(text[0]) || (text[0] == '.' && isdigit(text[1])))
+        return PPT_NUMBER;
+    if (text[0] == '"' || text[0] == '\'')
+        return PPT_STRING;
+    return PPT_PUNCT;
+}
+
+static const char *punctuators[] = {
+    "...", "<<=", ">>=",
+    "->", "++", "--", "<<", ">>", "<=", ">=", "==", "!=", "&&", "||",
+    "*=", "/=", "%=", "+=", "-=", "&=", "^=", "|=", "##",
+    NULL
+};
+
+/* returns the length of the longest punctuator at s */
+static int punctuator_length(const char *s)
+{
+    int i;
+
+    for (i = 0; punctuators[i]; i++) {
+        const char *p = punctuators[i];
+        int len = 0;
+
+        while (p[len] && p[len] == s[len])
+            len++;
+        if (!p[len])
+            return len;
+    }
+    return 1;
+}
+
+static const char *scan_pp_token(const char *s)
+{
+    if (is_ident_start(*s)) {
+        while (is_macroname(*s))
+            s++;
+    }
+    else if (isdigit(s[0]) || (s[0] == '.' && isdigit(s[1]))) {
+        /* pp-number */
+        for (;;) {
+            if ((s[0] == 'e' || s[0] == 'E') && (s[1] == '+' || s[1] == '-'))
+                s += 2;
+            else if (is_macroname(*s) || *s == '.')
+                s++;
+            else
+                break;
+        }
+    }
+    else if (*s == '"' || *s == '\'') {
+        const int quot = *s++;
+        while (*s && *s != quot && *s != '\n') {
+            if (s[0] == '\\' && s[1])
+                s++;
+            s++;
+        }
+        if (*s == quot)
+            s++;
+    }
+    else {
+        s += punctuator_length(s);
+    }
+    return s;
+}
+
+/* splits text into a token list. comments are taken as spaces */
+static struct pp_token *tokenize_text(const char *text, int region, int *newlines)
+{
+    struct pp_token head = {0};
+    struct pp_token *tail = &head;
+    const char *s = text;
+    int has_space = 0;
+
+    while (*s) {
+        const char *start = s;
+
+        if (is_whitespaces(*s) || *s == '\n') {
+            if (*s == '\n' && newlines)
+                (*newlines)++;
+            has_space = 1;
+            s++;
+            continue;
+        }
+        if (s[0] == '/' && s[1] == '*') {
+            for (s += 2; *s && !(s[0] == '*' && s[1] == '/'); s++)
+                if (*s == '\n' && newlines)
+                    (*newlines)++;
+            if (*s)
+                s += 2;
+            has_space = 1;
+            continue;
+        }
+        if (s[0] == '/' && s[1] == '/') {
+            while (*s && *s != '\n')
+                s++;
+            has_space = 1;
+            continue;
+        }
+
+        s = scan_pp_token(s);
+        tail->next = new_token(token_kind(start), start, s - start, has_space, region);
+        tail = tail->next;
+        has_space = 0;
+    }
+
+    return head.next;
+}
+
 static void new_line(struct preprocessor *pp)
 {
     int c;
@@ -413,6 +972,17 @@ static void new_line(struct preprocessor *pp)
     writec(pp, c);
 }
 
+static void discard_line(struct preprocessor *pp)
+{
+    int c;
+
+    do {
+        c = readc(pp);
+    } while (c != '\n' && c != EOF);
+
+    unreadc(pp, c);
+}
+
 static void line_comment(struct preprocessor *pp)
 {
     for (;;) {
@@ -578,7 +1148,8 @@ static void read_file_path(struct preprocessor *pp, char *path)
     }
 }
 
-static void file_path(struct preprocessor *pp, char *buf)
+/* returns 1 for <FILENAME> */
+static int file_path(struct preprocessor *pp, char *buf)
 {
     int c, quot;
 
@@ -598,89 +1169,181 @@ static void file_path(struct preprocessor *pp, char *buf)
     if (c != quot)
         goto file_path_error;
 
-    if (quot == '>') {
-        static char tmp[128] = {'\0'};
-        strcpy(tmp, buf);
-        sprintf(buf, "include/%s", tmp);
-    }
-
-    return;
+    return quot == '>';
 
 file_path_error:
     error_(pp, "expected \"FILENAME\" or <FILENAME>");
-    return;
-}
-
-static int const_expression(struct preprocessor *pp)
-{
-    static char expr[128] = {'\0'};
-    token(pp, expr);
-
-    if (expr[0] == '0' && expr[1] == '\0')
-        return 0;
-    return 1;
+    return 0;
 }
 
 static void include_line(struct preprocessor *pp)
 {
-    static char filename[256] = {'\0'};
+    static char name[256] = {'\0'};
+    const char *path;
+    int is_angle;
 
-    file_path(pp, filename);
+    is_angle = file_path(pp, name);
+
+    path = find_include_file(pp->filename, name, is_angle);
+    if (!path) {
+        static char msg[300] = {'\0'};
+        sprintf(msg, "'%s' file not found", name);
+        error_(pp, msg);
+    }
 
     new_line(pp);
 
-    preprocess_file(pp, filename);
-    write_line_directive(pp);
+    if (path && !load_precompiled_header(pp, path))
+        push_file(pp, path);
+    /* otherwise marked when the included file is closed */
+    if (!pp->included)
+        mark_line(pp);
 }
 
-static void if_part(struct preprocessor *pp)
+/* reads the name of a directive line. returns NULL for other lines */
+static const char *directive_name(const char *line, char *name, size_t size)
 {
-    const int val = const_expression(pp);
-    new_line(pp);
+    const char *s = line;
+    size_t len = 0;
 
-    if (!val)
-        pp->skip_depth++;
-}
+    while (is_whitespaces(*s))
+        s++;
+    if (*s != '#')
+        return NULL;
+    s++;
+    while (is_whitespaces(*s))
+        s++;
 
-static void ifdef_part(struct preprocessor *pp)
-{
-    static char ident[128] = {'\0'};
+    while (is_macroname(*s) && len < size - 1)
+        name[len++] = *s++;
+    name[len] = '\0';
 
-    token(pp, ident);
-    new_line(pp);
+    return s;
+}
 
-    if (!lookup_macro(pp->mactab, ident))
-        pp->skip_depth++;
+/* finds the first character that may start a comment or a literal */
+static const char *find_comment_or_literal(const char *s, const char *end)
+{
+    for (; s < end; s++)
+        if (*s == '/' || *s == '"' || *s == '\'')
+            return s;
+    return NULL;
 }
 
-static void ifndef_part(struct preprocessor *pp)
+/* moves past the line, with lines joined by a backslash or a block comment.
+ * comment delimiters in string and character literals are not comments */
+static const char *skip_line(const char *line, const char *end, int *newlines)
 {
-    static char ident[128] = {'\0'};
+    const char *s = line;
 
-    token(pp, ident);
-    new_line(pp);
+    for (;;) {
+        const char *nl = memchr(s, '\n', end - s);
+        const char *p;
+
+        if (!nl)
+            return end;
+
+        /* only lines with a slash or a quote need a closer look */
+        p = find_comment_or_literal(s, nl);
+        if (p && (*p == '"' || *p == '\'')) {
+            const int quot = *p;
+            /* a literal ends at the quote or the end of the line */
+            for (s = p + 1; s < nl && *s != quot; s++)
+                if (s[0] == '\\' && s + 1 < nl)
+                    s++;
+            if (s < nl)
+                s++;
+            continue;
+        }
+        if (p && p[1] == '*') {
+            for (s = p + 2; s < end && !(s[0] == '*' && s[1] == '/'); s++)
+                if (*s == '\n')
+                    (*newlines)++;
+            s = s < end ? s + 2 : end;
+            continue;
+        }
+        if (p && p[1] != '/') {
+            s = p + 1;
+            continue;
+        }
 
-    if (lookup_macro(pp->mactab, ident))
-        pp->skip_depth++;
+        (*newlines)++;
+        if (nl > line && nl[-1] == '\\') {
+            s = nl + 1;
+            continue;
+        }
+        return nl + 1;
+    }
 }
 
-static void endif_line(struct preprocessor *pp)
+/* jumps over the lines of an inactive block, looking only at directives
+ * for nesting, up to the #else, #elif or #endif line that ends it */
+static void skip_inactive_lines(struct preprocessor *pp)
 {
-    new_line(pp);
+    const char *line = pp->next;
+    int newlines = 0;
+    int depth = 0;
+
+    /* new lines given back by readc() */
+    newlines += pp->pending_newlines;
+    pp->pending_newlines = 0;
+    pp->escaped_newlines = 0;
+
+    while (line < pp->end) {
+        char name[16] = {'\0'};
+
+        if (directive_name(line, name, sizeof(name))) {
+            if (!strcmp(name, "if") || !strcmp(name, "ifdef") || !strcmp(name, "ifndef")) {
+                depth++;
+            }
+            else if (!strcmp(name, "else") || !strcmp(name, "elif")) {
+                if (depth == 0)
+                    break;
+            }
+            else if (!strcmp(name, "endif")) {
+                if (depth == 0)
+                    break;
+                depth--;
+            }
+        }
+
+        line = skip_line(line, pp->end, &newlines);
+    }
+
+    pp->next = line;
+    pp->y += newlines;
+    pp->x = 0;
+
+    /* keeps lines in sync */
+    for (; newlines > 0; newlines--)
+        writec(pp, '\n');
+}
 
-    if (pp->skip_depth)
-        pp->skip_depth--;
+static void skip_block(struct preprocessor *pp)
+{
+    pp->skip_depth++;
+    skip_inactive_lines(pp);
 }
 
-static struct macro_param *parameter_list(struct preprocessor *pp)
+/* reads the parameters of a function-like macro. returns 0 for an
+ * object-like macro. () makes a function-like macro with no parameters */
+static int parameter_list(struct preprocessor *pp, struct macro_param **params)
 {
     int c = readc(pp);
 
+    *params = NULL;
+
     if (c == '(') {
         struct macro_param head = {0};
         struct macro_param *tail = &head;
         char name[128] = {'\0'};
 
+        whitespaces(pp);
+        c = readc(pp);
+        if (c == ')')
+            return 1;
+        unreadc(pp, c);
+
         for (;;) {
             struct macro_param *param;
 
@@ -698,11 +1361,37 @@ static struct macro_param *parameter_list(struct preprocessor *pp)
             else if (c == ',')
                 continue;
         }
-        return head.next;
+        *params = head.next;
+        return 1;
 
     } else {
         unreadc(pp, c);
-        return NULL;
+        return 0;
+    }
+}
+
+static void set_body(struct macro_entry *mac)
+{
+    struct macro_param *prm;
+    struct pp_token *tok;
+    int i;
+
+    mac->body = tokenize_text(mac->repl, ARENA_MACRO, NULL);
+
+    mac->param_count = 0;
+    for (prm = mac->params; prm; prm = prm->next)
+        mac->param_count++;
+
+    /* resolve parameters once here instead of at every expansion */
+    for (tok = mac->body; tok; tok = tok->next) {
+        if (tok->kind != PPT_IDENT)
+            continue;
+        for (i = 0, prm = mac->params; prm; i++, prm = prm->next) {
+            if (!strcmp(tok->text, prm->name)) {
+                tok->param = i;
+                break;
+            }
+        }
     }
 }
 
@@ -712,19 +1401,23 @@ static void define_line(struct preprocessor *pp)
     static char repl[1024] = {'\0'};
     struct macro_entry *mac = NULL;
     struct macro_param *params = NULL;
+    int is_func;
 
     token(pp, ident);
 
-    params = parameter_list(pp);
+    is_func = parameter_list(pp, &params);
 
     token_list(pp, repl);
     new_line(pp);
 
+    macro_changed(pp->expansions, ident);
+
     mac = lookup_macro(pp->mactab, ident);
     if (mac) {
         if (strcmp(mac->repl, repl)) {
             /* override */
             add_replacement(mac, repl);
+            set_body(mac);
             /* TODO generate warning */
             error_(pp, "'' macro redefined\n");
         }
@@ -732,11 +1425,23 @@ static void define_line(struct preprocessor *pp)
         mac = insert_macro(pp->mactab, ident);
         add_replacement(mac, repl);
 
-        mac->is_func = (params != NULL);
+        mac->is_func = is_func;
         mac->params = params;
+        set_body(mac);
     }
 }
 
+static void undef_line(struct preprocessor *pp)
+{
+    static char ident[128] = {'\0'};
+
+    token(pp, ident);
+    new_line(pp);
+
+    macro_changed(pp->expansions, ident);
+    remove_macro(pp->mactab, ident);
+}
+
 static void unknown_directive(struct preprocessor *pp, const char *direc)
 {
     writes(pp, "# ");
@@ -750,6 +1455,65 @@ static void unknown_directive(struct preprocessor *pp, const char *direc)
     }
 }
 
+static void pragma_line(struct preprocessor *pp)
+{
+    static char name[128] = {'\0'};
+    const struct preprocessor saved = *pp;
+
+    token(pp, name);
+
+    if (!strcmp(name, "once")) {
+        new_line(pp);
+        pp->file->is_once = 1;
+    }
+    else {
+        /* other pragmas are passed through */
+        *pp = saved;
+        unknown_directive(pp, "pragma");
+    }
+}
+
+/* '#line 12 "file.c"' and '# 12 "file.c"' left in preprocessed text */
+static void line_line(struct preprocessor *pp, const char *direc)
+{
+    static char num[32] = {'\0'};
+    static char name[256] = {'\0'};
+    int c;
+
+    if (!strcmp(direc, "line"))
+        token(pp, num);
+    else
+        strcpy(num, direc);
+
+    if (!isdigit(num[0])) {
+        error_(pp, "#line directive requires a positive integer argument");
+        discard_line(pp);
+        new_line(pp);
+        return;
+    }
+
+    name[0] = '\0';
+    whitespaces(pp);
+    c = readc(pp);
+    if (c == '"') {
+        read_file_path(pp, name);
+        if (readc(pp) != '"')
+            error_(pp, "invalid filename for #line directive");
+    }
+    else {
+        unreadc(pp, c);
+    }
+
+    /* flags after the file name are ignored */
+    discard_line(pp);
+    new_line(pp);
+
+    pp->y = strtol(num, NULL, 10);
+    if (name[0])
+        pp->filename = insert_include_file(pp->includes, name)->path;
+    mark_line(pp);
+}
+
 static void directive_line(struct preprocessor *pp)
 {
     static char direc[128] = {'\0'};
@@ -760,337 +1524,1250 @@ static void directive_line(struct preprocessor *pp)
         include_line(pp);
     else if (!strcmp(direc, "define") && !is_skipping(pp))
         define_line(pp);
+    else if (!strcmp(direc, "undef") && !is_skipping(pp))
+        undef_line(pp);
     else if (!strcmp(direc, "if"))
         if_part(pp);
     else if (!strcmp(direc, "ifdef"))
         ifdef_part(pp);
     else if (!strcmp(direc, "ifndef"))
         ifndef_part(pp);
+    else if (!strcmp(direc, "elif"))
+        elif_part(pp);
+    else if (!strcmp(direc, "else"))
+        else_part(pp);
     else if (!strcmp(direc, "endif"))
         endif_line(pp);
+    else if (!strcmp(direc, "pragma") && !is_skipping(pp))
+        pragma_line(pp);
+    else if ((!strcmp(direc, "line") || isdigit(direc[0])) && !is_skipping(pp))
+        line_line(pp, direc);
     else
         unknown_directive(pp, direc);
 }
 
-static const char *next_arg(const char *args, char *buf)
+static int is_punct(const struct pp_token *tok, const char *punct)
 {
-    int depth = 0;
-    const char *s = args;
-    char *d = buf;
+    return tok && tok->kind == PPT_PUNCT && !strcmp(tok->text, punct);
+}
 
-    for (;;) {
-        if (*s == ',' || *s == '\0')
-            break;
+static struct pp_token *copy_token(const struct pp_token *tok)
+{
+    struct pp_token *dup = arena_alloc(ARENA_EXPANSION, sizeof(struct pp_token));
 
-        if (*s == ')' && depth == 0)
-            break;
+    *dup = *tok;
+    dup->param = -1;
+    dup->next = NULL;
 
-        if (*s == '(')
-            depth++;
-        if (*s == ')')
-            depth--;
+    return dup;
+}
+
+static struct pp_token *copy_tokens(const struct pp_token *list)
+{
+    struct pp_token head = {0};
+    struct pp_token *tail = &head;
+    const struct pp_token *tok;
 
-        *d++ = *s++;
+    for (tok = list; tok; tok = tok->next) {
+        tail->next = copy_token(tok);
+        tail = tail->next;
     }
-    *d = '\0';
-    return s;
+
+    return head.next;
 }
 
-static const char *read_args(const char *args, struct macro_param *params)
+static int in_hideset(const struct hideset *hs, struct macro_entry *mac)
 {
-    struct macro_param *prm = params;
-    char arg_[1024] = {'\0'};
-    const char *s = args;
+    for (; hs; hs = hs->next)
+        if (hs->mac == mac)
+            return 1;
+    return 0;
+}
 
-    while (*s != '(')
-        s++;
-    /* skip the first '(' */
-    s++;
+static struct hideset *hideset_add(struct hideset *hs, struct macro_entry *mac)
+{
+    struct hideset *h;
 
-    for (;;) {
-        if (!prm) {
-            /* TODO error */
-            return NULL;
-        }
+    if (in_hideset(hs, mac))
+        return hs;
 
-        s = next_arg(s, arg_);
-        strbuf_copy(&prm->arg, arg_);
-        prm = prm->next;
+    h = arena_alloc(ARENA_EXPANSION, sizeof(struct hideset));
+    h->mac = mac;
+    h->next = hs;
 
-        if (*s == ')')
-            /* the next char */
-            return s + 1;
-        else if (*s == ',') {
-            s++;
-            continue;
-        }
-        else if (*s == '\0')
-            /* null char */
-            return s;
-    }
+    return h;
 }
 
-static const struct macro_param *find_param(const struct macro_param *params,
-        const char *name)
+static struct hideset *hideset_union(struct hideset *a, struct hideset *b)
 {
-    const struct macro_param *p;
-    for (p = params; p; p = p->next)
-        if (!strcmp(p->name, name))
-            return p;
-    return NULL;
+    for (; a; a = a->next)
+        b = hideset_add(b, a->mac);
+    return b;
 }
 
-static void glue(struct strbuf *dst, const char *src)
+static struct hideset *hideset_intersection(struct hideset *a, struct hideset *b)
 {
-    strbuf_append(dst, src);
-}
+    struct hideset *result = NULL;
 
-static void glue_ch(struct strbuf *dst, char src)
-{
-    strbuf_append_char(dst, src);
+    for (; a; a = a->next)
+        if (in_hideset(b, a->mac))
+            result = hideset_add(result, a->mac);
+    return result;
 }
 
-static void add_hideset(const struct macro_entry *mac,
-        const struct macro_entry **hideset, int max_count)
+static struct pp_token *stringize(const struct pp_token *list, int has_space)
 {
-    int i;
+    struct pp_token *str;
+    const struct pp_token *tok;
+    const char *s;
+    struct strbuf buf;
 
-    if (!mac)
-        return;
+    strbuf_init(&buf, 0);
+    strbuf_append_char(&buf, '"');
 
-    for (i = 0; i < max_count; i++) {
-        if (hideset[i] == mac)
-            /* already in hideset */
-            return;
-        if (hideset[i] == NULL)
-            /* end of list */
-            break;
+    for (tok = list; tok; tok = tok->next) {
+        if (tok != list && tok->has_space)
+            strbuf_append_char(&buf, ' ');
+
+        for (s = tok->text; *s; s++) {
+            if (tok->kind == PPT_STRING && (*s == '"' || *s == '\\'))
+                strbuf_append_char(&buf, '\\');
+            strbuf_append_char(&buf, *s);
+        }
     }
 
-    if (i == max_count)
-        /* hideset is full. TODO error */
-        return;
+    strbuf_append_char(&buf, '"');
+    str = new_token(PPT_STRING, buf.buf, buf.len, has_space, ARENA_EXPANSION);
+    strbuf_free(&buf);
 
-    hideset[i] = mac;
+    return str;
 }
 
-static void union_hideset(struct preprocessor *pp,
-        const struct macro_entry **tmpset, int max_count)
+static void paste(struct pp_token *lhs, const struct pp_token *rhs)
 {
-    int i;
+    const size_t len1 = strlen(lhs->text);
+    const size_t len2 = strlen(rhs->text);
+    char *text = arena_alloc(ARENA_EXPANSION, len1 + len2 + 1);
 
-    for (i = 0; i < max_count; i++) {
-        if (tmpset[i] == NULL)
-            break;
-        add_hideset(tmpset[i], pp->hideset, MAX_HIDESET);
+    memcpy(text, lhs->text, len1);
+    memcpy(text + len1, rhs->text, len2 + 1);
+
+    lhs->text = text;
+    lhs->kind = token_kind(text);
+}
+
+/* forward declaration */
+static struct pp_token *expand_tokens(struct preprocessor *pp,
+        struct pp_token *ts, int *newlines);
+
+static const struct pp_token *expanded_arg(struct preprocessor *pp,
+        struct macro_arg *arg)
+{
+    /* an argument is expanded once however many times it is used */
+    if (!arg->is_expanded) {
+        arg->expanded = expand_tokens(pp, copy_tokens(arg->tokens), NULL);
+        arg->is_expanded = 1;
     }
+    return arg->expanded;
 }
 
-static int in_hideset(struct preprocessor *pp, const struct macro_entry *mac)
+static struct pp_token *subst(struct preprocessor *pp,
+        const struct macro_entry *mac, struct macro_arg *args, struct hideset *hs)
 {
-    int i;
+    struct pp_token head = {0};
+    struct pp_token *tail = &head;
+    /* the last token made by the previous item for ## to paste onto */
+    struct pp_token *last = NULL;
+    const struct pp_token *tok;
+    struct pp_token *t;
+    struct hideset *from = NULL, *to = hs;
 
-    if (!mac)
-        return 0;
+    for (tok = mac->body; tok; tok = tok->next) {
+        const struct pp_token *next = tok->next;
+        struct pp_token *tokens = NULL;
 
-    for (i = 0; i < MAX_HIDESET; i++) {
-        if (pp->hideset[i] == mac)
-            return 1;
-        if (pp->hideset[i] == NULL)
-            return 0;
+        if (mac->is_func && is_punct(tok, "#") && next && next->param >= 0) {
+            tokens = stringize(args[next->param].tokens, tok->has_space);
+            tok = next;
+        }
+        else if (is_punct(tok, "##") && next) {
+            if (next->param >= 0)
+                tokens = copy_tokens(args[next->param].tokens);
+            else
+                tokens = copy_token(next);
+
+            if (tokens && last) {
+                paste(last, tokens);
+                tokens = tokens->next;
+            }
+            tok = next;
+        }
+        else if (tok->param >= 0) {
+            /* operands of ## are not expanded */
+            if (is_punct(next, "##"))
+                tokens = copy_tokens(args[tok->param].tokens);
+            else
+                tokens = copy_tokens(expanded_arg(pp, &args[tok->param]));
+
+            if (tokens)
+                tokens->has_space = tok->has_space;
+            else
+                last = NULL;
+        }
+        else {
+            tokens = copy_token(tok);
+        }
+
+        if (tokens) {
+            tail->next = tokens;
+            while (tail->next)
+                tail = tail->next;
+            last = tail;
+        }
     }
 
-    return 0;
+    /* tokens from the same argument mostly share one hideset */
+    for (t = head.next; t; t = t->next) {
+        if (t->hideset != from) {
+            from = t->hideset;
+            to = hideset_union(from, hs);
+        }
+        t->hideset = to;
+    }
+
+    return head.next;
 }
 
-static const char *expand_fn(const struct macro_entry *mac,
-        const char *args, struct strbuf *dst)
+static void read_literal(struct preprocessor *pp, struct strbuf *dst, int quot)
 {
-    char tok[128] = {'\0'};
-    char *t = tok;
-    const char *s = mac->repl;
-    const char *end_of_args;
-
-    end_of_args = read_args(args, mac->params);
-
     for (;;) {
-        if (is_macroname(*s)) {
-            /* making token */
-            *t = *s;
-            t++;
-        } else {
-            *t = '\0';
-            if (t != tok) {
-                /* end of token */
-                const struct macro_param *prm = find_param(mac->params, tok);
-                if (prm)
-                    glue(dst, prm->arg.buf);
-                else
-                    glue(dst, tok);
-            }
-            t = tok;
-            glue_ch(dst, *s);
+        const int c = readc(pp);
 
-            /* skip trailing spaces */
-            if (is_whitespaces(*s))
-                while (is_whitespaces(*(s + 1)))
-                    s++;
+        if (c == EOF || c == '\n') {
+            unreadc(pp, c);
+            break;
         }
 
-        /* need check after substitution, otherwise a token ending with
-         * null char won't be substituted */
-        if (!*s)
+        strbuf_append_char(dst, c);
+
+        if (c == quot)
             break;
-        s++;
+        else if (c == '\\')
+            strbuf_append_char(dst, readc(pp));
     }
-
-    return end_of_args;
 }
 
-static int subst(struct preprocessor *pp, const char *ts, struct strbuf *dst)
+static void read_comment(struct preprocessor *pp, struct strbuf *dst)
 {
-#define MAX_TMPSET 16
-    const struct macro_entry *tmpset[MAX_TMPSET] = {NULL};
-    struct macro_entry *mac;
-    int has_subst = 0;
-    char tok[128] = {'\0'};
-    char *t = tok;
-    const char *s = ts;
+    strbuf_append(dst, "/*");
 
     for (;;) {
-        if (is_macroname(*s)) {
-            /* making token */
-            *t = *s;
-            t++;
-        } else {
-            *t = '\0';
-            if (t != tok) {
-                /* end of token */
-                int in_hs;
-                mac = lookup_macro(pp->mactab, tok);
-                in_hs = in_hideset(pp, mac);
-
-                if (mac && mac->repl && !in_hs) {
-                    if (mac->is_func)
-                        s = expand_fn(mac, s, dst);
-                    else
-                        glue(dst, mac->repl);
-
-                    add_hideset(mac, tmpset, MAX_TMPSET);
-                    has_subst = 1;
-                } else {
-                    glue(dst, tok);
-                }
-            }
-            t = tok;
-            glue_ch(dst, *s);
-        }
+        const int c = readc(pp);
 
-        /* need check after substitution, otherwise a token ending with
-         * null char won't be substituted */
-        if (!*s)
+        if (c == EOF) {
+            error_(pp, "unterminated /* comment");
             break;
-        s++;
-    }
+        }
+
+        strbuf_append_char(dst, c);
 
-    union_hideset(pp, tmpset, MAX_TMPSET);
-    return has_subst;
+        if (c == '*') {
+            const int c1 = readc(pp);
+            if (c1 == '/') {
+                strbuf_append_char(dst, c1);
+                break;
+            }
+            unreadc(pp, c1);
+        }
+    }
 }
 
-static void expand_ts(struct preprocessor *pp, const char *ts)
+/* reads arguments of a function-like macro whose name ended the expansion */
+static struct pp_token *read_source_args(struct preprocessor *pp, int *newlines)
 {
-    int nsubst = 0;
-    struct strbuf result;
-    strbuf_init(&result, 0);
+    const struct preprocessor saved = *pp;
+    struct pp_token *args = NULL;
+    struct strbuf buf;
+    int depth = 1;
+    int c;
 
-    if (ts && ts[0] == '\0')
-        return;
+    do {
+        c = readc(pp);
+    } while (is_whitespaces(c));
+
+    if (c != '(') {
+        /* not an invocation. leave the text for text_lines() */
+        *pp = saved;
+        return NULL;
+    }
+
+    strbuf_init(&buf, 0);
+    strbuf_append_char(&buf, c);
+
+    while (depth > 0) {
+        c = readc(pp);
+
+        if (c == EOF) {
+            error_(pp, "unterminated argument list");
+            break;
+        }
+        else if (c == '/') {
+            const int c1 = readc(pp);
+            if (c1 == '*') {
+                read_comment(pp, &buf);
+                continue;
+            }
+            unreadc(pp, c1);
+        }
 
-    nsubst = subst(pp, ts, &result);
+        strbuf_append_char(&buf, c);
 
-    if (0) {
-        static int depth = 0;
-        printf("depth: [%d]\n", depth);
-        printf("[%s]\n    => [%s] (%d)\n\n", ts, result.buf, nsubst);
-        depth++;
+        if (c == '(')
+            depth++;
+        else if (c == ')')
+            depth--;
+        else if (c == '"' || c == '\'')
+            read_literal(pp, &buf, c);
     }
 
-    if (nsubst)
-        expand_ts(pp, result.buf);
-    else
-        writes(pp, result.buf);
-    strbuf_free(&result);
+    args = tokenize_text(buf.buf, ARENA_EXPANSION, newlines);
+    strbuf_free(&buf);
+
+    return args;
 }
 
-static void glue_args(struct preprocessor *pp, struct strbuf *dst)
+/* splits tokens after '(' into arguments. returns the closing ')'. a macro
+ * without parameters takes F() with no arguments rather than an empty one.
+ * tokens after too many arguments are skipped up to the ')' */
+static struct pp_token *collect_args(struct preprocessor *pp,
+        const struct macro_entry *mac, struct pp_token *lparen,
+        struct macro_arg **args)
 {
+    struct macro_arg *arg = NULL;
+    struct pp_token *tail = NULL;
+    struct pp_token *tok, *next;
     int depth = 0;
-    int done = 0;
+    int nargs = 0;
+    int too_many = 0;
 
-    for (;;) {
-        const int c = readc(pp);
+    if (mac->param_count > 0) {
+        arg = arena_alloc(ARENA_EXPANSION,
+                sizeof(struct macro_arg) * mac->param_count);
+        nargs = 1;
+    }
 
-        if (c == '(')
-            depth++;
+    for (tok = lparen->next; tok; tok = next) {
+        next = tok->next;
 
-        if (c == ')')
-            done = (--depth == 0);
+        if (depth == 0 && is_punct(tok, ")")) {
+            if (nargs < mac->param_count)
+                error_(pp, "too few arguments for macro");
+            *args = arg;
+            return tok;
+        }
 
-        glue_ch(dst, c);
+        if (!too_many && (nargs == 0 ||
+                    (depth == 0 && is_punct(tok, ",") &&
+                     nargs == mac->param_count))) {
+            error_(pp, "too many arguments for macro");
+            too_many = 1;
+        }
 
-        if (done)
-            return;
+        if (is_punct(tok, "("))
+            depth++;
+        else if (is_punct(tok, ")"))
+            depth--;
 
-        if (!c) {
-            /* TODO error */
-            return;
+        if (too_many)
+            continue;
+
+        if (depth == 0 && is_punct(tok, ",")) {
+            nargs++;
+            tail = NULL;
+            continue;
         }
+
+        tok->next = NULL;
+        if (tail)
+            tail->next = tok;
+        else
+            arg[nargs - 1].tokens = tok;
+        tail = tok;
     }
+
+    error_(pp, "unterminated argument list");
+    return NULL;
 }
 
-static void expand(struct preprocessor *pp)
+/* Prosser's algorithm. a macro expansion is put back in front of the rest
+ * of tokens to be rescanned, with the names expanded so far in hidesets.
+ * when newlines is given, arguments for a function-like macro at the end
+ * are read from the source and the number of lines they span is added */
+static struct pp_token *expand_tokens(struct preprocessor *pp,
+        struct pp_token *ts, int *newlines)
 {
-    static char tok[128] = {'\0'};
-    struct macro_entry *mac;
+    struct pp_token head = {0};
+    struct pp_token *tail = &head;
 
-    token(pp, tok);
+    while (ts) {
+        struct pp_token *tok = ts;
+        struct macro_entry *mac = NULL;
+        struct pp_token *result = NULL;
+        struct pp_token *rest = NULL;
 
-    mac = lookup_macro(pp->mactab, tok);
+        if (tok->kind == PPT_IDENT)
+            mac = lookup_macro(pp->mactab, tok->text);
+        if (tok->kind == PPT_IDENT && pp->is_caching)
+            watch_name(pp->expansions, tok->text);
 
-    if (mac) {
-        /* makes token sequence */
-        struct strbuf ts;
-        strbuf_init(&ts, 0);
-        reset_hideset(pp);
+        if (mac && in_hideset(tok->hideset, mac))
+            mac = NULL;
+
+        if (mac && mac->is_func) {
+            if (!tok->next && newlines) {
+                tok->next = read_source_args(pp, newlines);
+                pp->has_read_source = 1;
+            }
+            if (!is_punct(tok->next, "("))
+                mac = NULL;
+        }
+
+        if (!mac) {
+            ts = tok->next;
+            tok->next = NULL;
+            tail->next = tok;
+            tail = tok;
+            continue;
+        }
+
+        if (mac->is_func) {
+            struct macro_arg *args = NULL;
+            struct pp_token *rparen = collect_args(pp, mac, tok->next, &args);
+
+            if (!rparen) {
+                /* the argument list was taken apart. drop the invocation */
+                ts = NULL;
+                continue;
+            }
+            result = subst(pp, mac, args,
+                    hideset_add(hideset_intersection(tok->hideset, rparen->hideset), mac));
+            rest = rparen->next;
+        }
+        else {
+            result = subst(pp, mac, NULL, hideset_add(tok->hideset, mac));
+            rest = tok->next;
+        }
 
-        glue(&ts, tok);
-        if (mac->is_func)
-            glue_args(pp, &ts);
+        if (result) {
+            struct pp_token *last = result;
 
-        expand_ts(pp, ts.buf);
-        strbuf_free(&ts);
+            result->has_space = tok->has_space;
+            while (last->next)
+                last = last->next;
+            last->next = rest;
+            ts = result;
+        }
+        else {
+            ts = rest;
+        }
     }
-    else {
-        writes(pp, tok);
+
+    return head.next;
+}
+
+static void append_tokens(struct strbuf *dst, const struct pp_token *list)
+{
+    const struct pp_token *tok;
+
+    for (tok = list; tok; tok = tok->next) {
+        if (tok != list && tok->has_space)
+            strbuf_append_char(dst, ' ');
+        strbuf_append(dst, tok->text);
     }
 }
 
-static void text_lines(struct preprocessor *pp)
+/* a token has been rescanned once for each macro in its hideset */
+static int rescan_depth(const struct pp_token *ts)
 {
-    for (;;) {
-        const int c = readc(pp);
+    const struct pp_token *tok;
+    int max = 0;
 
-        if (c == '/') {
-            const int c1 = readc(pp);
-            if (c1 == '/') {
-                line_comment(pp);
+    for (tok = ts; tok; tok = tok->next) {
+        const struct hideset *hs;
+        int depth = 0;
+
+        for (hs = tok->hideset; hs; hs = hs->next)
+            depth++;
+        if (max < depth)
+            max = depth;
+    }
+
+    return max;
+}
+
+/* expands the invocation from tokens read so far and caches the result
+ * unless it took more text from the source */
+static void expand_invocation(struct preprocessor *pp, struct macro_entry *mac,
+        struct pp_token *ts, const char *key, int *newlines)
+{
+    struct strbuf text;
+    int depth;
+
+    strbuf_init(&text, 0);
+
+    pp->is_caching = 1;
+    pp->has_read_source = 0;
+    ts = expand_tokens(pp, ts, newlines);
+    pp->is_caching = 0;
+
+    append_tokens(&text, ts);
+    if (!pp->has_read_source)
+        add_expansion(pp->expansions, key, text.buf);
+
+    /* cached ones are of the same depth */
+    depth = rescan_depth(ts);
+    if (mac->stats->max_depth < depth)
+        mac->stats->max_depth = depth;
+    mac->stats->output_bytes += text.len;
+
+    writes(pp, text.buf);
+    strbuf_free(&text);
+}
+
+static void expand(struct preprocessor *pp)
+{
+    static char tok[128] = {'\0'};
+    struct macro_entry *mac;
+
+    token(pp, tok);
+
+    mac = lookup_macro(pp->mactab, tok);
+
+    if (mac && !is_skipping(pp)) {
+        struct pp_token *ts, *args = NULL;
+        struct strbuf key;
+        const char *cached;
+        int newlines = 0;
+
+        if (mac->is_func) {
+            args = read_source_args(pp, &newlines);
+            if (!args) {
+                /* not an invocation */
+                writes(pp, tok);
+                return;
+            }
+        }
+
+        /* the name and the arguments as they are */
+        ts = new_token(PPT_IDENT, tok, strlen(tok), 0, ARENA_EXPANSION);
+        ts->next = args;
+
+        strbuf_init(&key, 0);
+        append_tokens(&key, ts);
+
+        cached = find_expansion(pp->expansions, key.buf);
+        if (cached) {
+            writes(pp, cached);
+            mac->stats->output_bytes += strlen(cached);
+        }
+        else {
+            expand_invocation(pp, mac, ts, key.buf, &newlines);
+        }
+        mac->stats->expansion_count++;
+
+        strbuf_free(&key);
+
+        /* keep lines in sync when arguments spanned multiple lines */
+        for (; newlines > 0; newlines--)
+            writec(pp, '\n');
+
+        reset_arena(ARENA_EXPANSION);
+    }
+    else {
+        writes(pp, tok);
+    }
+}
+
+static void push_cond(struct preprocessor *pp, int is_taken)
+{
+    struct cond_group *cond = malloc(sizeof(struct cond_group));
+
+    cond->is_taken = is_taken;
+    cond->next = pp->conds;
+    pp->conds = cond;
+}
+
+static void pop_cond(struct preprocessor *pp)
+{
+    struct cond_group *cond = pp->conds;
+
+    pp->conds = cond->next;
+    free(cond);
+}
+
+/* reads the rest of the directive. comments become spaces, and a block
+ * comment carries the directive over the new lines in it */
+static void read_line_text(struct preprocessor *pp, struct strbuf *dst)
+{
+    for (;;) {
+        const int c = readc(pp);
+
+        if (c == '\n' || c == EOF) {
+            unreadc(pp, c);
+            break;
+        }
+        else if (c == '/') {
+            const int c1 = readc(pp);
+            if (c1 == '*') {
+                block_comment(pp);
+                strbuf_append_char(dst, ' ');
+                continue;
+            }
+            if (c1 == '/') {
+                discard_line(pp);
+                continue;
+            }
+            unreadc(pp, c1);
+        }
+
+        strbuf_append_char(dst, c);
+
+        if (c == '"' || c == '\'')
+            read_literal(pp, dst, c);
+    }
+}
+
+/* replaces 'defined X' and 'defined(X)' with 1 or 0 before expansion */
+static struct pp_token *replace_defined(struct preprocessor *pp,
+        struct pp_token *ts)
+{
+    struct pp_token head = {0};
+    struct pp_token *tail = &head;
+    struct pp_token *tok = ts;
+
+    while (tok) {
+        struct pp_token *name = tok->next;
+        struct pp_token *next;
+        int has_paren;
+
+        if (tok->kind != PPT_IDENT || strcmp(tok->text, "defined")) {
+            tail->next = tok;
+            tail = tok;
+            tok = tok->next;
+            continue;
+        }
+
+        has_paren = is_punct(name, "(");
+        if (has_paren)
+            name = name->next;
+
+        if (!name || name->kind != PPT_IDENT) {
+            error_(pp, "macro name missing after 'defined'");
+            break;
+        }
+        next = name->next;
+        if (has_paren) {
+            if (!is_punct(next, ")")) {
+                error_(pp, "missing ')' after 'defined'");
+                break;
+            }
+            next = next->next;
+        }
+
+        tail->next = new_token(PPT_NUMBER,
+                lookup_macro(pp->mactab, name->text) ? "1" : "0", 1,
+                tok->has_space, ARENA_EXPANSION);
+        tail = tail->next;
+        tok = next;
+    }
+
+    tail->next = NULL;
+    return head.next;
+}
+
+/* value of #if expressions. unsigned values share the bits of long and
+ * are compared and divided with the helpers below, which keep to signed
+ * arithmetic so every stage of the compiler evaluates them alike */
+struct cond_value {
+    long value;
+    int is_unsigned;
+};
+
+/* evaluators of #if expressions. operands of && || ?: that are
+ * not evaluated in C are parsed with 'eval' off so they make no errors */
+static struct cond_value cond_conditional(struct preprocessor *pp,
+        struct pp_token **tok, int eval);
+
+static int consume_punct(struct pp_token **tok, const char *punct)
+{
+    if (!is_punct(*tok, punct))
+        return 0;
+    *tok = (*tok)->next;
+    return 1;
+}
+
+static struct cond_value make_value(long value, int is_unsigned)
+{
+    struct cond_value val;
+
+    val.value = value;
+    val.is_unsigned = is_unsigned;
+    return val;
+}
+
+/* the result is unsigned if either operand is */
+static struct cond_value convert_operands(struct cond_value l,
+        struct cond_value r, long value)
+{
+    return make_value(value, l.is_unsigned || r.is_unsigned);
+}
+
+static int unsigned_less(long l, long r)
+{
+    if ((l < 0) != (r < 0))
+        return r < 0;
+    return l < r;
+}
+
+static int value_less(struct cond_value l, struct cond_value r)
+{
+    if (l.is_unsigned || r.is_unsigned)
+        return unsigned_less(l.value, r.value);
+    return l.value < r.value;
+}
+
+static long unsigned_shift_right(long l, long n)
+{
+    return (long) ((unsigned long) l >> n);
+}
+
+static long unsigned_divide(long l, long r, int is_div)
+{
+    long q;
+
+    if (r < 0) {
+        /* divisor is not less than 2^63 */
+        q = !unsigned_less(l, r);
+    }
+    else if (l >= 0) {
+        q = l / r;
+    }
+    else {
+        /* halve the dividend to fit in long, then fix the last bit */
+        q = unsigned_shift_right(l, 1) / r * 2;
+        if (!unsigned_less((long) ((unsigned long) l - (unsigned long) q * r), r))
+            q++;
+    }
+
+    if (is_div)
+        return q;
+    return (long) ((unsigned long) l - (unsigned long) q * r);
+}
+
+static long char_constant(const char *text)
+{
+    /* text[0] is the opening quote */
+    if (text[1] == '\\') {
+        char es[4] = {'\0'};
+        int ch = '\0';
+
+        es[0] = '\\';
+        es[1] = text[2];
+        if (escape_sequence_to_char(es, &ch))
+            return ch;
+        return text[2];
+    }
+    return text[1];
+}
+
+static struct cond_value number_constant(struct preprocessor *pp,
+        const char *text)
+{
+    const char *s = text;
+    unsigned long val = 0;
+    int base = 10;
+    int is_unsigned;
+
+    if (s[0] == '0' && (s[1] == 'x' || s[1] == 'X')) {
+        base = 16;
+        s += 2;
+    }
+    else if (s[0] == '0') {
+        base = 8;
+    }
+
+    for (; *s; s++) {
+        int digit;
+
+        if (isdigit(*s))
+            digit = *s - '0';
+        else if (base == 16 && *s >= 'a' && *s <= 'f')
+            digit = *s - 'a' + 10;
+        else if (base == 16 && *s >= 'A' && *s <= 'F')
+            digit = *s - 'A' + 10;
+        else
+            break;
+
+        if (digit >= base)
+            break;
+        val = val * base + digit;
+    }
+
+    /* values that do not fit in long are unsigned long */
+    is_unsigned = (long) val < 0;
+
+    for (; *s; s++) {
+        if (*s == 'u' || *s == 'U') {
+            is_unsigned = 1;
+        }
+        else if (*s != 'l' && *s != 'L') {
+            error_(pp, "invalid integer constant in expression");
+            break;
+        }
+    }
+
+    return make_value((long) val, is_unsigned);
+}
+
+static struct cond_value cond_primary(struct preprocessor *pp,
+        struct pp_token **tok, int eval)
+{
+    const struct pp_token *t = *tok;
+    struct cond_value val = {0};
+
+    if (!t) {
+        error_(pp, "expected value in expression");
+        return val;
+    }
+
+    if (consume_punct(tok, "(")) {
+        val = cond_conditional(pp, tok, eval);
+        if (!consume_punct(tok, ")"))
+            error_(pp, "expected ')' in expression");
+        return val;
+    }
+
+    if (t->kind == PPT_IDENT && !strcmp(t->text, "defined")) {
+        /* replace_defined() ran before expansion. step over the operand */
+        error_(pp, "'defined' generated by macro expansion in #if");
+        *tok = t->next;
+        if (is_punct(*tok, "("))
+            while (*tok && !is_punct(*tok, ")"))
+                *tok = (*tok)->next;
+        if (*tok)
+            *tok = (*tok)->next;
+        return val;
+    }
+
+    if (t->kind == PPT_NUMBER)
+        val = number_constant(pp, t->text);
+    else if (t->kind == PPT_STRING && t->text[0] == '\'')
+        val.value = char_constant(t->text);
+    else if (t->kind == PPT_IDENT)
+        /* names left after expansion */
+        val.value = 0;
+    else
+        error_(pp, "invalid token in expression");
+
+    *tok = t->next;
+    return val;
+}
+
+static struct cond_value cond_unary(struct preprocessor *pp,
+        struct pp_token **tok, int eval)
+{
+    struct cond_value val;
+
+    if (consume_punct(tok, "+"))
+        return cond_unary(pp, tok, eval);
+
+    if (consume_punct(tok, "-")) {
+        val = cond_unary(pp, tok, eval);
+        val.value = -val.value;
+        return val;
+    }
+    if (consume_punct(tok, "~")) {
+        val = cond_unary(pp, tok, eval);
+        val.value = ~val.value;
+        return val;
+    }
+    if (consume_punct(tok, "!")) {
+        val = cond_unary(pp, tok, eval);
+        return make_value(!val.value, 0);
+    }
+
+    return cond_primary(pp, tok, eval);
+}
+
+static struct cond_value cond_multiplicative(struct preprocessor *pp,
+        struct pp_token **tok, int eval)
+{
+    struct cond_value val = cond_unary(pp, tok, eval);
+
+    for (;;) {
+        if (consume_punct(tok, "*")) {
+            const struct cond_value r = cond_unary(pp, tok, eval);
+            val = convert_operands(val, r, val.value * r.value);
+        }
+        else if (is_punct(*tok, "/") || is_punct(*tok, "%")) {
+            const int is_div = is_punct(*tok, "/");
+            struct cond_value r;
+
+            *tok = (*tok)->next;
+            r = cond_unary(pp, tok, eval);
+
+            if (r.value == 0) {
+                if (eval)
+                    error_(pp, "division by zero in #if");
+                val = convert_operands(val, r, 0);
+            }
+            else if (val.is_unsigned || r.is_unsigned) {
+                val = convert_operands(val, r,
+                        unsigned_divide(val.value, r.value, is_div));
+            }
+            else {
+                val.value = is_div ? val.value / r.value : val.value % r.value;
+            }
+        }
+        else {
+            return val;
+        }
+    }
+}
+
+static struct cond_value cond_additive(struct preprocessor *pp,
+        struct pp_token **tok, int eval)
+{
+    struct cond_value val = cond_multiplicative(pp, tok, eval);
+
+    for (;;) {
+        struct cond_value r;
+
+        if (consume_punct(tok, "+")) {
+            r = cond_multiplicative(pp, tok, eval);
+            val = convert_operands(val, r, val.value + r.value);
+        }
+        else if (consume_punct(tok, "-")) {
+            r = cond_multiplicative(pp, tok, eval);
+            val = convert_operands(val, r, val.value - r.value);
+        }
+        else {
+            return val;
+        }
+    }
+}
+
+/* the type of a shift is the one of its left operand */
+static struct cond_value cond_shift(struct preprocessor *pp,
+        struct pp_token **tok, int eval)
+{
+    struct cond_value val = cond_additive(pp, tok, eval);
+
+    for (;;) {
+        struct cond_value r;
+
+        if (consume_punct(tok, "<<")) {
+            r = cond_additive(pp, tok, eval);
+            val.value <<= r.value;
+        }
+        else if (consume_punct(tok, ">>")) {
+            r = cond_additive(pp, tok, eval);
+            if (val.is_unsigned)
+                val.value = unsigned_shift_right(val.value, r.value);
+            else
+                val.value >>= r.value;
+        }
+        else {
+            return val;
+        }
+    }
+}
+
+static struct cond_value cond_relational(struct preprocessor *pp,
+        struct pp_token **tok, int eval)
+{
+    struct cond_value val = cond_shift(pp, tok, eval);
+
+    for (;;) {
+        struct cond_value r;
+
+        if (consume_punct(tok, "<")) {
+            r = cond_shift(pp, tok, eval);
+            val = make_value(value_less(val, r), 0);
+        }
+        else if (consume_punct(tok, ">")) {
+            r = cond_shift(pp, tok, eval);
+            val = make_value(value_less(r, val), 0);
+        }
+        else if (consume_punct(tok, "<=")) {
+            r = cond_shift(pp, tok, eval);
+            val = make_value(!value_less(r, val), 0);
+        }
+        else if (consume_punct(tok, ">=")) {
+            r = cond_shift(pp, tok, eval);
+            val = make_value(!value_less(val, r), 0);
+        }
+        else {
+            return val;
+        }
+    }
+}
+
+static struct cond_value cond_equality(struct preprocessor *pp,
+        struct pp_token **tok, int eval)
+{
+    struct cond_value val = cond_relational(pp, tok, eval);
+
+    for (;;) {
+        struct cond_value r;
+
+        if (consume_punct(tok, "==")) {
+            r = cond_relational(pp, tok, eval);
+            val = make_value(val.value == r.value, 0);
+        }
+        else if (consume_punct(tok, "!=")) {
+            r = cond_relational(pp, tok, eval);
+            val = make_value(val.value != r.value, 0);
+        }
+        else {
+            return val;
+        }
+    }
+}
+
+static struct cond_value cond_and(struct preprocessor *pp,
+        struct pp_token **tok, int eval)
+{
+    struct cond_value val = cond_equality(pp, tok, eval);
+
+    while (consume_punct(tok, "&")) {
+        const struct cond_value r = cond_equality(pp, tok, eval);
+        val = convert_operands(val, r, val.value & r.value);
+    }
+    return val;
+}
+
+static struct cond_value cond_xor(struct preprocessor *pp,
+        struct pp_token **tok, int eval)
+{
+    struct cond_value val = cond_and(pp, tok, eval);
+
+    while (consume_punct(tok, "^")) {
+        const struct cond_value r = cond_and(pp, tok, eval);
+        val = convert_operands(val, r, val.value ^ r.value);
+    }
+    return val;
+}
+
+static struct cond_value cond_or(struct preprocessor *pp,
+        struct pp_token **tok, int eval)
+{
+    struct cond_value val = cond_xor(pp, tok, eval);
+
+    while (consume_punct(tok, "|")) {
+        const struct cond_value r = cond_xor(pp, tok, eval);
+        val = convert_operands(val, r, val.value | r.value);
+    }
+    return val;
+}
+
+static struct cond_value cond_logical_and(struct preprocessor *pp,
+        struct pp_token **tok, int eval)
+{
+    struct cond_value val = cond_or(pp, tok, eval);
+
+    while (consume_punct(tok, "&&")) {
+        const struct cond_value r = cond_or(pp, tok, eval && val.value);
+        val = make_value(val.value && r.value, 0);
+    }
+    return val;
+}
+
+static struct cond_value cond_logical_or(struct preprocessor *pp,
+        struct pp_token **tok, int eval)
+{
+    struct cond_value val = cond_logical_and(pp, tok, eval);
+
+    while (consume_punct(tok, "||")) {
+        const struct cond_value r = cond_logical_and(pp, tok, eval && !val.value);
+        val = make_value(val.value || r.value, 0);
+    }
+    return val;
+}
+
+static struct cond_value cond_conditional(struct preprocessor *pp,
+        struct pp_token **tok, int eval)
+{
+    const struct cond_value cond = cond_logical_or(pp, tok, eval);
+    struct cond_value then, els;
+
+    if (!consume_punct(tok, "?"))
+        return cond;
+
+    then = cond_conditional(pp, tok, eval && cond.value);
+    if (!consume_punct(tok, ":"))
+        error_(pp, "expected ':' in expression");
+    els = cond_conditional(pp, tok, eval && !cond.value);
+
+    /* both arms take the converted type */
+    return convert_operands(then, els, cond.value ? then.value : els.value);
+}
+
+static long const_expression(struct preprocessor *pp)
+{
+    struct pp_token *ts;
+    struct strbuf line;
+    struct cond_value val;
+
+    strbuf_init(&line, 0);
+    read_line_text(pp, &line);
+
+    ts = tokenize_text(line.buf, ARENA_EXPANSION, NULL);
+    ts = replace_defined(pp, ts);
+    ts = expand_tokens(pp, ts, NULL);
+
+    val = cond_conditional(pp, &ts, 1);
+    if (ts)
+        error_(pp, "extra tokens at end of #if expression");
+
+    strbuf_free(&line);
+    reset_arena(ARENA_EXPANSION);
+
+    return val.value;
+}
+
+static void begin_group(struct preprocessor *pp, int cond)
+{
+    push_cond(pp, cond);
+    if (!cond)
+        skip_block(pp);
+}
+
+/* the rest of the group is skipped once a part has been taken */
+static void skip_rest_of_group(struct preprocessor *pp)
+{
+    if (is_skipping(pp))
+        skip_inactive_lines(pp);
+    else
+        skip_block(pp);
+}
+
+static void if_part(struct preprocessor *pp)
+{
+    const long val = const_expression(pp);
+    new_line(pp);
+
+    begin_group(pp, val != 0);
+}
+
+static void ifdef_part(struct preprocessor *pp)
+{
+    static char ident[128] = {'\0'};
+
+    token(pp, ident);
+    new_line(pp);
+
+    begin_group(pp, lookup_macro(pp->mactab, ident) != NULL);
+}
+
+static void ifndef_part(struct preprocessor *pp)
+{
+    static char ident[128] = {'\0'};
+
+    token(pp, ident);
+    new_line(pp);
+
+    begin_group(pp, lookup_macro(pp->mactab, ident) == NULL);
+}
+
+static void elif_part(struct preprocessor *pp)
+{
+    long val;
+
+    if (!pp->conds || pp->conds->is_taken) {
+        /* the expression is not evaluated */
+        struct strbuf line;
+
+        if (!pp->conds)
+            error_(pp, "#elif without #if");
+        strbuf_init(&line, 0);
+        read_line_text(pp, &line);
+        strbuf_free(&line);
+        new_line(pp);
+
+        if (pp->conds)
+            skip_rest_of_group(pp);
+        return;
+    }
+
+    val = const_expression(pp);
+    new_line(pp);
+
+    if (val) {
+        pp->conds->is_taken = 1;
+        pp->skip_depth = 0;
+    }
+    else {
+        skip_inactive_lines(pp);
+    }
+}
+
+static void else_part(struct preprocessor *pp)
+{
+    if (!pp->conds) {
+        error_(pp, "#else without #if");
+        new_line(pp);
+        return;
+    }
+    new_line(pp);
+
+    if (pp->conds->is_taken) {
+        skip_rest_of_group(pp);
+    }
+    else {
+        pp->conds->is_taken = 1;
+        pp->skip_depth = 0;
+    }
+}
+
+static void endif_line(struct preprocessor *pp)
+{
+    if (!pp->conds) {
+        error_(pp, "#endif without #if");
+        new_line(pp);
+        return;
+    }
+    new_line(pp);
+
+    pop_cond(pp);
+    pp->skip_depth = 0;
+}
+
+/* reads lines until the end of file, an #include or a full chunk of text.
+ * returns EOF at the end of file */
+static int text_lines(struct preprocessor *pp)
+{
+    for (;;) {
+        int c;
+
+        if (pp->included)
+            return 0;
+        if (pp->text->len >= PP_CHUNK_SIZE && pp->text->buf[pp->text->len - 1] == '\n')
+            return 0;
+
+        c = readc(pp);
+
+        if (c == '/') {
+            const int c1 = readc(pp);
+            if (c1 == '/') {
+                line_comment(pp);
                 continue;
             }
             else if (c1 == '*') {
                 const int starty = pp->y;
                 block_comment(pp);
                 if (pp->y == starty)
-                    write_column_comment(pp);
+                    mark_column(pp);
                 continue;
             }
             else {
@@ -1119,7 +2796,7 @@ static void text_lines(struct preprocessor *pp)
             continue;
         }
         else if (c == EOF) {
-            break;
+            return EOF;
         }
         else {
             writec(pp, c);
@@ -1127,26 +2804,645 @@ static void text_lines(struct preprocessor *pp)
     }
 }
 
-int preprocess_file(struct preprocessor *pp, const char *filename)
+static const char *skip_blank_lines(const char *s)
+{
+    /* spaces, new lines and comments */
+    for (;;) {
+        if (isspace(*s)) {
+            s++;
+        }
+        else if (s[0] == '/' && s[1] == '*') {
+            for (s += 2; *s && !(s[0] == '*' && s[1] == '/'); s++)
+                ;
+            if (*s)
+                s += 2;
+        }
+        else if (s[0] == '/' && s[1] == '/') {
+            while (*s && *s != '\n')
+                s++;
+        }
+        else if (s[0] == '\\' && s[1] == '\n') {
+            s += 2;
+        }
+        else {
+            return s;
+        }
+    }
+}
+
+static const char *next_line(const char *s)
+{
+    /* a new line in a comment or after a backslash does not end the line */
+    while (*s) {
+        if (s[0] == '/' && s[1] == '*') {
+            for (s += 2; *s && !(s[0] == '*' && s[1] == '/'); s++)
+                ;
+            if (*s)
+                s += 2;
+        }
+        else if (s[0] == '/' && s[1] == '/') {
+            while (*s && *s != '\n')
+                s++;
+        }
+        else if (s[0] == '\\' && s[1] == '\n') {
+            s += 2;
+        }
+        else if (*s == '"' || *s == '\'') {
+            const int quot = *s++;
+            while (*s && *s != quot && *s != '\n') {
+                if (s[0] == '\\' && s[1])
+                    s++;
+                s++;
+            }
+            if (*s == quot)
+                s++;
+        }
+        else if (*s++ == '\n') {
+            break;
+        }
+    }
+    return s;
+}
+
+/* finds out if the whole file is wrapped in #ifndef GUARD ... #endif,
+ * with nothing but spaces and comments outside */
+static int find_include_guard(const char *src, char *guard, size_t size)
+{
+    const char *s = skip_blank_lines(src);
+    char name[16] = {'\0'};
+    size_t len = 0;
+    int depth = 0;
+
+    s = directive_name(s, name, sizeof(name));
+    if (!s || strcmp(name, "ifndef"))
+        return 0;
+
+    while (is_whitespaces(*s))
+        s++;
+    while (is_macroname(*s) && len < size - 1)
+        guard[len++] = *s++;
+    guard[len] = '\0';
+    if (len == 0)
+        return 0;
+
+    for (s = next_line(s); *s; s = next_line(s)) {
+        if (!directive_name(s, name, sizeof(name)))
+            continue;
+
+        if (!strcmp(name, "if") || !strcmp(name, "ifdef") || !strcmp(name, "ifndef")) {
+            depth++;
+        }
+        else if (!strcmp(name, "else") || !strcmp(name, "elif")) {
+            if (depth == 0)
+                return 0;
+        }
+        else if (!strcmp(name, "endif")) {
+            if (depth == 0)
+                return *skip_blank_lines(next_line(s)) == '\0';
+            depth--;
+        }
+    }
+
+    return 0;
+}
+
+static char *read_file(const char *filename, size_t *len)
 {
     FILE *fp;
+    char *buf;
+    size_t alloc = 1024 * 16;
+    size_t n = 0;
 
     fp = fopen(filename, "r");
     if (!fp)
+        return NULL;
+
+    buf = malloc(alloc);
+    for (;;) {
+        n += fread(buf + n, 1, alloc - n - 1, fp);
+        if (n < alloc - 1)
+            break;
+        alloc *= 2;
+        buf = realloc(buf, alloc);
+    }
+    buf[n] = '\0';
+
+    fclose(fp);
+
+    *len = n;
+    return buf;
+}
+
+static int can_skip_file(struct preprocessor *pp, const struct include_file *inc)
+{
+    if (inc->is_once)
+        return 1;
+    if (inc->guard && lookup_macro(pp->mactab, inc->guard))
+        return 1;
+    return 0;
+}
+
+/* the included file is read next from the beginning */
+static void push_file(struct preprocessor *pp, const char *filename)
+{
+    struct include_file *inc = insert_include_file(pp->includes, filename);
+    struct preprocessor *new_pp;
+    size_t len = 0;
+    char *src;
+
+    /* the whole body would be skipped. no need to open the file */
+    if (can_skip_file(pp, inc))
+        return;
+
+    src = read_file(filename, &len);
+    if (!src)
+        return;
+    add_read_file(pp->includes, inc);
+
+    if (!inc->is_guard_checked) {
+        static char guard[128] = {'\0'};
+        const size_t alloc = sizeof(guard) / sizeof(guard[0]);
+
+        if (find_include_guard(src, guard, alloc)) {
+            inc->guard = malloc(sizeof(char) * alloc);
+            strncpy(inc->guard, guard, alloc);
+        }
+        inc->is_guard_checked = 1;
+    }
+
+    new_pp = malloc(sizeof(struct preprocessor));
+    *new_pp = *pp;
+    new_pp->y = 1;
+    new_pp->x = 0;
+    new_pp->file = inc;
+    new_pp->filename = inc->path;
+    new_pp->src = src;
+    new_pp->next = src;
+    new_pp->end = src + len;
+    new_pp->escaped_newlines = 0;
+    new_pp->pending_newlines = 0;
+    /* conditional groups do not go across files */
+    new_pp->conds = NULL;
+    new_pp->included = NULL;
+    new_pp->error_count = 0;
+
+    switch_record(pp->profile, text_offset(pp), NULL);
+    new_pp->record = add_include_record(pp, inc->path, len);
+    pp->profile->current = new_pp->record;
+
+    pp->included = new_pp;
+    mark_line(new_pp);
+}
+
+/* closes the file included by pp and goes back to pp */
+static void pop_file(struct preprocessor *pp)
+{
+    struct preprocessor *inc_pp = pp->included;
+
+    if (inc_pp->conds)
+        error_(inc_pp, "unterminated conditional directive");
+    while (inc_pp->conds)
+        pop_cond(inc_pp);
+    /* errors add up to the object given to preprocess_file() */
+    pp->error_count += inc_pp->error_count;
+
+    switch_record(pp->profile, text_offset(pp), pp->record);
+
+    free((char *) inc_pp->src);
+    free(inc_pp);
+    pp->included = NULL;
+
+    /* after the #include line */
+    if (pp->file)
+        mark_line(pp);
+}
+
+int preprocess_file(struct preprocessor *pp, const char *filename)
+{
+    push_file(pp, filename);
+    return pp->included ? 0 : 1;
+}
+
+const char *read_text(struct preprocessor *pp)
+{
+    /* the previous chunk has been consumed */
+    pp->text->len = 0;
+    pp->text->buf[0] = '\0';
+    /* time is counted only while in here, not while the text is parsed */
+    mark_profile(pp->profile, text_offset(pp));
+
+    while (pp->included && pp->text->len < PP_CHUNK_SIZE) {
+        struct preprocessor *includer = pp;
+
+        /* the file being read is at the end of the chain */
+        while (includer->included->included)
+            includer = includer->included;
+
+        if (text_lines(includer->included) == EOF)
+            pop_file(includer);
+    }
+
+    switch_record(pp->profile, text_offset(pp), pp->profile->current);
+
+    if (pp->text->len == 0)
+        return NULL;
+
+    add_source_text(pp->srcmap, pp->text->buf, pp->text->len);
+    return pp->text->buf;
+}
+
+/* spaces and dollar signs are special to make */
+static void write_make_path(FILE *fp, const char *path)
+{
+    const char *s;
+
+    for (s = path; *s; s++) {
+        if (*s == ' ')
+            fprintf(fp, "\\ ");
+        else if (*s == '$')
+            fprintf(fp, "$$");
+        else
+            fprintf(fp, "%c", *s);
+    }
+}
+
+void write_dependencies(const struct preprocessor *pp, FILE *fp,
+        const char *target, int skip_system)
+{
+    const struct include_file *inc;
+
+    write_make_path(fp, target);
+    fprintf(fp, ":");
+
+    for (inc = pp->includes->first_read; inc; inc = inc->next_read) {
+        /* the input file is always written */
+        if (skip_system && inc != pp->includes->first_read &&
+            is_system_header(inc->path))
+            continue;
+
+        fprintf(fp, inc == pp->includes->first_read ? " " : " \\\n ");
+        write_make_path(fp, inc->path);
+    }
+    fprintf(fp, "\n");
+}
+
+/* precompiled headers. the state after preprocessing a header from the
+ * beginning is saved: the files read with their guards, the macros, and
+ * the text with its markers. a file including the header before anything
+ * else loads it instead of preprocessing the header again */
+#define PCH_MAGIC "ACCPCH2"
+
+struct pch_reader {
+    const char *p;
+    const char *end;
+    int is_bad;
+};
+
+static void write_int(FILE *fp, int n)
+{
+    fwrite(&n, sizeof(int), 1, fp);
+}
+
+/* with the terminating null so that it can be used in place */
+static void write_string(FILE *fp, const char *s)
+{
+    if (!s) {
+        write_int(fp, -1);
+        return;
+    }
+    write_int(fp, strlen(s) + 1);
+    fwrite(s, sizeof(char), strlen(s) + 1, fp);
+}
+
+static int read_int(struct pch_reader *r)
+{
+    int n = 0;
+
+    if (r->is_bad || r->end - r->p < (int) sizeof(int)) {
+        r->is_bad = 1;
+        return 0;
+    }
+    memcpy(&n, r->p, sizeof(int));
+    r->p += sizeof(int);
+
+    return n;
+}
+
+static const char *read_string(struct pch_reader *r)
+{
+    const int len = read_int(r);
+    const char *s = r->p;
+
+    if (len == -1)
+        return NULL;
+
+    if (r->is_bad || len < 1 || r->end - r->p < len || s[len - 1] != '\0') {
+        r->is_bad = 1;
+        return "";
+    }
+    r->p += len;
+
+    return s;
+}
+
+static int hash_text(const char *s, size_t len)
+{
+    unsigned int h = 0;
+    size_t i;
+
+    for (i = 0; i < len; i++)
+        h = PP_MULTIPLIER * h + (unsigned char) s[i];
+
+    return h;
+}
+
+static void write_file_state(FILE *fp, const struct include_file *inc)
+{
+    size_t len = 0;
+    char *src = read_file(inc->path, &len);
+
+    write_string(fp, inc->path);
+    write_string(fp, inc->guard);
+    write_int(fp, inc->is_guard_checked);
+    write_int(fp, inc->is_once);
+    write_int(fp, inc->is_read);
+
+    /* to find out if the file has changed since */
+    if (src) {
+        write_int(fp, len);
+        write_int(fp, hash_text(src, len));
+        free(src);
+    }
+    else {
+        write_int(fp, -1);
+        write_int(fp, 0);
+    }
+}
+
+static int count_include_files(const struct include_table *table)
+{
+    const struct include_file *inc;
+    int count = 0;
+    int i;
+
+    for (i = 0; i < PP_HASH_SIZE; i++)
+        for (inc = table->entries[i]; inc; inc = inc->next)
+            count++;
+
+    return count;
+}
+
+static int count_macros(const struct macro_table *table)
+{
+    const struct macro_entry *mac;
+    int count = 0;
+    int i;
+
+    for (i = 0; i < PP_HASH_SIZE; i++)
+        for (mac = table->entries[i]; mac; mac = mac->next)
+            count++;
+
+    return count;
+}
+
+static void write_macro(FILE *fp, const struct macro_entry *mac)
+{
+    const struct macro_param *prm;
+
+    write_string(fp, mac->name);
+    write_string(fp, mac->repl);
+    write_int(fp, mac->is_func);
+    write_int(fp, mac->param_count);
+    for (prm = mac->params; prm; prm = prm->next)
+        write_string(fp, prm->name);
+}
+
+int precompile_header(struct preprocessor *pp, const char *filename,
+        const char *pchname)
+{
+    const struct source_map *map = pp->srcmap;
+    const struct include_file *inc;
+    const struct macro_entry *mac;
+    const char *chunk;
+    struct strbuf text;
+    FILE *fp;
+    int i;
+
+    if (preprocess_file(pp, filename))
+        return 1;
+
+    strbuf_init(&text, 0);
+    while ((chunk = read_text(pp)) != NULL)
+        strbuf_append(&text, chunk);
+
+    fp = fopen(pchname, "w");
+    if (!fp) {
+        strbuf_free(&text);
         return 1;
+    }
+
+    write_string(fp, PCH_MAGIC);
+    write_string(fp, filename);
+
+    /* the files read first in the order read */
+    write_int(fp, count_include_files(pp->includes));
+    for (inc = pp->includes->first_read; inc; inc = inc->next_read)
+        write_file_state(fp, inc);
+    for (i = 0; i < PP_HASH_SIZE; i++)
+        for (inc = pp->includes->entries[i]; inc; inc = inc->next)
+            if (!inc->is_read)
+                write_file_state(fp, inc);
 
-    {
-        struct preprocessor new_pp = *pp;
-        new_pp.y = 1;
-        new_pp.x = 0;
-        new_pp.filename = filename;
-        new_pp.fp = fp;
+    write_int(fp, count_macros(pp->mactab));
+    for (i = 0; i < PP_HASH_SIZE; i++)
+        for (mac = pp->mactab->entries[i]; mac; mac = mac->next)
+            write_macro(fp, mac);
+
+    write_string(fp, text.buf);
 
-        write_line_directive(&new_pp);
-        text_lines(&new_pp);
+    write_int(fp, map->line_count);
+    for (i = 0; i < map->line_count; i++) {
+        write_int(fp, map->lines[i].offset);
+        write_int(fp, map->lines[i].line);
+        write_string(fp, map->lines[i].filename);
+    }
+    write_int(fp, map->column_count);
+    for (i = 0; i < map->column_count; i++) {
+        write_int(fp, map->columns[i].offset);
+        write_int(fp, map->columns[i].column);
     }
 
     fclose(fp);
+    strbuf_free(&text);
 
     return 0;
 }
+
+static int is_file_unchanged(const char *path, int len, int hash)
+{
+    size_t n = 0;
+    char *src = read_file(path, &n);
+    int unchanged;
+
+    if (!src)
+        return len == -1;
+
+    unchanged = (len == (int) n && hash == hash_text(src, n));
+    free(src);
+
+    return unchanged;
+}
+
+/* reads the saved state. with apply off, only checks that it can be used */
+static void read_pch(struct preprocessor *pp, struct pch_reader *r, int apply)
+{
+    struct source_map *map = pp->srcmap;
+    const int base = text_offset(pp);
+    const char *text;
+    int count;
+    int i;
+
+    count = read_int(r);
+    for (i = 0; i < count && !r->is_bad; i++) {
+        const char *path = read_string(r);
+        const char *guard = read_string(r);
+        const int is_guard_checked = read_int(r);
+        const int is_once = read_int(r);
+        const int is_read = read_int(r);
+        const int len = read_int(r);
+        const int hash = read_int(r);
+
+        if (!apply) {
+            if (!path || !is_file_unchanged(path, len, hash))
+                r->is_bad = 1;
+            continue;
+        }
+        {
+            struct include_file *inc = insert_include_file(pp->includes, path);
+
+            if (guard) {
+                inc->guard = malloc(sizeof(char) * (strlen(guard) + 1));
+                strcpy(inc->guard, guard);
+            }
+            inc->is_guard_checked = is_guard_checked;
+            inc->is_once = is_once;
+            if (is_read)
+                add_read_file(pp->includes, inc);
+        }
+    }
+
+    count = read_int(r);
+    for (i = 0; i < count && !r->is_bad; i++) {
+        const char *name = read_string(r);
+        const char *repl = read_string(r);
+        const int is_func = read_int(r);
+        const int param_count = read_int(r);
+        struct macro_param head = {0};
+        struct macro_param *tail = &head;
+        struct macro_entry *mac;
+        int j;
+
+        for (j = 0; j < param_count && !r->is_bad; j++) {
+            const char *param = read_string(r);
+
+            if (apply && param) {
+                tail->next = new_param(param);
+                tail = tail->next;
+            }
+        }
+        if (!apply || !name || !repl)
+            continue;
+
+        mac = insert_macro(pp->mactab, name);
+        add_replacement(mac, repl);
+        mac->is_func = is_func;
+        mac->params = head.next;
+        set_body(mac);
+    }
+
+    text = read_string(r);
+    if (apply && text)
+        strbuf_append(pp->text, text);
+
+    count = read_int(r);
+    for (i = 0; i < count && !r->is_bad; i++) {
+        const int offset = read_int(r);
+        const int line = read_int(r);
+        const char *filename = read_string(r);
+
+        if (apply && filename)
+            add_line_marker(map, base + offset, line,
+                    insert_include_file(pp->includes, filename)->path);
+    }
+
+    count = read_int(r);
+    for (i = 0; i < count && !r->is_bad; i++) {
+        const int offset = read_int(r);
+        const int column = read_int(r);
+
+        if (apply)
+            add_column_marker(map, base + offset, column);
+    }
+}
+
+/* a header precompiled for foo.h is in foo.pch */
+static int pch_path(const char *path, char *buf, size_t size)
+{
+    const size_t len = strlen(path);
+
+    if (len < 2 || strcmp(path + len - 2, ".h") || len + 3 > size)
+        return 0;
+
+    memcpy(buf, path, len - 1);
+    strcpy(buf + len - 1, "pch");
+    return 1;
+}
+
+/* returns 1 when the header has been loaded instead of being read */
+static int load_precompiled_header(struct preprocessor *pp, const char *path)
+{
+    static char pchname[256] = {'\0'};
+    struct pch_reader r = {0};
+    const char *magic, *header;
+    size_t len = 0;
+    char *buf;
+
+    /* the saved state is what the header makes from nothing */
+    if (count_macros(pp->mactab) > 0 || count_include_files(pp->includes) > 1)
+        return 0;
+
+    if (!pch_path(path, pchname, sizeof(pchname)))
+        return 0;
+
+    buf = read_file(pchname, &len);
+    if (!buf)
+        return 0;
+
+    r.p = buf;
+    r.end = buf + len;
+    magic = read_string(&r);
+    header = read_string(&r);
+
+    if (!r.is_bad && !strcmp(magic, PCH_MAGIC) && header && !strcmp(header, path)) {
+        const char *start = r.p;
+
+        read_pch(pp, &r, 0);
+
+        if (!r.is_bad) {
+            struct include_profile *prof = pp->profile;
+            struct include_record *rec = add_include_record(pp,
+                    insert_include_file(pp->includes, path)->path, len);
+
+            switch_record(prof, text_offset(pp), rec);
+            r.p = start;
+            read_pch(pp, &r, 1);
+            switch_record(prof, text_offset(pp), pp->record);
+        }
+    }
+    else {
+        r.is_bad = 1;
+    }
+
+    free(buf);
+    return !r.is_bad;
+}
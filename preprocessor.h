@@ -3,6 +3,7 @@
 
 #include <stdio.h>
 
+#define PP_CHUNK_SIZE (1024 * 16)
 #define PP_HASH_SIZE 1237 /* a prime number */
 #define PP_MULTIPLIER 31
 
@@ -12,43 +13,189 @@ struct strbuf {
 	char *buf;
 };
 
+enum pp_token_kind {
+    PPT_IDENT,
+    PPT_NUMBER,
+    PPT_STRING, /* string and character literals */
+    PPT_PUNCT
+};
+
+struct macro_entry;
+
+/* set of macros a token must not be expanded by again (Prosser) */
+struct hideset {
+    struct macro_entry *mac;
+    struct hideset *next;
+};
+
+struct pp_token {
+    int kind;
+    const char *text;
+    int has_space;
+    /* index of parameter in replacement list, otherwise -1 */
+    int param;
+    struct hideset *hideset;
+    struct pp_token *next;
+};
+
+/* an argument of a function-like macro invocation */
+struct macro_arg {
+    struct pp_token *tokens;
+    struct pp_token *expanded;
+    int is_expanded;
+};
+
 struct macro_param {
     char *name;
-    struct strbuf arg;
     struct macro_param *next;
 };
 
+/* counts for a macro name, kept through #undef and redefinitions */
+struct macro_stats {
+    char *name;
+    /* invocations from the text, bytes they expanded to, and the most
+     * macros a token of them went through */
+    int expansion_count;
+    long output_bytes;
+    int max_depth;
+    struct macro_stats *next;
+};
+
 struct macro_entry {
     char *name;
     char *repl;
+    struct pp_token *body;
     int is_func;
+    int param_count;
     struct macro_param *params;
     struct macro_entry *next;
+    struct macro_stats *stats;
 };
 
 struct macro_table {
     struct macro_entry *entries[PP_HASH_SIZE];
+    struct macro_stats *stats[PP_HASH_SIZE];
+};
+
+/* files included in a translation unit, to skip guarded or once-only files
+ * without reading them again */
+struct include_file {
+    char *path;
+    /* macro guarding the whole file with #ifndef, or NULL */
+    char *guard;
+    int is_guard_checked;
+    int is_once;
+    struct include_file *next;
+    /* files in the order they are first read, for dependency output */
+    int is_read;
+    struct include_file *next_read;
 };
 
-#define MAX_HIDESET 32
+/* a file opened while preprocessing, in the order opened. text and time
+ * are counted while the file is the innermost one being read */
+struct include_record {
+    const char *path;
+    int depth;
+    long bytes_read;
+    long bytes_emitted;
+    /* wall time */
+    long microseconds;
+    struct include_record *next;
+};
+
+struct include_profile {
+    struct include_record *first;
+    struct include_record *last;
+    /* the record text and time are charged to, from the marks on */
+    struct include_record *current;
+    long mark_offset;
+    long mark_time;
+};
+
+struct include_table {
+    struct include_file *entries[PP_HASH_SIZE];
+    struct include_file *first_read;
+    struct include_file *last_read;
+};
+
+/* an #if group being read. is_taken is set once one of the parts is taken */
+struct cond_group {
+    int is_taken;
+    struct cond_group *next;
+};
+
+struct source_map;
+struct macro_cache;
+
 struct preprocessor {
-    FILE *fp;
+    /* the whole file in memory. end points to the terminating null */
+    const char *src;
+    const char *next;
+    const char *end;
+    /* backslash-newlines spliced since the last newline */
+    int escaped_newlines;
+    /* newlines given back to be read before the buffer */
+    int pending_newlines;
+
     struct strbuf *text;
     struct macro_table *mactab;
-    const struct macro_entry *hideset[MAX_HIDESET];
+    struct include_table *includes;
+    /* where the text came from */
+    struct source_map *srcmap;
+    /* text of macro invocations expanded so far. names looked up while
+     * is_caching are watched, and expansions that read arguments from
+     * the source are not cached */
+    struct macro_cache *expansions;
+    int is_caching;
+    int has_read_source;
+    struct include_profile *profile;
 
+    /* the file being read */
+    struct include_file *file;
     const char *filename;
     int y;
     int x;
     int prevx;
 
     int skip_depth;
+    struct cond_group *conds;
+    /* NULL for the object given to preprocess_file() */
+    struct include_record *record;
+
+    /* the file opened by #include in this one. files are read from the end
+     * of this chain, starting at the one given to preprocess_file() */
+    struct preprocessor *included;
+    /* errors in this file. those in included files are added when they
+     * are closed */
+    int error_count;
 };
 
 extern struct preprocessor *new_preprocessor(void);
 extern void free_preprocessor(struct preprocessor *pp);
 
+/* opens the file to be read by read_text(). returns 1 if it cannot be read */
 extern int preprocess_file(struct preprocessor *pp, const char *filename);
-extern const char *get_text(const struct preprocessor *pp);
+/* preprocesses the next chunk of lines, which stays valid until the next
+ * call. returns NULL at the end. memory used for the text is a chunk plus
+ * the files on the include stack, however long the output is */
+extern const char *read_text(struct preprocessor *pp);
+extern struct source_map *get_source_map(struct preprocessor *pp);
+/* prints the whole text with line markers */
+extern void print_text(struct preprocessor *pp);
+/* reports on the files read and the macros expanded, in text or JSON */
+extern void print_include_tree(FILE *fp, const struct preprocessor *pp);
+extern void print_preprocessor_stats(FILE *fp, const struct preprocessor *pp);
+extern void print_preprocessor_stats_json(FILE *fp,
+        const struct preprocessor *pp);
+
+/* writes a make rule for target depending on every file read. files in
+ * system include directories are left out with skip_system on */
+extern void write_dependencies(const struct preprocessor *pp, FILE *fp,
+        const char *target, int skip_system);
+
+/* saves the state after preprocessing the header into pchname. the state is
+ * loaded when the header is included first in a file. returns 1 on error */
+extern int precompile_header(struct preprocessor *pp, const char *filename,
+        const char *pchname);
 
 #endif /* _H */
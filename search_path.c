@@ -0,0 +1,262 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "search_path.h"
+
+#define MAX_PATH_LEN 1024
+
+static struct include_dir *dirs = NULL;
+static struct include_dir *dirs_tail = NULL;
+
+/* opening a file can be slow on network file systems. every path is tried
+ * at most once and every lookup is done at most once per process */
+static struct probed_file *probed_files[SEARCH_HASH_SIZE];
+static struct resolved_include *resolved_includes[SEARCH_HASH_SIZE];
+
+static unsigned int hash_string(unsigned int h, const char *s)
+{
+    const unsigned char *p;
+
+    for (p = (const unsigned char *) s; *p != '\0'; p++)
+        h = 31 * h + *p;
+
+    return h;
+}
+
+static char *copy_string(const char *s)
+{
+    const size_t alloc = strlen(s) + 1;
+    char *dst = malloc(sizeof(char) * alloc);
+
+    strncpy(dst, s, alloc);
+    return dst;
+}
+
+void add_include_dir(const char *dir, int is_system)
+{
+    struct include_dir *d = malloc(sizeof(struct include_dir));
+    const size_t len = strlen(dir);
+
+    /* stored with a trailing slash to be joined with file names */
+    d->path = malloc(sizeof(char) * (len + 2));
+    strcpy(d->path, dir);
+    if (len > 0 && dir[len - 1] != '/') {
+        d->path[len] = '/';
+        d->path[len + 1] = '\0';
+    }
+    d->is_system = is_system;
+    d->next = NULL;
+
+    if (dirs_tail)
+        dirs_tail->next = d;
+    else
+        dirs = d;
+    dirs_tail = d;
+}
+
+void normalize_path(char *path)
+{
+    /* nothing is above the root of an absolute path */
+    char *root = path[0] == '/' ? path + 1 : path;
+    char *dst = root;
+    const char *src = root;
+    int depth = 0;
+
+    while (*src != '\0') {
+        const char *seg = src;
+        int len, i;
+
+        while (*src != '\0' && *src != '/')
+            src++;
+        len = src - seg;
+        while (*src == '/')
+            src++;
+
+        if (len == 0 || (len == 1 && seg[0] == '.'))
+            continue;
+
+        if (len == 2 && seg[0] == '.' && seg[1] == '.') {
+            if (depth > 0) {
+                /* drops the last segment kept */
+                while (dst > root && *(dst - 1) != '/')
+                    dst--;
+                if (dst > root)
+                    dst--;
+                depth--;
+                continue;
+            }
+            if (root != path)
+                continue;
+            /* leading ".." of a relative path stays */
+        }
+        else {
+            depth++;
+        }
+
+        if (dst > root)
+            *dst++ = '/';
+        /* dst never goes past src */
+        for (i = 0; i < len; i++)
+            *dst++ = seg[i];
+    }
+    *dst = '\0';
+}
+
+static struct probed_file *probe_file(const char *path)
+{
+    const unsigned int h = hash_string(0, path) % SEARCH_HASH_SIZE;
+    struct probed_file *file;
+    FILE *fp;
+
+    for (file = probed_files[h]; file; file = file->next)
+        if (!strcmp(file->path, path))
+            return file;
+
+    fp = fopen(path, "r");
+    if (fp)
+        fclose(fp);
+
+    file = malloc(sizeof(struct probed_file));
+    file->path = copy_string(path);
+    file->exists = (fp != NULL);
+    file->next = probed_files[h];
+    probed_files[h] = file;
+
+    return file;
+}
+
+static const char *try_dir(const char *dir, const char *name)
+{
+    static char path[MAX_PATH_LEN] = {'\0'};
+    const struct probed_file *file;
+
+    if (strlen(dir) + strlen(name) + 1 > MAX_PATH_LEN)
+        return NULL;
+
+    strcpy(path, dir);
+    strcpy(path + strlen(dir), name);
+    /* the same file is probed and included once however it is named */
+    normalize_path(path);
+
+    file = probe_file(path);
+    return file->exists ? file->path : NULL;
+}
+
+static const char *search_dirs(const char *name, int is_system)
+{
+    const struct include_dir *d;
+    const char *path = NULL;
+
+    for (d = dirs; d && !path; d = d->next)
+        if (d->is_system == is_system)
+            path = try_dir(d->path, name);
+
+    return path;
+}
+
+static void dir_of(const char *filename, char *dir)
+{
+    const char *s, *slash = NULL;
+
+    for (s = filename; *s; s++)
+        if (*s == '/')
+            slash = s;
+
+    if (slash) {
+        const size_t len = slash - filename + 1;
+        memcpy(dir, filename, len);
+        dir[len] = '\0';
+    }
+    else {
+        dir[0] = '\0';
+    }
+}
+
+const char *find_include_file(const char *includer, const char *name,
+        int is_angle)
+{
+    static char dir[MAX_PATH_LEN] = {'\0'};
+    struct resolved_include *r;
+    const char *path = NULL;
+    unsigned int h;
+
+    if (is_angle || !includer || strlen(includer) >= MAX_PATH_LEN)
+        dir[0] = '\0';
+    else
+        dir_of(includer, dir);
+
+    h = hash_string(hash_string(is_angle, dir), name) % SEARCH_HASH_SIZE;
+
+    for (r = resolved_includes[h]; r; r = r->next)
+        if (r->is_angle == is_angle && !strcmp(r->dir, dir) && !strcmp(r->name, name))
+            return r->path;
+
+    if (name[0] == '/') {
+        path = try_dir("", name);
+    }
+    else {
+        if (!is_angle)
+            path = try_dir(dir, name);
+        if (!path)
+            path = search_dirs(name, 0);
+        if (!path)
+            path = search_dirs(name, 1);
+    }
+
+    r = malloc(sizeof(struct resolved_include));
+    r->dir = copy_string(dir);
+    r->name = copy_string(name);
+    r->is_angle = is_angle;
+    r->path = path;
+    r->next = resolved_includes[h];
+    resolved_includes[h] = r;
+
+    return path;
+}
+
+int is_system_header(const char *path)
+{
+    const struct include_dir *d;
+
+    for (d = dirs; d; d = d->next) {
+        const size_t len = strlen(d->path);
+
+        if (d->is_system && strlen(path) > len && !memcmp(path, d->path, len))
+            return 1;
+    }
+
+    return 0;
+}
+
+void free_include_dirs(void)
+{
+    struct include_dir *d = dirs, *d_next;
+    int i;
+
+    for (; d; d = d_next) {
+        d_next = d->next;
+        free(d->path);
+        free(d);
+    }
+    dirs = NULL;
+    dirs_tail = NULL;
+
+    for (i = 0; i < SEARCH_HASH_SIZE; i++) {
+        struct probed_file *file = probed_files[i], *file_next;
+        struct resolved_include *r = resolved_includes[i], *r_next;
+
+        for (; file; file = file_next) {
+            file_next = file->next;
+            free(file->path);
+            free(file);
+        }
+        for (; r; r = r_next) {
+            r_next = r->next;
+            free(r->dir);
+            free(r->name);
+            free(r);
+        }
+        probed_files[i] = NULL;
+        resolved_includes[i] = NULL;
+    }
+}
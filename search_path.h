@@ -0,0 +1,48 @@
+#ifndef SEARCH_PATH_H
+#define SEARCH_PATH_H
+
+#define SEARCH_HASH_SIZE 1237 /* a prime number */
+
+struct include_dir {
+    char *path;
+    int is_system;
+    struct include_dir *next;
+};
+
+/* a file path that has been tried once */
+struct probed_file {
+    char *path;
+    int exists;
+    struct probed_file *next;
+};
+
+/* the result of an #include lookup */
+struct resolved_include {
+    /* directory of the including file. empty for <...> */
+    char *dir;
+    char *name;
+    int is_angle;
+    /* NULL when not found */
+    const char *path;
+    struct resolved_include *next;
+};
+
+/* directories are searched in the order added, -I ones before -isystem */
+extern void add_include_dir(const char *dir, int is_system);
+
+/* returns the path to open, or NULL when not found. "..." names are looked
+ * for in the directory of the including file first. the results live until
+ * free_include_dirs() so that they are shared by translation units */
+extern const char *find_include_file(const char *includer, const char *name,
+        int is_angle);
+
+/* collapses "." and ".." segments and repeated slashes in place, so that
+ * a file has one path however it is spelled. "a/./b//../c" is "a/c" */
+extern void normalize_path(char *path);
+
+/* returns 1 if path is in one of the -isystem directories */
+extern int is_system_header(const char *path);
+
+extern void free_include_dirs(void);
+
+#endif /* _H */
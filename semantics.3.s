@@ -0,0 +1,4180 @@
+    .data
+
+_type_name1_1025:
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+
+_type_name2_1026:
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+
+    .text
+
+_L_str_985:
+    .asciz "unused variable '%s'"
+
+_L_str_990:
+    .asciz "unused function '%s'"
+
+_L_str_993:
+    .asciz "duplicate case value '%d'"
+
+_L_str_996:
+    .asciz "multiple default labels in one switch"
+
+_L_str_999:
+    .asciz "unused label '%s'"
+
+_L_str_1038:
+    .asciz "incompatible pointer types initializing '%s' with an expression of type '%s'"
+
+_L_str_1039:
+    .asciz "initializing '%s' with an expression of incompatible type '%s'"
+
+_L_str_1055:
+    .asciz "excess elements in array initializer"
+
+_L_str_1076:
+    .asciz "excess elements in %s initializer"
+
+_L_str_1077:
+    .asciz "union"
+
+_L_str_1078:
+    .asciz "struct"
+
+_L_str_1126:
+    .asciz "variable has incomplete type '%s'"
+
+_L_str_1129:
+    .asciz "redefinition of label '%s'"
+
+_L_str_1132:
+    .asciz "redefinition of '%s'"
+
+_L_str_1136:
+    .asciz "read-only variable is not assignable"
+
+_L_str_1139:
+    .asciz "cannot assign to variable '%s' with const-qualified"
+
+_L_str_1144:
+    .asciz "incompatible pointer types assigning to '%s' from '%s'"
+
+_L_str_1145:
+    .asciz "assigning to '%s' from incompatible type '%s'"
+
+_L_str_1151:
+    .asciz "variable '%s' is uninitialized when used here"
+
+_L_str_1152:
+    .asciz "use of undeclared identifier '%s'"
+
+_L_str_1155:
+    .asciz "implicit declaration of function '%s'"
+
+_L_str_1158:
+    .asciz "expression is not assignable"
+
+_L_str_1161:
+    .asciz "use of undeclared label '%s'"
+
+_L_str_1166:
+    .asciz "member reference base type '%.32s' is not a structure or union"
+
+_L_str_1169:
+    .asciz "incomplete definition of type '%.32s'"
+
+_L_str_1172:
+    .asciz "no member named '%.32s' in '%.32s'"
+
+_L_str_1178:
+    .asciz "indirection requires pointer operand"
+
+_L_str_1189:
+    .asciz "too few arguments to function call"
+
+_L_str_1194:
+    .asciz "too many arguments to function call"
+
+_L_str_1199:
+    .asciz "passing '%s' to parameter of incompatible type '%s'"
+
+_L_str_1203:
+    .asciz "'break' statement not in loop or switch statement"
+
+_L_str_1205:
+    .asciz "'continue' statement not in loop statement"
+
+_L_str_1212:
+    .asciz "void function '%s' should not return a value"
+
+_L_str_1215:
+    .asciz "returning '%s' from a function with incompatible result type '%s'"
+
+_L_str_1219:
+    .asciz "non-void function '%s' should return a value"
+
+_is_orig_used:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## if-cond
+    movq  -8(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB1_3
+## if-then
+    movl  $0, %eax
+    jmp   _LBB0_0
+    jmp   _LBB1_2
+## if-else
+_LBB1_3:
+_LBB1_2:
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _has_origin
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB2_3
+## if-then
+    movq  -8(%rbp), %rax
+    addq  $56, %rax
+    movq  (%rax), %rax
+    addq  $86, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    jmp   _LBB0_0
+    jmp   _LBB2_2
+## if-else
+_LBB2_3:
+_LBB2_2:
+    movq  -8(%rbp), %rax
+    addq  $86, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    jmp   _LBB0_0
+_LBB0_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_is_orig_initialized:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## if-cond
+    movq  -8(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB4_3
+## if-then
+    movl  $0, %eax
+    jmp   _LBB3_0
+    jmp   _LBB4_2
+## if-else
+_LBB4_3:
+_LBB4_2:
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _has_origin
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB5_3
+## if-then
+    movq  -8(%rbp), %rax
+    addq  $56, %rax
+    movq  (%rax), %rax
+    addq  $84, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    jmp   _LBB3_0
+    jmp   _LBB5_2
+## if-else
+_LBB5_3:
+_LBB5_2:
+    movq  -8(%rbp), %rax
+    addq  $84, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    jmp   _LBB3_0
+_LBB3_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_check_symbol_usage:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## for-pre
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-cond
+_LBB7_1:
+    movq  -24(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB7_2
+## for-body
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_local_var
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB8_3
+## if-then
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_struct_or_union
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB9_3
+## if-then
+    jmp   _LBB7_4
+    jmp   _LBB9_2
+## if-else
+_LBB9_3:
+_LBB9_2:
+## if-cond
+    movq  -24(%rbp), %rax
+    addq  $82, %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    movl  $0, %eax
+    je    _LBB12_2
+    movq  -24(%rbp), %rax
+    addq  $86, %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB12_2
+    movl  $1, %eax
+_LBB12_2:
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB11_2
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_origin
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB11_2
+    movl  $1, %eax
+_LBB11_2:
+    cmpl  $0, %eax
+    je    _LBB10_3
+## if-then
+    subq  $32, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -24(%rbp), %rax
+    addq  $32, %rax
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_985(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movq  (%rsp), %rcx
+    movb  $0, %al
+    callq _add_warning
+    addq  $32, %rsp
+    jmp   _LBB10_2
+## if-else
+_LBB10_3:
+_LBB10_2:
+    jmp   _LBB8_2
+## if-else
+_LBB8_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_global_var
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB13_3
+## if-then
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_static
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB15_2
+    movq  -24(%rbp), %rax
+    addq  $86, %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB15_2
+    movl  $1, %eax
+_LBB15_2:
+    cmpl  $0, %eax
+    je    _LBB14_3
+## if-then
+    subq  $32, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -24(%rbp), %rax
+    addq  $32, %rax
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_985(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movq  (%rsp), %rcx
+    movb  $0, %al
+    callq _add_warning
+    addq  $32, %rsp
+    jmp   _LBB14_2
+## if-else
+_LBB14_3:
+_LBB14_2:
+    jmp   _LBB13_2
+## if-else
+_LBB13_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_func
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB16_3
+## if-then
+## if-cond
+    movq  -24(%rbp), %rax
+    addq  $82, %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    movl  $0, %eax
+    je    _LBB19_2
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_orig_used
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB19_2
+    movl  $1, %eax
+_LBB19_2:
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB18_2
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_static
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB18_2
+    movl  $1, %eax
+_LBB18_2:
+    cmpl  $0, %eax
+    je    _LBB17_3
+## if-then
+    subq  $32, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -24(%rbp), %rax
+    addq  $32, %rax
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_990(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movq  (%rsp), %rcx
+    movb  $0, %al
+    callq _add_warning
+    addq  $32, %rsp
+    jmp   _LBB17_2
+## if-else
+_LBB17_3:
+_LBB17_2:
+    jmp   _LBB16_2
+## if-else
+_LBB16_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_case
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB20_3
+## if-then
+## if-cond
+    movq  -24(%rbp), %rax
+    addq  $83, %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    je    _LBB21_3
+## if-then
+    subq  $32, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -24(%rbp), %rax
+    addq  $32, %rax
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_993(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    addq  $28, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movl  (%rsp), %ecx
+    movb  $0, %al
+    callq _add_error
+    addq  $32, %rsp
+    jmp   _LBB21_2
+## if-else
+_LBB21_3:
+_LBB21_2:
+    jmp   _LBB20_2
+## if-else
+_LBB20_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_default
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB22_3
+## if-then
+## if-cond
+    movq  -24(%rbp), %rax
+    addq  $83, %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    je    _LBB23_3
+## if-then
+    subq  $32, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -24(%rbp), %rax
+    addq  $32, %rax
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_996(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _add_error
+    addq  $32, %rsp
+    jmp   _LBB23_2
+## if-else
+_LBB23_3:
+_LBB23_2:
+    jmp   _LBB22_2
+## if-else
+_LBB22_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_label
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB24_3
+## if-then
+## if-cond
+    movq  -24(%rbp), %rax
+    addq  $82, %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    movl  $0, %eax
+    je    _LBB26_2
+    movq  -24(%rbp), %rax
+    addq  $86, %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB26_2
+    movl  $1, %eax
+_LBB26_2:
+    cmpl  $0, %eax
+    je    _LBB25_3
+## if-then
+    subq  $32, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -24(%rbp), %rax
+    addq  $32, %rax
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_999(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movq  (%rsp), %rcx
+    movb  $0, %al
+    callq _add_warning
+    addq  $32, %rsp
+    jmp   _LBB25_2
+## if-else
+_LBB25_3:
+_LBB25_2:
+    jmp   _LBB24_2
+## if-else
+_LBB24_3:
+_LBB24_2:
+_LBB22_2:
+_LBB20_2:
+_LBB16_2:
+_LBB13_2:
+_LBB8_2:
+## for-post
+_LBB7_4:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    addq  $40, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB7_1
+_LBB7_2:
+    movl  $0, %eax
+    jmp   _LBB6_0
+_LBB6_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_is_integer_zero:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_integer
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB30_2
+    movq  -8(%rbp), %rax
+    addq  $28, %rax
+    movb  (%rax), %al
+    movzbl %al, %eax
+    pushq %rax
+    movl  $65, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB30_2
+    movl  $1, %eax
+_LBB30_2:
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB29_2
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_ival
+    addq  $16, %rsp
+    pushq %rax
+    movl  $0, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB29_2
+    movl  $1, %eax
+_LBB29_2:
+    cmpl  $0, %eax
+    je    _LBB28_3
+## if-then
+    movl  $1, %eax
+    jmp   _LBB27_0
+    jmp   _LBB28_2
+## if-else
+_LBB28_3:
+_LBB28_2:
+    movl  $0, %eax
+    jmp   _LBB27_0
+_LBB27_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_check_init_scalar:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## if-cond
+    movq  -8(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB32_3
+## if-then
+    jmp   _LBB31_0
+    jmp   _LBB32_2
+## if-else
+_LBB32_3:
+_LBB32_2:
+## switch-value
+    movq  -8(%rbp), %rax
+    addq  $28, %rax
+    movb  (%rax), %al
+    movzbl %al, %eax
+## begin jump table
+    cmpl  $71, %eax
+    je    _LBB33_1136
+    jmp   _LBB33_1141
+    jmp   _LBB33_2
+## end jump table
+_LBB33_1136:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _node_l
+    addq  $8, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _node_r
+    addq  $8, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_pointer
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB35_2
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_integer_zero
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB35_2
+    movl  $1, %eax
+_LBB35_2:
+    cmpl  $0, %eax
+    je    _LBB34_3
+## if-then
+    jmp   _LBB31_0
+    jmp   _LBB34_2
+## if-else
+_LBB34_3:
+_LBB34_2:
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -32(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _is_compatible
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB36_3
+## if-then
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _type_name1_1025(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _make_type_name
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -32(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _type_name2_1026(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _make_type_name
+    addq  $16, %rsp
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_pointer
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB37_3
+## if-then
+    subq  $48, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 40(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_pos
+    addq  $16, %rsp
+    movq  %rax, 32(%rsp)
+    leaq  _L_str_1038(%rip), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _type_name1_1025(%rip), %rax
+    movq  %rax, 16(%rsp)
+    leaq  _type_name2_1026(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  40(%rsp), %rdi
+    movq  32(%rsp), %rsi
+    movq  24(%rsp), %rdx
+    movq  16(%rsp), %rcx
+    movq  8(%rsp), %r8
+    movb  $0, %al
+    callq _add_error
+    addq  $48, %rsp
+    jmp   _LBB37_2
+## if-else
+_LBB37_3:
+    subq  $48, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 40(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_pos
+    addq  $16, %rsp
+    movq  %rax, 32(%rsp)
+    leaq  _L_str_1039(%rip), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _type_name1_1025(%rip), %rax
+    movq  %rax, 16(%rsp)
+    leaq  _type_name2_1026(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  40(%rsp), %rdi
+    movq  32(%rsp), %rsi
+    movq  24(%rsp), %rdx
+    movq  16(%rsp), %rcx
+    movq  8(%rsp), %r8
+    movb  $0, %al
+    callq _add_error
+    addq  $48, %rsp
+_LBB37_2:
+    jmp   _LBB36_2
+## if-else
+_LBB36_3:
+_LBB36_2:
+    jmp   _LBB33_2
+_LBB33_1141:
+    jmp   _LBB33_2
+_LBB33_2:
+_LBB31_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_check_init_array_element:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $576, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## if-cond
+    movq  -8(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB39_3
+## if-then
+    jmp   _LBB38_0
+    jmp   _LBB39_2
+## if-else
+_LBB39_3:
+_LBB39_2:
+## switch-value
+    movq  -8(%rbp), %rax
+    addq  $28, %rax
+    movb  (%rax), %al
+    movzbl %al, %eax
+## begin jump table
+    cmpl  $71, %eax
+    je    _LBB40_1153
+    cmpl  $1, %eax
+    je    _LBB40_1157
+    jmp   _LBB40_1162
+    jmp   _LBB40_2
+## end jump table
+_LBB40_1153:
+## if-cond
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_void
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB41_3
+## if-then
+    subq  $32, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_pos
+    addq  $16, %rsp
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_1055(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _add_error
+    addq  $32, %rsp
+    jmp   _LBB40_2
+    jmp   _LBB41_2
+## if-else
+_LBB41_3:
+_LBB41_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _check_initializer
+    addq  $16, %rsp
+    jmp   _LBB40_2
+_LBB40_1157:
+    subq  $16, %rsp
+    leaq  -560(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _begin_ast_walk
+    addq  $16, %rsp
+## while-cond
+_LBB42_4:
+## assign
+    leaq  -568(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    leaq  -560(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _next_ast_list_item
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB42_2
+## while-body
+    subq  $16, %rsp
+    movq  -568(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _check_init_array_element
+    addq  $16, %rsp
+    jmp   _LBB42_4
+_LBB42_2:
+    subq  $16, %rsp
+    leaq  -560(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _end_ast_walk
+    addq  $16, %rsp
+    jmp   _LBB40_2
+_LBB40_1162:
+    jmp   _LBB40_2
+_LBB40_2:
+_LBB38_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_check_init_struct_members:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $576, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## if-cond
+    movq  -8(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB44_3
+## if-then
+    jmp   _LBB43_0
+    jmp   _LBB44_2
+## if-else
+_LBB44_3:
+_LBB44_2:
+## switch-value
+    movq  -8(%rbp), %rax
+    addq  $28, %rax
+    movb  (%rax), %al
+    movzbl %al, %eax
+## begin jump table
+    cmpl  $71, %eax
+    je    _LBB45_1174
+    cmpl  $1, %eax
+    je    _LBB45_1180
+    jmp   _LBB45_1185
+    jmp   _LBB45_2
+## end jump table
+_LBB45_1174:
+## if-cond
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_void
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB46_3
+## if-then
+    subq  $32, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_pos
+    addq  $16, %rsp
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_1076(%rip), %rax
+    movq  %rax, 8(%rsp)
+## cond-?
+    movq  -16(%rbp), %rax
+    addq  $36, %rax
+    movl  (%rax), %eax
+    cmpq  $0, %rax
+    je    _LBB47_3
+## cond-then
+    leaq  _L_str_1077(%rip), %rax
+    jmp   _LBB47_2
+## cond-else
+_LBB47_3:
+    leaq  _L_str_1078(%rip), %rax
+_LBB47_2:
+    movq  %rax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movq  (%rsp), %rcx
+    movb  $0, %al
+    callq _add_error
+    addq  $32, %rsp
+    jmp   _LBB45_2
+    jmp   _LBB46_2
+## if-else
+_LBB46_3:
+_LBB46_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _check_initializer
+    addq  $16, %rsp
+    jmp   _LBB45_2
+_LBB45_1180:
+    subq  $16, %rsp
+    leaq  -560(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _begin_ast_walk
+    addq  $16, %rsp
+## while-cond
+_LBB48_4:
+## assign
+    leaq  -568(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    leaq  -560(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _next_ast_list_item
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB48_2
+## while-body
+    subq  $16, %rsp
+    movq  -568(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _check_init_struct_members
+    addq  $16, %rsp
+    jmp   _LBB48_4
+_LBB48_2:
+    subq  $16, %rsp
+    leaq  -560(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _end_ast_walk
+    addq  $16, %rsp
+    jmp   _LBB45_2
+_LBB45_1185:
+    jmp   _LBB45_2
+_LBB45_2:
+_LBB43_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_check_initializer:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $112, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+## cond-?
+    movq  -8(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB50_3
+## cond-then
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _node_l
+    addq  $8, %rsp
+    jmp   _LBB50_2
+## cond-else
+_LBB50_3:
+    movl  $0, %eax
+_LBB50_2:
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+## cond-?
+    movq  -8(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB51_3
+## cond-then
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _node_r
+    addq  $8, %rsp
+    jmp   _LBB51_2
+## cond-else
+_LBB51_3:
+    movl  $0, %eax
+_LBB51_2:
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -24(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB53_2
+    movq  -32(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB53_2
+    movl  $0, %eax
+_LBB53_2:
+    cmpl  $0, %eax
+    je    _LBB52_3
+## if-then
+    jmp   _LBB49_0
+    jmp   _LBB52_2
+## if-else
+_LBB52_3:
+_LBB52_2:
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_array
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB54_3
+## if-then
+## local scalar init
+    leaq  -72(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    movq  16(%rax), %r10
+    movq  %r10, 16(%rdx)
+    movq  24(%rax), %r10
+    movq  %r10, 24(%rdx)
+    movq  32(%rax), %r10
+    movq  %r10, 32(%rdx)
+    subq  $16, %rsp
+    movq  -32(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  -72(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _check_init_array_element
+    addq  $16, %rsp
+    jmp   _LBB54_2
+## if-else
+_LBB54_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_struct_or_union
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB55_3
+## if-then
+## if-cond
+    movq  -32(%rbp), %rax
+    addq  $28, %rax
+    movb  (%rax), %al
+    movzbl %al, %eax
+    pushq %rax
+    movl  $71, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB57_2
+    movq  -32(%rbp), %rax
+    addq  $28, %rax
+    movb  (%rax), %al
+    movzbl %al, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB57_2
+    movl  $0, %eax
+_LBB57_2:
+    cmpl  $0, %eax
+    je    _LBB56_3
+## if-then
+## local scalar init
+    leaq  -112(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    movq  16(%rax), %r10
+    movq  %r10, 16(%rdx)
+    movq  24(%rax), %r10
+    movq  %r10, 24(%rdx)
+    movq  32(%rax), %r10
+    movq  %r10, 32(%rdx)
+## assign
+    leaq  -112(%rbp), %rax
+    addq  $36, %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _is_union
+    addq  $8, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  -32(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  -112(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _check_init_struct_members
+    addq  $16, %rsp
+    jmp   _LBB56_2
+## if-else
+_LBB56_3:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _check_init_scalar
+    addq  $16, %rsp
+_LBB56_2:
+    jmp   _LBB55_2
+## if-else
+_LBB55_3:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _check_init_scalar
+    addq  $16, %rsp
+_LBB55_2:
+_LBB54_2:
+_LBB49_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_check_tree_:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $624, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## if-cond
+    movq  -8(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB59_3
+## if-then
+    jmp   _LBB58_0
+    jmp   _LBB59_2
+## if-else
+_LBB59_3:
+_LBB59_2:
+## switch-value
+    movq  -8(%rbp), %rax
+    addq  $28, %rax
+    movb  (%rax), %al
+    movzbl %al, %eax
+## begin jump table
+    cmpl  $1, %eax
+    je    _LBB60_1218
+    cmpl  $2, %eax
+    je    _LBB60_1219
+    cmpl  $70, %eax
+    je    _LBB60_1224
+    cmpl  $18, %eax
+    je    _LBB60_1234
+    cmpl  $64, %eax
+    je    _LBB60_1247
+    cmpl  $29, %eax
+    je    _LBB60_1264
+    cmpl  $32, %eax
+    je    _LBB60_1274
+    cmpl  $13, %eax
+    je    _LBB60_1279
+    cmpl  $16, %eax
+    je    _LBB60_1280
+    cmpl  $17, %eax
+    je    _LBB60_1281
+    cmpl  $9, %eax
+    je    _LBB60_1282
+    cmpl  $33, %eax
+    je    _LBB60_1283
+    cmpl  $34, %eax
+    je    _LBB60_1284
+    cmpl  $35, %eax
+    je    _LBB60_1292
+    cmpl  $3, %eax
+    je    _LBB60_1302
+    cmpl  $4, %eax
+    je    _LBB60_1304
+    cmpl  $5, %eax
+    je    _LBB60_1306
+    jmp   _LBB60_1322
+    jmp   _LBB60_2
+## end jump table
+_LBB60_1218:
+_LBB60_1219:
+    subq  $16, %rsp
+    leaq  -560(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _begin_ast_walk
+    addq  $16, %rsp
+## while-cond
+_LBB61_4:
+## assign
+    leaq  -568(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    leaq  -560(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _next_ast_list_item
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB61_2
+## while-body
+    subq  $16, %rsp
+    movq  -568(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _check_tree_
+    addq  $16, %rsp
+    jmp   _LBB61_4
+_LBB61_2:
+    subq  $16, %rsp
+    leaq  -560(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _end_ast_walk
+    addq  $16, %rsp
+    jmp   _LBB58_0
+_LBB60_1224:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $84, %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _node_l
+    addq  $8, %rsp
+    cmpq  $0, %rax
+    movl  $1, %eax
+    jne   _LBB62_2
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _is_global_var
+    addq  $8, %rsp
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB62_2
+    movl  $0, %eax
+_LBB62_2:
+    popq  %rdx
+    movb  %al, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_function
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB63_3
+## if-then
+## assign
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB63_2
+## if-else
+_LBB63_3:
+_LBB63_2:
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_incomplete
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB65_2
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_local_var
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB66_2
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_global_var
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB66_2
+    movl  $0, %eax
+_LBB66_2:
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB65_2
+    movl  $1, %eax
+_LBB65_2:
+    cmpl  $0, %eax
+    je    _LBB64_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _type_name1_1025(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _make_type_name
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_pos
+    addq  $16, %rsp
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_1126(%rip), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _type_name1_1025(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movq  (%rsp), %rcx
+    movb  $0, %al
+    callq _add_error
+    addq  $32, %rsp
+    jmp   _LBB58_0
+    jmp   _LBB64_2
+## if-else
+_LBB64_3:
+_LBB64_2:
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_label
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB67_3
+## if-then
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $83, %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    je    _LBB68_3
+## if-then
+    subq  $32, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_pos
+    addq  $16, %rsp
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_1129(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movq  (%rsp), %rcx
+    movb  $0, %al
+    callq _add_error
+    addq  $32, %rsp
+    jmp   _LBB68_2
+## if-else
+_LBB68_3:
+_LBB68_2:
+    jmp   _LBB67_2
+## if-else
+_LBB67_3:
+_LBB67_2:
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_local_var
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB69_3
+## if-then
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $83, %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    je    _LBB70_3
+## if-then
+    subq  $32, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_pos
+    addq  $16, %rsp
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_1132(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movq  (%rsp), %rcx
+    movb  $0, %al
+    callq _add_error
+    addq  $32, %rsp
+    jmp   _LBB70_2
+## if-else
+_LBB70_3:
+_LBB70_2:
+    jmp   _LBB69_2
+## if-else
+_LBB69_3:
+_LBB69_2:
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    cmpq  $0, %rax
+    je    _LBB71_3
+## if-then
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _check_initializer
+    addq  $16, %rsp
+    jmp   _LBB71_2
+## if-else
+_LBB71_3:
+_LBB71_2:
+    jmp   _LBB60_2
+_LBB60_1234:
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _check_tree_
+    addq  $16, %rsp
+## assign
+    movq  -16(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _check_tree_
+    addq  $16, %rsp
+## assign
+    movq  -16(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    addq  $28, %rax
+    movb  (%rax), %al
+    movzbl %al, %eax
+    pushq %rax
+    movl  $32, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB72_3
+## if-then
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_const
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB73_3
+## if-then
+    subq  $32, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_pos
+    addq  $16, %rsp
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_1136(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _add_error
+    addq  $32, %rsp
+    jmp   _LBB73_2
+## if-else
+_LBB73_3:
+_LBB73_2:
+    jmp   _LBB72_2
+## if-else
+_LBB72_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    addq  $28, %rax
+    movb  (%rax), %al
+    movzbl %al, %eax
+    pushq %rax
+    movl  $64, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB74_3
+## if-then
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_const
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB75_3
+## if-then
+    subq  $32, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_pos
+    addq  $16, %rsp
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_1139(%rip), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movq  (%rsp), %rcx
+    movb  $0, %al
+    callq _add_error
+    addq  $32, %rsp
+    jmp   _LBB75_2
+## if-else
+_LBB75_3:
+_LBB75_2:
+    jmp   _LBB74_2
+## if-else
+_LBB74_3:
+_LBB74_2:
+_LBB72_2:
+## if-cond
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_pointer
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB77_2
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_integer_zero
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB77_2
+    movl  $1, %eax
+_LBB77_2:
+    cmpl  $0, %eax
+    je    _LBB76_3
+## if-then
+    jmp   _LBB58_0
+    jmp   _LBB76_2
+## if-else
+_LBB76_3:
+_LBB76_2:
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    cmpq  $0, %rax
+    movl  $0, %eax
+    je    _LBB80_2
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    cmpq  $0, %rax
+    movl  $0, %eax
+    je    _LBB80_2
+    movl  $1, %eax
+_LBB80_2:
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB79_2
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _is_compatible
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB79_2
+    movl  $1, %eax
+_LBB79_2:
+    cmpl  $0, %eax
+    je    _LBB78_3
+## if-then
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _type_name1_1025(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _make_type_name
+    addq  $16, %rsp
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _type_name2_1026(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _make_type_name
+    addq  $16, %rsp
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_pointer
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB81_3
+## if-then
+    subq  $48, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 40(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_pos
+    addq  $16, %rsp
+    movq  %rax, 32(%rsp)
+    leaq  _L_str_1144(%rip), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _type_name1_1025(%rip), %rax
+    movq  %rax, 16(%rsp)
+    leaq  _type_name2_1026(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  40(%rsp), %rdi
+    movq  32(%rsp), %rsi
+    movq  24(%rsp), %rdx
+    movq  16(%rsp), %rcx
+    movq  8(%rsp), %r8
+    movb  $0, %al
+    callq _add_error
+    addq  $48, %rsp
+    jmp   _LBB81_2
+## if-else
+_LBB81_3:
+    subq  $48, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 40(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_pos
+    addq  $16, %rsp
+    movq  %rax, 32(%rsp)
+    leaq  _L_str_1145(%rip), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _type_name1_1025(%rip), %rax
+    movq  %rax, 16(%rsp)
+    leaq  _type_name2_1026(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  40(%rsp), %rdi
+    movq  32(%rsp), %rsi
+    movq  24(%rsp), %rdx
+    movq  16(%rsp), %rcx
+    movq  8(%rsp), %r8
+    movb  $0, %al
+    callq _add_error
+    addq  $48, %rsp
+_LBB81_2:
+    jmp   _LBB78_2
+## if-else
+_LBB78_3:
+_LBB78_2:
+    jmp   _LBB58_0
+_LBB60_1247:
+## if-cond
+    movq  -16(%rbp), %rax
+    addq  $32, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB83_2
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $86, %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB83_2
+    movl  $1, %eax
+_LBB83_2:
+    cmpl  $0, %eax
+    je    _LBB82_3
+## if-then
+## assign
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $84, %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+    jmp   _LBB82_2
+## if-else
+_LBB82_3:
+_LBB82_2:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $85, %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $32, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $86, %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $56, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    je    _LBB84_3
+## if-then
+## assign
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $56, %rax
+    movq  (%rax), %rax
+    addq  $86, %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+    jmp   _LBB84_2
+## if-else
+_LBB84_3:
+_LBB84_2:
+## local scalar init
+    leaq  -576(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -576(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_local_var
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB86_2
+    subq  $16, %rsp
+    movq  -576(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_global_var
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB86_2
+    movl  $0, %eax
+_LBB86_2:
+    cmpl  $0, %eax
+    je    _LBB85_3
+## if-then
+## if-cond
+    movq  -576(%rbp), %rax
+    addq  $82, %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    movl  $0, %eax
+    je    _LBB89_2
+    movq  -576(%rbp), %rax
+    addq  $86, %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    movl  $0, %eax
+    je    _LBB89_2
+    movl  $1, %eax
+_LBB89_2:
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB88_2
+    subq  $16, %rsp
+    movq  -576(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_orig_initialized
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB88_2
+    movl  $1, %eax
+_LBB88_2:
+    cmpl  $0, %eax
+    je    _LBB87_3
+## if-then
+## if-cond
+    subq  $16, %rsp
+    movq  -576(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_array
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB91_2
+    subq  $16, %rsp
+    movq  -576(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_struct_or_union
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB91_2
+    movl  $1, %eax
+_LBB91_2:
+    cmpl  $0, %eax
+    je    _LBB90_3
+## if-then
+    subq  $32, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_pos
+    addq  $16, %rsp
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_1151(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -576(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movq  (%rsp), %rcx
+    movb  $0, %al
+    callq _add_warning
+    addq  $32, %rsp
+    jmp   _LBB90_2
+## if-else
+_LBB90_3:
+_LBB90_2:
+    jmp   _LBB87_2
+## if-else
+_LBB87_3:
+_LBB87_2:
+## if-cond
+    movq  -576(%rbp), %rax
+    addq  $82, %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB93_2
+    movq  -576(%rbp), %rax
+    addq  $86, %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    movl  $0, %eax
+    je    _LBB93_2
+    movl  $1, %eax
+_LBB93_2:
+    cmpl  $0, %eax
+    je    _LBB92_3
+## if-then
+    subq  $32, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_pos
+    addq  $16, %rsp
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_1152(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -576(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movq  (%rsp), %rcx
+    movb  $0, %al
+    callq _add_error
+    addq  $32, %rsp
+    jmp   _LBB92_2
+## if-else
+_LBB92_3:
+_LBB92_2:
+    jmp   _LBB85_2
+## if-else
+_LBB85_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -576(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_func
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB94_3
+## if-then
+## if-cond
+    movq  -576(%rbp), %rax
+    addq  $82, %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB98_2
+    movq  -576(%rbp), %rax
+    addq  $86, %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    movl  $0, %eax
+    je    _LBB98_2
+    movl  $1, %eax
+_LBB98_2:
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB97_2
+    subq  $16, %rsp
+    movq  -576(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_extern
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB97_2
+    movl  $1, %eax
+_LBB97_2:
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB96_2
+    subq  $16, %rsp
+    movq  -576(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_static
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB96_2
+    movl  $1, %eax
+_LBB96_2:
+    cmpl  $0, %eax
+    je    _LBB95_3
+## if-then
+    subq  $32, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_pos
+    addq  $16, %rsp
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_1155(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -576(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movq  (%rsp), %rcx
+    movb  $0, %al
+    callq _add_warning
+    addq  $32, %rsp
+    jmp   _LBB95_2
+## if-else
+_LBB95_3:
+_LBB95_2:
+    jmp   _LBB94_2
+## if-else
+_LBB94_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -576(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_enumerator
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB99_3
+## if-then
+## if-cond
+    movq  -576(%rbp), %rax
+    addq  $85, %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    je    _LBB100_3
+## if-then
+    subq  $32, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_pos
+    addq  $16, %rsp
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_1158(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _add_error
+    addq  $32, %rsp
+    jmp   _LBB100_2
+## if-else
+_LBB100_3:
+_LBB100_2:
+    jmp   _LBB99_2
+## if-else
+_LBB99_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -576(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_label
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB101_3
+## if-then
+## if-cond
+    movq  -576(%rbp), %rax
+    addq  $82, %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB103_2
+    movq  -576(%rbp), %rax
+    addq  $86, %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    movl  $0, %eax
+    je    _LBB103_2
+    movl  $1, %eax
+_LBB103_2:
+    cmpl  $0, %eax
+    je    _LBB102_3
+## if-then
+    subq  $32, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_pos
+    addq  $16, %rsp
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_1161(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -576(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movq  (%rsp), %rcx
+    movb  $0, %al
+    callq _add_error
+    addq  $32, %rsp
+    jmp   _LBB102_2
+## if-else
+_LBB102_3:
+_LBB102_2:
+    jmp   _LBB101_2
+## if-else
+_LBB101_3:
+_LBB101_2:
+_LBB99_2:
+_LBB94_2:
+_LBB85_2:
+    jmp   _LBB60_2
+_LBB60_1264:
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _check_tree_
+    addq  $16, %rsp
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _check_tree_
+    addq  $16, %rsp
+## if-cond
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_struct_or_union
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB104_3
+## if-then
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _type_name1_1025(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _make_type_name
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_pos
+    addq  $16, %rsp
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_1166(%rip), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _type_name1_1025(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movq  (%rsp), %rcx
+    movb  $0, %al
+    callq _add_error
+    addq  $32, %rsp
+    jmp   _LBB58_0
+    jmp   _LBB104_2
+## if-else
+_LBB104_3:
+_LBB104_2:
+## if-cond
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_incomplete
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB105_3
+## if-then
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _type_name1_1025(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _make_type_name
+    addq  $16, %rsp
+    subq  $32, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_pos
+    addq  $16, %rsp
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_1169(%rip), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _type_name1_1025(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movq  (%rsp), %rcx
+    movb  $0, %al
+    callq _add_error
+    addq  $32, %rsp
+    jmp   _LBB58_0
+    jmp   _LBB105_2
+## if-else
+_LBB105_3:
+_LBB105_2:
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $82, %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB106_3
+## if-then
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _type_name1_1025(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _make_type_name
+    addq  $16, %rsp
+    subq  $48, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 40(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_pos
+    addq  $16, %rsp
+    movq  %rax, 32(%rsp)
+    leaq  _L_str_1172(%rip), %rax
+    movq  %rax, 24(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    leaq  _type_name1_1025(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  40(%rsp), %rdi
+    movq  32(%rsp), %rsi
+    movq  24(%rsp), %rdx
+    movq  16(%rsp), %rcx
+    movq  8(%rsp), %r8
+    movb  $0, %al
+    callq _add_error
+    addq  $48, %rsp
+    jmp   _LBB106_2
+## if-else
+_LBB106_3:
+_LBB106_2:
+    jmp   _LBB58_0
+_LBB60_1274:
+## local scalar init
+    leaq  -580(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $32, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -16(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _check_tree_
+    addq  $16, %rsp
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _check_tree_
+    addq  $16, %rsp
+## assign
+    movq  -16(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    movl  -580(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _underlying
+    addq  $16, %rsp
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB107_3
+## if-then
+    subq  $32, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_pos
+    addq  $16, %rsp
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_1178(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _add_error
+    addq  $32, %rsp
+    jmp   _LBB107_2
+## if-else
+_LBB107_3:
+_LBB107_2:
+    jmp   _LBB58_0
+_LBB60_1279:
+_LBB60_1280:
+_LBB60_1281:
+    movq  -16(%rbp), %rax
+    addq  $24, %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _check_tree_
+    addq  $16, %rsp
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _check_tree_
+    addq  $16, %rsp
+    movq  -16(%rbp), %rax
+    addq  $24, %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    subl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB58_0
+_LBB60_1282:
+    movq  -16(%rbp), %rax
+    addq  $28, %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _check_tree_
+    addq  $16, %rsp
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _check_tree_
+    addq  $16, %rsp
+    movq  -16(%rbp), %rax
+    addq  $28, %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    subl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB58_0
+_LBB60_1283:
+## assign
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _check_tree_
+    addq  $16, %rsp
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _check_tree_
+    addq  $16, %rsp
+## assign
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB58_0
+_LBB60_1284:
+## local scalar init
+    leaq  -592(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _check_tree_
+    addq  $16, %rsp
+## assign
+    movq  -16(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    subq  $8, %rsp
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _underlying
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _first_param
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _check_tree_
+    addq  $16, %rsp
+## if-cond
+    movq  -16(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    movl  $0, %eax
+    je    _LBB109_2
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_ellipsis
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB109_2
+    movl  $1, %eax
+_LBB109_2:
+    cmpl  $0, %eax
+    je    _LBB108_3
+## if-then
+## local scalar init
+    leaq  -600(%rbp), %rax
+    pushq %rax
+## cond-?
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _node_r
+    addq  $8, %rsp
+    cmpq  $0, %rax
+    je    _LBB110_3
+## cond-then
+    subq  $8, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _node_pos
+    addq  $8, %rsp
+    jmp   _LBB110_2
+## cond-else
+_LBB110_3:
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _node_pos
+    addq  $8, %rsp
+_LBB110_2:
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $32, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    movq  -600(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_1189(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _add_error
+    addq  $32, %rsp
+    jmp   _LBB108_2
+## if-else
+_LBB108_3:
+_LBB108_2:
+## assign
+    movq  -16(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movq  -592(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB58_0
+_LBB60_1292:
+## if-cond
+    movq  -16(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB111_3
+## if-then
+    subq  $32, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_pos
+    addq  $16, %rsp
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_1194(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _add_error
+    addq  $32, %rsp
+    jmp   _LBB58_0
+    jmp   _LBB111_2
+## if-else
+_LBB111_3:
+_LBB111_2:
+## local scalar init
+    leaq  -608(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _node_l
+    addq  $8, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -608(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _is_compatible
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB113_2
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_ellipsis
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB113_2
+    movl  $1, %eax
+_LBB113_2:
+    cmpl  $0, %eax
+    je    _LBB112_3
+## if-then
+    subq  $16, %rsp
+    movq  -608(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _type_name1_1025(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _make_type_name
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _type_name2_1026(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _make_type_name
+    addq  $16, %rsp
+    subq  $48, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 40(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_pos
+    addq  $16, %rsp
+    movq  %rax, 32(%rsp)
+    leaq  _L_str_1199(%rip), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _type_name1_1025(%rip), %rax
+    movq  %rax, 16(%rsp)
+    leaq  _type_name2_1026(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  40(%rsp), %rdi
+    movq  32(%rsp), %rsi
+    movq  24(%rsp), %rdx
+    movq  16(%rsp), %rcx
+    movq  8(%rsp), %r8
+    movb  $0, %al
+    callq _add_error
+    addq  $48, %rsp
+    jmp   _LBB112_2
+## if-else
+_LBB112_3:
+_LBB112_2:
+## assign
+    movq  -16(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _next_param
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _check_tree_
+    addq  $16, %rsp
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _check_tree_
+    addq  $16, %rsp
+    jmp   _LBB58_0
+_LBB60_1302:
+## if-cond
+    movq  -16(%rbp), %rax
+    addq  $24, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB115_2
+    movq  -16(%rbp), %rax
+    addq  $28, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB115_2
+    movl  $1, %eax
+_LBB115_2:
+    cmpl  $0, %eax
+    je    _LBB114_3
+## if-then
+    subq  $32, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_pos
+    addq  $16, %rsp
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_1203(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _add_error
+    addq  $32, %rsp
+    jmp   _LBB114_2
+## if-else
+_LBB114_3:
+_LBB114_2:
+    jmp   _LBB60_2
+_LBB60_1304:
+## if-cond
+    movq  -16(%rbp), %rax
+    addq  $24, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB116_3
+## if-then
+    subq  $32, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_pos
+    addq  $16, %rsp
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_1205(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _add_error
+    addq  $32, %rsp
+    jmp   _LBB116_2
+## if-else
+_LBB116_3:
+_LBB116_2:
+    jmp   _LBB60_2
+_LBB60_1306:
+## local scalar init
+    leaq  -616(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _return_type
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -624(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    cmpq  $0, %rax
+    je    _LBB117_3
+## if-then
+## if-cond
+    subq  $16, %rsp
+    movq  -616(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_void
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    je    _LBB118_3
+## if-then
+    subq  $32, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_pos
+    addq  $16, %rsp
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_1212(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -624(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movq  (%rsp), %rcx
+    movb  $0, %al
+    callq _add_error
+    addq  $32, %rsp
+    jmp   _LBB118_2
+## if-else
+_LBB118_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -616(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _is_compatible
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB119_3
+## if-then
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _type_name1_1025(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _make_type_name
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -616(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _type_name2_1026(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _make_type_name
+    addq  $16, %rsp
+    subq  $48, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 40(%rsp)
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_pos
+    addq  $16, %rsp
+    movq  %rax, 32(%rsp)
+    leaq  _L_str_1215(%rip), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _type_name1_1025(%rip), %rax
+    movq  %rax, 16(%rsp)
+    leaq  _type_name2_1026(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  40(%rsp), %rdi
+    movq  32(%rsp), %rsi
+    movq  24(%rsp), %rdx
+    movq  16(%rsp), %rcx
+    movq  8(%rsp), %r8
+    movb  $0, %al
+    callq _add_error
+    addq  $48, %rsp
+    jmp   _LBB119_2
+## if-else
+_LBB119_3:
+_LBB119_2:
+_LBB118_2:
+    jmp   _LBB117_2
+## if-else
+_LBB117_3:
+## if-cond
+    subq  $16, %rsp
+    movq  -616(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _is_void
+    addq  $16, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB120_3
+## if-then
+    subq  $32, %rsp
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_pos
+    addq  $16, %rsp
+    movq  %rax, 16(%rsp)
+    leaq  _L_str_1219(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -624(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movq  (%rsp), %rcx
+    movb  $0, %al
+    callq _add_error
+    addq  $32, %rsp
+    jmp   _LBB120_2
+## if-else
+_LBB120_3:
+_LBB120_2:
+_LBB117_2:
+    jmp   _LBB60_2
+_LBB60_1322:
+    jmp   _LBB60_2
+_LBB60_2:
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_l
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _check_tree_
+    addq  $16, %rsp
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _node_r
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _check_tree_
+    addq  $16, %rsp
+_LBB58_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_check_tree_semantics:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $64, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -56(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    popq  %rax
+    movq  $0, %rdx
+    movq  %rdx, (%rax)
+## local scalar init
+    leaq  -56(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    popq  %rax
+    movq  $0, %rdx
+    movq  %rdx, (%rax)
+## local scalar init
+    leaq  -56(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -56(%rbp), %rax
+    addq  $28, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -56(%rbp), %rax
+    addq  $32, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -56(%rbp), %rax
+    addq  $36, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## assign
+    leaq  -56(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  -56(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _check_tree_
+    addq  $16, %rsp
+_LBB121_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _analyze_semantics
+_analyze_semantics:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movq  %rdx, -24(%rbp)
+## func body
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _check_tree_semantics
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _check_symbol_usage
+    addq  $16, %rsp
+    movl  $0, %eax
+    jmp   _LBB122_0
+_LBB122_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
@@ -73,7 +73,7 @@ static int is_integer_zero(struct ast_node *node)
 {
     if (is_integer(node->type) &&
         node->kind == NOD_NUM &&
-        node->ival == 0)
+        node_ival(node) == 0)
         return 1;
     return 0;
 }
@@ -91,22 +91,22 @@ static void check_init_scalar(struct ast_node *node, struct tree_context *ctx)
     switch (node->kind) {
 
     case NOD_INIT:
-        t1 = node->l->type;
-        t2 = node->r->type;
+        t1 = node_l(node)->type;
+        t2 = node_r(node)->type;
 
         /* integer zero to pointer */
-        if (is_pointer(t1) && is_integer_zero(node->r))
+        if (is_pointer(t1) && is_integer_zero(node_r(node)))
             return;
 
         if (!is_compatible(t1, t2)) {
             make_type_name(t1, type_name1);
             make_type_name(t2, type_name2);
             if (is_pointer(t1))
-                add_error(ctx->diag, &node->pos,
+                add_error(ctx->diag, node_pos(node),
                         "incompatible pointer types initializing '%s' with an expression of type '%s'",
                         type_name1, type_name2);
             else
-                add_error(ctx->diag, &node->pos,
+                add_error(ctx->diag, node_pos(node),
                         "initializing '%s' with an expression of incompatible type '%s'",
                         type_name1, type_name2);
         }
@@ -125,8 +125,8 @@ static void check_init_array_element(struct ast_node *node, struct tree_context
     switch (node->kind) {
 
     case NOD_INIT:
-        if (is_void(node->l->type)) {
-            add_error(ctx->diag, &node->pos,
+        if (is_void(node_l(node)->type)) {
+            add_error(ctx->diag, node_pos(node),
                     "excess elements in array initializer");
             break;
         }
@@ -135,8 +135,15 @@ static void check_init_array_element(struct ast_node *node, struct tree_context
         break;
 
     case NOD_LIST:
-        check_init_array_element(node->l, ctx);
-        check_init_array_element(node->r, ctx);
+        {
+            struct ast_walker walk;
+            const struct ast_node *item;
+
+            begin_ast_walk(&walk, node);
+            while ((item = next_ast_list_item(&walk)) != NULL)
+                check_init_array_element((struct ast_node *) item, ctx);
+            end_ast_walk(&walk);
+        }
         break;
 
     default:
@@ -152,8 +159,8 @@ static void check_init_struct_members(struct ast_node *node, struct tree_context
     switch (node->kind) {
 
     case NOD_INIT:
-        if (is_void(node->l->type)) {
-            add_error(ctx->diag, &node->pos,
+        if (is_void(node_l(node)->type)) {
+            add_error(ctx->diag, node_pos(node),
                     "excess elements in %s initializer",
                     ctx->is_union ? "union" : "struct");
             break;
@@ -163,8 +170,15 @@ static void check_init_struct_members(struct ast_node *node, struct tree_context
         break;
 
     case NOD_LIST:
-        check_init_struct_members(node->l, ctx);
-        check_init_struct_members(node->r, ctx);
+        {
+            struct ast_walker walk;
+            const struct ast_node *item;
+
+            begin_ast_walk(&walk, node);
+            while ((item = next_ast_list_item(&walk)) != NULL)
+                check_init_struct_members((struct ast_node *) item, ctx);
+            end_ast_walk(&walk);
+        }
         break;
 
     default:
@@ -174,8 +188,8 @@ static void check_init_struct_members(struct ast_node *node, struct tree_context
 
 static void check_initializer(struct ast_node *node, struct tree_context *ctx)
 {
-    struct ast_node *desi = node ? node->l : NULL;
-    struct ast_node *expr = node ? node->r : NULL;
+    struct ast_node *desi = node ? node_l(node) : NULL;
+    struct ast_node *expr = node ? node_r(node) : NULL;
 
     if (!desi || !expr)
         return;
@@ -210,10 +224,23 @@ static void check_tree_(struct ast_node *node, struct tree_context *ctx)
 
     switch (node->kind) {
 
+    case NOD_LIST:
+    case NOD_COMPOUND:
+        {
+            struct ast_walker walk;
+            const struct ast_node *item;
+
+            begin_ast_walk(&walk, node);
+            while ((item = next_ast_list_item(&walk)) != NULL)
+                check_tree_((struct ast_node *) item, ctx);
+            end_ast_walk(&walk);
+        }
+        return;
+
     /* declaration */
     case NOD_DECL_IDENT:
         /* has initializer or is a global variable */
-        node->sym->is_initialized = node->l || is_global_var(node->sym);
+        node->sym->is_initialized = node_l(node) || is_global_var(node->sym);
 
         if (is_function(node->type))
             ctx->func_type = node->type;
@@ -221,64 +248,64 @@ static void check_tree_(struct ast_node *node, struct tree_context *ctx)
         if (is_incomplete(node->sym->type) &&
                 (is_local_var(node->sym) || is_global_var(node->sym))) {
             make_type_name(node->sym->type, type_name1);
-            add_error(ctx->diag, &node->pos, "variable has incomplete type '%s'",
+            add_error(ctx->diag, node_pos(node), "variable has incomplete type '%s'",
                     type_name1);
             return;
         }
 
         if (is_label(node->sym)) {
             if (node->sym->is_redefined)
-                add_error(ctx->diag, &node->pos, "redefinition of label '%s'",
+                add_error(ctx->diag, node_pos(node), "redefinition of label '%s'",
                         node->sym->name);
         }
 
         if (is_local_var(node->sym)) {
             if (node->sym->is_redefined)
-                add_error(ctx->diag, &node->pos, "redefinition of '%s'",
+                add_error(ctx->diag, node_pos(node), "redefinition of '%s'",
                         node->sym->name);
         }
 
-        if (node->l)
-            check_initializer(node->l, ctx);
+        if (node_l(node))
+            check_initializer(node_l(node), ctx);
 
         break;
 
     /* TODO add sub_assign, ... */
     case NOD_ASSIGN:
         /* evaluate rvalue first to check a = a + 1; */
-        check_tree_(node->r, ctx);
+        check_tree_(node_r(node), ctx);
         ctx->is_lvalue = 1;
-        check_tree_(node->l, ctx);
+        check_tree_(node_l(node), ctx);
         ctx->is_lvalue = 0;
 
-        if (node->l->kind == NOD_DEREF) {
+        if (node_l(node)->kind == NOD_DEREF) {
             if (is_const(node->type))
-                add_error(ctx->diag, &node->pos,
+                add_error(ctx->diag, node_pos(node),
                         "read-only variable is not assignable");
         }
-        else if (node->l->kind == NOD_IDENT) {
+        else if (node_l(node)->kind == NOD_IDENT) {
             if (is_const(node->type))
-                add_error(ctx->diag, &node->pos,
+                add_error(ctx->diag, node_pos(node),
                         "cannot assign to variable '%s' with const-qualified",
-                        node->l->sym->name);
+                        node_l(node)->sym->name);
         }
         else {
             /* TODO assert? */
         }
 
         /* integer zero to pointer */
-        if (is_pointer(node->l->type) && is_integer_zero(node->r))
+        if (is_pointer(node_l(node)->type) && is_integer_zero(node_r(node)))
             return;
 
-        if (node->l && node->r && !is_compatible(node->l->type, node->r->type)) {
-            make_type_name(node->l->type, type_name1);
-            make_type_name(node->r->type, type_name2);
+        if (node_l(node) && node_r(node) && !is_compatible(node_l(node)->type, node_r(node)->type)) {
+            make_type_name(node_l(node)->type, type_name1);
+            make_type_name(node_r(node)->type, type_name2);
             if (is_pointer(node->type))
-                add_error(ctx->diag, &node->pos,
+                add_error(ctx->diag, node_pos(node),
                         "incompatible pointer types assigning to '%s' from '%s'",
                         type_name1, type_name2);
             else
-                add_error(ctx->diag, &node->pos,
+                add_error(ctx->diag, node_pos(node),
                         "assigning to '%s' from incompatible type '%s'",
                         type_name1, type_name2);
         }
@@ -300,25 +327,25 @@ static void check_tree_(struct ast_node *node, struct tree_context *ctx)
                 if (sym->is_defined && sym->is_used && !is_orig_initialized(sym))
                     /* array, struct, union will not be treated as uninitialized */
                     if (!is_array(sym->type) && !is_struct_or_union(sym->type))
-                        add_warning(ctx->diag, &node->pos,
+                        add_warning(ctx->diag, node_pos(node),
                                 "variable '%s' is uninitialized when used here", sym->name);
 
                 if (!sym->is_defined && sym->is_used)
-                    add_error(ctx->diag, &node->pos,
+                    add_error(ctx->diag, node_pos(node),
                             "use of undeclared identifier '%s'", sym->name);
             }
             else if (is_func(sym)) {
                 if (!sym->is_defined && sym->is_used && !is_extern(sym) && !is_static(sym))
-                    add_warning(ctx->diag, &node->pos,
+                    add_warning(ctx->diag, node_pos(node),
                             "implicit declaration of function '%s'", sym->name);
             }
             else if (is_enumerator(sym)) {
                 if (sym->is_assigned)
-                    add_error(ctx->diag, &node->pos, "expression is not assignable");
+                    add_error(ctx->diag, node_pos(node), "expression is not assignable");
             }
             else if (is_label(sym)) {
                 if (!sym->is_defined && sym->is_used)
-                    add_error(ctx->diag, &node->pos, "use of undeclared label '%s'",
+                    add_error(ctx->diag, node_pos(node), "use of undeclared label '%s'",
                             sym->name);
             }
         }
@@ -326,27 +353,27 @@ static void check_tree_(struct ast_node *node, struct tree_context *ctx)
 
     /* struct */
     case NOD_STRUCT_REF:
-        check_tree_(node->l, ctx);
-        check_tree_(node->r, ctx);
-        if (!is_struct_or_union(node->l->type)) {
-            make_type_name(node->l->type, type_name1);
-            add_error(ctx->diag, &node->pos,
+        check_tree_(node_l(node), ctx);
+        check_tree_(node_r(node), ctx);
+        if (!is_struct_or_union(node_l(node)->type)) {
+            make_type_name(node_l(node)->type, type_name1);
+            add_error(ctx->diag, node_pos(node),
                     "member reference base type '%.32s' is not a structure or union",
                     type_name1);
             return;
         }
-        if (is_incomplete(node->l->type)) {
-            make_type_name(node->l->type, type_name1);
-            add_error(ctx->diag, &node->pos,
+        if (is_incomplete(node_l(node)->type)) {
+            make_type_name(node_l(node)->type, type_name1);
+            add_error(ctx->diag, node_pos(node),
                     "incomplete definition of type '%.32s'",
                     type_name1);
             return;
         }
-        if (!node->r->sym->is_defined) {
-            make_type_name(node->l->type, type_name1);
-            add_error(ctx->diag, &node->pos,
+        if (!node_r(node)->sym->is_defined) {
+            make_type_name(node_l(node)->type, type_name1);
+            add_error(ctx->diag, node_pos(node),
                     "no member named '%.32s' in '%.32s'",
-                    node->r->sym->name, type_name1);
+                    node_r(node)->sym->name, type_name1);
         }
         return;
 
@@ -355,12 +382,12 @@ static void check_tree_(struct ast_node *node, struct tree_context *ctx)
             /* lvalue could have array access with other identifiers */
             const int tmp = ctx->is_lvalue;
             ctx->is_lvalue = 0;
-            check_tree_(node->l, ctx);
-            check_tree_(node->r, ctx);
+            check_tree_(node_l(node), ctx);
+            check_tree_(node_r(node), ctx);
             ctx->is_lvalue = tmp;
         }
-        if (!underlying(node->l->type))
-            add_error(ctx->diag, &node->pos, "indirection requires pointer operand");
+        if (!underlying(node_l(node)->type))
+            add_error(ctx->diag, node_pos(node), "indirection requires pointer operand");
         return;
 
     /* loop */
@@ -368,24 +395,24 @@ static void check_tree_(struct ast_node *node, struct tree_context *ctx)
     case NOD_WHILE:
     case NOD_DOWHILE:
         ctx->loop_depth++;
-        check_tree_(node->l, ctx);
-        check_tree_(node->r, ctx);
+        check_tree_(node_l(node), ctx);
+        check_tree_(node_r(node), ctx);
         ctx->loop_depth--;
         return;
 
     /* switch */
     case NOD_SWITCH:
         ctx->switch_depth++;
-        check_tree_(node->l, ctx);
-        check_tree_(node->r, ctx);
+        check_tree_(node_l(node), ctx);
+        check_tree_(node_r(node), ctx);
         ctx->switch_depth--;
         return;
 
     /* function */
     case NOD_FUNC_DEF:
         ctx->func_type = NULL;
-        check_tree_(node->l, ctx);
-        check_tree_(node->r, ctx);
+        check_tree_(node_l(node), ctx);
+        check_tree_(node_r(node), ctx);
         ctx->func_type = NULL;
         return;
 
@@ -393,12 +420,12 @@ static void check_tree_(struct ast_node *node, struct tree_context *ctx)
         {
             const struct parameter *tmp = ctx->param;
 
-            check_tree_(node->l, ctx);
-            ctx->param = first_param(underlying(node->l->type));
-            check_tree_(node->r, ctx);
+            check_tree_(node_l(node), ctx);
+            ctx->param = first_param(underlying(node_l(node)->type));
+            check_tree_(node_r(node), ctx);
 
             if (ctx->param && !is_ellipsis(ctx->param->sym)) {
-                const struct position *pos = node->r ? &node->r->pos : &node->pos;
+                const struct position *pos = node_r(node) ? node_pos(node_r(node)) : node_pos(node);
                 add_error(ctx->diag, pos, "too few arguments to function call");
             }
 
@@ -408,37 +435,37 @@ static void check_tree_(struct ast_node *node, struct tree_context *ctx)
 
     case NOD_ARG:
         if (!ctx->param) {
-            add_error(ctx->diag, &node->pos, "too many arguments to function call");
+            add_error(ctx->diag, node_pos(node), "too many arguments to function call");
             return;
         }
 
         {
-            const struct data_type *arg_type = node->l->type;
+            const struct data_type *arg_type = node_l(node)->type;
             if (!is_compatible(arg_type, ctx->param->sym->type) &&
                 !is_ellipsis(ctx->param->sym)) {
                 make_type_name(arg_type, type_name1);
                 make_type_name(ctx->param->sym->type, type_name2);
-                add_error(ctx->diag, &node->pos,
+                add_error(ctx->diag, node_pos(node),
                         "passing '%s' to parameter of incompatible type '%s'",
                         type_name1, type_name2);
             }
         }
         ctx->param = next_param(ctx->param);
 
-        check_tree_(node->l, ctx);
-        check_tree_(node->r, ctx);
+        check_tree_(node_l(node), ctx);
+        check_tree_(node_r(node), ctx);
         return;
 
     /* break and continue */
     case NOD_BREAK:
         if (ctx->loop_depth == 0 && ctx->switch_depth == 0)
-            add_error(ctx->diag, &node->pos,
+            add_error(ctx->diag, node_pos(node),
                     "'break' statement not in loop or switch statement");
         break;
 
     case NOD_CONTINUE:
         if (ctx->loop_depth == 0)
-            add_error(ctx->diag, &node->pos,
+            add_error(ctx->diag, node_pos(node),
                     "'continue' statement not in loop statement");
         break;
 
@@ -447,22 +474,22 @@ static void check_tree_(struct ast_node *node, struct tree_context *ctx)
             const struct data_type *ret_type = return_type(ctx->func_type);
             const char *func_name = ctx->func_type->sym->name;
 
-            if (node->l) {
+            if (node_l(node)) {
                 if (is_void(ret_type)) {
-                    add_error(ctx->diag, &node->l->pos,
+                    add_error(ctx->diag, node_pos(node_l(node)),
                             "void function '%s' should not return a value", func_name);
                 }
-                else if (!is_compatible(ret_type, node->l->type)) {
-                    make_type_name(node->l->type, type_name1);
+                else if (!is_compatible(ret_type, node_l(node)->type)) {
+                    make_type_name(node_l(node)->type, type_name1);
                     make_type_name(ret_type, type_name2);
-                    add_error(ctx->diag, &node->l->pos,
+                    add_error(ctx->diag, node_pos(node_l(node)),
                             "returning '%s' from a function with incompatible result type '%s'",
                             type_name1, type_name2);
                 }
             }
             else {
                 if (!is_void(ret_type))
-                    add_error(ctx->diag, &node->pos,
+                    add_error(ctx->diag, node_pos(node),
                             "non-void function '%s' should return a value", func_name);
             }
         }
@@ -472,8 +499,8 @@ static void check_tree_(struct ast_node *node, struct tree_context *ctx)
         break;;
     }
 
-    check_tree_(node->l, ctx);
-    check_tree_(node->r, ctx);
+    check_tree_(node_l(node), ctx);
+    check_tree_(node_r(node), ctx);
 }
 
 static void check_tree_semantics(struct ast_node *tree, struct diagnostic *diag)
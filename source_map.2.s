@@ -0,0 +1,1142 @@
+    .data
+
+    .text
+
+    .global _new_source_map
+_new_source_map:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+## func body
+## local scalar init
+    leaq  -8(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $1, %eax
+    movslq %eax, %rax
+    movq  %rax, 16(%rsp)
+    movl  $56, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _calloc
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $52, %rax
+    pushq %rax
+    movl  $1024, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $40, %rax
+    pushq %rax
+    subq  $8, %rsp
+    movl  $4, %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $52, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    imull %edx, %eax
+    movslq %eax, %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _malloc
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $40, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $48, %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    movq  -8(%rbp), %rax
+    jmp   _LBB0_0
+_LBB0_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _free_source_map
+_free_source_map:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## if-cond
+    movq  -8(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB2_3
+## if-then
+    jmp   _LBB1_0
+    jmp   _LBB2_2
+## if-else
+_LBB2_3:
+_LBB2_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $40, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+_LBB1_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _add_source_text
+_add_source_text:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movl  %edx, -20(%rbp)
+## func body
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  -20(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## while-cond
+_LBB4_4:
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -32(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  $10, %eax
+    movl  %eax, 8(%rsp)
+    movq  -40(%rbp), %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    movq  %rax, (%rsp)
+    movq  16(%rsp), %rdi
+    movl  8(%rsp), %esi
+    movq  (%rsp), %rdx
+    callq _memchr
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB4_2
+## while-body
+    leaq  -32(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $48, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $52, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB5_3
+## if-then
+## mul-assign
+    movq  -8(%rbp), %rax
+    addq  $52, %rax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull (%rdx), %eax
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $40, %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    addq  $40, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movl  $4, %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $52, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    imull %edx, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _realloc
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB5_2
+## if-else
+_LBB5_3:
+_LBB5_2:
+## assign
+    movq  -8(%rbp), %rax
+    addq  $40, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $48, %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    movq  %rax, %rdx
+    popq  %rax
+    subq  %rdx, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB4_4
+_LBB4_2:
+## add-assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  -20(%rbp), %eax
+    popq  %rdx
+    addl  %eax, (%rdx)
+    movl  (%rdx), %eax
+_LBB3_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _add_line_marker
+_add_line_marker:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+    movl  %edx, -16(%rbp)
+    movq  %rcx, -24(%rbp)
+## func body
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $20, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB7_3
+## if-then
+## assign
+    movq  -8(%rbp), %rax
+    addq  $20, %rax
+    pushq %rax
+## cond-?
+    movq  -8(%rbp), %rax
+    addq  $20, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    je    _LBB8_3
+## cond-then
+    movl  $2, %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $20, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    imull %edx, %eax
+    jmp   _LBB8_2
+## cond-else
+_LBB8_3:
+    movl  $64, %eax
+_LBB8_2:
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movl  $16, %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $20, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    imull %edx, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _realloc
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB7_2
+## if-else
+_LBB7_3:
+_LBB7_2:
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $16, %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -32(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -32(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    movl  -16(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -32(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+_LBB6_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _add_column_marker
+_add_column_marker:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+    movl  %edx, -16(%rbp)
+## func body
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $32, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $36, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB10_3
+## if-then
+## assign
+    movq  -8(%rbp), %rax
+    addq  $36, %rax
+    pushq %rax
+## cond-?
+    movq  -8(%rbp), %rax
+    addq  $36, %rax
+    movl  (%rax), %eax
+    cmpl  $0, %eax
+    je    _LBB11_3
+## cond-then
+    movl  $2, %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $36, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    imull %edx, %eax
+    jmp   _LBB11_2
+## cond-else
+_LBB11_3:
+    movl  $64, %eax
+_LBB11_2:
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movl  $8, %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $36, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    imull %edx, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _realloc
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB10_2
+## if-else
+_LBB10_3:
+_LBB10_2:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $32, %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -24(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    movl  -16(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+_LBB9_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_find_line:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $48, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $1, %eax
+    movl  %eax, %edx
+    popq  %rax
+    subl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## while-cond
+_LBB13_4:
+    movl  -16(%rbp), %eax
+    pushq %rax
+    movl  -20(%rbp), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB13_2
+## while-body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  -16(%rbp), %eax
+    pushq %rax
+    movl  -20(%rbp), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    pushq %rax
+    movl  $2, %eax
+    movl  %eax, %edi
+    popq  %rax
+    cltd
+    idivl %edi
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $40, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  -24(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setle %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB14_3
+## if-then
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  -24(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB14_2
+## if-else
+_LBB14_3:
+## assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  -24(%rbp), %eax
+    pushq %rax
+    movl  $1, %eax
+    movl  %eax, %edx
+    popq  %rax
+    subl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+_LBB14_2:
+    jmp   _LBB13_4
+_LBB13_2:
+    movl  -16(%rbp), %eax
+    jmp   _LBB12_0
+_LBB12_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_find_line_marker:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $16, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $1, %eax
+    movl  %eax, %edx
+    popq  %rax
+    subl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## while-cond
+_LBB16_4:
+    movl  -16(%rbp), %eax
+    pushq %rax
+    movl  -20(%rbp), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setle %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB16_2
+## while-body
+## local scalar init
+    leaq  -36(%rbp), %rax
+    pushq %rax
+    movl  -16(%rbp), %eax
+    pushq %rax
+    movl  -20(%rbp), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    pushq %rax
+    movl  $2, %eax
+    movl  %eax, %edi
+    popq  %rax
+    cltd
+    idivl %edi
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $16, %eax
+    pushq %rax
+    movl  -36(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setle %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB17_3
+## if-then
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $16, %eax
+    pushq %rax
+    movl  -36(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  -36(%rbp), %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB17_2
+## if-else
+_LBB17_3:
+## assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  -36(%rbp), %eax
+    pushq %rax
+    movl  $1, %eax
+    movl  %eax, %edx
+    popq  %rax
+    subl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+_LBB17_2:
+    jmp   _LBB16_4
+_LBB16_2:
+    movq  -32(%rbp), %rax
+    jmp   _LBB15_0
+_LBB15_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_find_column_marker:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $32, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $1, %eax
+    movl  %eax, %edx
+    popq  %rax
+    subl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## while-cond
+_LBB19_4:
+    movl  -16(%rbp), %eax
+    pushq %rax
+    movl  -20(%rbp), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setle %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB19_2
+## while-body
+## local scalar init
+    leaq  -36(%rbp), %rax
+    pushq %rax
+    movl  -16(%rbp), %eax
+    pushq %rax
+    movl  -20(%rbp), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    pushq %rax
+    movl  $2, %eax
+    movl  %eax, %edi
+    popq  %rax
+    cltd
+    idivl %edi
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -36(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setle %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB20_3
+## if-then
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $24, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  -36(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  -36(%rbp), %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB20_2
+## if-else
+_LBB20_3:
+## assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  -36(%rbp), %eax
+    pushq %rax
+    movl  $1, %eax
+    movl  %eax, %edx
+    popq  %rax
+    subl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+_LBB20_2:
+    jmp   _LBB19_4
+_LBB19_2:
+    movq  -32(%rbp), %rax
+    jmp   _LBB18_0
+_LBB18_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _resolve_position
+_resolve_position:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $64, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movq  %rdx, -24(%rbp)
+## func body
+## local scalar init
+    leaq  -44(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  -44(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movl  8(%rsp), %esi
+    callq _find_line
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -52(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $40, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  -48(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  -44(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movl  8(%rsp), %esi
+    callq _find_line_marker
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -32(%rbp), %rax
+    cmpq  $0, %rax
+    je    _LBB22_3
+## if-then
+## assign
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  -48(%rbp), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    pushq %rax
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -32(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movq  8(%rsp), %rdi
+    movl  (%rsp), %esi
+    callq _find_line
+    addq  $16, %rsp
+    movl  %eax, %edx
+    popq  %rax
+    subl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB22_2
+## if-else
+_LBB22_3:
+## assign
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -24(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  -48(%rbp), %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+_LBB22_2:
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movl  -44(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movl  8(%rsp), %esi
+    callq _find_column_marker
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -40(%rbp), %rax
+    cmpq  $0, %rax
+    movl  $0, %eax
+    je    _LBB24_2
+    movq  -40(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  -52(%rbp), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setge %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB24_2
+    movl  $1, %eax
+_LBB24_2:
+    cmpl  $0, %eax
+    je    _LBB23_3
+## if-then
+## assign
+    movq  -24(%rbp), %rax
+    addq  $12, %rax
+    pushq %rax
+    movq  -40(%rbp), %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  -44(%rbp), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    pushq %rax
+    movq  -40(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, %edx
+    popq  %rax
+    subl  %edx, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB23_2
+## if-else
+_LBB23_3:
+## assign
+    movq  -24(%rbp), %rax
+    addq  $12, %rax
+    pushq %rax
+    movl  -44(%rbp), %eax
+    pushq %rax
+    movl  -52(%rbp), %eax
+    movl  %eax, %edx
+    popq  %rax
+    subl  %edx, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+_LBB23_2:
+_LBB21_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
@@ -0,0 +1,160 @@
+#include <stdlib.h>
+#include <string.h>
+#include "source_map.h"
+
+struct source_map *new_source_map(void)
+{
+    struct source_map *map = calloc(1, sizeof(struct source_map));
+
+    map->line_start_capacity = 1024;
+    map->line_starts = malloc(sizeof(int) * map->line_start_capacity);
+    map->line_starts[map->line_start_count++] = 0;
+
+    return map;
+}
+
+void free_source_map(struct source_map *map)
+{
+    if (!map)
+        return;
+
+    free(map->lines);
+    free(map->columns);
+    free(map->line_starts);
+    free(map);
+}
+
+void add_source_text(struct source_map *map, const char *text, int len)
+{
+    const char *p = text;
+    const char *end = text + len;
+
+    while ((p = memchr(p, '\n', end - p)) != NULL) {
+        p++;
+        if (map->line_start_count == map->line_start_capacity) {
+            map->line_start_capacity *= 2;
+            map->line_starts = realloc(map->line_starts,
+                    sizeof(int) * map->line_start_capacity);
+        }
+        map->line_starts[map->line_start_count++] = map->text_length + (p - text);
+    }
+
+    map->text_length += len;
+}
+
+void add_line_marker(struct source_map *map,
+        int offset, int line, const char *filename)
+{
+    struct line_marker *m;
+
+    if (map->line_count == map->line_capacity) {
+        map->line_capacity = map->line_capacity ? 2 * map->line_capacity : 64;
+        map->lines = realloc(map->lines,
+                sizeof(struct line_marker) * map->line_capacity);
+    }
+
+    m = &map->lines[map->line_count++];
+    m->offset = offset;
+    m->line = line;
+    m->filename = filename;
+}
+
+void add_column_marker(struct source_map *map, int offset, int column)
+{
+    struct column_marker *m;
+
+    if (map->column_count == map->column_capacity) {
+        map->column_capacity = map->column_capacity ? 2 * map->column_capacity : 64;
+        map->columns = realloc(map->columns,
+                sizeof(struct column_marker) * map->column_capacity);
+    }
+
+    m = &map->columns[map->column_count++];
+    m->offset = offset;
+    m->column = column;
+}
+
+/* index of the last line containing offset */
+static int find_line(const struct source_map *map, int offset)
+{
+    int lo = 0, hi = map->line_start_count - 1;
+
+    while (lo < hi) {
+        const int mid = (lo + hi + 1) / 2;
+
+        if (map->line_starts[mid] <= offset)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+
+    return lo;
+}
+
+static const struct line_marker *find_line_marker(const struct source_map *map,
+        int offset)
+{
+    int lo = 0, hi = map->line_count - 1;
+    const struct line_marker *found = NULL;
+
+    while (lo <= hi) {
+        const int mid = (lo + hi) / 2;
+
+        if (map->lines[mid].offset <= offset) {
+            found = &map->lines[mid];
+            lo = mid + 1;
+        } else {
+            hi = mid - 1;
+        }
+    }
+
+    return found;
+}
+
+static const struct column_marker *find_column_marker(const struct source_map *map,
+        int offset)
+{
+    int lo = 0, hi = map->column_count - 1;
+    const struct column_marker *found = NULL;
+
+    while (lo <= hi) {
+        const int mid = (lo + hi) / 2;
+
+        if (map->columns[mid].offset <= offset) {
+            found = &map->columns[mid];
+            lo = mid + 1;
+        } else {
+            hi = mid - 1;
+        }
+    }
+
+    return found;
+}
+
+void resolve_position(const struct source_map *map,
+        const struct position *pos, struct source_location *loc)
+{
+    const struct line_marker *lm;
+    const struct column_marker *cm;
+    const int offset = pos->offset;
+    int line_index, line_start;
+
+    line_index = find_line(map, offset);
+    line_start = map->line_starts[line_index];
+
+    lm = find_line_marker(map, offset);
+    if (lm) {
+        loc->filename = lm->filename;
+        loc->line = lm->line + line_index - find_line(map, lm->offset);
+    } else {
+        loc->filename = NULL;
+        loc->line = line_index + 1;
+    }
+
+    /* column markers are effective until the end of line */
+    cm = find_column_marker(map, offset);
+    if (cm && cm->offset >= line_start)
+        loc->column = cm->column + offset - cm->offset + 1;
+    else
+        loc->column = offset - line_start + 1;
+}
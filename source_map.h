@@ -0,0 +1,58 @@
+#ifndef SOURCE_MAP_H
+#define SOURCE_MAP_H
+
+#include "position.h"
+
+/* text after offset is at the line of the file */
+struct line_marker {
+    int offset;
+    int line;
+    const char *filename;
+};
+
+/* text after offset is at the column on the same line */
+struct column_marker {
+    int offset;
+    int column;
+};
+
+/* maps offsets in the preprocessed text to lines and columns of source
+ * files. markers are added in text order by the preprocessor while the
+ * text is being written, so the text itself has no line markers. the text
+ * is added in chunks as it is handed to the lexer, and only the offsets
+ * of line starts are kept */
+struct source_map {
+    int text_length;
+
+    struct line_marker *lines;
+    int line_count;
+    int line_capacity;
+
+    struct column_marker *columns;
+    int column_count;
+    int column_capacity;
+
+    int *line_starts;
+    int line_start_count;
+    int line_start_capacity;
+};
+
+struct source_location {
+    const char *filename;
+    int line;
+    int column;
+};
+
+extern struct source_map *new_source_map(void);
+extern void free_source_map(struct source_map *map);
+
+/* text of len characters following the text added so far */
+extern void add_source_text(struct source_map *map, const char *text, int len);
+extern void add_line_marker(struct source_map *map,
+        int offset, int line, const char *filename);
+extern void add_column_marker(struct source_map *map, int offset, int column);
+
+extern void resolve_position(const struct source_map *map,
+        const struct position *pos, struct source_location *loc);
+
+#endif /* _H */
@@ -0,0 +1,4396 @@
+    .data
+
+    .text
+
+    .global _test_single_array
+_test_single_array:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+## func body
+## local scalar init
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    movl  $345, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -12(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    movl  $41, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -12(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $399, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $12, %eax
+    movl  %eax, 8(%rsp)
+    movl  $12, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $345, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $41, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $399, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    movl  $0, %eax
+    jmp   _LBB0_0
+_LBB0_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _array_to_pointer
+_array_to_pointer:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+    movq  -8(%rbp), %rax
+    movl  (%rax), %eax
+    jmp   _LBB1_0
+_LBB1_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _array_to_pointer2
+_array_to_pointer2:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+    movq  -8(%rbp), %rax
+    movq  (%rax), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    jmp   _LBB2_0
+_LBB2_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _count_up
+_count_up:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+    movq  -8(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+_LBB3_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _main
+_main:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $480, %rsp
+## func params
+## func body
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $7, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $4, %eax
+    popq  %rdx
+    imull %edx, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $10, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $42, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $42, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $16, %eax
+    movl  %eax, 8(%rsp)
+    movl  $16, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movl  $4, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $42, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -44(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $19, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $42, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -44(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $23, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    leaq  -44(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, %edx
+    popq  %rax
+    subl  %edx, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -68(%rbp), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $13, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -164(%rbp), %rax
+    pushq %rax
+    movl  $24, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $29, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $13, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -68(%rbp), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $29, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -164(%rbp), %rax
+    pushq %rax
+    movl  $24, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $42, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -68(%rbp), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    leaq  -164(%rbp), %rax
+    pushq %rax
+    movl  $24, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -212(%rbp), %rax
+    pushq %rax
+    movl  $16, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $13, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -212(%rbp), %rax
+    pushq %rax
+    movl  $16, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $4, %rax
+    pushq %rax
+    movl  $31, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $13, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -212(%rbp), %rax
+    pushq %rax
+    movl  $16, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $31, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -212(%rbp), %rax
+    pushq %rax
+    movl  $16, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -224(%rbp), %rax
+    pushq %rax
+    movl  $11, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -224(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    movl  $99, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -224(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $31, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $11, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -224(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $99, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -224(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $31, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -224(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -256(%rbp), %rax
+    pushq %rax
+    movl  $5, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -256(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    movl  $37, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -256(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $19, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -256(%rbp), %rax
+    addq  $12, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -256(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -256(%rbp), %rax
+    addq  $20, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -256(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -256(%rbp), %rax
+    addq  $28, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+    subq  $16, %rsp
+    movl  $5, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -256(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $37, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -256(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -256(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -256(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -256(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $4, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -256(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $5, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -256(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $6, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -256(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $7, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -272(%rbp), %rax
+    pushq %rax
+    movl  $15, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -272(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    movl  $37, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -272(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $19, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -272(%rbp), %rax
+    addq  $12, %rax
+    pushq %rax
+    movl  $23, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $15, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -272(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $37, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -272(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -272(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $23, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -272(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $16, %eax
+    movl  %eax, 8(%rsp)
+    movl  $16, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -288(%rbp), %rax
+    pushq %rax
+    movl  $11, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -288(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    movl  $22, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -288(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $44, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -288(%rbp), %rax
+    addq  $12, %rax
+    pushq %rax
+    movl  $55, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $16, %eax
+    movl  %eax, 8(%rsp)
+    movl  $16, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $11, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -288(%rbp), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $22, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -288(%rbp), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $44, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -288(%rbp), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $55, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -288(%rbp), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -312(%rbp), %rax
+    pushq %rax
+    movl  $111, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -312(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    movl  $222, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -312(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $444, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -312(%rbp), %rax
+    addq  $12, %rax
+    pushq %rax
+    movl  $555, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -312(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -312(%rbp), %rax
+    addq  $20, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+    subq  $16, %rsp
+    movl  $24, %eax
+    movl  %eax, 8(%rsp)
+    movl  $24, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $111, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -312(%rbp), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $222, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -312(%rbp), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $444, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -312(%rbp), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $555, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -312(%rbp), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -312(%rbp), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -312(%rbp), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -319(%rbp), %rax
+    pushq %rax
+    movl  $72, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -319(%rbp), %rax
+    addq  $1, %rax
+    pushq %rax
+    movl  $101, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -319(%rbp), %rax
+    addq  $2, %rax
+    pushq %rax
+    movl  $108, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -319(%rbp), %rax
+    addq  $3, %rax
+    pushq %rax
+    movl  $108, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -319(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    movl  $111, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -319(%rbp), %rax
+    addq  $5, %rax
+    pushq %rax
+    movl  $10, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -319(%rbp), %rax
+    addq  $6, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+    subq  $16, %rsp
+    movl  $7, %eax
+    movl  %eax, 8(%rsp)
+    movl  $7, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $72, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -319(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $101, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -319(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $108, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -319(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $108, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -319(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $111, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -319(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $4, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $10, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -319(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $5, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -319(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $6, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -329(%rbp), %rax
+    pushq %rax
+    movl  $72, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -329(%rbp), %rax
+    addq  $1, %rax
+    pushq %rax
+    movl  $101, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -329(%rbp), %rax
+    addq  $2, %rax
+    pushq %rax
+    movl  $108, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -329(%rbp), %rax
+    addq  $3, %rax
+    pushq %rax
+    movl  $108, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -329(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    movl  $111, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -329(%rbp), %rax
+    addq  $5, %rax
+    pushq %rax
+    movl  $10, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -329(%rbp), %rax
+    addq  $6, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -329(%rbp), %rax
+    addq  $7, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -329(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -329(%rbp), %rax
+    addq  $9, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+    subq  $16, %rsp
+    movl  $10, %eax
+    movl  %eax, 8(%rsp)
+    movl  $10, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $72, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -329(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $101, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -329(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $108, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -329(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $108, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -329(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $111, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -329(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $4, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $10, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -329(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $5, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -329(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $6, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -329(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $7, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -329(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $8, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -329(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $9, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -359(%rbp), %rax
+    pushq %rax
+    movl  $82, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -359(%rbp), %rax
+    addq  $1, %rax
+    pushq %rax
+    movl  $101, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -359(%rbp), %rax
+    addq  $2, %rax
+    pushq %rax
+    movl  $100, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -359(%rbp), %rax
+    addq  $3, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -359(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -359(%rbp), %rax
+    addq  $5, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -359(%rbp), %rax
+    addq  $6, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -359(%rbp), %rax
+    addq  $7, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -359(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -359(%rbp), %rax
+    addq  $9, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -359(%rbp), %rax
+    addq  $10, %rax
+    pushq %rax
+    movl  $71, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -359(%rbp), %rax
+    addq  $11, %rax
+    pushq %rax
+    movl  $114, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -359(%rbp), %rax
+    addq  $12, %rax
+    pushq %rax
+    movl  $101, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -359(%rbp), %rax
+    addq  $13, %rax
+    pushq %rax
+    movl  $101, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -359(%rbp), %rax
+    addq  $14, %rax
+    pushq %rax
+    movl  $110, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -359(%rbp), %rax
+    addq  $15, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -359(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -359(%rbp), %rax
+    addq  $17, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -359(%rbp), %rax
+    addq  $18, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -359(%rbp), %rax
+    addq  $19, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -359(%rbp), %rax
+    addq  $20, %rax
+    pushq %rax
+    movl  $66, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -359(%rbp), %rax
+    addq  $21, %rax
+    pushq %rax
+    movl  $108, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -359(%rbp), %rax
+    addq  $22, %rax
+    pushq %rax
+    movl  $117, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -359(%rbp), %rax
+    addq  $23, %rax
+    pushq %rax
+    movl  $101, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -359(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -359(%rbp), %rax
+    addq  $25, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -359(%rbp), %rax
+    addq  $26, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -359(%rbp), %rax
+    addq  $27, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -359(%rbp), %rax
+    addq  $28, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -359(%rbp), %rax
+    addq  $29, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+    subq  $16, %rsp
+    movl  $30, %eax
+    movl  %eax, 8(%rsp)
+    movl  $30, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $82, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -359(%rbp), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $101, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -359(%rbp), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $100, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -359(%rbp), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -359(%rbp), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -359(%rbp), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $4, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -359(%rbp), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $5, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -359(%rbp), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $6, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -359(%rbp), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $7, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -359(%rbp), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $8, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -359(%rbp), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $9, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $71, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -359(%rbp), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $114, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -359(%rbp), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $101, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -359(%rbp), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $101, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -359(%rbp), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $110, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -359(%rbp), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $4, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -359(%rbp), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $5, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -359(%rbp), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $6, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -359(%rbp), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $7, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -359(%rbp), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $8, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -359(%rbp), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $9, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $66, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -359(%rbp), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $108, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -359(%rbp), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $117, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -359(%rbp), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $101, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -359(%rbp), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -359(%rbp), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $4, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -359(%rbp), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $5, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -359(%rbp), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $6, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -359(%rbp), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $7, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -359(%rbp), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $8, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -359(%rbp), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $9, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -387(%rbp), %rax
+    pushq %rax
+    movl  $77, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -387(%rbp), %rax
+    addq  $1, %rax
+    pushq %rax
+    movl  $111, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -387(%rbp), %rax
+    addq  $2, %rax
+    pushq %rax
+    movl  $110, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -387(%rbp), %rax
+    addq  $3, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -387(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    movl  $84, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -387(%rbp), %rax
+    addq  $5, %rax
+    pushq %rax
+    movl  $117, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -387(%rbp), %rax
+    addq  $6, %rax
+    pushq %rax
+    movl  $101, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -387(%rbp), %rax
+    addq  $7, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -387(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $87, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -387(%rbp), %rax
+    addq  $9, %rax
+    pushq %rax
+    movl  $101, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -387(%rbp), %rax
+    addq  $10, %rax
+    pushq %rax
+    movl  $100, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -387(%rbp), %rax
+    addq  $11, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -387(%rbp), %rax
+    addq  $12, %rax
+    pushq %rax
+    movl  $84, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -387(%rbp), %rax
+    addq  $13, %rax
+    pushq %rax
+    movl  $104, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -387(%rbp), %rax
+    addq  $14, %rax
+    pushq %rax
+    movl  $117, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -387(%rbp), %rax
+    addq  $15, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -387(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movl  $70, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -387(%rbp), %rax
+    addq  $17, %rax
+    pushq %rax
+    movl  $114, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -387(%rbp), %rax
+    addq  $18, %rax
+    pushq %rax
+    movl  $105, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -387(%rbp), %rax
+    addq  $19, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -387(%rbp), %rax
+    addq  $20, %rax
+    pushq %rax
+    movl  $83, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -387(%rbp), %rax
+    addq  $21, %rax
+    pushq %rax
+    movl  $97, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -387(%rbp), %rax
+    addq  $22, %rax
+    pushq %rax
+    movl  $116, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -387(%rbp), %rax
+    addq  $23, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -387(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    movl  $83, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -387(%rbp), %rax
+    addq  $25, %rax
+    pushq %rax
+    movl  $117, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -387(%rbp), %rax
+    addq  $26, %rax
+    pushq %rax
+    movl  $110, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -387(%rbp), %rax
+    addq  $27, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+    subq  $16, %rsp
+    movl  $28, %eax
+    movl  %eax, 8(%rsp)
+    movl  $28, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $77, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -387(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $111, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -387(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $110, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -387(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -387(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $84, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -387(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $117, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -387(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $101, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -387(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -387(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $87, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -387(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $101, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -387(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $100, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -387(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -387(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $84, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -387(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $104, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -387(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $117, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -387(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -387(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $70, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -387(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $4, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $114, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -387(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $4, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $105, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -387(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $4, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -387(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $4, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $83, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -387(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $5, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $97, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -387(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $5, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $116, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -387(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $5, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -387(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $5, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $83, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -387(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $6, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $117, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -387(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $6, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $110, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -387(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $6, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -387(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $6, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    callq _test_single_array
+## local scalar init
+    leaq  -420(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -420(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -420(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -420(%rbp), %rax
+    addq  $12, %rax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -420(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -420(%rbp), %rax
+    addq  $20, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -420(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -420(%rbp), %rax
+    addq  $28, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+    subq  $16, %rsp
+    movl  $32, %eax
+    movl  %eax, 8(%rsp)
+    movl  $32, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -420(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -420(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $2, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -420(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $3, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -420(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -420(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $4, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -420(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $5, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -420(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $6, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -420(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $7, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -424(%rbp), %rax
+    pushq %rax
+    movl  $9, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $9, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  -424(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _array_to_pointer
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -440(%rbp), %rax
+    pushq %rax
+    movl  $11, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -440(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    movl  $22, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -440(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $33, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -440(%rbp), %rax
+    addq  $12, %rax
+    pushq %rax
+    movl  $44, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    leaq  -440(%rbp), %rax
+    addq  $0, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _count_up
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $12, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -440(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    leaq  -440(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _count_up
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $23, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -440(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -456(%rbp), %rax
+    pushq %rax
+    movl  $97, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -456(%rbp), %rax
+    addq  $1, %rax
+    pushq %rax
+    movl  $98, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -456(%rbp), %rax
+    addq  $2, %rax
+    pushq %rax
+    movl  $99, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -456(%rbp), %rax
+    addq  $3, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -456(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -456(%rbp), %rax
+    addq  $5, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -456(%rbp), %rax
+    addq  $6, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -456(%rbp), %rax
+    addq  $7, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -456(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $100, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -456(%rbp), %rax
+    addq  $9, %rax
+    pushq %rax
+    movl  $101, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -456(%rbp), %rax
+    addq  $10, %rax
+    pushq %rax
+    movl  $102, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -456(%rbp), %rax
+    addq  $11, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -456(%rbp), %rax
+    addq  $12, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -456(%rbp), %rax
+    addq  $13, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -456(%rbp), %rax
+    addq  $14, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -456(%rbp), %rax
+    addq  $15, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -464(%rbp), %rax
+    pushq %rax
+    leaq  -456(%rbp), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movl  $97, %eax
+    movl  %eax, 8(%rsp)
+    movq  -464(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $98, %eax
+    movl  %eax, 8(%rsp)
+    movq  -464(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $99, %eax
+    movl  %eax, 8(%rsp)
+    movq  -464(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    movl  $4, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    pushq %rax
+    leaq  -476(%rbp), %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $13, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $13, %eax
+    movl  %eax, 8(%rsp)
+    movl  $4, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    pushq %rax
+    leaq  -476(%rbp), %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    movl  $0, %eax
+    jmp   _LBB4_0
+_LBB4_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
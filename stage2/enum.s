@@ -0,0 +1,285 @@
+    .data
+
+    .text
+
+    .global _foo
+_foo:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movl  %edi, -4(%rbp)
+    movl  %esi, -8(%rbp)
+## func body
+    movl  -4(%rbp), %eax
+    jmp   _LBB0_0
+_LBB0_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _main
+_main:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+## func body
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movl  $1, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $2, %eax
+    movl  %eax, 8(%rsp)
+    movl  $2, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $10, %eax
+    movl  %eax, 8(%rsp)
+    movl  $10, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $11, %eax
+    movl  %eax, 8(%rsp)
+    movl  $11, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $12, %eax
+    movl  %eax, 8(%rsp)
+    movl  $12, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movl  $4, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movl  $4, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $10, %eax
+    movl  %eax, 8(%rsp)
+    movl  $10, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $11, %eax
+    movl  %eax, 8(%rsp)
+    movl  $11, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $21, %eax
+    movl  %eax, 8(%rsp)
+    movl  $21, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, 8(%rsp)
+    movl  $-1, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $9, %eax
+    movl  %eax, 8(%rsp)
+    movl  $9, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $5, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, 8(%rsp)
+    movl  $-5, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movl  $1, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -4(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $8, %eax
+    movl  %eax, 8(%rsp)
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  $2, %eax
+    pushq %rax
+    movl  -8(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    pushq %rax
+    movl  $3, %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $102, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $102, %eax
+    movl  %eax, 8(%rsp)
+    movl  -16(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $103, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $103, %eax
+    movl  %eax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $42, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movl  $42, %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _foo
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    movl  $0, %eax
+    jmp   _LBB1_0
+_LBB1_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
@@ -0,0 +1,4418 @@
+    .data
+
+    .global _X
+_X:
+    .long 8
+
+    .global _Y
+_Y:
+    .byte 0
+
+    .global _g_pt
+_g_pt:
+    .long 11
+    .long 59
+    .long 91
+
+    .global _g_line
+_g_line:
+    .long 11
+    .long 59
+    .long 91
+    .long 77
+    .long 0
+    .long 0
+
+    .global _g_someone
+_g_someone:
+    .long 1
+    .long 2
+    .long 0
+    .long 0
+    .long 11
+    .long 22
+    .long 0
+    .long 0
+
+    .global _x
+_x:
+    .long 0
+
+    .global _z
+_z:
+    .long 0
+
+_count_67:
+    .long 0
+
+_count_73:
+    .long 0
+
+    .global _ival
+_ival:
+    .long 42
+
+    .global _pval
+_pval:
+    .quad _ival
+
+    .global _g_a
+_g_a:
+    .long 11
+    .long 22
+    .long 44
+
+    .global _g_b
+_g_b:
+    .long 111
+    .long 222
+    .long 444
+    .long 555
+    .long 0
+    .long 0
+
+    .global _head
+_head:
+    .long 1
+    .zero 1
+    .zero 1
+    .zero 1
+    .zero 1
+    .quad 0
+
+    .global _verts
+_verts:
+    .quad 111
+    .quad 222
+    .quad 333
+    .quad 444
+    .quad 555
+    .quad 666
+    .quad 777
+    .quad 888
+    .quad 999
+
+    .global _data_spec_table
+_data_spec_table:
+    .quad _L_str_104
+    .quad _L_str_105
+    .quad _L_str_106
+    .quad _L_str_107
+    .quad _L_str_108
+    .quad _L_str_109
+    .quad _L_str_110
+    .quad _L_str_111
+
+    .global _A__
+_A__:
+    .quad _L_str_113
+    .quad _L_str_114
+    .quad _L_str_115
+    .quad _L_str_116
+
+    .global _str
+_str:
+    .quad _L_str_118
+
+    .global _p
+_p:
+    .quad 1
+
+    .global _SI__
+_SI__:
+    .quad _L_str_121
+    .quad _L_str_122
+    .quad _L_str_123
+    .quad _L_str_124
+
+    .global _DI__
+_DI__:
+    .quad _L_str_126
+    .quad _L_str_127
+    .quad _L_str_128
+    .quad _L_str_129
+
+_C___130:
+    .quad _L_str_131
+    .quad _L_str_132
+    .quad _L_str_133
+    .quad _L_str_134
+
+_D___135:
+    .quad _L_str_136
+    .quad _L_str_137
+    .quad _L_str_138
+    .quad _L_str_139
+
+    .global _ARG_REG__
+_ARG_REG__:
+    .quad _DI__
+    .quad _SI__
+    .quad _D___135
+    .quad _C___130
+
+    .global _first_name
+_first_name:
+    .byte 70
+    .byte 111
+    .byte 111
+    .byte 0
+
+    .global _last_name
+_last_name:
+    .byte 66
+    .byte 97
+    .byte 114
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+
+    .global _color_list
+_color_list:
+    .byte 82
+    .byte 101
+    .byte 100
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 71
+    .byte 114
+    .byte 101
+    .byte 101
+    .byte 110
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 66
+    .byte 108
+    .byte 117
+    .byte 101
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+
+    .global _days
+_days:
+    .byte 77
+    .byte 111
+    .byte 110
+    .byte 0
+    .byte 84
+    .byte 117
+    .byte 101
+    .byte 0
+    .byte 87
+    .byte 101
+    .byte 100
+    .byte 0
+    .byte 84
+    .byte 104
+    .byte 117
+    .byte 0
+    .byte 70
+    .byte 114
+    .byte 105
+    .byte 0
+    .byte 83
+    .byte 97
+    .byte 116
+    .byte 0
+    .byte 83
+    .byte 117
+    .byte 110
+    .byte 0
+
+    .global _bf1
+_bf1:
+    .long 8126391
+
+    .global _bf2
+_bf2:
+    .long 3293
+    .long 975245
+
+    .global _bf3
+_bf3:
+    .long 520
+    .long 1023
+    .long -23242
+
+    .text
+
+_L_str_104:
+    .asciz "b"
+
+_L_str_105:
+    .asciz "byte"
+
+_L_str_106:
+    .asciz "w"
+
+_L_str_107:
+    .asciz "word"
+
+_L_str_108:
+    .asciz "l"
+
+_L_str_109:
+    .asciz "long"
+
+_L_str_110:
+    .asciz "q"
+
+_L_str_111:
+    .asciz "quad"
+
+_L_str_113:
+    .asciz "al"
+
+_L_str_114:
+    .asciz "ax"
+
+_L_str_115:
+    .asciz "eax"
+
+_L_str_116:
+    .asciz "rax"
+
+_L_str_118:
+    .asciz "Hello"
+
+_L_str_121:
+    .asciz "sil"
+
+_L_str_122:
+    .asciz "si"
+
+_L_str_123:
+    .asciz "esi"
+
+_L_str_124:
+    .asciz "rsi"
+
+_L_str_126:
+    .asciz "dil"
+
+_L_str_127:
+    .asciz "di"
+
+_L_str_128:
+    .asciz "edi"
+
+_L_str_129:
+    .asciz "rdi"
+
+_L_str_131:
+    .asciz "cl"
+
+_L_str_132:
+    .asciz "cx"
+
+_L_str_133:
+    .asciz "ecx"
+
+_L_str_134:
+    .asciz "rcx"
+
+_L_str_136:
+    .asciz "dl"
+
+_L_str_137:
+    .asciz "dx"
+
+_L_str_138:
+    .asciz "edx"
+
+_L_str_139:
+    .asciz "rdx"
+
+    .global _num
+_num:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $0, %rsp
+## func params
+## func body
+    movl  _X(%rip), %eax
+    jmp   _LBB0_0
+_LBB0_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _add
+_add:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movl  %edi, -4(%rbp)
+    movl  %esi, -8(%rbp)
+## func body
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  -8(%rbp), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    jmp   _LBB1_0
+_LBB1_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_count_up:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $0, %rsp
+## func params
+## func body
+    leaq  _count_67(%rip), %rax
+    movl  (%rax), %edx
+    addl  $1, %edx
+    movl  %edx, (%rax)
+    movl  %edx, %eax
+    jmp   _LBB2_0
+_LBB2_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_count_up2:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $0, %rsp
+## func params
+## func body
+    leaq  _count_73(%rip), %rax
+    movl  (%rax), %edx
+    addl  $1, %edx
+    movl  %edx, (%rax)
+    movl  %edx, %eax
+    jmp   _LBB3_0
+_LBB3_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _main
+_main:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+## func body
+## local scalar init
+    leaq  -1(%rbp), %rax
+    pushq %rax
+    movl  $31, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -8(%rbp), %rax
+    pushq %rax
+    movl  $3, %eax
+    pushq %rax
+    movb  -1(%rbp), %al
+    movsbl %al, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $34, %eax
+    movl  %eax, 8(%rsp)
+    movl  -8(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $42, %eax
+    movl  %eax, 8(%rsp)
+    movl  -8(%rbp), %eax
+    pushq %rax
+    subq  $8, %rsp
+    callq _num
+    addq  $8, %rsp
+    popq  %rdx
+    addl  %edx, %eax
+    pushq %rax
+    movb  _Y(%rip), %al
+    movsbl %al, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    leaq  _x(%rip), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -24(%rbp), %rax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $3, %eax
+    movl  %eax, 8(%rsp)
+    movl  _x(%rip), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $39, %eax
+    movl  %eax, 16(%rsp)
+    movl  _x(%rip), %eax
+    movl  %eax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movl  8(%rsp), %esi
+    callq _add
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $42, %eax
+    movl  %eax, 8(%rsp)
+    movl  -12(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  _z(%rip), %rax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $42, %eax
+    movl  %eax, 8(%rsp)
+    movl  _z(%rip), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $45, %eax
+    movl  %eax, 8(%rsp)
+    movl  _z(%rip), %eax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  _g_count(%rip), %rax
+    pushq %rax
+    movl  $212, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $212, %eax
+    movl  %eax, 8(%rsp)
+    movl  _g_count(%rip), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _set_count
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    movl  _g_count(%rip), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    callq _count_up
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $2, %eax
+    movl  %eax, 8(%rsp)
+    callq _count_up
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $3, %eax
+    movl  %eax, 8(%rsp)
+    callq _count_up
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    callq _count_up
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $5, %eax
+    movl  %eax, 8(%rsp)
+    callq _count_up
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $6, %eax
+    movl  %eax, 8(%rsp)
+    callq _count_up
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    callq _count_up2
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $2, %eax
+    movl  %eax, 8(%rsp)
+    callq _count_up2
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $3, %eax
+    movl  %eax, 8(%rsp)
+    callq _count_up2
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    callq _count_up2
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $5, %eax
+    movl  %eax, 8(%rsp)
+    callq _count_up2
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $6, %eax
+    movl  %eax, 8(%rsp)
+    callq _count_up2
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $12, %eax
+    movl  %eax, 8(%rsp)
+    movl  $12, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $11, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _g_a(%rip), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $22, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _g_a(%rip), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $44, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _g_a(%rip), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $24, %eax
+    movl  %eax, 8(%rsp)
+    movl  $24, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $111, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _g_b(%rip), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $222, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _g_b(%rip), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $444, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _g_b(%rip), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $555, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _g_b(%rip), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _g_b(%rip), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _g_b(%rip), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $12, %eax
+    movl  %eax, 8(%rsp)
+    movl  $12, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $11, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _g_pt(%rip), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $59, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _g_pt(%rip), %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $91, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _g_pt(%rip), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $24, %eax
+    movl  %eax, 8(%rsp)
+    movl  $24, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $11, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _g_line(%rip), %rax
+    pushq %rax
+    movl  $12, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $59, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _g_line(%rip), %rax
+    pushq %rax
+    movl  $12, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $91, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _g_line(%rip), %rax
+    pushq %rax
+    movl  $12, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $77, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _g_line(%rip), %rax
+    pushq %rax
+    movl  $12, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _g_line(%rip), %rax
+    pushq %rax
+    movl  $12, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _g_line(%rip), %rax
+    pushq %rax
+    movl  $12, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $32, %eax
+    movl  %eax, 8(%rsp)
+    movl  $32, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _g_someone(%rip), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $2, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _g_someone(%rip), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _g_someone(%rip), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _g_someone(%rip), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $11, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _g_someone(%rip), %rax
+    addq  $16, %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $22, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _g_someone(%rip), %rax
+    addq  $16, %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _g_someone(%rip), %rax
+    addq  $16, %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _g_someone(%rip), %rax
+    addq  $16, %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movl  $4, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $8, %eax
+    movl  %eax, 8(%rsp)
+    movl  $8, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $42, %eax
+    movl  %eax, 8(%rsp)
+    movq  _pval(%rip), %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _head(%rip), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    leaq  _head(%rip), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _assertl
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $72, %eax
+    movl  %eax, 8(%rsp)
+    movl  $72, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $111, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _verts(%rip), %rax
+    pushq %rax
+    movl  $24, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $222, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _verts(%rip), %rax
+    pushq %rax
+    movl  $24, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $333, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _verts(%rip), %rax
+    pushq %rax
+    movl  $24, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $444, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _verts(%rip), %rax
+    pushq %rax
+    movl  $24, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $555, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _verts(%rip), %rax
+    pushq %rax
+    movl  $24, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $666, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _verts(%rip), %rax
+    pushq %rax
+    movl  $24, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $777, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _verts(%rip), %rax
+    pushq %rax
+    movl  $24, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $888, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _verts(%rip), %rax
+    pushq %rax
+    movl  $24, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $999, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _verts(%rip), %rax
+    pushq %rax
+    movl  $24, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    leaq  _verts(%rip), %rax
+    pushq %rax
+    movl  $24, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    movq  16(%rax), %r10
+    movq  %r10, 16(%rdx)
+    subq  $16, %rsp
+    movl  $777, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -48(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $888, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -48(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $999, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -48(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $64, %eax
+    movl  %eax, 8(%rsp)
+    movl  $64, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  _L_str_104(%rip), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _data_spec_table(%rip), %rax
+    pushq %rax
+    movl  $16, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  _L_str_105(%rip), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _data_spec_table(%rip), %rax
+    pushq %rax
+    movl  $16, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  _L_str_106(%rip), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _data_spec_table(%rip), %rax
+    pushq %rax
+    movl  $16, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  _L_str_107(%rip), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _data_spec_table(%rip), %rax
+    pushq %rax
+    movl  $16, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  _L_str_108(%rip), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _data_spec_table(%rip), %rax
+    pushq %rax
+    movl  $16, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  _L_str_109(%rip), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _data_spec_table(%rip), %rax
+    pushq %rax
+    movl  $16, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  _L_str_110(%rip), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _data_spec_table(%rip), %rax
+    pushq %rax
+    movl  $16, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  _L_str_111(%rip), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _data_spec_table(%rip), %rax
+    pushq %rax
+    movl  $16, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $32, %eax
+    movl  %eax, 8(%rsp)
+    movl  $32, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  _L_str_113(%rip), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _A__(%rip), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  _L_str_114(%rip), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _A__(%rip), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  _L_str_115(%rip), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _A__(%rip), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  _L_str_116(%rip), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _A__(%rip), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $8, %eax
+    movl  %eax, 8(%rsp)
+    movl  $8, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  _L_str_118(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  _str(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movq  _p(%rip), %rax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $32, %eax
+    movl  %eax, 8(%rsp)
+    movl  $32, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  _L_str_126(%rip), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _ARG_REG__(%rip), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  _L_str_127(%rip), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _ARG_REG__(%rip), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  _L_str_128(%rip), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _ARG_REG__(%rip), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  _L_str_129(%rip), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _ARG_REG__(%rip), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  _L_str_121(%rip), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _ARG_REG__(%rip), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  _L_str_122(%rip), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _ARG_REG__(%rip), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  _L_str_123(%rip), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _ARG_REG__(%rip), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  _L_str_124(%rip), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _ARG_REG__(%rip), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  _L_str_136(%rip), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _ARG_REG__(%rip), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  _L_str_137(%rip), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _ARG_REG__(%rip), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  _L_str_138(%rip), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _ARG_REG__(%rip), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  _L_str_139(%rip), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _ARG_REG__(%rip), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  _L_str_131(%rip), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _ARG_REG__(%rip), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  _L_str_132(%rip), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _ARG_REG__(%rip), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  _L_str_133(%rip), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _ARG_REG__(%rip), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  _L_str_134(%rip), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _ARG_REG__(%rip), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movl  $4, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $70, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _first_name(%rip), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $111, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _first_name(%rip), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $111, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _first_name(%rip), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _first_name(%rip), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $8, %eax
+    movl  %eax, 8(%rsp)
+    movl  $8, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $66, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _last_name(%rip), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $97, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _last_name(%rip), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $114, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _last_name(%rip), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _last_name(%rip), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _last_name(%rip), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $4, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _last_name(%rip), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $5, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _last_name(%rip), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $6, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _last_name(%rip), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $7, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $30, %eax
+    movl  %eax, 8(%rsp)
+    movl  $30, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $82, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _color_list(%rip), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $101, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _color_list(%rip), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $100, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _color_list(%rip), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _color_list(%rip), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _color_list(%rip), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $4, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _color_list(%rip), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $5, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _color_list(%rip), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $6, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _color_list(%rip), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $7, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _color_list(%rip), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $8, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _color_list(%rip), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $9, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $71, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _color_list(%rip), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $114, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _color_list(%rip), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $101, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _color_list(%rip), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $101, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _color_list(%rip), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $110, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _color_list(%rip), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $4, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _color_list(%rip), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $5, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _color_list(%rip), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $6, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _color_list(%rip), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $7, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _color_list(%rip), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $8, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _color_list(%rip), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $9, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $66, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _color_list(%rip), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $108, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _color_list(%rip), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $117, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _color_list(%rip), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $101, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _color_list(%rip), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _color_list(%rip), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $4, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _color_list(%rip), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $5, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _color_list(%rip), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $6, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _color_list(%rip), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $7, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _color_list(%rip), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $8, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _color_list(%rip), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $9, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $28, %eax
+    movl  %eax, 8(%rsp)
+    movl  $28, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $77, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _days(%rip), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $111, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _days(%rip), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $110, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _days(%rip), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _days(%rip), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $84, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _days(%rip), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $117, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _days(%rip), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $101, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _days(%rip), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _days(%rip), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $87, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _days(%rip), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $101, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _days(%rip), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $100, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _days(%rip), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _days(%rip), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $84, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _days(%rip), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $104, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _days(%rip), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $117, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _days(%rip), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _days(%rip), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $70, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _days(%rip), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $4, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $114, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _days(%rip), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $4, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $105, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _days(%rip), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $4, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _days(%rip), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $4, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $83, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _days(%rip), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $5, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $97, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _days(%rip), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $5, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $116, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _days(%rip), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $5, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _days(%rip), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $5, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $83, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _days(%rip), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $6, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $117, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _days(%rip), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $6, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $110, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _days(%rip), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $6, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _days(%rip), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $6, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movl  $4, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $8, %eax
+    movl  %eax, 8(%rsp)
+    movl  $8, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $73, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, 8(%rsp)
+    leaq  _bf1(%rip), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    shll  $19, %eax
+    sarl  $19, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $991, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _bf1(%rip), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    shll  $2, %eax
+    sarl  $15, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $803, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, 8(%rsp)
+    leaq  _bf2(%rip), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    shll  $21, %eax
+    sarl  $21, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $73331, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, 8(%rsp)
+    leaq  _bf2(%rip), %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    shll  $13, %eax
+    sarl  $13, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $12, %eax
+    movl  %eax, 8(%rsp)
+    movl  $12, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $520, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _bf3(%rip), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    shll  $22, %eax
+    shrl  $22, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $1023, %eax
+    movl  %eax, 8(%rsp)
+    leaq  _bf3(%rip), %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    shll  $22, %eax
+    shrl  $22, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $23242, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, 8(%rsp)
+    leaq  _bf3(%rip), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    movl  $0, %eax
+    jmp   _LBB4_0
+_LBB4_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
@@ -0,0 +1,289 @@
+    .data
+
+    .text
+
+    .global _add
+_add:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movl  %edi, -4(%rbp)
+    movl  %esi, -8(%rbp)
+## func body
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  -8(%rbp), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    jmp   _LBB0_0
+_LBB0_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _main
+_main:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+## func body
+## assign
+    leaq  -4(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $40, %eax
+    movl  %eax, 16(%rsp)
+    movl  $2, %eax
+    movl  %eax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movl  8(%rsp), %esi
+    callq _add
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $42, %eax
+    movl  %eax, 8(%rsp)
+    movl  -4(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -4(%rbp), %rax
+    pushq %rax
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  -8(%rbp), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $43, %eax
+    movl  %eax, 8(%rsp)
+    movl  -4(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -4(%rbp), %rax
+    pushq %rax
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $44, %eax
+    movl  %eax, 8(%rsp)
+    movl  -4(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -4(%rbp), %rax
+    pushq %rax
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  -16(%rbp), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $45, %eax
+    movl  %eax, 8(%rsp)
+    movl  -4(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -4(%rbp), %rax
+    pushq %rax
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  -20(%rbp), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $46, %eax
+    movl  %eax, 8(%rsp)
+    movl  -4(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $46, %eax
+    movl  %eax, 8(%rsp)
+    movl  -4(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $10, %eax
+    pushq %rax
+    movl  $11, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    pushq %rax
+    movl  $12, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    movl  $22, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $11, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    movl  %eax, 16(%rsp)
+    movl  $13, %eax
+    movl  %eax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movl  8(%rsp), %esi
+    callq _add
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -36(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $2, %eax
+    movl  %eax, 16(%rsp)
+    movl  $3, %eax
+    movl  %eax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movl  8(%rsp), %esi
+    callq _add
+    addq  $24, %rsp
+    pushq %rax
+    movl  $12, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $33, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $22, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $35, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $60, %eax
+    movl  %eax, 8(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    movl  $0, %eax
+    jmp   _LBB1_0
+_LBB1_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
@@ -0,0 +1,361 @@
+# 1 "macro.c"
+
+# 1 "test.h"
+
+
+
+void assert(int expected, int actual);
+void assertl(long expected, long actual);
+void assertf(float expected, float actual);
+void assertd(double expected, double actual);
+
+void set_count(int val);
+
+
+# 2 "macro.c"
+
+# 3 "macro.c"
+
+# 1 "once.h"
+
+
+ 
+struct once {
+    int value;
+};
+# 4 "macro.c"
+
+# 5 "macro.c"
+ 
+
+# 7 "macro.c"
+
+# 8 "macro.c"
+
+int strcmp(const char *s1, const char *s2);
+
+
+
+
+
+
+
+enum {
+    A = 123,
+    B = 456,
+    C = 789,
+    D = 111
+};
+ 
+
+
+
+
+
+ 
+
+
+
+ 
+
+
+
+ 
+
+
+ 
+
+
+
+
+ 
+
+
+ 
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+int main()
+{
+    {
+         
+        int a[8] = {11, 22, 33, 44};
+
+        assert(32, sizeof a);
+        assert(8, (sizeof a) / sizeof (a[0]));
+        assert(11, a[0]);
+        assert(22, a[1]);
+        assert(33, a[2]);
+        assert(44, a[3]);
+        assert(0,  a[4]);
+        assert(0,  a[5]);
+        assert(0,  a[6]);
+        assert(0,  a[7]);
+    }
+    {
+         
+        int x = ((39) + (3));
+        int y = 4;
+
+        assert(42, x);
+        assert(20, ((y++) * (y++)));
+        assert(6, y);
+        assert(5, 5);
+        assert(6, (5 + 1));
+    }
+    {
+         
+        assert(123, A);
+        assert(456, B);
+        assert(789, C);
+        assert(999, 999);
+    }
+    {
+         
+        int a = 42;
+
+        ;
+        ;
+
+        assert(42, a);
+    }
+    {
+        int a = ((7) + (7));
+
+        assert(14, a);
+        assert(49, ((7) * (7)));
+    }
+    {
+         
+        int a = 13;
+
+
+
+        a = 99;
+
+        assert(99, a);
+
+
+        a = -12223;
+
+
+
+
+
+        assert(-12223, a);
+    }
+    {
+        const char *s = "The comma operator has the lowest precedence of any C operator and acts as a sequence point";
+
+        assert(0, strcmp("The comma operator has the lowest precedence of any C operator and acts as a sequence point", s));
+    }
+    {
+         
+        int xy = 21;
+
+        assert(0, strcmp("a + b", "a + b"));
+        assert(0, strcmp("\"q\"", "\"q\""));
+        assert(21, xy);
+        assert(12, 12);
+        assert(42, xy * 2);
+    }
+    {
+         
+        const char *s = "a, b";
+        int a = ((1) + (2))
+;
+
+        assert(0, strcmp("a, b", s));
+        assert(3, a);
+        assert(7, ((3) + (4)));
+        assert(40, 40);
+    }
+    {
+         
+        struct once o = {42};
+
+        assert(42, o.value);
+    }
+    {
+         
+        int a = 19;
+
+
+
+        assert(19, a);
+    }
+    {
+         
+        int a = 7;
+
+
+
+
+
+
+
+
+
+
+        assert(7, a);
+    }
+    {
+         
+
+
+
+        int a = 3;
+
+
+
+
+        a += 1;
+        assert(4, a);
+    }
+
+    {
+         
+        int a = 0;
+
+        a += 1;
+
+
+        a += 2;
+
+
+
+
+
+        a += 4;
+
+
+        a += 8;
+
+        assert(15, a);
+    }
+    {
+         
+        int a = 0;
+
+        a += 1;
+
+
+        a += 2;
+
+
+        a += 4;
+
+        assert(7, a);
+    }
+    {
+         
+        int a = 0;
+
+
+        a += 1;
+
+
+
+
+        assert(1, a);
+    }
+    {
+         
+        int a = 0;
+
+
+
+        a = 2;
+
+
+
+
+
+        assert(2, a);
+
+
+
+
+
+
+
+
+
+        a = 8;
+
+
+        assert(8, a);
+
+
+        a = 9;
+
+
+
+        assert(9, a);
+    }
+
+    {
+         
+        int a, b, c;
+
+
+
+        int INNER = 3;
+        a = 1 + INNER + ((5) * 2);
+
+
+
+        b = 20 + 100 + ((5) * 2);
+
+
+        c = INNER;
+        assert(14, a);
+        assert(130, b);
+        assert(3, c);
+
+
+
+        assert(3, c);
+    }
+
+    return 0;
+}
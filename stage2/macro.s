@@ -0,0 +1,923 @@
+    .data
+
+    .text
+
+_L_str_61:
+    .asciz "The comma operator has the lowest precedence of any C operator and acts as a sequence point"
+
+_L_str_65:
+    .asciz "a + b"
+
+_L_str_66:
+    .asciz "\"q\""
+
+_L_str_70:
+    .asciz "a, b"
+
+    .global _main
+_main:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $144, %rsp
+## func params
+## func body
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $11, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    movl  $22, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $33, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    addq  $12, %rax
+    pushq %rax
+    movl  $44, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    addq  $20, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    addq  $28, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+    subq  $16, %rsp
+    movl  $32, %eax
+    movl  %eax, 8(%rsp)
+    movl  $32, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $8, %eax
+    movl  %eax, 8(%rsp)
+    movl  $32, %eax
+    pushq %rax
+    movl  $4, %eax
+    movl  %eax, %edi
+    popq  %rax
+    cltd
+    idivl %edi
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $11, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $22, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $33, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $44, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $4, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $5, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $6, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $7, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -36(%rbp), %rax
+    pushq %rax
+    movl  $39, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $42, %eax
+    movl  %eax, 8(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $20, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -40(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    pushq %rax
+    leaq  -40(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    popq  %rdx
+    imull %edx, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $6, %eax
+    movl  %eax, 8(%rsp)
+    movl  -40(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $5, %eax
+    movl  %eax, 8(%rsp)
+    movl  $5, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $6, %eax
+    movl  %eax, 8(%rsp)
+    movl  $5, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $123, %eax
+    movl  %eax, 8(%rsp)
+    movl  $123, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $456, %eax
+    movl  %eax, 8(%rsp)
+    movl  $456, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $789, %eax
+    movl  %eax, 8(%rsp)
+    movl  $789, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $999, %eax
+    movl  %eax, 8(%rsp)
+    movl  $999, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -44(%rbp), %rax
+    pushq %rax
+    movl  $42, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $42, %eax
+    movl  %eax, 8(%rsp)
+    movl  -44(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    movl  $7, %eax
+    pushq %rax
+    movl  $7, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $14, %eax
+    movl  %eax, 8(%rsp)
+    movl  -48(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $49, %eax
+    movl  %eax, 8(%rsp)
+    movl  $7, %eax
+    pushq %rax
+    movl  $7, %eax
+    popq  %rdx
+    imull %edx, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -52(%rbp), %rax
+    pushq %rax
+    movl  $13, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -52(%rbp), %rax
+    pushq %rax
+    movl  $99, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $99, %eax
+    movl  %eax, 8(%rsp)
+    movl  -52(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -52(%rbp), %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $12223, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $12223, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, 8(%rsp)
+    movl  -52(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -64(%rbp), %rax
+    pushq %rax
+    leaq  _L_str_61(%rip), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  _L_str_61(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -64(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -68(%rbp), %rax
+    pushq %rax
+    movl  $21, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  _L_str_65(%rip), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_65(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  _L_str_66(%rip), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_66(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $21, %eax
+    movl  %eax, 8(%rsp)
+    movl  -68(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $12, %eax
+    movl  %eax, 8(%rsp)
+    movl  $12, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $42, %eax
+    movl  %eax, 8(%rsp)
+    movl  -68(%rbp), %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -80(%rbp), %rax
+    pushq %rax
+    leaq  _L_str_70(%rip), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -84(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  _L_str_70(%rip), %rax
+    movq  %rax, 8(%rsp)
+    movq  -80(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $3, %eax
+    movl  %eax, 8(%rsp)
+    movl  -84(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $7, %eax
+    movl  %eax, 8(%rsp)
+    movl  $3, %eax
+    pushq %rax
+    movl  $4, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $40, %eax
+    movl  %eax, 8(%rsp)
+    movl  $40, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -88(%rbp), %rax
+    pushq %rax
+    movl  $42, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $42, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -88(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -92(%rbp), %rax
+    pushq %rax
+    movl  $19, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    movl  -92(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -96(%rbp), %rax
+    pushq %rax
+    movl  $7, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $7, %eax
+    movl  %eax, 8(%rsp)
+    movl  -96(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -100(%rbp), %rax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## add-assign
+    leaq  -100(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    addl  %eax, (%rdx)
+    movl  (%rdx), %eax
+    subq  $16, %rsp
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movl  -100(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -104(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## add-assign
+    leaq  -104(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    addl  %eax, (%rdx)
+    movl  (%rdx), %eax
+## add-assign
+    leaq  -104(%rbp), %rax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    addl  %eax, (%rdx)
+    movl  (%rdx), %eax
+## add-assign
+    leaq  -104(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    popq  %rdx
+    addl  %eax, (%rdx)
+    movl  (%rdx), %eax
+## add-assign
+    leaq  -104(%rbp), %rax
+    pushq %rax
+    movl  $8, %eax
+    popq  %rdx
+    addl  %eax, (%rdx)
+    movl  (%rdx), %eax
+    subq  $16, %rsp
+    movl  $15, %eax
+    movl  %eax, 8(%rsp)
+    movl  -104(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -108(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## add-assign
+    leaq  -108(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    addl  %eax, (%rdx)
+    movl  (%rdx), %eax
+## add-assign
+    leaq  -108(%rbp), %rax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    addl  %eax, (%rdx)
+    movl  (%rdx), %eax
+## add-assign
+    leaq  -108(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    popq  %rdx
+    addl  %eax, (%rdx)
+    movl  (%rdx), %eax
+    subq  $16, %rsp
+    movl  $7, %eax
+    movl  %eax, 8(%rsp)
+    movl  -108(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -112(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## add-assign
+    leaq  -112(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    addl  %eax, (%rdx)
+    movl  (%rdx), %eax
+    subq  $16, %rsp
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movl  -112(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -116(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -116(%rbp), %rax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $2, %eax
+    movl  %eax, 8(%rsp)
+    movl  -116(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -116(%rbp), %rax
+    pushq %rax
+    movl  $8, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $8, %eax
+    movl  %eax, 8(%rsp)
+    movl  -116(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -116(%rbp), %rax
+    pushq %rax
+    movl  $9, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $9, %eax
+    movl  %eax, 8(%rsp)
+    movl  -116(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -132(%rbp), %rax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -120(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  -132(%rbp), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    pushq %rax
+    movl  $5, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -124(%rbp), %rax
+    pushq %rax
+    movl  $20, %eax
+    pushq %rax
+    movl  $100, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    pushq %rax
+    movl  $5, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -128(%rbp), %rax
+    pushq %rax
+    movl  -132(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $14, %eax
+    movl  %eax, 8(%rsp)
+    movl  -120(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $130, %eax
+    movl  %eax, 8(%rsp)
+    movl  -124(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $3, %eax
+    movl  %eax, 8(%rsp)
+    movl  -128(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $3, %eax
+    movl  %eax, 8(%rsp)
+    movl  -128(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    movl  $0, %eax
+    jmp   _LBB0_0
+_LBB0_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
@@ -0,0 +1,6 @@
+#pragma once
+
+/* redefinition error if included twice */
+struct once {
+    int value;
+};
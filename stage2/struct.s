@@ -0,0 +1,3633 @@
+    .data
+
+    .text
+
+    .global _getx
+_getx:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    jmp   _LBB0_0
+_LBB0_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _gety
+_gety:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+    movq  -8(%rbp), %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    jmp   _LBB1_0
+_LBB1_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _getx_
+_getx_:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+    leaq  -8(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    jmp   _LBB2_0
+_LBB2_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _gety_
+_gety_:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+    leaq  -8(%rbp), %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    jmp   _LBB3_0
+_LBB3_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _add_point
+_add_point:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movq  %rdx, -24(%rbp)
+## func body
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+_LBB4_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _get_point
+_get_point:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+## func body
+## local scalar init
+    leaq  -8(%rbp), %rax
+    pushq %rax
+    movl  $71, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -8(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    movl  $92, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    movq  -8(%rbp), %rax
+    jmp   _LBB5_0
+_LBB5_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _add
+_add:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movl  %edi, -4(%rbp)
+    movl  %esi, -8(%rbp)
+## func body
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  -8(%rbp), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    jmp   _LBB6_0
+_LBB6_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _get_x3
+_get_x3:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rbp, %r10
+    subq  $12, %r10
+    movq  %rdi, (%r10)
+    movl  %esi, 8(%r10)
+## func body
+    leaq  -12(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    jmp   _LBB7_0
+_LBB7_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _get_y3
+_get_y3:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rbp, %r10
+    subq  $12, %r10
+    movq  %rdi, (%r10)
+    movl  %esi, 8(%r10)
+## func body
+    leaq  -12(%rbp), %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    jmp   _LBB8_0
+_LBB8_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _get_z3
+_get_z3:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rbp, %r10
+    subq  $12, %r10
+    movq  %rdi, (%r10)
+    movl  %esi, 8(%r10)
+## func body
+    leaq  -12(%rbp), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    jmp   _LBB9_0
+_LBB9_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _get_vec
+_get_vec:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+## func body
+## local scalar init
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    movl  $1301, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -12(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    movl  $223922, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -12(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $3973, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    leaq  -12(%rbp), %rax
+    movq  %rax, %rsi
+    movq  (%rsi), %rax
+    movq  8(%rsi), %rdx
+    jmp   _LBB10_0
+_LBB10_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _copy_vec
+_copy_vec:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## if-cond
+    movq  -8(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB14_2
+    movq  -16(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB14_2
+    movl  $0, %eax
+_LBB14_2:
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB13_2
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB13_2
+    movl  $0, %eax
+_LBB13_2:
+    cmpl  $0, %eax
+    je    _LBB12_3
+## if-then
+    jmp   _LBB11_0
+    jmp   _LBB12_2
+## if-else
+_LBB12_3:
+_LBB12_2:
+## assign
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movl  8(%rax), %r10d
+    movl  %r10d, 8(%rdx)
+_LBB11_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _get_w4
+_get_w4:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rbp, %r10
+    subq  $16, %r10
+    movq  %rdi, (%r10)
+    movq  %rsi, 8(%r10)
+## func body
+    leaq  -16(%rbp), %rax
+    addq  $12, %rax
+    movl  (%rax), %eax
+    jmp   _LBB15_0
+_LBB15_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _coord_x
+_coord_x:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rbp, %rax
+    addq  $16, %rax
+    movq  (%rax), %r10
+    movq  %r10, -24(%rbp)
+    movq  8(%rax), %r10
+    movq  %r10, -16(%rbp)
+    movq  16(%rax), %r10
+    movq  %r10, -8(%rbp)
+## func body
+    leaq  -24(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    jmp   _LBB16_0
+_LBB16_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _coord_y
+_coord_y:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rbp, %rax
+    addq  $16, %rax
+    movq  (%rax), %r10
+    movq  %r10, -24(%rbp)
+    movq  8(%rax), %r10
+    movq  %r10, -16(%rbp)
+    movq  16(%rax), %r10
+    movq  %r10, -8(%rbp)
+## func body
+    leaq  -24(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    jmp   _LBB17_0
+_LBB17_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _coord_z
+_coord_z:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rbp, %rax
+    addq  $16, %rax
+    movq  (%rax), %r10
+    movq  %r10, -24(%rbp)
+    movq  8(%rax), %r10
+    movq  %r10, -16(%rbp)
+    movq  16(%rax), %r10
+    movq  %r10, -8(%rbp)
+## func body
+    leaq  -24(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    jmp   _LBB18_0
+_LBB18_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _get_coord
+_get_coord:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+## save address to returning value
+    pushq %rdi
+## func body
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $72340, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -24(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1230889, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -24(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movl  $91355, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    leaq  -24(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    movq  16(%rax), %r10
+    movq  %r10, 16(%rdx)
+    movq  %rdx, %rax
+    jmp   _LBB19_0
+_LBB19_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _make_rgb
+_make_rgb:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movb  %dil, -1(%rbp)
+    movb  %sil, -2(%rbp)
+    movb  %dl, -3(%rbp)
+## func body
+## assign
+    leaq  -6(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movb  -1(%rbp), %al
+    popq  %rdx
+    movb  %al, (%rdx)
+## assign
+    leaq  -6(%rbp), %rax
+    addq  $1, %rax
+    pushq %rax
+    movb  -2(%rbp), %al
+    popq  %rdx
+    movb  %al, (%rdx)
+## assign
+    leaq  -6(%rbp), %rax
+    addq  $2, %rax
+    pushq %rax
+    movb  -3(%rbp), %al
+    popq  %rdx
+    movb  %al, (%rdx)
+    movzwl -6(%rbp), %r11d
+    movzbl -4(%rbp), %r10d
+    shlq  $16, %r10
+    orq   %r10, %r11
+    movq  %r11, %rax
+    jmp   _LBB20_0
+_LBB20_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _sum_rgb
+_sum_rgb:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, %r11
+    movw  %r11w, -3(%rbp)
+    shrq  $16, %r11
+    movb  %r11b, -1(%rbp)
+## func body
+    leaq  -3(%rbp), %rax
+    addq  $0, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    pushq %rax
+    leaq  -3(%rbp), %rax
+    addq  $1, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    pushq %rax
+    leaq  -3(%rbp), %rax
+    addq  $2, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    jmp   _LBB21_0
+_LBB21_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _sum_seven
+_sum_seven:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, %r11
+    movl  %r11d, -7(%rbp)
+    shrq  $32, %r11
+    movw  %r11w, -3(%rbp)
+    shrq  $16, %r11
+    movb  %r11b, -1(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-pre
+## assign
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB23_1:
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $7, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB23_2
+## for-body
+## add-assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    leaq  -7(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    popq  %rdx
+    addl  %eax, (%rdx)
+    movl  (%rdx), %eax
+## for-post
+_LBB23_4:
+    leaq  -12(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB23_1
+_LBB23_2:
+    movl  -16(%rbp), %eax
+    jmp   _LBB22_0
+_LBB22_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _sum_eleven
+_sum_eleven:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rbp, %r10
+    subq  $11, %r10
+    movq  %rdi, (%r10)
+    movq  %rsi, %r11
+    movw  %r11w, 8(%r10)
+    shrq  $16, %r11
+    movb  %r11b, 10(%r10)
+## func body
+## local scalar init
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-pre
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB25_1:
+    movl  -16(%rbp), %eax
+    pushq %rax
+    movl  $11, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB25_2
+## for-body
+## add-assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    leaq  -11(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  -16(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    popq  %rdx
+    addl  %eax, (%rdx)
+    movl  (%rdx), %eax
+## for-post
+_LBB25_4:
+    leaq  -16(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB25_1
+_LBB25_2:
+    movl  -20(%rbp), %eax
+    jmp   _LBB24_0
+_LBB24_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _main
+_main:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $736, %rsp
+## func params
+## func body
+## assign
+    leaq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $39, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $39, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -8(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    leaq  -8(%rbp), %rax
+    addq  $4, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $3, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -8(%rbp), %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $42, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -8(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    leaq  -8(%rbp), %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    leaq  -24(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -32(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $9, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $9, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -24(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    movq  -32(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $3, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -24(%rbp), %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $12, %eax
+    movl  %eax, 8(%rsp)
+    movq  -32(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $8, %eax
+    movl  %eax, 8(%rsp)
+    movl  $8, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $8, %eax
+    movl  %eax, 8(%rsp)
+    movl  $8, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $8, %eax
+    movl  %eax, 8(%rsp)
+    movl  $8, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movl  $4, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $8, %eax
+    movl  %eax, 8(%rsp)
+    movl  $8, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -44(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $121, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -56(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    movl  $111, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $121, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -44(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $111, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -56(%rbp), %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $10, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -44(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    leaq  -56(%rbp), %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    movl  %eax, %edx
+    popq  %rax
+    subl  %edx, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $12, %eax
+    movl  %eax, 8(%rsp)
+    movl  $12, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -92(%rbp), %rax
+    pushq %rax
+    movl  $12, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $4, %rax
+    pushq %rax
+    movl  $142, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -92(%rbp), %rax
+    pushq %rax
+    movl  $12, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $42, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $142, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -92(%rbp), %rax
+    pushq %rax
+    movl  $12, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $42, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -92(%rbp), %rax
+    pushq %rax
+    movl  $12, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -128(%rbp), %rax
+    pushq %rax
+    leaq  -116(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -104(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $123, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -116(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    movl  $23, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $123, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -104(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $23, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -116(%rbp), %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    movq  -128(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $31, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -128(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $91, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $31, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -116(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $91, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -116(%rbp), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -144(%rbp), %rax
+    addq  $0, %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $19, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -144(%rbp), %rax
+    addq  $8, %rax
+    addq  $4, %rax
+    pushq %rax
+    movl  $23, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -144(%rbp), %rax
+    addq  $0, %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $23, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -144(%rbp), %rax
+    addq  $8, %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $42, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -144(%rbp), %rax
+    addq  $0, %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    leaq  -144(%rbp), %rax
+    addq  $8, %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -160(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $123, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -176(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $765, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -192(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $999, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -160(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    leaq  -176(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -176(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    leaq  -192(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -192(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movl  $123, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -160(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $765, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -160(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $999, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -160(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $999, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -176(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -208(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $123, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -224(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $765, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -240(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $999, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -208(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    leaq  -224(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -224(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    leaq  -240(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -240(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movl  $123, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -208(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $765, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -208(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $999, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -208(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $999, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -224(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -248(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $111, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -248(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    movl  $19, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $111, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -248(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -248(%rbp), %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $130, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -248(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    leaq  -248(%rbp), %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -260(%rbp), %rax
+    pushq %rax
+    movl  $11, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -260(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    movl  $22, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -260(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $33, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $11, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -260(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $22, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -260(%rbp), %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $33, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -260(%rbp), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -272(%rbp), %rax
+    pushq %rax
+    movl  $19, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -272(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -272(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+    subq  $16, %rsp
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -272(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -272(%rbp), %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -272(%rbp), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -284(%rbp), %rax
+    pushq %rax
+    movl  $19, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -284(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $40, %eax
+    movl  %eax, 16(%rsp)
+    movl  $2, %eax
+    movl  %eax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movl  8(%rsp), %esi
+    callq _add
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -284(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $11, %eax
+    pushq %rax
+    movl  $12, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    pushq %rax
+    movl  $13, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -284(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $42, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -284(%rbp), %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $36, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -284(%rbp), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $8, %eax
+    movl  %eax, 8(%rsp)
+    movl  $8, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -292(%rbp), %rax
+    pushq %rax
+    movl  $29, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -292(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    movl  $31, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $8, %eax
+    movl  %eax, 8(%rsp)
+    movl  $8, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $29, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -292(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $31, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -292(%rbp), %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -300(%rbp), %rax
+    pushq %rax
+    movl  $42, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -300(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    movl  $71, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -308(%rbp), %rax
+    pushq %rax
+    movl  $13, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -308(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    movl  $49, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $42, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  -300(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _getx
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $42, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -300(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $49, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  -308(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _gety
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $32, %rsp
+    leaq  -316(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  -300(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    leaq  -308(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _add_point
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movl  $55, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  -316(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _getx
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $120, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  -316(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _gety
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -332(%rbp), %rax
+    pushq %rax
+    movl  $11, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -332(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    movl  $22, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -332(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $33, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -332(%rbp), %rax
+    addq  $12, %rax
+    pushq %rax
+    movl  $44, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -348(%rbp), %rax
+    pushq %rax
+    leaq  -332(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    subq  $16, %rsp
+    movl  $11, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -348(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $22, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -348(%rbp), %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $33, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -348(%rbp), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $44, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -348(%rbp), %rax
+    addq  $12, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -364(%rbp), %rax
+    pushq %rax
+    movl  $111, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -364(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    movl  $222, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -364(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $333, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -364(%rbp), %rax
+    addq  $12, %rax
+    pushq %rax
+    movl  $444, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -380(%rbp), %rax
+    pushq %rax
+    leaq  -364(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    subq  $16, %rsp
+    movl  $111, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -380(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $222, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -380(%rbp), %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $333, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -380(%rbp), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $444, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -380(%rbp), %rax
+    addq  $12, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -388(%rbp), %rax
+    pushq %rax
+    movl  $14, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -388(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    movl  $17, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $14, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -388(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _getx_
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $14, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -388(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $17, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -388(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _gety_
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $17, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -388(%rbp), %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -400(%rbp), %rax
+    pushq %rax
+    movl  $41, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -400(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    movl  $71, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -400(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $94, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -416(%rbp), %rax
+    pushq %rax
+    movl  $731, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -416(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    movl  $811, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -416(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $39, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -416(%rbp), %rax
+    addq  $12, %rax
+    pushq %rax
+    movl  $234, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $41, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  -400(%rbp), %rax
+    movq  (%rax), %r10
+    movq  %r10, (%rsp)
+    movl  8(%rax), %r10d
+    movl  %r10d, 8(%rsp)
+    movq  (%rsp), %rdi
+    movl  8(%rsp), %esi
+    callq _get_x3
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $41, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -400(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $71, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  -400(%rbp), %rax
+    movq  (%rax), %r10
+    movq  %r10, (%rsp)
+    movl  8(%rax), %r10d
+    movl  %r10d, 8(%rsp)
+    movq  (%rsp), %rdi
+    movl  8(%rsp), %esi
+    callq _get_y3
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $71, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -400(%rbp), %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $94, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  -400(%rbp), %rax
+    movq  (%rax), %r10
+    movq  %r10, (%rsp)
+    movl  8(%rax), %r10d
+    movl  %r10d, 8(%rsp)
+    movq  (%rsp), %rdi
+    movl  8(%rsp), %esi
+    callq _get_z3
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $94, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -400(%rbp), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $234, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  -416(%rbp), %rax
+    movq  (%rax), %r10
+    movq  %r10, (%rsp)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rsp)
+    movq  (%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _get_w4
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $234, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -416(%rbp), %rax
+    addq  $12, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -440(%rbp), %rax
+    pushq %rax
+    movl  $111, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -440(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $222, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -440(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movl  $199, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movl  $111, %eax
+    movl  %eax, 8(%rsp)
+    subq  $32, %rsp
+    leaq  -440(%rbp), %rax
+    movq  (%rax), %r10
+    movq  %r10, (%rsp)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rsp)
+    movq  16(%rax), %r10
+    movq  %r10, 16(%rsp)
+    callq _coord_x
+    addq  $32, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $111, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -440(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $222, %eax
+    movl  %eax, 8(%rsp)
+    subq  $32, %rsp
+    leaq  -440(%rbp), %rax
+    movq  (%rax), %r10
+    movq  %r10, (%rsp)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rsp)
+    movq  16(%rax), %r10
+    movq  %r10, 16(%rsp)
+    callq _coord_y
+    addq  $32, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $222, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -440(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $199, %eax
+    movl  %eax, 8(%rsp)
+    subq  $32, %rsp
+    leaq  -440(%rbp), %rax
+    movq  (%rax), %r10
+    movq  %r10, (%rsp)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rsp)
+    movq  16(%rax), %r10
+    movq  %r10, 16(%rsp)
+    callq _coord_z
+    addq  $32, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $199, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -440(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -448(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    callq _get_point
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movl  $71, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -448(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $92, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -448(%rbp), %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -460(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    callq _get_vec
+    addq  $8, %rsp
+    movq  %rax, -736(%rbp)
+    movq  %rdx, -728(%rbp)
+    leaq  -736(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movl  8(%rax), %r10d
+    movl  %r10d, 8(%rdx)
+    subq  $16, %rsp
+    movl  $1301, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -460(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $223922, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -460(%rbp), %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $3973, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, 8(%rsp)
+    leaq  -460(%rbp), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -488(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    leaq  -736(%rbp), %rdi
+    callq _get_coord
+    addq  $8, %rsp
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    movq  16(%rax), %r10
+    movq  %r10, 16(%rdx)
+    subq  $16, %rsp
+    movl  $72340, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -488(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1230889, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, 8(%rsp)
+    leaq  -488(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $91355, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -488(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -500(%rbp), %rax
+    pushq %rax
+    movl  $911, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -500(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    movl  $822, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -500(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $733, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    leaq  -512(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  -500(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _copy_vec
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $911, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -512(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $822, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -512(%rbp), %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $733, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -512(%rbp), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -528(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $123, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $123, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -528(%rbp), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movl  $1, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $2, %eax
+    movl  %eax, 8(%rsp)
+    movl  $2, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movl  $4, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movl  $4, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $8, %eax
+    movl  %eax, 8(%rsp)
+    movl  $8, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $12, %eax
+    movl  %eax, 8(%rsp)
+    movl  $12, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $8, %eax
+    movl  %eax, 8(%rsp)
+    movl  $8, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $16, %eax
+    movl  %eax, 8(%rsp)
+    movl  $16, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $2, %eax
+    movl  %eax, 8(%rsp)
+    movl  $2, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $24, %eax
+    movl  %eax, 8(%rsp)
+    movl  $24, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movl  $4, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $12, %eax
+    movl  %eax, 8(%rsp)
+    movl  $12, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $8, %eax
+    movl  %eax, 8(%rsp)
+    movl  $8, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movl  $4, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movl  $4, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -588(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $11, %eax
+    popq  %rdx
+## bit field
+    movl  %eax, %ecx
+    movl  %ecx, %r10d
+    shll  $0, %ecx
+    movl  (%rdx), %eax
+    andl  $-32, %eax
+    orl   %ecx, %eax
+    movl  %eax, (%rdx)
+    movl  %r10d, %eax
+## assign
+    leaq  -588(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $12, %eax
+    popq  %rdx
+## bit field
+    movl  %eax, %ecx
+    movl  %ecx, %r10d
+    shll  $5, %ecx
+    movl  (%rdx), %eax
+    andl  $-2017, %eax
+    orl   %ecx, %eax
+    movl  %eax, (%rdx)
+    movl  %r10d, %eax
+## assign
+    leaq  -588(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $13, %eax
+    popq  %rdx
+## bit field
+    movl  %eax, %ecx
+    movl  %ecx, %r10d
+    shll  $11, %ecx
+    movl  (%rdx), %eax
+    andl  $-260097, %eax
+    orl   %ecx, %eax
+    movl  %eax, (%rdx)
+    movl  %r10d, %eax
+## assign
+    leaq  -588(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $14, %eax
+    popq  %rdx
+## bit field
+    movl  %eax, %ecx
+    movl  %ecx, %r10d
+    shll  $18, %ecx
+    movl  (%rdx), %eax
+    andl  $-66846721, %eax
+    orl   %ecx, %eax
+    movl  %eax, (%rdx)
+    movl  %r10d, %eax
+## assign
+    leaq  -588(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $15, %eax
+    popq  %rdx
+## bit field
+    movl  %eax, %ecx
+    movl  %ecx, %r10d
+    shll  $26, %ecx
+    movl  (%rdx), %eax
+    andl  $67108863, %eax
+    orl   %ecx, %eax
+    movl  %eax, (%rdx)
+    movl  %r10d, %eax
+    subq  $16, %rsp
+    movl  $11, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -588(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    shll  $27, %eax
+    sarl  $27, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $12, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -588(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    shll  $21, %eax
+    sarl  $26, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $13, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -588(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    shll  $14, %eax
+    sarl  $25, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $14, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -588(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    shll  $6, %eax
+    sarl  $24, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $15, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -588(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    shll  $0, %eax
+    sarl  $26, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movl  $4, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -592(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $1023, %eax
+    popq  %rdx
+## bit field
+    movl  %eax, %ecx
+    movl  %ecx, %r10d
+    shll  $0, %ecx
+    movl  (%rdx), %eax
+    andl  $-1024, %eax
+    orl   %ecx, %eax
+    movl  %eax, (%rdx)
+    movl  %r10d, %eax
+## assign
+    leaq  -592(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $1023, %eax
+    popq  %rdx
+## bit field
+    movl  %eax, %ecx
+    movl  %ecx, %r10d
+    shll  $10, %ecx
+    movl  (%rdx), %eax
+    andl  $-1047553, %eax
+    orl   %ecx, %eax
+    movl  %eax, (%rdx)
+    movl  %r10d, %eax
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, 8(%rsp)
+    leaq  -592(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    shll  $22, %eax
+    sarl  $22, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $1023, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -592(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    shll  $12, %eax
+    shrl  $22, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movl  $4, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $8, %eax
+    movl  %eax, 8(%rsp)
+    movl  $8, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -596(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $123, %eax
+    popq  %rdx
+## bit field
+    movl  %eax, %ecx
+    movl  %ecx, %r10d
+    shll  $0, %ecx
+    movl  (%rdx), %eax
+    andl  $-1024, %eax
+    orl   %ecx, %eax
+    movl  %eax, (%rdx)
+    movl  %r10d, %eax
+## assign
+    leaq  -596(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $456, %eax
+    popq  %rdx
+## bit field
+    movl  %eax, %ecx
+    movl  %ecx, %r10d
+    shll  $10, %ecx
+    movl  (%rdx), %eax
+    andl  $-1047553, %eax
+    orl   %ecx, %eax
+    movl  %eax, (%rdx)
+    movl  %r10d, %eax
+    subq  $16, %rsp
+    movl  $123, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -596(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    shll  $22, %eax
+    sarl  $22, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $456, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -596(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    shll  $12, %eax
+    sarl  $22, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -604(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $73, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+## bit field
+    movl  %eax, %ecx
+    movl  %ecx, %r10d
+    shll  $0, %ecx
+    movl  (%rdx), %eax
+    andl  $-1024, %eax
+    orl   %ecx, %eax
+    movl  %eax, (%rdx)
+    movl  %r10d, %eax
+## assign
+    leaq  -604(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $31, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+## bit field
+    movl  %eax, %ecx
+    movl  %ecx, %r10d
+    shll  $0, %ecx
+    movl  (%rdx), %eax
+    andl  $-1024, %eax
+    orl   %ecx, %eax
+    movl  %eax, (%rdx)
+    movl  %r10d, %eax
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $73, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, 8(%rsp)
+    leaq  -604(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    shll  $22, %eax
+    sarl  $22, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $31, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, 8(%rsp)
+    leaq  -604(%rbp), %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    shll  $22, %eax
+    sarl  $22, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local bit init
+    leaq  -608(%rbp), %rax
+    movl  $0, %ecx
+    movl  %ecx, (%rax)
+    leaq  -608(%rbp), %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $111, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+## assign bit field
+    movl  %eax, %ecx
+    movl  %ecx, %r10d
+    shll  $0, %ecx
+    movl  (%rdx), %eax
+    andl  $-8192, %eax
+    orl   %ecx, %eax
+    movl  %eax, (%rdx)
+    movl  %r10d, %eax
+    leaq  -608(%rbp), %rax
+    pushq %rax
+    movl  $239, %eax
+    popq  %rdx
+## assign bit field
+    movl  %eax, %ecx
+    movl  %ecx, %r10d
+    shll  $13, %ecx
+    movl  (%rdx), %eax
+    andl  $-1073733633, %eax
+    orl   %ecx, %eax
+    movl  %eax, (%rdx)
+    movl  %r10d, %eax
+## local bit init
+    leaq  -616(%rbp), %rax
+    movl  $0, %ecx
+    movl  %ecx, (%rax)
+    leaq  -616(%rbp), %rax
+    pushq %rax
+    movl  $301, %eax
+    popq  %rdx
+## assign bit field
+    movl  %eax, %ecx
+    movl  %ecx, %r10d
+    shll  $0, %ecx
+    movl  (%rdx), %eax
+    andl  $-8192, %eax
+    orl   %ecx, %eax
+    movl  %eax, (%rdx)
+    movl  %r10d, %eax
+## local bit init
+    leaq  -616(%rbp), %rax
+    addq  $4, %rax
+    movl  $0, %ecx
+    movl  %ecx, (%rax)
+    leaq  -616(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $11230, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+## assign bit field
+    movl  %eax, %ecx
+    movl  %ecx, %r10d
+    shll  $0, %ecx
+    movl  (%rdx), %eax
+    andl  $-131072, %eax
+    orl   %ecx, %eax
+    movl  %eax, (%rdx)
+    movl  %r10d, %eax
+    subq  $16, %rsp
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movl  $4, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $8, %eax
+    movl  %eax, 8(%rsp)
+    movl  $8, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $111, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, 8(%rsp)
+    leaq  -608(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    shll  $19, %eax
+    sarl  $19, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $239, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -608(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    shll  $2, %eax
+    sarl  $15, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $301, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -616(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    shll  $19, %eax
+    sarl  $19, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $11230, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, 8(%rsp)
+    leaq  -616(%rbp), %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    shll  $15, %eax
+    sarl  $15, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local bit init
+    leaq  -628(%rbp), %rax
+    movl  $0, %ecx
+    movl  %ecx, (%rax)
+    leaq  -628(%rbp), %rax
+    pushq %rax
+    movl  $520, %eax
+    popq  %rdx
+## assign bit field
+    movl  %eax, %ecx
+    movl  %ecx, %r10d
+    shll  $0, %ecx
+    movl  (%rdx), %eax
+    andl  $-1024, %eax
+    orl   %ecx, %eax
+    movl  %eax, (%rdx)
+    movl  %r10d, %eax
+## local bit init
+    leaq  -628(%rbp), %rax
+    addq  $4, %rax
+    movl  $0, %ecx
+    movl  %ecx, (%rax)
+    leaq  -628(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    movl  $1023, %eax
+    popq  %rdx
+## assign bit field
+    movl  %eax, %ecx
+    movl  %ecx, %r10d
+    shll  $0, %ecx
+    movl  (%rdx), %eax
+    andl  $-1024, %eax
+    orl   %ecx, %eax
+    movl  %eax, (%rdx)
+    movl  %r10d, %eax
+## local scalar init
+    leaq  -628(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $23242, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $12, %eax
+    movl  %eax, 8(%rsp)
+    movl  $12, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $520, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -628(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    shll  $22, %eax
+    shrl  $22, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $1023, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -628(%rbp), %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    shll  $22, %eax
+    shrl  $22, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $23242, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, 8(%rsp)
+    leaq  -628(%rbp), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -640(%rbp), %rax
+    pushq %rax
+    movl  $19, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -636(%rbp), %rax
+    addq  $0, %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $7, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -636(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    movl  $23, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -644(%rbp), %rax
+    pushq %rax
+    leaq  -636(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movl  $4, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $7, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -644(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    movl  -640(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -671(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $1, %eax
+    movb  %al, 16(%rsp)
+    movl  $2, %eax
+    movb  %al, 8(%rsp)
+    movl  $3, %eax
+    movb  %al, (%rsp)
+    movb  16(%rsp), %dil
+    movb  8(%rsp), %sil
+    movb  (%rsp), %dl
+    callq _make_rgb
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, %r11
+    movw  %r11w, (%rdx)
+    shrq  $16, %r11
+    movb  %r11b, 2(%rdx)
+## for-pre
+## assign
+    leaq  -696(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB27_1:
+    movl  -696(%rbp), %eax
+    pushq %rax
+    movl  $7, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB27_2
+## for-body
+## assign
+    leaq  -678(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  -696(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  -696(%rbp), %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## for-post
+_LBB27_4:
+    leaq  -696(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB27_1
+_LBB27_2:
+## for-pre
+## assign
+    leaq  -696(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB28_1:
+    movl  -696(%rbp), %eax
+    pushq %rax
+    movl  $11, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB28_2
+## for-body
+## assign
+    leaq  -689(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  -696(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  -696(%rbp), %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## for-post
+_LBB28_4:
+    leaq  -696(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB28_1
+_LBB28_2:
+## assign
+    leaq  -668(%rbp), %rax
+    addq  $3, %rax
+    pushq %rax
+    movl  $41, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## assign
+    leaq  -668(%rbp), %rax
+    addq  $11, %rax
+    pushq %rax
+    movl  $42, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## assign
+    leaq  -668(%rbp), %rax
+    addq  $23, %rax
+    pushq %rax
+    movl  $43, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## assign
+    leaq  -668(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movzwl -671(%rbp), %r11d
+    movzbl -669(%rbp), %r10d
+    shlq  $16, %r10
+    orq   %r10, %r11
+    movq  %r11, %rax
+    popq  %rdx
+    movq  %rax, %r11
+    movw  %r11w, (%rdx)
+    shrq  $16, %r11
+    movb  %r11b, 2(%rdx)
+## assign
+    leaq  -668(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    movl  -678(%rbp), %r11d
+    movzwl -674(%rbp), %r10d
+    shlq  $32, %r10
+    orq   %r10, %r11
+    movzbl -672(%rbp), %r10d
+    shlq  $48, %r10
+    orq   %r10, %r11
+    movq  %r11, %rax
+    popq  %rdx
+    movq  %rax, %r11
+    movl  %r11d, (%rdx)
+    shrq  $32, %r11
+    movw  %r11w, 4(%rdx)
+    shrq  $16, %r11
+    movb  %r11b, 6(%rdx)
+## assign
+    leaq  -668(%rbp), %rax
+    addq  $12, %rax
+    pushq %rax
+    leaq  -689(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movw  8(%rax), %r10w
+    movw  %r10w, 8(%rdx)
+    movb  10(%rax), %r10b
+    movb  %r10b, 10(%rdx)
+    subq  $16, %rsp
+    movl  $3, %eax
+    movl  %eax, 8(%rsp)
+    movl  $3, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $41, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -668(%rbp), %rax
+    addq  $3, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $42, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -668(%rbp), %rax
+    addq  $11, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $43, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -668(%rbp), %rax
+    addq  $23, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $3, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -668(%rbp), %rax
+    addq  $0, %rax
+    addq  $2, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $7, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -668(%rbp), %rax
+    addq  $4, %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $6, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $11, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -668(%rbp), %rax
+    addq  $12, %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $10, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -671(%rbp), %rax
+    pushq %rax
+    leaq  -668(%rbp), %rax
+    addq  $0, %rax
+    movzwl (%rax), %r11d
+    movzbl 2(%rax), %r10d
+    shlq  $16, %r10
+    orq   %r10, %r11
+    movq  %r11, %rax
+    popq  %rdx
+    movq  %rax, %r11
+    movw  %r11w, (%rdx)
+    shrq  $16, %r11
+    movb  %r11b, 2(%rdx)
+    subq  $16, %rsp
+    movl  $6, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movzwl -671(%rbp), %r11d
+    movzbl -669(%rbp), %r10d
+    shlq  $16, %r10
+    orq   %r10, %r11
+    movq  %r11, %rax
+    movq  %rax, %r11
+    movw  %r11w, 8(%rsp)
+    shrq  $16, %r11
+    movb  %r11b, 10(%rsp)
+    movq  8(%rsp), %rdi
+    callq _sum_rgb
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $6, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  -668(%rbp), %rax
+    addq  $0, %rax
+    movzwl (%rax), %r11d
+    movzbl 2(%rax), %r10d
+    shlq  $16, %r10
+    orq   %r10, %r11
+    movq  %r11, %rax
+    movq  %rax, %r11
+    movw  %r11w, 8(%rsp)
+    shrq  $16, %r11
+    movb  %r11b, 10(%rsp)
+    movq  8(%rsp), %rdi
+    callq _sum_rgb
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $28, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  -668(%rbp), %rax
+    addq  $4, %rax
+    movl  (%rax), %r11d
+    movzwl 4(%rax), %r10d
+    shlq  $32, %r10
+    orq   %r10, %r11
+    movzbl 6(%rax), %r10d
+    shlq  $48, %r10
+    orq   %r10, %r11
+    movq  %r11, %rax
+    movq  %rax, %r11
+    movl  %r11d, 8(%rsp)
+    shrq  $32, %r11
+    movw  %r11w, 12(%rsp)
+    shrq  $16, %r11
+    movb  %r11b, 14(%rsp)
+    movq  8(%rsp), %rdi
+    callq _sum_seven
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $66, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  -668(%rbp), %rax
+    addq  $12, %rax
+    movq  (%rax), %r10
+    movq  %r10, (%rsp)
+    movw  8(%rax), %r10w
+    movw  %r10w, 8(%rsp)
+    movb  10(%rax), %r10b
+    movb  %r10b, 10(%rsp)
+    movq  (%rsp), %rdi
+    movl  8(%rsp), %esi
+    callq _sum_eleven
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $15, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    subq  $32, %rsp
+    movl  $4, %eax
+    movb  %al, 24(%rsp)
+    movl  $5, %eax
+    movb  %al, 16(%rsp)
+    movl  $6, %eax
+    movb  %al, 8(%rsp)
+    movb  24(%rsp), %dil
+    movb  16(%rsp), %sil
+    movb  8(%rsp), %dl
+    callq _make_rgb
+    addq  $32, %rsp
+    movq  %rax, %r11
+    movw  %r11w, 8(%rsp)
+    shrq  $16, %r11
+    movb  %r11b, 10(%rsp)
+    movq  8(%rsp), %rdi
+    callq _sum_rgb
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    movl  $0, %eax
+    jmp   _LBB26_0
+_LBB26_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
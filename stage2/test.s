@@ -0,0 +1,263 @@
+    .data
+
+    .global _g_count
+_g_count:
+    .long 0
+
+    .text
+
+_L_str_48:
+    .asciz "error: expected: %d actual: %d\012"
+
+_L_str_58:
+    .asciz "error: expected: %ld actual: %ld\012"
+
+_L_str_69:
+    .asciz "error: expected: %f actual: %f\012"
+
+_L_fp_67:
+    .quad 4517329193108106637
+
+    .global _assert
+_assert:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movl  %edi, -4(%rbp)
+    movl  %esi, -8(%rbp)
+## func body
+## if-cond
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  -8(%rbp), %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB1_3
+## if-then
+    subq  $32, %rsp
+    leaq  _L_str_48(%rip), %rax
+    movq  %rax, 24(%rsp)
+    movl  -4(%rbp), %eax
+    movl  %eax, 16(%rsp)
+    movl  -8(%rbp), %eax
+    movl  %eax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movl  16(%rsp), %esi
+    movl  8(%rsp), %edx
+    movb  $0, %al
+    callq _printf
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _exit
+    addq  $16, %rsp
+    jmp   _LBB1_2
+## if-else
+_LBB1_3:
+_LBB1_2:
+_LBB0_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _assertl
+_assertl:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## if-cond
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB3_3
+## if-then
+    subq  $32, %rsp
+    leaq  _L_str_58(%rip), %rax
+    movq  %rax, 24(%rsp)
+    movq  -8(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _printf
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _exit
+    addq  $16, %rsp
+    jmp   _LBB3_2
+## if-else
+_LBB3_3:
+_LBB3_2:
+_LBB2_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _assertf
+_assertf:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movss %xmm0, -4(%rbp)
+    movss %xmm1, -8(%rbp)
+## func body
+## if-cond
+    subq  $16, %rsp
+    movss -4(%rbp), %xmm0
+    subq  $8, %rsp
+    movss %xmm0, (%rsp)
+    movss -8(%rbp), %xmm0
+    movss %xmm0, %xmm1
+    movss (%rsp), %xmm0
+    addq  $8, %rsp
+    subss %xmm1, %xmm0
+    movss %xmm0, 8(%rsp)
+    movss 8(%rsp), %xmm0
+    callq _fabsf
+    addq  $16, %rsp
+    cvtss2sd %xmm0, %xmm0
+    subq  $8, %rsp
+    movsd %xmm0, (%rsp)
+    movsd _L_fp_67(%rip), %xmm0
+    movsd %xmm0, %xmm1
+    movsd (%rsp), %xmm0
+    addq  $8, %rsp
+    ucomisd %xmm0, %xmm1
+    setb  %al
+    andb  $1, %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB5_3
+## if-then
+    subq  $32, %rsp
+    leaq  _L_str_69(%rip), %rax
+    movq  %rax, 24(%rsp)
+    movss -4(%rbp), %xmm0
+    cvtss2sd %xmm0, %xmm0
+    movsd %xmm0, 16(%rsp)
+    movss -8(%rbp), %xmm0
+    cvtss2sd %xmm0, %xmm0
+    movsd %xmm0, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movsd 16(%rsp), %xmm0
+    movsd 8(%rsp), %xmm1
+    movb  $2, %al
+    callq _printf
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _exit
+    addq  $16, %rsp
+    jmp   _LBB5_2
+## if-else
+_LBB5_3:
+_LBB5_2:
+_LBB4_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _assertd
+_assertd:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movsd %xmm0, -8(%rbp)
+    movsd %xmm1, -16(%rbp)
+## func body
+## if-cond
+    subq  $16, %rsp
+    movsd -8(%rbp), %xmm0
+    subq  $8, %rsp
+    movsd %xmm0, (%rsp)
+    movsd -16(%rbp), %xmm0
+    movsd %xmm0, %xmm1
+    movsd (%rsp), %xmm0
+    addq  $8, %rsp
+    subsd %xmm1, %xmm0
+    cvtsd2ss %xmm0, %xmm0
+    movss %xmm0, 8(%rsp)
+    movss 8(%rsp), %xmm0
+    callq _fabsf
+    addq  $16, %rsp
+    cvtss2sd %xmm0, %xmm0
+    subq  $8, %rsp
+    movsd %xmm0, (%rsp)
+    movsd _L_fp_67(%rip), %xmm0
+    movsd %xmm0, %xmm1
+    movsd (%rsp), %xmm0
+    addq  $8, %rsp
+    ucomisd %xmm0, %xmm1
+    setb  %al
+    andb  $1, %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB7_3
+## if-then
+    subq  $32, %rsp
+    leaq  _L_str_69(%rip), %rax
+    movq  %rax, 24(%rsp)
+    movsd -8(%rbp), %xmm0
+    movsd %xmm0, 16(%rsp)
+    movsd -16(%rbp), %xmm0
+    movsd %xmm0, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movsd 16(%rsp), %xmm0
+    movsd 8(%rsp), %xmm1
+    movb  $2, %al
+    callq _printf
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _exit
+    addq  $16, %rsp
+    jmp   _LBB7_2
+## if-else
+_LBB7_3:
+_LBB7_2:
+_LBB6_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _set_count
+_set_count:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movl  %edi, -4(%rbp)
+## func body
+## assign
+    leaq  _g_count(%rip), %rax
+    pushq %rax
+    movl  -4(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+_LBB8_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
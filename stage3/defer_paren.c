@@ -0,0 +1,2 @@
+static int f(int x) { return (x + 1; }
+int main(void) { return 0; }
@@ -0,0 +1,2870 @@
+    .data
+
+    .text
+
+    .global _num
+_num:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+## func body
+## assign
+    leaq  -4(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    movl  -4(%rbp), %eax
+    jmp   _LBB0_0
+_LBB0_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _add
+_add:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movl  %edi, -4(%rbp)
+    movl  %esi, -8(%rbp)
+## func body
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  -8(%rbp), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    jmp   _LBB1_0
+_LBB1_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _ptrcmp
+_ptrcmp:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    sete  %al
+    movzbl %al, %eax
+    jmp   _LBB2_0
+_LBB2_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _main
+_main:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $272, %rsp
+## func params
+## func body
+## assign
+    leaq  -4(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $40, %eax
+    movl  %eax, 16(%rsp)
+    movl  $2, %eax
+    movl  %eax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movl  8(%rsp), %esi
+    callq _add
+    addq  $24, %rsp
+    pushq %rax
+    movl  $2, %eax
+    pushq %rax
+    subq  $8, %rsp
+    callq _num
+    addq  $8, %rsp
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $44, %eax
+    movl  %eax, 8(%rsp)
+    movl  -4(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $23, %eax
+    movl  %eax, 8(%rsp)
+    movl  $21, %eax
+    pushq %rax
+    movl  $2, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    pushq %rax
+    movl  $8, %eax
+    pushq %rax
+    movl  $2, %eax
+    movl  %eax, %edi
+    popq  %rax
+    cltd
+    idivl %edi
+    movl  %eax, %edx
+    popq  %rax
+    subl  %edx, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -8(%rbp), %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## add-assign
+    leaq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    addl  %eax, (%rdx)
+    movl  (%rdx), %eax
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -8(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movl  -8(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $42, %eax
+    movl  %eax, 8(%rsp)
+## add-assign
+    leaq  -8(%rbp), %rax
+    pushq %rax
+    movl  $41, %eax
+    popq  %rdx
+    addl  %eax, (%rdx)
+    movl  (%rdx), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## sub-assign
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    subl  %eax, (%rdx)
+    movl  (%rdx), %eax
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $2, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, 8(%rsp)
+    leaq  -12(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, 8(%rsp)
+    movl  -12(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $42, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, 8(%rsp)
+## sub-assign
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    movl  $41, %eax
+    popq  %rdx
+    subl  %eax, (%rdx)
+    movl  (%rdx), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $12, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## mul-assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    popq  %rdx
+    imull (%rdx), %eax
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $48, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -16(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $49, %eax
+    movl  %eax, 8(%rsp)
+    movl  -16(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $98, %eax
+    movl  %eax, 8(%rsp)
+## mul-assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull (%rdx), %eax
+    movl  %eax, (%rdx)
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $12, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## div-assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    movl  %eax, %edi
+    popq  %rsi
+    movl  (%rsi), %eax
+    cltd
+    idivl %edi
+    movl  %eax, (%rsi)
+    subq  $16, %rsp
+    movl  $3, %eax
+    movl  %eax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+## div-assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $3, %eax
+    movl  %eax, %edi
+    popq  %rsi
+    movl  (%rsi), %eax
+    cltd
+    idivl %edi
+    movl  %eax, (%rsi)
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $3, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -36(%rbp), %rax
+    pushq %rax
+    movl  $7, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## shl-assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $40, %eax
+    movslq %eax, %rax
+    movq  %rax, %rcx
+    popq  %rdx
+    movq  (%rdx), %rax
+    shlq  %cl, %rax
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movq  -32(%rbp), %rax
+    pushq %rax
+    movl  $3, %eax
+    movslq %eax, %rax
+    movq  %rax, %rdi
+    popq  %rax
+    cqto
+    idivq %rdi
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    pushq %rax
+    movl  $40, %eax
+    movq  %rax, %rcx
+    popq  %rax
+    shlq  %cl, %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    sete  %al
+    movzbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## div-assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $3, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movq  %rax, %rdi
+    popq  %rsi
+    movq  (%rsi), %rax
+    cqto
+    idivq %rdi
+    movq  %rax, (%rsi)
+    subq  $16, %rsp
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movq  -32(%rbp), %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    pushq %rax
+    movl  $40, %eax
+    movq  %rax, %rcx
+    popq  %rax
+    shlq  %cl, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    sete  %al
+    movzbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movq  -32(%rbp), %rax
+    pushq %rax
+    movl  $1024, %eax
+    movslq %eax, %rax
+    movq  %rax, %rdi
+    popq  %rax
+    cqto
+    idivq %rdi
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    pushq %rax
+    movl  $30, %eax
+    movq  %rax, %rcx
+    popq  %rax
+    shlq  %cl, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    sete  %al
+    movzbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -36(%rbp), %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  -36(%rbp), %eax
+    movl  %eax, %eax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movl  -36(%rbp), %eax
+    pushq %rax
+    movl  $2, %eax
+    movl  %eax, %edi
+    popq  %rax
+    xorl  %edx, %edx
+    divl  %edi
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setg  %al
+    movzbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## div-assign
+    leaq  -36(%rbp), %rax
+    pushq %rax
+    movl  $3, %eax
+    movl  %eax, %edi
+    popq  %rsi
+    movl  (%rsi), %eax
+    xorl  %edx, %edx
+    divl  %edi
+    movl  %eax, (%rsi)
+    subq  $16, %rsp
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movl  -36(%rbp), %eax
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setg  %al
+    movzbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movl  $7, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -44(%rbp), %rax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movl  -40(%rbp), %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB4_2
+    movl  -44(%rbp), %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB4_2
+    movl  $1, %eax
+_LBB4_2:
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -44(%rbp), %rax
+    pushq %rax
+    movl  $6, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    movl  -40(%rbp), %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB5_2
+    movl  -44(%rbp), %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB5_2
+    movl  $1, %eax
+_LBB5_2:
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movl  $9, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -44(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    movl  -40(%rbp), %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB6_2
+    movl  -44(%rbp), %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB6_2
+    movl  $1, %eax
+_LBB6_2:
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -44(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    movl  -40(%rbp), %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB7_2
+    movl  -44(%rbp), %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB7_2
+    movl  $1, %eax
+_LBB7_2:
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movl  $7, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -44(%rbp), %rax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movl  -40(%rbp), %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB8_2
+    movl  -44(%rbp), %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB8_2
+    movl  $0, %eax
+_LBB8_2:
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -44(%rbp), %rax
+    pushq %rax
+    movl  $6, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movl  -40(%rbp), %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB9_2
+    movl  -44(%rbp), %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB9_2
+    movl  $0, %eax
+_LBB9_2:
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movl  $8, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -44(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movl  -40(%rbp), %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB10_2
+    movl  -44(%rbp), %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB10_2
+    movl  $0, %eax
+_LBB10_2:
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -44(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    movl  -40(%rbp), %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB11_2
+    movl  -44(%rbp), %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB11_2
+    movl  $0, %eax
+_LBB11_2:
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -52(%rbp), %rax
+    pushq %rax
+    movl  $7, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    movl  -48(%rbp), %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB12_2
+    leaq  -52(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB12_2
+    movl  $1, %eax
+_LBB12_2:
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    movl  -56(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $7, %eax
+    movl  %eax, 8(%rsp)
+    movl  -52(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    movl  -48(%rbp), %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB13_2
+    leaq  -52(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB13_2
+    movl  $1, %eax
+_LBB13_2:
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movl  -56(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $8, %eax
+    movl  %eax, 8(%rsp)
+    movl  -52(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -60(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -64(%rbp), %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $12, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -68(%rbp), %rax
+    pushq %rax
+    movl  -60(%rbp), %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB14_2
+    leaq  -64(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB14_2
+    movl  $0, %eax
+_LBB14_2:
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movl  -68(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $11, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, 8(%rsp)
+    movl  -64(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -60(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -68(%rbp), %rax
+    pushq %rax
+    movl  -60(%rbp), %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB15_2
+    leaq  -64(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB15_2
+    movl  $0, %eax
+_LBB15_2:
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movl  -68(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $11, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, 8(%rsp)
+    movl  -64(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -72(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -76(%rbp), %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $12, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -80(%rbp), %rax
+    pushq %rax
+    movl  -72(%rbp), %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB16_2
+    leaq  -76(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB16_2
+    movl  $0, %eax
+_LBB16_2:
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    movl  -80(%rbp), %eax
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -72(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -80(%rbp), %rax
+    pushq %rax
+    movl  -72(%rbp), %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB17_2
+    leaq  -76(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB17_2
+    movl  $0, %eax
+_LBB17_2:
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    movl  -80(%rbp), %eax
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -84(%rbp), %rax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $111, %eax
+    movl  %eax, 8(%rsp)
+## cond-?
+    movl  -84(%rbp), %eax
+    pushq %rax
+    movl  $10, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB18_3
+## cond-then
+    movl  $111, %eax
+    jmp   _LBB18_2
+## cond-else
+_LBB18_3:
+## cond-?
+    movl  -84(%rbp), %eax
+    pushq %rax
+    movl  $50, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB19_3
+## cond-then
+    movl  $1111, %eax
+    jmp   _LBB19_2
+## cond-else
+_LBB19_3:
+    movl  $19, %eax
+_LBB19_2:
+_LBB18_2:
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -84(%rbp), %rax
+    pushq %rax
+    movl  $52, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $1111, %eax
+    movl  %eax, 8(%rsp)
+## cond-?
+    movl  -84(%rbp), %eax
+    pushq %rax
+    movl  $10, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB20_3
+## cond-then
+    movl  $111, %eax
+    jmp   _LBB20_2
+## cond-else
+_LBB20_3:
+## cond-?
+    movl  -84(%rbp), %eax
+    pushq %rax
+    movl  $50, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB21_3
+## cond-then
+    movl  $1111, %eax
+    jmp   _LBB21_2
+## cond-else
+_LBB21_3:
+    movl  $19, %eax
+_LBB21_2:
+_LBB20_2:
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -84(%rbp), %rax
+    pushq %rax
+    movl  $23, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+## cond-?
+    movl  -84(%rbp), %eax
+    pushq %rax
+    movl  $10, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB22_3
+## cond-then
+    movl  $111, %eax
+    jmp   _LBB22_2
+## cond-else
+_LBB22_3:
+## cond-?
+    movl  -84(%rbp), %eax
+    pushq %rax
+    movl  $50, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB23_3
+## cond-then
+    movl  $1111, %eax
+    jmp   _LBB23_2
+## cond-else
+_LBB23_3:
+    movl  $19, %eax
+_LBB23_2:
+_LBB22_2:
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+## cond-?
+    movl  -84(%rbp), %eax
+    pushq %rax
+    movl  $10, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB24_3
+## cond-then
+    movl  $0, %eax
+    jmp   _LBB24_2
+## cond-else
+_LBB24_3:
+    movl  $1, %eax
+_LBB24_2:
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+## cond-?
+    movl  $0, %eax
+    cmpl  $0, %eax
+    je    _LBB25_3
+## cond-then
+    movl  $0, %eax
+    jmp   _LBB25_2
+## cond-else
+_LBB25_3:
+    movl  $1, %eax
+_LBB25_2:
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+## cond-?
+    movl  $3, %eax
+    cmpl  $0, %eax
+    je    _LBB26_3
+## cond-then
+    movl  $0, %eax
+    jmp   _LBB26_2
+## cond-else
+_LBB26_3:
+    movl  $1, %eax
+_LBB26_2:
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -85(%rbp), %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    movb  %al, (%rdx)
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, 8(%rsp)
+    movb  -85(%rbp), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -85(%rbp), %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $2, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    movb  %al, (%rdx)
+## assign
+    leaq  -88(%rbp), %rax
+    pushq %rax
+    movb  -85(%rbp), %al
+    movsbw %al, %ax
+    popq  %rdx
+    movw  %ax, (%rdx)
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $2, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, 8(%rsp)
+    movw  -88(%rbp), %ax
+    movswq %ax, %rax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -85(%rbp), %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $4, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    movb  %al, (%rdx)
+## assign
+    leaq  -92(%rbp), %rax
+    pushq %rax
+    movb  -85(%rbp), %al
+    movsbl %al, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $4, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, 8(%rsp)
+    movl  -92(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -85(%rbp), %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $8, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    movb  %al, (%rdx)
+## assign
+    leaq  -104(%rbp), %rax
+    pushq %rax
+    movb  -85(%rbp), %al
+    movsbq %al, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $8, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, 8(%rsp)
+    movq  -104(%rbp), %rax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -108(%rbp), %rax
+    pushq %rax
+    movl  $12321, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -109(%rbp), %rax
+    pushq %rax
+    movl  $34, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+    subq  $16, %rsp
+    movl  $13, %eax
+    movl  %eax, 8(%rsp)
+    movl  -108(%rbp), %eax
+    pushq %rax
+    movb  -109(%rbp), %al
+    movsbl %al, %eax
+    movl  %eax, %edi
+    popq  %rax
+    cltd
+    idivl %edi
+    movl  %edx, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -108(%rbp), %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $123534, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -109(%rbp), %rax
+    pushq %rax
+    movl  $37, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $28, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, 8(%rsp)
+    movl  -108(%rbp), %eax
+    pushq %rax
+    movb  -109(%rbp), %al
+    movsbl %al, %eax
+    movl  %eax, %edi
+    popq  %rax
+    cltd
+    idivl %edi
+    movl  %edx, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -112(%rbp), %rax
+    pushq %rax
+    movl  $1219, %eax
+    popq  %rdx
+    movw  %ax, (%rdx)
+## local scalar init
+    leaq  -113(%rbp), %rax
+    pushq %rax
+    movl  $233, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+    subq  $16, %rsp
+    movl  $54, %eax
+    movl  %eax, 8(%rsp)
+    movw  -112(%rbp), %ax
+    movswq %ax, %rax
+    pushq %rax
+    movb  -113(%rbp), %al
+    movzbl %al, %eax
+    movl  %eax, %edi
+    popq  %rax
+    cltd
+    idivl %edi
+    movl  %edx, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -128(%rbp), %rax
+    pushq %rax
+    movq  $233334012321, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -130(%rbp), %rax
+    pushq %rax
+    movl  $2334, %eax
+    popq  %rdx
+    movw  %ax, (%rdx)
+    subq  $16, %rsp
+    movl  $1503, %eax
+    movl  %eax, 8(%rsp)
+    movq  -128(%rbp), %rax
+    pushq %rax
+    movw  -130(%rbp), %ax
+    movzwq %ax, %rax
+    movslq %eax, %rax
+    movq  %rax, %rdi
+    popq  %rax
+    cqto
+    idivq %rdi
+    movq  %rdx, %rax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -128(%rbp), %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movq  $123534233349, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -130(%rbp), %rax
+    pushq %rax
+    movl  $337, %eax
+    popq  %rdx
+    movw  %ax, (%rdx)
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $124, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, 8(%rsp)
+    movq  -128(%rbp), %rax
+    pushq %rax
+    movw  -130(%rbp), %ax
+    movzwq %ax, %rax
+    movslq %eax, %rax
+    movq  %rax, %rdi
+    popq  %rax
+    cqto
+    idivq %rdi
+    movq  %rdx, %rax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -136(%rbp), %rax
+    pushq %rax
+    movl  $15, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -140(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## mod-assign
+    leaq  -136(%rbp), %rax
+    pushq %rax
+    movl  -140(%rbp), %eax
+    movl  %eax, %edi
+    popq  %rsi
+    movl  (%rsi), %eax
+    cltd
+    idivl %edi
+    movl  %edx, %eax
+    movl  %eax, (%rsi)
+    subq  $16, %rsp
+    movl  $3, %eax
+    movl  %eax, 8(%rsp)
+    movl  -136(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -136(%rbp), %rax
+    pushq %rax
+    movl  $24145, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -140(%rbp), %rax
+    pushq %rax
+    movl  $1233, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## mod-assign
+    leaq  -136(%rbp), %rax
+    pushq %rax
+    movl  -140(%rbp), %eax
+    movl  %eax, %edi
+    popq  %rsi
+    movl  (%rsi), %eax
+    cltd
+    idivl %edi
+    movl  %edx, %eax
+    movl  %eax, (%rsi)
+    subq  $16, %rsp
+    movl  $718, %eax
+    movl  %eax, 8(%rsp)
+    movl  -136(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -152(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -156(%rbp), %rax
+    pushq %rax
+    movq  -152(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movl  -156(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movq  -152(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB27_2
+    movl  $1, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB27_2
+    movl  $1, %eax
+_LBB27_2:
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -160(%rbp), %rax
+    pushq %rax
+    movl  $1321, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -168(%rbp), %rax
+    pushq %rax
+    leaq  -160(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -176(%rbp), %rax
+    pushq %rax
+    leaq  -160(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -168(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  -176(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _ptrcmp
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $1321, %eax
+    movl  %eax, 8(%rsp)
+    movq  -168(%rbp), %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $1321, %eax
+    movl  %eax, 8(%rsp)
+    movq  -176(%rbp), %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -180(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -184(%rbp), %rax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -180(%rbp), %rax
+    pushq %rax
+    movl  -180(%rbp), %eax
+    pushq %rax
+    movl  $2, %eax
+    movl  %eax, %ecx
+    popq  %rax
+    shll  %cl, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movl  -180(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -180(%rbp), %rax
+    pushq %rax
+    movl  -180(%rbp), %eax
+    pushq %rax
+    movl  $4, %eax
+    movl  %eax, %ecx
+    popq  %rax
+    shll  %cl, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $64, %eax
+    movl  %eax, 8(%rsp)
+    movl  -180(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -180(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  -184(%rbp), %eax
+    movl  %eax, %ecx
+    popq  %rax
+    shll  %cl, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $8, %eax
+    movl  %eax, 8(%rsp)
+    movl  -180(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## shl-assign
+    leaq  -180(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    movl  %eax, %ecx
+    popq  %rdx
+    movl  (%rdx), %eax
+    shll  %cl, %eax
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $128, %eax
+    movl  %eax, 8(%rsp)
+    movl  -180(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## shl-assign
+    leaq  -180(%rbp), %rax
+    pushq %rax
+    movl  -184(%rbp), %eax
+    movl  %eax, %ecx
+    popq  %rdx
+    movl  (%rdx), %eax
+    shll  %cl, %eax
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $1024, %eax
+    movl  %eax, 8(%rsp)
+    movl  -180(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movl  $1, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $2, %eax
+    movl  %eax, 8(%rsp)
+    movl  $2, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movl  $4, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -188(%rbp), %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $256, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -192(%rbp), %rax
+    pushq %rax
+    movl  $512, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -196(%rbp), %rax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -188(%rbp), %rax
+    pushq %rax
+    movl  -188(%rbp), %eax
+    pushq %rax
+    movl  $2, %eax
+    movl  %eax, %ecx
+    popq  %rax
+    sarl  %cl, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $64, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, 8(%rsp)
+    movl  -188(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -188(%rbp), %rax
+    pushq %rax
+    movl  -188(%rbp), %eax
+    pushq %rax
+    movl  $4, %eax
+    movl  %eax, %ecx
+    popq  %rax
+    sarl  %cl, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $4, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, 8(%rsp)
+    movl  -188(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -192(%rbp), %rax
+    pushq %rax
+    movl  -192(%rbp), %eax
+    pushq %rax
+    movl  -196(%rbp), %eax
+    movl  %eax, %ecx
+    popq  %rax
+    shrl  %cl, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $64, %eax
+    movl  %eax, 8(%rsp)
+    movl  -192(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## shr-assign
+    leaq  -192(%rbp), %rax
+    pushq %rax
+    movl  $2, %eax
+    movl  %eax, %ecx
+    popq  %rdx
+    movl  (%rdx), %eax
+    shrl  %cl, %eax
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $16, %eax
+    movl  %eax, 8(%rsp)
+    movl  -192(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -188(%rbp), %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $512, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## shr-assign
+    leaq  -188(%rbp), %rax
+    pushq %rax
+    movl  -196(%rbp), %eax
+    movl  %eax, %ecx
+    popq  %rdx
+    movl  (%rdx), %eax
+    sarl  %cl, %eax
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $64, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, 8(%rsp)
+    movl  -188(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -200(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $3, %eax
+    movl  %eax, 8(%rsp)
+    movl  $1, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    orl   %edx, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $5, %eax
+    movl  %eax, 8(%rsp)
+    movl  $1, %eax
+    pushq %rax
+    movl  $4, %eax
+    popq  %rdx
+    orl   %edx, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $6, %eax
+    movl  %eax, 8(%rsp)
+    movl  $2, %eax
+    pushq %rax
+    movl  $4, %eax
+    popq  %rdx
+    orl   %edx, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $7, %eax
+    movl  %eax, 8(%rsp)
+    movl  $1, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    orl   %edx, %eax
+    pushq %rax
+    movl  $4, %eax
+    popq  %rdx
+    orl   %edx, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## or-assign
+    leaq  -200(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    popq  %rdx
+    orl   %eax, (%rdx)
+    movl  (%rdx), %eax
+    subq  $16, %rsp
+    movl  $5, %eax
+    movl  %eax, 8(%rsp)
+    movl  -200(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -204(%rbp), %rax
+    pushq %rax
+    movl  $2, %eax
+    pushq %rax
+    movl  $4, %eax
+    popq  %rdx
+    orl   %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -208(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    orl   %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $5, %eax
+    movl  %eax, 8(%rsp)
+    movl  -204(%rbp), %eax
+    pushq %rax
+    movl  -208(%rbp), %eax
+    popq  %rdx
+    xorl  %edx, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $6, %eax
+    movl  %eax, 8(%rsp)
+    movl  -204(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## xor-assign
+    leaq  -204(%rbp), %rax
+    pushq %rax
+    movl  -208(%rbp), %eax
+    popq  %rdx
+    xorl  %eax, (%rdx)
+    movl  (%rdx), %eax
+    subq  $16, %rsp
+    movl  $5, %eax
+    movl  %eax, 8(%rsp)
+    movl  -204(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -212(%rbp), %rax
+    pushq %rax
+    movl  $2, %eax
+    pushq %rax
+    movl  $4, %eax
+    popq  %rdx
+    orl   %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -216(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    orl   %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $2, %eax
+    movl  %eax, 8(%rsp)
+    movl  -212(%rbp), %eax
+    pushq %rax
+    movl  -216(%rbp), %eax
+    popq  %rdx
+    andl  %edx, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $6, %eax
+    movl  %eax, 8(%rsp)
+    movl  -212(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## and-assign
+    leaq  -212(%rbp), %rax
+    pushq %rax
+    movl  -216(%rbp), %eax
+    popq  %rdx
+    andl  %eax, (%rdx)
+    movl  (%rdx), %eax
+    subq  $16, %rsp
+    movl  $2, %eax
+    movl  %eax, 8(%rsp)
+    movl  -212(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -220(%rbp), %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    movl  -220(%rbp), %eax
+    notl  %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -220(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, 8(%rsp)
+    movl  -220(%rbp), %eax
+    notl  %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -221(%rbp), %rax
+    pushq %rax
+    movl  $10, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -224(%rbp), %rax
+    pushq %rax
+    movl  $20, %eax
+    popq  %rdx
+    movw  %ax, (%rdx)
+## local scalar init
+    leaq  -228(%rbp), %rax
+    pushq %rax
+    movl  $30, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -221(%rbp), %rax
+    pushq %rax
+## cond-?
+    movb  -221(%rbp), %al
+    movsbl %al, %eax
+    pushq %rax
+    movl  $0, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setg  %al
+    movzbl %al, %eax
+    cmpq  $0, %rax
+    je    _LBB28_3
+## cond-then
+    leaq  -221(%rbp), %rax
+    movq  %rax, %rdx
+    movb  (%rax), %al
+    movb  %al, %cl
+    addb  $1, %cl
+    movb  %cl, (%rdx)
+    leaq  -224(%rbp), %rax
+    movq  %rax, %rdx
+    movw  (%rax), %ax
+    movw  %ax, %cx
+    addw  $1, %cx
+    movw  %cx, (%rdx)
+    leaq  -228(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    movslq %eax, %rax
+    jmp   _LBB28_2
+## cond-else
+_LBB28_3:
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+_LBB28_2:
+    popq  %rdx
+    movb  %al, (%rdx)
+    subq  $16, %rsp
+    movl  $30, %eax
+    movl  %eax, 8(%rsp)
+    movb  -221(%rbp), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $21, %eax
+    movl  %eax, 8(%rsp)
+    movw  -224(%rbp), %ax
+    movswq %ax, %rax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $31, %eax
+    movl  %eax, 8(%rsp)
+    movl  -228(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -232(%rbp), %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -232(%rbp), %rax
+    movl  (%rax), %edx
+    addl  $1, %edx
+    movl  %edx, (%rax)
+    movl  %edx, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, 8(%rsp)
+    leaq  -232(%rbp), %rax
+    movl  (%rax), %edx
+    subl  $1, %edx
+    movl  %edx, (%rax)
+    movl  %edx, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $2, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, 8(%rsp)
+    leaq  -232(%rbp), %rax
+    movl  (%rax), %edx
+    subl  $1, %edx
+    movl  %edx, (%rax)
+    movl  %edx, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -232(%rbp), %rax
+    pushq %rax
+    movl  $221134, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $221135, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -232(%rbp), %rax
+    movl  (%rax), %edx
+    addl  $1, %edx
+    movl  %edx, (%rax)
+    movl  %edx, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $221134, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -232(%rbp), %rax
+    movl  (%rax), %edx
+    subl  $1, %edx
+    movl  %edx, (%rax)
+    movl  %edx, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $221133, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -232(%rbp), %rax
+    movl  (%rax), %edx
+    subl  $1, %edx
+    movl  %edx, (%rax)
+    movl  %edx, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -236(%rbp), %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $111, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -240(%rbp), %rax
+    pushq %rax
+    movl  $130, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $110, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, 8(%rsp)
+    leaq  -236(%rbp), %rax
+    movl  (%rax), %edx
+    addl  $1, %edx
+    movl  %edx, (%rax)
+    movl  %edx, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $109, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, 8(%rsp)
+    leaq  -236(%rbp), %rax
+    movl  (%rax), %edx
+    addl  $1, %edx
+    movl  %edx, (%rax)
+    movl  %edx, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $110, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, 8(%rsp)
+    leaq  -236(%rbp), %rax
+    movl  (%rax), %edx
+    subl  $1, %edx
+    movl  %edx, (%rax)
+    movl  %edx, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -240(%rbp), %rax
+    pushq %rax
+    movl  -240(%rbp), %eax
+    pushq %rax
+    movl  -236(%rbp), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $20, %eax
+    movl  %eax, 8(%rsp)
+    movl  -240(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $21, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -240(%rbp), %rax
+    movl  (%rax), %edx
+    addl  $1, %edx
+    movl  %edx, (%rax)
+    movl  %edx, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $20, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -240(%rbp), %rax
+    movl  (%rax), %edx
+    subl  $1, %edx
+    movl  %edx, (%rax)
+    movl  %edx, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -244(%rbp), %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $13, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -248(%rbp), %rax
+    pushq %rax
+    movl  $14, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $13, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, 8(%rsp)
+    leaq  -244(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $12, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, 8(%rsp)
+    movl  -244(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $12, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, 8(%rsp)
+    leaq  -244(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $11, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, 8(%rsp)
+    movl  -244(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $11, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, 8(%rsp)
+    leaq  -244(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    subl  $1, %ecx
+    movl  %ecx, (%rdx)
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $12, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, 8(%rsp)
+    movl  -244(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -248(%rbp), %rax
+    pushq %rax
+    movl  -248(%rbp), %eax
+    pushq %rax
+    movl  -244(%rbp), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $2, %eax
+    movl  %eax, 8(%rsp)
+    movl  -248(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $2, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -248(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $3, %eax
+    movl  %eax, 8(%rsp)
+    movl  -248(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $3, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -248(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    subl  $1, %ecx
+    movl  %ecx, (%rdx)
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $2, %eax
+    movl  %eax, 8(%rsp)
+    movl  -248(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -249(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -250(%rbp), %rax
+    pushq %rax
+    movl  $9, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## assign
+    leaq  -251(%rbp), %rax
+    pushq %rax
+    movb  -250(%rbp), %al
+    movsbl %al, %eax
+    pushq %rax
+    movb  -249(%rbp), %al
+    movsbl %al, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setg  %al
+    movzbl %al, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+    subq  $16, %rsp
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movb  -251(%rbp), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -257(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## assign
+    leaq  -256(%rbp), %rax
+    pushq %rax
+    movl  $2241, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movb  -257(%rbp), %al
+    cmpb  $0, %al
+    movl  $0, %eax
+    je    _LBB30_2
+    movb  -257(%rbp), %al
+    cmpb  $0, %al
+    movl  $0, %eax
+    je    _LBB30_2
+    movl  $1, %eax
+_LBB30_2:
+    cmpl  $0, %eax
+    je    _LBB29_3
+## if-then
+## assign
+    leaq  -257(%rbp), %rax
+    pushq %rax
+    movl  $99, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+    jmp   _LBB29_2
+## if-else
+_LBB29_3:
+_LBB29_2:
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    movb  -257(%rbp), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -256(%rbp), %rax
+    pushq %rax
+    movl  $2241, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movb  -257(%rbp), %al
+    cmpb  $0, %al
+    movl  $1, %eax
+    jne   _LBB32_2
+    movb  -257(%rbp), %al
+    cmpb  $0, %al
+    movl  $1, %eax
+    jne   _LBB32_2
+    movl  $0, %eax
+_LBB32_2:
+    cmpl  $0, %eax
+    je    _LBB31_3
+## if-then
+## assign
+    leaq  -257(%rbp), %rax
+    pushq %rax
+    movl  $37, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+    jmp   _LBB31_2
+## if-else
+_LBB31_3:
+_LBB31_2:
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    movb  -257(%rbp), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    movl  $0, %eax
+    jmp   _LBB3_0
+_LBB3_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
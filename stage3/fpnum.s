@@ -0,0 +1,454 @@
+    .data
+
+    .text
+
+_L_fp_30:
+    .quad 4616347244041716367
+
+_L_fp_31:
+    .quad 4614253070214989087
+
+_L_fp_35:
+    .quad 4613303441197561744
+
+_L_fp_37:
+    .quad 4657483393084771329
+
+_L_fp_41:
+    .quad 4608236261112822104
+
+_L_fp_43:
+    .quad 4597454643604897137
+
+_L_fp_44:
+    .quad 4609272089027117318
+
+_L_fp_45:
+    .quad 4607200433198526890
+
+_L_fp_46:
+    .quad 4598784466502867097
+
+_L_fp_47:
+    .quad 4617726716188447895
+
+_L_fp_51:
+    .quad 4612451630364040888
+
+_L_fp_53:
+    .quad 4615829330084568760
+
+_L_fp_54:
+    .quad 4612361558371493478
+
+_L_fp_55:
+    .quad 4599075939470750515
+
+_L_fp_56:
+    .quad 4615829330084568760
+
+_L_fp_57:
+    .quad 4602678819172646912
+
+_L_fp_61:
+    .quad 4621745934095026749
+
+_L_fp_62:
+    .quad 4621695268599218831
+
+    .global _main
+_main:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $80, %rsp
+## func params
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movsd _L_fp_30(%rip), %xmm0
+    popq  %rdx
+    movsd %xmm0, (%rdx)
+## assign
+    leaq  -4(%rbp), %rax
+    pushq %rax
+    movsd _L_fp_31(%rip), %xmm0
+    cvtsd2ss %xmm0, %xmm0
+    popq  %rdx
+    movss %xmm0, (%rdx)
+    subq  $16, %rsp
+    movl  $3, %eax
+    movl  %eax, 8(%rsp)
+    movss -4(%rbp), %xmm0
+    cvttss2si %xmm0, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movsd -16(%rbp), %xmm0
+    cvttsd2si %xmm0, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movsd _L_fp_35(%rip), %xmm0
+    cvtsd2ss %xmm0, %xmm0
+    popq  %rdx
+    movss %xmm0, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movsd _L_fp_37(%rip), %xmm0
+    popq  %rdx
+    movsd %xmm0, (%rdx)
+    subq  $16, %rsp
+    movsd _L_fp_35(%rip), %xmm0
+    cvtsd2ss %xmm0, %xmm0
+    movss %xmm0, 8(%rsp)
+    movss -20(%rbp), %xmm0
+    movss %xmm0, (%rsp)
+    movss 8(%rsp), %xmm0
+    movss (%rsp), %xmm1
+    callq _assertf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movsd _L_fp_37(%rip), %xmm0
+    movsd %xmm0, 8(%rsp)
+    movsd -32(%rbp), %xmm0
+    movsd %xmm0, (%rsp)
+    movsd 8(%rsp), %xmm0
+    movsd (%rsp), %xmm1
+    callq _assertd
+    addq  $16, %rsp
+## local scalar init
+    leaq  -36(%rbp), %rax
+    pushq %rax
+    movsd _L_fp_41(%rip), %xmm0
+    cvtsd2ss %xmm0, %xmm0
+    popq  %rdx
+    movss %xmm0, (%rdx)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    movsd _L_fp_43(%rip), %xmm0
+    popq  %rdx
+    movsd %xmm0, (%rdx)
+    subq  $16, %rsp
+    movsd _L_fp_44(%rip), %xmm0
+    cvtsd2ss %xmm0, %xmm0
+    movss %xmm0, 8(%rsp)
+    movss -36(%rbp), %xmm0
+    cvtss2sd %xmm0, %xmm0
+    subq  $8, %rsp
+    movsd %xmm0, (%rsp)
+    movsd -48(%rbp), %xmm0
+    movsd (%rsp), %xmm1
+    addq  $8, %rsp
+    addsd %xmm1, %xmm0
+    cvtsd2ss %xmm0, %xmm0
+    movss %xmm0, (%rsp)
+    movss 8(%rsp), %xmm0
+    movss (%rsp), %xmm1
+    callq _assertf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movsd _L_fp_45(%rip), %xmm0
+    cvtsd2ss %xmm0, %xmm0
+    movss %xmm0, 8(%rsp)
+    movss -36(%rbp), %xmm0
+    cvtss2sd %xmm0, %xmm0
+    subq  $8, %rsp
+    movsd %xmm0, (%rsp)
+    movsd -48(%rbp), %xmm0
+    movsd %xmm0, %xmm1
+    movsd (%rsp), %xmm0
+    addq  $8, %rsp
+    subsd %xmm1, %xmm0
+    cvtsd2ss %xmm0, %xmm0
+    movss %xmm0, (%rsp)
+    movss 8(%rsp), %xmm0
+    movss (%rsp), %xmm1
+    callq _assertf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movsd _L_fp_46(%rip), %xmm0
+    cvtsd2ss %xmm0, %xmm0
+    movss %xmm0, 8(%rsp)
+    movss -36(%rbp), %xmm0
+    cvtss2sd %xmm0, %xmm0
+    subq  $8, %rsp
+    movsd %xmm0, (%rsp)
+    movsd -48(%rbp), %xmm0
+    movsd (%rsp), %xmm1
+    addq  $8, %rsp
+    mulsd %xmm1, %xmm0
+    cvtsd2ss %xmm0, %xmm0
+    movss %xmm0, (%rsp)
+    movss 8(%rsp), %xmm0
+    movss (%rsp), %xmm1
+    callq _assertf
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movsd _L_fp_47(%rip), %xmm0
+    cvtsd2ss %xmm0, %xmm0
+    movss %xmm0, 8(%rsp)
+    movss -36(%rbp), %xmm0
+    cvtss2sd %xmm0, %xmm0
+    subq  $8, %rsp
+    movsd %xmm0, (%rsp)
+    movsd -48(%rbp), %xmm0
+    movsd %xmm0, %xmm1
+    movsd (%rsp), %xmm0
+    addq  $8, %rsp
+    divsd %xmm1, %xmm0
+    cvtsd2ss %xmm0, %xmm0
+    movss %xmm0, (%rsp)
+    movss 8(%rsp), %xmm0
+    movss (%rsp), %xmm1
+    callq _assertf
+    addq  $16, %rsp
+## local scalar init
+    leaq  -52(%rbp), %rax
+    pushq %rax
+    movsd _L_fp_51(%rip), %xmm0
+    cvtsd2ss %xmm0, %xmm0
+    popq  %rdx
+    movss %xmm0, (%rdx)
+## local scalar init
+    leaq  -64(%rbp), %rax
+    pushq %rax
+    movsd _L_fp_53(%rip), %xmm0
+    popq  %rdx
+    movsd %xmm0, (%rdx)
+    subq  $16, %rsp
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movss -52(%rbp), %xmm0
+    cvtss2sd %xmm0, %xmm0
+    subq  $8, %rsp
+    movsd %xmm0, (%rsp)
+    movsd _L_fp_54(%rip), %xmm0
+    movsd %xmm0, %xmm1
+    movsd (%rsp), %xmm0
+    addq  $8, %rsp
+    ucomisd %xmm0, %xmm1
+    setb  %al
+    andb  $1, %al
+    movzbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movss -52(%rbp), %xmm0
+    cvtss2sd %xmm0, %xmm0
+    subq  $8, %rsp
+    movsd %xmm0, (%rsp)
+    movsd _L_fp_54(%rip), %xmm0
+    subq  $8, %rsp
+    movsd %xmm0, (%rsp)
+    movl  $2, %eax
+    movsd (%rsp), %xmm1
+    addq  $8, %rsp
+    mulsd %xmm1, %xmm0
+    movsd %xmm0, %xmm1
+    movsd (%rsp), %xmm0
+    addq  $8, %rsp
+    ucomisd %xmm0, %xmm1
+    seta  %al
+    andb  $1, %al
+    movzbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    movss -52(%rbp), %xmm0
+    cvtss2sd %xmm0, %xmm0
+    subq  $8, %rsp
+    movsd %xmm0, (%rsp)
+    movsd _L_fp_54(%rip), %xmm0
+    subq  $8, %rsp
+    movsd %xmm0, (%rsp)
+    movsd _L_fp_55(%rip), %xmm0
+    movsd %xmm0, %xmm1
+    movsd (%rsp), %xmm0
+    addq  $8, %rsp
+    subsd %xmm1, %xmm0
+    movsd %xmm0, %xmm1
+    movsd (%rsp), %xmm0
+    addq  $8, %rsp
+    ucomisd %xmm0, %xmm1
+    seta  %al
+    andb  $1, %al
+    movzbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movsd -64(%rbp), %xmm0
+    subq  $8, %rsp
+    movsd %xmm0, (%rsp)
+    movsd _L_fp_56(%rip), %xmm0
+    movsd %xmm0, %xmm1
+    movsd (%rsp), %xmm0
+    addq  $8, %rsp
+    ucomisd %xmm0, %xmm1
+    setae %al
+    andb  $1, %al
+    movzbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movsd -64(%rbp), %xmm0
+    subq  $8, %rsp
+    movsd %xmm0, (%rsp)
+    movsd _L_fp_56(%rip), %xmm0
+    movsd %xmm0, %xmm1
+    movsd (%rsp), %xmm0
+    addq  $8, %rsp
+    ucomisd %xmm0, %xmm1
+    setbe %al
+    andb  $1, %al
+    movzbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    movsd -64(%rbp), %xmm0
+    subq  $8, %rsp
+    movsd %xmm0, (%rsp)
+    movsd _L_fp_56(%rip), %xmm0
+    subq  $8, %rsp
+    movsd %xmm0, (%rsp)
+    movsd _L_fp_57(%rip), %xmm0
+    movsd (%rsp), %xmm1
+    addq  $8, %rsp
+    mulsd %xmm1, %xmm0
+    movsd %xmm0, %xmm1
+    movsd (%rsp), %xmm0
+    addq  $8, %rsp
+    ucomisd %xmm0, %xmm1
+    setae %al
+    andb  $1, %al
+    movzbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -72(%rbp), %rax
+    pushq %rax
+    movsd _L_fp_61(%rip), %xmm0
+    popq  %rdx
+    movsd %xmm0, (%rdx)
+    subq  $16, %rsp
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movsd -72(%rbp), %xmm0
+    subq  $8, %rsp
+    movsd %xmm0, (%rsp)
+    movsd _L_fp_61(%rip), %xmm0
+    movsd %xmm0, %xmm1
+    movsd (%rsp), %xmm0
+    addq  $8, %rsp
+    ucomisd %xmm0, %xmm1
+    sete  %al
+    andb  $1, %al
+    movzbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    movsd -72(%rbp), %xmm0
+    subq  $8, %rsp
+    movsd %xmm0, (%rsp)
+    movsd _L_fp_62(%rip), %xmm0
+    movsd %xmm0, %xmm1
+    movsd (%rsp), %xmm0
+    addq  $8, %rsp
+    ucomisd %xmm0, %xmm1
+    sete  %al
+    andb  $1, %al
+    movzbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    movsd -72(%rbp), %xmm0
+    subq  $8, %rsp
+    movsd %xmm0, (%rsp)
+    movsd _L_fp_61(%rip), %xmm0
+    movsd %xmm0, %xmm1
+    movsd (%rsp), %xmm0
+    addq  $8, %rsp
+    ucomisd %xmm0, %xmm1
+    setne %al
+    andb  $1, %al
+    movzbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movsd -72(%rbp), %xmm0
+    subq  $8, %rsp
+    movsd %xmm0, (%rsp)
+    movsd _L_fp_62(%rip), %xmm0
+    movsd %xmm0, %xmm1
+    movsd (%rsp), %xmm0
+    addq  $8, %rsp
+    ucomisd %xmm0, %xmm1
+    setne %al
+    andb  $1, %al
+    movzbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    movl  $0, %eax
+    jmp   _LBB0_0
+_LBB0_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
@@ -0,0 +1,2874 @@
+    .data
+
+    .global _function_pointer
+_function_pointer:
+    .quad 0
+
+_function_pointer2_250:
+    .quad _num
+
+    .global _function_pointer3
+_function_pointer3:
+    .quad 0
+
+_function_pointer4_257:
+    .quad _twice_long
+
+    .text
+
+_L_str_284:
+    .asciz "(%d, %d, %d, %d, %d, %d, %d)"
+
+_L_str_285:
+    .asciz "(1, 2, 3, 4, 5, 6, 7)"
+
+_L_str_289:
+    .asciz "(%d, %d, %d, %d)"
+
+_L_str_290:
+    .asciz "(1, 2, 3, 4)"
+
+_L_str_329:
+    .asciz "Heloo, world\012"
+
+_L_str_336:
+    .asciz "%ld"
+
+_L_str_337:
+    .asciz "-64"
+
+_L_str_341:
+    .asciz "foo"
+
+    .global _sum1234_mult_sum5678
+_sum1234_mult_sum5678:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movl  %edi, -4(%rbp)
+    movl  %esi, -8(%rbp)
+    movl  %edx, -12(%rbp)
+    movl  %ecx, -16(%rbp)
+    movl  %r8d, -20(%rbp)
+    movl  %r9d, -24(%rbp)
+    movq  %rbp, %rax
+    addq  $16, %rax
+    movl  (%rax), %r10d
+    movl  %r10d, 16(%rbp)
+    movq  %rbp, %rax
+    addq  $24, %rax
+    movl  (%rax), %r10d
+    movl  %r10d, 24(%rbp)
+## func body
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  -8(%rbp), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    pushq %rax
+    movl  -16(%rbp), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    pushq %rax
+    movl  -20(%rbp), %eax
+    pushq %rax
+    movl  -24(%rbp), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    pushq %rax
+    movl  16(%rbp), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    pushq %rax
+    movl  24(%rbp), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    imull %edx, %eax
+    jmp   _LBB0_0
+_LBB0_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _my_sprintf
+_my_sprintf:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $80, %rsp
+## func params
+    movq  %rdi, -48(%rbp)
+    movq  %rsi, -40(%rbp)
+    movq  %rdx, -32(%rbp)
+    movq  %rcx, -24(%rbp)
+    movq  %r8, -16(%rbp)
+    movq  %r9, -8(%rbp)
+## func body
+    leaq  -40(%rbp), %rax
+    subq  $8, %rsp
+    movq  %rax, (%rsp)
+    leaq  -72(%rbp), %rax
+    subq  $8, %rsp
+    movq  %rax, (%rsp)
+## __builtin_va_start
+    pop    %rax ## &va_list
+    pop    %rdx ## &last
+    leaq   -48(%rbp), %rdi ## gp_offset
+    subq   %rdi, %rdx      ## gp_offset
+    addq   $8, %rdx         ## gp_offset
+    movq   %rdx, (%rax)    ## gp_offset
+    movl   $48, 4(%rax)     ## fp_offset
+    leaq   16(%rbp), %rdi  ## overflow_arg_area
+    movq   %rdi, 8(%rax)   ## overflow_arg_area
+    leaq   -48(%rbp), %rdi ## reg_save_area
+    movq   %rdi, 16(%rax)  ## reg_save_area
+## end of __builtin_va_start
+    subq  $32, %rsp
+    movq  -48(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -40(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    leaq  -72(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _vsprintf
+    addq  $32, %rsp
+    jmp   _LBB1_0
+_LBB1_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _foo
+_foo:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movl  %edi, -4(%rbp)
+    movl  %esi, -8(%rbp)
+    movl  %edx, -12(%rbp)
+## func body
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  -8(%rbp), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    jmp   _LBB2_0
+_LBB2_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _bar
+_bar:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movl  %edi, -4(%rbp)
+## func body
+    movl  $2, %eax
+    pushq %rax
+    movl  -4(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    jmp   _LBB3_0
+_LBB3_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _make_coord
+_make_coord:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+## save address to returning value
+    pushq %rdi
+    movq  %rsi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $7, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $19, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movl  $0, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -32(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    leaq  -32(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    movq  16(%rax), %r10
+    movq  %r10, 16(%rdx)
+    movq  %rdx, %rax
+    jmp   _LBB4_0
+_LBB4_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _some_calc
+_some_calc:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movq  %rbp, %rax
+    addq  $16, %rax
+    movq  (%rax), %r10
+    movq  %r10, -40(%rbp)
+    movq  8(%rax), %r10
+    movq  %r10, -32(%rbp)
+    movq  16(%rax), %r10
+    movq  %r10, -24(%rbp)
+## func body
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    leaq  -40(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    jmp   _LBB5_0
+_LBB5_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _some_coord_func
+_some_coord_func:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## assign
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+_LBB6_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _try_some_calc
+_try_some_calc:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+## func body
+    subq  $48, %rsp
+    movl  $19, %eax
+    movslq %eax, %rax
+    movq  %rax, 40(%rsp)
+    movl  $27, %eax
+    movslq %eax, %rax
+    movq  %rax, 32(%rsp)
+    subq  $16, %rsp
+    movl  $55, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    leaq  -32(%rbp), %rdi
+    movq  8(%rsp), %rsi
+    callq _make_coord
+    addq  $16, %rsp
+    movq  (%rax), %r10
+    movq  %r10, (%rsp)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rsp)
+    movq  16(%rax), %r10
+    movq  %r10, 16(%rsp)
+    movq  40(%rsp), %rdi
+    movq  32(%rsp), %rsi
+    callq _some_calc
+    addq  $48, %rsp
+    jmp   _LBB7_0
+_LBB7_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _mid_struct_and_some_ptr
+_mid_struct_and_some_ptr:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movq  %rbp, %r10
+    subq  $32, %r10
+    movq  %rdx, (%r10)
+    movq  %rcx, 8(%r10)
+## func body
+    movq  -16(%rbp), %rax
+    movl  (%rax), %eax
+    pushq %rax
+    leaq  -32(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    jmp   _LBB8_0
+_LBB8_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _twice_long
+_twice_long:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+    movl  $2, %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    jmp   _LBB9_0
+_LBB9_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _ret_struct_by_val
+_ret_struct_by_val:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+## save address to returning value
+    pushq %rdi
+    movq  %rsi, -8(%rbp)
+    movl  %edx, -12(%rbp)
+## func body
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movl  $11, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $22, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movl  $33, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## add-assign
+    leaq  -40(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    movslq %eax, %rax
+    popq  %rdx
+    addq  %rax, (%rdx)
+    movq  (%rdx), %rax
+## add-assign
+    leaq  -40(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    movslq %eax, %rax
+    popq  %rdx
+    addq  %rax, (%rdx)
+    movq  (%rdx), %rax
+## add-assign
+    leaq  -40(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    movslq %eax, %rax
+    popq  %rdx
+    addq  %rax, (%rdx)
+    movq  (%rdx), %rax
+    leaq  -40(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    movq  16(%rax), %r10
+    movq  %r10, 16(%rdx)
+    movq  %rdx, %rax
+    jmp   _LBB10_0
+_LBB10_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _ret_struct_by_val_with_struct_param
+_ret_struct_by_val_with_struct_param:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $64, %rsp
+## func params
+## save address to returning value
+    pushq %rdi
+    movq  %rbp, %rax
+    addq  $16, %rax
+    movq  (%rax), %r10
+    movq  %r10, -24(%rbp)
+    movq  8(%rax), %r10
+    movq  %r10, -16(%rbp)
+    movq  16(%rax), %r10
+    movq  %r10, -8(%rbp)
+    movq  %rsi, -32(%rbp)
+    movl  %edx, -36(%rbp)
+## func body
+## local scalar init
+    leaq  -64(%rbp), %rax
+    pushq %rax
+    leaq  -24(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    movq  16(%rax), %r10
+    movq  %r10, 16(%rdx)
+## add-assign
+    leaq  -64(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  -36(%rbp), %eax
+    movslq %eax, %rax
+    popq  %rdx
+    addq  %rax, (%rdx)
+    movq  (%rdx), %rax
+## add-assign
+    leaq  -64(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  -36(%rbp), %eax
+    movslq %eax, %rax
+    popq  %rdx
+    addq  %rax, (%rdx)
+    movq  (%rdx), %rax
+## add-assign
+    leaq  -64(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movl  -36(%rbp), %eax
+    movslq %eax, %rax
+    popq  %rdx
+    addq  %rax, (%rdx)
+    movq  (%rdx), %rax
+    leaq  -64(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    movq  16(%rax), %r10
+    movq  %r10, 16(%rdx)
+    movq  %rdx, %rax
+    jmp   _LBB11_0
+_LBB11_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _num
+_num:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $0, %rsp
+## func params
+## func body
+    movl  $23012, %eax
+    jmp   _LBB12_0
+_LBB12_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _main
+_main:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $480, %rsp
+## func params
+## func body
+    subq  $16, %rsp
+    movl  $42, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movl  $21, %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _gcc_twice
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $16, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    subq  $16, %rsp
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _gcc_twice
+    addq  $16, %rsp
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _gcc_twice
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -8(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $48, %rsp
+    movl  $11, %eax
+    movb  %al, 40(%rsp)
+    movl  $22, %eax
+    movw  %ax, 32(%rsp)
+    movl  $33, %eax
+    movl  %eax, 24(%rsp)
+    movl  $44, %eax
+    movslq %eax, %rax
+    movq  %rax, 16(%rsp)
+    leaq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movb  40(%rsp), %dil
+    movw  32(%rsp), %si
+    movl  24(%rsp), %edx
+    movq  16(%rsp), %rcx
+    movq  8(%rsp), %r8
+    callq _gcc_add
+    addq  $48, %rsp
+    subq  $16, %rsp
+    movl  $110, %eax
+    movl  %eax, 8(%rsp)
+    movq  -8(%rbp), %rax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    subq  $72, %rsp
+    movl  $1, %eax
+    movl  %eax, 64(%rsp)
+    movl  $2, %eax
+    movl  %eax, 56(%rsp)
+    movl  $3, %eax
+    movl  %eax, 48(%rsp)
+    movl  $4, %eax
+    movl  %eax, 40(%rsp)
+    movl  $5, %eax
+    movl  %eax, 32(%rsp)
+    movl  $6, %eax
+    movl  %eax, 24(%rsp)
+    movl  $7, %eax
+    movl  %eax, (%rsp)
+    movl  $8, %eax
+    movl  %eax, 8(%rsp)
+    movl  64(%rsp), %edi
+    movl  56(%rsp), %esi
+    movl  48(%rsp), %edx
+    movl  40(%rsp), %ecx
+    movl  32(%rsp), %r8d
+    movl  24(%rsp), %r9d
+    callq _gcc_sum1234_mult_sum5678
+    addq  $72, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $260, %eax
+    movl  %eax, 8(%rsp)
+    movl  -12(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    subq  $72, %rsp
+    movl  $1, %eax
+    movl  %eax, 64(%rsp)
+    movl  $2, %eax
+    movl  %eax, 56(%rsp)
+    movl  $3, %eax
+    movl  %eax, 48(%rsp)
+    movl  $4, %eax
+    movl  %eax, 40(%rsp)
+    movl  $5, %eax
+    movl  %eax, 32(%rsp)
+    movl  $6, %eax
+    movl  %eax, 24(%rsp)
+    movl  $7, %eax
+    movl  %eax, (%rsp)
+    movl  $8, %eax
+    movl  %eax, 8(%rsp)
+    movl  64(%rsp), %edi
+    movl  56(%rsp), %esi
+    movl  48(%rsp), %edx
+    movl  40(%rsp), %ecx
+    movl  32(%rsp), %r8d
+    movl  24(%rsp), %r9d
+    callq _sum1234_mult_sum5678
+    addq  $72, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $260, %eax
+    movl  %eax, 8(%rsp)
+    movl  -16(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $1, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $2, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $3, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $5, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $6, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $7, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $9, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $10, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $11, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $12, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $13, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $14, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $15, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $17, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $18, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $19, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $20, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $21, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $22, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $23, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $25, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $26, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $27, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $28, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $29, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $30, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    addq  $31, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+    subq  $80, %rsp
+    leaq  -48(%rbp), %rax
+    movq  %rax, 72(%rsp)
+    leaq  _L_str_284(%rip), %rax
+    movq  %rax, 64(%rsp)
+    movl  $1, %eax
+    movl  %eax, 56(%rsp)
+    movl  $2, %eax
+    movl  %eax, 48(%rsp)
+    movl  $3, %eax
+    movl  %eax, 40(%rsp)
+    movl  $4, %eax
+    movl  %eax, 32(%rsp)
+    movl  $5, %eax
+    movl  %eax, (%rsp)
+    movl  $6, %eax
+    movl  %eax, 8(%rsp)
+    movl  $7, %eax
+    movl  %eax, 16(%rsp)
+    movq  72(%rsp), %rdi
+    movq  64(%rsp), %rsi
+    movl  56(%rsp), %edx
+    movl  48(%rsp), %ecx
+    movl  40(%rsp), %r8d
+    movl  32(%rsp), %r9d
+    movb  $0, %al
+    callq _sprintf
+    addq  $80, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  -48(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_285(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -80(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -80(%rbp), %rax
+    addq  $1, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -80(%rbp), %rax
+    addq  $2, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -80(%rbp), %rax
+    addq  $3, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -80(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -80(%rbp), %rax
+    addq  $5, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -80(%rbp), %rax
+    addq  $6, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -80(%rbp), %rax
+    addq  $7, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -80(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -80(%rbp), %rax
+    addq  $9, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -80(%rbp), %rax
+    addq  $10, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -80(%rbp), %rax
+    addq  $11, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -80(%rbp), %rax
+    addq  $12, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -80(%rbp), %rax
+    addq  $13, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -80(%rbp), %rax
+    addq  $14, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -80(%rbp), %rax
+    addq  $15, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -80(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -80(%rbp), %rax
+    addq  $17, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -80(%rbp), %rax
+    addq  $18, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -80(%rbp), %rax
+    addq  $19, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -80(%rbp), %rax
+    addq  $20, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -80(%rbp), %rax
+    addq  $21, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -80(%rbp), %rax
+    addq  $22, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -80(%rbp), %rax
+    addq  $23, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -80(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -80(%rbp), %rax
+    addq  $25, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -80(%rbp), %rax
+    addq  $26, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -80(%rbp), %rax
+    addq  $27, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -80(%rbp), %rax
+    addq  $28, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -80(%rbp), %rax
+    addq  $29, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -80(%rbp), %rax
+    addq  $30, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -80(%rbp), %rax
+    addq  $31, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+    subq  $48, %rsp
+    leaq  -80(%rbp), %rax
+    movq  %rax, 40(%rsp)
+    leaq  _L_str_289(%rip), %rax
+    movq  %rax, 32(%rsp)
+    movl  $1, %eax
+    movl  %eax, 24(%rsp)
+    movl  $2, %eax
+    movl  %eax, 16(%rsp)
+    movl  $3, %eax
+    movl  %eax, 8(%rsp)
+    movl  $4, %eax
+    movl  %eax, (%rsp)
+    movq  40(%rsp), %rdi
+    movq  32(%rsp), %rsi
+    movl  24(%rsp), %edx
+    movl  16(%rsp), %ecx
+    movl  8(%rsp), %r8d
+    movl  (%rsp), %r9d
+    movb  $0, %al
+    callq _my_sprintf
+    addq  $48, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  -80(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_290(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -112(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -112(%rbp), %rax
+    addq  $1, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -112(%rbp), %rax
+    addq  $2, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -112(%rbp), %rax
+    addq  $3, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -112(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -112(%rbp), %rax
+    addq  $5, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -112(%rbp), %rax
+    addq  $6, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -112(%rbp), %rax
+    addq  $7, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -112(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -112(%rbp), %rax
+    addq  $9, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -112(%rbp), %rax
+    addq  $10, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -112(%rbp), %rax
+    addq  $11, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -112(%rbp), %rax
+    addq  $12, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -112(%rbp), %rax
+    addq  $13, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -112(%rbp), %rax
+    addq  $14, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -112(%rbp), %rax
+    addq  $15, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -112(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -112(%rbp), %rax
+    addq  $17, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -112(%rbp), %rax
+    addq  $18, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -112(%rbp), %rax
+    addq  $19, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -112(%rbp), %rax
+    addq  $20, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -112(%rbp), %rax
+    addq  $21, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -112(%rbp), %rax
+    addq  $22, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -112(%rbp), %rax
+    addq  $23, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -112(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -112(%rbp), %rax
+    addq  $25, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -112(%rbp), %rax
+    addq  $26, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -112(%rbp), %rax
+    addq  $27, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -112(%rbp), %rax
+    addq  $28, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -112(%rbp), %rax
+    addq  $29, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -112(%rbp), %rax
+    addq  $30, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -112(%rbp), %rax
+    addq  $31, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+    subq  $80, %rsp
+    leaq  -112(%rbp), %rax
+    movq  %rax, 72(%rsp)
+    leaq  _L_str_284(%rip), %rax
+    movq  %rax, 64(%rsp)
+    movl  $1, %eax
+    movl  %eax, 56(%rsp)
+    movl  $2, %eax
+    movl  %eax, 48(%rsp)
+    movl  $3, %eax
+    movl  %eax, 40(%rsp)
+    movl  $4, %eax
+    movl  %eax, 32(%rsp)
+    movl  $5, %eax
+    movl  %eax, (%rsp)
+    movl  $6, %eax
+    movl  %eax, 8(%rsp)
+    movl  $7, %eax
+    movl  %eax, 16(%rsp)
+    movq  72(%rsp), %rdi
+    movq  64(%rsp), %rsi
+    movl  56(%rsp), %edx
+    movl  48(%rsp), %ecx
+    movl  40(%rsp), %r8d
+    movl  32(%rsp), %r9d
+    movb  $0, %al
+    callq _my_sprintf
+    addq  $80, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  -112(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  _L_str_285(%rip), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -120(%rbp), %rax
+    pushq %rax
+    movl  $14, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -120(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    movl  $17, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $14, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -120(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _gcc_get_x
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $14, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -120(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $17, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -120(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _gcc_get_y
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $17, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -120(%rbp), %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -136(%rbp), %rax
+    pushq %rax
+    movl  $14, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    movl  $17, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $49, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -136(%rbp), %rax
+    addq  $12, %rax
+    pushq %rax
+    movl  $32, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $14, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  -136(%rbp), %rax
+    movq  (%rax), %r10
+    movq  %r10, (%rsp)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rsp)
+    movq  (%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _gcc_get_x4
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $14, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -136(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $17, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  -136(%rbp), %rax
+    movq  (%rax), %r10
+    movq  %r10, (%rsp)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rsp)
+    movq  (%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _gcc_get_y4
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $17, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -136(%rbp), %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $49, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  -136(%rbp), %rax
+    movq  (%rax), %r10
+    movq  %r10, (%rsp)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rsp)
+    movq  (%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _gcc_get_z4
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $49, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -136(%rbp), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $32, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  -136(%rbp), %rax
+    movq  (%rax), %r10
+    movq  %r10, (%rsp)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rsp)
+    movq  (%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _gcc_get_w4
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $32, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -136(%rbp), %rax
+    addq  $12, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -160(%rbp), %rax
+    pushq %rax
+    movl  $111, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -160(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $222, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -160(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movl  $199, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movl  $111, %eax
+    movl  %eax, 8(%rsp)
+    subq  $32, %rsp
+    leaq  -160(%rbp), %rax
+    movq  (%rax), %r10
+    movq  %r10, (%rsp)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rsp)
+    movq  16(%rax), %r10
+    movq  %r10, 16(%rsp)
+    callq _gcc_coord_x
+    addq  $32, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $111, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -160(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $222, %eax
+    movl  %eax, 8(%rsp)
+    subq  $32, %rsp
+    leaq  -160(%rbp), %rax
+    movq  (%rax), %r10
+    movq  %r10, (%rsp)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rsp)
+    movq  16(%rax), %r10
+    movq  %r10, 16(%rsp)
+    callq _gcc_coord_y
+    addq  $32, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $222, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -160(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $199, %eax
+    movl  %eax, 8(%rsp)
+    subq  $32, %rsp
+    leaq  -160(%rbp), %rax
+    movq  (%rax), %r10
+    movq  %r10, (%rsp)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rsp)
+    movq  16(%rax), %r10
+    movq  %r10, 16(%rsp)
+    callq _gcc_coord_z
+    addq  $32, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $199, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -160(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -168(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    callq _gcc_get_point
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movl  $71, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -168(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $92, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -168(%rbp), %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -184(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    callq _gcc_get_vec
+    addq  $8, %rsp
+    movq  %rax, -480(%rbp)
+    movq  %rdx, -472(%rbp)
+    leaq  -480(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    subq  $16, %rsp
+    movl  $1301, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -184(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $223922, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -184(%rbp), %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $3973, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, 8(%rsp)
+    leaq  -184(%rbp), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -208(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    leaq  -480(%rbp), %rdi
+    callq _gcc_get_coord
+    addq  $8, %rsp
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    movq  16(%rax), %r10
+    movq  %r10, 16(%rdx)
+    subq  $16, %rsp
+    movl  $72340, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -208(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1230889, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, 8(%rsp)
+    leaq  -208(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $91355, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -208(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -212(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $11, %eax
+    movl  %eax, 16(%rsp)
+    movl  $22, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movl  $33, %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _bar
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  16(%rsp), %edi
+    movl  8(%rsp), %esi
+    movl  (%rsp), %edx
+    callq _foo
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $99, %eax
+    movl  %eax, 8(%rsp)
+    movl  -212(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -224(%rbp), %rax
+    pushq %rax
+    movl  $23, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -224(%rbp), %rax
+    pushq %rax
+    subq  $40, %rsp
+    movl  $9, %eax
+    movslq %eax, %rax
+    movq  %rax, 32(%rsp)
+    movl  $17, %eax
+    movslq %eax, %rax
+    movq  %rax, 24(%rsp)
+    subq  $16, %rsp
+    movl  $55, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    leaq  -480(%rbp), %rdi
+    movq  8(%rsp), %rsi
+    callq _make_coord
+    addq  $16, %rsp
+    movq  (%rax), %r10
+    movq  %r10, (%rsp)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rsp)
+    movq  16(%rax), %r10
+    movq  %r10, 16(%rsp)
+    movq  32(%rsp), %rdi
+    movq  24(%rsp), %rsi
+    callq _some_calc
+    addq  $40, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movl  $33, %eax
+    movl  %eax, 8(%rsp)
+    movq  -224(%rbp), %rax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -248(%rbp), %rax
+    pushq %rax
+    movl  $111, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -248(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $222, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -248(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movl  $333, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -252(%rbp), %rax
+    pushq %rax
+    movl  $17, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    leaq  -248(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  -252(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _some_coord_func
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $3, %eax
+    movl  %eax, 8(%rsp)
+    movl  -252(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -264(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    callq _try_some_calc
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movl  $53, %eax
+    movl  %eax, 8(%rsp)
+    movq  -264(%rbp), %rax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -280(%rbp), %rax
+    pushq %rax
+    movl  $11, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    movl  $22, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $33, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -280(%rbp), %rax
+    addq  $12, %rax
+    pushq %rax
+    popq  %rax
+    movl  $0, %edx
+    movl  %edx, (%rax)
+## local scalar init
+    leaq  -288(%rbp), %rax
+    pushq %rax
+    leaq  _L_str_329(%rip), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -292(%rbp), %rax
+    pushq %rax
+    movl  $42, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $53, %eax
+    movl  %eax, 8(%rsp)
+    subq  $32, %rsp
+    movq  -288(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  -292(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    leaq  -280(%rbp), %rax
+    movq  (%rax), %r10
+    movq  %r10, (%rsp)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  (%rsp), %rdx
+    movq  8(%rsp), %rcx
+    callq _mid_struct_and_some_ptr
+    addq  $32, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -308(%rbp), %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $32, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -340(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## local scalar init
+    leaq  -340(%rbp), %rax
+    addq  $1, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -340(%rbp), %rax
+    addq  $2, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -340(%rbp), %rax
+    addq  $3, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -340(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -340(%rbp), %rax
+    addq  $5, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -340(%rbp), %rax
+    addq  $6, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -340(%rbp), %rax
+    addq  $7, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -340(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -340(%rbp), %rax
+    addq  $9, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -340(%rbp), %rax
+    addq  $10, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -340(%rbp), %rax
+    addq  $11, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -340(%rbp), %rax
+    addq  $12, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -340(%rbp), %rax
+    addq  $13, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -340(%rbp), %rax
+    addq  $14, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -340(%rbp), %rax
+    addq  $15, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -340(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -340(%rbp), %rax
+    addq  $17, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -340(%rbp), %rax
+    addq  $18, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -340(%rbp), %rax
+    addq  $19, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -340(%rbp), %rax
+    addq  $20, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -340(%rbp), %rax
+    addq  $21, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -340(%rbp), %rax
+    addq  $22, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -340(%rbp), %rax
+    addq  $23, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -340(%rbp), %rax
+    addq  $24, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -340(%rbp), %rax
+    addq  $25, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -340(%rbp), %rax
+    addq  $26, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -340(%rbp), %rax
+    addq  $27, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -340(%rbp), %rax
+    addq  $28, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -340(%rbp), %rax
+    addq  $29, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -340(%rbp), %rax
+    addq  $30, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## local scalar init
+    leaq  -340(%rbp), %rax
+    addq  $31, %rax
+    pushq %rax
+    popq  %rax
+    movb  $0, %dl
+    movb  %dl, (%rax)
+## assign
+    leaq  -304(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movl  -308(%rbp), %eax
+    movslq %eax, %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _twice_long
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $32, %rsp
+    leaq  -340(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  _L_str_336(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movq  -304(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    movb  $0, %al
+    callq _sprintf
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  _L_str_337(%rip), %rax
+    movq  %rax, 8(%rsp)
+    leaq  -340(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _strcmp
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -368(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    leaq  _L_str_341(%rip), %rax
+    movq  %rax, 16(%rsp)
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -480(%rbp), %rdi
+    movq  16(%rsp), %rsi
+    movl  8(%rsp), %edx
+    callq _ret_struct_by_val
+    addq  $24, %rsp
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    movq  16(%rax), %r10
+    movq  %r10, 16(%rdx)
+    subq  $16, %rsp
+    movl  $30, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -368(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $41, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -368(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $52, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -368(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -392(%rbp), %rax
+    pushq %rax
+    movl  $111, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -392(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $222, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -392(%rbp), %rax
+    addq  $16, %rax
+    pushq %rax
+    movl  $333, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -392(%rbp), %rax
+    pushq %rax
+    subq  $40, %rsp
+    leaq  -392(%rbp), %rax
+    movq  (%rax), %r10
+    movq  %r10, (%rsp)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rsp)
+    movq  16(%rax), %r10
+    movq  %r10, 16(%rsp)
+    leaq  _L_str_341(%rip), %rax
+    movq  %rax, 32(%rsp)
+    movl  $23, %eax
+    movl  %eax, 24(%rsp)
+    leaq  -480(%rbp), %rdi
+    movq  32(%rsp), %rsi
+    movl  24(%rsp), %edx
+    callq _ret_struct_by_val_with_struct_param
+    addq  $40, %rsp
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    movq  16(%rax), %r10
+    movq  %r10, 16(%rdx)
+    subq  $16, %rsp
+    movl  $134, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -392(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $245, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -392(%rbp), %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $356, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -392(%rbp), %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -400(%rbp), %rax
+    pushq %rax
+    leaq  _num(%rip), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movl  $8, %eax
+    movl  %eax, 8(%rsp)
+    movl  $8, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $23012, %eax
+    movl  %eax, 8(%rsp)
+    callq *-400(%rbp)
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -408(%rbp), %rax
+    pushq %rax
+    leaq  _num(%rip), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movl  $8, %eax
+    movl  %eax, 8(%rsp)
+    movl  $8, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $23012, %eax
+    movl  %eax, 8(%rsp)
+    callq *-408(%rbp)
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -416(%rbp), %rax
+    pushq %rax
+    leaq  _twice_long(%rip), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movl  $8, %eax
+    movl  %eax, 8(%rsp)
+    movl  $8, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $246, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movl  $123, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq *-416(%rbp)
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _assertl
+    addq  $16, %rsp
+## assign
+    leaq  -424(%rbp), %rax
+    pushq %rax
+    leaq  _twice_long(%rip), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movl  $8, %eax
+    movl  %eax, 8(%rsp)
+    movl  $8, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $1998, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movl  $999, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq *-424(%rbp)
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _assertl
+    addq  $16, %rsp
+## assign
+    leaq  _function_pointer(%rip), %rax
+    pushq %rax
+    leaq  _num(%rip), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movl  $8, %eax
+    movl  %eax, 8(%rsp)
+    movl  $8, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $23012, %eax
+    movl  %eax, 8(%rsp)
+    callq *_function_pointer(%rip)
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $8, %eax
+    movl  %eax, 8(%rsp)
+    movl  $8, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $23012, %eax
+    movl  %eax, 8(%rsp)
+    callq *_function_pointer2_250(%rip)
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  _function_pointer3(%rip), %rax
+    pushq %rax
+    leaq  _twice_long(%rip), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movl  $8, %eax
+    movl  %eax, 8(%rsp)
+    movl  $8, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $982, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movl  $491, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq *_function_pointer3(%rip)
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $8, %eax
+    movl  %eax, 8(%rsp)
+    movl  $8, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $306, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $153, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq *_function_pointer4_257(%rip)
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _assertl
+    addq  $16, %rsp
+## local scalar init
+    leaq  -432(%rbp), %rax
+    pushq %rax
+    leaq  _num(%rip), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -440(%rbp), %rax
+    pushq %rax
+    leaq  _twice_long(%rip), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movl  $8, %eax
+    movl  %eax, 8(%rsp)
+    movl  $8, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $8, %eax
+    movl  %eax, 8(%rsp)
+    movl  $8, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $8, %eax
+    movl  %eax, 8(%rsp)
+    movl  $8, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $23012, %eax
+    movl  %eax, 8(%rsp)
+    callq *-432(%rbp)
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $8, %eax
+    movl  %eax, 8(%rsp)
+    movl  $8, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $462, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movl  $231, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq *-440(%rbp)
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _assertl
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1422, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $711, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq *-440(%rbp)
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _assertl
+    addq  $16, %rsp
+    movl  $0, %eax
+    jmp   _LBB13_0
+_LBB13_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
@@ -0,0 +1,335 @@
+#include "test.h"
+#include "test.h"
+#include "once.h"
+#include "once.h"
+/* the same file under other names */
+#include "./once.h"
+#include ".//once.h"
+
+int strcmp(const char *s1, const char *s2);
+
+#define ARRARY_SIZE 8
+#define ADD(x, y) ((x) + (y))
+#define SQUARE(x) ((x) * (x))
+#define FIVE() 5
+#define SIX( ) (FIVE() + 1)
+
+enum {
+    A = 123,
+    B = 456,
+    C = 789,
+    D = 111
+};
+/* cyclic define */
+#define A B
+#define B C
+#define C A
+#define D 999
+
+/* empty macro replacements */
+#define va_end(ap)
+#define NOTHING
+
+/* testing hideset for one macro apearing twice */
+#define SEVEN (7)
+#define OP(op) (SEVEN op SEVEN)
+
+/* testing long arg */
+#define LONG_ARG(a) a
+
+/* stringizing and token pasting */
+#define STR(x) #x
+#define CAT(a, b) a ## b
+#define XCAT(a, b) CAT(a, b)
+
+/* a function-like macro name coming from an expansion */
+#define ADD_NAME ADD
+
+/* deeper than the old hideset limit of 32 */
+#define CHAIN0 CHAIN1
+#define CHAIN1 CHAIN2
+#define CHAIN2 CHAIN3
+#define CHAIN3 CHAIN4
+#define CHAIN4 CHAIN5
+#define CHAIN5 CHAIN6
+#define CHAIN6 CHAIN7
+#define CHAIN7 CHAIN8
+#define CHAIN8 CHAIN9
+#define CHAIN9 CHAIN10
+#define CHAIN10 CHAIN11
+#define CHAIN11 CHAIN12
+#define CHAIN12 CHAIN13
+#define CHAIN13 CHAIN14
+#define CHAIN14 CHAIN15
+#define CHAIN15 CHAIN16
+#define CHAIN16 CHAIN17
+#define CHAIN17 CHAIN18
+#define CHAIN18 CHAIN19
+#define CHAIN19 CHAIN20
+#define CHAIN20 CHAIN21
+#define CHAIN21 CHAIN22
+#define CHAIN22 CHAIN23
+#define CHAIN23 CHAIN24
+#define CHAIN24 CHAIN25
+#define CHAIN25 CHAIN26
+#define CHAIN26 CHAIN27
+#define CHAIN27 CHAIN28
+#define CHAIN28 CHAIN29
+#define CHAIN29 CHAIN30
+#define CHAIN30 CHAIN31
+#define CHAIN31 CHAIN32
+#define CHAIN32 CHAIN33
+#define CHAIN33 CHAIN34
+#define CHAIN34 CHAIN35
+#define CHAIN35 CHAIN36
+#define CHAIN36 CHAIN37
+#define CHAIN37 CHAIN38
+#define CHAIN38 CHAIN39
+#define CHAIN39 CHAIN40
+#define CHAIN40 40
+
+int main()
+{
+    {
+        /* object-like macros */
+        int a[ARRARY_SIZE] = {11, 22, 33, 44};
+
+        assert(32, sizeof a);
+        assert(8, (sizeof a) / sizeof (a[0]));
+        assert(11, a[0]);
+        assert(22, a[1]);
+        assert(33, a[2]);
+        assert(44, a[3]);
+        assert(0,  a[4]);
+        assert(0,  a[5]);
+        assert(0,  a[6]);
+        assert(0,  a[7]);
+    }
+    {
+        /* function-like macros */
+        int x = ADD(39, 3);
+        int y = 4;
+
+        assert(42, x);
+        assert(20, SQUARE(y++));
+        assert(6, y);
+        assert(5, FIVE());
+        assert(6, SIX ( ));
+    }
+    {
+        /* cyclic define */
+        assert(123, A);
+        assert(456, B);
+        assert(789, C);
+        assert(999, D);
+    }
+    {
+        /* empty macro replacements */
+        int a = 42;
+
+        va_end(a);
+        NOTHING;
+
+        assert(42, a);
+    }
+    {
+        int a = OP(+);
+
+        assert(14, a);
+        assert(49, OP(*));
+    }
+    {
+        /* ifdef and ifndef */
+        int a = 13;
+
+#define FOO
+#ifdef FOO
+        a = 99;
+#endif
+        assert(99, a);
+
+#ifndef BAR
+        a = -12223;
+#endif
+
+#ifdef BAR
+        a = 723;
+#endif
+        assert(-12223, a);
+    }
+    {
+        const char *s = LONG_ARG("The comma operator has the lowest precedence of any C operator and acts as a sequence point");
+
+        assert(0, strcmp("The comma operator has the lowest precedence of any C operator and acts as a sequence point", s));
+    }
+    {
+        /* stringizing and token pasting */
+        int xy = 21;
+
+        assert(0, strcmp("a + b", STR(a + b)));
+        assert(0, strcmp("\"q\"", STR("q")));
+        assert(21, CAT(x, y));
+        assert(12, XCAT(1, 2));
+        assert(42, CAT(x, y) * 2);
+    }
+    {
+        /* arguments with commas in strings and spanning lines */
+        const char *s = LONG_ARG("a, b");
+        int a = ADD(1,
+                2);
+
+        assert(0, strcmp("a, b", s));
+        assert(3, a);
+        assert(7, ADD_NAME(3, 4));
+        assert(40, CHAIN0);
+    }
+    {
+        /* include guard and pragma once */
+        struct once o = {42};
+
+        assert(42, o.value);
+    }
+    {
+        /* if 0 */
+        int a = 19;
+#if 0
+        a = 42;
+#endif
+        assert(19, a);
+    }
+    {
+        /* nested conditionals and comments in skipped blocks */
+        int a = 7;
+#if 0
+#ifdef FOO
+        a = 1;
+#endif
+        a = 2;
+/*
+#endif
+*/
+        a = 3;
+#endif
+        assert(7, a);
+    }
+    {
+        /* comment delimiters in literals in skipped blocks */
+#if 0
+        char *s = "/*";
+#endif
+        int a = 3;
+#if 0
+        char c = '"';
+        char *t = "\"/*";
+#endif
+        a += 1;
+        assert(4, a);
+    }
+
+    {
+        /* if expressions */
+        int a = 0;
+#if (1 + 2) * 3 == 9 && -1 < 0 && (7 >> 1) == 3 && !0
+        a += 1;
+#endif
+#if defined(FOO) && defined BAR == 0 && !defined(BAZ)
+        a += 2;
+#endif
+#if 0 && 1 / 0
+        a += 100;
+#endif
+#if 1 || 1 / 0
+        a += 4;
+#endif
+#if defined FOO ? 'a' == 97 : 0
+        a += 8;
+#endif
+        assert(15, a);
+    }
+    {
+        /* unsigned if expressions */
+        int a = 0;
+#if -1 > 0u && 0xFFFFFFFFFFFFFFFF > 0 && (-1 < 0)
+        a += 1;
+#endif
+#if -2u / 2 > 0 && (-1u >> 63) == 1 && (-1 >> 63) == -1
+        a += 2;
+#endif
+#if (1 ? -1 : 0u) > 0 && -7u % 10 == 9 && 10UL / 3l == 3
+        a += 4;
+#endif
+        assert(7, a);
+    }
+    {
+        /* comments in if expressions */
+        int a = 0;
+#if 2 /* a comment over
+         two lines */ > 1 // and a line comment
+        a += 1;
+#elif 1 /* not
+           evaluated */
+        a += 2;
+#endif
+        assert(1, a);
+    }
+    {
+        /* elif and else */
+        int a = 0;
+#if 0
+        a = 1;
+#elif ADD(1, 2) == 3
+        a = 2;
+#elif 1
+        a = 3;
+#else
+        a = 4;
+#endif
+        assert(2, a);
+
+#ifdef BAR
+        a = 5;
+#else
+#if 0
+        a = 6;
+#elif 0
+        a = 7;
+#else
+        a = 8;
+#endif
+#endif
+        assert(8, a);
+
+#if 1
+        a = 9;
+#else
+#error not reached
+#endif
+        assert(9, a);
+    }
+
+    {
+        /* undef and expansions cached before */
+        int a, b, c;
+#define CACHED 1
+#define OUTER INNER
+#define TWICE(x) ((x) * 2)
+        int INNER = 3;
+        a = CACHED + OUTER + TWICE(5);
+#undef CACHED
+#define CACHED 20
+#define INNER 100
+        b = CACHED + OUTER + TWICE(5);
+#undef INNER
+#undef TWICE
+        c = OUTER;
+        assert(14, a);
+        assert(130, b);
+        assert(3, c);
+#ifdef TWICE
+        c = 0;
+#endif
+        assert(3, c);
+    }
+
+    return 0;
+}
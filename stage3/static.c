@@ -0,0 +1,69 @@
+#include "test.h"
+
+/* also built with --defer-static, where bodies of static functions are
+ * parsed only when the functions are named */
+typedef int num_t;
+
+static int called_later(int x);
+
+static int twice(int x)
+{
+    return 2 * x;
+}
+
+static int unused(int x)
+{
+    /* never parsed when deferred */
+    return twice(x) + 1;
+}
+
+static int called_by_helper(int x)
+{
+    return x + 1;
+}
+
+static int helper(int x)
+{
+    return called_by_helper(x) * 10;
+}
+
+static int labels(int n)
+{
+    int i = 0;
+loop:
+    if (i < n) {
+        i++;
+        goto loop;
+    }
+    return i;
+}
+
+static int (*fp)(int) = twice;
+
+static int with_locals(int x)
+{
+    num_t a = x;
+    num_t b[3] = {1, 2, 3};
+    {
+        int a = 100;
+        b[0] = a;
+    }
+    return a + b[0] + b[1] + b[2];
+}
+
+int main()
+{
+    assert(14, twice(7));
+    assert(60, helper(5));
+    assert(5, labels(5));
+    assert(18, fp(9));
+    assert(111, with_locals(6));
+    assert(42, called_later(41));
+
+    return 0;
+}
+
+static int called_later(int x)
+{
+    return x + 1;
+}
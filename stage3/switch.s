@@ -0,0 +1,605 @@
+    .data
+
+    .text
+
+    .global _foo
+_foo:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movl  %edi, -4(%rbp)
+## func body
+## switch-value
+    movl  -4(%rbp), %eax
+## begin jump table
+    cmpl  $0, %eax
+    je    _LBB1_135
+    cmpl  $1, %eax
+    je    _LBB1_136
+    cmpl  $2, %eax
+    je    _LBB1_137
+    cmpl  $3, %eax
+    je    _LBB1_138
+    jmp   _LBB1_139
+    jmp   _LBB1_2
+## end jump table
+_LBB1_135:
+_LBB1_136:
+    movl  $19, %eax
+    jmp   _LBB0_0
+_LBB1_137:
+_LBB1_138:
+    movl  $23, %eax
+    jmp   _LBB0_0
+_LBB1_139:
+    movl  $29, %eax
+    jmp   _LBB0_0
+_LBB1_2:
+_LBB0_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _bar
+_bar:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movl  %edi, -4(%rbp)
+    movl  %esi, -8(%rbp)
+## func body
+## switch-value
+    movl  -4(%rbp), %eax
+## begin jump table
+    cmpl  $0, %eax
+    je    _LBB3_151
+    cmpl  $1, %eax
+    je    _LBB3_152
+    cmpl  $2, %eax
+    je    _LBB3_160
+    cmpl  $3, %eax
+    je    _LBB3_161
+    jmp   _LBB3_162
+    jmp   _LBB3_2
+## end jump table
+_LBB3_151:
+_LBB3_152:
+## switch-value
+    movl  -8(%rbp), %eax
+## begin jump table
+    cmpl  $0, %eax
+    je    _LBB4_155
+    cmpl  $3, %eax
+    je    _LBB4_156
+    jmp   _LBB4_157
+    jmp   _LBB4_2
+## end jump table
+_LBB4_155:
+    movl  $119, %eax
+    jmp   _LBB2_0
+_LBB4_156:
+    movl  $211, %eax
+    jmp   _LBB2_0
+_LBB4_157:
+    jmp   _LBB4_2
+_LBB4_2:
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    jmp   _LBB2_0
+_LBB3_160:
+_LBB3_161:
+    movl  $23, %eax
+    jmp   _LBB2_0
+_LBB3_162:
+    movl  $29, %eax
+    jmp   _LBB2_0
+_LBB3_2:
+_LBB2_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _main
+_main:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+## func body
+## local scalar init
+    leaq  -4(%rbp), %rax
+    pushq %rax
+    movl  $11, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -8(%rbp), %rax
+    pushq %rax
+    movl  $100, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## switch-value
+    movl  -4(%rbp), %eax
+## begin jump table
+    cmpl  $1, %eax
+    je    _LBB6_175
+    cmpl  $2, %eax
+    je    _LBB6_176
+    cmpl  $11, %eax
+    je    _LBB6_177
+    cmpl  $13, %eax
+    je    _LBB6_187
+    jmp   _LBB6_188
+    jmp   _LBB6_2
+## end jump table
+_LBB6_175:
+    movl  -4(%rbp), %eax
+    jmp   _LBB5_0
+_LBB6_176:
+    jmp   _LBB6_2
+_LBB6_177:
+## switch-value
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  -8(%rbp), %eax
+    popq  %rdx
+    addl  %edx, %eax
+## begin jump table
+    cmpl  $110, %eax
+    je    _LBB7_180
+    cmpl  $111, %eax
+    je    _LBB7_181
+    cmpl  $1, %eax
+    je    _LBB7_182
+    cmpl  $2, %eax
+    je    _LBB7_183
+    cmpl  $11, %eax
+    je    _LBB7_184
+    jmp   _LBB7_2
+## end jump table
+_LBB7_180:
+## mul-assign
+    leaq  -4(%rbp), %rax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull (%rdx), %eax
+    movl  %eax, (%rdx)
+    jmp   _LBB7_2
+_LBB7_181:
+## mul-assign
+    leaq  -4(%rbp), %rax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull (%rdx), %eax
+    movl  %eax, (%rdx)
+    jmp   _LBB7_2
+_LBB7_182:
+## mul-assign
+    leaq  -4(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    popq  %rdx
+    imull (%rdx), %eax
+    movl  %eax, (%rdx)
+    jmp   _LBB7_2
+_LBB7_183:
+## mul-assign
+    leaq  -4(%rbp), %rax
+    pushq %rax
+    movl  $5, %eax
+    popq  %rdx
+    imull (%rdx), %eax
+    movl  %eax, (%rdx)
+    jmp   _LBB7_2
+_LBB7_184:
+## sub-assign
+    leaq  -4(%rbp), %rax
+    pushq %rax
+    movl  $5, %eax
+    popq  %rdx
+    subl  %eax, (%rdx)
+    movl  (%rdx), %eax
+    jmp   _LBB7_2
+_LBB7_2:
+## add-assign
+    leaq  -8(%rbp), %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $50, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    addl  %eax, (%rdx)
+    movl  (%rdx), %eax
+    jmp   _LBB6_2
+_LBB6_187:
+    movl  -4(%rbp), %eax
+    jmp   _LBB5_0
+_LBB6_188:
+    jmp   _LBB6_2
+_LBB6_2:
+    subq  $16, %rsp
+    movl  $33, %eax
+    movl  %eax, 8(%rsp)
+    movl  -4(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $50, %eax
+    movl  %eax, 8(%rsp)
+    movl  -8(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $100, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## switch-value
+    movl  -12(%rbp), %eax
+## begin jump table
+    cmpl  $1, %eax
+    je    _LBB8_197
+    cmpl  $2, %eax
+    je    _LBB8_198
+    cmpl  $11, %eax
+    je    _LBB8_199
+    cmpl  $13, %eax
+    je    _LBB8_200
+    jmp   _LBB8_201
+    jmp   _LBB8_2
+## end jump table
+_LBB8_197:
+## add-assign
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    movl  $10, %eax
+    popq  %rdx
+    addl  %eax, (%rdx)
+    movl  (%rdx), %eax
+_LBB8_198:
+## add-assign
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    movl  $13, %eax
+    popq  %rdx
+    addl  %eax, (%rdx)
+    movl  (%rdx), %eax
+_LBB8_199:
+## add-assign
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    movl  $37, %eax
+    popq  %rdx
+    addl  %eax, (%rdx)
+    movl  (%rdx), %eax
+    jmp   _LBB8_2
+_LBB8_200:
+## add-assign
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    movl  $97, %eax
+    popq  %rdx
+    addl  %eax, (%rdx)
+    movl  (%rdx), %eax
+    jmp   _LBB8_2
+_LBB8_201:
+    jmp   _LBB8_2
+_LBB8_2:
+    subq  $16, %rsp
+    movl  $61, %eax
+    movl  %eax, 8(%rsp)
+    movl  -12(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $100, %eax
+    movl  %eax, 8(%rsp)
+    movl  -16(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $42, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## switch-value
+    movl  $3, %eax
+## begin jump table
+    cmpl  $19, %eax
+    je    _LBB9_209
+    cmpl  $23, %eax
+    je    _LBB9_210
+    jmp   _LBB9_211
+    jmp   _LBB9_2
+## end jump table
+_LBB9_209:
+## assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB9_2
+_LBB9_210:
+## assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB9_2
+_LBB9_211:
+    jmp   _LBB9_2
+_LBB9_2:
+    subq  $16, %rsp
+    movl  $42, %eax
+    movl  %eax, 8(%rsp)
+    movl  -20(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## switch-value
+    movl  -24(%rbp), %eax
+## begin jump table
+    cmpl  $0, %eax
+    je    _LBB10_219
+    cmpl  $1, %eax
+    je    _LBB10_220
+    jmp   _LBB10_221
+    jmp   _LBB10_2
+## end jump table
+_LBB10_219:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $10, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB10_2
+_LBB10_220:
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $11, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB10_2
+_LBB10_221:
+    jmp   _LBB10_2
+_LBB10_2:
+    subq  $16, %rsp
+    movl  $10, %eax
+    movl  %eax, 8(%rsp)
+    movl  -24(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _foo
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _foo
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $23, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movl  $2, %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _foo
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $23, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movl  $3, %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _foo
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $29, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movl  $238, %eax
+    movl  %eax, 8(%rsp)
+    movl  8(%rsp), %edi
+    callq _foo
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $119, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    movl  $0, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _bar
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    movl  $1, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _bar
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $211, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movl  $3, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _bar
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $211, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    movl  $3, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _bar
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## switch-value
+    movl  -28(%rbp), %eax
+## begin jump table
+    cmpl  $0, %eax
+    je    _LBB11_233
+    cmpl  $1, %eax
+    je    _LBB11_234
+    jmp   _LBB11_2
+## end jump table
+_LBB11_233:
+## assign
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    movl  $10, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB11_2
+_LBB11_234:
+## assign
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    movl  $11, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB11_2
+_LBB11_2:
+    subq  $16, %rsp
+    movl  $3, %eax
+    movl  %eax, 8(%rsp)
+    movl  -28(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    movl  $0, %eax
+    jmp   _LBB5_0
+_LBB5_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
@@ -0,0 +1,11 @@
+#ifndef TEST_H
+#define TEST_H
+
+void assert(int expected, int actual);
+void assertl(long expected, long actual);
+void assertf(float expected, float actual);
+void assertd(double expected, double actual);
+
+void set_count(int val);
+
+#endif /* TEST_H */
@@ -0,0 +1,2207 @@
+    .data
+
+    .text
+
+_L_str_162:
+    .asciz "Hello"
+
+_L_str_271:
+    .asciz "\012"
+
+    .global _add
+_add:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movl  %edi, -4(%rbp)
+    movl  %esi, -8(%rbp)
+## func body
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  -8(%rbp), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    jmp   _LBB0_0
+_LBB0_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _add_var
+_add_var:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movq  %rdx, -24(%rbp)
+## func body
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+_LBB1_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _geti
+_geti:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    jmp   _LBB2_0
+_LBB2_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _getl
+_getl:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    jmp   _LBB3_0
+_LBB3_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _get_i3
+_get_i3:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rbp, %r10
+    subq  $16, %r10
+    movq  %rdi, (%r10)
+    movq  %rsi, 8(%r10)
+## func body
+    leaq  -16(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    jmp   _LBB4_0
+_LBB4_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _get_l3
+_get_l3:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rbp, %r10
+    subq  $16, %r10
+    movq  %rdi, (%r10)
+    movq  %rsi, 8(%r10)
+## func body
+    leaq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    jmp   _LBB5_0
+_LBB5_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _get_s3
+_get_s3:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rbp, %r10
+    subq  $16, %r10
+    movq  %rdi, (%r10)
+    movq  %rsi, 8(%r10)
+## func body
+    leaq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    jmp   _LBB6_0
+_LBB6_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _get_var
+_get_var:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+## func body
+## local scalar init
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    movl  $1301, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -12(%rbp), %rax
+    addq  $4, %rax
+    pushq %rax
+    movl  $223922, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -12(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $3973, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -32(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    leaq  -12(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movl  8(%rax), %r10d
+    movl  %r10d, 8(%rdx)
+    leaq  -32(%rbp), %rax
+    movq  %rax, %rsi
+    movq  (%rsi), %rax
+    movq  8(%rsi), %rdx
+    jmp   _LBB7_0
+_LBB7_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _copy_var
+_copy_var:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## if-cond
+    movq  -8(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB11_2
+    movq  -16(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB11_2
+    movl  $0, %eax
+_LBB11_2:
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB10_2
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $1, %eax
+    jne   _LBB10_2
+    movl  $0, %eax
+_LBB10_2:
+    cmpl  $0, %eax
+    je    _LBB9_3
+## if-then
+    jmp   _LBB8_0
+    jmp   _LBB9_2
+## if-else
+_LBB9_3:
+_LBB9_2:
+## assign
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+_LBB8_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _geti_
+_geti_:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+    leaq  -8(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    jmp   _LBB12_0
+_LBB12_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _getl_
+_getl_:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+    leaq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    jmp   _LBB13_0
+_LBB13_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _get_u8
+_get_u8:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+## func body
+## local scalar init
+    leaq  -8(%rbp), %rax
+    pushq %rax
+    movl  $71, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    movq  -8(%rbp), %rax
+    jmp   _LBB14_0
+_LBB14_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _coord_x
+_coord_x:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rbp, %rax
+    addq  $16, %rax
+    movq  (%rax), %r10
+    movq  %r10, -24(%rbp)
+    movq  8(%rax), %r10
+    movq  %r10, -16(%rbp)
+    movq  16(%rax), %r10
+    movq  %r10, -8(%rbp)
+## func body
+    leaq  -24(%rbp), %rax
+    addq  $0, %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    jmp   _LBB15_0
+_LBB15_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _coord_y
+_coord_y:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rbp, %rax
+    addq  $16, %rax
+    movq  (%rax), %r10
+    movq  %r10, -24(%rbp)
+    movq  8(%rax), %r10
+    movq  %r10, -16(%rbp)
+    movq  16(%rax), %r10
+    movq  %r10, -8(%rbp)
+## func body
+    leaq  -24(%rbp), %rax
+    addq  $0, %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    jmp   _LBB16_0
+_LBB16_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _coord_z
+_coord_z:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+    movq  %rbp, %rax
+    addq  $16, %rax
+    movq  (%rax), %r10
+    movq  %r10, -24(%rbp)
+    movq  8(%rax), %r10
+    movq  %r10, -16(%rbp)
+    movq  16(%rax), %r10
+    movq  %r10, -8(%rbp)
+## func body
+    leaq  -24(%rbp), %rax
+    addq  $0, %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    jmp   _LBB17_0
+_LBB17_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _get_coord
+_get_coord:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $32, %rsp
+## func params
+## save address to returning value
+    pushq %rdi
+## func body
+## assign
+    leaq  -24(%rbp), %rax
+    addq  $0, %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $72340, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -24(%rbp), %rax
+    addq  $0, %rax
+    addq  $8, %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1230889, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -24(%rbp), %rax
+    addq  $0, %rax
+    addq  $16, %rax
+    pushq %rax
+    movl  $91355, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    leaq  -24(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    movq  16(%rax), %r10
+    movq  %r10, 16(%rdx)
+    movq  %rdx, %rax
+    jmp   _LBB18_0
+_LBB18_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _main
+_main:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $448, %rsp
+## func params
+## func body
+## assign
+    leaq  -16(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $32, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $32, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -16(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    leaq  -16(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movl  $123, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $123, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, 8(%rsp)
+    movq  -24(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $123, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, 8(%rsp)
+    leaq  -16(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -16(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  $-1, %rax
+    pushq %rax
+    movq  $22130193123, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movq  $22130193123, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movq  %rax, 8(%rsp)
+    leaq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _assertl
+    addq  $16, %rsp
+## assign
+    leaq  -16(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    leaq  _L_str_162(%rip), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movl  $72, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $101, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $108, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $108, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $111, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $4, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -16(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $5, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    leaq  -40(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -48(%rbp), %rax
+    addq  $0, %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $9, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $9, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -40(%rbp), %rax
+    addq  $0, %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    movq  -48(%rbp), %rax
+    addq  $0, %rax
+    addq  $4, %rax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $3, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -40(%rbp), %rax
+    addq  $0, %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $12, %eax
+    movl  %eax, 8(%rsp)
+    movq  -48(%rbp), %rax
+    addq  $0, %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movq  -48(%rbp), %rax
+    addq  $0, %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $8, %eax
+    movl  %eax, 8(%rsp)
+    movl  $8, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $16, %eax
+    movl  %eax, 8(%rsp)
+    movl  $16, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $16, %eax
+    movl  %eax, 8(%rsp)
+    movl  $16, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movl  $4, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $16, %eax
+    movl  %eax, 8(%rsp)
+    movl  $16, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -52(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $121, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -56(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $111, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $121, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -52(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $111, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -56(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $10, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -52(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    leaq  -56(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, %edx
+    popq  %rax
+    subl  %edx, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movl  $4, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -52(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $99231, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $99231, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -52(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -68(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $142, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -68(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $42, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $142, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -68(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $42, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -68(%rbp), %rax
+    pushq %rax
+    movl  $4, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -112(%rbp), %rax
+    pushq %rax
+    leaq  -104(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -88(%rbp), %rax
+    addq  $0, %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $123, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -104(%rbp), %rax
+    addq  $0, %rax
+    addq  $4, %rax
+    pushq %rax
+    movl  $23, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $123, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -88(%rbp), %rax
+    addq  $0, %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $23, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -104(%rbp), %rax
+    addq  $0, %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    movq  -112(%rbp), %rax
+    addq  $0, %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $31, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -112(%rbp), %rax
+    addq  $0, %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $91, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $31, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -104(%rbp), %rax
+    addq  $0, %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $91, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -104(%rbp), %rax
+    addq  $0, %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -120(%rbp), %rax
+    addq  $0, %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $19, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -120(%rbp), %rax
+    addq  $0, %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $23, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $23, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -120(%rbp), %rax
+    addq  $0, %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $23, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -120(%rbp), %rax
+    addq  $0, %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $46, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -120(%rbp), %rax
+    addq  $0, %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    leaq  -120(%rbp), %rax
+    addq  $0, %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -128(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $111, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -128(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $19, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -128(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $19, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -128(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $38, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -128(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    leaq  -128(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -136(%rbp), %rax
+    pushq %rax
+    movl  $11, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $11, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -136(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -136(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    leaq  _L_str_162(%rip), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movl  $72, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -136(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $101, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -136(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $108, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -136(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $108, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -136(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $111, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -136(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $4, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $0, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -136(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $5, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -140(%rbp), %rax
+    pushq %rax
+    movl  $11, %eax
+    pushq %rax
+    movl  $12, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    pushq %rax
+    movl  $13, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -144(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $4, %eax
+    movl  %eax, 16(%rsp)
+    movl  $5, %eax
+    movl  %eax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movl  8(%rsp), %esi
+    callq _add
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $36, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -140(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $9, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -144(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movl  $4, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -148(%rbp), %rax
+    pushq %rax
+    movl  $29, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movl  $4, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $29, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -148(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $29, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -148(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -168(%rbp), %rax
+    pushq %rax
+    movl  $42, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -184(%rbp), %rax
+    pushq %rax
+    movl  $13, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $42, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  -168(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _geti
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $42, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -168(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -184(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $49, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movl  $49, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  -184(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _getl
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _assertl
+    addq  $16, %rsp
+## assign
+    leaq  -184(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $13, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $32, %rsp
+    leaq  -200(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    leaq  -168(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    leaq  -184(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _add_var
+    addq  $32, %rsp
+    subq  $16, %rsp
+    movl  $55, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  -200(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _geti
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -200(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $120, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movl  $120, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  -200(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _getl
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _assertl
+    addq  $16, %rsp
+## local scalar init
+    leaq  -216(%rbp), %rax
+    pushq %rax
+    movl  $79, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -232(%rbp), %rax
+    pushq %rax
+    leaq  -216(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    subq  $16, %rsp
+    movl  $79, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -216(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $79, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -232(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -248(%rbp), %rax
+    pushq %rax
+    movl  $111, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -264(%rbp), %rax
+    pushq %rax
+    leaq  -248(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    subq  $16, %rsp
+    movl  $111, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -248(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $111, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -264(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -272(%rbp), %rax
+    pushq %rax
+    movl  $14, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $8, %eax
+    movl  %eax, 8(%rsp)
+    movl  $8, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $14, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -272(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _geti_
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $14, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -272(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -272(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $17, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movl  $17, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    movq  -272(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _getl_
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _assertl
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $17, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    leaq  -272(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _assertl
+    addq  $16, %rsp
+## local scalar init
+    leaq  -288(%rbp), %rax
+    pushq %rax
+    movl  $41, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $16, %eax
+    movl  %eax, 8(%rsp)
+    movl  $16, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $41, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  -288(%rbp), %rax
+    movq  (%rax), %r10
+    movq  %r10, (%rsp)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rsp)
+    movq  (%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _get_i3
+    addq  $16, %rsp
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $41, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -288(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -288(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $71, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movl  $71, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  -288(%rbp), %rax
+    movq  (%rax), %r10
+    movq  %r10, (%rsp)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rsp)
+    movq  (%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _get_l3
+    addq  $16, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _assertl
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $71, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    leaq  -288(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _assertl
+    addq  $16, %rsp
+## assign
+    leaq  -288(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    leaq  _L_str_271(%rip), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movl  $10, %eax
+    movl  %eax, 8(%rsp)
+    subq  $16, %rsp
+    leaq  -288(%rbp), %rax
+    movq  (%rax), %r10
+    movq  %r10, (%rsp)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rsp)
+    movq  (%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _get_s3
+    addq  $16, %rsp
+    pushq %rax
+    movl  $1, %eax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $24, %eax
+    movl  %eax, 8(%rsp)
+    movl  $24, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -312(%rbp), %rax
+    addq  $0, %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $111, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -312(%rbp), %rax
+    addq  $0, %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $222, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    leaq  -312(%rbp), %rax
+    addq  $0, %rax
+    addq  $16, %rax
+    pushq %rax
+    movl  $199, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movl  $111, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    subq  $32, %rsp
+    leaq  -312(%rbp), %rax
+    movq  (%rax), %r10
+    movq  %r10, (%rsp)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rsp)
+    movq  16(%rax), %r10
+    movq  %r10, 16(%rsp)
+    callq _coord_x
+    addq  $32, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _assertl
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $111, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    leaq  -312(%rbp), %rax
+    addq  $0, %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _assertl
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $222, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    subq  $32, %rsp
+    leaq  -312(%rbp), %rax
+    movq  (%rax), %r10
+    movq  %r10, (%rsp)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rsp)
+    movq  16(%rax), %r10
+    movq  %r10, 16(%rsp)
+    callq _coord_y
+    addq  $32, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _assertl
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $222, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    leaq  -312(%rbp), %rax
+    addq  $0, %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _assertl
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $199, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    subq  $32, %rsp
+    leaq  -312(%rbp), %rax
+    movq  (%rax), %r10
+    movq  %r10, (%rsp)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rsp)
+    movq  16(%rax), %r10
+    movq  %r10, 16(%rsp)
+    callq _coord_z
+    addq  $32, %rsp
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _assertl
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $199, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    leaq  -312(%rbp), %rax
+    addq  $0, %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _assertl
+    addq  $16, %rsp
+## local scalar init
+    leaq  -320(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    callq _get_u8
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movl  $8, %eax
+    movl  %eax, 8(%rsp)
+    movl  $8, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $71, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -320(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -336(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    callq _get_var
+    addq  $8, %rsp
+    movq  %rax, -448(%rbp)
+    movq  %rdx, -440(%rbp)
+    leaq  -448(%rbp), %rax
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    subq  $16, %rsp
+    movl  $16, %eax
+    movl  %eax, 8(%rsp)
+    movl  $16, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $1301, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -336(%rbp), %rax
+    addq  $0, %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $223922, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -336(%rbp), %rax
+    addq  $0, %rax
+    addq  $4, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $3973, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movl  %eax, 8(%rsp)
+    leaq  -336(%rbp), %rax
+    addq  $0, %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -360(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    leaq  -448(%rbp), %rdi
+    callq _get_coord
+    addq  $8, %rsp
+    popq  %rdx
+    movq  (%rax), %r10
+    movq  %r10, (%rdx)
+    movq  8(%rax), %r10
+    movq  %r10, 8(%rdx)
+    movq  16(%rax), %r10
+    movq  %r10, 16(%rdx)
+    subq  $16, %rsp
+    movl  $24, %eax
+    movl  %eax, 8(%rsp)
+    movl  $24, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $72340, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    leaq  -360(%rbp), %rax
+    addq  $0, %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _assertl
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  $-1, %rax
+    pushq %rax
+    movl  $1230889, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    movq  %rax, 8(%rsp)
+    leaq  -360(%rbp), %rax
+    addq  $0, %rax
+    addq  $8, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _assertl
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $91355, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    leaq  -360(%rbp), %rax
+    addq  $0, %rax
+    addq  $16, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _assertl
+    addq  $16, %rsp
+## local scalar init
+    leaq  -376(%rbp), %rax
+    pushq %rax
+    movl  $911, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    leaq  -392(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    leaq  -376(%rbp), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _copy_var
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $911, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -392(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -392(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $822, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $16, %rsp
+    movl  $822, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    leaq  -392(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, (%rsp)
+    movq  8(%rsp), %rdi
+    movq  (%rsp), %rsi
+    callq _assertl
+    addq  $16, %rsp
+## assign
+    leaq  -400(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movl  $123, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $123, %eax
+    movl  %eax, 8(%rsp)
+    leaq  -400(%rbp), %rax
+    addq  $0, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movl  $1, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $2, %eax
+    movl  %eax, 8(%rsp)
+    movl  $2, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $2, %eax
+    movl  %eax, 8(%rsp)
+    movl  $2, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movl  $4, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movl  $4, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movl  $4, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $4, %eax
+    movl  %eax, 8(%rsp)
+    movl  $4, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $8, %eax
+    movl  %eax, 8(%rsp)
+    movl  $8, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $2, %eax
+    movl  %eax, 8(%rsp)
+    movl  $2, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $8, %eax
+    movl  %eax, 8(%rsp)
+    movl  $8, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    movl  $0, %eax
+    jmp   _LBB19_0
+_LBB19_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
@@ -0,0 +1,739 @@
+    .data
+
+    .text
+
+_L_str_94:
+    .asciz "abc"
+
+    .global _foo
+_foo:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+## func body
+## local scalar init
+    leaq  -4(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## while-cond
+_LBB1_4:
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  $10, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB1_2
+## while-body
+## assign
+    leaq  -4(%rbp), %rax
+    pushq %rax
+    movl  $2, %eax
+    pushq %rax
+    movl  -4(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB1_4
+_LBB1_2:
+    subq  $16, %rsp
+    movl  $15, %eax
+    movl  %eax, 8(%rsp)
+    movl  -4(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    movl  -4(%rbp), %eax
+    jmp   _LBB0_0
+_LBB0_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _num
+_num:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+## func body
+## assign
+    leaq  -4(%rbp), %rax
+    pushq %rax
+    movl  $7, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    movl  -4(%rbp), %eax
+    jmp   _LBB2_0
+_LBB2_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _add
+_add:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movl  %edi, -4(%rbp)
+    movl  %esi, -8(%rbp)
+## func body
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  -8(%rbp), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    jmp   _LBB3_0
+_LBB3_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _main
+_main:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $112, %rsp
+## func params
+## func body
+## assign
+    leaq  -4(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $21, %eax
+    movl  %eax, 16(%rsp)
+    movl  $7, %eax
+    movl  %eax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movl  8(%rsp), %esi
+    callq _add
+    addq  $24, %rsp
+    pushq %rax
+    movl  $2, %eax
+    pushq %rax
+    subq  $8, %rsp
+    callq _num
+    addq  $8, %rsp
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $42, %eax
+    movl  %eax, 8(%rsp)
+    movl  -4(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -8(%rbp), %rax
+    pushq %rax
+    movl  $42, %eax
+    pushq %rax
+    callq _num
+    movl  %eax, %edi
+    popq  %rax
+    cltd
+    idivl %edi
+    pushq %rax
+    movl  $7, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movl  -8(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## assign
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    callq _foo
+    addq  $8, %rsp
+    pushq %rax
+    movl  $14, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setg  %al
+    movzbl %al, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $1, %eax
+    movl  %eax, 8(%rsp)
+    movl  -12(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movl  $44, %eax
+    movl  %eax, 8(%rsp)
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  -8(%rbp), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## while-cond
+_LBB5_4:
+    movl  -20(%rbp), %eax
+    pushq %rax
+    movl  $10, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB5_2
+## while-body
+    leaq  -20(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  -16(%rbp), %eax
+    pushq %rax
+    movl  -20(%rbp), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB5_4
+_LBB5_2:
+    subq  $16, %rsp
+    movl  $55, %eax
+    movl  %eax, 8(%rsp)
+    movl  -16(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## do-while-body
+_LBB6_1:
+    leaq  -28(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  -24(%rbp), %eax
+    pushq %rax
+    movl  -28(%rbp), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## do-while-cond
+_LBB6_4:
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movl  $10, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB6_2
+    jmp   _LBB6_1
+_LBB6_2:
+    subq  $16, %rsp
+    movl  $55, %eax
+    movl  %eax, 8(%rsp)
+    movl  -24(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## do-while-body
+_LBB7_1:
+    leaq  -32(%rbp), %rax
+    movl  (%rax), %edx
+    addl  $1, %edx
+    movl  %edx, (%rax)
+    movl  %edx, %eax
+## do-while-cond
+_LBB7_4:
+    movl  -32(%rbp), %eax
+    pushq %rax
+    movl  $10, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB7_2
+    jmp   _LBB7_1
+_LBB7_2:
+    subq  $16, %rsp
+    movl  $10, %eax
+    movl  %eax, 8(%rsp)
+    movl  -32(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -36(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## while-cond
+_LBB8_4:
+    movl  -36(%rbp), %eax
+    pushq %rax
+    movl  $10, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB8_2
+## while-body
+## if-cond
+    leaq  -36(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    pushq %rax
+    movl  $6, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB9_3
+## if-then
+    jmp   _LBB8_2
+    jmp   _LBB9_2
+## if-else
+_LBB9_3:
+_LBB9_2:
+    jmp   _LBB8_4
+_LBB8_2:
+    subq  $16, %rsp
+    movl  $7, %eax
+    movl  %eax, 8(%rsp)
+    movl  -36(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## while-cond
+_LBB10_4:
+    movl  $1, %eax
+    cmpl  $0, %eax
+    je    _LBB10_2
+## while-body
+## if-cond
+    movl  -40(%rbp), %eax
+    pushq %rax
+    movl  $3, %eax
+    movl  %eax, %edi
+    popq  %rax
+    cltd
+    idivl %edi
+    pushq %rax
+    movl  $4, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB11_3
+## if-then
+## if-cond
+    movl  -40(%rbp), %eax
+    pushq %rax
+    movl  $6, %eax
+    movl  %eax, %edi
+    popq  %rax
+    cltd
+    idivl %edi
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB12_3
+## if-then
+    jmp   _LBB10_2
+    jmp   _LBB12_2
+## if-else
+_LBB12_3:
+_LBB12_2:
+    jmp   _LBB11_2
+## if-else
+_LBB11_3:
+_LBB11_2:
+    leaq  -40(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB10_4
+_LBB10_2:
+    subq  $16, %rsp
+    movl  $12, %eax
+    movl  %eax, 8(%rsp)
+    movl  -40(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -44(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## while-cond
+_LBB13_4:
+    movl  -48(%rbp), %eax
+    pushq %rax
+    movl  $20, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB13_2
+## while-body
+## if-cond
+    movl  -48(%rbp), %eax
+    pushq %rax
+    movl  $3, %eax
+    movl  %eax, %edi
+    popq  %rax
+    cltd
+    idivl %edi
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB14_3
+## if-then
+## add-assign
+    leaq  -44(%rbp), %rax
+    pushq %rax
+    movl  -48(%rbp), %eax
+    popq  %rdx
+    addl  %eax, (%rdx)
+    movl  (%rdx), %eax
+    leaq  -48(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB13_4
+    jmp   _LBB14_2
+## if-else
+_LBB14_3:
+_LBB14_2:
+    leaq  -48(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB13_4
+_LBB13_2:
+    subq  $16, %rsp
+    movl  $30, %eax
+    movl  %eax, 8(%rsp)
+    movl  -44(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -52(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## do-while-body
+_LBB15_1:
+## if-cond
+    movl  -56(%rbp), %eax
+    pushq %rax
+    movl  $3, %eax
+    movl  %eax, %edi
+    popq  %rax
+    cltd
+    idivl %edi
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB16_3
+## if-then
+## add-assign
+    leaq  -52(%rbp), %rax
+    pushq %rax
+    movl  -56(%rbp), %eax
+    popq  %rdx
+    addl  %eax, (%rdx)
+    movl  (%rdx), %eax
+    leaq  -56(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB15_4
+    jmp   _LBB16_2
+## if-else
+_LBB16_3:
+_LBB16_2:
+    leaq  -56(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+## do-while-cond
+_LBB15_4:
+    movl  -56(%rbp), %eax
+    pushq %rax
+    movl  $20, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB15_2
+    jmp   _LBB15_1
+_LBB15_2:
+    subq  $16, %rsp
+    movl  $30, %eax
+    movl  %eax, 8(%rsp)
+    movl  -52(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -64(%rbp), %rax
+    pushq %rax
+    leaq  _L_str_94(%rip), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -72(%rbp), %rax
+    pushq %rax
+    movq  -64(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -76(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## while-cond
+_LBB17_4:
+    movq  -72(%rbp), %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    je    _LBB17_2
+## while-body
+## add-assign
+    leaq  -76(%rbp), %rax
+    pushq %rax
+    movq  -72(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    popq  %rdx
+    addl  %eax, (%rdx)
+    movl  (%rdx), %eax
+    leaq  -72(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    jmp   _LBB17_4
+_LBB17_2:
+    subq  $16, %rsp
+    movl  $294, %eax
+    movl  %eax, 8(%rsp)
+    movl  -76(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -88(%rbp), %rax
+    pushq %rax
+    leaq  _L_str_94(%rip), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -96(%rbp), %rax
+    pushq %rax
+    movq  -88(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -100(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## do-while-body
+_LBB18_1:
+## add-assign
+    leaq  -100(%rbp), %rax
+    pushq %rax
+    movq  -96(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    popq  %rdx
+    addl  %eax, (%rdx)
+    movl  (%rdx), %eax
+    leaq  -96(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+## do-while-cond
+_LBB18_4:
+    movq  -96(%rbp), %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    je    _LBB18_2
+    jmp   _LBB18_1
+_LBB18_2:
+    subq  $16, %rsp
+    movl  $294, %eax
+    movl  %eax, 8(%rsp)
+    movl  -100(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    movl  $0, %eax
+    jmp   _LBB4_0
+_LBB4_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
@@ -0,0 +1,753 @@
+    .data
+
+    .text
+
+_hash_fn:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+## local scalar init
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-pre
+## for-cond
+_LBB1_1:
+    movq  -32(%rbp), %rax
+    pushq %rax
+    movq  -40(%rbp), %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    setne %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB1_2
+## for-body
+## assign
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $31, %eax
+    pushq %rax
+    movl  -20(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    movb  (%rax), %al
+    movzbl %al, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-post
+_LBB1_4:
+    leaq  -32(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    jmp   _LBB1_1
+_LBB1_2:
+    movl  -20(%rbp), %eax
+    jmp   _LBB0_0
+_LBB0_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_find_entry:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $64, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movl  %esi, -12(%rbp)
+    movq  %rdx, -24(%rbp)
+    movq  %rcx, -32(%rbp)
+    movl  %r8d, -36(%rbp)
+## func body
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $1, %eax
+    movl  %eax, %edx
+    popq  %rax
+    subl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-pre
+## assign
+    leaq  -44(%rbp), %rax
+    pushq %rax
+    movl  -36(%rbp), %eax
+    pushq %rax
+    movl  -40(%rbp), %eax
+    popq  %rdx
+    andl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB3_1:
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $16, %eax
+    pushq %rax
+    movl  -44(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    je    _LBB3_2
+## for-body
+## local scalar init
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $16, %eax
+    pushq %rax
+    movl  -44(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -56(%rbp), %rax
+    addq  $12, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  -36(%rbp), %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB6_2
+    movq  -56(%rbp), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    movl  %eax, %eax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    popq  %rdx
+    cmpq  %rdx, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB6_2
+    movl  $1, %eax
+_LBB6_2:
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB5_2
+    subq  $32, %rsp
+    movq  -56(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 24(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -32(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _memcmp
+    addq  $32, %rsp
+    cmpl  $0, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    movl  $0, %eax
+    je    _LBB5_2
+    movl  $1, %eax
+_LBB5_2:
+    cmpl  $0, %eax
+    je    _LBB4_3
+## if-then
+    jmp   _LBB3_2
+    jmp   _LBB4_2
+## if-else
+_LBB4_3:
+_LBB4_2:
+## for-post
+_LBB3_4:
+## assign
+    leaq  -44(%rbp), %rax
+    pushq %rax
+    movl  -44(%rbp), %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    pushq %rax
+    movl  -40(%rbp), %eax
+    popq  %rdx
+    andl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    jmp   _LBB3_1
+_LBB3_2:
+    movq  -8(%rbp), %rax
+    pushq %rax
+    movl  $16, %eax
+    pushq %rax
+    movl  -44(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    jmp   _LBB2_0
+_LBB2_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+_grow_table:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## mul-assign
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    imull (%rdx), %eax
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    movslq %eax, %rax
+    movq  %rax, 16(%rsp)
+    movl  $16, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _calloc
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## for-pre
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB8_1:
+    movl  -24(%rbp), %eax
+    pushq %rax
+    movl  -20(%rbp), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB8_2
+## for-body
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movq  -16(%rbp), %rax
+    pushq %rax
+    movl  $16, %eax
+    pushq %rax
+    movl  -24(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    popq  %rdx
+    addq  %rdx, %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -32(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB9_3
+## if-then
+    jmp   _LBB8_4
+    jmp   _LBB9_2
+## if-else
+_LBB9_3:
+_LBB9_2:
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $40, %rsp
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 32(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    movl  %eax, 24(%rsp)
+    movq  -32(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 16(%rsp)
+    movq  -32(%rbp), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    movl  %eax, %eax
+    movq  %rax, 8(%rsp)
+    movq  -32(%rbp), %rax
+    addq  $12, %rax
+    movl  (%rax), %eax
+    movl  %eax, (%rsp)
+    movq  32(%rsp), %rdi
+    movl  24(%rsp), %esi
+    movq  16(%rsp), %rdx
+    movq  8(%rsp), %rcx
+    movl  (%rsp), %r8d
+    callq _find_entry
+    addq  $40, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -40(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -40(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -40(%rbp), %rax
+    addq  $12, %rax
+    pushq %rax
+    movq  -32(%rbp), %rax
+    addq  $12, %rax
+    movl  (%rax), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-post
+_LBB8_4:
+    leaq  -24(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB8_1
+_LBB8_2:
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+_LBB7_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _new_string_table
+_new_string_table:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+## func body
+## local scalar init
+    leaq  -8(%rbp), %rax
+    pushq %rax
+    subq  $8, %rsp
+    movl  $16, %eax
+    movslq %eax, %rax
+    movq  %rax, (%rsp)
+    movq  (%rsp), %rdi
+    callq _malloc
+    addq  $8, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $1024, %eax
+    movslq %eax, %rax
+    movq  %rax, 16(%rsp)
+    movl  $16, %eax
+    movslq %eax, %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _calloc
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movl  $1024, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -8(%rbp), %rax
+    addq  $12, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    movq  -8(%rbp), %rax
+    jmp   _LBB10_0
+_LBB10_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _free_string_table
+_free_string_table:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+## func body
+## if-cond
+    movq  -8(%rbp), %rax
+    cmpq  $0, %rax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB12_3
+## if-then
+    jmp   _LBB11_0
+    jmp   _LBB12_2
+## if-else
+_LBB12_3:
+_LBB12_2:
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _free
+    addq  $16, %rsp
+_LBB11_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _insert_string
+_insert_string:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $16, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+## func body
+    subq  $32, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    subq  $16, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _strlen
+    addq  $16, %rsp
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _insert_string_len
+    addq  $32, %rsp
+    jmp   _LBB13_0
+_LBB13_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
+    .global _insert_string_len
+_insert_string_len:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $48, %rsp
+## func params
+    movq  %rdi, -8(%rbp)
+    movq  %rsi, -16(%rbp)
+    movq  %rdx, -24(%rbp)
+## func body
+## local scalar init
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  16(%rsp), %rdi
+    movq  8(%rsp), %rsi
+    callq _hash_fn
+    addq  $24, %rsp
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $40, %rsp
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 32(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    movl  %eax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -28(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  32(%rsp), %rdi
+    movl  24(%rsp), %esi
+    movq  16(%rsp), %rdx
+    movq  8(%rsp), %rcx
+    movl  (%rsp), %r8d
+    callq _find_entry
+    addq  $40, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+## if-cond
+    movq  -40(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    cmpq  $0, %rax
+    je    _LBB15_3
+## if-then
+    movq  -40(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    jmp   _LBB14_0
+    jmp   _LBB15_2
+## if-else
+_LBB15_3:
+_LBB15_2:
+## if-cond
+    movl  $2, %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $12, %rax
+    movl  (%rax), %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    imull %edx, %eax
+    pushq %rax
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setg  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB16_3
+## if-then
+    subq  $16, %rsp
+    movq  -8(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  8(%rsp), %rdi
+    callq _grow_table
+    addq  $16, %rsp
+## assign
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    subq  $40, %rsp
+    movq  -8(%rbp), %rax
+    addq  $0, %rax
+    movq  (%rax), %rax
+    movq  %rax, 32(%rsp)
+    movq  -8(%rbp), %rax
+    addq  $8, %rax
+    movl  (%rax), %eax
+    movl  %eax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movl  -28(%rbp), %eax
+    movl  %eax, (%rsp)
+    movq  32(%rsp), %rdi
+    movl  24(%rsp), %esi
+    movq  16(%rsp), %rdx
+    movq  8(%rsp), %rcx
+    movl  (%rsp), %r8d
+    callq _find_entry
+    addq  $40, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    jmp   _LBB16_2
+## if-else
+_LBB16_3:
+_LBB16_2:
+## assign
+    leaq  -48(%rbp), %rax
+    pushq %rax
+    subq  $24, %rsp
+    movl  $3, %eax
+    movl  %eax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    movq  %rax, 8(%rsp)
+    movl  16(%rsp), %edi
+    movq  8(%rsp), %rsi
+    callq _arena_alloc
+    addq  $24, %rsp
+    popq  %rdx
+    movq  %rax, (%rdx)
+    subq  $32, %rsp
+    movq  -48(%rbp), %rax
+    movq  %rax, 24(%rsp)
+    movq  -16(%rbp), %rax
+    movq  %rax, 16(%rsp)
+    movq  -24(%rbp), %rax
+    movq  %rax, 8(%rsp)
+    movq  24(%rsp), %rdi
+    movq  16(%rsp), %rsi
+    movq  8(%rsp), %rdx
+    callq _memcpy
+    addq  $32, %rsp
+## assign
+    movq  -48(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    movslq %eax, %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    popq  %rdx
+    imulq %rdx, %rax
+    popq  %rdx
+    addq  %rdx, %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movb  %al, (%rdx)
+## assign
+    movq  -40(%rbp), %rax
+    addq  $0, %rax
+    pushq %rax
+    movq  -48(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## assign
+    movq  -40(%rbp), %rax
+    addq  $8, %rax
+    pushq %rax
+    movq  -24(%rbp), %rax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## assign
+    movq  -40(%rbp), %rax
+    addq  $12, %rax
+    pushq %rax
+    movl  -28(%rbp), %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    movq  -8(%rbp), %rax
+    addq  $12, %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    movq  -48(%rbp), %rax
+    jmp   _LBB14_0
+_LBB14_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq
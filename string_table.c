@@ -2,90 +2,111 @@
 #include <stdio.h>
 #include <string.h>
 #include "string_table.h"
+#include "arena.h"
 
-static unsigned int hash_fn(const char *key)
+static unsigned int hash_fn(const char *key, size_t len)
 {
     unsigned int h = 0;
-    unsigned const char *p = NULL;
+    unsigned const char *p = (unsigned const char *) key;
+    unsigned const char *end = p + len;
 
-    for (p = (unsigned const char *) key; *p != '\0'; p++)
+    for (; p != end; p++)
         h = MULTIPLIER * h + *p;
 
-    return h % HASH_SIZE;
+    return h;
 }
 
-static struct table_entry *new_entry(const char *src)
+static struct table_entry *find_entry(struct table_entry *entries, int capacity,
+        const char *src, size_t len, unsigned int hash)
 {
-    struct table_entry *ent = malloc(sizeof(struct table_entry));
-    const size_t alloc = strlen(src) + 1;
-    char *dst = malloc(sizeof(char) * alloc);
+    const unsigned int mask = capacity - 1;
+    unsigned int i;
 
-    strncpy(dst, src, alloc);
-    ent->str = dst;
-    ent->next = NULL;
+    for (i = hash & mask; entries[i].str; i = (i + 1) & mask) {
+        struct table_entry *ent = &entries[i];
+
+        if (ent->hash == hash && ent->len == len && !memcmp(ent->str, src, len))
+            break;
+    }
 
-    return ent;
+    return &entries[i];
 }
 
-static void free_entry(struct table_entry *entry)
+static void grow_table(struct string_table *table)
 {
-    if (!entry)
-        return;
+    struct table_entry *old = table->entries;
+    const int old_capacity = table->capacity;
+    int i;
+
+    table->capacity *= 2;
+    table->entries = calloc(table->capacity, sizeof(struct table_entry));
+
+    for (i = 0; i < old_capacity; i++) {
+        const struct table_entry *ent = &old[i];
+        struct table_entry *dst;
 
-    free(entry->str);
-    free(entry);
+        if (!ent->str)
+            continue;
+
+        dst = find_entry(table->entries, table->capacity, ent->str, ent->len, ent->hash);
+        dst->str = ent->str;
+        dst->len = ent->len;
+        dst->hash = ent->hash;
+    }
+
+    free(old);
 }
 
 struct string_table *new_string_table()
 {
     struct string_table *table = malloc(sizeof(struct string_table));
 
-    init_string_table(table);
+    table->entries = calloc(INIT_CAPACITY, sizeof(struct table_entry));
+    table->capacity = INIT_CAPACITY;
+    table->count = 0;
 
     return table;
 }
 
 void free_string_table(struct string_table *table)
 {
-    int i;
-
     if (!table)
         return;
-
-    for (i = 0; i < HASH_SIZE; i++) {
-        struct table_entry *ent = table->entries[i], *tmp;
-        if (!ent)
-            continue;
-
-        while (ent) {
-            tmp = ent->next;
-            free_entry(ent);
-            ent = tmp;
-        }
-    }
-
+    /* strings are released with the string arena */
+    free(table->entries);
     free(table);
 }
 
-void init_string_table(struct string_table *table)
+const char *insert_string(struct string_table *table, const char *src)
 {
-    int i;
-    for (i = 0; i < HASH_SIZE; i++)
-        table->entries[i] = NULL;
+    return insert_string_len(table, src, strlen(src));
 }
 
-const char *insert_string(struct string_table *table, const char *src)
+const char *insert_string_len(struct string_table *table,
+        const char *src, size_t len)
 {
+    const unsigned int h = hash_fn(src, len);
     struct table_entry *ent;
-    const unsigned int h = hash_fn(src);
+    char *dst;
+
+    ent = find_entry(table->entries, table->capacity, src, len, h);
+    if (ent->str)
+        return ent->str;
 
-    for (ent = table->entries[h]; ent; ent = ent->next)
-        if (!strcmp(src, ent->str))
-            return ent->str;
+    /* keep load factor under 1/2 */
+    if (2 * (table->count + 1) > table->capacity) {
+        grow_table(table);
+        ent = find_entry(table->entries, table->capacity, src, len, h);
+    }
+
+    dst = arena_alloc(ARENA_STRING, len + 1);
+    memcpy(dst, src, len);
+    dst[len] = '\0';
 
-    ent = new_entry(src);
-    ent->next = table->entries[h];
-    table->entries[h] = ent;
+    ent->str = dst;
+    ent->len = len;
+    ent->hash = h;
+    table->count++;
 
-    return ent->str;
+    return dst;
 }
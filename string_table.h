@@ -1,22 +1,31 @@
 #ifndef STRING_TABLE_H
 #define STRING_TABLE_H
 
-#define HASH_SIZE 1237 /* a prime number */
+#include <stddef.h>
+
+/* must be a power of 2 */
+#define INIT_CAPACITY 1024
 #define MULTIPLIER 31
 
 struct table_entry {
-    char *str;
-    struct table_entry *next;
+    const char *str;
+    unsigned int len;
+    unsigned int hash;
 };
 
+/* open addressing table. string bytes are kept in the string arena */
 struct string_table {
-    struct table_entry *entries[HASH_SIZE];
+    struct table_entry *entries;
+    int capacity;
+    int count;
 };
 
 extern struct string_table *new_string_table();
 extern void free_string_table(struct string_table *table);
 
-extern void init_string_table(struct string_table *table);
 extern const char *insert_string(struct string_table *table, const char *src);
+/* src does not need to be null terminated */
+extern const char *insert_string_len(struct string_table *table,
+        const char *src, size_t len);
 
 #endif /* _H */
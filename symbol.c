@@ -3,8 +3,12 @@
 #include <string.h>
 #include <assert.h>
 #include "symbol.h"
+#include "arena.h"
 #include "esc_seq.h"
 
+/* must be a power of 2 */
+#define INIT_BUCKET_COUNT 256
+
 int is_extern(const struct symbol *sym)
 {
     return sym && sym->is_extern;
@@ -145,42 +149,40 @@ int has_origin(const struct symbol *sym)
     return !is_origin(sym);
 }
 
-static int is_scope_begin(const struct symbol *sym)
-{
-    return sym && sym->kind == SYM_SCOPE_BEGIN;
-}
-
 struct symbol_table *new_symbol_table(void)
 {
     struct symbol_table *table;
+    int i;
     table = malloc(sizeof(struct symbol_table));
 
     table->head = NULL;
     table->tail = NULL;
+
+    table->buckets = calloc(INIT_BUCKET_COUNT, sizeof(struct symbol *));
+    table->bucket_count = INIT_BUCKET_COUNT;
+    table->visible_count = 0;
+    table->visible_tail = NULL;
+
+    for (i = 0; i < LITERAL_HASH_SIZE; i++)
+        table->literals[i] = NULL;
+
     /* 0 means global scope */
     table->current_scope_level = 0;
     /* switch scope is independent of current scope */
     table->current_switch_level = 0;
 
-    return table;
-}
-
-static void free_list(struct symbol *sym)
-{
-    struct symbol *s = sym, *tmp;
+    table->hidden_begin = 0;
+    table->hidden_end = 0;
 
-    while (s) {
-        tmp = s->next;
-        free(s);
-        s = tmp;
-    }
+    return table;
 }
 
 void free_symbol_table(struct symbol_table *table)
 {
     if (!table)
         return;
-    free_list(table->head);
+    /* symbols are released with the symbol arena */
+    free(table->buckets);
     free(table);
 }
 
@@ -320,7 +322,7 @@ static struct symbol *new_symbol(int kind, const char *name, struct data_type *t
         int scope_level)
 {
     static int next_id = 0;
-    struct symbol *sym = calloc(1, sizeof(struct symbol));
+    struct symbol *sym = arena_alloc(ARENA_SYMBOL, sizeof(struct symbol));
 
     sym->kind = kind;
     sym->name = name;
@@ -334,24 +336,6 @@ static struct symbol *new_symbol(int kind, const char *name, struct data_type *t
     return sym;
 }
 
-static struct symbol *push_symbol(struct symbol_table *table,
-        const char *name, int kind, struct data_type *type)
-{
-    struct symbol *sym = new_symbol(kind, name, type, table->current_scope_level);
-
-    if (!table->head) {
-        table->head = sym;
-        table->tail = sym;
-        return sym;
-    }
-
-    table->tail->next = sym;
-    sym->prev = table->tail;
-    table->tail = sym;
-
-    return sym;
-}
-
 static int namespace_of(int kind)
 {
     switch (kind) {
@@ -379,11 +363,99 @@ static int namespace_of(int kind)
     }
 }
 
-static int match_namespace(const struct symbol *sym, int kind)
+/* names are interned by the lexer, so the address identifies the name */
+static unsigned int hash_name(const char *name, int space)
 {
-    if (!sym)
-        return 0;
-    return namespace_of(sym->kind) == namespace_of(kind);
+    unsigned long h = (unsigned long) name / 8;
+
+    h = h ^ (h / 1024);
+    return h * 4 + space;
+}
+
+static struct symbol **find_bucket(struct symbol_table *table,
+        const char *name, int space)
+{
+    const unsigned int mask = table->bucket_count - 1;
+
+    return &table->buckets[hash_name(name, space) & mask];
+}
+
+static void rehash(struct symbol_table *table)
+{
+    struct symbol *sym;
+
+    free(table->buckets);
+    table->bucket_count *= 2;
+    table->buckets = calloc(table->bucket_count, sizeof(struct symbol *));
+
+    for (sym = table->visible_tail; sym; sym = sym->visible_prev) {
+        struct symbol **bucket = find_bucket(table, sym->name, namespace_of(sym->kind));
+
+        sym->hash_next = *bucket;
+        *bucket = sym;
+    }
+}
+
+static void show_symbol(struct symbol_table *table, struct symbol *sym)
+{
+    const int space = namespace_of(sym->kind);
+    struct symbol **bucket;
+
+    if (!sym->name || space < 0)
+        return;
+
+    if (table->visible_count >= table->bucket_count)
+        rehash(table);
+
+    bucket = find_bucket(table, sym->name, space);
+    sym->hash_next = *bucket;
+    *bucket = sym;
+
+    sym->visible_prev = table->visible_tail;
+    table->visible_tail = sym;
+    table->visible_count++;
+}
+
+static void hide_symbol(struct symbol_table *table, struct symbol *sym)
+{
+    struct symbol **link = find_bucket(table, sym->name, namespace_of(sym->kind));
+
+    while (*link != sym)
+        link = &(*link)->hash_next;
+    *link = sym->hash_next;
+    sym->hash_next = NULL;
+
+    table->visible_tail = sym->visible_prev;
+    sym->visible_prev = NULL;
+    table->visible_count--;
+}
+
+/* symbols are visible in the order they are pushed and hidden in reverse
+ * order, so the most recent ones are always on top of visible_tail */
+static void hide_scope_symbols(struct symbol_table *table)
+{
+    const int lv = table->current_scope_level;
+
+    while (table->visible_tail && table->visible_tail->scope_level > lv)
+        hide_symbol(table, table->visible_tail);
+}
+
+static struct symbol *push_symbol(struct symbol_table *table,
+        const char *name, int kind, struct data_type *type)
+{
+    struct symbol *sym = new_symbol(kind, name, type, table->current_scope_level);
+
+    if (!table->head) {
+        table->head = sym;
+        table->tail = sym;
+    } else {
+        table->tail->next = sym;
+        sym->prev = table->tail;
+        table->tail = sym;
+    }
+    show_symbol(table, sym);
+
+    return sym;
 }
 
 static int match_name(const struct symbol *sym, const char *name)
@@ -396,43 +468,31 @@ static int match_name(const struct symbol *sym, const char *name)
 static struct symbol *lookup(struct symbol_table *table,
         const char *name, enum symbol_kind kind)
 {
-    struct symbol *sym;
-    int lv = table->current_scope_level;
-
-    for (sym = table->tail; sym; sym = sym->prev) {
-        /* step down one level */
-        if (is_scope_begin(sym)) {
-            lv = sym->scope_level < lv ? sym->scope_level : lv;
-            continue;
-        }
+    struct symbol *sym, *found = NULL;
+    const int space = namespace_of(kind);
 
-        if (sym->scope_level > lv)
-            continue;
+    if (!name || space < 0)
+        return NULL;
 
-        if (match_name(sym, name) && match_namespace(sym, kind))
-            return sym;
+    /* only visible symbols are in the bucket. the latest one shadows others */
+    for (sym = *find_bucket(table, name, space); sym; sym = sym->hash_next) {
+        if (sym->name == name && namespace_of(sym->kind) == space &&
+            (sym->id < table->hidden_begin || sym->id >= table->hidden_end))
+            if (!found || sym->id > found->id)
+                found = sym;
     }
 
-    return NULL;
+    return found;
 }
 
 static struct symbol *lookup_current(struct symbol_table *table,
         const char *name, enum symbol_kind kind)
 {
-    struct symbol *sym;
-    const int lv = table->current_scope_level;
-
-    for (sym = table->tail; sym; sym = sym->prev) {
-        /* reached the beginning of current scope */
-        if (is_scope_begin(sym) && sym->scope_level < lv)
-            break;
-
-        if (sym->scope_level > lv)
-            continue;
+    struct symbol *sym = lookup(table, name, kind);
 
-        if (match_name(sym, name) && match_namespace(sym, kind))
-            return sym;
-    }
+    /* symbols in closed scopes at the same level are already hidden */
+    if (sym && sym->scope_level == table->current_scope_level)
+        return sym;
 
     return NULL;
 }
@@ -446,8 +506,11 @@ static void link_type_to_sym(struct data_type *type, struct symbol *sym)
 {
     if (is_struct_tag(sym) ||
         is_union_tag(sym) ||
-        is_enum_tag(sym) ||
-        is_func(sym))
+        is_enum_tag(sym))
+        set_symbol(type, sym);
+
+    /* implicitly declared functions have the shared int type */
+    if (is_func(sym) && is_function(type))
         set_symbol(type, sym);
 }
 
@@ -604,41 +667,66 @@ struct symbol *use_label_symbol(struct symbol_table *table, const char *label)
     return push_symbol(table, label, SYM_LABEL, type_int());
 }
 
-struct symbol *define_string_symbol(struct symbol_table *table, const char *str)
+static struct symbol **find_literal_bucket(struct symbol_table *table,
+        const char *text)
+{
+    const unsigned char *s;
+    unsigned int h = 0;
+
+    for (s = (const unsigned char *) text; *s != '\0'; s++)
+        h = 31 * h + *s;
+
+    return &table->literals[h % LITERAL_HASH_SIZE];
+}
+
+/* a literal is defined once in a translation unit however many times used */
+static struct symbol *find_literal(struct symbol_table *table,
+        const char *text, int kind)
 {
     struct symbol *sym;
-    struct symbol *str_sym = NULL;
-    struct data_type *str_type = NULL;
 
-    for (sym = table->tail; sym; sym = sym->prev)
-        if (match_name(sym, str) && is_string_literal(sym))
+    for (sym = *find_literal_bucket(table, text); sym; sym = sym->hash_next)
+        if (sym->kind == kind && match_name(sym, text))
             return sym;
 
-    str_type = type_array(type_char());
-    set_array_length(str_type, strlen(str) + 1);
+    return NULL;
+}
+
+static struct symbol *push_literal(struct symbol_table *table,
+        const char *text, int kind, struct data_type *type)
+{
+    struct symbol **bucket = find_literal_bucket(table, text);
+    struct symbol *sym = push_symbol(table, text, kind, type);
 
-    str_sym = push_symbol(table, str, SYM_STRING, str_type);
-    str_sym->is_defined = 1;
+    sym->is_defined = 1;
+    sym->hash_next = *bucket;
+    *bucket = sym;
 
-    return str_sym;
+    return sym;
 }
 
-struct symbol *define_fpnum_symbol(struct symbol_table *table, const char *str)
+struct symbol *define_string_symbol(struct symbol_table *table, const char *str)
 {
-    struct symbol *sym;
-    struct symbol *str_sym = NULL;
-    struct data_type *fp_type = NULL;
+    struct symbol *sym = find_literal(table, str, SYM_STRING);
+    struct data_type *str_type = NULL;
 
-    for (sym = table->tail; sym; sym = sym->prev)
-        if (match_name(sym, str) && is_fpnum_literal(sym))
-            return sym;
+    if (sym)
+        return sym;
 
-    fp_type = type_double();
+    str_type = type_array(type_char());
+    set_array_length(str_type, strlen(str) + 1);
+
+    return push_literal(table, str, SYM_STRING, str_type);
+}
+
+struct symbol *define_fpnum_symbol(struct symbol_table *table, const char *str)
+{
+    struct symbol *sym = find_literal(table, str, SYM_FPNUM);
 
-    str_sym = push_symbol(table, str, SYM_FPNUM, fp_type);
-    str_sym->is_defined = 1;
+    if (sym)
+        return sym;
 
-    return str_sym;
+    return push_literal(table, str, SYM_FPNUM, type_double());
 }
 
 struct symbol *find_type_name_symbol(struct symbol_table *table, const char *name)
@@ -656,6 +744,24 @@ struct symbol *define_ellipsis_symbol(struct symbol_table *table)
     return push_symbol(table, "...", SYM_ELLIPSIS, type_void());
 }
 
+int symbol_mark(const struct symbol_table *table)
+{
+    /* ids go up in the order symbols are pushed */
+    return table->tail ? table->tail->id + 1 : 0;
+}
+
+void hide_symbols_since(struct symbol_table *table, int mark)
+{
+    table->hidden_begin = mark;
+    table->hidden_end = symbol_mark(table);
+}
+
+void show_hidden_symbols(struct symbol_table *table)
+{
+    table->hidden_begin = 0;
+    table->hidden_end = 0;
+}
+
 void symbol_scope_begin(struct symbol_table *table)
 {
     push_symbol(table, NULL, SYM_SCOPE_BEGIN, NULL);
@@ -665,6 +771,7 @@ void symbol_scope_begin(struct symbol_table *table)
 void symbol_scope_end(struct symbol_table *table)
 {
     table->current_scope_level--;
+    hide_scope_symbols(table);
     push_symbol(table, NULL, SYM_SCOPE_END, NULL);
 }
 
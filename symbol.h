@@ -4,6 +4,8 @@
 #include "type.h"
 #include "position.h"
 
+#define LITERAL_HASH_SIZE 1237 /* a prime number */
+
 enum symbol_kind {
     SYM_SCOPE_BEGIN,
     SYM_SCOPE_END,
@@ -41,6 +43,10 @@ struct symbol {
     struct symbol *prev;
     struct symbol *orig;
 
+    /* links for visible symbols in symbol table index */
+    struct symbol *hash_next;
+    struct symbol *visible_prev;
+
     /* flags */
     char is_extern;
     char is_static;
@@ -51,6 +57,8 @@ struct symbol {
     char is_used;
     char is_variadic;
     char is_builtin;
+    /* named in an expression while parsing */
+    char is_referenced;
 
     /* bit field */
     char is_bitfield;
@@ -62,8 +70,23 @@ struct symbol_table {
     struct symbol *head;
     struct symbol *tail;
 
+    /* visible symbols hashed by name and name space. symbols are
+     * removed from the index when their scope ends */
+    struct symbol **buckets;
+    int bucket_count;
+    int visible_count;
+    struct symbol *visible_tail;
+
+    /* string and floating point literals by text. they are never hidden,
+     * and linked with hash_next as they are not in the index above */
+    struct symbol *literals[LITERAL_HASH_SIZE];
+
     int current_scope_level;
     int current_switch_level;
+
+    /* symbols with ids in the range are not looked up */
+    int hidden_begin;
+    int hidden_end;
 };
 
 /* symbol */
@@ -120,6 +143,12 @@ extern struct symbol *find_type_name_symbol(struct symbol_table *table, const ch
 /* ellipsis symbol */
 extern struct symbol *define_ellipsis_symbol(struct symbol_table *table);
 
+/* symbols defined from a mark on can be hidden for a while. a deferred
+ * body sees only the symbols defined before it */
+extern int symbol_mark(const struct symbol_table *table);
+extern void hide_symbols_since(struct symbol_table *table, int mark);
+extern void show_hidden_symbols(struct symbol_table *table);
+
 /* scope symbol */
 extern void symbol_scope_begin(struct symbol_table *table);
 extern void symbol_scope_end(struct symbol_table *table);
@@ -0,0 +1,3 @@
+#define D defined(X)
+#if D
+#endif
@@ -0,0 +1,3 @@
+static int f(void) { return sizeof(T); }
+int main(void) { return f(); }
+typedef char T;
@@ -0,0 +1,3 @@
+static int f(void) { return g; }
+int main(void) { return f(); }
+int g = 3;
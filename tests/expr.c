@@ -63,6 +63,21 @@ int main()
         assert(3, a);
         assert(1, a /= 3);
     }
+    {
+        long a = 3;
+        unsigned int b = 7;
+
+        a <<= 40;
+        assert(1, a / 3 == (long) 1 << 40);
+        a /= -3;
+        assert(1, a == -((long) 1 << 40));
+        assert(1, a / 1024 == -((long) 1 << 30));
+
+        b = -b;
+        assert(1, b / 2 > 0);
+        b /= 3;
+        assert(1, b > 0);
+    }
     {
         int a = 7;
         int b = 2;
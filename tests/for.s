@@ -0,0 +1,516 @@
+    .data
+
+    .text
+
+_L_str_70:
+    .asciz "abc"
+
+    .global _main
+_main:
+    pushq %rbp
+    movq  %rsp, %rbp
+    subq  $80, %rsp
+## func params
+## func body
+## local scalar init
+    leaq  -4(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-pre
+## assign
+    leaq  -8(%rbp), %rax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB1_1:
+    movl  -8(%rbp), %eax
+    pushq %rax
+    movl  $10, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setle %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB1_2
+## for-body
+## assign
+    leaq  -4(%rbp), %rax
+    pushq %rax
+    movl  -4(%rbp), %eax
+    pushq %rax
+    movl  -8(%rbp), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-post
+_LBB1_4:
+    leaq  -8(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB1_1
+_LBB1_2:
+    subq  $16, %rsp
+    movl  $55, %eax
+    movl  %eax, 8(%rsp)
+    movl  -4(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## for-pre
+## assign
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB2_1:
+    movl  -12(%rbp), %eax
+    pushq %rax
+    movl  $10, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB2_2
+## for-body
+## assign
+    leaq  -12(%rbp), %rax
+    pushq %rax
+    movl  $2, %eax
+    pushq %rax
+    movl  -12(%rbp), %eax
+    popq  %rdx
+    imull %edx, %eax
+    pushq %rax
+    movl  $1, %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-post
+_LBB2_4:
+    jmp   _LBB2_1
+_LBB2_2:
+    subq  $16, %rsp
+    movl  $15, %eax
+    movl  %eax, 8(%rsp)
+    movl  -12(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -20(%rbp), %rax
+    pushq %rax
+    movl  $11, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-pre
+## for-cond
+_LBB3_1:
+    movl  -20(%rbp), %eax
+    pushq %rax
+    movl  $20, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setle %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB3_2
+## for-body
+## assign
+    leaq  -16(%rbp), %rax
+    pushq %rax
+    movl  -16(%rbp), %eax
+    pushq %rax
+    movl  -20(%rbp), %eax
+    popq  %rdx
+    addl  %edx, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    leaq  -20(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+## for-post
+_LBB3_4:
+    jmp   _LBB3_1
+_LBB3_2:
+    subq  $16, %rsp
+    movl  $155, %eax
+    movl  %eax, 8(%rsp)
+    movl  -16(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## for-pre
+## assign
+    leaq  -24(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB4_1:
+    movl  -24(%rbp), %eax
+    pushq %rax
+    movl  $10, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB4_2
+## for-body
+## if-cond
+    movl  -24(%rbp), %eax
+    pushq %rax
+    movl  $6, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB5_3
+## if-then
+    jmp   _LBB4_2
+    jmp   _LBB5_2
+## if-else
+_LBB5_3:
+_LBB5_2:
+## for-post
+_LBB4_4:
+    leaq  -24(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB4_1
+_LBB4_2:
+    subq  $16, %rsp
+    movl  $6, %eax
+    movl  %eax, 8(%rsp)
+    movl  -24(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -28(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-pre
+## for-cond
+_LBB6_1:
+    movl  $1, %eax
+    cmpl  $0, %eax
+    je    _LBB6_2
+## for-body
+## if-cond
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movl  $3, %eax
+    movl  %eax, %edi
+    popq  %rax
+    cltd
+    idivl %edi
+    pushq %rax
+    movl  $4, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB7_3
+## if-then
+## if-cond
+    movl  -28(%rbp), %eax
+    pushq %rax
+    movl  $6, %eax
+    movl  %eax, %edi
+    popq  %rax
+    cltd
+    idivl %edi
+    pushq %rax
+    movl  $2, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB8_3
+## if-then
+    jmp   _LBB6_2
+    jmp   _LBB8_2
+## if-else
+_LBB8_3:
+_LBB8_2:
+    jmp   _LBB7_2
+## if-else
+_LBB7_3:
+_LBB7_2:
+    leaq  -28(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+## for-post
+_LBB6_4:
+    jmp   _LBB6_1
+_LBB6_2:
+    subq  $16, %rsp
+    movl  $12, %eax
+    movl  %eax, 8(%rsp)
+    movl  -28(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## local scalar init
+    leaq  -36(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-pre
+## assign
+    leaq  -36(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-cond
+_LBB9_1:
+    movl  -36(%rbp), %eax
+    pushq %rax
+    movl  $20, %eax
+    movl  %eax, %edx
+    popq  %rax
+    cmpl  %edx, %eax
+    setl  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB9_2
+## for-body
+## if-cond
+    movl  -36(%rbp), %eax
+    pushq %rax
+    movl  $3, %eax
+    movl  %eax, %edi
+    popq  %rax
+    cltd
+    idivl %edi
+    pushq %rax
+    movl  $3, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB10_3
+## if-then
+## add-assign
+    leaq  -32(%rbp), %rax
+    pushq %rax
+    movl  -36(%rbp), %eax
+    popq  %rdx
+    addl  %eax, (%rdx)
+    movl  (%rdx), %eax
+    jmp   _LBB9_4
+    jmp   _LBB10_2
+## if-else
+_LBB10_3:
+_LBB10_2:
+## for-post
+_LBB9_4:
+    leaq  -36(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+    jmp   _LBB9_1
+_LBB9_2:
+    subq  $16, %rsp
+    movl  $30, %eax
+    movl  %eax, 8(%rsp)
+    movl  -32(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -40(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## for-pre
+## for-cond
+_LBB11_1:
+    movl  $1, %eax
+    cmpl  $0, %eax
+    je    _LBB11_2
+## for-body
+## if-cond
+    movl  -40(%rbp), %eax
+    pushq %rax
+    movl  $10, %eax
+    popq  %rdx
+    cmpl  %edx, %eax
+    sete  %al
+    movzbl %al, %eax
+    cmpl  $0, %eax
+    je    _LBB12_3
+## if-then
+    jmp   _LBB11_2
+    jmp   _LBB12_2
+## if-else
+_LBB12_3:
+_LBB12_2:
+    leaq  -40(%rbp), %rax
+    movq  %rax, %rdx
+    movl  (%rax), %eax
+    movl  %eax, %ecx
+    addl  $1, %ecx
+    movl  %ecx, (%rdx)
+## for-post
+_LBB11_4:
+    jmp   _LBB11_1
+_LBB11_2:
+    subq  $16, %rsp
+    movl  $10, %eax
+    movl  %eax, 8(%rsp)
+    movl  -40(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -44(%rbp), %rax
+    pushq %rax
+    movl  $19, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## if-cond
+    movl  $0, %eax
+    cmpl  $0, %eax
+    je    _LBB13_3
+## if-then
+    jmp   _LBB13_2
+## if-else
+_LBB13_3:
+_LBB13_2:
+## assign
+    leaq  -44(%rbp), %rax
+    pushq %rax
+    movl  $22, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+    subq  $16, %rsp
+    movl  $22, %eax
+    movl  %eax, 8(%rsp)
+    movl  -44(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+## local scalar init
+    leaq  -56(%rbp), %rax
+    pushq %rax
+    leaq  _L_str_70(%rip), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -64(%rbp), %rax
+    pushq %rax
+    movq  -56(%rbp), %rax
+    popq  %rdx
+    movq  %rax, (%rdx)
+## local scalar init
+    leaq  -68(%rbp), %rax
+    pushq %rax
+    movl  $0, %eax
+    popq  %rdx
+    movl  %eax, (%rdx)
+## while-cond
+_LBB14_4:
+    movq  -64(%rbp), %rax
+    movb  (%rax), %al
+    cmpb  $0, %al
+    je    _LBB14_2
+## while-body
+## add-assign
+    leaq  -68(%rbp), %rax
+    pushq %rax
+    movq  -64(%rbp), %rax
+    movb  (%rax), %al
+    movsbl %al, %eax
+    popq  %rdx
+    addl  %eax, (%rdx)
+    movl  (%rdx), %eax
+    leaq  -64(%rbp), %rax
+    movq  %rax, %rdx
+    movq  (%rax), %rax
+    movq  %rax, %rcx
+    addq  $1, %rcx
+    movq  %rcx, (%rdx)
+    jmp   _LBB14_4
+_LBB14_2:
+    subq  $16, %rsp
+    movl  $294, %eax
+    movl  %eax, 8(%rsp)
+    movl  -68(%rbp), %eax
+    movl  %eax, (%rsp)
+    movl  8(%rsp), %edi
+    movl  (%rsp), %esi
+    callq _assert
+    addq  $16, %rsp
+    movl  $0, %eax
+    jmp   _LBB0_0
+_LBB0_0:
+    movq  %rbp, %rsp
+    popq  %rbp
+    retq